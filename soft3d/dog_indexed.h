@@ -0,0 +1,28326 @@
+// Generated by meshtool optimize from dog_indexed.h (cache size 16).
+
+static Vertex dog_vertices[] = {
+    { 1.8538f, -25.8554f, 31.6067f, 0.5209f, 0.0959f },
+    { 1.8973f, -25.8536f, 31.5632f, 0.5215f, 0.0951f },
+    { 1.8565f, -25.7918f, 31.6733f, 0.5211f, 0.0975f },
+    { 1.9354f, -25.7667f, 31.6031f, 0.5229f, 0.0963f },
+    { 1.9363f, -25.8735f, 31.5023f, 0.5222f, 0.0944f },
+    { 1.8484f, -25.6648f, 31.819f, 0.5213f, 0.0992f },
+    { 1.9943f, -25.8179f, 31.492f, 0.5239f, 0.0945f },
+    { 1.909f, -25.962f, 31.4487f, 0.5207f, 0.0923f },
+    { 2.0122f, -25.6347f, 31.6359f, 0.5254f, 0.0981f },
+    { 1.99f, -25.9492f, 31.3868f, 0.5231f, 0.0918f },
+    { 1.8224f, -26.0997f, 31.3693f, 0.5193f, 0.0902f },
+    { 2.1394f, -25.6915f, 31.3925f, 0.5283f, 0.0949f },
+    { 2.0096f, -25.3886f, 31.8937f, 0.5271f, 0.1038f },
+    { 2.1758f, -25.3964f, 31.6724f, 0.5302f, 0.1014f },
+    { 1.7742f, -25.349f, 32.1612f, 0.5238f, 0.1071f },
+    { 1.6746f, -25.5913f, 32.1156f, 0.5192f, 0.103f },
+    { 2.1465f, -25.1065f, 31.9483f, 0.532f, 0.1081f },
+    { 1.5206f, -25.3034f, 32.4167f, 0.5207f, 0.1103f },
+    { 1.4686f, -25.5409f, 32.3799f, 0.517f, 0.1068f },
+    { 1.8759f, -25.0801f, 32.21f, 0.5279f, 0.1113f },
+    { 1.589f, -25.0477f, 32.4585f, 0.524f, 0.1145f },
+    { 1.9093f, -24.8054f, 32.2737f, 0.5309f, 0.1159f },
+    { 1.6314f, -24.7879f, 32.5179f, 0.5266f, 0.1189f },
+    { 1.3644f, -25.0323f, 32.6482f, 0.5209f, 0.1167f },
+    { 1.2997f, -25.2777f, 32.6017f, 0.5182f, 0.1124f },
+    { 1.2517f, -25.5113f, 32.5662f, 0.5152f, 0.1083f },
+    { 1.4024f, -24.7799f, 32.7085f, 0.523f, 0.1211f },
+    { 1.0887f, -25.2688f, 32.737f, 0.5158f, 0.1137f },
+    { 1.0277f, -25.5003f, 32.6964f, 0.5134f, 0.1097f },
+    { 1.16f, -25.0289f, 32.7954f, 0.5181f, 0.1181f },
+    { 0.865f, -25.2734f, 32.8431f, 0.5133f, 0.1145f },
+    { 0.8009f, -25.5059f, 32.7922f, 0.5112f, 0.1098f },
+    { 0.934f, -25.0327f, 32.9161f, 0.5151f, 0.1191f },
+    { 1.1876f, -24.7785f, 32.8594f, 0.5197f, 0.1227f },
+    { 0.9527f, -24.7807f, 32.9844f, 0.5163f, 0.1239f },
+    { 0.6692f, -25.0439f, 33.0065f, 0.5116f, 0.1197f },
+    { 0.613f, -25.2884f, 32.9234f, 0.5103f, 0.1148f },
+    { 0.5581f, -25.524f, 32.8641f, 0.5089f, 0.11f },
+    { 0.6804f, -24.7892f, 33.0782f, 0.5125f, 0.1246f },
+    { 0.3174f, -25.3108f, 32.9813f, 0.5069f, 0.1149f },
+    { 0.2863f, -25.5503f, 32.9226f, 0.506f, 0.1099f },
+    { 0.3485f, -25.0628f, 33.0629f, 0.5075f, 0.1198f },
+    { -0.0001f, -25.3238f, 33.0046f, 0.5031f, 0.1148f },
+    { -0.0001f, -25.5655f, 32.9485f, 0.5031f, 0.1099f },
+    { -0.2864f, -25.5503f, 32.9226f, 0.5003f, 0.1097f },
+    { -0.0001f, -25.0742f, 33.0825f, 0.5031f, 0.1197f },
+    { -0.3175f, -25.3108f, 32.9813f, 0.4995f, 0.1146f },
+    { -0.5582f, -25.524f, 32.8641f, 0.4975f, 0.1095f },
+    { -0.6131f, -25.2884f, 32.9234f, 0.4961f, 0.1143f },
+    { -0.8011f, -25.5059f, 32.7922f, 0.4953f, 0.1092f },
+    { -0.3487f, -25.0628f, 33.0629f, 0.4988f, 0.1195f },
+    { -0.f, -24.8177f, 33.1551f, 0.5031f, 0.1246f },
+    { -0.6693f, -25.0439f, 33.0065f, 0.4948f, 0.1191f },
+    { 0.3538f, -24.8067f, 33.1356f, 0.508f, 0.1247f },
+    { -0.3538f, -24.8067f, 33.1356f, 0.4984f, 0.1244f },
+    { -0.f, -24.5481f, 33.2124f, 0.5031f, 0.1295f },
+    { 0.3489f, -24.5372f, 33.1932f, 0.5083f, 0.1296f },
+    { -0.349f, -24.5372f, 33.1932f, 0.4981f, 0.1293f },
+    { 0.6717f, -24.5208f, 33.1374f, 0.5131f, 0.1295f },
+    { -0.f, -24.2596f, 33.2444f, 0.5032f, 0.1345f },
+    { 0.3498f, -24.2494f, 33.2296f, 0.5087f, 0.1347f },
+    { 0.9422f, -24.5149f, 33.0466f, 0.5172f, 0.1287f },
+    { 0.6683f, -24.235f, 33.1827f, 0.5138f, 0.1345f },
+    { 1.1812f, -24.5147f, 32.9238f, 0.5209f, 0.1274f },
+    { 0.924f, -24.2327f, 33.101f, 0.5179f, 0.1338f },
+    { 1.4092f, -24.515f, 32.7721f, 0.5246f, 0.1257f },
+    { 1.1502f, -24.2344f, 32.9834f, 0.5217f, 0.1324f },
+    { 1.6406f, -24.5161f, 32.5822f, 0.5286f, 0.1235f },
+    { 1.3802f, -24.2318f, 32.8288f, 0.5258f, 0.1307f },
+    { 1.1128f, -23.9455f, 33.0504f, 0.5223f, 0.1376f },
+    { 1.6094f, -24.2245f, 32.6388f, 0.5301f, 0.1286f },
+    { 0.9074f, -23.9422f, 33.1613f, 0.5186f, 0.1389f },
+    { 1.3257f, -23.9403f, 32.9019f, 0.5264f, 0.1359f },
+    { 0.6679f, -23.9407f, 33.2345f, 0.5144f, 0.1397f },
+    { 0.3528f, -23.9514f, 33.2702f, 0.5091f, 0.1399f },
+    { 0.9019f, -23.6512f, 33.2411f, 0.5194f, 0.1441f },
+    { -0.f, -23.9597f, 33.2786f, 0.5032f, 0.1397f },
+    { 0.6682f, -23.6465f, 33.3132f, 0.515f, 0.1449f },
+    { 0.3542f, -23.6515f, 33.3403f, 0.5094f, 0.1451f },
+    { 0.8994f, -23.3758f, 33.3514f, 0.52f, 0.1492f },
+    { -0.3499f, -24.2494f, 33.2296f, 0.4977f, 0.1343f },
+    { 0.6652f, -23.3537f, 33.4481f, 0.5154f, 0.1506f },
+    { 0.8919f, -23.1316f, 33.5031f, 0.5202f, 0.1542f },
+    { 0.3523f, -23.3455f, 33.4759f, 0.5096f, 0.151f },
+    { 1.0692f, -23.2014f, 33.2988f, 0.5242f, 0.1511f },
+    { -0.f, -23.6565f, 33.3426f, 0.5032f, 0.145f },
+    { -0.f, -23.3449f, 33.4726f, 0.5032f, 0.1509f },
+    { -0.3542f, -23.6515f, 33.3403f, 0.4971f, 0.1448f },
+    { -0.3523f, -23.3455f, 33.4759f, 0.497f, 0.1506f },
+    { -0.f, -23.0202f, 33.7046f, 0.5032f, 0.1578f },
+    { 0.3454f, -23.029f, 33.7127f, 0.5094f, 0.1578f },
+    { -0.3454f, -23.029f, 33.7127f, 0.4971f, 0.1575f },
+    { 0.6548f, -23.0635f, 33.6683f, 0.5153f, 0.1569f },
+    { -0.f, -22.7068f, 33.9496f, 0.5032f, 0.1646f },
+    { 0.3396f, -22.7258f, 33.9625f, 0.5092f, 0.1646f },
+    { 0.9202f, -22.9309f, 33.6209f, 0.5211f, 0.1583f },
+    { 0.7061f, -22.7349f, 33.9825f, 0.5159f, 0.1648f },
+    { -0.f, -22.4289f, 34.1184f, 0.5032f, 0.1702f },
+    { 0.341f, -22.4597f, 34.1374f, 0.5091f, 0.1701f },
+    { -0.3397f, -22.7258f, 33.9625f, 0.4973f, 0.1642f },
+    { -0.341f, -22.4597f, 34.1374f, 0.4974f, 0.1698f },
+    { -0.6548f, -23.0635f, 33.6683f, 0.4915f, 0.1562f },
+    { -0.f, -22.155f, 34.2529f, 0.5032f, 0.1755f },
+    { -0.7061f, -22.7349f, 33.9825f, 0.4909f, 0.164f },
+    { -0.3464f, -22.195f, 34.2776f, 0.4973f, 0.1749f },
+    { -0.6394f, -22.4818f, 34.1865f, 0.4924f, 0.1698f },
+    { -0.8527f, -22.425f, 34.2574f, 0.4889f, 0.1713f },
+    { -0.666f, -22.2448f, 34.3278f, 0.492f, 0.1745f },
+    { -0.9321f, -22.2344f, 34.3792f, 0.4877f, 0.1752f },
+    { -0.9442f, -22.4785f, 34.2072f, 0.4874f, 0.17f },
+    { -0.6884f, -21.96f, 34.474f, 0.4917f, 0.18f },
+    { -0.99f, -21.9818f, 34.5117f, 0.4868f, 0.1801f },
+    { -0.3527f, -21.8961f, 34.4235f, 0.4972f, 0.1806f },
+    { -1.0265f, -21.6871f, 34.647f, 0.4861f, 0.1856f },
+    { -0.702f, -21.6524f, 34.6204f, 0.4914f, 0.1858f },
+    { -0.f, -21.8537f, 34.3951f, 0.5032f, 0.1812f },
+    { -0.3564f, -21.592f, 34.5762f, 0.4972f, 0.1864f },
+    { 0.3527f, -21.8961f, 34.4235f, 0.5092f, 0.1809f },
+    { -0.f, -21.5554f, 34.5498f, 0.5031f, 0.1869f },
+    { 0.3463f, -22.195f, 34.2776f, 0.5091f, 0.1752f },
+    { 0.3563f, -21.592f, 34.5762f, 0.5092f, 0.1867f },
+    { -0.f, -21.2907f, 34.7217f, 0.5031f, 0.1922f },
+    { 0.702f, -21.6525f, 34.6204f, 0.5151f, 0.1864f },
+    { -0.3535f, -21.3115f, 34.7368f, 0.4972f, 0.1919f },
+    { 0.3534f, -21.3115f, 34.7368f, 0.5092f, 0.1922f },
+    { -0.f, -21.0336f, 34.8784f, 0.5031f, 0.1973f },
+    { 0.3531f, -21.0388f, 34.8799f, 0.5092f, 0.1974f },
+    { -0.3531f, -21.0388f, 34.8799f, 0.4971f, 0.1971f },
+    { 0.7022f, -21.3471f, 34.7618f, 0.5152f, 0.192f },
+    { -0.f, -20.7583f, 34.9872f, 0.5031f, 0.2022f },
+    { 0.7045f, -21.0477f, 34.8831f, 0.5153f, 0.1974f },
+    { 0.3642f, -20.7583f, 34.9804f, 0.5095f, 0.2023f },
+    { -0.f, -20.3925f, 35.0902f, 0.5031f, 0.2083f },
+    { 1.0526f, -21.0537f, 34.8866f, 0.5213f, 0.1974f },
+    { -0.3643f, -20.7583f, 34.9804f, 0.4968f, 0.202f },
+    { 0.7243f, -20.7584f, 34.9689f, 0.5158f, 0.2023f },
+    { 0.3747f, -20.3925f, 35.0798f, 0.5098f, 0.2084f },
+    { 1.0759f, -20.7588f, 34.9617f, 0.522f, 0.2023f },
+    { 0.743f, -20.3927f, 35.0592f, 0.5163f, 0.2083f },
+    { 1.0984f, -20.3934f, 35.0388f, 0.5227f, 0.2083f },
+    { 1.4463f, -20.3941f, 35.009f, 0.529f, 0.2081f },
+    { 0.3722f, -19.864f, 35.22f, 0.5099f, 0.2171f },
+    { 1.4151f, -20.7598f, 34.9456f, 0.528f, 0.2023f },
+    { -0.f, -19.864f, 35.2295f, 0.5031f, 0.217f },
+    { -0.3747f, -20.3925f, 35.0798f, 0.4965f, 0.2081f },
+    { -0.f, -19.2428f, 35.3344f, 0.5031f, 0.2271f },
+    { -0.3722f, -19.864f, 35.22f, 0.4964f, 0.2168f },
+    { -0.7243f, -20.7584f, 34.9689f, 0.4906f, 0.2018f },
+    { -0.743f, -20.3927f, 35.0592f, 0.49f, 0.2079f },
+    { -0.7045f, -21.0477f, 34.8831f, 0.4911f, 0.1969f },
+    { -1.0984f, -20.3934f, 35.0388f, 0.4836f, 0.2076f },
+    { -0.7023f, -21.3471f, 34.7618f, 0.4913f, 0.1915f },
+    { -1.0417f, -21.3704f, 34.7768f, 0.4856f, 0.1913f },
+    { -1.0526f, -21.0537f, 34.8866f, 0.4852f, 0.1968f },
+    { -1.0759f, -20.7588f, 34.9617f, 0.4844f, 0.2017f },
+    { -1.3807f, -21.0559f, 34.8791f, 0.4795f, 0.1966f },
+    { -1.4151f, -20.7598f, 34.9456f, 0.4785f, 0.2014f },
+    { -1.4464f, -20.3941f, 35.009f, 0.4773f, 0.2072f },
+    { -1.3478f, -21.3755f, 34.7788f, 0.4805f, 0.1912f },
+    { -1.7379f, -20.7618f, 34.9072f, 0.4727f, 0.201f },
+    { -1.3109f, -21.6849f, 34.6621f, 0.4814f, 0.1858f },
+    { -1.672f, -21.0538f, 34.8494f, 0.4745f, 0.1964f },
+    { -1.5963f, -21.3561f, 34.7648f, 0.4762f, 0.1915f },
+    { -1.2642f, -21.9508f, 34.5465f, 0.4823f, 0.181f },
+    { -1.5364f, -21.6349f, 34.6715f, 0.4776f, 0.1868f },
+    { -1.189f, -22.2196f, 34.3956f, 0.4836f, 0.1757f },
+    { -1.5179f, -21.8565f, 34.588f, 0.4782f, 0.1829f },
+    { -1.6946f, -21.5643f, 34.6812f, 0.4749f, 0.1879f },
+    { -1.0579f, -22.5127f, 34.1254f, 0.4854f, 0.1687f },
+    { -1.7948f, -21.3586f, 34.7359f, 0.4729f, 0.1913f },
+    { -1.9223f, -21.07f, 34.8018f, 0.4701f, 0.1958f },
+    { -1.9508f, -21.4293f, 34.6932f, 0.4703f, 0.1899f },
+    { -2.0301f, -20.7784f, 34.8458f, 0.4675f, 0.2001f },
+    { -2.1273f, -21.1272f, 34.7401f, 0.4666f, 0.1944f },
+    { -2.2776f, -20.8233f, 34.7604f, 0.463f, 0.1986f },
+    { -2.2992f, -21.1887f, 34.6713f, 0.4636f, 0.1929f },
+    { -2.116f, -20.404f, 34.8855f, 0.465f, 0.2056f },
+    { -2.4911f, -20.8669f, 34.6526f, 0.4589f, 0.197f },
+    { -1.7923f, -20.3942f, 34.9603f, 0.471f, 0.2066f },
+    { -2.3979f, -20.4341f, 34.7774f, 0.4596f, 0.2041f },
+    { -2.1778f, -19.8673f, 34.9386f, 0.4625f, 0.2137f },
+    { -1.8333f, -19.8651f, 35.0309f, 0.4692f, 0.2147f },
+    { -1.47f, -19.8656f, 35.0999f, 0.4761f, 0.2155f },
+    { -2.2097f, -19.2407f, 34.9667f, 0.4605f, 0.2232f },
+    { -1.107f, -19.8651f, 35.1542f, 0.4829f, 0.2161f },
+    { -1.8578f, -19.2435f, 35.0749f, 0.4676f, 0.2243f },
+    { -1.4857f, -19.2439f, 35.1645f, 0.4749f, 0.2252f },
+    { -2.2063f, -18.5967f, 34.9315f, 0.459f, 0.2332f },
+    { -1.8622f, -18.5981f, 35.0479f, 0.4663f, 0.2343f },
+    { -1.1085f, -19.2438f, 35.2405f, 0.4822f, 0.226f },
+    { -1.4935f, -18.5981f, 35.1487f, 0.4738f, 0.2353f },
+    { -0.742f, -19.8643f, 35.194f, 0.4896f, 0.2165f },
+    { -0.3644f, -19.243f, 35.3262f, 0.4963f, 0.2269f },
+    { -0.7326f, -19.2435f, 35.2965f, 0.4894f, 0.2265f },
+    { -1.1094f, -18.5996f, 35.2304f, 0.4815f, 0.2361f },
+    { -0.3589f, -18.5998f, 35.3238f, 0.4962f, 0.2371f },
+    { -0.726f, -18.6009f, 35.2898f, 0.4891f, 0.2367f },
+    { -0.f, -18.5987f, 35.3345f, 0.5031f, 0.2373f },
+    { -0.3546f, -17.915f, 35.2476f, 0.4961f, 0.2479f },
+    { 0.3643f, -19.243f, 35.3262f, 0.5099f, 0.2271f },
+    { -0.f, -17.9134f, 35.2604f, 0.5031f, 0.2481f },
+    { 0.3589f, -18.5998f, 35.3238f, 0.51f, 0.2373f },
+    { 0.742f, -19.8643f, 35.194f, 0.5166f, 0.217f },
+    { 0.7325f, -19.2435f, 35.2965f, 0.5168f, 0.227f },
+    { 1.107f, -19.8651f, 35.1542f, 0.5233f, 0.2168f },
+    { 1.1085f, -19.2438f, 35.2405f, 0.5239f, 0.2267f },
+    { 1.4699f, -19.8656f, 35.0999f, 0.5301f, 0.2165f },
+    { 1.4857f, -19.2439f, 35.1645f, 0.5311f, 0.2263f },
+    { 1.8333f, -19.8651f, 35.0309f, 0.5369f, 0.2159f },
+    { 1.8577f, -19.2435f, 35.0749f, 0.5384f, 0.2256f },
+    { 1.7922f, -20.3942f, 34.9603f, 0.5353f, 0.2077f },
+    { 2.2096f, -19.2407f, 34.9667f, 0.5454f, 0.2247f },
+    { 2.1777f, -19.8673f, 34.9386f, 0.5435f, 0.215f },
+    { 1.7378f, -20.7618f, 34.9072f, 0.5337f, 0.202f },
+    { 2.116f, -20.404f, 34.8855f, 0.5413f, 0.2068f },
+    { 1.3806f, -21.0559f, 34.8791f, 0.527f, 0.1975f },
+    { 2.0301f, -20.7784f, 34.8458f, 0.5389f, 0.2013f },
+    { 1.0417f, -21.3704f, 34.7768f, 0.5209f, 0.192f },
+    { 1.672f, -21.0538f, 34.8494f, 0.5321f, 0.1974f },
+    { 1.3477f, -21.3755f, 34.7788f, 0.5262f, 0.1921f },
+    { 1.0264f, -21.6871f, 34.647f, 0.5206f, 0.1863f },
+    { 1.5963f, -21.3561f, 34.7648f, 0.5304f, 0.1925f },
+    { 0.6884f, -21.96f, 34.474f, 0.5149f, 0.1806f },
+    { 1.3108f, -21.6849f, 34.6621f, 0.5254f, 0.1868f },
+    { 0.99f, -21.9818f, 34.5117f, 0.52f, 0.1809f },
+    { 0.666f, -22.2448f, 34.3278f, 0.5147f, 0.1751f },
+    { 1.2642f, -21.9508f, 34.5465f, 0.5246f, 0.1819f },
+    { 0.6394f, -22.4818f, 34.1865f, 0.5143f, 0.1703f },
+    { 0.8527f, -22.425f, 34.2574f, 0.5179f, 0.172f },
+    { 0.9442f, -22.4785f, 34.2072f, 0.5196f, 0.1709f },
+    { 0.9321f, -22.2344f, 34.3792f, 0.5191f, 0.176f },
+    { 1.189f, -22.2196f, 34.3956f, 0.5234f, 0.1767f },
+    { 1.0579f, -22.5127f, 34.1254f, 0.5218f, 0.1697f },
+    { 1.5179f, -21.8565f, 34.588f, 0.5287f, 0.184f },
+    { 0.9609f, -22.6717f, 33.9271f, 0.5209f, 0.1652f },
+    { 1.2706f, -22.3332f, 34.256f, 0.5251f, 0.1739f },
+    { 1.025f, -22.7857f, 33.6297f, 0.5237f, 0.1604f },
+    { 1.1538f, -22.6075f, 33.8252f, 0.5249f, 0.1653f },
+    { 1.1885f, -22.6621f, 33.5541f, 0.5276f, 0.1614f },
+    { 1.2162f, -22.5103f, 33.9903f, 0.5251f, 0.1686f },
+    { 1.3904f, -22.5112f, 33.6394f, 0.5303f, 0.1651f },
+    { 1.4413f, -22.454f, 33.7802f, 0.5302f, 0.1676f },
+    { 1.3717f, -22.3821f, 34.0925f, 0.5274f, 0.1717f },
+    { 1.5545f, -22.3634f, 33.8772f, 0.5317f, 0.1701f },
+    { 1.7327f, -22.3168f, 33.6687f, 0.5361f, 0.1689f },
+    { 1.5535f, -22.1575f, 34.3504f, 0.5296f, 0.1777f },
+    { 1.6453f, -22.3733f, 33.567f, 0.5352f, 0.1668f },
+    { 1.5279f, -22.0282f, 34.4893f, 0.529f, 0.1807f },
+    { 1.8686f, -21.8188f, 34.5657f, 0.5346f, 0.1847f },
+    { 1.7478f, -21.6867f, 34.6368f, 0.5327f, 0.187f },
+    { 1.6945f, -21.5643f, 34.6812f, 0.5319f, 0.189f },
+    { 1.5364f, -21.6349f, 34.6715f, 0.5292f, 0.1878f },
+    { 1.7948f, -21.3586f, 34.7359f, 0.5338f, 0.1924f },
+    { 1.9508f, -21.4293f, 34.6932f, 0.5364f, 0.1911f },
+    { 1.9222f, -21.07f, 34.8018f, 0.5365f, 0.1969f },
+    { 2.1272f, -21.1272f, 34.7401f, 0.54f, 0.1956f },
+    { 2.2776f, -20.8233f, 34.7604f, 0.5434f, 0.1999f },
+    { 2.2992f, -21.1887f, 34.6713f, 0.543f, 0.1942f },
+    { 2.3978f, -20.4341f, 34.7774f, 0.5466f, 0.2054f },
+    { 2.491f, -20.8669f, 34.6526f, 0.5475f, 0.1983f },
+    { 2.1015f, -21.4958f, 34.6444f, 0.5389f, 0.1898f },
+    { 2.4504f, -21.2177f, 34.602f, 0.5457f, 0.1931f },
+    { 2.2842f, -21.4858f, 34.597f, 0.5421f, 0.1895f },
+    { 2.1894f, -21.6913f, 34.5272f, 0.5402f, 0.1863f },
+    { 2.5881f, -21.1803f, 34.5147f, 0.5487f, 0.1929f },
+    { 1.8673f, -21.9916f, 34.4037f, 0.5348f, 0.1809f },
+    { 2.5144f, -21.3711f, 34.5131f, 0.5466f, 0.1904f },
+    { 2.173f, -21.8418f, 34.4113f, 0.54f, 0.1833f },
+    { 2.4735f, -21.5449f, 34.4526f, 0.5456f, 0.1877f },
+    { 2.8017f, -20.9393f, 34.412f, 0.5539f, 0.1952f },
+    { 2.8076f, -21.1238f, 34.3548f, 0.5535f, 0.1923f },
+    { 2.6809f, -20.8796f, 34.5239f, 0.5514f, 0.197f },
+    { 2.6541f, -20.4549f, 34.6327f, 0.5518f, 0.2039f },
+    { 2.9012f, -20.4373f, 34.4483f, 0.5573f, 0.2025f },
+    { 2.4839f, -19.8761f, 34.8144f, 0.5495f, 0.2138f },
+    { 2.7655f, -19.8773f, 34.656f, 0.5554f, 0.2124f },
+    { 2.5265f, -19.2335f, 34.8351f, 0.5519f, 0.2236f },
+    { 2.2063f, -18.5967f, 34.9315f, 0.5467f, 0.2347f },
+    { 2.8165f, -19.2245f, 34.6786f, 0.5581f, 0.2224f },
+    { 1.8622f, -18.5981f, 35.0479f, 0.5396f, 0.2356f },
+    { 2.5164f, -18.5905f, 34.8031f, 0.5533f, 0.2338f },
+    { 2.1886f, -17.9169f, 34.8571f, 0.5472f, 0.2457f },
+    { 1.4935f, -18.5981f, 35.1487f, 0.5321f, 0.2364f },
+    { 1.8526f, -17.913f, 34.9711f, 0.5401f, 0.2466f },
+    { 1.1095f, -18.5996f, 35.2304f, 0.5245f, 0.2369f },
+    { 1.4885f, -17.9107f, 35.0735f, 0.5326f, 0.2474f },
+    { 0.726f, -18.6009f, 35.2898f, 0.5171f, 0.2372f },
+    { 1.104f, -17.9133f, 35.1533f, 0.5249f, 0.2479f },
+    { 0.3546f, -17.915f, 35.2476f, 0.51f, 0.2482f },
+    { 0.7192f, -17.9162f, 35.2112f, 0.5172f, 0.2481f },
+    { -0.f, -17.1681f, 35.1425f, 0.5031f, 0.2603f },
+    { 0.3503f, -17.1692f, 35.1321f, 0.51f, 0.2603f },
+    { 0.7094f, -17.1694f, 35.0984f, 0.517f, 0.2603f },
+    { -0.3504f, -17.1692f, 35.1321f, 0.4962f, 0.2601f },
+    { 1.086f, -17.1655f, 35.039f, 0.5245f, 0.2601f },
+    { -0.f, -16.4998f, 35.0028f, 0.5031f, 0.2714f },
+    { 0.3499f, -16.5f, 34.9952f, 0.5099f, 0.2714f },
+    { 0.7055f, -16.4988f, 34.9642f, 0.5168f, 0.2714f },
+    { 1.0725f, -16.4944f, 34.9014f, 0.524f, 0.2713f },
+    { 0.7165f, -16.0433f, 34.8217f, 0.5169f, 0.2793f },
+    { 1.0806f, -16.0382f, 34.7546f, 0.5239f, 0.2793f },
+    { 0.3571f, -16.0452f, 34.855f, 0.51f, 0.2793f },
+    { 1.0966f, -15.6894f, 34.6033f, 0.5239f, 0.2855f },
+    { 0.7332f, -15.6951f, 34.6751f, 0.517f, 0.2855f },
+    { -0.f, -16.0454f, 34.8633f, 0.5031f, 0.2793f },
+    { 0.3672f, -15.6976f, 34.7131f, 0.5101f, 0.2855f },
+    { 0.7463f, -15.3469f, 34.5285f, 0.517f, 0.2916f },
+    { -0.3571f, -16.0452f, 34.855f, 0.4962f, 0.2791f },
+    { 1.1072f, -15.3405f, 34.4523f, 0.5237f, 0.2916f },
+    { -0.3499f, -16.5f, 34.9952f, 0.4963f, 0.2712f },
+    { -0.7165f, -16.0433f, 34.8217f, 0.4892f, 0.2789f },
+    { -0.7094f, -17.1694f, 35.0984f, 0.4891f, 0.2597f },
+    { -0.7055f, -16.4988f, 34.9642f, 0.4893f, 0.2709f },
+    { -0.7192f, -17.9162f, 35.2112f, 0.4889f, 0.2476f },
+    { -1.104f, -17.9133f, 35.1533f, 0.4812f, 0.247f },
+    { -1.086f, -17.1655f, 35.039f, 0.4815f, 0.2593f },
+    { -1.4885f, -17.9107f, 35.0735f, 0.4733f, 0.2463f },
+    { -1.4658f, -17.1641f, 34.9595f, 0.4738f, 0.2586f },
+    { -1.8526f, -17.913f, 34.9711f, 0.4657f, 0.2452f },
+    { -1.8346f, -17.1719f, 34.8655f, 0.4662f, 0.2576f },
+    { -2.1887f, -17.9169f, 34.8571f, 0.4585f, 0.2441f },
+    { -2.1777f, -17.183f, 34.7675f, 0.459f, 0.2564f },
+    { -2.5164f, -18.5905f, 34.8031f, 0.4523f, 0.232f },
+    { -2.4892f, -17.9191f, 34.7423f, 0.4519f, 0.2428f },
+    { -2.5265f, -19.2335f, 34.8351f, 0.4538f, 0.222f },
+    { -2.7983f, -18.5871f, 34.6568f, 0.446f, 0.2305f },
+    { -2.4839f, -19.8761f, 34.8144f, 0.4564f, 0.2123f },
+    { -2.8166f, -19.2245f, 34.6786f, 0.4475f, 0.2206f },
+    { -2.7656f, -19.8773f, 34.656f, 0.4504f, 0.2108f },
+    { -2.6542f, -20.4549f, 34.6327f, 0.4543f, 0.2024f },
+    { -3.0366f, -19.8566f, 34.4608f, 0.4442f, 0.2092f },
+    { -2.9013f, -20.4373f, 34.4483f, 0.4488f, 0.201f },
+    { -2.681f, -20.8796f, 34.5239f, 0.455f, 0.1956f },
+    { -2.4504f, -21.2177f, 34.602f, 0.4609f, 0.1917f },
+    { -2.8017f, -20.9393f, 34.412f, 0.4526f, 0.1937f },
+    { -2.1015f, -21.4958f, 34.6444f, 0.4679f, 0.1885f },
+    { -2.5881f, -21.1803f, 34.5147f, 0.458f, 0.1914f },
+    { -2.2842f, -21.4858f, 34.597f, 0.4648f, 0.1881f },
+    { -2.5144f, -21.3711f, 34.5131f, 0.4601f, 0.1889f },
+    { -2.8077f, -21.1238f, 34.3548f, 0.4532f, 0.1907f },
+    { -2.1894f, -21.6913f, 34.5272f, 0.4668f, 0.1848f },
+    { -3.1548f, -20.4553f, 34.1981f, 0.4428f, 0.1984f },
+    { -2.4735f, -21.5449f, 34.4526f, 0.4613f, 0.1861f },
+    { -3.1116f, -20.8534f, 34.1339f, 0.4453f, 0.1923f },
+    { -2.7716f, -21.3485f, 34.3071f, 0.4549f, 0.1872f },
+    { -2.173f, -21.8418f, 34.4113f, 0.4671f, 0.1818f },
+    { -2.4721f, -21.6925f, 34.3569f, 0.4616f, 0.1833f },
+    { -2.7661f, -21.5283f, 34.224f, 0.4556f, 0.1841f },
+    { -1.8674f, -21.9916f, 34.4037f, 0.4723f, 0.1795f },
+    { -3.0604f, -21.1499f, 34.1028f, 0.448f, 0.1879f },
+    { -1.8686f, -21.8188f, 34.5657f, 0.4724f, 0.1834f },
+    { -1.7478f, -21.6867f, 34.6368f, 0.4742f, 0.1858f },
+    { -1.5279f, -22.0282f, 34.4893f, 0.4781f, 0.1795f },
+    { -1.5535f, -22.1575f, 34.3504f, 0.4775f, 0.1764f },
+    { -1.2706f, -22.3332f, 34.256f, 0.4821f, 0.1727f },
+    { -1.3717f, -22.3821f, 34.0925f, 0.48f, 0.1704f },
+    { -1.2162f, -22.5103f, 33.9903f, 0.4823f, 0.1674f },
+    { -1.6167f, -22.2343f, 34.1748f, 0.476f, 0.1736f },
+    { -1.5545f, -22.3634f, 33.8772f, 0.476f, 0.1684f },
+    { -1.906f, -22.0812f, 34.2301f, 0.4713f, 0.1765f },
+    { -1.7393f, -22.2487f, 33.9664f, 0.4731f, 0.1711f },
+    { -1.968f, -22.1175f, 34.0296f, 0.4694f, 0.1737f },
+    { -2.1943f, -21.9371f, 34.251f, 0.4664f, 0.1788f },
+    { -2.2125f, -21.9773f, 34.0482f, 0.4651f, 0.1758f },
+    { -2.4791f, -21.7978f, 34.2139f, 0.4613f, 0.1804f },
+    { -2.4637f, -21.8448f, 34.0117f, 0.4604f, 0.1771f },
+    { -2.4573f, -21.901f, 33.8148f, 0.4595f, 0.1736f },
+    { -2.7119f, -21.7366f, 33.9098f, 0.4556f, 0.1774f },
+    { -2.2401f, -22.0167f, 33.856f, 0.4637f, 0.1728f },
+    { -2.6727f, -21.8199f, 33.7222f, 0.4554f, 0.1737f },
+    { -2.0376f, -22.1387f, 33.8423f, 0.4673f, 0.1713f },
+    { -1.866f, -22.2386f, 33.7701f, 0.4701f, 0.1691f },
+    { -2.2895f, -22.1097f, 33.7279f, 0.4626f, 0.1701f },
+    { -2.0989f, -22.183f, 33.7083f, 0.4658f, 0.1692f },
+    { -1.7327f, -22.3168f, 33.6687f, 0.4719f, 0.1668f },
+    { -1.9411f, -22.2418f, 33.6309f, 0.4681f, 0.1675f },
+    { -1.4413f, -22.454f, 33.7802f, 0.4775f, 0.166f },
+    { -1.8201f, -22.2816f, 33.5258f, 0.4695f, 0.1656f },
+    { -1.1539f, -22.6075f, 33.8252f, 0.4825f, 0.164f },
+    { -1.6453f, -22.3733f, 33.567f, 0.4729f, 0.1647f },
+    { -1.3905f, -22.5112f, 33.6394f, 0.4775f, 0.1634f },
+    { -0.9609f, -22.6717f, 33.9271f, 0.4863f, 0.1642f },
+    { -1.1885f, -22.6621f, 33.5541f, 0.4801f, 0.1598f },
+    { -1.025f, -22.7857f, 33.6297f, 0.4837f, 0.1591f },
+    { -0.9202f, -22.9309f, 33.6209f, 0.4861f, 0.1572f },
+    { -1.2746f, -22.6975f, 33.2727f, 0.4767f, 0.1558f },
+    { -1.1626f, -22.8677f, 33.3255f, 0.4797f, 0.1544f },
+    { -1.3926f, -22.5259f, 33.4188f, 0.4757f, 0.1601f },
+    { -1.3665f, -22.7371f, 33.077f, 0.4739f, 0.153f },
+    { -1.5938f, -22.4008f, 33.4435f, 0.4728f, 0.1626f },
+    { -1.4277f, -22.5254f, 33.1907f, 0.4732f, 0.157f },
+    { -1.5682f, -22.3919f, 33.2766f, 0.4717f, 0.1601f },
+    { -1.74f, -22.2979f, 33.4231f, 0.47f, 0.1638f },
+    { -1.6867f, -22.2945f, 33.3116f, 0.4698f, 0.1619f },
+    { -1.8591f, -22.2406f, 33.4172f, 0.4679f, 0.1645f },
+    { -1.7789f, -22.2248f, 33.3185f, 0.4682f, 0.1629f },
+    { -1.9814f, -22.2341f, 33.5199f, 0.4667f, 0.1661f },
+    { -1.8925f, -22.1768f, 33.3117f, 0.4663f, 0.1632f },
+    { -2.1398f, -22.2152f, 33.599f, 0.4647f, 0.1673f },
+    { -2.0036f, -22.1914f, 33.4081f, 0.4654f, 0.1645f },
+    { -2.1478f, -22.1999f, 33.4857f, 0.4639f, 0.1654f },
+    { -2.3282f, -22.194f, 33.6273f, 0.462f, 0.1677f },
+    { -2.3239f, -22.2074f, 33.5175f, 0.4617f, 0.1655f },
+    { -2.1406f, -22.1631f, 33.3996f, 0.4634f, 0.1639f },
+    { -2.3036f, -22.1836f, 33.4322f, 0.4617f, 0.1639f },
+    { -2.0125f, -22.1388f, 33.3245f, 0.4645f, 0.1632f },
+    { -2.2944f, -22.1558f, 33.4052f, 0.4616f, 0.1629f },
+    { -2.1357f, -22.131f, 33.3723f, 0.4631f, 0.163f },
+    { -1.9145f, -22.1129f, 33.2341f, 0.465f, 0.1622f },
+    { -2.0131f, -22.1015f, 33.2979f, 0.4639f, 0.1625f },
+    { -2.1394f, -22.1131f, 33.3554f, 0.4633f, 0.1626f },
+    { -2.2979f, -22.1352f, 33.3863f, 0.4616f, 0.1624f },
+    { -2.0178f, -22.0853f, 33.2844f, 0.4636f, 0.1621f },
+    { -2.4712f, -22.1286f, 33.3671f, 0.4598f, 0.1622f },
+    { -1.9194f, -22.0717f, 33.2097f, 0.4642f, 0.1617f },
+    { -1.9249f, -22.0563f, 33.1987f, 0.4639f, 0.1615f },
+    { -2.4693f, -22.1505f, 33.3855f, 0.4595f, 0.1626f },
+    { -2.6376f, -22.0705f, 33.2883f, 0.457f, 0.1616f },
+    { -2.4812f, -22.1759f, 33.4104f, 0.4593f, 0.1635f },
+    { -2.6407f, -22.09f, 33.302f, 0.4568f, 0.1622f },
+    { -2.7789f, -21.9918f, 33.1779f, 0.4541f, 0.1611f },
+    { -2.5094f, -22.1928f, 33.4896f, 0.4591f, 0.1651f },
+    { -2.6528f, -22.116f, 33.3225f, 0.4565f, 0.163f },
+    { -2.7882f, -22.0098f, 33.1858f, 0.454f, 0.1618f },
+    { -2.8771f, -21.9229f, 33.0644f, 0.4521f, 0.1611f },
+    { -2.8918f, -21.9455f, 33.0681f, 0.4516f, 0.1617f },
+    { -2.9456f, -21.8632f, 32.9574f, 0.4501f, 0.1612f },
+    { -2.8005f, -22.0393f, 33.2006f, 0.4537f, 0.1626f },
+    { -2.9626f, -21.894f, 32.9584f, 0.4497f, 0.1616f },
+    { -2.9975f, -21.8118f, 32.8668f, 0.4487f, 0.1611f },
+    { -2.9062f, -21.9814f, 33.0771f, 0.4512f, 0.1624f },
+    { -2.6819f, -22.1346f, 33.3883f, 0.4562f, 0.1645f },
+    { -2.8287f, -22.0616f, 33.2493f, 0.4533f, 0.1638f },
+    { -2.5232f, -22.1594f, 33.5923f, 0.4589f, 0.1673f },
+    { -2.7011f, -22.1005f, 33.482f, 0.4558f, 0.1667f },
+    { -2.4915f, -22.034f, 33.6879f, 0.4591f, 0.1703f },
+    { -2.6836f, -21.9684f, 33.5865f, 0.4556f, 0.1699f },
+    { -2.8529f, -22.033f, 33.331f, 0.4528f, 0.1659f },
+    { -2.8532f, -21.91f, 33.4452f, 0.4522f, 0.1692f },
+    { -2.9373f, -22.0024f, 33.1084f, 0.4506f, 0.1633f },
+    { -2.9698f, -21.9726f, 33.1739f, 0.4499f, 0.1651f },
+    { -2.8691f, -21.759f, 33.5886f, 0.4515f, 0.1731f },
+    { -2.9878f, -21.8561f, 33.2856f, 0.449f, 0.1683f },
+    { -3.0522f, -21.9209f, 33.0279f, 0.4474f, 0.1644f },
+    { -3.0289f, -21.7042f, 33.4246f, 0.4478f, 0.1722f },
+    { -3.0122f, -21.9558f, 32.9801f, 0.4483f, 0.1629f },
+    { -3.0841f, -21.808f, 33.1238f, 0.4461f, 0.1673f },
+    { -2.9778f, -21.9383f, 32.9627f, 0.449f, 0.1622f },
+    { -3.0119f, -21.8524f, 32.8663f, 0.4481f, 0.1614f },
+    { -3.0278f, -21.7754f, 32.7969f, 0.4473f, 0.161f },
+    { -3.0234f, -21.9062f, 32.8684f, 0.4473f, 0.1618f },
+    { -3.0383f, -21.8186f, 32.7962f, 0.4469f, 0.1612f },
+    { -3.0314f, -21.7607f, 32.7519f, 0.4469f, 0.1607f },
+    { -3.0576f, -21.9204f, 32.8788f, 0.4465f, 0.1625f },
+    { -3.0461f, -21.8742f, 32.7965f, 0.4462f, 0.1615f },
+    { -3.0404f, -21.7909f, 32.7526f, 0.4464f, 0.1609f },
+    { -3.0221f, -21.7745f, 32.7298f, 0.4464f, 0.1604f },
+    { -3.0269f, -21.7853f, 32.7253f, 0.4462f, 0.1607f },
+    { -3.0031f, -21.7964f, 32.7156f, 0.4467f, 0.1604f },
+    { -3.0491f, -21.8314f, 32.7497f, 0.4456f, 0.1612f },
+    { -3.0784f, -21.8837f, 32.8015f, 0.4451f, 0.1622f },
+    { -3.0376f, -21.8091f, 32.7195f, 0.4454f, 0.161f },
+    { -3.1007f, -21.8794f, 32.9104f, 0.4454f, 0.1639f },
+    { -3.0795f, -21.8329f, 32.7451f, 0.444f, 0.1619f },
+    { -3.1209f, -21.8405f, 32.8166f, 0.4437f, 0.1633f },
+    { -3.1388f, -21.7673f, 32.9759f, 0.4436f, 0.1663f },
+    { -3.1185f, -21.7965f, 32.7421f, 0.4421f, 0.1628f },
+    { -3.1449f, -21.6558f, 33.2424f, 0.4444f, 0.1709f },
+    { -3.1593f, -21.7378f, 32.8474f, 0.4417f, 0.1652f },
+    { -3.2099f, -21.6143f, 33.0544f, 0.4413f, 0.1694f },
+    { -3.2714f, -21.5029f, 33.3582f, 0.4421f, 0.1748f },
+    { -3.2311f, -21.5949f, 32.8767f, 0.439f, 0.1675f },
+    { -3.1302f, -21.5683f, 33.5716f, 0.4463f, 0.1761f },
+    { -3.3519f, -21.4507f, 33.1247f, 0.4384f, 0.1729f },
+    { -3.4014f, -21.3353f, 33.4566f, 0.4398f, 0.1786f },
+    { -3.3738f, -21.4313f, 32.8874f, 0.4354f, 0.1703f },
+    { -3.2343f, -21.4223f, 33.7038f, 0.4448f, 0.18f },
+    { -3.4997f, -21.2713f, 33.1781f, 0.4352f, 0.1763f },
+    { -3.5887f, -21.0711f, 33.2058f, 0.4324f, 0.1795f },
+    { -3.5264f, -21.2475f, 32.8836f, 0.4315f, 0.1731f },
+    { -3.4727f, -21.1394f, 33.5231f, 0.4377f, 0.182f },
+    { -3.6276f, -21.0443f, 32.8697f, 0.428f, 0.1758f },
+    { -3.6992f, -20.7908f, 32.8264f, 0.4241f, 0.1787f },
+    { -3.6437f, -20.8153f, 33.1994f, 0.4291f, 0.1829f },
+    { -3.6934f, -20.8215f, 32.4635f, 0.4205f, 0.1733f },
+    { -3.7627f, -20.4563f, 32.7344f, 0.4193f, 0.1823f },
+    { -3.5855f, -21.0684f, 32.5382f, 0.425f, 0.1709f },
+    { -3.8342f, -20.5362f, 32.3168f, 0.4148f, 0.1757f },
+    { -3.6343f, -20.9537f, 32.145f, 0.4189f, 0.167f },
+    { -3.4783f, -21.2811f, 32.5887f, 0.4291f, 0.1686f },
+    { -3.4976f, -21.1714f, 32.2582f, 0.4238f, 0.1654f },
+    { -3.3395f, -21.464f, 32.6626f, 0.4336f, 0.1668f },
+    { -3.3888f, -21.377f, 32.3469f, 0.4283f, 0.1638f },
+    { -3.2155f, -21.6129f, 32.7258f, 0.4376f, 0.1653f },
+    { -3.2725f, -21.5438f, 32.4806f, 0.4331f, 0.1632f },
+    { -3.1761f, -21.6666f, 32.6043f, 0.4373f, 0.163f },
+    { -3.1964f, -21.6659f, 32.3715f, 0.4339f, 0.16f },
+    { -3.1255f, -21.7548f, 32.5154f, 0.4378f, 0.1606f },
+    { -3.1269f, -21.7401f, 32.6632f, 0.4397f, 0.1626f },
+    { -3.1528f, -21.7234f, 32.7439f, 0.4402f, 0.164f },
+    { -3.0987f, -21.7809f, 32.6872f, 0.4415f, 0.1621f },
+    { -3.0653f, -21.8058f, 32.7064f, 0.4436f, 0.1615f },
+    { -3.0672f, -21.8271f, 32.6526f, 0.4422f, 0.1611f },
+    { -3.0401f, -21.8401f, 32.6823f, 0.4442f, 0.1609f },
+    { -3.0168f, -21.8386f, 32.6977f, 0.4457f, 0.1607f },
+    { -3.0066f, -21.8182f, 32.7042f, 0.4464f, 0.1605f },
+    { -2.9468f, -21.8583f, 32.6977f, 0.447f, 0.1603f },
+    { -2.953f, -21.8784f, 32.6844f, 0.447f, 0.16f },
+    { -2.8345f, -21.9364f, 32.6753f, 0.4486f, 0.1591f },
+    { -2.9618f, -21.9021f, 32.6783f, 0.4465f, 0.16f },
+    { -2.8399f, -21.9547f, 32.6606f, 0.4483f, 0.1588f },
+    { -2.6789f, -22.0143f, 32.658f, 0.4503f, 0.1579f },
+    { -2.9808f, -21.9138f, 32.6644f, 0.4455f, 0.1599f },
+    { -2.8478f, -21.9821f, 32.6555f, 0.4479f, 0.1585f },
+    { -2.682f, -22.0313f, 32.6425f, 0.4502f, 0.1576f },
+    { -2.4928f, -22.0755f, 32.6555f, 0.4527f, 0.1575f },
+    { -2.4944f, -22.0922f, 32.6396f, 0.4525f, 0.1568f },
+    { -2.2895f, -22.1044f, 32.6696f, 0.4551f, 0.157f },
+    { -2.6894f, -22.0622f, 32.638f, 0.4499f, 0.157f },
+    { -2.2898f, -22.1212f, 32.6539f, 0.4551f, 0.1565f },
+    { -2.0824f, -22.0849f, 32.7026f, 0.4579f, 0.1575f },
+    { -2.5009f, -22.1264f, 32.6346f, 0.4523f, 0.156f },
+    { -2.8644f, -22.0047f, 32.6443f, 0.4472f, 0.1581f },
+    { -2.704f, -22.0956f, 32.6286f, 0.4493f, 0.1563f },
+    { -3.0026f, -21.9135f, 32.6301f, 0.4439f, 0.1597f },
+    { -2.8835f, -22.0188f, 32.6118f, 0.446f, 0.1575f },
+    { -3.0891f, -21.8036f, 32.603f, 0.4403f, 0.161f },
+    { -3.0197f, -21.9013f, 32.563f, 0.4419f, 0.159f },
+    { -3.0466f, -21.8717f, 32.4593f, 0.4393f, 0.1581f },
+    { -2.899f, -22.0204f, 32.5426f, 0.4443f, 0.1565f },
+    { -2.721f, -22.1234f, 32.5991f, 0.4484f, 0.1554f },
+    { -2.9222f, -22.0115f, 32.4365f, 0.442f, 0.1553f },
+    { -2.5129f, -22.1693f, 32.6238f, 0.4518f, 0.1551f },
+    { -2.7354f, -22.1377f, 32.5344f, 0.4472f, 0.1542f },
+    { -2.5264f, -22.2081f, 32.5937f, 0.4512f, 0.1539f },
+    { -2.2951f, -22.158f, 32.6488f, 0.4549f, 0.1557f },
+    { -2.3039f, -22.2092f, 32.6375f, 0.4547f, 0.1545f },
+    { -2.081f, -22.1018f, 32.6872f, 0.4578f, 0.1569f },
+    { -1.9071f, -22.0466f, 32.7491f, 0.4606f, 0.158f },
+    { -2.085f, -22.1408f, 32.6837f, 0.4578f, 0.156f },
+    { -1.9029f, -22.0634f, 32.734f, 0.4602f, 0.1574f },
+    { -1.7989f, -22.0192f, 32.8037f, 0.4617f, 0.1579f },
+    { -1.7905f, -22.035f, 32.7887f, 0.4618f, 0.158f },
+    { -1.7455f, -22.0037f, 32.8649f, 0.4628f, 0.1578f },
+    { -1.9048f, -22.1033f, 32.7326f, 0.4603f, 0.1568f },
+    { -1.7347f, -22.0195f, 32.8503f, 0.4629f, 0.1586f },
+    { -1.7345f, -22.0012f, 32.9309f, 0.4635f, 0.159f },
+    { -1.7889f, -22.0741f, 32.7888f, 0.462f, 0.1578f },
+    { -2.0898f, -22.1983f, 32.6773f, 0.4578f, 0.1548f },
+    { -1.9033f, -22.1636f, 32.7327f, 0.4605f, 0.1557f },
+    { -2.3119f, -22.2585f, 32.6094f, 0.4543f, 0.1532f },
+    { -2.09f, -22.26f, 32.6599f, 0.4577f, 0.1534f },
+    { -2.5372f, -22.2296f, 32.5309f, 0.4503f, 0.1525f },
+    { -2.3152f, -22.2897f, 32.5535f, 0.4538f, 0.1518f },
+    { -2.7563f, -22.1487f, 32.4332f, 0.4454f, 0.1528f },
+    { -2.5527f, -22.2577f, 32.4357f, 0.449f, 0.151f },
+    { -2.323f, -22.3379f, 32.4695f, 0.453f, 0.1501f },
+    { -2.7927f, -22.1666f, 32.2944f, 0.443f, 0.1514f },
+    { -2.08f, -22.3113f, 32.6236f, 0.4577f, 0.152f },
+    { -2.58f, -22.3163f, 32.3086f, 0.4473f, 0.1493f },
+    { -2.0787f, -22.3886f, 32.56f, 0.4575f, 0.1502f },
+    { -2.3446f, -22.4382f, 32.357f, 0.4519f, 0.1481f },
+    { -1.8938f, -22.234f, 32.728f, 0.4609f, 0.1544f },
+    { -1.872f, -22.3041f, 32.7122f, 0.4613f, 0.153f },
+    { -1.7767f, -22.1318f, 32.7934f, 0.4625f, 0.157f },
+    { -1.7566f, -22.2018f, 32.796f, 0.4631f, 0.1558f },
+    { -1.7292f, -22.0568f, 32.8512f, 0.4632f, 0.1587f },
+    { -1.7051f, -22.1093f, 32.8579f, 0.4639f, 0.1582f },
+    { -1.7264f, -22.0197f, 32.9176f, 0.4638f, 0.1592f },
+    { -1.7452f, -22.0087f, 32.9762f, 0.4641f, 0.1602f },
+    { -1.7176f, -22.0552f, 32.9184f, 0.4642f, 0.1592f },
+    { -1.7436f, -22.0253f, 32.9802f, 0.4643f, 0.1598f },
+    { -1.7629f, -22.0056f, 33.0132f, 0.464f, 0.1602f },
+    { -1.7642f, -22.0257f, 33.0274f, 0.4645f, 0.1601f },
+    { -1.7992f, -22.013f, 33.0616f, 0.4639f, 0.1603f },
+    { -1.7333f, -22.06f, 32.9827f, 0.4648f, 0.1595f },
+    { -1.7963f, -22.0298f, 33.0741f, 0.4644f, 0.1604f },
+    { -1.8526f, -22.0311f, 33.1239f, 0.4639f, 0.1609f },
+    { -1.7554f, -22.0618f, 33.036f, 0.4651f, 0.16f },
+    { -1.6838f, -22.1021f, 32.9249f, 0.4649f, 0.1587f },
+    { -1.6951f, -22.1045f, 32.9943f, 0.4656f, 0.1591f },
+    { -1.6747f, -22.1747f, 32.8651f, 0.4646f, 0.1572f },
+    { -1.6444f, -22.1638f, 32.9362f, 0.4658f, 0.158f },
+    { -1.7316f, -22.2774f, 32.7905f, 0.4638f, 0.1546f },
+    { -1.65f, -22.2508f, 32.8673f, 0.4655f, 0.1563f },
+    { -1.8605f, -22.4074f, 32.673f, 0.4616f, 0.1513f },
+    { -1.7091f, -22.3918f, 32.7743f, 0.4645f, 0.1531f },
+    { -2.1049f, -22.5281f, 32.4609f, 0.4568f, 0.1479f },
+    { -1.8819f, -22.5776f, 32.5976f, 0.4615f, 0.1488f },
+    { -2.3857f, -22.5606f, 32.2078f, 0.4502f, 0.1454f },
+    { -2.156f, -22.6938f, 32.3334f, 0.4556f, 0.145f },
+    { -2.6213f, -22.3836f, 32.1412f, 0.445f, 0.1471f },
+    { -2.2297f, -22.8494f, 32.1843f, 0.4541f, 0.1414f },
+    { -2.8413f, -22.1785f, 32.1166f, 0.4401f, 0.1496f },
+    { -2.4519f, -22.6749f, 32.0134f, 0.448f, 0.1418f },
+    { -2.6786f, -22.4381f, 31.9251f, 0.442f, 0.1438f },
+    { -3.0245f, -21.961f, 32.117f, 0.4357f, 0.1527f },
+    { -2.8987f, -22.1715f, 31.898f, 0.4366f, 0.147f },
+    { -2.9645f, -21.9936f, 32.2934f, 0.4391f, 0.1541f },
+    { -3.0981f, -21.8194f, 32.3157f, 0.436f, 0.1571f },
+    { -3.1735f, -21.744f, 32.1472f, 0.4321f, 0.1561f },
+    { -3.291f, -21.5403f, 32.2118f, 0.4294f, 0.1597f },
+    { -3.101f, -21.9076f, 31.9111f, 0.4317f, 0.1508f },
+    { -3.2721f, -21.6448f, 31.9691f, 0.4278f, 0.1551f },
+    { -3.3987f, -21.3814f, 32.0766f, 0.4249f, 0.1601f },
+    { -3.5299f, -21.2336f, 31.9052f, 0.4201f, 0.1599f },
+    { -3.3797f, -21.576f, 31.7452f, 0.4234f, 0.1532f },
+    { -3.8348f, -20.7506f, 31.9376f, 0.4129f, 0.1676f },
+    { -3.6951f, -21.1409f, 31.6366f, 0.4148f, 0.1581f },
+    { -3.1837f, -21.8957f, 31.6658f, 0.4279f, 0.1478f },
+    { -3.482f, -21.5917f, 31.4393f, 0.4192f, 0.1493f },
+    { -2.9654f, -22.2097f, 31.6537f, 0.4333f, 0.1433f },
+    { -3.262f, -21.9874f, 31.3712f, 0.4247f, 0.1429f },
+    { -3.0421f, -22.3573f, 31.3982f, 0.431f, 0.1382f },
+    { -2.7489f, -22.5353f, 31.6952f, 0.4394f, 0.1396f },
+    { -2.8288f, -22.7307f, 31.4864f, 0.4379f, 0.1344f },
+    { -2.5327f, -22.825f, 31.8099f, 0.4459f, 0.1373f },
+    { -2.6175f, -23.0549f, 31.6331f, 0.445f, 0.132f },
+    { -2.3157f, -23.0318f, 32.0172f, 0.4526f, 0.1369f },
+    { -2.4034f, -23.2773f, 31.8355f, 0.4517f, 0.1315f },
+    { -2.0697f, -23.158f, 32.2792f, 0.4595f, 0.1383f },
+    { -2.1741f, -23.4151f, 32.0748f, 0.4581f, 0.1326f },
+    { -1.9888f, -22.9558f, 32.4101f, 0.4604f, 0.1425f },
+    { -1.9169f, -23.4852f, 32.3321f, 0.4646f, 0.1347f },
+    { -1.9275f, -22.7739f, 32.5041f, 0.461f, 0.1458f },
+    { -1.7668f, -23.2062f, 32.5581f, 0.4667f, 0.141f },
+    { -1.7058f, -22.9881f, 32.6634f, 0.4669f, 0.1451f },
+    { -1.6967f, -22.5782f, 32.7447f, 0.4654f, 0.1508f },
+    { -1.6953f, -22.7919f, 32.7062f, 0.4663f, 0.148f },
+    { -1.6162f, -22.3679f, 32.8732f, 0.4667f, 0.155f },
+    { -1.5584f, -22.556f, 32.8915f, 0.4686f, 0.153f },
+    { -1.6185f, -22.2439f, 32.9513f, 0.4668f, 0.1573f },
+    { -1.5733f, -22.3618f, 32.9789f, 0.4684f, 0.1564f },
+    { -1.6509f, -22.1664f, 33.0169f, 0.4666f, 0.1587f },
+    { -1.6222f, -22.2531f, 33.0523f, 0.468f, 0.1584f },
+    { -1.7217f, -22.1108f, 33.0661f, 0.4661f, 0.1599f },
+    { -1.6797f, -22.1795f, 33.115f, 0.4674f, 0.1599f },
+    { -1.7896f, -22.0684f, 33.09f, 0.4652f, 0.1605f },
+    { -1.7622f, -22.1249f, 33.1419f, 0.4663f, 0.1609f },
+    { -1.8475f, -22.0465f, 33.135f, 0.4644f, 0.161f },
+    { -1.8414f, -22.0874f, 33.156f, 0.4652f, 0.1613f },
+    { -1.8156f, -22.1507f, 33.2233f, 0.4665f, 0.162f },
+    { -1.7245f, -22.2f, 33.2192f, 0.4679f, 0.1614f },
+    { -1.6462f, -22.2748f, 33.1802f, 0.4691f, 0.16f },
+    { -1.5631f, -22.3708f, 33.1078f, 0.47f, 0.1579f },
+    { -1.4758f, -22.5369f, 33.0276f, 0.471f, 0.1549f },
+    { -1.4961f, -22.7716f, 32.9078f, 0.4708f, 0.1506f },
+    { -1.2858f, -22.9304f, 33.1066f, 0.4764f, 0.1511f },
+    { -1.4488f, -22.9714f, 32.9077f, 0.4726f, 0.1482f },
+    { -1.0935f, -23.0357f, 33.3378f, 0.4819f, 0.1525f },
+    { -1.2308f, -23.1029f, 33.1241f, 0.4785f, 0.1492f },
+    { -1.4279f, -23.2056f, 32.8714f, 0.4741f, 0.1449f },
+    { -1.0692f, -23.2014f, 33.2988f, 0.483f, 0.1499f },
+    { -1.6849f, -23.5273f, 32.5675f, 0.4702f, 0.1369f },
+    { -1.1989f, -23.2408f, 33.1372f, 0.48f, 0.1475f },
+    { -1.3349f, -23.3379f, 32.9681f, 0.4773f, 0.1442f },
+    { -1.5311f, -23.5808f, 32.7411f, 0.4742f, 0.1381f },
+    { -1.2029f, -23.4034f, 33.1122f, 0.4808f, 0.1449f },
+    { -1.7198f, -23.8966f, 32.5316f, 0.4721f, 0.1311f },
+    { -1.0727f, -23.3972f, 33.226f, 0.4836f, 0.1464f },
+    { -1.3095f, -23.445f, 32.9946f, 0.4786f, 0.143f },
+    { -1.405f, -23.6279f, 32.8809f, 0.4775f, 0.139f },
+    { -1.2559f, -23.6505f, 33.0151f, 0.4808f, 0.1403f },
+    { -1.0871f, -23.6558f, 33.1372f, 0.4841f, 0.1418f },
+    { -1.3258f, -23.9404f, 32.902f, 0.4806f, 0.1348f },
+    { -1.5326f, -23.9249f, 32.7258f, 0.4764f, 0.1329f },
+    { -1.1128f, -23.9455f, 33.0504f, 0.4845f, 0.1366f },
+    { -1.6094f, -24.2247f, 32.6388f, 0.4767f, 0.1274f },
+    { -1.3803f, -24.2319f, 32.8288f, 0.481f, 0.1296f },
+    { -0.9074f, -23.9422f, 33.1613f, 0.4882f, 0.138f },
+    { -1.833f, -24.2124f, 32.415f, 0.4721f, 0.1251f },
+    { -1.1503f, -24.2344f, 32.9834f, 0.485f, 0.1314f },
+    { -0.9019f, -23.6512f, 33.2411f, 0.4875f, 0.1432f },
+    { -0.924f, -24.2327f, 33.101f, 0.4888f, 0.1329f },
+    { -0.8994f, -23.3758f, 33.3514f, 0.4871f, 0.1483f },
+    { -0.6679f, -23.9407f, 33.2345f, 0.4922f, 0.139f },
+    { -0.6683f, -23.6465f, 33.3132f, 0.4917f, 0.1443f },
+    { -0.8919f, -23.1316f, 33.5031f, 0.4869f, 0.1533f },
+    { -0.6652f, -23.3537f, 33.4481f, 0.4914f, 0.1499f },
+    { -0.3529f, -23.9514f, 33.2702f, 0.4974f, 0.1395f },
+    { -0.6683f, -24.235f, 33.1827f, 0.4928f, 0.1339f },
+    { -0.6717f, -24.5208f, 33.1374f, 0.4934f, 0.1288f },
+    { -0.9423f, -24.5149f, 33.0466f, 0.4894f, 0.1278f },
+    { -0.6805f, -24.7892f, 33.0782f, 0.494f, 0.1239f },
+    { -0.9528f, -24.7807f, 32.9844f, 0.4902f, 0.123f },
+    { -0.9342f, -25.0327f, 32.9161f, 0.4914f, 0.1183f },
+    { -0.8651f, -25.2734f, 32.8431f, 0.4932f, 0.1137f },
+    { -1.0275f, -25.508f, 32.6981f, 0.4931f, 0.1089f },
+    { -1.0887f, -25.2748f, 32.7383f, 0.4907f, 0.1127f },
+    { -1.25f, -25.5421f, 32.5731f, 0.4914f, 0.1068f },
+    { -1.1601f, -25.0328f, 32.7961f, 0.4884f, 0.1171f },
+    { -1.2988f, -25.3019f, 32.6069f, 0.4884f, 0.1111f },
+    { -1.466f, -25.5932f, 32.3915f, 0.4897f, 0.1048f },
+    { -1.1878f, -24.7804f, 32.8597f, 0.4868f, 0.1217f },
+    { -1.3642f, -25.0478f, 32.6513f, 0.4857f, 0.1154f },
+    { -1.5191f, -25.3432f, 32.4252f, 0.4857f, 0.1087f },
+    { -1.6726f, -25.6462f, 32.128f, 0.4865f, 0.1012f },
+    { -1.7731f, -25.3872f, 32.1694f, 0.482f, 0.1056f },
+    { -1.8476f, -25.713f, 31.83f, 0.4833f, 0.0977f },
+    { -1.5887f, -25.0721f, 32.4632f, 0.4824f, 0.1131f },
+    { -1.4025f, -24.7875f, 32.7099f, 0.4836f, 0.1199f },
+    { -1.8757f, -25.1002f, 32.2138f, 0.478f, 0.1102f },
+    { -1.1813f, -24.5151f, 32.9239f, 0.4857f, 0.1264f },
+    { -1.4093f, -24.5169f, 32.7725f, 0.4821f, 0.1246f },
+    { -1.6315f, -24.7995f, 32.52f, 0.4799f, 0.1177f },
+    { -1.6407f, -24.5191f, 32.5827f, 0.4781f, 0.1224f },
+    { -1.9093f, -24.814f, 32.2751f, 0.4753f, 0.1149f },
+    { -1.8898f, -24.5207f, 32.3449f, 0.4734f, 0.1198f },
+    { -2.1699f, -24.8214f, 32.0156f, 0.4706f, 0.112f },
+    { -2.1203f, -24.5161f, 32.0926f, 0.4688f, 0.1172f },
+    { -2.038f, -24.1907f, 32.1781f, 0.4675f, 0.1229f },
+    { -2.3474f, -24.812f, 31.7817f, 0.4667f, 0.1098f },
+    { -1.9005f, -23.8571f, 32.3204f, 0.4676f, 0.1294f },
+    { -2.2957f, -24.5f, 31.859f, 0.4647f, 0.115f },
+    { -2.2117f, -24.1555f, 31.9492f, 0.4631f, 0.1209f },
+    { -2.0879f, -23.8075f, 32.0932f, 0.4627f, 0.1276f },
+    { -2.2838f, -23.7278f, 31.8655f, 0.4574f, 0.126f },
+    { -2.3806f, -24.0969f, 31.72f, 0.4585f, 0.1192f },
+    { -2.453f, -24.4693f, 31.6138f, 0.4605f, 0.1128f },
+    { -2.5714f, -24.0053f, 31.4826f, 0.4533f, 0.1176f },
+    { -2.4892f, -24.7916f, 31.5223f, 0.4628f, 0.1074f },
+    { -2.6289f, -24.4209f, 31.3266f, 0.4557f, 0.1103f },
+    { -2.4568f, -25.0924f, 31.4514f, 0.4658f, 0.1028f },
+    { -2.643f, -24.7662f, 31.1865f, 0.458f, 0.1044f },
+    { -2.7667f, -24.3715f, 30.9526f, 0.4502f, 0.1069f },
+    { -2.6037f, -25.0762f, 31.0733f, 0.4607f, 0.0995f },
+    { -2.7638f, -24.7395f, 30.7782f, 0.4528f, 0.1007f },
+    { -2.7379f, -23.9198f, 31.133f, 0.4473f, 0.1147f },
+    { -2.8096f, -24.3376f, 30.4471f, 0.4444f, 0.1021f },
+    { -2.4897f, -23.5979f, 31.6528f, 0.4517f, 0.1251f },
+    { -2.7229f, -23.3807f, 31.3428f, 0.4439f, 0.1241f },
+    { -2.8339f, -23.8799f, 30.5674f, 0.4402f, 0.1089f },
+    { -2.9251f, -22.9083f, 31.1569f, 0.4351f, 0.128f },
+    { -2.904f, -23.3992f, 30.6205f, 0.435f, 0.1155f },
+    { -3.1299f, -22.4984f, 31.0366f, 0.4277f, 0.1319f },
+    { -3.0446f, -22.952f, 30.5646f, 0.4284f, 0.1204f },
+    { -3.2301f, -22.5173f, 30.4738f, 0.4214f, 0.1248f },
+    { -3.3435f, -22.0808f, 30.9743f, 0.4207f, 0.1368f },
+    { -3.4352f, -22.0737f, 30.4224f, 0.4147f, 0.1301f },
+    { -3.31f, -22.4967f, 29.8317f, 0.4147f, 0.1174f },
+    { -3.5021f, -22.0443f, 29.7899f, 0.4084f, 0.1227f },
+    { -3.1439f, -22.943f, 29.8898f, 0.4211f, 0.1126f },
+    { -3.3367f, -22.5198f, 29.2322f, 0.4101f, 0.1101f },
+    { -3.0031f, -23.3947f, 29.9314f, 0.4274f, 0.1077f },
+    { -3.1797f, -22.9624f, 29.3129f, 0.4164f, 0.1059f },
+    { -3.0414f, -23.4032f, 29.3598f, 0.4226f, 0.1015f },
+    { -2.8871f, -23.8631f, 29.9236f, 0.4335f, 0.1023f },
+    { -2.8151f, -24.3108f, 29.8722f, 0.4387f, 0.0967f },
+    { -2.9252f, -23.8469f, 29.3397f, 0.4284f, 0.0966f },
+    { -2.8066f, -24.7153f, 30.3014f, 0.4476f, 0.0964f },
+    { -2.8412f, -24.2829f, 29.2903f, 0.4337f, 0.0916f },
+    { -2.7273f, -25.0611f, 30.6303f, 0.4553f, 0.0956f },
+    { -2.8066f, -24.7001f, 29.7829f, 0.4428f, 0.0918f },
+    { -2.792f, -25.0459f, 30.1675f, 0.4505f, 0.0916f },
+    { -2.5009f, -25.3857f, 30.998f, 0.4643f, 0.0951f },
+    { -2.6557f, -25.3731f, 30.5298f, 0.4583f, 0.0911f },
+    { -2.3229f, -25.3998f, 31.4069f, 0.4701f, 0.0985f },
+    { -2.381f, -25.6817f, 30.9429f, 0.468f, 0.0912f },
+    { -2.3223f, -25.1107f, 31.72f, 0.4697f, 0.1051f },
+    { -2.1465f, -25.1179f, 31.9503f, 0.4734f, 0.1073f },
+    { -2.1757f, -25.4157f, 31.6766f, 0.4743f, 0.1007f },
+    { -2.0092f, -25.417f, 31.8998f, 0.4779f, 0.1027f },
+    { -2.0119f, -25.6672f, 31.6433f, 0.4786f, 0.0972f },
+    { -2.1394f, -25.7131f, 31.3974f, 0.4753f, 0.0947f },
+    { -1.9347f, -25.8054f, 31.612f, 0.4809f, 0.0953f },
+    { -1.8558f, -25.8404f, 31.6842f, 0.4831f, 0.0962f },
+    { -1.8531f, -25.904f, 31.6175f, 0.483f, 0.0947f },
+    { -1.8965f, -25.8967f, 31.5728f, 0.482f, 0.0942f },
+    { -1.9358f, -25.9137f, 31.5112f, 0.4811f, 0.0938f },
+    { -1.9939f, -25.8514f, 31.4996f, 0.4796f, 0.094f },
+    { -1.9087f, -26.0079f, 31.4586f, 0.4826f, 0.0923f },
+    { -1.9898f, -25.9879f, 31.3953f, 0.4802f, 0.0919f },
+    { -1.8223f, -26.1544f, 31.3802f, 0.484f, 0.0908f },
+    { -2.111f, -25.9635f, 31.2359f, 0.4767f, 0.0906f },
+    { -1.9145f, -26.1666f, 31.2997f, 0.4821f, 0.089f },
+    { -1.76f, -26.3395f, 31.2133f, 0.4848f, 0.0855f },
+    { -1.6506f, -26.3252f, 31.2983f, 0.4879f, 0.0864f },
+    { -2.0359f, -26.1745f, 31.1431f, 0.4788f, 0.0874f },
+    { -1.5658f, -26.4845f, 31.1323f, 0.4877f, 0.0817f },
+    { -1.453f, -26.4765f, 31.2203f, 0.4919f, 0.0819f },
+    { -1.2888f, -26.5647f, 31.1533f, 0.4933f, 0.0791f },
+    { -1.8941f, -26.343f, 31.0707f, 0.4813f, 0.0842f },
+    { -1.7f, -26.4756f, 31.0021f, 0.4841f, 0.0808f },
+    { -1.3712f, -26.5798f, 31.0525f, 0.4901f, 0.0781f },
+    { -1.113f, -26.6144f, 31.1064f, 0.4947f, 0.0762f },
+    { -1.1608f, -26.6364f, 30.9802f, 0.4923f, 0.0744f },
+    { -0.9202f, -26.6319f, 31.0413f, 0.4964f, 0.0728f },
+    { -1.4682f, -26.5787f, 30.921f, 0.4869f, 0.077f },
+    { -1.8082f, -26.4709f, 30.8113f, 0.4803f, 0.0792f },
+    { -1.2017f, -26.6524f, 30.8403f, 0.4898f, 0.0726f },
+    { -2.0237f, -26.3417f, 30.8327f, 0.477f, 0.0821f },
+    { -1.5412f, -26.5889f, 30.7598f, 0.4838f, 0.0754f },
+    { -1.8821f, -26.4657f, 30.5693f, 0.4765f, 0.077f },
+    { -1.235f, -26.6809f, 30.6911f, 0.4874f, 0.0707f },
+    { -1.5872f, -26.5966f, 30.5655f, 0.4808f, 0.0733f },
+    { -2.1217f, -26.3355f, 30.538f, 0.4726f, 0.0795f },
+    { -1.9136f, -26.4557f, 30.2853f, 0.4727f, 0.0744f },
+    { -2.1851f, -26.1767f, 30.8502f, 0.4739f, 0.0847f },
+    { -2.1609f, -26.3243f, 30.2253f, 0.4686f, 0.0768f },
+    { -2.29f, -25.951f, 30.8903f, 0.4711f, 0.0878f },
+    { -2.3097f, -26.1723f, 30.4969f, 0.4688f, 0.0817f },
+    { -2.45f, -25.9429f, 30.4711f, 0.4652f, 0.0843f },
+    { -2.5597f, -25.6691f, 30.4767f, 0.4616f, 0.0874f },
+    { -2.5141f, -25.9316f, 30.091f, 0.4607f, 0.0812f },
+    { -2.733f, -25.3617f, 30.0825f, 0.4535f, 0.0874f },
+    { -2.6377f, -25.6584f, 30.0544f, 0.4569f, 0.0839f },
+    { -2.8001f, -25.0457f, 29.6955f, 0.4463f, 0.0874f },
+    { -2.7341f, -25.3623f, 29.6498f, 0.4497f, 0.0837f },
+    { -2.6249f, -25.6539f, 29.656f, 0.4533f, 0.0806f },
+    { -2.7539f, -25.0756f, 29.2252f, 0.4429f, 0.0832f },
+    { -2.7991f, -24.7002f, 29.2495f, 0.4386f, 0.0871f },
+    { -2.6602f, -25.3859f, 29.2255f, 0.4466f, 0.0798f },
+    { -2.768f, -24.707f, 28.7896f, 0.4354f, 0.0831f },
+    { -2.8459f, -24.2669f, 28.7909f, 0.43f, 0.0872f },
+    { -2.9249f, -23.852f, 28.8511f, 0.4251f, 0.0918f },
+    { -2.6973f, -24.7121f, 28.4917f, 0.4337f, 0.0803f },
+    { -2.7877f, -24.2763f, 28.4633f, 0.4283f, 0.084f },
+    { -3.0212f, -23.3981f, 28.8511f, 0.4191f, 0.096f },
+    { -2.8627f, -23.8988f, 28.4932f, 0.4237f, 0.0876f },
+    { -3.1679f, -22.9469f, 28.8379f, 0.413f, 0.1005f },
+    { -2.9139f, -23.5815f, 28.4962f, 0.4197f, 0.0904f },
+    { -3.3067f, -22.5436f, 28.7232f, 0.4069f, 0.1037f },
+    { -3.0194f, -23.1137f, 28.5028f, 0.4134f, 0.0945f },
+    { -3.5089f, -22.0705f, 29.1512f, 0.4038f, 0.1147f },
+    { -3.1242f, -22.8329f, 28.4691f, 0.4093f, 0.0971f },
+    { -3.7031f, -21.5729f, 29.7528f, 0.4021f, 0.1284f },
+    { -3.436f, -22.1378f, 28.5973f, 0.4009f, 0.107f },
+    { -3.6598f, -21.5981f, 30.4245f, 0.4082f, 0.1365f },
+    { -3.6762f, -21.6008f, 29.0739f, 0.3975f, 0.1196f },
+    { -3.5762f, -21.6224f, 31.0122f, 0.4144f, 0.1436f },
+    { -3.8384f, -21.0899f, 31.1923f, 0.4088f, 0.1535f },
+    { -3.9037f, -21.0669f, 30.4939f, 0.4021f, 0.1447f },
+    { -3.8955f, -21.0698f, 29.7088f, 0.3959f, 0.1343f },
+    { -4.1181f, -20.511f, 30.5204f, 0.3961f, 0.1524f },
+    { -3.8183f, -21.0967f, 29.0044f, 0.3913f, 0.1247f },
+    { -4.053f, -20.545f, 29.6425f, 0.3898f, 0.1399f },
+    { -3.9236f, -20.5578f, 28.9314f, 0.385f, 0.1298f },
+    { -4.1488f, -20.0083f, 29.5388f, 0.3836f, 0.1446f },
+    { -3.9806f, -19.9836f, 28.8438f, 0.3785f, 0.1347f },
+    { -3.7194f, -20.5218f, 28.2765f, 0.3804f, 0.1208f },
+    { -3.7632f, -19.8998f, 28.213f, 0.3734f, 0.1261f },
+    { -3.6451f, -21.0934f, 28.3293f, 0.387f, 0.1155f },
+    { -3.4297f, -20.4095f, 27.5675f, 0.3745f, 0.1113f },
+    { -3.5263f, -21.6746f, 28.3448f, 0.3937f, 0.1092f },
+    { -3.3493f, -21.0059f, 27.6324f, 0.3815f, 0.1061f },
+    { -3.0984f, -20.2314f, 26.8262f, 0.3674f, 0.1017f },
+    { -3.2634f, -22.2312f, 28.2191f, 0.3999f, 0.1004f },
+    { -3.5101f, -19.7693f, 27.5508f, 0.3675f, 0.1174f },
+    { -3.216f, -22.525f, 28.3525f, 0.4045f, 0.099f },
+    { -3.0256f, -22.7193f, 28.2084f, 0.4066f, 0.0944f },
+    { -3.0725f, -22.5093f, 28.1065f, 0.4031f, 0.0952f },
+    { -2.9511f, -22.9428f, 28.265f, 0.41f, 0.0927f },
+    { -2.8838f, -22.5416f, 27.9719f, 0.403f, 0.0919f },
+    { -2.8491f, -22.7047f, 28.0575f, 0.4057f, 0.0913f },
+    { -2.8922f, -23.1628f, 28.2473f, 0.4129f, 0.0905f },
+    { -2.6973f, -22.5991f, 27.9289f, 0.4037f, 0.0891f },
+    { -2.7927f, -22.8991f, 28.1233f, 0.4088f, 0.0901f },
+    { -2.658f, -22.7438f, 28.0047f, 0.4062f, 0.0885f },
+    { -2.7641f, -23.1214f, 28.1571f, 0.412f, 0.0886f },
+    { -2.6096f, -22.925f, 28.0769f, 0.409f, 0.0873f },
+    { -2.6021f, -23.149f, 28.1421f, 0.4123f, 0.0861f },
+    { -2.4667f, -22.9625f, 28.1248f, 0.4097f, 0.0849f },
+    { -2.4594f, -23.1923f, 28.2273f, 0.413f, 0.0834f },
+    { -2.516f, -22.791f, 28.0381f, 0.4071f, 0.0863f },
+    { -2.3294f, -23.2279f, 28.3145f, 0.4136f, 0.081f },
+    { -2.3435f, -22.9929f, 28.1757f, 0.4103f, 0.083f },
+    { -2.5605f, -22.659f, 27.958f, 0.405f, 0.0872f },
+    { -2.396f, -22.8227f, 28.0698f, 0.4078f, 0.0847f },
+    { -2.6773f, -22.4845f, 27.8526f, 0.4018f, 0.0888f },
+    { -2.4476f, -22.6942f, 27.9794f, 0.4058f, 0.0857f },
+    { -2.8477f, -22.4131f, 27.8785f, 0.4007f, 0.0914f },
+    { -2.5531f, -22.5477f, 27.8752f, 0.4031f, 0.0871f },
+    { -2.6361f, -22.4146f, 27.7725f, 0.4003f, 0.0879f },
+    { -2.459f, -22.5843f, 27.8869f, 0.4039f, 0.086f },
+    { -2.5264f, -22.4733f, 27.7926f, 0.4015f, 0.0865f },
+    { -2.7791f, -22.3396f, 27.7794f, 0.399f, 0.0901f },
+    { -2.469f, -22.5185f, 27.816f, 0.4025f, 0.0859f },
+    { -3.0483f, -22.3299f, 27.9888f, 0.4f, 0.0952f },
+    { -3.2145f, -21.9928f, 27.992f, 0.3954f, 0.0997f },
+    { -2.9364f, -22.2051f, 27.7879f, 0.397f, 0.0931f },
+    { -3.0174f, -21.851f, 27.5941f, 0.3911f, 0.0953f },
+    { -2.8181f, -22.0866f, 27.5068f, 0.3934f, 0.0904f },
+    { -2.7721f, -22.2841f, 27.6325f, 0.3968f, 0.089f },
+    { -3.2261f, -21.5044f, 27.6674f, 0.3874f, 0.101f },
+    { -2.723f, -22.2524f, 27.4995f, 0.3954f, 0.0876f },
+    { -2.9878f, -20.8386f, 26.9315f, 0.3749f, 0.0969f },
+    { -2.8861f, -21.3647f, 27.0742f, 0.3819f, 0.0932f },
+    { -2.7691f, -19.9982f, 26.0743f, 0.3594f, 0.0922f },
+    { -2.7513f, -21.7492f, 27.1419f, 0.3869f, 0.0894f },
+    { -2.6173f, -20.5957f, 26.2443f, 0.3673f, 0.0881f },
+    { -2.6037f, -22.0923f, 27.204f, 0.3913f, 0.0855f },
+    { -2.616f, -22.3225f, 27.4015f, 0.3953f, 0.0847f },
+    { -2.4438f, -22.046f, 26.9458f, 0.3888f, 0.082f },
+    { -2.4495f, -22.4704f, 27.2979f, 0.3959f, 0.0805f },
+    { -2.4952f, -21.6307f, 26.7517f, 0.3827f, 0.0843f },
+    { -2.3616f, -22.4309f, 27.1361f, 0.3943f, 0.0789f },
+    { -2.5437f, -21.1568f, 26.5268f, 0.3757f, 0.0862f },
+    { -2.2683f, -22.0556f, 26.7487f, 0.3874f, 0.0786f },
+    { -2.2472f, -21.588f, 26.4644f, 0.3801f, 0.0797f },
+    { -2.1615f, -20.4027f, 25.6679f, 0.361f, 0.0793f },
+    { -2.0961f, -20.9951f, 26.0493f, 0.3704f, 0.0785f },
+    { -2.3057f, -19.741f, 25.2227f, 0.349f, 0.0796f },
+    { -1.5773f, -19.958f, 24.8206f, 0.3501f, 0.0692f },
+    { -1.5438f, -20.3848f, 25.2993f, 0.3585f, 0.0696f },
+    { -0.9615f, -20.124f, 24.6305f, 0.3512f, 0.0587f },
+    { -3.0524f, -19.4148f, 26.1873f, 0.354f, 0.1005f },
+    { -2.8411f, -19.1829f, 25.5138f, 0.3468f, 0.0923f },
+    { -3.2603f, -19.6037f, 26.8709f, 0.3609f, 0.1088f },
+    { -3.3302f, -18.7901f, 26.4207f, 0.3488f, 0.1102f },
+    { -3.2345f, -18.6308f, 25.8371f, 0.3446f, 0.1049f },
+    { -3.4085f, -18.9146f, 26.9889f, 0.3542f, 0.117f },
+    { -3.5722f, -19.0474f, 27.5692f, 0.3597f, 0.1242f },
+    { -3.4779f, -18.1229f, 27.1035f, 0.3461f, 0.1248f },
+    { -3.4656f, -18.0684f, 26.6121f, 0.3421f, 0.1186f },
+    { -3.4572f, -17.9772f, 26.0915f, 0.3384f, 0.1126f },
+    { -3.6109f, -17.2532f, 26.3277f, 0.3322f, 0.1203f },
+    { -3.5528f, -17.3119f, 26.776f, 0.3345f, 0.1263f },
+    { -3.5266f, -17.3306f, 27.1933f, 0.3368f, 0.1323f },
+    { -3.5975f, -18.2059f, 27.6097f, 0.3507f, 0.1315f },
+    { -3.623f, -17.38f, 27.6487f, 0.3409f, 0.1391f },
+    { -3.7842f, -19.1774f, 28.1558f, 0.3653f, 0.1319f },
+    { -3.7902f, -18.3048f, 28.1213f, 0.3555f, 0.1386f },
+    { -3.8011f, -17.451f, 28.1083f, 0.345f, 0.146f },
+    { -4.0072f, -19.2936f, 28.7427f, 0.3706f, 0.1398f },
+    { -4.0215f, -18.4072f, 28.629f, 0.3604f, 0.146f },
+    { -4.0203f, -17.5341f, 28.5384f, 0.3503f, 0.1516f },
+    { -3.8369f, -16.7851f, 28.1152f, 0.3389f, 0.1502f },
+    { -4.2005f, -19.345f, 29.3924f, 0.3759f, 0.1493f },
+    { -4.2253f, -18.4406f, 29.1983f, 0.3652f, 0.1548f },
+    { -4.0006f, -16.884f, 28.5068f, 0.3427f, 0.1554f },
+    { -3.8876f, -16.3001f, 28.2701f, 0.3328f, 0.1544f },
+    { -3.9989f, -16.4476f, 28.6258f, 0.3363f, 0.1583f },
+    { -4.2107f, -17.5501f, 29.0188f, 0.3543f, 0.1595f },
+    { -4.1442f, -16.9289f, 28.9164f, 0.3463f, 0.1618f },
+    { -4.0971f, -16.6124f, 28.9063f, 0.3397f, 0.1621f },
+    { -4.2354f, -16.8472f, 29.4234f, 0.3495f, 0.1706f },
+    { -4.1473f, -16.4883f, 29.2264f, 0.3426f, 0.1691f },
+    { -4.2292f, -16.319f, 29.6989f, 0.3454f, 0.1761f },
+    { -4.308f, -16.6601f, 29.9612f, 0.3524f, 0.1806f },
+    { -4.3577f, -17.2036f, 30.262f, 0.3595f, 0.1851f },
+    { -4.3026f, -17.4197f, 29.6293f, 0.358f, 0.1703f },
+    { -4.3354f, -18.3323f, 29.8948f, 0.3697f, 0.1666f },
+    { -4.3843f, -18.1502f, 30.6062f, 0.3743f, 0.1792f },
+    { -4.4045f, -17.9617f, 31.22f, 0.3795f, 0.1907f },
+    { -4.4379f, -16.9627f, 30.8089f, 0.3643f, 0.1959f },
+    { -4.3628f, -19.1506f, 30.9469f, 0.3869f, 0.1744f },
+    { -4.4011f, -17.73f, 31.7446f, 0.3845f, 0.2015f },
+    { -4.5048f, -16.7226f, 31.2858f, 0.369f, 0.2067f },
+    { -4.3082f, -19.0027f, 31.6117f, 0.3926f, 0.1859f },
+    { -4.1926f, -18.8629f, 32.319f, 0.4003f, 0.1982f },
+    { -4.1623f, -19.7024f, 31.899f, 0.4017f, 0.1818f },
+    { -4.0115f, -19.5805f, 32.472f, 0.4079f, 0.1911f },
+    { -4.1705f, -18.2114f, 32.7062f, 0.4016f, 0.2119f },
+    { -4.3795f, -17.4178f, 32.1882f, 0.3888f, 0.212f },
+    { -4.5199f, -16.5086f, 31.7085f, 0.3746f, 0.2141f },
+    { -4.3712f, -17.1106f, 32.5184f, 0.3919f, 0.2206f },
+    { -4.542f, -16.3313f, 32.0262f, 0.3802f, 0.2215f },
+    { -4.6299f, -16.2012f, 32.1879f, 0.3803f, 0.2234f },
+    { -4.1336f, -17.7603f, 33.0026f, 0.4037f, 0.2223f },
+    { -4.4075f, -16.8939f, 32.7025f, 0.3935f, 0.2263f },
+    { -4.7541f, -16.1109f, 32.2436f, 0.3805f, 0.2254f },
+    { -3.9382f, -17.9771f, 33.4461f, 0.4128f, 0.2264f },
+    { -4.1222f, -17.4422f, 33.1924f, 0.4053f, 0.2297f },
+    { -4.4795f, -16.7582f, 32.7834f, 0.394f, 0.2297f },
+    { -4.5777f, -16.6942f, 32.8039f, 0.3938f, 0.2318f },
+    { -4.885f, -16.0529f, 32.2431f, 0.3799f, 0.2261f },
+    { -4.1541f, -17.2447f, 33.2936f, 0.4061f, 0.2345f },
+    { -4.6513f, -16.6991f, 32.739f, 0.393f, 0.2334f },
+    { -4.9603f, -16.0408f, 32.18f, 0.3792f, 0.2268f },
+    { -4.9177f, -16.0882f, 32.0479f, 0.3795f, 0.2292f },
+    { -4.2471f, -17.1555f, 33.3242f, 0.4058f, 0.2372f },
+    { -4.3575f, -17.1583f, 33.2464f, 0.4042f, 0.2389f },
+    { -4.6493f, -16.7697f, 32.5639f, 0.3915f, 0.2354f },
+    { -4.886f, -16.2396f, 31.7272f, 0.3798f, 0.2316f },
+    { -4.6513f, -16.9289f, 32.1767f, 0.3877f, 0.238f },
+    { -4.994f, -16.5397f, 31.0982f, 0.3727f, 0.2344f },
+    { -4.4415f, -17.2368f, 33.0224f, 0.4012f, 0.2407f },
+    { -4.2338f, -17.2868f, 33.5714f, 0.4108f, 0.2429f },
+    { -4.5156f, -17.3952f, 32.5688f, 0.3956f, 0.2432f },
+    { -4.0708f, -17.2651f, 33.7019f, 0.4138f, 0.2421f },
+    { -4.4029f, -17.3891f, 33.2841f, 0.4064f, 0.2442f },
+    { -4.2139f, -17.1851f, 33.7663f, 0.4149f, 0.247f },
+    { -4.5495f, -17.5659f, 32.7724f, 0.3995f, 0.2462f },
+    { -4.4554f, -17.3284f, 33.4205f, 0.4092f, 0.2472f },
+    { -3.9827f, -17.1326f, 33.9585f, 0.4194f, 0.2474f },
+    { -4.2315f, -16.9534f, 33.8834f, 0.4186f, 0.2526f },
+    { -3.9524f, -17.3576f, 33.705f, 0.4151f, 0.2399f },
+    { -3.8088f, -17.2283f, 34.0117f, 0.422f, 0.2458f },
+    { -3.9173f, -17.5981f, 33.6099f, 0.4143f, 0.2345f },
+    { -3.7392f, -17.5295f, 33.9407f, 0.4216f, 0.2397f },
+    { -3.7448f, -17.9764f, 33.8181f, 0.4203f, 0.231f },
+    { -3.9876f, -18.4853f, 33.2429f, 0.4117f, 0.2161f },
+    { -3.9954f, -19.0424f, 33.0831f, 0.4122f, 0.206f },
+    { -3.7964f, -18.509f, 33.7169f, 0.4199f, 0.2214f },
+    { -3.891f, -19.5682f, 33.0499f, 0.4154f, 0.1983f },
+    { -3.8225f, -19.0763f, 33.6329f, 0.4207f, 0.2119f },
+    { -3.5135f, -17.9738f, 34.0879f, 0.4272f, 0.2345f },
+    { -3.5622f, -18.5525f, 34.0468f, 0.4271f, 0.2246f },
+    { -3.5342f, -17.4046f, 34.1702f, 0.4282f, 0.2448f },
+    { -3.2643f, -17.9649f, 34.292f, 0.4336f, 0.2372f },
+    { -3.6576f, -16.9881f, 34.2079f, 0.4281f, 0.2523f },
+    { -3.3013f, -17.283f, 34.3344f, 0.4344f, 0.249f },
+    { -3.4492f, -16.608f, 34.3396f, 0.4348f, 0.2609f },
+    { -3.0392f, -17.2248f, 34.4689f, 0.4406f, 0.2518f },
+    { -3.0784f, -16.5702f, 34.442f, 0.442f, 0.2634f },
+    { -3.8888f, -16.538f, 34.1563f, 0.4283f, 0.261f },
+    { -3.9169f, -16.8675f, 34.1153f, 0.4244f, 0.254f },
+    { -4.2828f, -16.6512f, 33.9017f, 0.4215f, 0.259f },
+    { -4.5207f, -17.1564f, 33.5033f, 0.4118f, 0.2512f },
+    { -4.3637f, -16.3381f, 33.8003f, 0.4233f, 0.2653f },
+    { -4.661f, -17.5428f, 32.8633f, 0.4015f, 0.2484f },
+    { -4.6112f, -16.8935f, 33.5138f, 0.4141f, 0.2564f },
+    { -4.7583f, -17.4274f, 32.9172f, 0.4034f, 0.2511f },
+    { -4.6448f, -17.8111f, 31.969f, 0.3894f, 0.2495f },
+    { -4.7849f, -17.8081f, 32.0371f, 0.391f, 0.2513f },
+    { -4.596f, -17.6377f, 31.8021f, 0.3863f, 0.2466f },
+    { -4.6208f, -17.917f, 30.8667f, 0.3747f, 0.25f },
+    { -4.737f, -17.1995f, 31.4756f, 0.3802f, 0.2411f },
+    { -5.1181f, -16.9117f, 30.3069f, 0.3655f, 0.2371f },
+    { -4.8107f, -17.5178f, 30.6085f, 0.3703f, 0.2442f },
+    { -4.7766f, -17.8204f, 29.7236f, 0.3593f, 0.2467f },
+    { -5.1349f, -17.2792f, 29.4994f, 0.3555f, 0.2394f },
+    { -4.5281f, -18.186f, 29.9066f, 0.3624f, 0.2526f },
+    { -4.6834f, -18.0926f, 28.8068f, 0.3478f, 0.2499f },
+    { -5.0713f, -17.6343f, 28.6446f, 0.3454f, 0.2417f },
+    { -4.9544f, -17.9692f, 27.7116f, 0.3336f, 0.2503f },
+    { -4.4049f, -18.4093f, 28.937f, 0.35f, 0.2554f },
+    { -4.5797f, -18.3199f, 27.844f, 0.3363f, 0.2553f },
+    { -4.89f, -18.2493f, 27.0119f, 0.3218f, 0.2589f },
+    { -4.5447f, -18.5043f, 27.1287f, 0.3276f, 0.2609f },
+    { -4.9842f, -18.4404f, 26.8572f, 0.3206f, 0.2624f },
+    { -4.3388f, -18.5516f, 27.973f, 0.3384f, 0.2597f },
+    { -4.6575f, -18.6478f, 26.9545f, 0.3243f, 0.2648f },
+    { -5.1359f, -18.5304f, 27.1633f, 0.3193f, 0.2659f },
+    { -4.8035f, -18.7296f, 27.2557f, 0.3236f, 0.2679f },
+    { -4.4147f, -18.5993f, 27.4192f, 0.3315f, 0.2624f },
+    { -4.4531f, -18.7098f, 27.2989f, 0.3298f, 0.2656f },
+    { -4.6087f, -18.748f, 27.4861f, 0.3321f, 0.2671f },
+    { -4.3769f, -18.7017f, 28.0318f, 0.3391f, 0.2628f },
+    { -4.5886f, -18.7632f, 28.0273f, 0.3394f, 0.2656f },
+    { -4.4115f, -18.5984f, 28.9847f, 0.351f, 0.2587f },
+    { -4.5396f, -18.3745f, 29.9893f, 0.364f, 0.2558f },
+    { -4.6093f, -18.6648f, 28.974f, 0.3515f, 0.2614f },
+    { -4.6533f, -18.0917f, 30.9994f, 0.3772f, 0.253f },
+    { -4.8094f, -18.1062f, 31.0485f, 0.3786f, 0.255f },
+    { -4.7169f, -18.4188f, 30.0043f, 0.365f, 0.2581f },
+    { -4.918f, -17.717f, 32.0673f, 0.3926f, 0.2536f },
+    { -4.9903f, -18.0252f, 31.0556f, 0.38f, 0.2573f },
+    { -4.9654f, -18.3515f, 29.9841f, 0.3663f, 0.261f },
+    { -4.9044f, -18.6135f, 28.9291f, 0.3526f, 0.2649f },
+    { -5.2346f, -17.8044f, 31.0708f, 0.3824f, 0.2609f },
+    { -4.8681f, -18.7289f, 27.9668f, 0.34f, 0.2693f },
+    { -4.8035f, -18.7296f, 27.2557f, 0.3279f, 0.2739f },
+    { -5.2444f, -18.5074f, 27.846f, 0.3418f, 0.2744f },
+    { -5.1359f, -18.5304f, 27.1633f, 0.3279f, 0.278f },
+    { -5.3665f, -18.3419f, 28.8655f, 0.3555f, 0.2704f },
+    { -5.2929f, -18.1152f, 30.0249f, 0.3694f, 0.2649f },
+    { -5.9005f, -17.8027f, 28.3044f, 0.3553f, 0.2802f },
+    { -5.581f, -17.3998f, 31.1441f, 0.3868f, 0.2665f },
+    { -5.7069f, -17.6525f, 30.2226f, 0.3758f, 0.27f },
+    { -5.8463f, -17.7171f, 29.4272f, 0.3675f, 0.2747f },
+    { -5.8276f, -16.9086f, 31.1497f, 0.3914f, 0.2731f },
+    { -6.0242f, -17.127f, 30.3507f, 0.382f, 0.2757f },
+    { -6.054f, -17.2975f, 29.7437f, 0.3744f, 0.2775f },
+    { -6.1133f, -17.4313f, 28.8723f, 0.3646f, 0.2811f },
+    { -6.2214f, -17.0217f, 29.4649f, 0.3742f, 0.2822f },
+    { -6.0614f, -16.7024f, 30.1823f, 0.3841f, 0.2814f },
+    { -6.4f, -16.9078f, 28.6245f, 0.3663f, 0.288f },
+    { -6.3453f, -16.6311f, 29.2266f, 0.3746f, 0.2876f },
+    { -6.3267f, -17.1153f, 28.1012f, 0.3593f, 0.2886f },
+    { -6.5321f, -16.1155f, 29.2773f, 0.3782f, 0.2932f },
+    { -5.7463f, -18.0074f, 27.6611f, 0.346f, 0.2816f },
+    { -5.6041f, -18.0693f, 27.1217f, 0.3385f, 0.2842f },
+    { -4.9842f, -18.4404f, 26.8572f, 0.3257f, 0.2825f },
+    { -6.2151f, -17.2651f, 27.6113f, 0.3527f, 0.2896f },
+    { -5.4274f, -18.0122f, 26.8656f, 0.3345f, 0.2871f },
+    { -4.89f, -18.2493f, 27.0119f, 0.3235f, 0.287f },
+    { -6.0611f, -17.3393f, 27.2327f, 0.3475f, 0.2909f },
+    { -5.303f, -17.8164f, 27.0026f, 0.3347f, 0.2923f },
+    { -4.9544f, -17.9692f, 27.7116f, 0.331f, 0.3003f },
+    { -5.861f, -17.3203f, 27.0429f, 0.3444f, 0.2926f },
+    { -5.3175f, -17.462f, 27.6427f, 0.3394f, 0.3021f },
+    { -5.0713f, -17.6343f, 28.6446f, 0.3385f, 0.3136f },
+    { -5.6904f, -17.1778f, 27.1451f, 0.3442f, 0.2965f },
+    { -5.3933f, -17.0207f, 28.501f, 0.3475f, 0.3131f },
+    { -5.6249f, -16.8813f, 27.6425f, 0.3474f, 0.304f },
+    { -5.4525f, -16.5641f, 29.2929f, 0.3577f, 0.3221f },
+    { -5.1349f, -17.2792f, 29.4994f, 0.35f, 0.3229f },
+    { -5.6539f, -16.3554f, 28.3605f, 0.3552f, 0.3131f },
+    { -5.438f, -16.1163f, 30.0437f, 0.3684f, 0.3294f },
+    { -5.1181f, -16.9117f, 30.3069f, 0.3616f, 0.3323f },
+    { -5.6878f, -15.8075f, 29.0692f, 0.3651f, 0.3207f },
+    { -5.6619f, -15.2907f, 29.7664f, 0.3756f, 0.327f },
+    { -5.6811f, -14.5941f, 29.4224f, 0.3819f, 0.3237f },
+    { -5.5118f, -14.8579f, 30.4501f, 0.3855f, 0.3323f },
+    { -5.2929f, -15.7015f, 30.7788f, 0.3779f, 0.3355f },
+    { -4.994f, -16.5397f, 31.0982f, 0.3694f, 0.3381f },
+    { -5.1491f, -15.4001f, 31.3512f, 0.3848f, 0.3398f },
+    { -4.886f, -16.2396f, 31.7272f, 0.3772f, 0.3439f },
+    { -4.9177f, -16.0882f, 32.0479f, 0.3796f, 0.3457f },
+    { -5.3412f, -14.5746f, 30.9801f, 0.3927f, 0.3362f },
+    { -5.1385f, -15.2927f, 31.6139f, 0.3877f, 0.3421f },
+    { -4.9603f, -16.0408f, 32.18f, 0.3819f, 0.3475f },
+    { -5.5284f, -14.1821f, 30.0447f, 0.3912f, 0.3283f },
+    { -5.254f, -14.5063f, 31.2164f, 0.3954f, 0.3383f },
+    { -5.363f, -13.9277f, 30.5454f, 0.3984f, 0.3318f },
+    { -5.1297f, -15.3151f, 31.7003f, 0.3888f, 0.3436f },
+    { -5.2067f, -13.8523f, 30.8099f, 0.4023f, 0.3341f },
+    { -4.9914f, -15.4031f, 31.744f, 0.3902f, 0.3455f },
+    { -4.885f, -16.0529f, 32.2431f, 0.3829f, 0.3484f },
+    { -5.152f, -14.5834f, 31.2879f, 0.3963f, 0.3399f },
+    { -4.9374f, -14.7362f, 31.3238f, 0.3982f, 0.3425f },
+    { -4.8035f, -15.5158f, 31.7432f, 0.3917f, 0.3475f },
+    { -4.7541f, -16.1109f, 32.2436f, 0.3839f, 0.3493f },
+    { -4.6299f, -16.2012f, 32.1879f, 0.385f, 0.3501f },
+    { -4.6995f, -14.9066f, 31.3222f, 0.4002f, 0.3453f },
+    { -4.6458f, -15.6122f, 31.6962f, 0.393f, 0.3489f },
+    { -4.542f, -16.3313f, 32.0262f, 0.3861f, 0.351f },
+    { -4.5139f, -14.2168f, 31.0204f, 0.4103f, 0.3424f },
+    { -4.5278f, -15.0364f, 31.2811f, 0.4017f, 0.3474f },
+    { -4.5373f, -15.7253f, 31.5588f, 0.3943f, 0.3505f },
+    { -4.4969f, -15.8879f, 31.2865f, 0.3959f, 0.353f },
+    { -4.5199f, -16.5086f, 31.7085f, 0.3892f, 0.3534f },
+    { -4.4187f, -15.1738f, 31.1658f, 0.4027f, 0.3494f },
+    { -4.4683f, -16.1069f, 30.9108f, 0.3975f, 0.3554f },
+    { -4.5048f, -16.7226f, 31.2858f, 0.3923f, 0.3559f },
+    { -4.4379f, -16.9627f, 30.8089f, 0.3942f, 0.3567f },
+    { -4.3688f, -15.3672f, 30.9416f, 0.4035f, 0.3523f },
+    { -4.3397f, -15.6343f, 30.6116f, 0.404f, 0.3552f },
+    { -4.3955f, -16.3888f, 30.463f, 0.3988f, 0.3569f },
+    { -4.3577f, -17.2036f, 30.262f, 0.3961f, 0.3575f },
+    { -4.308f, -16.6601f, 29.9612f, 0.3999f, 0.3579f },
+    { -4.2933f, -15.993f, 30.179f, 0.4039f, 0.3574f },
+    { -4.2292f, -16.319f, 29.6989f, 0.4037f, 0.3583f },
+    { -4.167f, -15.0565f, 30.3804f, 0.4124f, 0.3548f },
+    { -4.1474f, -15.5282f, 29.9537f, 0.4101f, 0.3585f },
+    { -4.1156f, -15.9793f, 29.4703f, 0.4074f, 0.3615f },
+    { -4.1473f, -16.4883f, 29.2264f, 0.4027f, 0.3608f },
+    { -3.9731f, -14.5543f, 30.1955f, 0.4203f, 0.3551f },
+    { -4.0517f, -16.2159f, 28.9873f, 0.4053f, 0.3632f },
+    { -4.0971f, -16.6124f, 28.9063f, 0.4017f, 0.3633f },
+    { -3.9989f, -16.4476f, 28.6258f, 0.4035f, 0.3641f },
+    { -3.9434f, -15.989f, 28.7009f, 0.4074f, 0.3659f },
+    { -3.8876f, -16.3001f, 28.2701f, 0.4053f, 0.3649f },
+    { -3.9819f, -15.6553f, 29.2488f, 0.4111f, 0.3645f },
+    { -3.9808f, -15.1027f, 29.7548f, 0.416f, 0.3604f },
+    { -3.843f, -15.3611f, 29.0081f, 0.4143f, 0.3675f },
+    { -3.8162f, -14.8244f, 29.5498f, 0.4203f, 0.3632f },
+    { -3.7811f, -14.3087f, 30.0352f, 0.4253f, 0.3572f },
+    { -3.8175f, -15.7663f, 28.3621f, 0.4086f, 0.3693f },
+    { -3.6767f, -14.5838f, 29.3423f, 0.4239f, 0.3665f },
+    { -3.7586f, -16.1708f, 27.8381f, 0.4033f, 0.3687f },
+    { -3.8369f, -16.7851f, 28.1152f, 0.4008f, 0.3637f },
+    { -3.7517f, -15.079f, 28.7509f, 0.4171f, 0.3709f },
+    { -3.7529f, -15.5458f, 28.0354f, 0.4095f, 0.3731f },
+    { -3.6852f, -16.7052f, 27.6626f, 0.3984f, 0.3659f },
+    { -3.8011f, -17.451f, 28.1083f, 0.3963f, 0.3625f },
+    { -3.623f, -17.38f, 27.6487f, 0.3938f, 0.3619f },
+    { -3.7f, -16.0455f, 27.447f, 0.4022f, 0.3725f },
+    { -3.6126f, -16.6393f, 27.2371f, 0.3963f, 0.3679f },
+    { -3.5266f, -17.3306f, 27.1933f, 0.3913f, 0.3614f },
+    { -3.6859f, -16.5826f, 26.927f, 0.3946f, 0.3695f },
+    { -3.5528f, -17.3119f, 26.776f, 0.388f, 0.361f },
+    { -3.7995f, -15.9104f, 27.2139f, 0.4019f, 0.3757f },
+    { -3.7974f, -16.4901f, 26.5964f, 0.3927f, 0.3719f },
+    { -3.6109f, -17.2532f, 26.3277f, 0.3847f, 0.3607f },
+    { -3.9338f, -15.7486f, 26.9647f, 0.4013f, 0.3792f },
+    { -3.8283f, -15.3252f, 27.7854f, 0.4105f, 0.3771f },
+    { -3.9375f, -15.0893f, 27.5001f, 0.4108f, 0.3817f },
+    { -3.7608f, -14.7909f, 28.4799f, 0.4194f, 0.375f },
+    { -3.8077f, -14.493f, 28.1488f, 0.4209f, 0.3801f },
+    { -3.5853f, -14.2714f, 29.1357f, 0.4278f, 0.3703f },
+    { -3.5441f, -13.9403f, 28.8571f, 0.431f, 0.3752f },
+    { -3.8299f, -14.1816f, 27.7111f, 0.421f, 0.3866f },
+    { -3.403f, -13.8519f, 29.795f, 0.4348f, 0.3631f },
+    { -3.1622f, -13.4101f, 29.695f, 0.4422f, 0.3674f },
+    { -3.591f, -14.1359f, 29.9011f, 0.4295f, 0.3601f },
+    { -3.3149f, -13.6174f, 30.4999f, 0.4393f, 0.3536f },
+    { -3.7813f, -13.9665f, 30.5124f, 0.4282f, 0.3504f },
+    { -3.0165f, -13.3796f, 30.5293f, 0.4464f, 0.3557f },
+    { -3.5574f, -13.8107f, 30.5191f, 0.4335f, 0.3515f },
+    { -3.227f, -13.5331f, 31.1884f, 0.4432f, 0.3438f },
+    { -2.9099f, -13.433f, 31.1998f, 0.4496f, 0.3458f },
+    { -3.5559f, -13.5651f, 31.1692f, 0.4367f, 0.3417f },
+    { -2.5125f, -13.2659f, 31.2516f, 0.4576f, 0.3477f },
+    { -3.8417f, -13.7316f, 30.8633f, 0.429f, 0.3443f },
+    { -2.7382f, -13.5321f, 31.8059f, 0.454f, 0.3373f },
+    { -4.048f, -14.0271f, 30.7847f, 0.422f, 0.3459f },
+    { -2.3738f, -13.4454f, 31.8383f, 0.4607f, 0.3389f },
+    { -3.0452f, -13.564f, 31.7983f, 0.4485f, 0.3357f },
+    { -2.5532f, -13.6878f, 32.3554f, 0.4582f, 0.3296f },
+    { -2.2279f, -13.6439f, 32.4039f, 0.4639f, 0.3305f },
+    { -2.84f, -13.6986f, 32.3373f, 0.4535f, 0.3284f },
+    { -1.8349f, -13.5739f, 32.4494f, 0.4708f, 0.3316f },
+    { -3.3082f, -13.5506f, 31.7912f, 0.4439f, 0.3341f },
+    { -2.0945f, -13.8767f, 32.9105f, 0.4664f, 0.3227f },
+    { -3.5409f, -13.5008f, 31.76f, 0.44f, 0.3327f },
+    { -1.7257f, -13.829f, 32.9623f, 0.4727f, 0.3236f },
+    { -2.4069f, -13.9112f, 32.8561f, 0.4611f, 0.3219f },
+    { -1.9808f, -14.1749f, 33.3615f, 0.468f, 0.3149f },
+    { -2.682f, -13.9249f, 32.813f, 0.4567f, 0.321f },
+    { -1.6239f, -14.1346f, 33.4147f, 0.4742f, 0.3158f },
+    { -2.2958f, -14.2128f, 33.3043f, 0.4627f, 0.3139f },
+    { -1.5403f, -14.5389f, 33.8235f, 0.4751f, 0.3072f },
+    { -1.8942f, -14.5694f, 33.76f, 0.4688f, 0.3063f },
+    { -2.2163f, -14.6033f, 33.6957f, 0.4632f, 0.3053f },
+    { -1.1711f, -14.5244f, 33.8971f, 0.4818f, 0.3075f },
+    { -2.5669f, -14.2368f, 33.2367f, 0.4583f, 0.3132f },
+    { -1.2266f, -14.1036f, 33.4701f, 0.4812f, 0.3165f },
+    { -1.2814f, -13.7754f, 32.9976f, 0.4805f, 0.3246f },
+    { -0.7891f, -14.5218f, 33.9654f, 0.4888f, 0.3075f },
+    { -0.8125f, -14.0848f, 33.522f, 0.4886f, 0.3167f },
+    { -1.3448f, -13.4849f, 32.4585f, 0.4794f, 0.3332f },
+    { -0.8199f, -13.7276f, 33.0247f, 0.4886f, 0.3254f },
+    { -1.9403f, -13.3213f, 31.859f, 0.4687f, 0.3407f },
+    { -1.4263f, -13.1769f, 31.8315f, 0.478f, 0.3433f },
+    { -2.045f, -13.064f, 31.2836f, 0.4668f, 0.3501f },
+    { -2.6244f, -13.0901f, 30.6817f, 0.4555f, 0.3569f },
+    { -2.1515f, -12.795f, 30.8157f, 0.4655f, 0.3585f },
+    { -2.7196f, -12.9059f, 30.1268f, 0.454f, 0.3661f },
+    { -1.5176f, -12.8594f, 31.2357f, 0.4766f, 0.3534f },
+    { -2.2526f, -12.531f, 30.3707f, 0.4645f, 0.3669f },
+    { -1.6104f, -12.5407f, 30.7902f, 0.4756f, 0.362f },
+    { -0.9016f, -13.0523f, 31.7843f, 0.4873f, 0.3456f },
+    { -0.9796f, -12.6993f, 31.1554f, 0.4861f, 0.3565f },
+    { -0.8401f, -13.4001f, 32.4525f, 0.4883f, 0.3347f },
+    { -0.4032f, -13.3425f, 32.453f, 0.496f, 0.3353f },
+    { -0.436f, -12.9878f, 31.7459f, 0.4955f, 0.3468f },
+    { -0.3997f, -13.6969f, 33.0518f, 0.496f, 0.3256f },
+    { -0.0001f, -13.3217f, 32.4528f, 0.503f, 0.3353f },
+    { -0.4047f, -14.0816f, 33.5643f, 0.4959f, 0.3166f },
+    { -0.f, -13.6859f, 33.0653f, 0.503f, 0.3253f },
+    { -0.3971f, -14.5268f, 34.0127f, 0.4959f, 0.3073f },
+    { -0.f, -14.0838f, 33.5831f, 0.503f, 0.3162f },
+    { -0.7627f, -14.9664f, 34.3144f, 0.4889f, 0.2988f },
+    { -0.f, -14.5313f, 34.0312f, 0.503f, 0.3071f },
+    { -1.1271f, -14.962f, 34.2381f, 0.4821f, 0.2989f },
+    { -0.3848f, -14.9704f, 34.3605f, 0.496f, 0.2988f },
+    { -0.7463f, -15.3469f, 34.5285f, 0.489f, 0.2916f },
+    { -0.f, -14.9722f, 34.3761f, 0.5031f, 0.2987f },
+    { -0.3756f, -15.35f, 34.5711f, 0.496f, 0.2917f },
+    { -0.f, -15.3507f, 34.5841f, 0.5031f, 0.2918f },
+    { 0.3847f, -14.9704f, 34.3605f, 0.5101f, 0.2986f },
+    { 0.397f, -14.5268f, 34.0127f, 0.5101f, 0.307f },
+    { 0.3756f, -15.35f, 34.5711f, 0.5101f, 0.2917f },
+    { 0.4046f, -14.0816f, 33.5643f, 0.51f, 0.316f },
+    { 0.7627f, -14.9664f, 34.3144f, 0.517f, 0.2985f },
+    { 0.789f, -14.5218f, 33.9654f, 0.5169f, 0.3068f },
+    { 0.3996f, -13.6969f, 33.0518f, 0.5098f, 0.325f },
+    { 0.8124f, -14.0848f, 33.522f, 0.5169f, 0.3157f },
+    { 1.2266f, -14.1036f, 33.4701f, 0.5237f, 0.3149f },
+    { 0.8199f, -13.7276f, 33.0247f, 0.5167f, 0.3242f },
+    { 1.171f, -14.5244f, 33.8971f, 0.5235f, 0.3064f },
+    { 1.2813f, -13.7754f, 32.9976f, 0.5242f, 0.3229f },
+    { 1.7256f, -13.829f, 32.9623f, 0.5313f, 0.3214f },
+    { 1.3447f, -13.4903f, 32.45f, 0.525f, 0.3315f },
+    { 1.6238f, -14.1346f, 33.4146f, 0.5301f, 0.3139f },
+    { 1.8348f, -13.5755f, 32.4469f, 0.5328f, 0.3294f },
+    { 2.0944f, -13.8767f, 32.9105f, 0.537f, 0.3202f },
+    { 2.2279f, -13.6441f, 32.4036f, 0.5391f, 0.3279f },
+    { 1.9402f, -13.3275f, 31.8491f, 0.5346f, 0.3386f },
+    { 2.3737f, -13.4461f, 31.8372f, 0.5418f, 0.3362f },
+    { 2.7381f, -13.5322f, 31.8056f, 0.5479f, 0.3342f },
+    { 1.4262f, -13.1983f, 31.7975f, 0.5262f, 0.3419f },
+    { 2.5532f, -13.6879f, 32.3553f, 0.5442f, 0.3267f },
+    { 0.84f, -13.4079f, 32.4401f, 0.5169f, 0.3336f },
+    { 0.4031f, -13.3476f, 32.4448f, 0.5097f, 0.3348f },
+    { 0.9014f, -13.0836f, 31.7346f, 0.5178f, 0.3449f },
+    { 0.4358f, -13.0085f, 31.713f, 0.5102f, 0.3465f },
+    { -0.0001f, -12.9757f, 31.7208f, 0.503f, 0.3471f },
+    { 0.9788f, -12.7599f, 31.0593f, 0.5189f, 0.3561f },
+    { -0.4804f, -12.631f, 31.0901f, 0.4948f, 0.3581f },
+    { 0.4794f, -12.6705f, 31.0274f, 0.5108f, 0.3581f },
+    { -0.0005f, -12.6296f, 31.0456f, 0.503f, 0.3586f },
+    { -1.0497f, -12.356f, 30.7013f, 0.4854f, 0.3655f },
+    { -0.5183f, -12.27f, 30.6453f, 0.4944f, 0.3672f },
+    { -1.6934f, -12.2362f, 30.3872f, 0.475f, 0.3702f },
+    { -1.1037f, -12.0333f, 30.3087f, 0.4849f, 0.3738f },
+    { -2.3409f, -12.2886f, 29.8639f, 0.4636f, 0.376f },
+    { -1.7554f, -11.9617f, 29.9189f, 0.4744f, 0.3792f },
+    { -2.8078f, -12.7013f, 29.5852f, 0.4531f, 0.3753f },
+    { -2.4148f, -12.0617f, 29.3507f, 0.4627f, 0.3851f },
+    { -3.1985f, -13.1647f, 29.102f, 0.4426f, 0.3773f },
+    { -2.8869f, -12.4767f, 29.0858f, 0.4525f, 0.384f },
+    { -3.2598f, -12.9203f, 28.6269f, 0.4424f, 0.3854f },
+    { -2.473f, -11.8442f, 28.8866f, 0.4617f, 0.3935f },
+    { -2.9549f, -12.2326f, 28.6574f, 0.452f, 0.3918f },
+    { -3.5764f, -13.3489f, 27.9527f, 0.4317f, 0.3901f },
+    { -3.3088f, -12.6379f, 28.2293f, 0.4425f, 0.3927f },
+    { -3.5553f, -13.6434f, 28.4333f, 0.4319f, 0.3822f },
+    { -3.8182f, -13.8543f, 27.2136f, 0.4203f, 0.3941f },
+    { -3.5647f, -13.025f, 27.5036f, 0.4315f, 0.3978f },
+    { -3.9668f, -14.5281f, 26.5596f, 0.4081f, 0.3939f },
+    { -3.2747f, -12.4409f, 27.9019f, 0.4421f, 0.3985f },
+    { -3.7635f, -13.509f, 26.703f, 0.4194f, 0.4022f },
+    { -3.4419f, -12.6209f, 27.2937f, 0.4344f, 0.4038f },
+    { -3.0297f, -12.0689f, 28.1794f, 0.4496f, 0.3992f },
+    { -3.1295f, -12.0856f, 27.5312f, 0.4435f, 0.4068f },
+    { -2.5386f, -11.6624f, 28.4297f, 0.4597f, 0.4012f },
+    { -2.6351f, -11.5427f, 27.9384f, 0.4561f, 0.4085f },
+    { -1.8795f, -11.3124f, 28.6197f, 0.4716f, 0.4036f },
+    { -1.9662f, -11.1157f, 28.2377f, 0.4694f, 0.4106f },
+    { -1.8331f, -11.5076f, 29.0155f, 0.473f, 0.3962f },
+    { -1.2482f, -10.8217f, 28.4345f, 0.4821f, 0.4125f },
+    { -1.8006f, -11.7184f, 29.4426f, 0.4738f, 0.3881f },
+    { -1.1805f, -11.0581f, 28.7416f, 0.4836f, 0.4056f },
+    { -1.1553f, -11.2689f, 29.0642f, 0.4843f, 0.3988f },
+    { -1.1335f, -11.7421f, 29.8645f, 0.4847f, 0.3827f },
+    { -1.1478f, -11.4861f, 29.4294f, 0.4846f, 0.3914f },
+    { -0.5453f, -11.9338f, 30.268f, 0.4942f, 0.3755f },
+    { -0.5572f, -11.6514f, 29.8149f, 0.4942f, 0.3845f },
+    { -0.5599f, -11.4043f, 29.3789f, 0.4942f, 0.3932f },
+    { -0.0025f, -11.9249f, 30.2332f, 0.503f, 0.3759f },
+    { -0.5593f, -11.1737f, 29.0528f, 0.4941f, 0.4003f },
+    { -0.0036f, -11.6506f, 29.7709f, 0.503f, 0.385f },
+    { -0.0043f, -11.4089f, 29.3302f, 0.503f, 0.3937f },
+    { 0.5503f, -11.7008f, 29.7333f, 0.5115f, 0.3847f },
+    { 0.5516f, -11.4364f, 29.3224f, 0.5114f, 0.3932f },
+    { -0.0042f, -11.166f, 29.0242f, 0.5029f, 0.4007f },
+    { -0.5699f, -10.9386f, 28.7876f, 0.4938f, 0.4067f },
+    { 0.5508f, -11.1899f, 29.0212f, 0.5115f, 0.4002f },
+    { -0.0037f, -10.9137f, 28.7886f, 0.5029f, 0.4069f },
+    { 0.5621f, -10.9432f, 28.7754f, 0.5117f, 0.4064f },
+    { -0.6063f, -10.6778f, 28.5342f, 0.4931f, 0.4132f },
+    { 0.5998f, -10.6782f, 28.5307f, 0.5124f, 0.4129f },
+    { -1.3283f, -10.5502f, 28.1258f, 0.4804f, 0.4197f },
+    { -0.0029f, -10.6434f, 28.5589f, 0.5029f, 0.4133f },
+    { -0.652f, -10.3781f, 28.2762f, 0.4922f, 0.4203f },
+    { -2.0564f, -10.8976f, 27.8405f, 0.4667f, 0.418f },
+    { -1.3908f, -10.2343f, 27.7986f, 0.4788f, 0.4277f },
+    { -2.7218f, -11.414f, 27.4128f, 0.4518f, 0.4161f },
+    { -2.1129f, -10.6382f, 27.3995f, 0.4638f, 0.4264f },
+    { -3.2101f, -12.0936f, 26.8355f, 0.4366f, 0.4148f },
+    { -2.758f, -11.2056f, 26.8536f, 0.4477f, 0.4249f },
+    { -3.6155f, -12.9864f, 26.2462f, 0.4208f, 0.4119f },
+    { -3.227f, -11.9039f, 26.2149f, 0.4318f, 0.4235f },
+    { -3.5848f, -12.6808f, 25.5829f, 0.4166f, 0.4211f },
+    { -3.9461f, -14.2048f, 26.0502f, 0.4065f, 0.4012f },
+    { -3.9197f, -13.8559f, 25.5468f, 0.4049f, 0.4089f },
+    { -3.9934f, -15.2954f, 26.0052f, 0.3963f, 0.3897f },
+    { -3.8959f, -13.4837f, 25.0567f, 0.4028f, 0.4166f },
+    { -4.0327f, -15.0051f, 25.5143f, 0.3942f, 0.3961f },
+    { -4.0725f, -14.6754f, 25.0452f, 0.3923f, 0.403f },
+    { -3.8693f, -16.0815f, 25.5649f, 0.3862f, 0.3819f },
+    { -4.0881f, -14.3094f, 24.59f, 0.3904f, 0.4101f },
+    { -3.9439f, -15.8023f, 25.0642f, 0.3837f, 0.3883f },
+    { -4.0286f, -15.4899f, 24.5928f, 0.3814f, 0.395f },
+    { -4.0889f, -15.1546f, 24.1364f, 0.3791f, 0.4017f },
+    { -3.693f, -16.5653f, 24.6793f, 0.3742f, 0.3791f },
+    { -4.19f, -14.7808f, 23.6893f, 0.3768f, 0.4089f },
+    { -3.6162f, -16.8419f, 25.2053f, 0.3771f, 0.3726f },
+    { -4.1519f, -13.8802f, 24.1374f, 0.3883f, 0.4179f },
+    { -3.9373f, -13.059f, 24.5805f, 0.4004f, 0.4248f },
+    { -4.3364f, -13.3611f, 23.6754f, 0.3859f, 0.4272f },
+    { -3.6108f, -12.2985f, 25.0782f, 0.4137f, 0.4295f },
+    { -4.1065f, -12.5525f, 24.1186f, 0.3978f, 0.434f },
+    { -3.2367f, -11.5802f, 25.6897f, 0.4286f, 0.4322f },
+    { -3.7464f, -11.8524f, 24.634f, 0.4109f, 0.4382f },
+    { -4.2809f, -11.8721f, 23.7635f, 0.3969f, 0.4446f },
+    { -3.2955f, -11.186f, 25.2801f, 0.4264f, 0.4405f },
+    { -4.5973f, -12.6153f, 23.1855f, 0.3837f, 0.4395f },
+    { -3.898f, -11.2787f, 24.3085f, 0.4097f, 0.4476f },
+    { -4.3971f, -14.3527f, 23.2462f, 0.3742f, 0.417f },
+    { -4.0217f, -15.6724f, 23.2245f, 0.3656f, 0.3989f },
+    { -3.8907f, -15.9742f, 23.6926f, 0.3685f, 0.3924f },
+    { -4.2434f, -15.3613f, 22.7899f, 0.3628f, 0.4057f },
+    { -3.7985f, -16.2706f, 24.1817f, 0.3715f, 0.3859f },
+    { -3.6168f, -16.4671f, 22.731f, 0.3545f, 0.3892f },
+    { -3.4859f, -16.7235f, 23.2558f, 0.3581f, 0.3831f },
+    { -3.393f, -16.989f, 23.8038f, 0.3617f, 0.3768f },
+    { -3.2936f, -17.2627f, 24.339f, 0.3648f, 0.3701f },
+    { -2.9544f, -17.3985f, 22.859f, 0.3484f, 0.374f },
+    { -2.8811f, -17.6337f, 23.4488f, 0.3525f, 0.368f },
+    { -3.0677f, -17.1694f, 22.2892f, 0.3443f, 0.3797f },
+    { -2.3762f, -17.9954f, 22.5357f, 0.34f, 0.3653f },
+    { -3.8302f, -16.2207f, 22.2657f, 0.3514f, 0.3952f },
+    { -2.4668f, -17.7839f, 21.9795f, 0.3361f, 0.3705f },
+    { -3.258f, -16.947f, 21.7854f, 0.3412f, 0.3852f },
+    { -4.5046f, -15.0596f, 22.3661f, 0.3596f, 0.4124f },
+    { -4.0821f, -15.9748f, 21.8243f, 0.3483f, 0.4011f },
+    { -4.6462f, -13.9637f, 22.7974f, 0.371f, 0.4248f },
+    { -4.8733f, -13.7068f, 22.3336f, 0.3664f, 0.4309f },
+    { -4.8449f, -12.5385f, 22.5657f, 0.3755f, 0.4441f },
+    { -4.7537f, -14.7862f, 21.9305f, 0.3558f, 0.4187f },
+    { -5.0856f, -12.4589f, 21.9869f, 0.3678f, 0.4484f },
+    { -5.1209f, -13.5074f, 21.7963f, 0.3602f, 0.4366f },
+    { -4.3283f, -15.7199f, 21.3715f, 0.3445f, 0.4072f },
+    { -5.0224f, -14.4948f, 21.4344f, 0.3509f, 0.4253f },
+    { -5.4197f, -12.3915f, 21.2782f, 0.3578f, 0.4532f },
+    { -5.4318f, -13.2907f, 21.1273f, 0.352f, 0.4429f },
+    { -5.0772f, -11.3843f, 22.0118f, 0.3731f, 0.4613f },
+    { -5.7431f, -12.3015f, 20.4251f, 0.3458f, 0.4585f },
+    { -4.8263f, -11.3375f, 22.6118f, 0.3822f, 0.4584f },
+    { -5.4124f, -11.4764f, 21.2821f, 0.3617f, 0.4642f },
+    { -5.1151f, -10.3294f, 21.8244f, 0.3749f, 0.475f },
+    { -5.7301f, -11.5118f, 20.418f, 0.3487f, 0.468f },
+    { -5.4178f, -10.5816f, 21.1112f, 0.3629f, 0.4757f },
+    { -4.8698f, -10.1188f, 22.4273f, 0.385f, 0.4742f },
+    { -5.2188f, -9.34f, 21.378f, 0.3718f, 0.4894f },
+    { -4.5998f, -11.2225f, 23.1284f, 0.3906f, 0.4567f },
+    { -4.338f, -10.9258f, 23.6081f, 0.3999f, 0.4571f },
+    { -4.6419f, -9.9331f, 22.9648f, 0.3942f, 0.4733f },
+    { -5.0279f, -8.8972f, 21.9679f, 0.3825f, 0.4918f },
+    { -4.3915f, -9.7556f, 23.4816f, 0.4034f, 0.4724f },
+    { -3.9717f, -10.5139f, 24.1599f, 0.4117f, 0.4582f },
+    { -4.5552f, -8.4036f, 23.2132f, 0.404f, 0.4912f },
+    { -3.4317f, -10.0533f, 24.8929f, 0.4276f, 0.4582f },
+    { -4.8227f, -8.5427f, 22.5615f, 0.393f, 0.493f },
+    { -4.0392f, -9.5368f, 24.0752f, 0.4147f, 0.4712f },
+    { -3.5055f, -9.2271f, 24.8429f, 0.4302f, 0.4697f },
+    { -4.1722f, -8.3259f, 23.9411f, 0.4166f, 0.488f },
+    { -3.621f, -8.1551f, 24.7637f, 0.4321f, 0.4851f },
+    { -4.3335f, -7.0074f, 23.7983f, 0.4179f, 0.5067f },
+    { -3.7601f, -6.9353f, 24.6717f, 0.4336f, 0.5028f },
+    { -4.7609f, -7.0036f, 22.9254f, 0.4035f, 0.5112f },
+    { -4.4855f, -5.7075f, 23.6871f, 0.4189f, 0.5253f },
+    { -5.1346f, -6.9928f, 21.8447f, 0.3868f, 0.5166f },
+    { -4.9408f, -5.6892f, 22.7411f, 0.4039f, 0.5299f },
+    { -5.2395f, -7.8766f, 21.2132f, 0.3743f, 0.5083f },
+    { -5.3054f, -5.5811f, 21.6818f, 0.3882f, 0.5359f },
+    { -5.3377f, -8.5247f, 20.6972f, 0.3643f, 0.5027f },
+    { -5.5147f, -6.3876f, 20.3886f, 0.367f, 0.5309f },
+    { -5.4437f, -7.2608f, 20.1426f, 0.3604f, 0.521f },
+    { -5.6144f, -5.3536f, 20.4456f, 0.3709f, 0.544f },
+    { -5.4438f, -9.7436f, 20.7374f, 0.3605f, 0.4877f },
+    { -5.6912f, -10.7315f, 20.2895f, 0.3499f, 0.4779f },
+    { -5.4677f, -9.053f, 20.1854f, 0.3546f, 0.4987f },
+    { -5.6319f, -9.9721f, 20.0373f, 0.349f, 0.4882f },
+    { -5.8489f, -10.6352f, 19.3611f, 0.3367f, 0.483f },
+    { -5.7123f, -9.8893f, 19.269f, 0.3379f, 0.4925f },
+    { -5.561f, -9.4057f, 19.8299f, 0.348f, 0.4961f },
+    { -5.5685f, -9.1961f, 19.266f, 0.3403f, 0.5011f },
+    { -5.4671f, -8.6004f, 19.4798f, 0.3456f, 0.5074f },
+    { -5.5086f, -8.9558f, 18.485f, 0.3292f, 0.5073f },
+    { -5.4212f, -7.992f, 19.8066f, 0.3527f, 0.5134f },
+    { -5.4103f, -8.3192f, 18.608f, 0.3333f, 0.5146f },
+    { -5.7061f, -9.6658f, 18.4181f, 0.326f, 0.4986f },
+    { -5.2657f, -8.1427f, 17.5575f, 0.3177f, 0.521f },
+    { -5.3858f, -8.7789f, 17.5136f, 0.3149f, 0.5133f },
+    { -5.9096f, -10.4186f, 18.3885f, 0.3232f, 0.4892f },
+    { -5.6344f, -9.4718f, 17.4706f, 0.3122f, 0.5044f },
+    { -5.9287f, -11.3888f, 19.4146f, 0.3348f, 0.4737f },
+    { -6.0258f, -11.1836f, 18.3773f, 0.3208f, 0.48f },
+    { -5.9518f, -12.1541f, 19.413f, 0.3323f, 0.4645f },
+    { -5.7246f, -13.0891f, 20.313f, 0.3416f, 0.4493f },
+    { -6.0612f, -11.9688f, 18.3591f, 0.3184f, 0.4706f },
+    { -5.3426f, -14.1395f, 20.8294f, 0.3447f, 0.4332f },
+    { -5.9185f, -12.9349f, 19.3397f, 0.3291f, 0.4553f },
+    { -5.6287f, -13.8367f, 20.0929f, 0.3363f, 0.4407f },
+    { -4.6295f, -15.3862f, 20.8955f, 0.3404f, 0.4145f },
+    { -5.0464f, -14.9034f, 20.3843f, 0.3362f, 0.4241f },
+    { -5.4092f, -14.5063f, 19.7763f, 0.3303f, 0.4328f },
+    { -3.7119f, -16.5078f, 20.8172f, 0.334f, 0.3963f },
+    { -5.7952f, -13.7028f, 19.2027f, 0.3253f, 0.446f },
+    { -3.4858f, -16.7277f, 21.308f, 0.338f, 0.3907f },
+    { -2.6273f, -17.5565f, 21.4611f, 0.333f, 0.3756f },
+    { -2.823f, -17.337f, 20.9532f, 0.3298f, 0.3806f },
+    { -1.8638f, -18.2653f, 21.7732f, 0.3294f, 0.3621f },
+    { -1.9943f, -18.028f, 21.2515f, 0.3265f, 0.3668f },
+    { -2.1561f, -17.8019f, 20.7188f, 0.3232f, 0.3715f },
+    { -1.3088f, -18.5684f, 21.6419f, 0.3241f, 0.3555f },
+    { -3.0195f, -17.1493f, 20.4282f, 0.3255f, 0.3857f },
+    { -1.4155f, -18.3406f, 21.1153f, 0.3212f, 0.3597f },
+    { -3.9767f, -16.2598f, 20.1058f, 0.3271f, 0.403f },
+    { -4.7011f, -15.4955f, 19.7365f, 0.3261f, 0.4174f },
+    { -3.1142f, -17.0261f, 19.7324f, 0.3184f, 0.3897f },
+    { -5.097f, -15.0416f, 19.4717f, 0.3247f, 0.4258f },
+    { -3.7124f, -16.4683f, 18.8218f, 0.3109f, 0.4024f },
+    { -5.5481f, -14.4294f, 19.0098f, 0.321f, 0.4369f },
+    { -4.4646f, -15.8287f, 18.8307f, 0.314f, 0.4148f },
+    { -5.1228f, -15.1322f, 18.8547f, 0.317f, 0.4269f },
+    { -5.8699f, -13.6144f, 18.2172f, 0.3127f, 0.4504f },
+    { -5.5654f, -14.4567f, 18.0764f, 0.3091f, 0.4395f },
+    { -6.0222f, -12.7821f, 18.3086f, 0.3158f, 0.4607f },
+    { -6.0443f, -12.5844f, 17.3207f, 0.3028f, 0.4659f },
+    { -6.0864f, -11.7647f, 17.3807f, 0.3053f, 0.4759f },
+    { -6.0392f, -10.9721f, 17.4116f, 0.3075f, 0.4855f },
+    { -6.054f, -11.5627f, 16.4604f, 0.2926f, 0.4805f },
+    { -5.8921f, -10.2075f, 17.4345f, 0.3098f, 0.4949f },
+    { -5.9915f, -10.7801f, 16.4885f, 0.2945f, 0.4902f },
+    { -5.8121f, -10.027f, 16.4856f, 0.296f, 0.4999f },
+    { -5.4967f, -9.313f, 16.4604f, 0.2971f, 0.5098f },
+    { -5.6851f, -9.9022f, 15.5283f, 0.2817f, 0.504f },
+    { -5.182f, -8.6511f, 16.4225f, 0.2982f, 0.5192f },
+    { -5.2923f, -9.1952f, 15.4214f, 0.2811f, 0.5149f },
+    { -4.8792f, -8.5582f, 15.2822f, 0.2802f, 0.5253f },
+    { -5.0047f, -8.0543f, 16.3817f, 0.2996f, 0.5272f },
+    { -4.5985f, -8.0374f, 15.1341f, 0.2799f, 0.5337f },
+    { -4.4059f, -8.5292f, 14.1381f, 0.2607f, 0.5322f },
+    { -4.0151f, -8.1877f, 14.0188f, 0.2602f, 0.5403f },
+    { -5.085f, -9.1212f, 14.5021f, 0.2666f, 0.5186f },
+    { -3.4758f, -8.7142f, 13.3161f, 0.2431f, 0.5427f },
+    { -4.3271f, -8.6788f, 13.6385f, 0.2518f, 0.5312f },
+    { -5.5396f, -9.8175f, 14.6465f, 0.2684f, 0.507f },
+    { -4.9388f, -9.0938f, 13.8508f, 0.2564f, 0.5201f },
+    { -5.9051f, -10.6331f, 15.5791f, 0.2813f, 0.494f },
+    { -5.8001f, -10.5162f, 14.7241f, 0.2688f, 0.4968f },
+    { -5.9905f, -11.3833f, 15.5811f, 0.2802f, 0.4843f },
+    { -6.0188f, -12.3653f, 16.3927f, 0.2903f, 0.4705f },
+    { -5.9161f, -11.2214f, 14.7502f, 0.2683f, 0.4874f },
+    { -5.8807f, -13.448f, 17.1951f, 0.2996f, 0.4551f },
+    { -5.9794f, -12.148f, 15.5415f, 0.2786f, 0.4745f },
+    { -5.8638f, -13.2186f, 16.2316f, 0.287f, 0.4598f },
+    { -5.5633f, -14.3722f, 16.9675f, 0.2952f, 0.4432f },
+    { -5.855f, -12.9409f, 15.422f, 0.2761f, 0.4644f },
+    { -5.0537f, -15.2557f, 17.9066f, 0.3049f, 0.4277f },
+    { -5.5668f, -14.1529f, 15.9232f, 0.2819f, 0.448f },
+    { -4.9977f, -15.2411f, 16.7087f, 0.29f, 0.4302f },
+    { -4.2797f, -15.9581f, 17.728f, 0.3001f, 0.4148f },
+    { -4.0891f, -15.9386f, 16.4897f, 0.2847f, 0.4159f },
+    { -3.4452f, -16.5387f, 17.5943f, 0.2956f, 0.4024f },
+    { -3.1305f, -16.4707f, 16.384f, 0.2806f, 0.4024f },
+    { -2.7516f, -16.9724f, 17.5591f, 0.2926f, 0.3923f },
+    { -2.4144f, -16.8435f, 16.465f, 0.279f, 0.392f },
+    { -3.0049f, -17.0002f, 18.7121f, 0.3066f, 0.3917f },
+    { -2.1529f, -17.2771f, 17.5547f, 0.2901f, 0.3839f },
+    { -2.3432f, -17.4033f, 18.5651f, 0.3019f, 0.3825f },
+    { -1.8638f, -17.0937f, 16.6039f, 0.2785f, 0.384f },
+    { -1.603f, -17.4709f, 17.5132f, 0.2873f, 0.3767f },
+    { -1.4014f, -17.2583f, 16.6717f, 0.2775f, 0.3776f },
+    { -1.4402f, -16.7462f, 15.72f, 0.2665f, 0.3826f },
+    { -1.0766f, -16.9429f, 15.9188f, 0.2675f, 0.3769f },
+    { -1.9595f, -16.537f, 15.4693f, 0.2657f, 0.3906f },
+    { -0.8465f, -16.1277f, 14.9104f, 0.2533f, 0.3796f },
+    { -1.3528f, -15.9765f, 14.6116f, 0.2522f, 0.3875f },
+    { -2.7657f, -16.2037f, 15.117f, 0.2644f, 0.4029f },
+    { -1.9665f, -15.7931f, 14.2937f, 0.2509f, 0.3971f },
+    { -1.4266f, -15.0922f, 13.6603f, 0.2388f, 0.3939f },
+    { -4.0334f, -15.7147f, 15.3688f, 0.271f, 0.4196f },
+    { -2.5544f, -15.3747f, 13.8935f, 0.2468f, 0.4072f },
+    { -4.9994f, -15.0307f, 15.5936f, 0.2762f, 0.4347f },
+    { -4.2531f, -15.2309f, 14.6181f, 0.262f, 0.4275f },
+    { -5.6003f, -13.7755f, 15.1838f, 0.2722f, 0.4536f },
+    { -5.1036f, -14.5671f, 14.8937f, 0.2673f, 0.4415f },
+    { -5.64f, -13.3494f, 14.5549f, 0.2634f, 0.4591f },
+    { -5.2305f, -14.0174f, 14.3512f, 0.26f, 0.4486f },
+    { -5.8498f, -12.6508f, 14.6798f, 0.2658f, 0.4686f },
+    { -5.3007f, -13.5486f, 13.7083f, 0.2509f, 0.4541f },
+    { -5.9372f, -11.9372f, 14.7401f, 0.2673f, 0.478f },
+    { -5.662f, -12.9835f, 13.8422f, 0.2534f, 0.4635f },
+    { -5.9032f, -11.7375f, 13.9616f, 0.2563f, 0.4808f },
+    { -5.8435f, -12.384f, 13.9186f, 0.2551f, 0.472f },
+    { -5.8509f, -11.0718f, 13.9754f, 0.2571f, 0.4898f },
+    { -5.8775f, -11.5655f, 13.2575f, 0.2462f, 0.4829f },
+    { -5.6963f, -10.4144f, 13.9645f, 0.2576f, 0.4989f },
+    { -5.8052f, -10.9499f, 13.2877f, 0.2472f, 0.4913f },
+    { -5.6285f, -10.3435f, 13.3044f, 0.2478f, 0.4999f },
+    { -5.8605f, -11.4375f, 12.6796f, 0.238f, 0.4844f },
+    { -5.7894f, -10.871f, 12.7182f, 0.2389f, 0.4921f },
+    { -5.6314f, -10.3189f, 12.748f, 0.2396f, 0.4997f },
+    { -5.8254f, -11.9871f, 12.6259f, 0.2368f, 0.4769f },
+    { -5.2983f, -9.6627f, 13.2609f, 0.2473f, 0.5101f },
+    { -5.8355f, -12.1572f, 13.2101f, 0.245f, 0.4748f },
+    { -5.6693f, -12.6918f, 13.1419f, 0.2435f, 0.4669f },
+    { -5.6651f, -12.488f, 12.5505f, 0.2352f, 0.4695f },
+    { -5.3316f, -13.1828f, 13.0524f, 0.2415f, 0.4583f },
+    { -5.3409f, -12.9419f, 12.4708f, 0.2332f, 0.4615f },
+    { -4.7755f, -13.6434f, 12.9414f, 0.2386f, 0.4479f },
+    { -4.7017f, -14.0916f, 13.4933f, 0.2469f, 0.443f },
+    { -4.8143f, -13.3499f, 12.4042f, 0.2307f, 0.452f },
+    { -4.5439f, -14.6392f, 14.0541f, 0.2549f, 0.4364f },
+    { -4.1005f, -13.9045f, 12.8302f, 0.2344f, 0.4373f },
+    { -3.9867f, -14.403f, 13.2709f, 0.2415f, 0.4319f },
+    { -3.3147f, -15.5668f, 14.3028f, 0.2555f, 0.4149f },
+    { -3.751f, -14.9867f, 13.7382f, 0.2486f, 0.4248f },
+    { -3.0225f, -14.8314f, 13.4781f, 0.241f, 0.4163f },
+    { -3.277f, -14.2731f, 13.1149f, 0.2349f, 0.4227f },
+    { -2.4165f, -14.3107f, 13.2119f, 0.2322f, 0.4103f },
+    { -1.9834f, -14.7714f, 13.4454f, 0.2364f, 0.4028f },
+    { -1.991f, -13.5618f, 12.8776f, 0.222f, 0.4062f },
+    { -1.6133f, -13.8735f, 13.0137f, 0.2247f, 0.4002f },
+    { -2.2015f, -13.1956f, 12.6812f, 0.218f, 0.41f },
+    { -1.7128f, -12.6502f, 12.5318f, 0.2107f, 0.4031f },
+    { -2.6546f, -13.8284f, 12.9451f, 0.227f, 0.4155f },
+    { -1.8842f, -12.4169f, 12.3852f, 0.208f, 0.4057f },
+    { -2.3152f, -12.862f, 12.4217f, 0.2132f, 0.4132f },
+    { -1.9784f, -12.1801f, 12.1871f, 0.2044f, 0.408f },
+    { -3.406f, -13.7967f, 12.7401f, 0.2285f, 0.4278f },
+    { -2.7812f, -13.4169f, 12.6207f, 0.2213f, 0.4197f },
+    { -2.4026f, -12.6479f, 12.0961f, 0.2083f, 0.4173f },
+    { -2.8794f, -13.1686f, 12.2148f, 0.2155f, 0.4246f },
+    { -3.4976f, -13.4993f, 12.2903f, 0.2219f, 0.4329f },
+    { -4.1712f, -13.5799f, 12.3458f, 0.2271f, 0.4421f },
+    { -2.9169f, -13.0141f, 11.7671f, 0.2096f, 0.4288f },
+    { -3.5312f, -13.3155f, 11.7998f, 0.2152f, 0.437f },
+    { -2.4447f, -12.5106f, 11.7267f, 0.2034f, 0.4212f },
+    { -2.8607f, -12.8844f, 11.3176f, 0.2038f, 0.4312f },
+    { -2.4227f, -12.4073f, 11.3357f, 0.1988f, 0.4238f },
+    { -2.1042f, -11.9022f, 11.659f, 0.1968f, 0.4149f },
+    { -2.1275f, -11.8399f, 11.3305f, 0.1934f, 0.4175f },
+    { -2.0531f, -12.0121f, 11.9448f, 0.2006f, 0.4114f },
+    { -1.8847f, -11.2863f, 11.5443f, 0.1899f, 0.4102f },
+    { -1.8172f, -11.3359f, 11.7713f, 0.1925f, 0.407f },
+    { -1.7412f, -11.4195f, 11.9613f, 0.1951f, 0.4039f },
+    { -1.9237f, -10.6822f, 11.5008f, 0.1828f, 0.407f },
+    { -1.8501f, -10.6562f, 11.711f, 0.1843f, 0.4033f },
+    { -1.9804f, -10.704f, 11.2506f, 0.1821f, 0.4082f },
+    { -1.7739f, -10.6401f, 11.884f, 0.1857f, 0.3996f },
+    { -1.9308f, -11.2732f, 11.2757f, 0.1879f, 0.4125f },
+    { -2.0319f, -10.6857f, 10.7345f, 0.1815f, 0.4093f },
+    { -1.9768f, -11.232f, 10.7365f, 0.1834f, 0.4149f },
+    { -2.09f, -10.5915f, 9.727f, 0.1708f, 0.4128f },
+    { -2.1461f, -11.7558f, 10.7375f, 0.1877f, 0.4202f },
+    { -2.0441f, -11.0983f, 9.6977f, 0.1737f, 0.4182f },
+    { -2.1709f, -10.4366f, 8.4372f, 0.1602f, 0.4164f },
+    { -2.387f, -12.2803f, 10.7002f, 0.1917f, 0.4262f },
+    { -2.1829f, -11.5807f, 9.658f, 0.1765f, 0.4238f },
+    { -2.14f, -10.9077f, 8.3876f, 0.1608f, 0.4216f },
+    { -2.2912f, -10.2364f, 7.0742f, 0.1457f, 0.4183f },
+    { -2.272f, -10.696f, 7.0344f, 0.1466f, 0.4242f },
+    { -2.3899f, -10.0557f, 5.9413f, 0.1313f, 0.4202f },
+    { -2.2592f, -11.3609f, 8.3308f, 0.1624f, 0.4274f },
+    { -2.3841f, -10.5135f, 5.9262f, 0.1347f, 0.4256f },
+    { -2.4062f, -9.9593f, 5.3418f, 0.1282f, 0.419f },
+    { -2.3963f, -11.1428f, 6.9949f, 0.1477f, 0.4303f },
+    { -2.388f, -12.0715f, 9.5977f, 0.1793f, 0.4298f },
+    { -2.4496f, -11.8278f, 8.2724f, 0.1644f, 0.4336f },
+    { -2.7805f, -12.727f, 10.6469f, 0.1956f, 0.4333f },
+    { -2.7457f, -12.4899f, 9.5355f, 0.1822f, 0.4367f },
+    { -3.4859f, -13.1799f, 11.303f, 0.2086f, 0.4395f },
+    { -3.4077f, -13.018f, 10.5997f, 0.1994f, 0.4416f },
+    { -4.1969f, -13.3796f, 11.8318f, 0.2198f, 0.4459f },
+    { -4.1759f, -13.254f, 11.3027f, 0.2127f, 0.4483f },
+    { -4.8233f, -13.1711f, 11.8702f, 0.2231f, 0.4551f },
+    { -5.333f, -12.7959f, 11.9247f, 0.2255f, 0.4638f },
+    { -4.808f, -13.0669f, 11.3276f, 0.2157f, 0.4571f },
+    { -5.6484f, -12.3597f, 12.0053f, 0.2275f, 0.4713f },
+    { -5.3122f, -12.7148f, 11.3754f, 0.2179f, 0.4653f },
+    { -4.1163f, -13.1054f, 10.576f, 0.203f, 0.4504f },
+    { -4.7546f, -12.9418f, 10.5932f, 0.2057f, 0.4589f },
+    { -3.342f, -12.7553f, 9.4898f, 0.1853f, 0.4447f },
+    { -4.0266f, -12.836f, 9.4696f, 0.1881f, 0.4531f },
+    { -2.7814f, -12.2206f, 8.2241f, 0.1665f, 0.4403f },
+    { -3.3247f, -12.4515f, 8.1975f, 0.1687f, 0.4479f },
+    { -2.5956f, -11.5958f, 6.9687f, 0.1492f, 0.4367f },
+    { -2.913f, -11.9665f, 6.9535f, 0.1509f, 0.4434f },
+    { -2.5235f, -10.968f, 5.9161f, 0.1356f, 0.432f },
+    { -2.7368f, -11.4171f, 5.9255f, 0.1369f, 0.4386f },
+    { -2.4207f, -10.4104f, 5.3508f, 0.1286f, 0.4256f },
+    { -2.4114f, -9.9193f, 4.9847f, 0.1251f, 0.4179f },
+    { -2.5698f, -10.8783f, 5.3602f, 0.1292f, 0.4323f },
+    { -2.4373f, -10.3742f, 5.0211f, 0.125f, 0.4251f },
+    { -2.4895f, -10.3921f, 4.6499f, 0.1209f, 0.4252f },
+    { -2.4768f, -9.9081f, 4.579f, 0.1204f, 0.4177f },
+    { -2.5909f, -10.8597f, 5.0567f, 0.1256f, 0.4321f },
+    { -2.4914f, -10.4239f, 4.1202f, 0.1148f, 0.4244f },
+    { -2.4983f, -9.9155f, 4.0106f, 0.1157f, 0.4175f },
+    { -2.3719f, -9.9318f, 3.166f, 0.104f, 0.4132f },
+    { -2.6421f, -10.8982f, 4.7353f, 0.1218f, 0.4326f },
+    { -2.645f, -10.9392f, 4.2589f, 0.116f, 0.4322f },
+    { -2.3575f, -10.4291f, 3.3151f, 0.1051f, 0.4212f },
+    { -2.2086f, -9.9963f, 2.3888f, 0.0923f, 0.409f },
+    { -2.207f, -10.463f, 2.5575f, 0.0955f, 0.418f },
+    { -2.1199f, -10.1485f, 2.0229f, 0.089f, 0.41f },
+    { -2.5213f, -10.928f, 3.4905f, 0.1064f, 0.4291f },
+    { -2.1591f, -10.5803f, 2.1703f, 0.09f, 0.4171f },
+    { -2.1062f, -10.3172f, 1.839f, 0.0858f, 0.411f },
+    { -2.3956f, -10.9268f, 2.7388f, 0.0968f, 0.4258f },
+    { -2.9014f, -11.3807f, 4.4078f, 0.1179f, 0.4397f },
+    { -2.7911f, -11.3436f, 3.6585f, 0.1082f, 0.4368f },
+    { -2.8766f, -11.3544f, 4.8296f, 0.1233f, 0.4398f },
+    { -3.2275f, -11.7051f, 4.5313f, 0.1198f, 0.4466f },
+    { -2.8073f, -11.3201f, 5.0967f, 0.1267f, 0.439f },
+    { -3.1843f, -11.701f, 4.912f, 0.1249f, 0.4466f },
+    { -3.1046f, -11.6822f, 5.1374f, 0.1279f, 0.4458f },
+    { -2.784f, -11.3331f, 5.3817f, 0.1303f, 0.439f },
+    { -3.0837f, -11.6936f, 5.4088f, 0.1315f, 0.4457f },
+    { -3.0454f, -11.7751f, 5.9422f, 0.1383f, 0.4453f },
+    { -3.4892f, -11.8783f, 5.4348f, 0.1324f, 0.4522f },
+    { -3.3915f, -12.1661f, 6.9469f, 0.1524f, 0.4504f },
+    { -3.4704f, -11.9561f, 5.9541f, 0.1393f, 0.4519f },
+    { -3.9548f, -12.5128f, 8.1912f, 0.1708f, 0.4558f },
+    { -3.949f, -12.2029f, 6.9487f, 0.1538f, 0.4576f },
+    { -3.9682f, -11.9759f, 5.963f, 0.1402f, 0.4587f },
+    { -4.503f, -12.0847f, 6.9584f, 0.1551f, 0.4651f },
+    { -4.4952f, -11.8498f, 5.971f, 0.1411f, 0.4661f },
+    { -3.9715f, -11.9016f, 5.4551f, 0.1332f, 0.4589f },
+    { -4.5017f, -11.7775f, 5.4652f, 0.1339f, 0.4663f },
+    { -3.5003f, -11.8725f, 5.1753f, 0.1289f, 0.4521f },
+    { -3.5563f, -11.8782f, 4.9617f, 0.1259f, 0.4527f },
+    { -3.9754f, -11.9021f, 5.2022f, 0.1296f, 0.4587f },
+    { -4.5105f, -11.7823f, 5.21f, 0.1303f, 0.4661f },
+    { -3.9967f, -11.8995f, 4.9816f, 0.1265f, 0.4588f },
+    { -4.5097f, -11.7782f, 4.9744f, 0.1269f, 0.466f },
+    { -3.5902f, -11.8691f, 4.5941f, 0.1208f, 0.4527f },
+    { -4.f, -11.8855f, 4.6087f, 0.1212f, 0.4587f },
+    { -3.5352f, -11.8188f, 3.8722f, 0.111f, 0.4511f },
+    { -4.4674f, -11.7668f, 4.5879f, 0.1214f, 0.4655f },
+    { -3.95f, -11.8521f, 3.8987f, 0.1113f, 0.4578f },
+    { -4.3517f, -11.7498f, 3.8795f, 0.1113f, 0.4642f },
+    { -3.9146f, -11.8732f, 3.1399f, 0.1007f, 0.457f },
+    { -4.2619f, -11.8025f, 3.124f, 0.1003f, 0.4631f },
+    { -4.7055f, -11.5435f, 3.8253f, 0.1108f, 0.4704f },
+    { -4.5539f, -11.6271f, 3.0692f, 0.0995f, 0.4686f },
+    { -4.8853f, -11.5378f, 4.5408f, 0.1211f, 0.4722f },
+    { -4.8244f, -11.3793f, 2.9857f, 0.0985f, 0.4744f },
+    { -4.9622f, -11.532f, 4.9459f, 0.1269f, 0.4732f },
+    { -4.9766f, -11.265f, 3.7468f, 0.1098f, 0.4762f },
+    { -5.1467f, -11.2232f, 4.4768f, 0.1203f, 0.478f },
+    { -4.9739f, -11.5252f, 5.2f, 0.1306f, 0.4735f },
+    { -5.2212f, -11.1788f, 4.9017f, 0.1264f, 0.4793f },
+    { -4.9581f, -11.5165f, 5.4627f, 0.1343f, 0.4737f },
+    { -5.2339f, -11.1435f, 5.1739f, 0.1303f, 0.48f },
+    { -4.9448f, -11.5886f, 5.9739f, 0.1417f, 0.4734f },
+    { -5.2189f, -11.1287f, 5.4454f, 0.1342f, 0.4803f },
+    { -5.3309f, -10.7134f, 5.1327f, 0.1297f, 0.4858f },
+    { -5.2104f, -11.2032f, 5.9675f, 0.1417f, 0.48f },
+    { -5.3255f, -10.7786f, 4.8407f, 0.1255f, 0.4847f },
+    { -5.3172f, -10.6964f, 5.4165f, 0.1337f, 0.4862f },
+    { -5.3053f, -10.3116f, 5.0776f, 0.1289f, 0.4911f },
+    { -5.2732f, -10.8627f, 4.394f, 0.1192f, 0.4833f },
+    { -5.314f, -10.3917f, 4.7615f, 0.1245f, 0.4899f },
+    { -5.1465f, -10.9362f, 3.6461f, 0.1086f, 0.4818f },
+    { -5.2864f, -10.4961f, 4.2908f, 0.1179f, 0.4884f },
+    { -5.0255f, -11.0714f, 2.8778f, 0.0973f, 0.4802f },
+    { -5.1966f, -10.579f, 3.5251f, 0.1073f, 0.4872f },
+    { -4.9904f, -11.3403f, 2.3697f, 0.0888f, 0.4785f },
+    { -5.1093f, -10.7156f, 2.7497f, 0.0962f, 0.4858f },
+    { -4.8037f, -11.6407f, 2.4671f, 0.0897f, 0.4732f },
+    { -5.089f, -10.9812f, 2.2501f, 0.088f, 0.484f },
+    { -4.5617f, -11.8662f, 2.5424f, 0.0908f, 0.4679f },
+    { -5.0603f, -11.6989f, 2.0156f, 0.0813f, 0.4769f },
+    { -4.8873f, -11.9952f, 2.1215f, 0.0824f, 0.4722f },
+    { -4.2973f, -12.0006f, 2.5959f, 0.0921f, 0.463f },
+    { -4.6641f, -12.2142f, 2.2109f, 0.0839f, 0.4677f },
+    { -5.2541f, -12.1029f, 1.7092f, 0.0731f, 0.4753f },
+    { -5.0482f, -12.3884f, 1.8793f, 0.0755f, 0.4712f },
+    { -4.3974f, -12.3295f, 2.2698f, 0.0858f, 0.4632f },
+    { -5.4112f, -11.8036f, 1.6037f, 0.0721f, 0.4796f },
+    { -3.962f, -12.0226f, 2.6202f, 0.0933f, 0.4572f },
+    { -5.1762f, -11.3519f, 1.9076f, 0.0807f, 0.4819f },
+    { -3.5071f, -11.9109f, 2.6081f, 0.0938f, 0.4492f },
+    { -5.1063f, -10.6016f, 2.1284f, 0.0875f, 0.4893f },
+    { -3.4785f, -11.8063f, 3.1067f, 0.1005f, 0.4495f },
+    { -3.1386f, -11.6494f, 3.7941f, 0.11f, 0.4442f },
+    { -3.0371f, -11.6162f, 3.0259f, 0.0998f, 0.4414f },
+    { -2.6742f, -11.3171f, 2.8991f, 0.0984f, 0.4335f },
+    { -3.0428f, -11.6876f, 2.5527f, 0.0937f, 0.4404f },
+    { -2.6793f, -11.3749f, 2.4471f, 0.0925f, 0.4321f },
+    { -2.3927f, -10.9975f, 2.3125f, 0.0911f, 0.4244f },
+    { -3.0736f, -11.8332f, 2.2712f, 0.0899f, 0.4402f },
+    { -2.7195f, -11.5062f, 2.1829f, 0.089f, 0.4319f },
+    { -2.1726f, -10.7328f, 1.9634f, 0.0863f, 0.4172f },
+    { -2.43f, -11.1305f, 2.0717f, 0.0875f, 0.4242f },
+    { -2.2062f, -10.8717f, 1.7467f, 0.0825f, 0.4174f },
+    { -2.1684f, -10.4312f, 1.6075f, 0.0805f, 0.4103f },
+    { -2.4251f, -11.3161f, 1.8762f, 0.0843f, 0.4246f },
+    { -2.2364f, -11.0689f, 1.5666f, 0.0793f, 0.4182f },
+    { -2.2217f, -10.6111f, 1.3454f, 0.0753f, 0.4097f },
+    { -2.3918f, -11.5519f, 1.7093f, 0.0815f, 0.4252f },
+    { -2.7079f, -11.7002f, 1.9873f, 0.086f, 0.4321f },
+    { -2.6576f, -11.9313f, 1.8231f, 0.0833f, 0.4323f },
+    { -3.0473f, -12.0224f, 2.0784f, 0.0869f, 0.4398f },
+    { -3.0017f, -12.2915f, 1.8838f, 0.0839f, 0.4395f },
+    { -3.525f, -12.0849f, 2.3105f, 0.0896f, 0.4489f },
+    { -3.436f, -12.2809f, 2.1477f, 0.0867f, 0.4473f },
+    { -4.0368f, -12.3429f, 2.2713f, 0.0873f, 0.4576f },
+    { -3.7766f, -12.5639f, 2.1835f, 0.0849f, 0.4531f },
+    { -4.2111f, -12.8749f, 2.1533f, 0.0814f, 0.459f },
+    { -4.5017f, -12.7748f, 2.1205f, 0.0802f, 0.4629f },
+    { -3.9715f, -12.9595f, 2.1738f, 0.0815f, 0.4557f },
+    { -4.7965f, -12.6242f, 2.0408f, 0.0782f, 0.467f },
+    { -4.2925f, -13.3102f, 2.034f, 0.0766f, 0.4589f },
+    { -4.5859f, -13.2014f, 2.0077f, 0.0755f, 0.4623f },
+    { -4.9027f, -13.0188f, 1.9205f, 0.0734f, 0.4662f },
+    { -5.1881f, -12.7489f, 1.701f, 0.0698f, 0.4701f },
+    { -4.9268f, -13.3203f, 1.7385f, 0.0697f, 0.4653f },
+    { -5.4839f, -12.5145f, 1.4148f, 0.0646f, 0.4738f },
+    { -5.2089f, -13.0053f, 1.5471f, 0.0663f, 0.469f },
+    { -5.4225f, -12.7564f, 1.3056f, 0.062f, 0.4715f },
+    { -5.1584f, -13.3335f, 1.3639f, 0.0637f, 0.4671f },
+    { -5.3481f, -13.0352f, 1.1696f, 0.0602f, 0.4693f },
+    { -5.6539f, -12.7306f, 1.227f, 0.0588f, 0.4734f },
+    { -5.5178f, -12.8012f, 1.1025f, 0.0574f, 0.4711f },
+    { -5.8145f, -12.5919f, 1.2232f, 0.0589f, 0.4758f },
+    { -5.7145f, -12.9686f, 1.072f, 0.0545f, 0.4721f },
+    { -5.6665f, -12.2467f, 1.3663f, 0.0642f, 0.4774f },
+    { -5.8864f, -12.879f, 1.0731f, 0.0545f, 0.4744f },
+    { -5.9311f, -12.3563f, 1.1616f, 0.059f, 0.4786f },
+    { -6.0257f, -12.6999f, 0.9953f, 0.0542f, 0.4767f },
+    { -5.7582f, -11.9531f, 1.3257f, 0.0647f, 0.481f },
+    { -6.1018f, -12.4204f, 0.928f, 0.055f, 0.4796f },
+    { -5.4738f, -11.4612f, 1.5457f, 0.0726f, 0.484f },
+    { -5.9355f, -11.9947f, 1.1124f, 0.0608f, 0.4822f },
+    { -5.2118f, -10.9781f, 1.8153f, 0.0808f, 0.4869f },
+    { -5.1442f, -10.6012f, 1.7565f, 0.0816f, 0.4917f },
+    { -5.3961f, -11.0464f, 1.5179f, 0.0746f, 0.4886f },
+    { -5.0492f, -10.2397f, 2.0248f, 0.0874f, 0.4942f },
+    { -5.6962f, -11.5271f, 1.3047f, 0.0673f, 0.4853f },
+    { -4.9537f, -10.2066f, 1.6733f, 0.0823f, 0.4971f },
+    { -5.2615f, -10.6591f, 1.4764f, 0.0766f, 0.4927f },
+    { -5.7962f, -11.4954f, 1.0642f, 0.064f, 0.487f },
+    { -5.5243f, -11.0391f, 1.273f, 0.0706f, 0.49f },
+    { -6.0112f, -11.9441f, 0.8711f, 0.0577f, 0.4843f },
+    { -5.4816f, -10.8464f, 1.0055f, 0.0684f, 0.4935f },
+    { -5.6504f, -11.1743f, 0.8241f, 0.0633f, 0.4919f },
+    { -6.1035f, -12.3009f, 0.7146f, 0.0528f, 0.4824f },
+    { -5.2864f, -10.5594f, 1.2005f, 0.0734f, 0.495f },
+    { -5.7045f, -11.4573f, 0.6884f, 0.0592f, 0.4907f },
+    { -6.1828f, -12.7752f, 0.7385f, 0.0498f, 0.4777f },
+    { -6.0752f, -13.0131f, 0.7688f, 0.0491f, 0.475f },
+    { -6.1177f, -12.5506f, 0.5731f, 0.049f, 0.4812f },
+    { -5.9135f, -13.1475f, 0.8142f, 0.0494f, 0.4729f },
+    { -6.1971f, -13.0055f, 0.5572f, 0.0457f, 0.4765f },
+    { -6.0856f, -13.2198f, 0.5404f, 0.0446f, 0.4739f },
+    { -6.0982f, -12.678f, 0.4251f, 0.046f, 0.4808f },
+    { -6.1634f, -13.0576f, 0.3978f, 0.043f, 0.4763f },
+    { -5.9152f, -13.3216f, 0.5448f, 0.0448f, 0.4717f },
+    { -6.0081f, -12.6839f, 0.3318f, 0.043f, 0.4803f },
+    { -5.8057f, -12.3543f, 0.3025f, 0.0469f, 0.4865f },
+    { -6.0574f, -12.9692f, 0.286f, 0.0409f, 0.4765f },
+    { -5.754f, -12.015f, 0.4227f, 0.0513f, 0.4882f },
+    { -5.4642f, -11.9194f, 0.2832f, 0.0508f, 0.4927f },
+    { -5.7152f, -11.727f, 0.5656f, 0.0554f, 0.4897f },
+    { -5.3534f, -11.3622f, 0.4178f, 0.0565f, 0.4953f },
+    { -5.1189f, -11.0131f, 0.4374f, 0.0595f, 0.4994f },
+    { -5.1638f, -11.3911f, 0.3729f, 0.057f, 0.4985f },
+    { -5.2522f, -10.9567f, 0.5497f, 0.0615f, 0.4979f },
+    { -4.9912f, -10.6618f, 0.5404f, 0.0636f, 0.5019f },
+    { -4.7547f, -10.8298f, 0.4827f, 0.0632f, 0.5044f },
+    { -5.2327f, -10.6782f, 0.6686f, 0.0653f, 0.4988f },
+    { -4.9355f, -10.3973f, 0.6636f, 0.0674f, 0.5027f },
+    { -4.5267f, -10.4053f, 0.6667f, 0.0675f, 0.5045f },
+    { -5.2141f, -10.4726f, 0.7989f, 0.0687f, 0.4991f },
+    { -4.897f, -10.2005f, 0.807f, 0.0708f, 0.5029f },
+    { -4.4664f, -10.1835f, 0.828f, 0.0718f, 0.5047f },
+    { -5.1154f, -10.286f, 0.9649f, 0.0723f, 0.4996f },
+    { -4.8211f, -10.0522f, 0.9708f, 0.0738f, 0.5033f },
+    { -4.4051f, -10.0238f, 0.9947f, 0.073f, 0.5075f },
+    { -3.6899f, -10.2469f, 0.841f, 0.0674f, 0.5144f },
+    { -3.6736f, -10.0794f, 1.008f, 0.0699f, 0.5152f },
+    { -2.9192f, -10.3672f, 0.8481f, 0.0631f, 0.5241f },
+    { -4.3272f, -9.8864f, 1.1793f, 0.0757f, 0.5085f },
+    { -2.9354f, -10.1977f, 1.0207f, 0.0661f, 0.5232f },
+    { -2.506f, -10.5204f, 0.8511f, 0.0603f, 0.5266f },
+    { -3.646f, -9.9193f, 1.18f, 0.0727f, 0.5162f },
+    { -2.4991f, -10.3573f, 1.0432f, 0.0631f, 0.5282f },
+    { -2.3183f, -10.9008f, 0.8764f, 0.0575f, 0.529f },
+    { -2.2824f, -10.7296f, 1.0821f, 0.0606f, 0.5316f },
+    { -2.9444f, -10.035f, 1.1954f, 0.0691f, 0.5242f },
+    { -2.482f, -10.221f, 1.2518f, 0.0661f, 0.5299f },
+    { -2.2217f, -10.6111f, 1.3454f, 0.0636f, 0.5342f },
+    { -2.4288f, -10.0588f, 1.4678f, 0.0695f, 0.5321f },
+    { -2.1684f, -10.4312f, 1.6075f, 0.0661f, 0.5381f },
+    { -2.9216f, -9.7989f, 1.372f, 0.0728f, 0.5255f },
+    { -2.39f, -9.8884f, 1.6789f, 0.073f, 0.5339f },
+    { -2.1062f, -10.3172f, 1.839f, 0.0687f, 0.5421f },
+    { -2.9037f, -9.5641f, 1.5597f, 0.0766f, 0.5266f },
+    { -2.4164f, -9.7272f, 1.8728f, 0.0765f, 0.5346f },
+    { -2.1199f, -10.1485f, 2.0229f, 0.0728f, 0.5417f },
+    { -2.9275f, -9.4058f, 1.7678f, 0.0799f, 0.5274f },
+    { -2.5009f, -9.5973f, 2.2664f, 0.0828f, 0.5352f },
+    { -2.2086f, -9.9963f, 2.3888f, 0.077f, 0.5414f },
+    { -2.9823f, -9.2999f, 2.1916f, 0.0857f, 0.5283f },
+    { -2.6364f, -9.5207f, 3.0767f, 0.0946f, 0.5366f },
+    { -2.3719f, -9.9318f, 3.166f, 0.0921f, 0.5434f },
+    { -3.0576f, -9.2227f, 3.0265f, 0.0969f, 0.5298f },
+    { -2.7234f, -9.4951f, 3.9489f, 0.107f, 0.5386f },
+    { -2.4983f, -9.9155f, 4.0106f, 0.1073f, 0.5454f },
+    { -2.4768f, -9.9081f, 4.579f, 0.1142f, 0.5469f },
+    { -2.6621f, -9.5179f, 4.528f, 0.1151f, 0.541f },
+    { -2.4114f, -9.9193f, 4.9847f, 0.1212f, 0.5483f },
+    { -3.1232f, -9.1187f, 3.9985f, 0.1099f, 0.5314f },
+    { -2.5778f, -9.5506f, 4.9428f, 0.121f, 0.5427f },
+    { -2.9335f, -9.196f, 4.52f, 0.1164f, 0.5355f },
+    { -2.5956f, -9.5545f, 5.3217f, 0.1265f, 0.5429f },
+    { -2.4062f, -9.9593f, 5.3418f, 0.1261f, 0.5491f },
+    { -2.842f, -9.2347f, 4.8993f, 0.1214f, 0.5375f },
+    { -2.6119f, -9.5969f, 5.947f, 0.1352f, 0.5431f },
+    { -2.3899f, -10.0557f, 5.9413f, 0.1309f, 0.5498f },
+    { -2.2912f, -10.2364f, 7.0742f, 0.1491f, 0.5529f },
+    { -2.8778f, -9.2f, 5.2616f, 0.1266f, 0.5371f },
+    { -3.0192f, -9.1218f, 5.8163f, 0.1346f, 0.535f },
+    { -2.5226f, -9.745f, 7.1009f, 0.1505f, 0.5452f },
+    { -2.1709f, -10.4366f, 8.4372f, 0.1674f, 0.556f },
+    { -2.4306f, -9.9162f, 8.4736f, 0.1683f, 0.5475f },
+    { -2.09f, -10.5915f, 9.727f, 0.1813f, 0.5579f },
+    { -2.9026f, -9.3069f, 7.1152f, 0.1518f, 0.5376f },
+    { -2.4386f, -10.0276f, 9.7557f, 0.1846f, 0.5487f },
+    { -2.0319f, -10.6857f, 10.7345f, 0.1952f, 0.5598f },
+    { -2.8497f, -9.4358f, 8.4909f, 0.1701f, 0.5395f },
+    { -2.464f, -10.0938f, 10.7688f, 0.1971f, 0.5495f },
+    { -1.9804f, -10.704f, 11.2506f, 0.1972f, 0.5599f },
+    { -2.9567f, -9.5072f, 9.7675f, 0.1874f, 0.5398f },
+    { -3.359f, -9.0847f, 8.4829f, 0.1717f, 0.5316f },
+    { -3.1557f, -9.4789f, 10.9051f, 0.2034f, 0.5391f },
+    { -3.3674f, -9.0072f, 7.1177f, 0.1531f, 0.5303f },
+    { -3.511f, -9.1307f, 9.7459f, 0.1894f, 0.5316f },
+    { -3.8955f, -8.9372f, 8.4688f, 0.173f, 0.5241f },
+    { -3.7403f, -9.1103f, 10.7087f, 0.2036f, 0.5305f },
+    { -4.063f, -8.9833f, 9.7279f, 0.1911f, 0.5238f },
+    { -3.8644f, -8.8847f, 7.1103f, 0.1543f, 0.5234f },
+    { -3.4612f, -8.8944f, 5.9922f, 0.1382f, 0.5284f },
+    { -4.3963f, -9.0674f, 8.4678f, 0.1743f, 0.5169f },
+    { -3.5651f, -8.7425f, 5.4482f, 0.131f, 0.5264f },
+    { -4.5742f, -9.1502f, 9.7502f, 0.193f, 0.5164f },
+    { -3.8916f, -8.809f, 5.9956f, 0.1392f, 0.5224f },
+    { -4.746f, -9.165f, 10.7322f, 0.2076f, 0.5163f },
+    { -4.3405f, -8.9784f, 7.0947f, 0.155f, 0.5166f },
+    { -3.899f, -8.6931f, 5.4681f, 0.132f, 0.522f },
+    { -4.3125f, -8.868f, 5.9713f, 0.1396f, 0.5166f },
+    { -4.7491f, -9.2479f, 7.0775f, 0.1556f, 0.51f },
+    { -4.2178f, -8.7211f, 5.4382f, 0.1321f, 0.5178f },
+    { -4.825f, -9.3891f, 8.468f, 0.1753f, 0.51f },
+    { -4.7293f, -9.0753f, 5.7803f, 0.1376f, 0.51f },
+    { -5.0053f, -9.5206f, 9.781f, 0.1945f, 0.5092f },
+    { -5.317f, -9.9837f, 9.7881f, 0.1955f, 0.502f },
+    { -5.2209f, -9.5803f, 10.9816f, 0.2126f, 0.5087f },
+    { -5.4905f, -10.1316f, 10.9077f, 0.2121f, 0.5007f },
+    { -5.1449f, -9.8161f, 8.4573f, 0.176f, 0.503f },
+    { -5.043f, -9.6533f, 7.0656f, 0.1562f, 0.5032f },
+    { -5.5143f, -10.4978f, 9.7646f, 0.1957f, 0.4949f },
+    { -5.3573f, -10.2981f, 8.43f, 0.1763f, 0.4962f },
+    { -5.6589f, -10.6673f, 10.8908f, 0.2122f, 0.4936f },
+    { -5.6024f, -11.0216f, 9.7038f, 0.1951f, 0.4881f },
+    { -5.7296f, -11.2102f, 10.8308f, 0.2115f, 0.4865f },
+    { -5.5969f, -10.2356f, 11.666f, 0.2234f, 0.4998f },
+    { -5.7397f, -10.7597f, 11.6428f, 0.2232f, 0.4928f },
+    { -5.4153f, -9.7491f, 11.6972f, 0.2236f, 0.5063f },
+    { -5.6419f, -10.2974f, 12.2252f, 0.2318f, 0.4994f },
+    { -5.4639f, -9.8035f, 12.2408f, 0.2319f, 0.506f },
+    { -5.2361f, -9.3252f, 11.7745f, 0.2246f, 0.512f },
+    { -5.2709f, -9.3377f, 12.2385f, 0.2316f, 0.5123f },
+    { -5.0828f, -9.2389f, 11.3811f, 0.2183f, 0.5135f },
+    { -5.0237f, -8.957f, 12.2384f, 0.2312f, 0.518f },
+    { -5.019f, -8.9935f, 11.8478f, 0.2253f, 0.517f },
+    { -4.7834f, -9.0497f, 11.204f, 0.2148f, 0.5176f },
+    { -4.9643f, -9.0381f, 11.5536f, 0.2207f, 0.5166f },
+    { -4.683f, -8.718f, 12.2604f, 0.2308f, 0.5232f },
+    { -4.7232f, -8.784f, 11.8668f, 0.2249f, 0.5214f },
+    { -4.7535f, -8.8931f, 11.4781f, 0.219f, 0.5195f },
+    { -4.9593f, -8.918f, 12.5348f, 0.2356f, 0.5196f },
+    { -5.2147f, -9.3059f, 12.6274f, 0.2375f, 0.5136f },
+    { -4.6234f, -8.6905f, 12.549f, 0.2352f, 0.5248f },
+    { -5.4265f, -9.7933f, 12.7306f, 0.2393f, 0.507f },
+    { -4.8733f, -8.9363f, 12.7473f, 0.2387f, 0.5206f },
+    { -5.0323f, -9.1739f, 12.9111f, 0.2416f, 0.517f },
+    { -4.605f, -8.7353f, 12.7946f, 0.239f, 0.5253f },
+    { -4.2575f, -8.6118f, 12.5785f, 0.2347f, 0.5294f },
+    { -4.6885f, -8.8861f, 13.0593f, 0.2434f, 0.5235f },
+    { -4.2478f, -8.6324f, 12.8241f, 0.2386f, 0.5303f },
+    { -4.2974f, -8.6264f, 12.2699f, 0.2299f, 0.5279f },
+    { -3.9099f, -8.6863f, 12.7396f, 0.2357f, 0.5344f },
+    { -4.3807f, -8.6994f, 11.8548f, 0.2237f, 0.5255f },
+    { -3.9122f, -8.6703f, 12.5317f, 0.2325f, 0.5333f },
+    { -3.9155f, -8.6879f, 12.2324f, 0.2278f, 0.5321f },
+    { -3.6401f, -8.813f, 12.5948f, 0.2319f, 0.5372f },
+    { -4.0236f, -8.7425f, 11.8348f, 0.2221f, 0.5296f },
+    { -3.5858f, -8.8385f, 12.4386f, 0.2292f, 0.537f },
+    { -3.5624f, -8.8821f, 12.1511f, 0.2246f, 0.5361f },
+    { -3.4431f, -8.9274f, 12.591f, 0.2306f, 0.5399f },
+    { -3.676f, -8.9105f, 11.7746f, 0.2195f, 0.5336f },
+    { -3.2766f, -9.0887f, 12.3293f, 0.2253f, 0.5411f },
+    { -3.2634f, -9.1888f, 12.0291f, 0.2204f, 0.5402f },
+    { -3.7854f, -8.9552f, 11.4966f, 0.2157f, 0.5317f },
+    { -3.362f, -9.2004f, 11.6418f, 0.2153f, 0.5378f },
+    { -4.0888f, -8.8405f, 11.446f, 0.2163f, 0.5278f },
+    { -4.4361f, -8.8041f, 11.4473f, 0.2175f, 0.5235f },
+    { -4.3922f, -8.914f, 11.1618f, 0.2128f, 0.523f },
+    { -3.9637f, -8.9883f, 11.173f, 0.2114f, 0.5287f },
+    { -4.2632f, -8.9875f, 10.6911f, 0.2054f, 0.5233f },
+    { -3.5897f, -9.131f, 11.3092f, 0.2117f, 0.5339f },
+    { -2.979f, -9.608f, 11.4804f, 0.2099f, 0.5431f },
+    { -2.4241f, -10.129f, 11.3344f, 0.2037f, 0.5509f },
+    { -1.9237f, -10.6822f, 11.5008f, 0.1992f, 0.5599f },
+    { -2.3586f, -10.1091f, 11.6465f, 0.2073f, 0.5522f },
+    { -2.9013f, -9.6003f, 11.8623f, 0.2147f, 0.5453f },
+    { -2.307f, -10.0098f, 11.8993f, 0.2106f, 0.5528f },
+    { -1.8501f, -10.6562f, 11.711f, 0.2002f, 0.5603f },
+    { -2.8839f, -9.4646f, 12.163f, 0.2195f, 0.5461f },
+    { -2.2467f, -9.9017f, 12.095f, 0.2132f, 0.5534f },
+    { -1.7739f, -10.6401f, 11.884f, 0.2012f, 0.5607f },
+    { -1.709f, -10.6481f, 12.0226f, 0.2017f, 0.5612f },
+    { -3.0042f, -9.1951f, 12.4948f, 0.2262f, 0.5453f },
+    { -2.155f, -9.8558f, 12.236f, 0.2145f, 0.5546f },
+    { -1.6125f, -10.6644f, 12.1117f, 0.2022f, 0.5616f },
+    { -3.6743f, -8.7719f, 12.9833f, 0.2384f, 0.5384f },
+    { -2.8397f, -9.2114f, 12.6568f, 0.2275f, 0.5477f },
+    { -2.0169f, -9.8487f, 12.3099f, 0.2145f, 0.5563f },
+    { -1.8175f, -9.8572f, 12.304f, 0.2132f, 0.5584f },
+    { -1.4409f, -10.6735f, 12.1362f, 0.2012f, 0.563f },
+    { -2.669f, -9.1975f, 12.7399f, 0.228f, 0.5501f },
+    { -1.4466f, -9.8731f, 12.2265f, 0.2101f, 0.5623f },
+    { -1.1302f, -10.6859f, 12.1122f, 0.2002f, 0.5643f },
+    { -2.4226f, -9.1872f, 12.7008f, 0.2265f, 0.5533f },
+    { -1.9532f, -8.9534f, 12.5499f, 0.2239f, 0.5602f },
+    { -3.2225f, -8.6008f, 13.2401f, 0.2423f, 0.5471f },
+    { -2.9282f, -8.1893f, 13.0885f, 0.2423f, 0.5541f },
+    { -3.5955f, -8.7686f, 13.1824f, 0.2411f, 0.5401f },
+    { -4.2814f, -8.6874f, 13.3059f, 0.2464f, 0.5308f },
+    { -3.8048f, -8.7323f, 12.8629f, 0.2371f, 0.5363f },
+    { -4.2554f, -8.6647f, 13.0505f, 0.2422f, 0.5306f },
+    { -4.8184f, -9.0399f, 13.3943f, 0.249f, 0.5211f },
+    { -5.4041f, -9.7577f, 13.9245f, 0.2574f, 0.5088f },
+    { -5.7766f, -10.8144f, 12.1941f, 0.2313f, 0.4924f },
+    { -5.8023f, -11.2965f, 11.5898f, 0.2224f, 0.4858f },
+    { -5.8395f, -11.3493f, 12.1498f, 0.2304f, 0.4854f },
+    { -5.6968f, -11.732f, 10.7548f, 0.2104f, 0.4797f },
+    { -5.7675f, -11.8175f, 11.5193f, 0.2212f, 0.4789f },
+    { -5.8053f, -11.8738f, 12.0882f, 0.2292f, 0.4783f },
+    { -5.6181f, -12.2943f, 11.4435f, 0.2197f, 0.4723f },
+    { -5.5546f, -12.2046f, 10.69f, 0.2092f, 0.4734f },
+    { -5.2562f, -12.6129f, 10.6362f, 0.2077f, 0.4666f },
+    { -5.4384f, -12.0035f, 9.5696f, 0.1933f, 0.4752f },
+    { -4.6493f, -12.7005f, 9.4837f, 0.1904f, 0.4612f },
+    { -5.1425f, -12.4044f, 9.5208f, 0.1921f, 0.4686f },
+    { -4.5471f, -12.3968f, 8.2038f, 0.1726f, 0.4634f },
+    { -5.0266f, -12.1286f, 8.2321f, 0.1739f, 0.4706f },
+    { -4.9642f, -11.8246f, 6.9734f, 0.156f, 0.4723f },
+    { -5.2429f, -11.4354f, 6.9911f, 0.1564f, 0.4789f },
+    { -5.3183f, -11.733f, 8.273f, 0.1748f, 0.4772f },
+    { -5.3174f, -10.7729f, 5.955f, 0.1415f, 0.486f },
+    { -5.3647f, -10.9882f, 7.0112f, 0.1566f, 0.4851f },
+    { -5.2863f, -10.3015f, 5.3793f, 0.1331f, 0.4915f },
+    { -5.2914f, -10.3772f, 5.94f, 0.1411f, 0.4914f },
+    { -5.2027f, -9.9342f, 5.0169f, 0.1279f, 0.4962f },
+    { -5.1755f, -9.9216f, 5.3403f, 0.1324f, 0.4967f },
+    { -5.2145f, -10.0101f, 4.6754f, 0.1233f, 0.4951f },
+    { -5.0689f, -9.5773f, 4.959f, 0.127f, 0.5011f },
+    { -5.2002f, -10.1108f, 4.1796f, 0.1166f, 0.4938f },
+    { -5.055f, -9.6255f, 4.5933f, 0.1221f, 0.5006f },
+    { -5.1488f, -10.198f, 3.394f, 0.106f, 0.4926f },
+    { -5.0285f, -9.6939f, 4.0732f, 0.1152f, 0.4999f },
+    { -5.1032f, -10.3391f, 2.6122f, 0.0952f, 0.4912f },
+    { -5.0249f, -9.7981f, 3.2631f, 0.1047f, 0.4984f },
+    { -5.0349f, -9.9695f, 2.4759f, 0.0942f, 0.4964f },
+    { -4.8821f, -9.8936f, 1.9365f, 0.0871f, 0.4994f },
+    { -4.8639f, -9.6249f, 2.3522f, 0.0933f, 0.5018f },
+    { -4.8027f, -9.4394f, 3.1449f, 0.1034f, 0.5045f },
+    { -4.55f, -9.3236f, 2.2524f, 0.0921f, 0.5076f },
+    { -4.5691f, -9.5614f, 1.8606f, 0.0865f, 0.5056f },
+    { -4.4601f, -9.1824f, 3.0519f, 0.1019f, 0.5105f },
+    { -4.7276f, -9.2454f, 4.0558f, 0.1147f, 0.5075f },
+    { -4.1076f, -9.1374f, 2.1868f, 0.0905f, 0.5141f },
+    { -4.8519f, -9.2612f, 4.5547f, 0.1214f, 0.5061f },
+    { -4.8965f, -9.2428f, 4.9082f, 0.1262f, 0.506f },
+    { -5.0345f, -9.5339f, 5.306f, 0.1317f, 0.502f },
+    { -4.6783f, -8.9326f, 4.8689f, 0.1254f, 0.5106f },
+    { -5.174f, -9.9795f, 5.9255f, 0.1406f, 0.4968f },
+    { -4.8553f, -9.173f, 5.2457f, 0.1306f, 0.5072f },
+    { -5.0074f, -9.5433f, 5.9147f, 0.1401f, 0.5029f },
+    { -5.355f, -10.5541f, 7.0332f, 0.1567f, 0.4908f },
+    { -5.2393f, -10.1152f, 7.0529f, 0.1566f, 0.4967f },
+    { -5.4534f, -11.2664f, 8.3235f, 0.1755f, 0.4835f },
+    { -5.4633f, -10.7848f, 8.3806f, 0.176f, 0.4898f },
+    { -5.5781f, -11.5313f, 9.6305f, 0.1942f, 0.4815f },
+    { -4.6299f, -8.8731f, 5.1288f, 0.1287f, 0.5118f },
+    { -4.4764f, -8.7925f, 5.3335f, 0.1312f, 0.5142f },
+    { -4.4301f, -8.6944f, 4.8425f, 0.1247f, 0.5149f },
+    { -4.3839f, -8.6606f, 5.0281f, 0.1271f, 0.5157f },
+    { -4.3323f, -8.6724f, 5.1909f, 0.1291f, 0.5163f },
+    { -4.1351f, -8.5987f, 5.2139f, 0.129f, 0.5189f },
+    { -4.1428f, -8.5616f, 5.0166f, 0.1265f, 0.5188f },
+    { -3.8982f, -8.5876f, 5.2419f, 0.1289f, 0.5219f },
+    { -3.9003f, -8.5433f, 5.0314f, 0.1262f, 0.5217f },
+    { -3.6408f, -8.6143f, 5.2118f, 0.128f, 0.525f },
+    { -4.1676f, -8.5764f, 4.8303f, 0.1242f, 0.5183f },
+    { -3.65f, -8.5726f, 5.0093f, 0.1254f, 0.5246f },
+    { -3.9006f, -8.5494f, 4.8257f, 0.1237f, 0.5215f },
+    { -3.6387f, -8.5847f, 4.8219f, 0.1231f, 0.5246f },
+    { -3.8941f, -8.5955f, 4.6141f, 0.121f, 0.5213f },
+    { -4.1359f, -8.6094f, 4.6387f, 0.1217f, 0.5184f },
+    { -3.6532f, -8.6179f, 4.6309f, 0.1207f, 0.5242f },
+    { -4.3784f, -8.7083f, 4.6513f, 0.1222f, 0.5152f },
+    { -3.3768f, -8.7062f, 4.8294f, 0.1224f, 0.5282f },
+    { -4.6217f, -8.9405f, 4.5987f, 0.1218f, 0.511f },
+    { -4.4631f, -8.9141f, 4.3737f, 0.1186f, 0.5129f },
+    { -4.3218f, -8.7614f, 4.4878f, 0.12f, 0.5154f },
+    { -4.1232f, -8.6958f, 4.4444f, 0.1192f, 0.5181f },
+    { -4.2054f, -8.8705f, 4.2499f, 0.1165f, 0.5163f },
+    { -3.8907f, -8.6889f, 4.4058f, 0.1182f, 0.521f },
+    { -4.3339f, -9.058f, 3.8531f, 0.1115f, 0.5136f },
+    { -3.9002f, -8.8373f, 4.2096f, 0.1153f, 0.5205f },
+    { -4.0292f, -9.0498f, 2.9974f, 0.1004f, 0.5167f },
+    { -3.9404f, -8.9783f, 3.8115f, 0.1101f, 0.5192f },
+    { -3.5439f, -8.9876f, 3.8237f, 0.1092f, 0.5248f },
+    { -3.5417f, -9.0645f, 2.9944f, 0.0987f, 0.5232f },
+    { -3.5514f, -9.138f, 2.1658f, 0.0884f, 0.5211f },
+    { -3.532f, -9.2737f, 1.7561f, 0.0829f, 0.5199f },
+    { -4.1169f, -9.3269f, 1.7996f, 0.0851f, 0.5124f },
+    { -3.5273f, -9.4625f, 1.5581f, 0.0797f, 0.5189f },
+    { -4.5787f, -9.7862f, 1.6536f, 0.083f, 0.5043f },
+    { -4.1294f, -9.5483f, 1.6105f, 0.0819f, 0.5113f },
+    { -3.5812f, -9.6957f, 1.3647f, 0.0761f, 0.5176f },
+    { -4.2174f, -9.7313f, 1.3942f, 0.0787f, 0.5099f },
+    { -4.6398f, -9.8879f, 1.4087f, 0.0797f, 0.5039f },
+    { -4.7285f, -9.9491f, 1.1672f, 0.0767f, 0.5037f },
+    { -4.9258f, -10.1241f, 1.4043f, 0.0792f, 0.4993f },
+    { -4.9987f, -10.1569f, 1.1667f, 0.0759f, 0.4999f },
+    { -5.153f, -10.3989f, 1.377f, 0.0772f, 0.4958f },
+    { 1.0392f, -26.4364f, 32.5716f, 0.8442f, 0.2028f },
+    { 1.0657f, -26.2118f, 32.6382f, 0.8463f, 0.2087f },
+    { 0.7927f, -26.4867f, 32.648f, 0.8379f, 0.2034f },
+    { 0.7314f, -26.6334f, 32.5219f, 0.8362f, 0.198f },
+    { 1.2438f, -26.3992f, 32.423f, 0.8501f, 0.2005f },
+    { 0.9608f, -26.5821f, 32.4749f, 0.842f, 0.1981f },
+    { 0.4809f, -26.6798f, 32.5252f, 0.8302f, 0.1971f },
+    { 0.6423f, -26.7061f, 32.3496f, 0.8343f, 0.1926f },
+    { 0.4222f, -26.7427f, 32.3254f, 0.829f, 0.1912f },
+    { 0.5264f, -26.5364f, 32.678f, 0.8314f, 0.2032f },
+    { 0.2093f, -26.7637f, 32.3003f, 0.8238f, 0.1901f },
+    { 0.8173f, -26.246f, 32.739f, 0.8396f, 0.2103f },
+    { 0.2384f, -26.7074f, 32.5151f, 0.8244f, 0.1963f },
+    { 0.552f, -26.2833f, 32.7946f, 0.8327f, 0.2108f },
+    { 0.2626f, -26.5715f, 32.6876f, 0.825f, 0.2028f },
+    { 0.2782f, -26.3187f, 32.8237f, 0.8257f, 0.2108f },
+    { 0.8153f, -25.974f, 32.7885f, 0.8411f, 0.2173f },
+    { -0.f, -26.7166f, 32.5067f, 0.8187f, 0.196f },
+    { 0.5596f, -25.9965f, 32.8612f, 0.834f, 0.2185f },
+    { -0.f, -26.7703f, 32.2875f, 0.8187f, 0.1897f },
+    { 0.2846f, -26.0286f, 32.9064f, 0.8264f, 0.2187f },
+    { 0.5509f, -25.7517f, 32.8639f, 0.835f, 0.2246f },
+    { -0.f, -26.0471f, 32.9221f, 0.8187f, 0.2186f },
+    { 0.2813f, -25.781f, 32.9185f, 0.827f, 0.2251f },
+    { 0.5581f, -25.524f, 32.8641f, 0.8364f, 0.2302f },
+    { 0.2863f, -25.5503f, 32.9226f, 0.8276f, 0.2306f },
+    { 0.7971f, -25.7333f, 32.7901f, 0.8424f, 0.2232f },
+    { 0.8009f, -25.5059f, 32.7922f, 0.8436f, 0.2285f },
+    { -0.f, -25.7984f, 32.941f, 0.8187f, 0.2251f },
+    { -0.0001f, -25.5655f, 32.9485f, 0.8187f, 0.231f },
+    { -0.2864f, -25.5503f, 32.9226f, 0.81f, 0.2306f },
+    { -0.2814f, -25.781f, 32.9185f, 0.8105f, 0.2251f },
+    { -0.5582f, -25.524f, 32.8641f, 0.8013f, 0.2302f },
+    { -0.2847f, -26.0286f, 32.9064f, 0.811f, 0.2187f },
+    { -0.5511f, -25.7517f, 32.8639f, 0.8026f, 0.2246f },
+    { -0.7973f, -25.7333f, 32.7901f, 0.7953f, 0.2233f },
+    { -0.8011f, -25.5059f, 32.7922f, 0.7943f, 0.2286f },
+    { -0.5597f, -25.9965f, 32.8612f, 0.8035f, 0.2185f },
+    { -1.0307f, -25.7337f, 32.6874f, 0.7884f, 0.2208f },
+    { -1.0275f, -25.508f, 32.6981f, 0.7873f, 0.2271f },
+    { -0.8155f, -25.974f, 32.7885f, 0.7964f, 0.2174f },
+    { -1.057f, -25.9656f, 32.6774f, 0.7896f, 0.2151f },
+    { -1.2615f, -25.7604f, 32.546f, 0.7816f, 0.2167f },
+    { -1.25f, -25.5421f, 32.5731f, 0.7807f, 0.2221f },
+    { -1.2889f, -25.9761f, 32.5173f, 0.7829f, 0.2113f },
+    { -1.4722f, -25.8025f, 32.348f, 0.775f, 0.2111f },
+    { -1.466f, -25.5932f, 32.3915f, 0.7741f, 0.2172f },
+    { -1.4892f, -26.0001f, 32.3002f, 0.7765f, 0.206f },
+    { -1.6453f, -25.8488f, 32.0755f, 0.7687f, 0.2038f },
+    { -1.6726f, -25.6462f, 32.128f, 0.7672f, 0.2085f },
+    { -1.6355f, -26.0321f, 32.0181f, 0.7707f, 0.1991f },
+    { -1.7612f, -25.8975f, 31.8189f, 0.764f, 0.1969f },
+    { -1.8476f, -25.713f, 31.83f, 0.7604f, 0.1998f },
+    { -1.7199f, -26.0659f, 31.757f, 0.7665f, 0.1925f },
+    { -1.8006f, -25.9467f, 31.6682f, 0.7622f, 0.1924f },
+    { -1.8558f, -25.8404f, 31.6842f, 0.7601f, 0.1963f },
+    { -1.7342f, -26.0952f, 31.6029f, 0.7649f, 0.1881f },
+    { -1.8134f, -25.9866f, 31.5814f, 0.7616f, 0.1897f },
+    { -1.8531f, -25.904f, 31.6175f, 0.7598f, 0.1928f },
+    { -1.8965f, -25.8967f, 31.5728f, 0.7588f, 0.1915f },
+    { -1.7303f, -26.1197f, 31.5131f, 0.7644f, 0.1854f },
+    { -1.8497f, -26.0073f, 31.5161f, 0.7606f, 0.188f },
+    { -1.9358f, -25.9137f, 31.5112f, 0.7577f, 0.1903f },
+    { -1.9087f, -26.0079f, 31.4586f, 0.7592f, 0.1868f },
+    { -1.7603f, -26.1391f, 31.4451f, 0.7633f, 0.1837f },
+    { -1.8223f, -26.1544f, 31.3802f, 0.7608f, 0.1834f },
+    { -1.6506f, -26.3252f, 31.2983f, 0.7669f, 0.1762f },
+    { -1.5947f, -26.2943f, 31.3633f, 0.7679f, 0.1779f },
+    { -1.453f, -26.4765f, 31.2203f, 0.7731f, 0.1691f },
+    { -1.5869f, -26.2653f, 31.4318f, 0.7686f, 0.18f },
+    { -1.409f, -26.4306f, 31.2845f, 0.7728f, 0.1722f },
+    { -1.2888f, -26.5647f, 31.1533f, 0.7763f, 0.1658f },
+    { -1.6217f, -26.2565f, 31.5271f, 0.7688f, 0.1832f },
+    { -1.422f, -26.3895f, 31.3544f, 0.7731f, 0.1748f },
+    { -1.2595f, -26.5054f, 31.2224f, 0.7766f, 0.1682f },
+    { -1.113f, -26.6144f, 31.1064f, 0.7795f, 0.1625f },
+    { -1.2747f, -26.4582f, 31.2978f, 0.7769f, 0.1711f },
+    { -1.1382f, -26.5388f, 31.1875f, 0.7798f, 0.1657f },
+    { -1.0371f, -26.5509f, 31.1901f, 0.783f, 0.1647f },
+    { -1.3259f, -26.4794f, 31.4173f, 0.7772f, 0.1751f },
+    { -1.1272f, -26.4949f, 31.2698f, 0.7807f, 0.1686f },
+    { -1.48f, -26.3962f, 31.4592f, 0.7731f, 0.1785f },
+    { -1.1725f, -26.535f, 31.4194f, 0.7812f, 0.1734f },
+    { -1.3651f, -26.5187f, 31.6035f, 0.7784f, 0.1803f },
+    { -1.1885f, -26.5815f, 31.6042f, 0.7829f, 0.1784f },
+    { -1.6413f, -26.2514f, 31.6901f, 0.77f, 0.1878f },
+    { -1.5237f, -26.4153f, 31.6337f, 0.7741f, 0.1835f },
+    { -1.5878f, -26.2334f, 31.9617f, 0.7737f, 0.1943f },
+    { -1.4679f, -26.215f, 32.2539f, 0.779f, 0.2009f },
+    { -1.4937f, -26.4117f, 31.913f, 0.7775f, 0.19f },
+    { -1.3444f, -26.5257f, 31.8789f, 0.7816f, 0.1868f },
+    { -1.3977f, -26.4046f, 32.2071f, 0.7822f, 0.1963f },
+    { -1.1647f, -26.594f, 31.8561f, 0.786f, 0.1843f },
+    { -1.268f, -26.5264f, 32.158f, 0.7858f, 0.1928f },
+    { -1.1001f, -26.5996f, 32.0991f, 0.7898f, 0.1896f },
+    { -0.979f, -26.6351f, 31.8414f, 0.7905f, 0.1823f },
+    { -0.9153f, -26.6433f, 32.023f, 0.794f, 0.1861f },
+    { -0.9935f, -26.6256f, 32.2574f, 0.7936f, 0.1926f },
+    { -1.0165f, -26.6233f, 31.6408f, 0.7875f, 0.1777f },
+    { -0.8206f, -26.6646f, 32.1234f, 0.7974f, 0.1878f },
+    { -1.1399f, -26.547f, 32.3554f, 0.7903f, 0.1965f },
+    { -0.8419f, -26.6637f, 32.3385f, 0.7979f, 0.1935f },
+    { -1.2435f, -26.4132f, 32.4262f, 0.7874f, 0.2006f },
+    { -0.6939f, -26.6936f, 32.1525f, 0.801f, 0.1876f },
+    { -0.9608f, -26.5839f, 32.4753f, 0.7953f, 0.1982f },
+    { -0.6423f, -26.7061f, 32.3496f, 0.803f, 0.1927f },
+    { -1.0392f, -26.4399f, 32.5724f, 0.7931f, 0.203f },
+    { -0.534f, -26.7247f, 32.12f, 0.8052f, 0.1859f },
+    { -0.7314f, -26.6334f, 32.5219f, 0.8011f, 0.1981f },
+    { -0.4222f, -26.7427f, 32.3254f, 0.8084f, 0.1913f },
+    { -0.7927f, -26.4867f, 32.648f, 0.7994f, 0.2036f },
+    { -0.357f, -26.754f, 32.0677f, 0.8097f, 0.1839f },
+    { -0.4809f, -26.6798f, 32.5252f, 0.8071f, 0.1972f },
+    { -0.2093f, -26.7637f, 32.3003f, 0.8136f, 0.1902f },
+    { -1.0655f, -26.2174f, 32.6395f, 0.7912f, 0.2088f },
+    { -0.1788f, -26.7775f, 32.0371f, 0.8142f, 0.1828f },
+    { -1.2881f, -26.2083f, 32.4788f, 0.7849f, 0.2057f },
+    { -0.8174f, -26.246f, 32.739f, 0.7978f, 0.2104f },
+    { -0.5265f, -26.5364f, 32.678f, 0.8059f, 0.2032f },
+    { -0.5521f, -26.2833f, 32.7946f, 0.8047f, 0.2109f },
+    { -0.2782f, -26.3187f, 32.8237f, 0.8117f, 0.2108f },
+    { -0.f, -26.3359f, 32.8316f, 0.8187f, 0.2106f },
+    { -0.f, -26.5855f, 32.6872f, 0.8187f, 0.2025f },
+    { -0.2626f, -26.5715f, 32.6876f, 0.8123f, 0.2028f },
+    { -0.2385f, -26.7074f, 32.5151f, 0.813f, 0.1964f },
+    { -0.f, -26.7878f, 32.0272f, 0.8187f, 0.1824f },
+    { 0.1787f, -26.7775f, 32.0371f, 0.8232f, 0.1828f },
+    { -0.f, -26.7886f, 31.7707f, 0.8187f, 0.1753f },
+    { 0.3569f, -26.754f, 32.0677f, 0.8277f, 0.1839f },
+    { 0.1514f, -26.7743f, 31.7797f, 0.8226f, 0.1756f },
+    { 0.534f, -26.7247f, 32.12f, 0.8321f, 0.1859f },
+    { 0.3039f, -26.736f, 31.7904f, 0.8267f, 0.176f },
+    { 0.8418f, -26.6631f, 32.3383f, 0.8393f, 0.1934f },
+    { 1.1398f, -26.54f, 32.3538f, 0.847f, 0.1964f },
+    { 0.6938f, -26.6935f, 32.1525f, 0.8363f, 0.1875f },
+    { 0.9933f, -26.6233f, 32.2569f, 0.8437f, 0.1925f },
+    { 0.4528f, -26.7079f, 31.9165f, 0.8307f, 0.18f },
+    { 0.8204f, -26.6642f, 32.1233f, 0.8399f, 0.1877f },
+    { 0.5751f, -26.6871f, 31.9833f, 0.834f, 0.1824f },
+    { 0.3583f, -26.6911f, 31.7198f, 0.8284f, 0.1741f },
+    { 0.4449f, -26.6739f, 31.8221f, 0.8308f, 0.1773f },
+    { 0.5439f, -26.6579f, 31.8969f, 0.8337f, 0.1798f },
+    { 0.3075f, -26.707f, 31.6127f, 0.8271f, 0.1708f },
+    { 0.6802f, -26.6694f, 31.997f, 0.837f, 0.1835f },
+    { 0.3974f, -26.6395f, 31.69f, 0.8297f, 0.1732f },
+    { 0.4721f, -26.624f, 31.7826f, 0.8318f, 0.1761f },
+    { 0.3505f, -26.6534f, 31.6014f, 0.8286f, 0.1705f },
+    { 0.4331f, -26.5733f, 31.6582f, 0.8311f, 0.1722f },
+    { 0.3925f, -26.5854f, 31.5825f, 0.8302f, 0.1699f },
+    { 0.3726f, -26.5908f, 31.5031f, 0.8301f, 0.1675f },
+    { 0.4964f, -26.5593f, 31.7436f, 0.8328f, 0.1748f },
+    { 0.3338f, -26.6569f, 31.5057f, 0.8285f, 0.1676f },
+    { 0.4235f, -26.5148f, 31.5697f, 0.8317f, 0.1694f },
+    { 0.2913f, -26.7107f, 31.4967f, 0.8269f, 0.1673f },
+    { 0.4586f, -26.5038f, 31.6379f, 0.8324f, 0.1713f },
+    { 0.4003f, -26.5226f, 31.501f, 0.8317f, 0.1675f },
+    { 0.4671f, -26.4423f, 31.6426f, 0.8335f, 0.1709f },
+    { 0.4338f, -26.453f, 31.5763f, 0.8329f, 0.1692f },
+    { 0.3814f, -26.5257f, 31.4179f, 0.8322f, 0.1652f },
+    { 0.4095f, -26.462f, 31.5118f, 0.8329f, 0.1676f },
+    { 0.3718f, -26.5844f, 31.4061f, 0.8311f, 0.1648f },
+    { 0.3846f, -26.4697f, 31.4345f, 0.8332f, 0.1657f },
+    { 0.3495f, -26.6411f, 31.392f, 0.8297f, 0.1643f },
+    { 0.3758f, -26.5287f, 31.3433f, 0.8331f, 0.1632f },
+    { 0.3863f, -26.5768f, 31.3183f, 0.8325f, 0.1624f },
+    { 0.3722f, -26.4782f, 31.3655f, 0.8337f, 0.164f },
+    { 0.3927f, -26.5362f, 31.3002f, 0.8338f, 0.1621f },
+    { 0.3829f, -26.6234f, 31.2891f, 0.8314f, 0.1615f },
+    { 0.4126f, -26.5789f, 31.2663f, 0.8335f, 0.161f },
+    { 0.3084f, -26.6913f, 31.3683f, 0.828f, 0.1637f },
+    { 0.4192f, -26.6212f, 31.226f, 0.8329f, 0.1599f },
+    { 0.3449f, -26.6696f, 31.2542f, 0.8297f, 0.1606f },
+    { 0.2271f, -26.7519f, 31.4697f, 0.8249f, 0.1666f },
+    { 0.2383f, -26.733f, 31.3272f, 0.8257f, 0.1627f },
+    { 0.2418f, -26.7483f, 31.6088f, 0.8251f, 0.1707f },
+    { 0.1319f, -26.7791f, 31.5822f, 0.8222f, 0.1699f },
+    { 0.1234f, -26.7798f, 31.4181f, 0.822f, 0.1653f },
+    { -0.f, -26.7918f, 31.5632f, 0.8187f, 0.1694f },
+    { -0.132f, -26.7791f, 31.5822f, 0.8152f, 0.1699f },
+    { -0.f, -26.7904f, 31.3862f, 0.8187f, 0.1644f },
+    { -0.1515f, -26.7743f, 31.7797f, 0.8147f, 0.1756f },
+    { -0.304f, -26.736f, 31.7904f, 0.8107f, 0.1761f },
+    { -0.2419f, -26.7483f, 31.6088f, 0.8122f, 0.1707f },
+    { -0.4529f, -26.7079f, 31.9165f, 0.8067f, 0.1801f },
+    { -0.3076f, -26.707f, 31.6127f, 0.8103f, 0.1708f },
+    { -0.5752f, -26.6872f, 31.9833f, 0.8033f, 0.1825f },
+    { -0.3584f, -26.6911f, 31.7199f, 0.809f, 0.1741f },
+    { -0.4449f, -26.6739f, 31.8221f, 0.8065f, 0.1774f },
+    { -0.6805f, -26.6695f, 31.997f, 0.8003f, 0.1835f },
+    { -0.544f, -26.6579f, 31.8969f, 0.8037f, 0.1799f },
+    { -0.7668f, -26.6558f, 31.9468f, 0.7973f, 0.1829f },
+    { -0.6323f, -26.6454f, 31.9218f, 0.801f, 0.1811f },
+    { -0.8317f, -26.6469f, 31.822f, 0.794f, 0.1806f },
+    { -0.7076f, -26.6356f, 31.8875f, 0.7983f, 0.1808f },
+    { -0.6306f, -26.5991f, 31.8785f, 0.8007f, 0.1796f },
+    { -0.7674f, -26.6276f, 31.7849f, 0.7952f, 0.179f },
+    { -0.556f, -26.6097f, 31.854f, 0.8031f, 0.1785f },
+    { -0.6941f, -26.5914f, 31.8468f, 0.7983f, 0.1793f },
+    { -0.4721f, -26.624f, 31.7827f, 0.8055f, 0.1762f },
+    { -0.3975f, -26.6395f, 31.6901f, 0.8077f, 0.1733f },
+    { -0.4964f, -26.5593f, 31.7437f, 0.8046f, 0.1748f },
+    { -0.3506f, -26.6534f, 31.6014f, 0.8088f, 0.1705f },
+    { -0.4332f, -26.5733f, 31.6583f, 0.8063f, 0.1722f },
+    { -0.3925f, -26.5854f, 31.5827f, 0.8072f, 0.1699f },
+    { -0.3339f, -26.6569f, 31.5058f, 0.8089f, 0.1676f },
+    { -0.3727f, -26.5908f, 31.5032f, 0.8073f, 0.1676f },
+    { -0.2913f, -26.7107f, 31.4968f, 0.8105f, 0.1674f },
+    { -0.3719f, -26.5844f, 31.4063f, 0.8063f, 0.1648f },
+    { -0.2271f, -26.7519f, 31.4697f, 0.8125f, 0.1666f },
+    { -0.3497f, -26.6411f, 31.3921f, 0.8077f, 0.1644f },
+    { -0.3086f, -26.6913f, 31.3683f, 0.8094f, 0.1637f },
+    { -0.1235f, -26.7798f, 31.4182f, 0.8154f, 0.1653f },
+    { -0.2384f, -26.733f, 31.3272f, 0.8117f, 0.1627f },
+    { -0.129f, -26.7642f, 31.2612f, 0.815f, 0.161f },
+    { -0.f, -26.7772f, 31.2219f, 0.8187f, 0.16f },
+    { -0.2673f, -26.7092f, 31.2003f, 0.8105f, 0.1592f },
+    { 0.1289f, -26.7642f, 31.2611f, 0.8224f, 0.161f },
+    { 0.2671f, -26.7092f, 31.2003f, 0.8269f, 0.1592f },
+    { 0.1447f, -26.7364f, 31.1138f, 0.8231f, 0.1571f },
+    { -0.0001f, -26.7469f, 31.0625f, 0.8187f, 0.1558f },
+    { 0.3864f, -26.6663f, 31.1817f, 0.8311f, 0.1587f },
+    { -0.1449f, -26.7364f, 31.1139f, 0.8143f, 0.1571f },
+    { -0.0001f, -26.6943f, 30.9007f, 0.8187f, 0.1517f },
+    { -0.1671f, -26.7005f, 30.979f, 0.8136f, 0.1536f },
+    { 0.167f, -26.7005f, 30.9789f, 0.8238f, 0.1536f },
+    { -0.0001f, -26.634f, 30.6865f, 0.8187f, 0.1447f },
+    { -0.2449f, -26.6729f, 30.8849f, 0.8129f, 0.1503f },
+    { 0.2447f, -26.6741f, 30.8848f, 0.8245f, 0.1503f },
+    { -0.3056f, -26.6982f, 31.108f, 0.8092f, 0.1568f },
+    { -0.3849f, -26.6867f, 31.0472f, 0.8071f, 0.1558f },
+    { 0.3053f, -26.6982f, 31.1079f, 0.8282f, 0.1568f },
+    { 0.3846f, -26.687f, 31.0471f, 0.8303f, 0.1558f },
+    { 0.4576f, -26.6608f, 31.1364f, 0.8337f, 0.1578f },
+    { 0.583f, -26.6319f, 31.1039f, 0.8387f, 0.1576f },
+    { 0.5367f, -26.6631f, 31.0151f, 0.838f, 0.1561f },
+    { 0.4803f, -26.6184f, 31.1876f, 0.8351f, 0.1591f },
+    { 0.5882f, -26.5988f, 31.1587f, 0.8392f, 0.159f },
+    { 0.4693f, -26.583f, 31.2356f, 0.8354f, 0.1604f },
+    { 0.5751f, -26.5815f, 31.2119f, 0.8391f, 0.1602f },
+    { 0.448f, -26.5461f, 31.2754f, 0.8354f, 0.1615f },
+    { 0.5578f, -26.5566f, 31.2558f, 0.8388f, 0.1613f },
+    { 0.3855f, -26.4899f, 31.3254f, 0.8342f, 0.163f },
+    { 0.4397f, -26.4992f, 31.3019f, 0.8357f, 0.1625f },
+    { 0.3951f, -26.4143f, 31.4203f, 0.8345f, 0.1654f },
+    { 0.402f, -26.4324f, 31.3756f, 0.8349f, 0.1644f },
+    { 0.4018f, -26.4095f, 31.4744f, 0.8342f, 0.1666f },
+    { 0.4535f, -26.3382f, 31.5558f, 0.8354f, 0.1682f },
+    { 0.4285f, -26.3965f, 31.5486f, 0.8341f, 0.1682f },
+    { 0.4853f, -26.3134f, 31.6248f, 0.8356f, 0.1696f },
+    { 0.4644f, -26.3258f, 31.5432f, 0.8358f, 0.1679f },
+    { 0.4863f, -26.3252f, 31.6485f, 0.8354f, 0.1702f },
+    { 0.4469f, -26.3924f, 31.6026f, 0.8341f, 0.1695f },
+    { 0.5197f, -26.3012f, 31.7024f, 0.836f, 0.1713f },
+    { 0.4803f, -26.3782f, 31.6662f, 0.8346f, 0.1709f },
+    { 0.5433f, -26.3094f, 31.7502f, 0.8363f, 0.1724f },
+    { 0.5253f, -26.3707f, 31.7414f, 0.8354f, 0.1727f },
+    { 0.5193f, -26.4295f, 31.725f, 0.8345f, 0.173f },
+    { 0.5831f, -26.2881f, 31.7916f, 0.8371f, 0.1733f },
+    { 0.579f, -26.3575f, 31.8059f, 0.8365f, 0.1742f },
+    { 0.5135f, -26.4908f, 31.7196f, 0.8337f, 0.1736f },
+    { 0.5776f, -26.4186f, 31.7975f, 0.8359f, 0.1748f },
+    { 0.6169f, -26.3005f, 31.8164f, 0.8377f, 0.1741f },
+    { 0.6264f, -26.3577f, 31.835f, 0.8374f, 0.175f },
+    { 0.6384f, -26.2855f, 31.7953f, 0.8384f, 0.1737f },
+    { 0.5926f, -26.2139f, 31.723f, 0.8381f, 0.1715f },
+    { 0.6641f, -26.3531f, 31.816f, 0.8385f, 0.1749f },
+    { 0.6296f, -26.4134f, 31.8342f, 0.8371f, 0.1758f },
+    { 0.6668f, -26.2979f, 31.755f, 0.8394f, 0.1733f },
+    { 0.575f, -26.4791f, 31.792f, 0.8353f, 0.1756f },
+    { 0.6727f, -26.4115f, 31.8206f, 0.8385f, 0.1758f },
+    { 0.5671f, -26.5465f, 31.8149f, 0.8348f, 0.177f },
+    { 0.6297f, -26.472f, 31.8325f, 0.8368f, 0.1767f },
+    { 0.6298f, -26.5376f, 31.848f, 0.8367f, 0.178f },
+    { 0.556f, -26.6097f, 31.8539f, 0.8343f, 0.1785f },
+    { 0.6305f, -26.5991f, 31.8784f, 0.8366f, 0.1795f },
+    { 0.6321f, -26.6454f, 31.9217f, 0.8363f, 0.181f },
+    { 0.7071f, -26.6356f, 31.8874f, 0.839f, 0.1808f },
+    { 0.7661f, -26.6556f, 31.9468f, 0.84f, 0.1829f },
+    { 0.9146f, -26.6425f, 32.0229f, 0.8433f, 0.1861f },
+    { 0.8306f, -26.6467f, 31.822f, 0.8433f, 0.1806f },
+    { 1.0995f, -26.5951f, 32.0983f, 0.8476f, 0.1896f },
+    { 0.9777f, -26.634f, 31.8415f, 0.8468f, 0.1823f },
+    { 1.1634f, -26.5869f, 31.8552f, 0.8514f, 0.1844f },
+    { 1.2677f, -26.5119f, 32.155f, 0.8516f, 0.1927f },
+    { 1.3435f, -26.5028f, 31.8749f, 0.8559f, 0.1869f },
+    { 1.3981f, -26.3768f, 32.2012f, 0.8554f, 0.1963f },
+    { 1.4935f, -26.3705f, 31.905f, 0.8603f, 0.1901f },
+    { 1.2893f, -26.186f, 32.4738f, 0.8528f, 0.2056f },
+    { 1.4697f, -26.1734f, 32.2448f, 0.8589f, 0.201f },
+    { 1.0573f, -25.9582f, 32.6758f, 0.8481f, 0.2149f },
+    { 1.2909f, -25.9467f, 32.5108f, 0.8551f, 0.2113f },
+    { 1.031f, -25.7256f, 32.6856f, 0.8495f, 0.2206f },
+    { 1.0277f, -25.5003f, 32.6964f, 0.8508f, 0.2268f },
+    { 1.2635f, -25.728f, 32.5387f, 0.8566f, 0.2168f },
+    { 1.2517f, -25.5113f, 32.5662f, 0.8578f, 0.2222f },
+    { 1.4922f, -25.9479f, 32.2887f, 0.8617f, 0.2061f },
+    { 1.4755f, -25.7464f, 32.3355f, 0.8635f, 0.2113f },
+    { 1.4686f, -25.5409f, 32.3799f, 0.8648f, 0.2176f },
+    { 1.5888f, -26.1789f, 31.9504f, 0.8642f, 0.1944f },
+    { 1.6374f, -25.9702f, 32.0047f, 0.8674f, 0.1992f },
+    { 1.6475f, -25.7863f, 32.0616f, 0.8696f, 0.2039f },
+    { 1.6746f, -25.5913f, 32.1156f, 0.8711f, 0.2085f },
+    { 1.7619f, -25.8375f, 31.8056f, 0.8739f, 0.1968f },
+    { 1.8484f, -25.6648f, 31.819f, 0.8774f, 0.1995f },
+    { 1.7202f, -26.002f, 31.7435f, 0.8714f, 0.1926f },
+    { 1.8009f, -25.8894f, 31.6557f, 0.8755f, 0.1923f },
+    { 1.8565f, -25.7918f, 31.6733f, 0.8775f, 0.196f },
+    { 1.734f, -26.0319f, 31.5899f, 0.8729f, 0.1883f },
+    { 1.8138f, -25.9324f, 31.5697f, 0.876f, 0.1896f },
+    { 1.8538f, -25.8554f, 31.6067f, 0.8776f, 0.1925f },
+    { 1.8973f, -25.8536f, 31.5632f, 0.8786f, 0.1913f },
+    { 1.7303f, -26.0584f, 31.5008f, 0.8734f, 0.1856f },
+    { 1.8501f, -25.9565f, 31.5052f, 0.877f, 0.188f },
+    { 1.9363f, -25.8735f, 31.5023f, 0.8796f, 0.19f },
+    { 1.909f, -25.962f, 31.4487f, 0.8782f, 0.1868f },
+    { 1.7604f, -26.0803f, 31.4335f, 0.8744f, 0.1839f },
+    { 1.8224f, -26.0997f, 31.3693f, 0.8769f, 0.1836f },
+    { 1.6512f, -26.2634f, 31.2876f, 0.8709f, 0.1766f },
+    { 1.595f, -26.23f, 31.3522f, 0.8701f, 0.1782f },
+    { 1.4537f, -26.417f, 31.2111f, 0.865f, 0.1696f },
+    { 1.5869f, -26.2001f, 31.4202f, 0.8694f, 0.1804f },
+    { 1.4094f, -26.37f, 31.2752f, 0.8652f, 0.1726f },
+    { 1.2888f, -26.5242f, 31.1468f, 0.8614f, 0.1662f },
+    { 1.6214f, -26.1915f, 31.515f, 0.8692f, 0.1834f },
+    { 1.4219f, -26.3297f, 31.345f, 0.865f, 0.1752f },
+    { 1.2591f, -26.4648f, 31.2161f, 0.8613f, 0.1685f },
+    { 1.1119f, -26.5982f, 31.1029f, 0.8579f, 0.1627f },
+    { 1.2739f, -26.4192f, 31.2919f, 0.861f, 0.1714f },
+    { 1.1369f, -26.5202f, 31.1841f, 0.8578f, 0.166f },
+    { 1.0355f, -26.5418f, 31.1881f, 0.8546f, 0.165f },
+    { 1.3246f, -26.4436f, 31.4119f, 0.8606f, 0.1754f },
+    { 0.9872f, -26.5755f, 31.1431f, 0.8531f, 0.1627f },
+    { 0.9192f, -26.6265f, 31.0396f, 0.8518f, 0.1596f },
+    { 0.8769f, -26.5886f, 31.108f, 0.8495f, 0.1603f },
+    { 0.7266f, -26.6388f, 31.0124f, 0.8456f, 0.1565f },
+    { 0.9441f, -26.5339f, 31.2156f, 0.8514f, 0.1648f },
+    { 0.7327f, -26.6008f, 31.0919f, 0.8445f, 0.1584f },
+    { 0.8961f, -26.5437f, 31.1783f, 0.85f, 0.163f },
+    { 0.8158f, -26.5566f, 31.1534f, 0.8474f, 0.1611f },
+    { 0.7108f, -26.5743f, 31.1454f, 0.8438f, 0.1596f },
+    { 0.6866f, -26.5684f, 31.1999f, 0.843f, 0.1606f },
+    { 0.7604f, -26.5376f, 31.204f, 0.8454f, 0.1618f },
+    { 0.6668f, -26.5496f, 31.2452f, 0.8423f, 0.1617f },
+    { 0.72f, -26.507f, 31.2477f, 0.844f, 0.1627f },
+    { 0.5502f, -26.5007f, 31.2824f, 0.8388f, 0.1625f },
+    { 0.658f, -26.4844f, 31.2712f, 0.8419f, 0.1629f },
+    { 0.4549f, -26.4327f, 31.3625f, 0.8362f, 0.1642f },
+    { 0.5518f, -26.4267f, 31.3343f, 0.8388f, 0.1641f },
+    { 0.4535f, -26.3561f, 31.4843f, 0.8358f, 0.1666f },
+    { 0.5042f, -26.3369f, 31.5046f, 0.8369f, 0.1671f },
+    { 0.5621f, -26.3477f, 31.4537f, 0.8386f, 0.1665f },
+    { 0.6482f, -26.396f, 31.3328f, 0.8413f, 0.1647f },
+    { 0.6257f, -26.3076f, 31.485f, 0.8401f, 0.1675f },
+    { 0.7041f, -26.4405f, 31.2726f, 0.8432f, 0.1638f },
+    { 0.6923f, -26.3628f, 31.3235f, 0.8425f, 0.1653f },
+    { 0.7479f, -26.4626f, 31.2629f, 0.8448f, 0.164f },
+    { 0.7246f, -26.3987f, 31.2865f, 0.8438f, 0.1648f },
+    { 0.8107f, -26.5086f, 31.2225f, 0.847f, 0.1634f },
+    { 0.7814f, -26.4501f, 31.2905f, 0.8458f, 0.1652f },
+    { 0.8518f, -26.501f, 31.2538f, 0.8483f, 0.1649f },
+    { 0.8065f, -26.4542f, 31.3308f, 0.8465f, 0.1666f },
+    { 0.872f, -26.506f, 31.2999f, 0.8489f, 0.1665f },
+    { 0.9545f, -26.5345f, 31.2703f, 0.8516f, 0.1667f },
+    { 0.8093f, -26.4597f, 31.3844f, 0.8465f, 0.1681f },
+    { 1.0303f, -26.5235f, 31.2521f, 0.8542f, 0.1672f },
+    { 0.8592f, -26.5146f, 31.3625f, 0.8484f, 0.1683f },
+    { 0.9217f, -26.5529f, 31.3476f, 0.8504f, 0.1688f },
+    { 1.1255f, -26.4811f, 31.2676f, 0.857f, 0.1689f },
+    { 0.9801f, -26.5569f, 31.3441f, 0.8522f, 0.1695f },
+    { 1.1706f, -26.5217f, 31.4178f, 0.8564f, 0.1736f },
+    { 1.0209f, -26.5581f, 31.38f, 0.853f, 0.171f },
+    { 1.0308f, -26.5879f, 31.4831f, 0.8521f, 0.1739f },
+    { 1.0147f, -26.6215f, 31.641f, 0.8499f, 0.1778f },
+    { 0.9144f, -26.6019f, 31.4485f, 0.8496f, 0.1718f },
+    { 1.1866f, -26.5715f, 31.6033f, 0.8545f, 0.1785f },
+    { 1.3637f, -26.4882f, 31.5987f, 0.8592f, 0.1805f },
+    { 1.4794f, -26.3387f, 31.4496f, 0.8649f, 0.1788f },
+    { 1.5229f, -26.3634f, 31.6245f, 0.8637f, 0.1837f },
+    { 1.6411f, -26.1894f, 31.678f, 0.8679f, 0.188f },
+    { 0.8804f, -26.6382f, 31.6723f, 0.8464f, 0.1775f },
+    { 0.7664f, -26.6276f, 31.785f, 0.8421f, 0.179f },
+    { 0.9224f, -26.6257f, 31.5471f, 0.8488f, 0.1746f },
+    { 0.8162f, -26.6218f, 31.6578f, 0.845f, 0.1765f },
+    { 0.9508f, -26.5978f, 31.4584f, 0.8504f, 0.1724f },
+    { 0.8627f, -26.6184f, 31.5493f, 0.8474f, 0.1741f },
+    { 0.828f, -26.5805f, 31.5279f, 0.8468f, 0.173f },
+    { 0.7874f, -26.5818f, 31.6293f, 0.8447f, 0.1753f },
+    { 0.7444f, -26.5856f, 31.7497f, 0.8419f, 0.1776f },
+    { 0.7595f, -26.5278f, 31.6187f, 0.844f, 0.1743f },
+    { 0.6939f, -26.5914f, 31.8469f, 0.8391f, 0.1793f },
+    { 0.6828f, -26.5321f, 31.8269f, 0.8388f, 0.1779f },
+    { 0.7241f, -26.5292f, 31.7355f, 0.8415f, 0.1764f },
+    { 0.6752f, -26.4685f, 31.8205f, 0.8386f, 0.1767f },
+    { 0.7094f, -26.4678f, 31.7354f, 0.8409f, 0.1755f },
+    { 0.7045f, -26.4102f, 31.7422f, 0.8405f, 0.1747f },
+    { 0.695f, -26.3543f, 31.7505f, 0.84f, 0.174f },
+    { 0.672f, -26.2839f, 31.7027f, 0.8401f, 0.1724f },
+    { 0.7156f, -26.3507f, 31.6659f, 0.8415f, 0.1727f },
+    { 0.6996f, -26.3029f, 31.6406f, 0.8413f, 0.1716f },
+    { 0.7308f, -26.4105f, 31.639f, 0.8425f, 0.173f },
+    { 0.7412f, -26.3601f, 31.5885f, 0.8427f, 0.1714f },
+    { 0.6966f, -26.2894f, 31.6126f, 0.8413f, 0.1709f },
+    { 0.758f, -26.4132f, 31.5514f, 0.8439f, 0.1714f },
+    { 0.7385f, -26.4679f, 31.623f, 0.8432f, 0.1736f },
+    { 0.7552f, -26.3585f, 31.5257f, 0.8434f, 0.1702f },
+    { 0.7948f, -26.5264f, 31.5213f, 0.8459f, 0.1722f },
+    { 0.7693f, -26.4671f, 31.5292f, 0.8448f, 0.1716f },
+    { 0.8711f, -26.5735f, 31.4369f, 0.8485f, 0.1709f },
+    { 0.8285f, -26.5229f, 31.4377f, 0.8472f, 0.1702f },
+    { 0.7951f, -26.4646f, 31.4507f, 0.8459f, 0.1697f },
+    { 0.7794f, -26.4133f, 31.4758f, 0.8448f, 0.1698f },
+    { 0.7886f, -26.4057f, 31.4087f, 0.8452f, 0.1683f },
+    { 0.7681f, -26.3516f, 31.455f, 0.8439f, 0.1688f },
+    { 0.7188f, -26.2963f, 31.5429f, 0.8421f, 0.1698f },
+    { 0.6992f, -26.2718f, 31.5343f, 0.8416f, 0.1693f },
+    { 0.7591f, -26.3337f, 31.4077f, 0.8438f, 0.1677f },
+    { 0.7819f, -26.3956f, 31.3534f, 0.8451f, 0.1669f },
+    { 0.7556f, -26.3885f, 31.313f, 0.8445f, 0.1658f },
+    { 0.7395f, -26.3268f, 31.3606f, 0.8435f, 0.1668f },
+    { 0.7086f, -26.3295f, 31.3458f, 0.8429f, 0.1662f },
+    { 0.6985f, -26.2758f, 31.4724f, 0.8419f, 0.1683f },
+    { 0.6675f, -26.2679f, 31.4933f, 0.8411f, 0.1684f },
+    { 0.6642f, -26.2988f, 31.4454f, 0.8412f, 0.1673f },
+    { 0.7266f, -26.6388f, 31.0124f, 0.5073f, 0.0662f },
+    { 0.5367f, -26.6631f, 31.0151f, 0.5056f, 0.0651f },
+    { 0.667f, -26.6791f, 30.8798f, 0.5082f, 0.0634f },
+    { 0.9185f, -26.6632f, 30.92f, 0.5102f, 0.0672f },
+    { 0.9192f, -26.6265f, 31.0396f, 0.5084f, 0.0696f },
+    { 0.4269f, -26.6748f, 30.86f, 0.506f, 0.0607f },
+    { 0.3846f, -26.687f, 31.0471f, 0.504f, 0.064f },
+    { 0.2447f, -26.6741f, 30.8848f, 0.5035f, 0.0585f },
+    { 0.3187f, -26.6812f, 30.6816f, 0.5064f, 0.0567f },
+    { -0.0001f, -26.634f, 30.6865f, 0.5031f, 0.0531f },
+    { 0.6001f, -26.7201f, 30.7194f, 0.5095f, 0.0601f },
+    { 0.9032f, -26.7018f, 30.7717f, 0.5121f, 0.0648f },
+    { 0.572f, -26.7601f, 30.5565f, 0.511f, 0.0571f },
+    { 0.9017f, -26.7452f, 30.6171f, 0.5141f, 0.0622f },
+    { 1.2015f, -26.6389f, 30.8372f, 0.5145f, 0.0699f },
+    { 0.2773f, -26.6964f, 30.5231f, 0.5072f, 0.0535f },
+    { 1.2354f, -26.6724f, 30.6886f, 0.517f, 0.0678f },
+    { 1.1602f, -26.6197f, 30.9766f, 0.512f, 0.0715f },
+    { 1.1119f, -26.5982f, 31.1029f, 0.5095f, 0.073f },
+    { 1.3714f, -26.541f, 31.0459f, 0.5138f, 0.0757f },
+    { 1.2888f, -26.5242f, 31.1468f, 0.5105f, 0.0763f },
+    { 1.4686f, -26.544f, 30.9149f, 0.5169f, 0.0747f },
+    { 1.5666f, -26.4283f, 31.123f, 0.5158f, 0.0799f },
+    { 1.4537f, -26.417f, 31.2111f, 0.5116f, 0.0797f },
+    { 1.6512f, -26.2634f, 31.2876f, 0.5154f, 0.085f },
+    { 1.7008f, -26.4265f, 30.9934f, 0.5194f, 0.0791f },
+    { 1.7606f, -26.2827f, 31.203f, 0.5185f, 0.0843f },
+    { 1.9147f, -26.1183f, 31.2897f, 0.5212f, 0.0884f },
+    { 1.8946f, -26.2956f, 31.0616f, 0.522f, 0.0829f },
+    { 1.8092f, -26.4347f, 30.8046f, 0.5231f, 0.0772f },
+    { 2.036f, -26.1365f, 31.1351f, 0.5245f, 0.0866f },
+    { 1.5421f, -26.5622f, 30.7549f, 0.52f, 0.0729f },
+    { 2.0244f, -26.3097f, 30.8265f, 0.5262f, 0.0804f },
+    { 1.8833f, -26.4439f, 30.5652f, 0.527f, 0.0744f },
+    { 1.5883f, -26.5799f, 30.5622f, 0.5231f, 0.0704f },
+    { 2.1224f, -26.3187f, 30.5353f, 0.5308f, 0.0771f },
+    { 1.2555f, -26.6989f, 30.5266f, 0.5194f, 0.0654f },
+    { 1.9144f, -26.4457f, 30.2838f, 0.531f, 0.0709f },
+    { 1.6039f, -26.5815f, 30.3329f, 0.5263f, 0.0673f },
+    { 0.9029f, -26.7734f, 30.459f, 0.5161f, 0.0596f },
+    { 1.2556f, -26.697f, 30.3471f, 0.5218f, 0.0627f },
+    { 0.5634f, -26.7833f, 30.3976f, 0.5126f, 0.0543f },
+    { 0.8955f, -26.7661f, 30.3002f, 0.5181f, 0.0571f },
+    { 1.2368f, -26.6786f, 30.1501f, 0.5245f, 0.0598f },
+    { 0.5548f, -26.7739f, 30.2495f, 0.5142f, 0.0518f },
+    { 1.5813f, -26.5717f, 30.0834f, 0.5296f, 0.0638f },
+    { 0.8818f, -26.7435f, 30.1372f, 0.5203f, 0.0545f },
+    { 1.5134f, -26.5552f, 29.8304f, 0.5327f, 0.0599f },
+    { 1.2001f, -26.6556f, 29.9361f, 0.5274f, 0.0565f },
+    { 1.8881f, -26.4417f, 29.9858f, 0.5348f, 0.0668f },
+    { 1.7897f, -26.4336f, 29.6968f, 0.538f, 0.0624f },
+    { 2.1613f, -26.3161f, 30.2259f, 0.5351f, 0.0734f },
+    { 2.0151f, -26.3001f, 29.583f, 0.5424f, 0.0645f },
+    { 2.1295f, -26.3078f, 29.9059f, 0.539f, 0.0693f },
+    { 2.3099f, -26.1639f, 30.4961f, 0.5346f, 0.0794f },
+    { 2.3571f, -26.1566f, 30.1617f, 0.5391f, 0.0756f },
+    { 2.1853f, -26.1545f, 30.8455f, 0.5293f, 0.0833f },
+    { 2.45f, -25.9393f, 30.4709f, 0.5386f, 0.0822f },
+    { 2.29f, -25.9361f, 30.887f, 0.5324f, 0.0867f },
+    { 2.111f, -25.935f, 31.2296f, 0.5267f, 0.0903f },
+    { 2.381f, -25.6724f, 30.9408f, 0.5358f, 0.0905f },
+    { 2.5596f, -25.6681f, 30.4766f, 0.5426f, 0.0856f },
+    { 2.5009f, -25.3812f, 30.997f, 0.54f, 0.0947f },
+    { 2.6556f, -25.3734f, 30.5299f, 0.5464f, 0.0898f },
+    { 2.6377f, -25.6604f, 30.0554f, 0.5479f, 0.0808f },
+    { 2.733f, -25.3642f, 30.0831f, 0.5518f, 0.0847f },
+    { 2.5141f, -25.9313f, 30.0932f, 0.5435f, 0.0779f },
+    { 2.6236f, -25.6421f, 29.6511f, 0.5524f, 0.076f },
+    { 2.4876f, -25.9129f, 29.727f, 0.5477f, 0.0734f },
+    { 2.3234f, -26.1412f, 29.8257f, 0.5431f, 0.0714f },
+    { 2.2052f, -26.1266f, 29.4716f, 0.5468f, 0.0665f },
+    { 2.3757f, -25.8851f, 29.3454f, 0.5518f, 0.0685f },
+    { 2.526f, -25.606f, 29.2378f, 0.5568f, 0.0708f },
+    { 2.2203f, -25.85f, 29.0118f, 0.5551f, 0.0638f },
+    { 2.3891f, -25.5658f, 28.884f, 0.5603f, 0.0662f },
+    { 2.6558f, -25.3195f, 29.1819f, 0.5612f, 0.0738f },
+    { 2.5419f, -25.2942f, 28.7921f, 0.5649f, 0.069f },
+    { 2.2572f, -25.5352f, 28.6588f, 0.5623f, 0.063f },
+    { 2.0407f, -26.1031f, 29.156f, 0.5499f, 0.0617f },
+    { 2.0633f, -25.8098f, 28.7896f, 0.5572f, 0.0603f },
+    { 1.8559f, -26.2811f, 29.2971f, 0.5452f, 0.0599f },
+    { 1.8679f, -26.0613f, 28.9355f, 0.552f, 0.0579f },
+    { 1.6519f, -26.4136f, 29.4421f, 0.5406f, 0.0581f },
+    { 1.6894f, -26.2392f, 29.0881f, 0.5473f, 0.0561f },
+    { 1.5072f, -26.3739f, 29.2468f, 0.5427f, 0.0545f },
+    { 1.4149f, -26.5304f, 29.5981f, 0.5354f, 0.056f },
+    { 1.3009f, -26.4955f, 29.411f, 0.5376f, 0.0527f },
+    { 1.3749f, -26.3253f, 29.1125f, 0.5442f, 0.0517f },
+    { 1.1881f, -26.4544f, 29.2768f, 0.5392f, 0.05f },
+    { 1.5405f, -26.1888f, 28.9527f, 0.5487f, 0.0533f },
+    { 1.0934f, -26.4108f, 29.2031f, 0.5401f, 0.048f },
+    { 1.7132f, -26.0145f, 28.8017f, 0.5532f, 0.0552f },
+    { 1.2742f, -26.2786f, 29.041f, 0.545f, 0.0498f },
+    { 1.434f, -26.1441f, 28.8875f, 0.5494f, 0.0515f },
+    { 1.9213f, -25.772f, 28.6639f, 0.5583f, 0.0578f },
+    { 1.6029f, -25.9763f, 28.746f, 0.5538f, 0.0534f },
+    { 2.135f, -25.5129f, 28.5394f, 0.5633f, 0.0607f },
+    { 1.811f, -25.744f, 28.6198f, 0.5587f, 0.056f },
+    { 2.4317f, -25.2875f, 28.5516f, 0.5667f, 0.0658f },
+    { 2.0269f, -25.4978f, 28.5032f, 0.5635f, 0.0589f },
+    { 2.6702f, -25.0112f, 28.7434f, 0.5692f, 0.0722f },
+    { 2.3246f, -25.289f, 28.4285f, 0.5673f, 0.0636f },
+    { 2.5801f, -25.025f, 28.4786f, 0.5709f, 0.0687f },
+    { 2.766f, -24.6925f, 28.7453f, 0.5737f, 0.0757f },
+    { 2.4829f, -25.0529f, 28.3443f, 0.5712f, 0.0664f },
+    { 2.7511f, -25.0219f, 29.177f, 0.5654f, 0.0774f },
+    { 2.6959f, -24.7055f, 28.4504f, 0.5756f, 0.0719f },
+    { 2.7978f, -24.7095f, 29.2221f, 0.5694f, 0.0815f },
+    { 2.8454f, -24.3394f, 28.7856f, 0.5785f, 0.0798f },
+    { 2.733f, -25.348f, 29.6395f, 0.5566f, 0.0794f },
+    { 2.7994f, -25.0426f, 29.6837f, 0.5604f, 0.0835f },
+    { 2.792f, -25.0587f, 30.1678f, 0.5552f, 0.0892f },
+    { 2.8064f, -24.7381f, 29.7757f, 0.5638f, 0.088f },
+    { 2.7273f, -25.0708f, 30.6304f, 0.5498f, 0.0946f },
+    { 2.8067f, -24.7602f, 30.3009f, 0.5581f, 0.0943f },
+    { 2.8408f, -24.3559f, 29.2867f, 0.574f, 0.0861f },
+    { 2.8152f, -24.3865f, 29.8703f, 0.5679f, 0.0932f },
+    { 2.9248f, -23.9529f, 28.8523f, 0.5838f, 0.0845f },
+    { 2.9249f, -23.9348f, 29.3404f, 0.5798f, 0.0913f },
+    { 2.7873f, -24.3585f, 28.4578f, 0.5806f, 0.0753f },
+    { 2.8627f, -24.0135f, 28.4919f, 0.5855f, 0.079f },
+    { 2.603f, -24.7572f, 28.3001f, 0.5757f, 0.0693f },
+    { 2.6715f, -24.4254f, 28.2563f, 0.5807f, 0.0716f },
+    { 3.0213f, -23.4833f, 28.8455f, 0.5911f, 0.0889f },
+    { 2.7602f, -24.0741f, 28.2695f, 0.5859f, 0.0748f },
+    { 2.9141f, -23.6865f, 28.4874f, 0.5905f, 0.0817f },
+    { 2.639f, -24.0922f, 28.1956f, 0.5861f, 0.0722f },
+    { 2.811f, -23.7946f, 28.2611f, 0.5902f, 0.0769f },
+    { 2.6855f, -23.8319f, 28.189f, 0.5902f, 0.0741f },
+    { 2.8417f, -23.5478f, 28.2317f, 0.5944f, 0.0784f },
+    { 2.7212f, -23.6047f, 28.1794f, 0.5939f, 0.0757f },
+    { 2.9336f, -23.3935f, 28.3791f, 0.5959f, 0.0824f },
+    { 2.8344f, -23.372f, 28.2062f, 0.5974f, 0.0791f },
+    { 2.7475f, -23.3814f, 28.1677f, 0.5976f, 0.0774f },
+    { 2.8935f, -23.1904f, 28.2428f, 0.6001f, 0.0814f },
+    { 3.0202f, -23.1571f, 28.4987f, 0.599f, 0.0863f },
+    { 2.766f, -23.1331f, 28.1545f, 0.6016f, 0.0791f },
+    { 2.9524f, -22.9491f, 28.2641f, 0.6039f, 0.0838f },
+    { 2.6054f, -23.4039f, 28.192f, 0.5974f, 0.0747f },
+    { 2.7943f, -22.8939f, 28.1234f, 0.6057f, 0.0806f },
+    { 2.5811f, -23.6162f, 28.2297f, 0.5938f, 0.0732f },
+    { 2.6043f, -23.1576f, 28.1401f, 0.6015f, 0.076f },
+    { 2.4303f, -23.6347f, 28.39f, 0.5935f, 0.0695f },
+    { 2.461f, -23.4448f, 28.321f, 0.5967f, 0.0712f },
+    { 2.6109f, -22.9214f, 28.0769f, 0.6056f, 0.0772f },
+    { 2.4613f, -23.2003f, 28.2257f, 0.6008f, 0.0729f },
+    { 2.3257f, -23.4755f, 28.4466f, 0.5962f, 0.068f },
+    { 2.6587f, -22.7392f, 28.0051f, 0.6091f, 0.0783f },
+    { 2.2982f, -23.6374f, 28.5394f, 0.5935f, 0.0663f },
+    { 2.4675f, -22.9616f, 28.1247f, 0.6049f, 0.0745f },
+    { 2.3307f, -23.2366f, 28.3131f, 0.6002f, 0.0701f },
+    { 2.5163f, -22.7887f, 28.0383f, 0.608f, 0.0759f },
+    { 2.2111f, -23.4675f, 28.4608f, 0.5967f, 0.066f },
+    { 2.3439f, -22.9943f, 28.1754f, 0.6043f, 0.0722f },
+    { 2.2064f, -23.2419f, 28.3042f, 0.6006f, 0.068f },
+    { 2.3961f, -22.8221f, 28.0698f, 0.6073f, 0.074f },
+    { 2.1241f, -23.5376f, 28.4565f, 0.5962f, 0.0637f },
+    { 2.2198f, -22.9995f, 28.1376f, 0.6048f, 0.0703f },
+    { 2.1421f, -23.2473f, 28.2423f, 0.6015f, 0.0662f },
+    { 2.2712f, -22.8149f, 28.0118f, 0.6078f, 0.0722f },
+    { 2.1607f, -22.9962f, 28.0599f, 0.6058f, 0.0686f },
+    { 2.2135f, -22.7908f, 27.9156f, 0.6092f, 0.0707f },
+    { 2.1916f, -23.2838f, 28.1712f, 0.6023f, 0.0645f },
+    { 2.232f, -23.0036f, 27.9906f, 0.6071f, 0.0672f },
+    { 2.1472f, -23.5816f, 28.3536f, 0.5971f, 0.0617f },
+    { 2.2766f, -23.3181f, 28.0877f, 0.6032f, 0.063f },
+    { 2.0799f, -23.8658f, 28.605f, 0.5908f, 0.0603f },
+    { 2.2023f, -23.6275f, 28.2562f, 0.5978f, 0.0601f },
+    { 2.0725f, -23.8652f, 28.5168f, 0.5919f, 0.0592f },
+    { 2.1659f, -23.6977f, 28.5974f, 0.5929f, 0.0634f },
+    { 2.2141f, -23.6015f, 28.5571f, 0.5943f, 0.0649f },
+    { 2.2553f, -23.7808f, 28.6015f, 0.5912f, 0.0646f },
+    { 2.1369f, -23.9199f, 28.6826f, 0.5893f, 0.0612f },
+    { 2.3906f, -23.8186f, 28.4393f, 0.5905f, 0.0679f },
+    { 2.2344f, -23.9916f, 28.667f, 0.5878f, 0.0627f },
+    { 2.0273f, -24.1369f, 28.7119f, 0.5862f, 0.0577f },
+    { 2.1022f, -24.156f, 28.7623f, 0.5855f, 0.0588f },
+    { 1.9902f, -24.1208f, 28.6363f, 0.5872f, 0.0568f },
+    { 1.9633f, -24.3215f, 28.7527f, 0.5831f, 0.0557f },
+    { 2.0923f, -23.8826f, 28.4201f, 0.5928f, 0.0579f },
+    { 1.9234f, -24.3351f, 28.6875f, 0.5835f, 0.0547f },
+    { 1.9841f, -24.1097f, 28.5469f, 0.5883f, 0.056f },
+    { 2.2373f, -23.6286f, 28.1463f, 0.599f, 0.0592f },
+    { 2.1172f, -23.8826f, 28.317f, 0.5939f, 0.057f },
+    { 2.3188f, -23.3168f, 27.9889f, 0.6044f, 0.0622f },
+    { 2.249f, -23.6053f, 28.0259f, 0.6005f, 0.0586f },
+    { 2.327f, -23.2914f, 27.8742f, 0.6058f, 0.0617f },
+    { 2.3917f, -22.9997f, 27.8396f, 0.6095f, 0.0656f },
+    { 2.4026f, -22.9686f, 27.7374f, 0.6108f, 0.0653f },
+    { 2.3403f, -23.009f, 27.9204f, 0.6083f, 0.0661f },
+    { 2.5092f, -22.6749f, 27.6034f, 0.6153f, 0.0692f },
+    { 2.2952f, -22.7733f, 27.8329f, 0.6108f, 0.0697f },
+    { 2.4864f, -22.7296f, 27.693f, 0.6137f, 0.0691f },
+    { 2.4187f, -22.7553f, 27.7599f, 0.6124f, 0.0691f },
+    { 2.2844f, -22.6378f, 27.8091f, 0.6116f, 0.0723f },
+    { 2.368f, -22.6054f, 27.7168f, 0.6135f, 0.0717f },
+    { 2.4944f, -22.5726f, 27.6411f, 0.6154f, 0.0716f },
+    { 2.3333f, -22.6772f, 27.9132f, 0.6101f, 0.0735f },
+    { 2.4375f, -22.5125f, 27.661f, 0.6151f, 0.0729f },
+    { 2.3569f, -22.5441f, 27.7398f, 0.6134f, 0.0731f },
+    { 2.4476f, -22.694f, 27.9794f, 0.6096f, 0.075f },
+    { 2.3789f, -22.5756f, 27.8284f, 0.6122f, 0.074f },
+    { 2.4204f, -22.5029f, 27.716f, 0.6144f, 0.0736f },
+    { 2.5605f, -22.6585f, 27.958f, 0.6105f, 0.0766f },
+    { 2.4902f, -22.4696f, 27.6612f, 0.6158f, 0.0737f },
+    { 2.4309f, -22.5028f, 27.7607f, 0.6139f, 0.0741f },
+    { 2.5886f, -22.4321f, 27.6182f, 0.6173f, 0.0743f },
+    { 2.459f, -22.5843f, 27.8869f, 0.6118f, 0.0752f },
+    { 2.5126f, -22.4519f, 27.7132f, 0.6155f, 0.0747f },
+    { 2.4689f, -22.5185f, 27.816f, 0.6133f, 0.075f },
+    { 2.5263f, -22.4733f, 27.7926f, 0.6144f, 0.0756f },
+    { 2.5531f, -22.5477f, 27.8752f, 0.6127f, 0.0764f },
+    { 2.6118f, -22.4043f, 27.6853f, 0.6169f, 0.0757f },
+    { 2.636f, -22.4146f, 27.7725f, 0.6158f, 0.0771f },
+    { 2.6772f, -22.4845f, 27.8526f, 0.6141f, 0.0782f },
+    { 2.6974f, -22.598f, 27.929f, 0.6119f, 0.0788f },
+    { 2.8499f, -22.6982f, 28.0581f, 0.6094f, 0.0816f },
+    { 2.8839f, -22.54f, 27.972f, 0.6126f, 0.0819f },
+    { 3.0264f, -22.7188f, 28.2085f, 0.6081f, 0.0853f },
+    { 3.1247f, -22.8541f, 28.4675f, 0.6042f, 0.089f },
+    { 3.0726f, -22.5091f, 28.1066f, 0.6123f, 0.0859f },
+    { 3.1679f, -22.9873f, 28.8349f, 0.5991f, 0.0938f },
+    { 3.2161f, -22.5302f, 28.3521f, 0.6103f, 0.0907f },
+    { 3.3067f, -22.5535f, 28.7225f, 0.6069f, 0.0968f },
+    { 3.2634f, -22.2311f, 28.2191f, 0.6159f, 0.0917f },
+    { 3.4359f, -22.1377f, 28.5974f, 0.6141f, 0.0996f },
+    { 3.3366f, -22.5295f, 29.2317f, 0.6022f, 0.1051f },
+    { 3.5089f, -22.0705f, 29.1513f, 0.6098f, 0.1093f },
+    { 3.1793f, -23.0015f, 29.3105f, 0.5943f, 0.101f },
+    { 3.5021f, -22.0443f, 29.7899f, 0.6034f, 0.1193f },
+    { 3.0408f, -23.4741f, 29.357f, 0.5866f, 0.0966f },
+    { 3.3099f, -22.5042f, 29.8315f, 0.596f, 0.1144f },
+    { 3.1437f, -22.9729f, 29.8888f, 0.5884f, 0.1098f },
+    { 2.887f, -23.94f, 29.9227f, 0.5739f, 0.0991f },
+    { 3.0029f, -23.4512f, 29.9299f, 0.5809f, 0.1049f },
+    { 2.906f, -23.4482f, 30.6195f, 0.5726f, 0.1142f },
+    { 3.0458f, -22.9774f, 30.564f, 0.5801f, 0.1192f },
+    { 2.8353f, -23.9491f, 30.5661f, 0.5664f, 0.1074f },
+    { 2.7265f, -23.4192f, 31.3418f, 0.5633f, 0.1243f },
+    { 2.8101f, -24.4099f, 30.4459f, 0.5615f, 0.1002f },
+    { 2.7404f, -23.9763f, 31.132f, 0.5589f, 0.1143f },
+    { 2.7639f, -24.7759f, 30.7777f, 0.5525f, 0.0999f },
+    { 2.7675f, -24.4304f, 30.9517f, 0.5553f, 0.1063f },
+    { 2.6036f, -25.0798f, 31.073f, 0.5442f, 0.0993f },
+    { 2.643f, -24.7854f, 31.1861f, 0.5473f, 0.1044f },
+    { 2.3229f, -25.3885f, 31.4045f, 0.5342f, 0.0988f },
+    { 2.4567f, -25.0895f, 31.4507f, 0.5391f, 0.1031f },
+    { 2.3222f, -25.104f, 31.7189f, 0.5354f, 0.1057f },
+    { 2.1699f, -24.8176f, 32.0151f, 0.5353f, 0.1129f },
+    { 2.3474f, -24.8097f, 31.7814f, 0.5389f, 0.1104f },
+    { 2.4892f, -24.7947f, 31.522f, 0.5426f, 0.1079f },
+    { 2.1202f, -24.5144f, 32.0923f, 0.5375f, 0.1181f },
+    { 2.6294f, -24.4525f, 31.3258f, 0.55f, 0.1104f },
+    { 2.2957f, -24.4981f, 31.8586f, 0.5414f, 0.1158f },
+    { 2.4531f, -24.4753f, 31.6132f, 0.5454f, 0.1134f },
+    { 2.5731f, -24.0356f, 31.4818f, 0.553f, 0.118f },
+    { 2.381f, -24.1028f, 31.7194f, 0.5481f, 0.12f },
+    { 2.2117f, -24.1536f, 31.9487f, 0.5436f, 0.1219f },
+    { 2.038f, -24.1895f, 32.1779f, 0.5392f, 0.1239f },
+    { 2.0878f, -23.8058f, 32.0928f, 0.5444f, 0.1287f },
+    { 1.9004f, -23.8559f, 32.3202f, 0.5395f, 0.1306f },
+    { 1.8329f, -24.2117f, 32.4148f, 0.5347f, 0.1262f },
+    { 2.2842f, -23.7315f, 31.865f, 0.5497f, 0.1271f },
+    { 2.4917f, -23.6186f, 31.652f, 0.5553f, 0.1259f },
+    { 2.4026f, -23.2852f, 31.8347f, 0.5559f, 0.1327f },
+    { 2.6162f, -23.0677f, 31.6321f, 0.5627f, 0.1329f },
+    { 2.1738f, -23.4159f, 32.0744f, 0.5494f, 0.134f },
+    { 2.5277f, -22.8227f, 31.8088f, 0.5623f, 0.1387f },
+    { 1.9168f, -23.484f, 32.3319f, 0.5429f, 0.1361f },
+    { 2.3123f, -23.0297f, 32.0164f, 0.5554f, 0.1385f },
+    { 2.0688f, -23.1567f, 32.2789f, 0.5483f, 0.14f },
+    { 2.4482f, -22.6705f, 32.0128f, 0.5605f, 0.1436f },
+    { 2.2272f, -22.8462f, 32.1838f, 0.5542f, 0.1433f },
+    { 1.7667f, -23.2055f, 32.558f, 0.5411f, 0.1427f },
+    { 1.9881f, -22.9546f, 32.41f, 0.5478f, 0.1445f },
+    { 1.6848f, -23.5265f, 32.5674f, 0.5372f, 0.1383f },
+    { 1.7058f, -22.9878f, 32.6633f, 0.5411f, 0.147f },
+    { 1.7197f, -23.8959f, 32.5314f, 0.535f, 0.1323f },
+    { 1.5311f, -23.5804f, 32.741f, 0.5331f, 0.1394f },
+    { 1.5326f, -23.9245f, 32.7257f, 0.5307f, 0.1341f },
+    { 1.8897f, -24.5182f, 32.3445f, 0.533f, 0.1208f },
+    { 1.405f, -23.6277f, 32.8809f, 0.5298f, 0.1403f },
+    { 1.2559f, -23.6504f, 33.0151f, 0.5264f, 0.1415f },
+    { 1.3095f, -23.4449f, 32.9946f, 0.5288f, 0.1443f },
+    { 1.0871f, -23.6558f, 33.1372f, 0.523f, 0.1428f },
+    { 1.2029f, -23.4034f, 33.1122f, 0.5265f, 0.1462f },
+    { 1.0727f, -23.3972f, 33.226f, 0.5236f, 0.1475f },
+    { 1.1989f, -23.2408f, 33.1372f, 0.5274f, 0.1489f },
+    { 1.3349f, -23.3378f, 32.9681f, 0.5302f, 0.1456f },
+    { 1.4278f, -23.2054f, 32.8714f, 0.5335f, 0.1465f },
+    { 1.2308f, -23.1029f, 33.1241f, 0.5291f, 0.1507f },
+    { 1.4487f, -22.9713f, 32.9076f, 0.5354f, 0.1501f },
+    { 1.0935f, -23.0358f, 33.3378f, 0.5255f, 0.1538f },
+    { 1.2857f, -22.9304f, 33.1066f, 0.5314f, 0.1528f },
+    { 1.1626f, -22.8677f, 33.3255f, 0.528f, 0.1559f },
+    { 1.2746f, -22.6975f, 33.2727f, 0.5313f, 0.1577f },
+    { 1.3665f, -22.7371f, 33.077f, 0.5342f, 0.155f },
+    { 1.3926f, -22.5259f, 33.4188f, 0.5324f, 0.1621f },
+    { 1.4277f, -22.5254f, 33.1907f, 0.5351f, 0.1592f },
+    { 1.4961f, -22.7716f, 32.9078f, 0.5375f, 0.1528f },
+    { 1.4758f, -22.5369f, 33.0276f, 0.5375f, 0.1573f },
+    { 1.6953f, -22.7918f, 32.7062f, 0.5421f, 0.1502f },
+    { 1.5584f, -22.556f, 32.8915f, 0.54f, 0.1555f },
+    { 1.9273f, -22.7736f, 32.504f, 0.5475f, 0.1481f },
+    { 1.6967f, -22.5782f, 32.7447f, 0.5433f, 0.1534f },
+    { 2.1554f, -22.693f, 32.3333f, 0.553f, 0.1473f },
+    { 1.8819f, -22.5776f, 32.5976f, 0.5473f, 0.1516f },
+    { 2.3847f, -22.5595f, 32.2077f, 0.5586f, 0.1476f },
+    { 2.1049f, -22.5281f, 32.4609f, 0.5522f, 0.1507f },
+    { 2.6206f, -22.3829f, 32.1411f, 0.5641f, 0.1491f },
+    { 2.3446f, -22.4383f, 32.357f, 0.5573f, 0.1508f },
+    { 2.6761f, -22.4352f, 31.9247f, 0.5667f, 0.1454f },
+    { 2.58f, -22.3163f, 32.3086f, 0.5623f, 0.152f },
+    { 2.7455f, -22.5338f, 31.6945f, 0.569f, 0.1408f },
+    { 2.8411f, -22.1784f, 32.1165f, 0.5693f, 0.1514f },
+    { 2.898f, -22.1708f, 31.8979f, 0.5724f, 0.1483f },
+    { 2.7927f, -22.1666f, 32.2944f, 0.5668f, 0.1539f },
+    { 3.0244f, -21.961f, 32.117f, 0.5738f, 0.1542f },
+    { 2.9645f, -22.2094f, 31.6535f, 0.5754f, 0.1442f },
+    { 3.1009f, -21.9076f, 31.9111f, 0.5774f, 0.1518f },
+    { 2.8279f, -22.7394f, 31.4858f, 0.5701f, 0.1351f },
+    { 2.9269f, -22.9284f, 31.1563f, 0.5728f, 0.128f },
+    { 3.0418f, -22.3595f, 31.3981f, 0.5774f, 0.1387f },
+    { 3.1836f, -21.8957f, 31.6658f, 0.581f, 0.1484f },
+    { 3.1303f, -22.5035f, 31.0365f, 0.5809f, 0.1318f },
+    { 3.2304f, -22.5236f, 30.4737f, 0.588f, 0.1234f },
+    { 3.4352f, -22.0737f, 30.4224f, 0.5955f, 0.1283f },
+    { 3.7031f, -21.5729f, 29.7528f, 0.6107f, 0.1245f },
+    { 3.3434f, -22.0808f, 30.9743f, 0.5883f, 0.1363f },
+    { 3.6761f, -21.6008f, 29.074f, 0.6172f, 0.1137f },
+    { 3.6598f, -21.5981f, 30.4245f, 0.6027f, 0.1344f },
+    { 3.8182f, -21.0967f, 29.0044f, 0.6246f, 0.1187f },
+    { 3.8955f, -21.0698f, 29.7088f, 0.6183f, 0.1301f },
+    { 3.5762f, -21.6224f, 31.0122f, 0.595f, 0.1428f },
+    { 3.9037f, -21.0669f, 30.4939f, 0.6097f, 0.1423f },
+    { 3.482f, -21.5917f, 31.4393f, 0.5897f, 0.1492f },
+    { 3.8384f, -21.0899f, 31.1923f, 0.601f, 0.1526f },
+    { 3.262f, -21.9874f, 31.3712f, 0.5841f, 0.1431f },
+    { 3.3797f, -21.576f, 31.7452f, 0.5855f, 0.1536f },
+    { 3.6951f, -21.1409f, 31.6366f, 0.5942f, 0.1581f },
+    { 3.2721f, -21.6448f, 31.9691f, 0.5814f, 0.156f },
+    { 3.5299f, -21.2336f, 31.9052f, 0.5887f, 0.1604f },
+    { 3.1734f, -21.744f, 32.1472f, 0.5775f, 0.1574f },
+    { 3.3987f, -21.3814f, 32.0766f, 0.5841f, 0.161f },
+    { 3.291f, -21.5403f, 32.2118f, 0.5799f, 0.161f },
+    { 2.9644f, -21.9937f, 32.2934f, 0.5709f, 0.1563f },
+    { 3.098f, -21.8194f, 32.3157f, 0.574f, 0.159f },
+    { 2.7563f, -22.1487f, 32.4332f, 0.5649f, 0.156f },
+    { 2.9222f, -22.0115f, 32.4365f, 0.5686f, 0.1581f },
+    { 2.5527f, -22.2577f, 32.4357f, 0.561f, 0.1543f },
+    { 2.7354f, -22.1377f, 32.5344f, 0.5637f, 0.158f },
+    { 2.323f, -22.3379f, 32.4695f, 0.5566f, 0.1534f },
+    { 2.5372f, -22.2296f, 32.5309f, 0.5601f, 0.1564f },
+    { 2.3152f, -22.2897f, 32.5535f, 0.5561f, 0.1555f },
+    { 2.0787f, -22.3886f, 32.56f, 0.5518f, 0.1536f },
+    { 2.08f, -22.3113f, 32.6236f, 0.5518f, 0.1556f },
+    { 1.8605f, -22.4074f, 32.673f, 0.5474f, 0.1545f },
+    { 1.872f, -22.3041f, 32.7122f, 0.5479f, 0.1565f },
+    { 1.7091f, -22.3918f, 32.7743f, 0.5444f, 0.1561f },
+    { 1.7316f, -22.2774f, 32.7905f, 0.5453f, 0.158f },
+    { 1.6162f, -22.3679f, 32.8732f, 0.5422f, 0.1579f },
+    { 1.65f, -22.2508f, 32.8673f, 0.5435f, 0.1594f },
+    { 1.5733f, -22.3618f, 32.9789f, 0.5404f, 0.1591f },
+    { 1.6185f, -22.2439f, 32.9513f, 0.5421f, 0.1603f },
+    { 1.5631f, -22.3708f, 33.1078f, 0.5386f, 0.1605f },
+    { 1.6222f, -22.2531f, 33.0523f, 0.5409f, 0.1612f },
+    { 1.5682f, -22.3919f, 33.2766f, 0.5368f, 0.1625f },
+    { 1.6462f, -22.2748f, 33.1802f, 0.5396f, 0.1627f },
+    { 1.5938f, -22.4008f, 33.4435f, 0.5354f, 0.1648f },
+    { 1.6867f, -22.2945f, 33.3116f, 0.5386f, 0.1645f },
+    { 1.74f, -22.2979f, 33.4231f, 0.5383f, 0.1662f },
+    { 1.8201f, -22.2816f, 33.5258f, 0.5387f, 0.1679f },
+    { 1.7789f, -22.2248f, 33.3185f, 0.5403f, 0.1656f },
+    { 1.8591f, -22.2406f, 33.4172f, 0.5404f, 0.1671f },
+    { 1.9411f, -22.2418f, 33.6309f, 0.5399f, 0.1699f },
+    { 1.7245f, -22.2f, 33.2192f, 0.5407f, 0.1642f },
+    { 1.6797f, -22.1795f, 33.115f, 0.5414f, 0.1628f },
+    { 1.8156f, -22.1507f, 33.2233f, 0.5421f, 0.165f },
+    { 1.6508f, -22.1664f, 33.0169f, 0.5423f, 0.1617f },
+    { 1.7622f, -22.1249f, 33.1419f, 0.5424f, 0.164f },
+    { 1.7217f, -22.1108f, 33.0661f, 0.5428f, 0.1631f },
+    { 1.6443f, -22.1638f, 32.9362f, 0.5432f, 0.1611f },
+    { 1.6951f, -22.1045f, 32.9943f, 0.5434f, 0.1624f },
+    { 1.6747f, -22.1747f, 32.8651f, 0.5444f, 0.1605f },
+    { 1.6838f, -22.1021f, 32.9249f, 0.5442f, 0.162f },
+    { 1.7566f, -22.2018f, 32.796f, 0.5461f, 0.1593f },
+    { 1.7051f, -22.1093f, 32.8579f, 0.5453f, 0.1616f },
+    { 1.8937f, -22.234f, 32.728f, 0.5485f, 0.1581f },
+    { 1.7766f, -22.1318f, 32.7934f, 0.5468f, 0.1607f },
+    { 2.0899f, -22.26f, 32.6599f, 0.5519f, 0.1573f },
+    { 1.9032f, -22.1636f, 32.7327f, 0.5489f, 0.1597f },
+    { 2.3119f, -22.2585f, 32.6094f, 0.5558f, 0.1572f },
+    { 2.0898f, -22.1983f, 32.6773f, 0.552f, 0.1589f },
+    { 2.5263f, -22.2081f, 32.5937f, 0.5595f, 0.1581f },
+    { 2.3038f, -22.2092f, 32.6375f, 0.5555f, 0.1588f },
+    { 2.0849f, -22.1408f, 32.6837f, 0.552f, 0.1604f },
+    { 2.5129f, -22.1693f, 32.6238f, 0.5591f, 0.1596f },
+    { 1.9047f, -22.1033f, 32.7326f, 0.5492f, 0.161f },
+    { 2.2951f, -22.158f, 32.6488f, 0.5554f, 0.1602f },
+    { 1.7888f, -22.0741f, 32.7888f, 0.5472f, 0.1619f },
+    { 1.7291f, -22.0568f, 32.8512f, 0.5459f, 0.1626f },
+    { 1.7904f, -22.035f, 32.7887f, 0.5475f, 0.1626f },
+    { 1.7175f, -22.0552f, 32.9184f, 0.5449f, 0.1629f },
+    { 1.7346f, -22.0195f, 32.8503f, 0.5463f, 0.1633f },
+    { 1.7263f, -22.0197f, 32.9176f, 0.5453f, 0.1635f },
+    { 1.7333f, -22.06f, 32.9827f, 0.5442f, 0.163f },
+    { 1.7435f, -22.0253f, 32.9802f, 0.5447f, 0.1635f },
+    { 1.7554f, -22.0618f, 33.036f, 0.5438f, 0.1633f },
+    { 1.7642f, -22.0257f, 33.0274f, 0.5445f, 0.1636f },
+    { 1.7896f, -22.0684f, 33.09f, 0.5436f, 0.1639f },
+    { 1.7963f, -22.0298f, 33.0741f, 0.5444f, 0.164f },
+    { 1.8413f, -22.0874f, 33.156f, 0.5435f, 0.1646f },
+    { 1.8475f, -22.0465f, 33.135f, 0.5444f, 0.1645f },
+    { 1.9144f, -22.1129f, 33.2341f, 0.5436f, 0.1655f },
+    { 1.8525f, -22.0311f, 33.1239f, 0.5449f, 0.1645f },
+    { 1.7992f, -22.013f, 33.0616f, 0.545f, 0.164f },
+    { 1.9248f, -22.0563f, 33.1987f, 0.5448f, 0.1651f },
+    { 1.7629f, -22.0056f, 33.0132f, 0.545f, 0.1639f },
+    { 1.7452f, -22.0087f, 32.9762f, 0.545f, 0.1639f },
+    { 1.7345f, -22.0012f, 32.9309f, 0.5457f, 0.1639f },
+    { 1.7455f, -22.0037f, 32.8649f, 0.5463f, 0.164f },
+    { 1.7989f, -22.0192f, 32.8037f, 0.5476f, 0.1632f },
+    { 1.9028f, -22.0634f, 32.734f, 0.5493f, 0.1619f },
+    { 1.907f, -22.0466f, 32.7491f, 0.5488f, 0.1625f },
+    { 2.0809f, -22.1018f, 32.6872f, 0.552f, 0.1614f },
+    { 2.0823f, -22.0849f, 32.7026f, 0.552f, 0.1622f },
+    { 2.2897f, -22.1212f, 32.6539f, 0.5553f, 0.1612f },
+    { 2.2894f, -22.1044f, 32.6696f, 0.5552f, 0.1618f },
+    { 2.5008f, -22.1264f, 32.6346f, 0.5588f, 0.1608f },
+    { 2.4944f, -22.0922f, 32.6396f, 0.5587f, 0.1618f },
+    { 2.4927f, -22.0755f, 32.6555f, 0.5587f, 0.1626f },
+    { 2.682f, -22.0313f, 32.6425f, 0.5619f, 0.1628f },
+    { 2.6789f, -22.0143f, 32.658f, 0.5621f, 0.1634f },
+    { 2.6894f, -22.0622f, 32.638f, 0.5621f, 0.162f },
+    { 2.8399f, -21.9547f, 32.6606f, 0.5646f, 0.164f },
+    { 2.8345f, -21.9364f, 32.6753f, 0.5645f, 0.1644f },
+    { 2.8478f, -21.9821f, 32.6555f, 0.5649f, 0.1635f },
+    { 2.953f, -21.8784f, 32.6844f, 0.5666f, 0.165f },
+    { 2.9468f, -21.8583f, 32.6977f, 0.5669f, 0.1653f },
+    { 2.9618f, -21.9021f, 32.6783f, 0.5669f, 0.1647f },
+    { 3.0066f, -21.8182f, 32.7042f, 0.5673f, 0.1654f },
+    { 3.0031f, -21.7964f, 32.7156f, 0.5671f, 0.1654f },
+    { 3.0168f, -21.8386f, 32.6977f, 0.5677f, 0.1653f },
+    { 3.0269f, -21.7853f, 32.7253f, 0.5672f, 0.1655f },
+    { 3.0221f, -21.7745f, 32.7298f, 0.5673f, 0.1654f },
+    { 3.0376f, -21.8091f, 32.7195f, 0.5676f, 0.1655f },
+    { 3.0403f, -21.7909f, 32.7526f, 0.5664f, 0.1658f },
+    { 3.0314f, -21.7607f, 32.7519f, 0.5662f, 0.1657f },
+    { 3.049f, -21.8314f, 32.7497f, 0.5668f, 0.1659f },
+    { 3.0382f, -21.8186f, 32.7962f, 0.5651f, 0.1661f },
+    { 3.0277f, -21.7754f, 32.7969f, 0.5651f, 0.1659f },
+    { 3.046f, -21.8742f, 32.7965f, 0.5654f, 0.1664f },
+    { 3.0119f, -21.8524f, 32.8663f, 0.5634f, 0.1663f },
+    { 2.9975f, -21.8118f, 32.8668f, 0.5631f, 0.166f },
+    { 3.0233f, -21.9062f, 32.8684f, 0.5638f, 0.1667f },
+    { 2.9626f, -21.894f, 32.9584f, 0.5614f, 0.1664f },
+    { 2.9456f, -21.8632f, 32.9574f, 0.5612f, 0.166f },
+    { 2.9778f, -21.9383f, 32.9627f, 0.5617f, 0.1669f },
+    { 2.8918f, -21.9455f, 33.0681f, 0.5589f, 0.1664f },
+    { 2.8771f, -21.9229f, 33.0644f, 0.5587f, 0.166f },
+    { 2.9061f, -21.9814f, 33.0771f, 0.5592f, 0.167f },
+    { 2.7882f, -22.0098f, 33.1858f, 0.5561f, 0.1665f },
+    { 2.7788f, -21.9918f, 33.1779f, 0.5561f, 0.166f },
+    { 2.8004f, -22.0393f, 33.2006f, 0.5562f, 0.1671f },
+    { 2.6406f, -22.09f, 33.302f, 0.5527f, 0.1666f },
+    { 2.6375f, -22.0705f, 33.2883f, 0.5526f, 0.1661f },
+    { 2.6527f, -22.116f, 33.3225f, 0.5528f, 0.1672f },
+    { 2.4692f, -22.1505f, 33.3855f, 0.5495f, 0.1667f },
+    { 2.4711f, -22.1286f, 33.3671f, 0.5491f, 0.1663f },
+    { 2.4811f, -22.1759f, 33.4104f, 0.5495f, 0.1674f },
+    { 2.2944f, -22.1558f, 33.4052f, 0.547f, 0.1667f },
+    { 2.2978f, -22.1352f, 33.3863f, 0.5471f, 0.1663f },
+    { 2.3036f, -22.1836f, 33.4322f, 0.5469f, 0.1674f },
+    { 2.1357f, -22.131f, 33.3723f, 0.5454f, 0.1665f },
+    { 2.1394f, -22.1131f, 33.3554f, 0.5452f, 0.1662f },
+    { 2.1406f, -22.1631f, 33.3996f, 0.545f, 0.1672f },
+    { 2.013f, -22.1015f, 33.2979f, 0.5446f, 0.1659f },
+    { 2.0177f, -22.0853f, 33.2844f, 0.545f, 0.1657f },
+    { 2.0125f, -22.1388f, 33.3245f, 0.544f, 0.1664f },
+    { 1.9193f, -22.0717f, 33.2097f, 0.5444f, 0.1652f },
+    { 1.8925f, -22.1768f, 33.3117f, 0.5421f, 0.1662f },
+    { 2.0036f, -22.1914f, 33.4081f, 0.5429f, 0.1675f },
+    { 1.9814f, -22.2341f, 33.5199f, 0.5415f, 0.1687f },
+    { 2.1478f, -22.1999f, 33.4857f, 0.5444f, 0.1685f },
+    { 2.3239f, -22.2074f, 33.5175f, 0.5467f, 0.1688f },
+    { 2.1397f, -22.2152f, 33.599f, 0.5434f, 0.17f },
+    { 2.5094f, -22.1928f, 33.4896f, 0.5496f, 0.1687f },
+    { 2.3282f, -22.194f, 33.6273f, 0.5462f, 0.1706f },
+    { 2.0989f, -22.183f, 33.7083f, 0.5421f, 0.1716f },
+    { 2.5231f, -22.1594f, 33.5923f, 0.5495f, 0.1706f },
+    { 1.866f, -22.2386f, 33.7701f, 0.5378f, 0.1712f },
+    { 2.2895f, -22.1097f, 33.7279f, 0.5453f, 0.1727f },
+    { 2.0376f, -22.1386f, 33.8423f, 0.5404f, 0.1734f },
+    { 1.7393f, -22.2487f, 33.9664f, 0.5345f, 0.1729f },
+    { 1.6167f, -22.2343f, 34.1748f, 0.5313f, 0.175f },
+    { 1.9679f, -22.1175f, 34.0296f, 0.5382f, 0.1756f },
+    { 1.9059f, -22.0812f, 34.2301f, 0.5361f, 0.1781f },
+    { 2.2401f, -22.0167f, 33.856f, 0.5441f, 0.1751f },
+    { 2.2125f, -21.9773f, 34.0482f, 0.5424f, 0.1778f },
+    { 2.1943f, -21.9371f, 34.251f, 0.5409f, 0.1806f },
+    { 2.4573f, -21.901f, 33.8148f, 0.5483f, 0.1762f },
+    { 2.472f, -21.6925f, 34.3569f, 0.5455f, 0.185f },
+    { 2.4636f, -21.8448f, 34.0117f, 0.5471f, 0.1792f },
+    { 2.4791f, -21.7978f, 34.2139f, 0.5461f, 0.1823f },
+    { 2.7715f, -21.3485f, 34.3071f, 0.5521f, 0.1889f },
+    { 2.7661f, -21.5283f, 34.224f, 0.5516f, 0.186f },
+    { 2.7575f, -21.6592f, 34.0951f, 0.5517f, 0.183f },
+    { 3.0604f, -21.1499f, 34.1028f, 0.5589f, 0.1896f },
+    { 2.7119f, -21.7366f, 33.9098f, 0.5521f, 0.1798f },
+    { 3.0412f, -21.3705f, 34.0315f, 0.5579f, 0.1861f },
+    { 3.0143f, -21.5308f, 33.9174f, 0.5574f, 0.1829f },
+    { 3.317f, -20.9972f, 33.8518f, 0.5656f, 0.1892f },
+    { 2.9398f, -21.6465f, 33.7579f, 0.5571f, 0.1795f },
+    { 3.2835f, -21.24f, 33.7981f, 0.564f, 0.1855f },
+    { 3.2342f, -21.4223f, 33.7038f, 0.5629f, 0.1822f },
+    { 3.1301f, -21.5683f, 33.5716f, 0.5618f, 0.1787f },
+    { 3.4727f, -21.1394f, 33.5231f, 0.5698f, 0.184f },
+    { 3.0288f, -21.7042f, 33.4246f, 0.5608f, 0.1752f },
+    { 3.5189f, -20.8868f, 33.5515f, 0.572f, 0.1875f },
+    { 2.869f, -21.759f, 33.5886f, 0.5568f, 0.176f },
+    { 2.6727f, -21.8199f, 33.7222f, 0.5526f, 0.1764f },
+    { 2.8532f, -21.91f, 33.4452f, 0.5566f, 0.1726f },
+    { 2.6835f, -21.9684f, 33.5865f, 0.5529f, 0.1731f },
+    { 2.4914f, -22.034f, 33.6879f, 0.5491f, 0.1732f },
+    { 2.701f, -22.1005f, 33.482f, 0.553f, 0.1703f },
+    { 2.8529f, -22.033f, 33.331f, 0.5565f, 0.1697f },
+    { 2.6818f, -22.1346f, 33.3883f, 0.5529f, 0.1684f },
+    { 2.8286f, -22.0616f, 33.2493f, 0.5563f, 0.168f },
+    { 2.9373f, -22.0024f, 33.1084f, 0.5595f, 0.1677f },
+    { 2.9698f, -21.9726f, 33.1739f, 0.5598f, 0.1692f },
+    { 3.0122f, -21.9558f, 32.9801f, 0.5621f, 0.1674f },
+    { 2.9878f, -21.8561f, 33.2856f, 0.5602f, 0.1719f },
+    { 3.0522f, -21.9209f, 33.0279f, 0.5627f, 0.1686f },
+    { 3.0841f, -21.808f, 33.1238f, 0.5634f, 0.1709f },
+    { 3.1449f, -21.6558f, 33.2424f, 0.5646f, 0.174f },
+    { 3.1007f, -21.8794f, 32.9104f, 0.565f, 0.168f },
+    { 3.2713f, -21.5029f, 33.3582f, 0.5662f, 0.1774f },
+    { 3.1388f, -21.7673f, 32.9759f, 0.5662f, 0.1698f },
+    { 3.2099f, -21.6143f, 33.0544f, 0.5679f, 0.1724f },
+    { 3.1209f, -21.8405f, 32.8166f, 0.5669f, 0.1673f },
+    { 3.1592f, -21.7378f, 32.8474f, 0.5684f, 0.1686f },
+    { 3.3518f, -21.4507f, 33.1247f, 0.5703f, 0.1753f },
+    { 3.231f, -21.5949f, 32.8767f, 0.5705f, 0.1704f },
+    { 3.4013f, -21.3353f, 33.4566f, 0.5681f, 0.1808f },
+    { 3.4997f, -21.2713f, 33.1781f, 0.5729f, 0.1784f },
+    { 3.5887f, -21.0711f, 33.2058f, 0.5753f, 0.1812f },
+    { 3.6436f, -20.8153f, 33.1994f, 0.5782f, 0.1844f },
+    { 3.6991f, -20.7908f, 32.8264f, 0.5836f, 0.1799f },
+    { 3.6894f, -20.4693f, 33.1503f, 0.5823f, 0.1885f },
+    { 3.6276f, -21.0443f, 32.8697f, 0.58f, 0.1773f },
+    { 3.7626f, -20.4563f, 32.7344f, 0.5884f, 0.1833f },
+    { 3.6934f, -20.8215f, 32.4635f, 0.5877f, 0.1742f },
+    { 3.5855f, -21.0684f, 32.5382f, 0.5834f, 0.1721f },
+    { 3.8342f, -20.5362f, 32.3168f, 0.5935f, 0.1763f },
+    { 3.5264f, -21.2475f, 32.8836f, 0.5768f, 0.1749f },
+    { 3.6343f, -20.9537f, 32.145f, 0.5897f, 0.1676f },
+    { 3.4783f, -21.2811f, 32.5887f, 0.5797f, 0.1702f },
+    { 3.4976f, -21.1714f, 32.2582f, 0.5849f, 0.1664f },
+    { 3.8347f, -20.7506f, 31.9376f, 0.5959f, 0.1678f },
+    { 3.3888f, -21.377f, 32.3469f, 0.5808f, 0.1652f },
+    { 3.1963f, -21.6659f, 32.3715f, 0.5759f, 0.1619f },
+    { 3.2724f, -21.5438f, 32.4806f, 0.5764f, 0.1652f },
+    { 3.3395f, -21.464f, 32.6626f, 0.5756f, 0.169f },
+    { 3.1254f, -21.7548f, 32.5154f, 0.5726f, 0.163f },
+    { 3.3738f, -21.4313f, 32.8874f, 0.5735f, 0.1726f },
+    { 3.2155f, -21.6129f, 32.7258f, 0.5721f, 0.168f },
+    { 3.176f, -21.6666f, 32.6043f, 0.5727f, 0.1655f },
+    { 3.1528f, -21.7234f, 32.7439f, 0.5699f, 0.1671f },
+    { 3.1268f, -21.7401f, 32.6632f, 0.5707f, 0.1655f },
+    { 3.089f, -21.8036f, 32.603f, 0.5706f, 0.1638f },
+    { 3.0987f, -21.7809f, 32.6872f, 0.5696f, 0.1655f },
+    { 3.1184f, -21.7965f, 32.7421f, 0.5686f, 0.1665f },
+    { 3.0672f, -21.8271f, 32.6526f, 0.5695f, 0.1644f },
+    { 3.0653f, -21.8058f, 32.7064f, 0.5685f, 0.1655f },
+    { 3.0401f, -21.8401f, 32.6823f, 0.5685f, 0.1649f },
+    { 3.0025f, -21.9135f, 32.6301f, 0.5683f, 0.1632f },
+    { 3.0795f, -21.8329f, 32.7451f, 0.5675f, 0.1661f },
+    { 3.0783f, -21.8837f, 32.8015f, 0.566f, 0.1667f },
+    { 3.0576f, -21.9204f, 32.8788f, 0.5643f, 0.1671f },
+    { 2.9808f, -21.9138f, 32.6644f, 0.5674f, 0.1641f },
+    { 2.8644f, -22.0047f, 32.6443f, 0.5653f, 0.1626f },
+    { 2.704f, -22.0956f, 32.6286f, 0.5624f, 0.161f },
+    { 2.8834f, -22.0188f, 32.6118f, 0.566f, 0.1615f },
+    { 2.721f, -22.1234f, 32.5991f, 0.5629f, 0.1597f },
+    { 2.899f, -22.0204f, 32.5426f, 0.567f, 0.1599f },
+    { 3.0196f, -21.9013f, 32.563f, 0.5695f, 0.1619f },
+    { 3.0465f, -21.8717f, 32.4593f, 0.5713f, 0.1605f },
+    { 0.47f, -26.636f, 29.6365f, 0.5242f, 0.0419f },
+    { 0.4971f, -26.6875f, 29.7366f, 0.5223f, 0.0436f },
+    { 0.2308f, -26.604f, 29.7195f, 0.5194f, 0.0391f },
+    { 0.7824f, -26.6659f, 29.6581f, 0.5274f, 0.0471f },
+    { 0.2295f, -26.5635f, 29.6361f, 0.5217f, 0.0378f },
+    { 0.8336f, -26.7028f, 29.8018f, 0.5253f, 0.0495f },
+    { 0.7261f, -26.62f, 29.5427f, 0.5291f, 0.0449f },
+    { 0.5245f, -26.7267f, 29.8504f, 0.5203f, 0.0456f },
+    { 0.457f, -26.5828f, 29.5529f, 0.5262f, 0.0406f },
+    { 0.2412f, -26.6417f, 29.8118f, 0.5171f, 0.0406f },
+    { -0.f, -26.5717f, 29.758f, 0.5146f, 0.0362f },
+    { -0.f, -26.5429f, 29.6758f, 0.5171f, 0.0351f },
+    { -0.f, -26.5964f, 29.8484f, 0.5118f, 0.0378f },
+    { -0.f, -26.5018f, 29.634f, 0.5195f, 0.0339f },
+    { 0.2529f, -26.671f, 29.9121f, 0.5147f, 0.0424f },
+    { -0.f, -26.6168f, 29.9459f, 0.509f, 0.0394f },
+    { -0.f, -26.6331f, 30.0491f, 0.506f, 0.0417f },
+    { 0.2582f, -26.6864f, 30.0191f, 0.5123f, 0.0443f },
+    { -0.f, -26.6434f, 30.1566f, 0.5029f, 0.0457f },
+    { 0.5387f, -26.7431f, 29.9757f, 0.5181f, 0.0475f },
+    { 0.2609f, -26.6954f, 30.1326f, 0.5103f, 0.0463f },
+    { 0.864f, -26.7255f, 29.9663f, 0.5228f, 0.052f },
+    { 0.5465f, -26.7533f, 30.1096f, 0.516f, 0.0495f },
+    { 1.1428f, -26.6279f, 29.7298f, 0.5302f, 0.0533f },
+    { 0.2648f, -26.7054f, 30.2521f, 0.509f, 0.0484f },
+    { 1.062f, -26.5957f, 29.5563f, 0.5324f, 0.0503f },
+    { 0.9738f, -26.5585f, 29.4265f, 0.5341f, 0.0478f },
+    { 0.6806f, -26.5703f, 29.4629f, 0.5305f, 0.0433f },
+    { 0.8945f, -26.5162f, 29.3513f, 0.5351f, 0.0458f },
+    { 0.854f, -26.4441f, 29.3296f, 0.5364f, 0.0442f },
+    { 0.4579f, -26.5181f, 29.5158f, 0.5282f, 0.0393f },
+    { 0.6641f, -26.4966f, 29.4325f, 0.5323f, 0.0418f },
+    { 0.2335f, -26.5132f, 29.5951f, 0.5238f, 0.0365f },
+    { 0.4726f, -26.4322f, 29.5556f, 0.5303f, 0.0376f },
+    { 0.239f, -26.4461f, 29.63f, 0.5257f, 0.0349f },
+    { -0.f, -26.4404f, 29.6647f, 0.5211f, 0.0321f },
+    { 0.6952f, -26.3788f, 29.4654f, 0.535f, 0.0402f },
+    { 0.4825f, -26.3479f, 29.5991f, 0.5323f, 0.0358f },
+    { 0.2404f, -26.381f, 29.6614f, 0.5276f, 0.0331f },
+    { -0.f, -26.3802f, 29.6862f, 0.5227f, 0.0303f },
+    { -0.f, -26.3427f, 29.6169f, 0.5261f, 0.0283f },
+    { 0.2321f, -26.3369f, 29.6099f, 0.5297f, 0.0314f },
+    { -0.f, -26.3422f, 29.5058f, 0.5295f, 0.0262f },
+    { 0.2282f, -26.3286f, 29.5147f, 0.5321f, 0.0298f },
+    { -0.f, -26.3933f, 29.4022f, 0.5323f, 0.0245f },
+    { 0.4693f, -26.2883f, 29.5729f, 0.534f, 0.0344f },
+    { 0.2427f, -26.371f, 29.4151f, 0.5348f, 0.0283f },
+    { -0.f, -26.4519f, 29.3008f, 0.5351f, 0.0227f },
+    { 0.4603f, -26.2667f, 29.5029f, 0.5357f, 0.0332f },
+    { 0.2621f, -26.4231f, 29.3105f, 0.5375f, 0.027f },
+    { -0.f, -26.4741f, 29.1968f, 0.5373f, 0.0218f },
+    { 0.4828f, -26.2966f, 29.4149f, 0.538f, 0.032f },
+    { 0.7002f, -26.1439f, 29.4258f, 0.541f, 0.0363f },
+    { 0.5148f, -26.3399f, 29.3117f, 0.5404f, 0.0308f },
+    { 0.7166f, -26.1774f, 29.4807f, 0.5395f, 0.0373f },
+    { 0.7179f, -26.1663f, 29.3596f, 0.5426f, 0.0352f },
+    { 0.9226f, -25.975f, 29.2959f, 0.5472f, 0.039f },
+    { 0.728f, -26.2585f, 29.5015f, 0.5377f, 0.0386f },
+    { 0.9468f, -26.016f, 29.3459f, 0.5458f, 0.04f },
+    { 0.8821f, -26.3178f, 29.3606f, 0.539f, 0.0425f },
+    { 0.991f, -26.1211f, 29.3556f, 0.5439f, 0.0417f },
+    { 1.0293f, -26.3559f, 29.1913f, 0.5408f, 0.0463f },
+    { 1.0084f, -26.281f, 29.2426f, 0.5418f, 0.0446f },
+    { 1.1937f, -26.2246f, 29.0538f, 0.5455f, 0.048f },
+    { 1.122f, -26.1541f, 29.1727f, 0.5455f, 0.0453f },
+    { 1.3503f, -26.0853f, 28.9123f, 0.5499f, 0.0497f },
+    { 1.2697f, -25.9924f, 29.0468f, 0.5502f, 0.0469f },
+    { 1.5175f, -25.9156f, 28.7778f, 0.5543f, 0.0517f },
+    { 1.1961f, -25.8933f, 29.175f, 0.5509f, 0.0441f },
+    { 1.4374f, -25.8014f, 28.9067f, 0.5553f, 0.049f },
+    { 1.7136f, -25.6932f, 28.6618f, 0.5591f, 0.0541f },
+    { 1.6107f, -25.5867f, 28.7944f, 0.5602f, 0.0512f },
+    { 1.9142f, -25.4598f, 28.5567f, 0.5638f, 0.0569f },
+    { 2.2195f, -25.288f, 28.3904f, 0.5674f, 0.0619f },
+    { 2.3808f, -25.0844f, 28.3017f, 0.5709f, 0.0646f },
+    { 2.0948f, -25.2572f, 28.4552f, 0.5676f, 0.0596f },
+    { 1.7782f, -25.369f, 28.7067f, 0.5647f, 0.0536f },
+    { 2.2894f, -25.0102f, 28.3329f, 0.5719f, 0.0633f },
+    { 1.9286f, -25.1689f, 28.6405f, 0.5686f, 0.0559f },
+    { 2.5028f, -24.8565f, 28.2571f, 0.5744f, 0.0671f },
+    { 2.4988f, -24.7374f, 28.2436f, 0.5761f, 0.0676f },
+    { 2.5757f, -24.3611f, 28.2059f, 0.5819f, 0.0703f },
+    { 2.4897f, -24.6137f, 28.2266f, 0.578f, 0.0681f },
+    { 2.3644f, -24.6784f, 28.3098f, 0.577f, 0.0654f },
+    { 2.4501f, -24.3625f, 28.2794f, 0.5819f, 0.0679f },
+    { 2.0689f, -24.9399f, 28.5889f, 0.5726f, 0.0584f },
+    { 2.2064f, -24.6352f, 28.545f, 0.5776f, 0.0613f },
+    { 2.5048f, -24.0789f, 28.2657f, 0.5863f, 0.0698f },
+    { 2.3138f, -24.3164f, 28.5076f, 0.5826f, 0.064f },
+    { 2.5435f, -23.8295f, 28.254f, 0.5903f, 0.0715f },
+    { 2.3635f, -24.045f, 28.4754f, 0.5869f, 0.0661f },
+    { 2.175f, -24.259f, 28.7573f, 0.5836f, 0.0598f },
+    { 2.0493f, -24.573f, 28.7704f, 0.5784f, 0.0572f },
+    { 2.0147f, -24.3921f, 28.8022f, 0.5816f, 0.0564f },
+    { 1.902f, -24.8488f, 28.799f, 0.5738f, 0.0544f },
+    { 1.9266f, -24.5808f, 28.8241f, 0.5784f, 0.0546f },
+    { 1.8066f, -24.8075f, 28.8446f, 0.5745f, 0.0523f },
+    { 1.7751f, -25.0733f, 28.8172f, 0.5698f, 0.0522f },
+    { 1.6887f, -25.0202f, 28.8561f, 0.5706f, 0.0504f },
+    { 1.6515f, -25.2733f, 28.8488f, 0.5659f, 0.0503f },
+    { 1.5666f, -25.2207f, 28.8787f, 0.5667f, 0.0485f },
+    { 1.5137f, -25.4757f, 28.9178f, 0.5615f, 0.0483f },
+    { 1.4343f, -25.4111f, 28.9322f, 0.5625f, 0.0465f },
+    { 1.3618f, -25.6818f, 29.026f, 0.5566f, 0.0462f },
+    { 1.2902f, -25.6051f, 29.029f, 0.5578f, 0.0445f },
+    { 1.1329f, -25.816f, 29.1811f, 0.552f, 0.0424f },
+    { 1.1024f, -25.7749f, 29.1257f, 0.5534f, 0.0413f },
+    { 1.2547f, -25.5692f, 28.9701f, 0.5591f, 0.0433f },
+    { 0.9363f, -25.9918f, 29.2456f, 0.5483f, 0.038f },
+    { 1.1267f, -25.7846f, 29.0696f, 0.5546f, 0.0403f },
+    { 1.3948f, -25.3835f, 28.8842f, 0.5635f, 0.0454f },
+    { 1.2875f, -25.5725f, 28.9037f, 0.5605f, 0.0424f },
+    { 1.5263f, -25.198f, 28.8415f, 0.5674f, 0.0474f },
+    { 1.4176f, -25.383f, 28.8202f, 0.5647f, 0.0445f },
+    { 1.6527f, -24.9932f, 28.8157f, 0.5713f, 0.0494f },
+    { 1.5332f, -25.1923f, 28.7826f, 0.5683f, 0.0466f },
+    { 1.763f, -24.7918f, 28.7985f, 0.5751f, 0.0513f },
+    { 1.6507f, -24.9761f, 28.7546f, 0.5723f, 0.0487f },
+    { 1.8463f, -24.6164f, 28.7816f, 0.5782f, 0.0529f },
+    { 1.7514f, -24.7772f, 28.7338f, 0.5759f, 0.0505f },
+    { 1.8167f, -24.6379f, 28.718f, 0.5784f, 0.0517f },
+    { 1.9105f, -24.4615f, 28.766f, 0.5808f, 0.0544f },
+    { 2.0371f, -24.2936f, 28.7861f, 0.5833f, 0.057f },
+    { 1.8672f, -24.5076f, 28.7037f, 0.5807f, 0.0529f },
+    { 1.915f, -24.3355f, 28.6039f, 0.5843f, 0.0538f },
+    { 1.8677f, -24.5254f, 28.6222f, 0.5813f, 0.0519f },
+    { 1.8247f, -24.6448f, 28.6326f, 0.5793f, 0.0507f },
+    { 1.8949f, -24.5103f, 28.5285f, 0.5826f, 0.0512f },
+    { 1.9355f, -24.324f, 28.5156f, 0.5855f, 0.0531f },
+    { 1.8575f, -24.6364f, 28.525f, 0.5807f, 0.0498f },
+    { 2.0021f, -24.1055f, 28.4553f, 0.5893f, 0.0552f },
+    { 1.9209f, -24.474f, 28.4577f, 0.5839f, 0.0509f },
+    { 1.9597f, -24.327f, 28.427f, 0.5864f, 0.0523f },
+    { 1.9063f, -24.5619f, 28.4201f, 0.583f, 0.0496f },
+    { 2.0254f, -24.1083f, 28.3566f, 0.5903f, 0.0543f },
+    { 1.9622f, -24.3707f, 28.3429f, 0.5867f, 0.0511f },
+    { 2.1351f, -23.8727f, 28.2048f, 0.5952f, 0.0562f },
+    { 2.0349f, -24.1182f, 28.2458f, 0.5912f, 0.0532f },
+    { 2.134f, -23.8602f, 28.0811f, 0.5964f, 0.0553f },
+    { 2.2342f, -23.5781f, 27.8974f, 0.6019f, 0.0578f },
+    { 2.0182f, -24.1213f, 28.1227f, 0.5923f, 0.0521f },
+    { 2.3102f, -23.253f, 27.7431f, 0.6074f, 0.0611f },
+    { 2.1076f, -23.8436f, 27.9508f, 0.5978f, 0.0543f },
+    { 2.1955f, -23.5503f, 27.7674f, 0.6033f, 0.0569f },
+    { 2.0496f, -23.8209f, 27.8189f, 0.5991f, 0.0531f },
+    { 2.1357f, -23.5254f, 27.6426f, 0.6045f, 0.0558f },
+    { 2.269f, -23.2115f, 27.6077f, 0.6089f, 0.0603f },
+    { 2.3891f, -22.909f, 27.6033f, 0.6127f, 0.065f },
+    { 2.2043f, -23.1764f, 27.4801f, 0.6103f, 0.0593f },
+    { 2.3472f, -22.8459f, 27.4564f, 0.6146f, 0.0643f },
+    { 2.2731f, -22.8043f, 27.316f, 0.6161f, 0.0632f },
+    { 2.4979f, -22.5701f, 27.4627f, 0.6178f, 0.0693f },
+    { 2.3601f, -22.4392f, 27.1351f, 0.6218f, 0.0671f },
+    { 2.4492f, -22.4725f, 27.2977f, 0.6202f, 0.0688f },
+    { 2.6122f, -22.4572f, 27.519f, 0.6185f, 0.0727f },
+    { 2.616f, -22.3225f, 27.4015f, 0.6211f, 0.0734f },
+    { 2.5737f, -22.5319f, 27.587f, 0.6168f, 0.072f },
+    { 2.6769f, -22.3628f, 27.5308f, 0.6195f, 0.0749f },
+    { 2.6247f, -22.4321f, 27.5596f, 0.6182f, 0.0738f },
+    { 2.5502f, -22.4765f, 27.5987f, 0.6169f, 0.0731f },
+    { 2.664f, -22.384f, 27.5948f, 0.6185f, 0.0753f },
+    { 2.7097f, -22.3441f, 27.5886f, 0.6192f, 0.0762f },
+    { 2.7167f, -22.3415f, 27.6764f, 0.6182f, 0.0774f },
+    { 2.7721f, -22.2841f, 27.6325f, 0.6196f, 0.0782f },
+    { 2.7791f, -22.3396f, 27.7794f, 0.6172f, 0.0795f },
+    { 2.8476f, -22.4131f, 27.8785f, 0.6153f, 0.0811f },
+    { 3.0482f, -22.3299f, 27.9888f, 0.616f, 0.0855f },
+    { 2.9363f, -22.2051f, 27.7879f, 0.6194f, 0.0828f },
+    { 3.2145f, -21.9928f, 27.992f, 0.621f, 0.0904f },
+    { 2.723f, -22.2524f, 27.4995f, 0.6211f, 0.0766f },
+    { 2.8181f, -22.0866f, 27.5068f, 0.6232f, 0.0798f },
+    { 2.603f, -22.0985f, 27.2038f, 0.6253f, 0.0743f },
+    { 3.0174f, -21.851f, 27.5941f, 0.6257f, 0.0854f },
+    { 2.4398f, -22.0845f, 26.9446f, 0.6275f, 0.0705f },
+    { 2.7492f, -21.7773f, 27.1419f, 0.6298f, 0.0788f },
+    { 3.5262f, -21.6759f, 28.3448f, 0.6227f, 0.1011f },
+    { 3.2261f, -21.5131f, 27.6676f, 0.6296f, 0.0917f },
+    { 3.6451f, -21.102f, 28.3296f, 0.63f, 0.1079f },
+    { 3.3496f, -21.0403f, 27.6334f, 0.6356f, 0.0972f },
+    { 3.7195f, -20.5347f, 28.2769f, 0.6371f, 0.1136f },
+    { 3.4302f, -20.461f, 27.569f, 0.6427f, 0.103f },
+    { 3.9236f, -20.5578f, 28.9314f, 0.632f, 0.1239f },
+    { 3.7632f, -19.9084f, 28.2133f, 0.6445f, 0.1195f },
+    { 4.053f, -20.545f, 29.6425f, 0.6258f, 0.1354f },
+    { 3.9806f, -19.9836f, 28.8438f, 0.6392f, 0.1289f },
+    { 4.1181f, -20.511f, 30.5204f, 0.6171f, 0.1498f },
+    { 4.1488f, -20.0083f, 29.5388f, 0.6331f, 0.1401f },
+    { 4.0945f, -20.4671f, 31.5076f, 0.6061f, 0.1658f },
+    { 4.2542f, -19.9615f, 30.3936f, 0.6252f, 0.1545f },
+    { 3.9948f, -20.1755f, 32.121f, 0.6007f, 0.1788f },
+    { 4.2682f, -19.8555f, 31.2373f, 0.6167f, 0.1695f },
+    { 3.8546f, -20.0498f, 32.6106f, 0.5944f, 0.1875f },
+    { 4.1622f, -19.7024f, 31.899f, 0.6091f, 0.1821f },
+    { 4.3628f, -19.1506f, 30.9469f, 0.6277f, 0.173f },
+    { 4.0114f, -19.5805f, 32.472f, 0.6014f, 0.1923f },
+    { 4.3229f, -19.281f, 30.1672f, 0.6349f, 0.1585f },
+    { 4.3082f, -19.0027f, 31.6117f, 0.6201f, 0.1861f },
+    { 4.3843f, -18.1502f, 30.6062f, 0.6414f, 0.1776f },
+    { 4.1925f, -18.8629f, 32.319f, 0.6102f, 0.1998f },
+    { 4.3354f, -18.3323f, 29.8948f, 0.6472f, 0.1635f },
+    { 4.4044f, -17.9617f, 31.22f, 0.6348f, 0.1907f },
+    { 4.3576f, -17.2036f, 30.262f, 0.6572f, 0.1832f },
+    { 4.4379f, -16.9627f, 30.8089f, 0.6513f, 0.1957f },
+    { 4.401f, -17.7299f, 31.7446f, 0.6281f, 0.203f },
+    { 4.5047f, -16.7226f, 31.2858f, 0.6455f, 0.2082f },
+    { 4.3794f, -17.4178f, 32.1882f, 0.6223f, 0.2144f },
+    { 4.5199f, -16.5086f, 31.7085f, 0.6382f, 0.2164f },
+    { 4.1704f, -18.2114f, 32.7062f, 0.6078f, 0.2145f },
+    { 4.3711f, -17.1106f, 32.5184f, 0.6178f, 0.2236f },
+    { 4.542f, -16.3313f, 32.0262f, 0.6309f, 0.2246f },
+    { 4.6299f, -16.2012f, 32.1879f, 0.63f, 0.2264f },
+    { 4.1335f, -17.7603f, 33.0026f, 0.6047f, 0.2253f },
+    { 4.4075f, -16.8939f, 32.7025f, 0.6154f, 0.2292f },
+    { 4.7541f, -16.1109f, 32.2436f, 0.6291f, 0.2283f },
+    { 3.9381f, -17.9771f, 33.4461f, 0.5943f, 0.2293f },
+    { 4.1221f, -17.4422f, 33.1924f, 0.6023f, 0.2326f },
+    { 4.4794f, -16.7582f, 32.7834f, 0.6143f, 0.2325f },
+    { 4.5777f, -16.6942f, 32.8039f, 0.6141f, 0.2344f },
+    { 4.885f, -16.0529f, 32.2431f, 0.6295f, 0.2289f },
+    { 4.154f, -17.2447f, 33.2936f, 0.6009f, 0.2372f },
+    { 4.6512f, -16.6991f, 32.739f, 0.6147f, 0.2359f },
+    { 4.9603f, -16.0408f, 32.18f, 0.63f, 0.2296f },
+    { 4.9177f, -16.0882f, 32.0479f, 0.6287f, 0.2319f },
+    { 4.6492f, -16.7697f, 32.5639f, 0.6157f, 0.2378f },
+    { 4.886f, -16.2396f, 31.7272f, 0.6275f, 0.2343f },
+    { 4.3574f, -17.1583f, 33.2464f, 0.6023f, 0.2411f },
+    { 4.247f, -17.1555f, 33.3242f, 0.6009f, 0.2396f },
+    { 4.2337f, -17.2868f, 33.5714f, 0.5949f, 0.2451f },
+    { 4.0707f, -17.2651f, 33.7019f, 0.592f, 0.2444f },
+    { 4.4414f, -17.2368f, 33.0224f, 0.605f, 0.2428f },
+    { 4.2139f, -17.1851f, 33.7663f, 0.5903f, 0.249f },
+    { 4.6512f, -16.9289f, 32.1767f, 0.6187f, 0.2401f },
+    { 4.994f, -16.5397f, 31.0982f, 0.6335f, 0.2367f },
+    { 4.4029f, -17.3891f, 33.2841f, 0.5993f, 0.246f },
+    { 4.5155f, -17.3952f, 32.5688f, 0.6102f, 0.2449f },
+    { 4.737f, -17.1995f, 31.4756f, 0.6254f, 0.243f },
+    { 5.1181f, -16.9117f, 30.3069f, 0.6396f, 0.2391f },
+    { 4.596f, -17.6377f, 31.8021f, 0.6187f, 0.2481f },
+    { 4.8107f, -17.5178f, 30.6085f, 0.6344f, 0.2458f },
+    { 4.7766f, -17.8204f, 29.7236f, 0.6447f, 0.248f },
+    { 5.1349f, -17.2792f, 29.4994f, 0.649f, 0.2411f },
+    { 4.6208f, -17.917f, 30.8667f, 0.6295f, 0.2513f },
+    { 4.6833f, -18.0926f, 28.8068f, 0.6557f, 0.2509f },
+    { 5.0713f, -17.6343f, 28.6446f, 0.6584f, 0.2431f },
+    { 4.9544f, -17.9692f, 27.7116f, 0.6695f, 0.2512f },
+    { 4.5797f, -18.3199f, 27.844f, 0.6666f, 0.256f },
+    { 4.89f, -18.2493f, 27.0119f, 0.6807f, 0.2592f },
+    { 4.4049f, -18.4093f, 28.937f, 0.6532f, 0.2562f },
+    { 4.528f, -18.186f, 29.9066f, 0.6413f, 0.2536f },
+    { 4.6533f, -18.0917f, 30.9994f, 0.6269f, 0.2541f },
+    { 4.5395f, -18.3745f, 29.9893f, 0.6395f, 0.2566f },
+    { 4.6447f, -17.8111f, 31.969f, 0.6153f, 0.2508f },
+    { 4.8093f, -18.1062f, 31.0485f, 0.6253f, 0.2559f },
+    { 4.5494f, -17.5659f, 32.7724f, 0.6058f, 0.2478f },
+    { 4.7849f, -17.8081f, 32.0371f, 0.6135f, 0.2525f },
+    { 4.661f, -17.5428f, 32.8633f, 0.6036f, 0.2498f },
+    { 4.4554f, -17.3284f, 33.4205f, 0.5961f, 0.2489f },
+    { 4.7583f, -17.4274f, 32.9172f, 0.6014f, 0.2523f },
+    { 4.5207f, -17.1564f, 33.5033f, 0.593f, 0.2526f },
+    { 4.2315f, -16.9534f, 33.8834f, 0.5861f, 0.2542f },
+    { 3.9827f, -17.1326f, 33.9585f, 0.5857f, 0.2495f },
+    { 4.2827f, -16.6512f, 33.9017f, 0.5825f, 0.2601f },
+    { 3.9523f, -17.3576f, 33.705f, 0.591f, 0.2424f },
+    { 3.917f, -16.8675f, 34.1153f, 0.5801f, 0.2557f },
+    { 3.8088f, -17.2283f, 34.0117f, 0.5833f, 0.2481f },
+    { 3.9173f, -17.5981f, 33.6099f, 0.5922f, 0.2373f },
+    { 3.7392f, -17.5295f, 33.9407f, 0.5841f, 0.2424f },
+    { 3.6577f, -16.9881f, 34.2079f, 0.5767f, 0.2543f },
+    { 3.7448f, -17.9764f, 33.8181f, 0.5859f, 0.2339f },
+    { 3.5343f, -17.4046f, 34.1702f, 0.5769f, 0.2472f },
+    { 3.8888f, -16.538f, 34.1563f, 0.5758f, 0.2623f },
+    { 3.4492f, -16.608f, 34.3396f, 0.5695f, 0.2624f },
+    { 4.3637f, -16.3381f, 33.8003f, 0.5802f, 0.2658f },
+    { 3.9135f, -16.2124f, 34.0656f, 0.573f, 0.2683f },
+    { 4.6112f, -16.8935f, 33.5138f, 0.5902f, 0.2574f },
+    { 4.7391f, -16.56f, 33.4335f, 0.5876f, 0.2633f },
+    { 4.8793f, -17.1986f, 32.927f, 0.599f, 0.2561f },
+    { 4.918f, -17.717f, 32.0673f, 0.6118f, 0.2546f },
+    { 5.0919f, -17.5006f, 32.0754f, 0.6094f, 0.258f },
+    { 4.9903f, -18.0252f, 31.0556f, 0.6237f, 0.2581f },
+    { 4.7168f, -18.4188f, 30.0043f, 0.6383f, 0.2587f },
+    { 5.2346f, -17.8044f, 31.0708f, 0.621f, 0.2614f },
+    { 4.4115f, -18.5984f, 28.9847f, 0.652f, 0.2593f },
+    { 4.9654f, -18.3515f, 29.9841f, 0.6368f, 0.2615f },
+    { 4.6092f, -18.6648f, 28.974f, 0.6513f, 0.2618f },
+    { 4.5885f, -18.7632f, 28.0273f, 0.6629f, 0.2657f },
+    { 4.9044f, -18.6135f, 28.9291f, 0.65f, 0.265f },
+    { 5.2929f, -18.1152f, 30.0249f, 0.6334f, 0.265f },
+    { 4.8681f, -18.7289f, 27.9668f, 0.6621f, 0.2692f },
+    { 5.3665f, -18.3419f, 28.8655f, 0.6465f, 0.2701f },
+    { 5.581f, -17.3998f, 31.1441f, 0.6161f, 0.2665f },
+    { 5.7069f, -17.6525f, 30.2226f, 0.6265f, 0.2697f },
+    { 5.3543f, -17.1214f, 32.0771f, 0.6056f, 0.2635f },
+    { 5.8276f, -16.9086f, 31.1497f, 0.611f, 0.2726f },
+    { 5.062f, -16.8354f, 32.8856f, 0.5959f, 0.2621f },
+    { 5.5427f, -16.649f, 31.9922f, 0.6016f, 0.2705f },
+    { 5.1985f, -16.3928f, 32.7384f, 0.5927f, 0.2694f },
+    { 4.8244f, -16.1846f, 33.2488f, 0.5852f, 0.27f },
+    { 4.4023f, -16.0188f, 33.6043f, 0.5782f, 0.2718f },
+    { 4.3268f, -15.698f, 33.3384f, 0.5757f, 0.2785f },
+    { 3.9142f, -15.8898f, 33.886f, 0.5708f, 0.2744f },
+    { 3.4641f, -16.1503f, 34.2403f, 0.5664f, 0.2707f },
+    { 3.8138f, -15.5693f, 33.6603f, 0.5678f, 0.2811f },
+    { 3.4416f, -15.8047f, 34.0818f, 0.5638f, 0.2771f },
+    { 3.0783f, -16.5702f, 34.442f, 0.5625f, 0.2649f },
+    { 3.0907f, -16.1192f, 34.3351f, 0.5605f, 0.2728f },
+    { 3.3012f, -17.283f, 34.3344f, 0.5705f, 0.2512f },
+    { 2.771f, -16.5512f, 34.5173f, 0.5568f, 0.2666f },
+    { 3.5135f, -17.9738f, 34.0879f, 0.5785f, 0.2372f },
+    { 3.0391f, -17.2248f, 34.4689f, 0.5644f, 0.2538f },
+    { 3.2643f, -17.9649f, 34.292f, 0.5718f, 0.2396f },
+    { 3.7963f, -18.509f, 33.7169f, 0.5866f, 0.2241f },
+    { 3.5621f, -18.5525f, 34.0468f, 0.5787f, 0.2272f },
+    { 3.9876f, -18.4853f, 33.2429f, 0.5961f, 0.2188f },
+    { 3.9953f, -19.0424f, 33.0831f, 0.596f, 0.2082f },
+    { 3.8224f, -19.0763f, 33.6329f, 0.5859f, 0.2142f },
+    { 3.8909f, -19.5682f, 33.0499f, 0.5923f, 0.2f },
+    { 3.7603f, -20.0485f, 33.09f, 0.5871f, 0.1936f },
+    { 3.7515f, -19.6268f, 33.5623f, 0.5832f, 0.2052f },
+    { 3.5992f, -19.1356f, 34.0095f, 0.5777f, 0.2174f },
+    { 3.6473f, -20.1284f, 33.5237f, 0.5794f, 0.1976f },
+    { 3.3082f, -18.5895f, 34.2857f, 0.5719f, 0.2291f },
+    { 3.5439f, -19.7177f, 33.9388f, 0.5752f, 0.208f },
+    { 3.3473f, -19.1917f, 34.276f, 0.5707f, 0.2192f },
+    { 3.0175f, -17.9453f, 34.4668f, 0.5656f, 0.2417f },
+    { 3.0579f, -18.5939f, 34.4867f, 0.5656f, 0.231f },
+    { 2.7611f, -17.2031f, 34.5806f, 0.5585f, 0.2555f },
+    { 2.7625f, -17.9263f, 34.6158f, 0.5596f, 0.2434f },
+    { 2.4796f, -16.5382f, 34.5859f, 0.5513f, 0.2679f },
+    { 2.4802f, -17.1912f, 34.6764f, 0.5527f, 0.2568f },
+    { 2.7697f, -16.1044f, 34.3917f, 0.5551f, 0.2745f },
+    { 2.1732f, -16.5257f, 34.6563f, 0.5454f, 0.2691f },
+    { 3.0661f, -15.7704f, 34.1796f, 0.5582f, 0.2792f },
+    { 2.4775f, -16.0911f, 34.4515f, 0.55f, 0.2758f },
+    { 2.7537f, -15.7601f, 34.2329f, 0.5534f, 0.2808f },
+    { 3.3393f, -15.4604f, 33.8903f, 0.5606f, 0.284f },
+    { 2.9948f, -15.4222f, 34.0069f, 0.5554f, 0.2858f },
+    { 2.7198f, -15.4161f, 34.0699f, 0.5513f, 0.287f },
+    { 3.7538f, -15.2702f, 33.4616f, 0.5656f, 0.2871f },
+    { 2.4701f, -15.7471f, 34.2951f, 0.5487f, 0.282f },
+    { 3.2482f, -15.0551f, 33.6761f, 0.5572f, 0.2919f },
+    { 2.9305f, -15.0568f, 33.79f, 0.5528f, 0.2929f },
+    { 2.6995f, -15.0514f, 33.8573f, 0.5495f, 0.2938f },
+    { 2.4538f, -15.4031f, 34.1389f, 0.5471f, 0.2881f },
+    { 2.7244f, -14.6453f, 33.5496f, 0.5481f, 0.3017f },
+    { 2.4524f, -15.0374f, 33.9311f, 0.5457f, 0.2947f },
+    { 2.927f, -14.6563f, 33.5019f, 0.551f, 0.3008f },
+    { 2.4902f, -14.6281f, 33.6199f, 0.5447f, 0.3025f },
+    { 2.7957f, -14.2524f, 33.1802f, 0.5479f, 0.3098f },
+    { 2.9837f, -14.2651f, 33.1563f, 0.5505f, 0.3088f },
+    { 2.172f, -15.016f, 34.0063f, 0.5412f, 0.2958f },
+    { 3.1597f, -14.6247f, 33.4585f, 0.554f, 0.3003f },
+    { 2.1665f, -15.3841f, 34.2115f, 0.5424f, 0.2892f },
+    { 2.1755f, -15.7299f, 34.3642f, 0.5436f, 0.2832f },
+    { 1.8277f, -15.3596f, 34.2852f, 0.5366f, 0.2904f },
+    { 2.1751f, -16.0759f, 34.5172f, 0.5445f, 0.277f },
+    { 1.8299f, -15.7073f, 34.4382f, 0.5375f, 0.2844f },
+    { 1.8234f, -16.0551f, 34.5917f, 0.538f, 0.2781f },
+    { 1.8207f, -16.5082f, 34.737f, 0.5386f, 0.2701f },
+    { 1.4494f, -16.0391f, 34.6719f, 0.531f, 0.279f },
+    { 1.4459f, -16.4948f, 34.821f, 0.5313f, 0.271f },
+    { 1.8346f, -17.1719f, 34.8655f, 0.5395f, 0.2589f },
+    { 1.4658f, -17.1641f, 34.9595f, 0.5321f, 0.2597f },
+    { 2.1776f, -17.183f, 34.7675f, 0.5465f, 0.2579f },
+    { 2.4891f, -17.9191f, 34.7423f, 0.5536f, 0.2447f },
+    { 2.7983f, -18.5871f, 34.6568f, 0.5595f, 0.2326f },
+    { 3.0883f, -19.2159f, 34.4956f, 0.5643f, 0.2209f },
+    { 3.0365f, -19.8566f, 34.4608f, 0.5615f, 0.2109f },
+    { 3.2961f, -19.8061f, 34.2236f, 0.5681f, 0.2095f },
+    { 3.1548f, -20.4553f, 34.1981f, 0.5633f, 0.2f },
+    { 3.4506f, -20.2465f, 33.876f, 0.5719f, 0.1997f },
+    { 3.1116f, -20.8534f, 34.1339f, 0.5612f, 0.1939f },
+    { 3.3738f, -20.6695f, 33.8624f, 0.5685f, 0.1937f },
+    { 3.5734f, -20.5491f, 33.5359f, 0.5755f, 0.1919f },
+    { -0.f, -26.6437f, 30.384f, 0.503f, 0.0499f },
+    { 0.2701f, -26.7084f, 30.3811f, 0.5081f, 0.0508f },
+    { -0.f, -26.6403f, 30.5132f, 0.503f, 0.0524f },
+    { -0.f, -26.6458f, 30.2667f, 0.503f, 0.0477f },
+    { -0.2648f, -26.68f, 30.252f, 0.4969f, 0.0502f },
+    { -0.2609f, -26.671f, 30.1324f, 0.4954f, 0.0484f },
+    { -0.2582f, -26.661f, 30.0186f, 0.4929f, 0.0471f },
+    { -0.f, -26.6331f, 30.0491f, 0.4993f, 0.0429f },
+    { -0.5465f, -26.716f, 30.1095f, 0.4893f, 0.053f },
+    { -0.2529f, -26.6453f, 29.9112f, 0.49f, 0.0461f },
+    { -0.f, -26.6168f, 29.9459f, 0.4955f, 0.0418f },
+    { -0.f, -26.5964f, 29.8484f, 0.4923f, 0.0412f },
+    { -0.5387f, -26.7044f, 29.975f, 0.4869f, 0.0516f },
+    { -0.5245f, -26.688f, 29.8492f, 0.4845f, 0.0504f },
+    { -0.2412f, -26.6194f, 29.8109f, 0.4873f, 0.0451f },
+    { -0.f, -26.5717f, 29.758f, 0.4891f, 0.0405f },
+    { -0.2309f, -26.5869f, 29.7186f, 0.4848f, 0.0443f },
+    { -0.f, -26.5429f, 29.6758f, 0.4866f, 0.04f },
+    { -0.4971f, -26.654f, 29.7351f, 0.4823f, 0.0491f },
+    { -0.8334f, -26.6765f, 29.8009f, 0.4794f, 0.055f },
+    { -0.4701f, -26.6103f, 29.6352f, 0.4803f, 0.048f },
+    { -0.8637f, -26.6975f, 29.9658f, 0.4819f, 0.0567f },
+    { -0.7823f, -26.6436f, 29.6571f, 0.4773f, 0.0532f },
+    { -1.1426f, -26.6202f, 29.7295f, 0.4745f, 0.0592f },
+    { -0.7261f, -26.6028f, 29.5418f, 0.4756f, 0.0516f },
+    { -1.0619f, -26.5899f, 29.556f, 0.4724f, 0.0569f },
+    { -1.1997f, -26.6452f, 29.9359f, 0.4771f, 0.0616f },
+    { -1.4148f, -26.5287f, 29.5979f, 0.4694f, 0.0623f },
+    { -0.8814f, -26.7158f, 30.1372f, 0.4845f, 0.0586f },
+    { -1.5131f, -26.552f, 29.8303f, 0.4718f, 0.0652f },
+    { -0.5547f, -26.7356f, 30.2496f, 0.4912f, 0.0548f },
+    { -1.2361f, -26.6679f, 30.1504f, 0.4799f, 0.064f },
+    { -0.895f, -26.7402f, 30.3006f, 0.4868f, 0.0606f },
+    { -0.2702f, -26.6837f, 30.381f, 0.4978f, 0.0524f },
+    { -0.5633f, -26.747f, 30.3978f, 0.4929f, 0.057f },
+    { -0.2773f, -26.6779f, 30.5231f, 0.4988f, 0.0549f },
+    { -0.3189f, -26.6706f, 30.6816f, 0.4995f, 0.0581f },
+    { -0.2449f, -26.6729f, 30.8849f, 0.5025f, 0.059f },
+    { -0.5721f, -26.7336f, 30.5567f, 0.4946f, 0.0596f },
+    { -0.9025f, -26.7519f, 30.4597f, 0.4889f, 0.0628f },
+    { -0.6004f, -26.7057f, 30.7197f, 0.4961f, 0.0626f },
+    { -1.2548f, -26.6916f, 30.348f, 0.4825f, 0.0664f },
+    { -0.9016f, -26.7319f, 30.618f, 0.4909f, 0.0651f },
+    { -1.2548f, -26.7009f, 30.5283f, 0.485f, 0.0686f },
+    { -1.5808f, -26.5698f, 30.0839f, 0.4746f, 0.0682f },
+    { -1.6029f, -26.5874f, 30.3345f, 0.4776f, 0.0709f },
+    { -0.9035f, -26.6972f, 30.7729f, 0.4929f, 0.0676f },
+    { -0.9192f, -26.665f, 30.9215f, 0.4947f, 0.0702f },
+    { -0.7274f, -26.6387f, 31.0129f, 0.4981f, 0.0695f },
+    { -0.6676f, -26.6736f, 30.8803f, 0.4972f, 0.066f },
+    { -0.5373f, -26.6619f, 31.0152f, 0.5f, 0.0672f },
+    { -0.4273f, -26.6701f, 30.86f, 0.4998f, 0.0624f },
+    { -0.3849f, -26.6867f, 31.0472f, 0.5018f, 0.065f },
+    { -1.8878f, -26.4445f, 29.9848f, 0.4693f, 0.0714f },
+    { -1.7897f, -26.436f, 29.6932f, 0.4666f, 0.068f },
+    { -2.1294f, -26.3152f, 29.9004f, 0.4652f, 0.0738f },
+    { -1.652f, -26.4175f, 29.4371f, 0.4645f, 0.0648f },
+    { -2.0151f, -26.3152f, 29.5689f, 0.4624f, 0.0703f },
+    { -1.856f, -26.302f, 29.2781f, 0.4602f, 0.0668f },
+    { -1.3008f, -26.4949f, 29.4109f, 0.4674f, 0.0597f },
+    { -1.5073f, -26.3767f, 29.2434f, 0.4627f, 0.062f },
+    { -0.9738f, -26.5544f, 29.4261f, 0.4708f, 0.0549f },
+    { -1.1881f, -26.455f, 29.2762f, 0.466f, 0.0576f },
+    { -0.6806f, -26.5582f, 29.4623f, 0.4742f, 0.0504f },
+    { -0.8946f, -26.5139f, 29.3505f, 0.4699f, 0.0533f },
+    { -0.4571f, -26.5647f, 29.552f, 0.4783f, 0.0472f },
+    { -0.4579f, -26.5047f, 29.5172f, 0.4763f, 0.0465f },
+    { -0.2295f, -26.5514f, 29.6355f, 0.4824f, 0.0437f },
+    { -0.f, -26.5018f, 29.634f, 0.4841f, 0.0396f },
+    { -0.2335f, -26.5039f, 29.5963f, 0.4803f, 0.043f },
+    { -0.239f, -26.4351f, 29.6358f, 0.4783f, 0.0419f },
+    { -0.f, -26.4404f, 29.6647f, 0.4823f, 0.0383f },
+    { -0.4726f, -26.4179f, 29.5626f, 0.4742f, 0.0452f },
+    { -0.2404f, -26.3679f, 29.671f, 0.4763f, 0.0405f },
+    { -0.f, -26.3802f, 29.6862f, 0.4805f, 0.0371f },
+    { -0.f, -26.3427f, 29.6169f, 0.4772f, 0.0358f },
+    { -0.4825f, -26.3326f, 29.6101f, 0.4722f, 0.0439f },
+    { -0.2321f, -26.3253f, 29.619f, 0.4742f, 0.0394f },
+    { -0.f, -26.3422f, 29.5058f, 0.4739f, 0.0345f },
+    { -0.2282f, -26.3205f, 29.521f, 0.4719f, 0.0384f },
+    { -0.f, -26.3933f, 29.4022f, 0.4712f, 0.0334f },
+    { -0.4693f, -26.2769f, 29.5818f, 0.4705f, 0.0429f },
+    { -0.2427f, -26.3669f, 29.4183f, 0.4693f, 0.0375f },
+    { -0.f, -26.4519f, 29.3008f, 0.4686f, 0.0322f },
+    { -0.4603f, -26.2617f, 29.5068f, 0.4689f, 0.0421f },
+    { -0.2622f, -26.4221f, 29.3113f, 0.4668f, 0.0367f },
+    { -0.f, -26.4741f, 29.1968f, 0.4666f, 0.0317f },
+    { -0.4829f, -26.2976f, 29.4141f, 0.4667f, 0.0414f },
+    { -0.7002f, -26.1639f, 29.4101f, 0.4643f, 0.0457f },
+    { -0.5148f, -26.345f, 29.3076f, 0.4643f, 0.0408f },
+    { -0.7166f, -26.1897f, 29.471f, 0.4657f, 0.0464f },
+    { -0.7179f, -26.1907f, 29.3404f, 0.4627f, 0.0451f },
+    { -0.9226f, -26.0171f, 29.2635f, 0.4588f, 0.0491f },
+    { -0.7484f, -26.232f, 29.2553f, 0.461f, 0.0444f },
+    { -0.9364f, -26.0354f, 29.2119f, 0.4577f, 0.0484f },
+    { -0.9468f, -26.051f, 29.3188f, 0.4601f, 0.0498f },
+    { -0.5339f, -26.3643f, 29.1912f, 0.4621f, 0.0401f },
+    { -0.728f, -26.2626f, 29.4975f, 0.4674f, 0.0473f },
+    { -0.6952f, -26.3768f, 29.4641f, 0.4699f, 0.0483f },
+    { -0.991f, -26.1481f, 29.3343f, 0.4617f, 0.051f },
+    { -0.6642f, -26.4896f, 29.432f, 0.4725f, 0.0494f },
+    { -0.8541f, -26.4465f, 29.3262f, 0.4686f, 0.0521f },
+    { -0.8822f, -26.3303f, 29.3501f, 0.4662f, 0.051f },
+    { -1.0934f, -26.4137f, 29.2008f, 0.4652f, 0.0559f },
+    { -1.0294f, -26.3635f, 29.1853f, 0.4646f, 0.0545f },
+    { -1.375f, -26.3278f, 29.1102f, 0.4614f, 0.0598f },
+    { -1.2742f, -26.2849f, 29.0359f, 0.4606f, 0.0582f },
+    { -1.6895f, -26.2537f, 29.0751f, 0.4585f, 0.0639f },
+    { -1.5406f, -26.196f, 28.9465f, 0.4573f, 0.0617f },
+    { -2.0419f, -26.1473f, 29.1336f, 0.4562f, 0.0688f },
+    { -1.8687f, -26.0952f, 28.9229f, 0.4545f, 0.066f },
+    { -1.7135f, -26.0336f, 28.7996f, 0.4534f, 0.0638f },
+    { -2.206f, -26.1567f, 29.454f, 0.4585f, 0.0723f },
+    { -1.434f, -26.1547f, 28.8788f, 0.4567f, 0.0602f },
+    { -1.1937f, -26.2376f, 29.0435f, 0.4603f, 0.0566f },
+    { -1.0084f, -26.2969f, 29.2301f, 0.4637f, 0.0532f },
+    { -1.1221f, -26.1755f, 29.1557f, 0.4602f, 0.0543f },
+    { -1.3503f, -26.1031f, 28.8977f, 0.4563f, 0.0587f },
+    { -1.2698f, -26.0144f, 29.0289f, 0.456f, 0.0563f },
+    { -1.1961f, -25.9192f, 29.1548f, 0.4554f, 0.0541f },
+    { -1.5176f, -25.9386f, 28.7662f, 0.4524f, 0.0609f },
+    { -1.1329f, -25.848f, 29.1576f, 0.4544f, 0.0528f },
+    { -1.4374f, -25.8218f, 28.8936f, 0.4514f, 0.0588f },
+    { -1.3619f, -25.6991f, 29.0139f, 0.4502f, 0.0567f },
+    { -1.7138f, -25.7226f, 28.6674f, 0.4482f, 0.0636f },
+    { -1.6107f, -25.606f, 28.7936f, 0.447f, 0.0613f },
+    { -1.2902f, -25.6243f, 29.0179f, 0.4492f, 0.0554f },
+    { -1.5137f, -25.4869f, 28.9142f, 0.4458f, 0.0592f },
+    { -1.1024f, -25.8116f, 29.0997f, 0.4532f, 0.052f },
+    { -1.2547f, -25.5909f, 28.9595f, 0.4481f, 0.0546f },
+    { -1.1267f, -25.8206f, 29.0432f, 0.4521f, 0.0514f },
+    { -0.9662f, -26.0714f, 29.1494f, 0.4566f, 0.0477f },
+    { -1.2876f, -25.5919f, 28.8927f, 0.4469f, 0.054f },
+    { -0.7699f, -26.2494f, 29.148f, 0.459f, 0.0438f },
+    { -1.1718f, -25.8514f, 28.985f, 0.451f, 0.0508f },
+    { -0.9902f, -26.0909f, 29.0614f, 0.4551f, 0.0471f },
+    { -0.7827f, -26.2485f, 29.0218f, 0.4569f, 0.0432f },
+    { -1.2035f, -25.8805f, 28.9218f, 0.4501f, 0.0501f },
+    { -0.5443f, -26.3643f, 29.0652f, 0.4599f, 0.0396f },
+    { -1.0045f, -26.0928f, 28.9457f, 0.4533f, 0.0464f },
+    { -0.7868f, -26.2346f, 28.8796f, 0.4547f, 0.0425f },
+    { -1.0054f, -26.0764f, 28.7996f, 0.4511f, 0.0456f },
+    { -1.2191f, -25.8799f, 28.6871f, 0.4469f, 0.0485f },
+    { -0.5504f, -26.3539f, 28.93f, 0.4576f, 0.039f },
+    { -0.9854f, -26.0494f, 28.6322f, 0.4488f, 0.0447f },
+    { -0.2789f, -26.4432f, 29.0826f, 0.4623f, 0.0355f },
+    { -0.7758f, -26.2107f, 28.7249f, 0.4523f, 0.0417f },
+    { -0.283f, -26.4335f, 28.9536f, 0.4599f, 0.035f },
+    { -0.5455f, -26.3319f, 28.7878f, 0.4552f, 0.0384f },
+    { -0.f, -26.4734f, 29.0847f, 0.4646f, 0.0312f },
+    { -0.f, -26.4634f, 28.9588f, 0.462f, 0.0307f },
+    { -0.2731f, -26.4434f, 29.2006f, 0.4645f, 0.036f },
+    { -0.2812f, -26.4091f, 28.8185f, 0.4574f, 0.0345f },
+    { -0.f, -26.4367f, 28.8258f, 0.4594f, 0.0303f },
+    { -0.2697f, -26.3647f, 28.6818f, 0.4549f, 0.034f },
+    { -0.f, -26.3857f, 28.6925f, 0.4566f, 0.0301f },
+    { -0.5229f, -26.2974f, 28.6409f, 0.4528f, 0.0376f },
+    { -0.2492f, -26.2998f, 28.5421f, 0.4523f, 0.0335f },
+    { -0.f, -26.3135f, 28.5533f, 0.4539f, 0.0299f },
+    { -0.4806f, -26.2446f, 28.4954f, 0.4505f, 0.0367f },
+    { -0.2203f, -26.2142f, 28.3982f, 0.4495f, 0.033f },
+    { -0.f, -26.2229f, 28.4027f, 0.4504f, 0.0299f },
+    { -0.4168f, -26.1679f, 28.3573f, 0.448f, 0.0357f },
+    { -0.2028f, -26.1119f, 28.2492f, 0.4465f, 0.0328f },
+    { -0.f, -26.1185f, 28.2452f, 0.4469f, 0.0299f },
+    { -0.3469f, -26.0968f, 28.2504f, 0.4461f, 0.0348f },
+    { -0.4114f, -26.0069f, 28.1432f, 0.4438f, 0.0357f },
+    { -0.216f, -25.9972f, 28.0943f, 0.4434f, 0.033f },
+    { -0.f, -26.0043f, 28.085f, 0.4436f, 0.0301f },
+    { -0.5657f, -26.0641f, 28.2528f, 0.4454f, 0.0378f },
+    { -0.4767f, -25.8711f, 28.001f, 0.4407f, 0.0368f },
+    { -0.245f, -25.864f, 27.9444f, 0.4402f, 0.0337f },
+    { -0.f, -25.8702f, 27.9308f, 0.4402f, 0.0303f },
+    { -0.2744f, -25.706f, 27.81f, 0.4369f, 0.0345f },
+    { -0.f, -25.7061f, 27.7912f, 0.4366f, 0.0309f },
+    { -0.5384f, -25.7149f, 27.8718f, 0.4375f, 0.0379f },
+    { -0.3045f, -25.5209f, 27.69f, 0.4336f, 0.0354f },
+    { -0.f, -25.511f, 27.666f, 0.433f, 0.0314f },
+    { -0.5967f, -25.5348f, 27.7548f, 0.4344f, 0.0392f },
+    { -0.3352f, -25.3062f, 27.5832f, 0.43f, 0.0366f },
+    { -0.f, -25.2842f, 27.5552f, 0.429f, 0.0324f },
+    { -0.6518f, -25.3271f, 27.6491f, 0.431f, 0.0406f },
+    { -0.3594f, -25.0651f, 27.4912f, 0.4263f, 0.0379f },
+    { -0.f, -25.0334f, 27.4606f, 0.425f, 0.0334f },
+    { -0.6962f, -25.094f, 27.5601f, 0.4275f, 0.0421f },
+    { -0.37f, -24.8005f, 27.416f, 0.4224f, 0.0393f },
+    { -0.f, -24.7666f, 27.3845f, 0.4209f, 0.0347f },
+    { -0.7223f, -24.8377f, 27.4929f, 0.4238f, 0.0437f },
+    { -0.3779f, -24.5109f, 27.3348f, 0.4182f, 0.0408f },
+    { -0.f, -24.4781f, 27.3059f, 0.4169f, 0.0361f },
+    { -0.7455f, -24.5551f, 27.4167f, 0.4198f, 0.0454f },
+    { -0.3939f, -24.1947f, 27.225f, 0.4137f, 0.0426f },
+    { -0.f, -24.1626f, 27.2041f, 0.4122f, 0.0377f },
+    { -0.7814f, -24.2432f, 27.3008f, 0.4153f, 0.0474f },
+    { -0.4187f, -23.8782f, 27.1093f, 0.4092f, 0.0445f },
+    { -0.f, -23.8474f, 27.0958f, 0.4074f, 0.0394f },
+    { -0.8288f, -23.9282f, 27.1748f, 0.4107f, 0.0496f },
+    { -0.4526f, -23.5877f, 27.0102f, 0.4052f, 0.0464f },
+    { -0.f, -23.5595f, 26.9978f, 0.4038f, 0.0407f },
+    { -0.8864f, -23.6366f, 27.0685f, 0.4067f, 0.0518f },
+    { -0.4793f, -23.2891f, 26.9022f, 0.4012f, 0.0482f },
+    { -0.f, -23.2635f, 26.8857f, 0.4002f, 0.0421f },
+    { -0.9306f, -23.3361f, 26.9592f, 0.4025f, 0.0539f },
+    { -0.4822f, -22.9482f, 26.7598f, 0.3966f, 0.0499f },
+    { -0.f, -22.9238f, 26.7353f, 0.3954f, 0.0437f },
+    { -0.9378f, -22.9944f, 26.8244f, 0.3979f, 0.0557f },
+    { -0.4765f, -22.6062f, 26.5961f, 0.3919f, 0.0516f },
+    { -0.f, -22.5803f, 26.5663f, 0.3905f, 0.0454f },
+    { -0.9323f, -22.6561f, 26.6668f, 0.3931f, 0.0574f },
+    { -0.4768f, -22.3043f, 26.424f, 0.3877f, 0.0536f },
+    { -0.f, -22.2731f, 26.3985f, 0.3867f, 0.0475f },
+    { -0.9384f, -22.3658f, 26.4893f, 0.3889f, 0.0594f },
+    { -0.4763f, -22.0043f, 26.2335f, 0.3835f, 0.0553f },
+    { -0.f, -21.9691f, 26.2133f, 0.3829f, 0.0497f },
+    { -0.f, -21.6351f, 25.9922f, 0.3782f, 0.0501f },
+    { -0.9405f, -22.0764f, 26.291f, 0.3845f, 0.061f },
+    { -0.4681f, -21.6679f, 26.0141f, 0.3787f, 0.0561f },
+    { -0.f, -21.3067f, 25.7702f, 0.3735f, 0.0506f },
+    { -1.3698f, -22.4248f, 26.5826f, 0.3901f, 0.0646f },
+    { -0.4489f, -21.3306f, 25.7949f, 0.3739f, 0.0563f },
+    { -0.923f, -21.7412f, 26.071f, 0.3795f, 0.0617f },
+    { -1.3807f, -22.1508f, 26.3826f, 0.3858f, 0.066f },
+    { -0.8945f, -21.394f, 25.8585f, 0.3744f, 0.0618f },
+    { -1.3515f, -21.8284f, 26.1536f, 0.3808f, 0.0665f },
+    { -0.4154f, -21.0278f, 25.6046f, 0.3696f, 0.0559f },
+    { -0.f, -21.0193f, 25.5823f, 0.3701f, 0.0506f },
+    { -0.8637f, -21.0686f, 25.6829f, 0.3698f, 0.0617f },
+    { -0.3969f, -20.7551f, 25.3668f, 0.3651f, 0.0552f },
+    { 0.0002f, -20.7652f, 25.349f, 0.3667f, 0.0506f },
+    { -0.8603f, -20.7568f, 25.4569f, 0.3648f, 0.0613f },
+    { -0.4226f, -20.5082f, 25.0054f, 0.3596f, 0.054f },
+    { 0.001f, -20.5368f, 24.991f, 0.3614f, 0.0486f },
+    { 0.0018f, -20.2803f, 24.532f, 0.3561f, 0.0467f },
+    { -0.4539f, -20.2364f, 24.5469f, 0.3537f, 0.0527f },
+    { -0.9142f, -20.4504f, 25.0935f, 0.3585f, 0.0606f },
+    { -1.457f, -20.7957f, 25.6544f, 0.3658f, 0.0694f },
+    { -1.3777f, -21.1523f, 25.8277f, 0.3711f, 0.0682f },
+    { -1.8081f, -21.345f, 26.04f, 0.3744f, 0.0734f },
+    { -1.3334f, -21.486f, 25.9503f, 0.3756f, 0.0669f },
+    { -2.0055f, -21.7132f, 26.3208f, 0.3804f, 0.0752f },
+    { -1.6358f, -21.5574f, 26.0702f, 0.3771f, 0.0705f },
+    { -1.7227f, -21.8466f, 26.2432f, 0.3815f, 0.0709f },
+    { -2.0495f, -22.1259f, 26.6064f, 0.3871f, 0.0748f },
+    { -1.762f, -22.1824f, 26.493f, 0.3869f, 0.0706f },
+    { -2.2223f, -22.4316f, 26.9802f, 0.3931f, 0.0765f },
+    { -2.02f, -22.4522f, 26.8329f, 0.3922f, 0.0732f },
+    { -1.7406f, -22.4606f, 26.6989f, 0.3914f, 0.0692f },
+    { -1.9623f, -22.7592f, 27.0217f, 0.3969f, 0.0709f },
+    { -1.6978f, -22.74f, 26.8772f, 0.3956f, 0.0672f },
+    { -1.3469f, -22.7032f, 26.7597f, 0.3944f, 0.0627f },
+    { -1.3399f, -23.039f, 26.9201f, 0.3992f, 0.0608f },
+    { -1.673f, -23.0796f, 27.0442f, 0.4005f, 0.065f },
+    { -1.9215f, -23.1142f, 27.194f, 0.402f, 0.0683f },
+    { -1.6483f, -23.4242f, 27.202f, 0.4055f, 0.0628f },
+    { -1.3261f, -23.3812f, 27.0643f, 0.404f, 0.0588f },
+    { -1.8796f, -23.4646f, 27.3571f, 0.407f, 0.0657f },
+    { -1.2827f, -23.6791f, 27.1926f, 0.4082f, 0.0567f },
+    { -1.6054f, -23.7185f, 27.3524f, 0.4098f, 0.0607f },
+    { -1.222f, -23.9685f, 27.3184f, 0.4124f, 0.0545f },
+    { -1.5457f, -24.0043f, 27.4985f, 0.4142f, 0.0586f },
+    { -1.1561f, -24.2852f, 27.4551f, 0.4171f, 0.0521f },
+    { -1.4703f, -24.3232f, 27.6429f, 0.4189f, 0.0561f },
+    { -1.0927f, -24.5937f, 27.5697f, 0.4216f, 0.0498f },
+    { -1.388f, -24.6307f, 27.756f, 0.4234f, 0.0536f },
+    { -1.0392f, -24.8582f, 27.629f, 0.4252f, 0.0477f },
+    { -1.3073f, -24.8822f, 27.8077f, 0.4268f, 0.0513f },
+    { -0.988f, -25.0988f, 27.6777f, 0.4285f, 0.0459f },
+    { -1.2321f, -25.1111f, 27.8461f, 0.4299f, 0.0492f },
+    { -0.9315f, -25.3356f, 27.7605f, 0.432f, 0.0442f },
+    { -1.1664f, -25.3503f, 27.9191f, 0.4334f, 0.0474f },
+    { -0.8644f, -25.5568f, 27.8674f, 0.4355f, 0.0426f },
+    { -1.0894f, -25.5836f, 28.0206f, 0.437f, 0.0456f },
+    { -0.7815f, -25.7509f, 27.9884f, 0.4389f, 0.041f },
+    { -0.9805f, -25.7945f, 28.1446f, 0.4406f, 0.0437f },
+    { -0.6822f, -25.9195f, 28.1185f, 0.4422f, 0.0395f },
+    { -0.8421f, -25.9791f, 28.276f, 0.4442f, 0.0417f },
+    { -0.6769f, -26.1334f, 28.3998f, 0.4476f, 0.0394f },
+    { -0.743f, -26.1796f, 28.5611f, 0.45f, 0.0407f },
+    { -0.937f, -26.0197f, 28.4524f, 0.4465f, 0.0434f },
+    { -1.1119f, -25.8259f, 28.3252f, 0.4426f, 0.0458f },
+    { -1.1876f, -25.8521f, 28.5121f, 0.4447f, 0.0474f },
+    { -1.2538f, -25.6116f, 28.2074f, 0.4388f, 0.0481f },
+    { -1.3487f, -25.3899f, 28.1268f, 0.4354f, 0.0501f },
+    { -1.3573f, -25.6399f, 28.4027f, 0.4407f, 0.0499f },
+    { -1.4255f, -25.1624f, 28.0672f, 0.4322f, 0.052f },
+    { -1.4693f, -25.4338f, 28.342f, 0.4376f, 0.0522f },
+    { -1.3997f, -25.6675f, 28.5819f, 0.4428f, 0.0512f },
+    { -1.5565f, -25.2182f, 28.2909f, 0.4347f, 0.0542f },
+    { -1.2199f, -25.8944f, 28.8304f, 0.4488f, 0.0494f },
+    { -1.5189f, -25.4613f, 28.5233f, 0.4396f, 0.0535f },
+    { -1.4015f, -25.6774f, 28.7187f, 0.4444f, 0.0521f },
+    { -1.3831f, -25.6525f, 28.7873f, 0.4452f, 0.0528f },
+    { -1.5218f, -25.4659f, 28.6536f, 0.441f, 0.0545f },
+    { -1.345f, -25.6162f, 28.8308f, 0.4458f, 0.0535f },
+    { -1.5023f, -25.4411f, 28.7158f, 0.4417f, 0.0553f },
+    { -1.4658f, -25.4098f, 28.7555f, 0.4421f, 0.0559f },
+    { -1.4177f, -25.3947f, 28.8186f, 0.4431f, 0.0564f },
+    { -1.5647f, -25.2049f, 28.7187f, 0.4391f, 0.0582f },
+    { -1.3949f, -25.3984f, 28.8839f, 0.4442f, 0.057f },
+    { -1.5333f, -25.2013f, 28.7859f, 0.44f, 0.0587f },
+    { -1.5264f, -25.2109f, 28.847f, 0.4408f, 0.0593f },
+    { -1.4343f, -25.4234f, 28.93f, 0.4449f, 0.0578f },
+    { -1.5667f, -25.2298f, 28.8818f, 0.4413f, 0.0601f },
+    { -1.6515f, -25.2811f, 28.8517f, 0.4419f, 0.0614f },
+    { -1.7783f, -25.3877f, 28.7181f, 0.4431f, 0.0638f },
+    { -1.7751f, -25.0798f, 28.8223f, 0.4385f, 0.0635f },
+    { -1.9144f, -25.4951f, 28.5807f, 0.4442f, 0.0663f },
+    { -1.9286f, -25.188f, 28.656f, 0.4397f, 0.0662f },
+    { -2.0949f, -25.2958f, 28.4859f, 0.4408f, 0.069f },
+    { -2.0274f, -25.5484f, 28.5396f, 0.4447f, 0.068f },
+    { -2.2198f, -25.3469f, 28.4356f, 0.4414f, 0.0708f },
+    { -1.8113f, -25.7789f, 28.6347f, 0.4487f, 0.0651f },
+    { -2.3261f, -25.3704f, 28.4878f, 0.4418f, 0.0722f },
+    { -1.603f, -25.9953f, 28.7411f, 0.4529f, 0.0624f },
+    { -1.9224f, -25.8149f, 28.6841f, 0.4492f, 0.0665f },
+    { -2.1368f, -25.5803f, 28.5852f, 0.4452f, 0.0694f },
+    { -2.0665f, -25.8709f, 28.8038f, 0.4502f, 0.0685f },
+    { -2.2248f, -25.9181f, 29.0164f, 0.452f, 0.0711f },
+    { -2.2625f, -25.6234f, 28.7078f, 0.4462f, 0.0713f },
+    { -2.4363f, -25.3953f, 28.6252f, 0.4428f, 0.0739f },
+    { -2.3964f, -25.6569f, 28.9269f, 0.4479f, 0.0737f },
+    { -2.5485f, -25.4058f, 28.8653f, 0.4444f, 0.0764f },
+    { -2.3786f, -25.9278f, 29.3446f, 0.4543f, 0.0745f },
+    { -2.5308f, -25.6603f, 29.2615f, 0.4503f, 0.077f },
+    { -2.3235f, -26.1518f, 29.8178f, 0.4614f, 0.0759f },
+    { -2.4883f, -25.9242f, 29.7242f, 0.4573f, 0.0781f },
+    { -2.357f, -26.1605f, 30.1591f, 0.4647f, 0.0789f },
+    { -2.6745f, -25.1081f, 28.8226f, 0.4405f, 0.0794f },
+    { -2.583f, -25.1154f, 28.5539f, 0.4389f, 0.0768f },
+    { -2.4837f, -25.1168f, 28.4006f, 0.4382f, 0.075f },
+    { -2.6033f, -24.7507f, 28.3321f, 0.4335f, 0.0782f },
+    { -2.3809f, -25.1313f, 28.3442f, 0.4382f, 0.0735f },
+    { -2.6715f, -24.3319f, 28.2598f, 0.4281f, 0.0811f },
+    { -2.5028f, -24.8584f, 28.2867f, 0.4346f, 0.0762f },
+    { -2.4988f, -24.7009f, 28.2594f, 0.4326f, 0.077f },
+    { -2.2875f, -25.0235f, 28.3657f, 0.4368f, 0.0725f },
+    { -2.4897f, -24.5473f, 28.2351f, 0.4307f, 0.0777f },
+    { -2.5757f, -24.2549f, 28.2081f, 0.4269f, 0.0802f },
+    { -2.3945f, -24.6152f, 28.2939f, 0.4315f, 0.0759f },
+    { -2.0472f, -24.9781f, 28.633f, 0.4365f, 0.0682f },
+    { -2.2401f, -24.6476f, 28.5616f, 0.4319f, 0.0719f },
+    { -2.3268f, -24.5264f, 28.4404f, 0.4303f, 0.0743f },
+    { -2.1198f, -24.7291f, 28.6743f, 0.4331f, 0.0695f },
+    { -2.3438f, -24.2343f, 28.483f, 0.4267f, 0.0755f },
+    { -2.191f, -24.2556f, 28.7563f, 0.4269f, 0.0715f },
+    { -2.0276f, -24.5874f, 28.8035f, 0.4313f, 0.0681f },
+    { -1.8965f, -24.8573f, 28.8112f, 0.4351f, 0.0657f },
+    { -1.6887f, -25.0277f, 28.8611f, 0.4379f, 0.0622f },
+    { -1.8066f, -24.8115f, 28.849f, 0.4345f, 0.0643f },
+    { -1.6527f, -25.0046f, 28.8232f, 0.4374f, 0.0615f },
+    { -1.9266f, -24.5757f, 28.8269f, 0.4311f, 0.0666f },
+    { -1.7631f, -24.8003f, 28.8051f, 0.4341f, 0.0636f },
+    { -1.6507f, -24.9838f, 28.7596f, 0.4365f, 0.061f },
+    { -1.6722f, -24.9743f, 28.68f, 0.4356f, 0.0605f },
+    { -1.7515f, -24.7833f, 28.7382f, 0.4334f, 0.063f },
+    { -1.5979f, -25.2257f, 28.6655f, 0.4385f, 0.0576f },
+    { -1.7066f, -24.9853f, 28.5945f, 0.4347f, 0.0597f },
+    { -1.6187f, -25.2449f, 28.5927f, 0.4378f, 0.0567f },
+    { -1.6128f, -25.244f, 28.4669f, 0.4365f, 0.0557f },
+    { -1.7175f, -24.9984f, 28.368f, 0.4326f, 0.0577f },
+    { -1.6514f, -24.9773f, 28.2101f, 0.431f, 0.0562f },
+    { -1.513f, -24.9303f, 28.0123f, 0.429f, 0.0541f },
+    { -1.6002f, -24.6704f, 27.9378f, 0.4252f, 0.0564f },
+    { -1.7394f, -24.7037f, 28.1049f, 0.4269f, 0.0583f },
+    { -1.6763f, -24.3593f, 27.8191f, 0.4206f, 0.0588f },
+    { -1.7471f, -24.0407f, 27.6734f, 0.4159f, 0.0612f },
+    { -1.8059f, -24.3898f, 27.9807f, 0.4222f, 0.0606f },
+    { -1.8158f, -24.7215f, 28.2472f, 0.4281f, 0.0598f },
+    { -1.8709f, -24.0733f, 27.8382f, 0.4174f, 0.063f },
+    { -1.7297f, -24.9991f, 28.4936f, 0.4338f, 0.0588f },
+    { -1.8907f, -24.4106f, 28.1252f, 0.4234f, 0.0621f },
+    { -1.854f, -24.7155f, 28.3811f, 0.4291f, 0.061f },
+    { -1.802f, -24.7711f, 28.5365f, 0.4313f, 0.0616f },
+    { -1.7663f, -24.7703f, 28.6485f, 0.4324f, 0.0624f },
+    { -1.8575f, -24.6341f, 28.525f, 0.4294f, 0.063f },
+    { -1.8248f, -24.6451f, 28.6333f, 0.4306f, 0.0636f },
+    { -1.8167f, -24.6408f, 28.7206f, 0.4313f, 0.0643f },
+    { -1.8676f, -24.5236f, 28.6224f, 0.4289f, 0.0648f },
+    { -1.8464f, -24.6186f, 28.7856f, 0.4315f, 0.0653f },
+    { -1.8672f, -24.5058f, 28.7043f, 0.4294f, 0.0656f },
+    { -1.8948f, -24.5046f, 28.5286f, 0.4278f, 0.0643f },
+    { -1.9148f, -24.3305f, 28.6039f, 0.4264f, 0.0666f },
+    { -1.9206f, -24.4636f, 28.4578f, 0.4267f, 0.0643f },
+    { -1.935f, -24.3124f, 28.5157f, 0.4254f, 0.0662f },
+    { -1.9061f, -24.5551f, 28.4201f, 0.4275f, 0.063f },
+    { -1.9589f, -24.3088f, 28.4273f, 0.4246f, 0.0657f },
+    { -1.9614f, -24.3552f, 28.3431f, 0.4244f, 0.0646f },
+    { -1.9396f, -24.4047f, 28.2477f, 0.4243f, 0.0633f },
+    { -2.0235f, -24.0824f, 28.3573f, 0.4214f, 0.0677f },
+    { -1.9618f, -24.0979f, 27.9877f, 0.4187f, 0.0644f },
+    { -2.0331f, -24.0955f, 28.2465f, 0.4206f, 0.0668f },
+    { -2.0168f, -24.1076f, 28.1233f, 0.4198f, 0.0657f },
+    { -1.9546f, -23.7921f, 27.6779f, 0.413f, 0.0652f },
+    { -2.0487f, -23.8157f, 27.8199f, 0.4142f, 0.0666f },
+    { -1.8181f, -23.7579f, 27.5182f, 0.4115f, 0.0634f },
+    { -2.0363f, -23.4986f, 27.5107f, 0.4084f, 0.0677f },
+    { -2.0952f, -23.1451f, 27.347f, 0.4034f, 0.0706f },
+    { -2.1348f, -23.5219f, 27.6437f, 0.4096f, 0.0691f },
+    { -2.1508f, -22.775f, 27.1743f, 0.3981f, 0.0736f },
+    { -2.2037f, -23.1747f, 27.4808f, 0.4047f, 0.0721f },
+    { -2.2734f, -22.8018f, 27.3165f, 0.3995f, 0.0755f },
+    { -2.347f, -22.8441f, 27.4567f, 0.401f, 0.0766f },
+    { -2.2678f, -23.2063f, 27.6089f, 0.406f, 0.0731f },
+    { -2.4979f, -22.5701f, 27.4627f, 0.3983f, 0.081f },
+    { -2.3886f, -22.9065f, 27.6036f, 0.4028f, 0.0772f },
+    { -2.1935f, -23.5404f, 27.7691f, 0.4107f, 0.0701f },
+    { -2.3081f, -23.243f, 27.7446f, 0.4074f, 0.0738f },
+    { -2.1057f, -23.8302f, 27.9522f, 0.4153f, 0.0678f },
+    { -2.2309f, -23.5598f, 27.8996f, 0.4119f, 0.071f },
+    { -2.1311f, -23.8372f, 28.0828f, 0.4164f, 0.0688f },
+    { -2.1317f, -23.8458f, 28.2065f, 0.4175f, 0.0696f },
+    { -2.245f, -23.5833f, 28.0281f, 0.4131f, 0.0717f },
+    { -2.0008f, -24.089f, 28.4557f, 0.4223f, 0.0683f },
+    { -2.1145f, -23.8653f, 28.318f, 0.4186f, 0.0701f },
+    { -1.9834f, -24.102f, 28.5468f, 0.4232f, 0.0687f },
+    { -2.2339f, -23.6143f, 28.1476f, 0.4144f, 0.0721f },
+    { -1.9233f, -24.3274f, 28.687f, 0.427f, 0.0673f },
+    { -2.0905f, -23.8745f, 28.4204f, 0.4196f, 0.0706f },
+    { -1.9898f, -24.1086f, 28.6356f, 0.424f, 0.0694f },
+    { -1.9105f, -24.4555f, 28.767f, 0.4292f, 0.0668f },
+    { -1.9633f, -24.307f, 28.752f, 0.4272f, 0.0682f },
+    { -2.0147f, -24.3772f, 28.803f, 0.4284f, 0.0685f },
+    { -2.0371f, -24.2732f, 28.7856f, 0.427f, 0.0692f },
+    { -2.102f, -24.1293f, 28.762f, 0.4251f, 0.0709f },
+    { -2.027f, -24.1153f, 28.711f, 0.4246f, 0.0701f },
+    { -2.2337f, -23.9513f, 28.6695f, 0.4231f, 0.0742f },
+    { -2.071f, -23.8521f, 28.5169f, 0.4203f, 0.0716f },
+    { -2.1359f, -23.8918f, 28.6838f, 0.4221f, 0.073f },
+    { -2.0786f, -23.843f, 28.6054f, 0.421f, 0.0725f },
+    { -2.1999f, -23.6209f, 28.2568f, 0.4155f, 0.0727f },
+    { -2.1452f, -23.571f, 28.3546f, 0.4161f, 0.074f },
+    { -2.1641f, -23.6712f, 28.6001f, 0.4194f, 0.0751f },
+    { -2.122f, -23.5177f, 28.4586f, 0.4168f, 0.0756f },
+    { -2.2541f, -23.7438f, 28.6055f, 0.4205f, 0.076f },
+    { -2.2121f, -23.5778f, 28.5601f, 0.4183f, 0.0764f },
+    { -2.3898f, -23.7565f, 28.4465f, 0.4206f, 0.0787f },
+    { -2.2963f, -23.6083f, 28.5432f, 0.4188f, 0.0775f },
+    { -2.2091f, -23.4491f, 28.4633f, 0.4164f, 0.0775f },
+    { -2.4285f, -23.5908f, 28.3962f, 0.4185f, 0.0803f },
+    { -2.3237f, -23.4567f, 28.4493f, 0.4167f, 0.079f },
+    { -2.4586f, -23.4214f, 28.3246f, 0.4162f, 0.0818f },
+    { -2.2052f, -23.2321f, 28.3055f, 0.4133f, 0.0793f },
+    { -2.1408f, -23.2378f, 28.2436f, 0.4126f, 0.078f },
+    { -2.2195f, -22.9972f, 28.138f, 0.4099f, 0.0814f },
+    { -2.2712f, -22.815f, 28.0118f, 0.4073f, 0.0832f },
+    { -2.1604f, -22.994f, 28.0602f, 0.409f, 0.0801f },
+    { -2.3333f, -22.6772f, 27.9132f, 0.4053f, 0.0845f },
+    { -2.2136f, -22.7909f, 27.9156f, 0.4062f, 0.0821f },
+    { -2.2845f, -22.6378f, 27.8091f, 0.404f, 0.0835f },
+    { -2.3789f, -22.5756f, 27.8284f, 0.4035f, 0.085f },
+    { -2.357f, -22.5441f, 27.7398f, 0.4024f, 0.0843f },
+    { -2.431f, -22.5028f, 27.7607f, 0.402f, 0.0852f },
+    { -2.4204f, -22.5029f, 27.716f, 0.4015f, 0.0847f },
+    { -2.4902f, -22.4696f, 27.6612f, 0.4003f, 0.0849f },
+    { -2.5126f, -22.4519f, 27.7132f, 0.4006f, 0.0857f },
+    { -2.4375f, -22.5125f, 27.661f, 0.4009f, 0.0841f },
+    { -2.5886f, -22.4321f, 27.6182f, 0.3989f, 0.0855f },
+    { -2.6119f, -22.4043f, 27.6853f, 0.3993f, 0.0867f },
+    { -2.7167f, -22.3415f, 27.6764f, 0.3981f, 0.0883f },
+    { -2.664f, -22.384f, 27.5948f, 0.3978f, 0.0864f },
+    { -2.7098f, -22.3441f, 27.5886f, 0.3972f, 0.0872f },
+    { -2.6769f, -22.3628f, 27.5308f, 0.3969f, 0.086f },
+    { -2.6247f, -22.4321f, 27.5596f, 0.3981f, 0.085f },
+    { -2.5502f, -22.4765f, 27.5987f, 0.3993f, 0.0844f },
+    { -2.3681f, -22.6054f, 27.7168f, 0.4023f, 0.0831f },
+    { -2.4944f, -22.5726f, 27.6411f, 0.4006f, 0.0831f },
+    { -2.5738f, -22.5319f, 27.587f, 0.3993f, 0.0834f },
+    { -2.4187f, -22.7553f, 27.7599f, 0.4033f, 0.0809f },
+    { -2.2953f, -22.7734f, 27.8329f, 0.4047f, 0.0813f },
+    { -2.2318f, -23.0023f, 27.9908f, 0.408f, 0.079f },
+    { -2.34f, -23.0082f, 27.9205f, 0.4069f, 0.0782f },
+    { -2.1902f, -23.2779f, 28.1719f, 0.4119f, 0.0765f },
+    { -2.275f, -23.3144f, 28.0881f, 0.4111f, 0.0753f },
+    { -2.3166f, -23.3088f, 27.9898f, 0.4101f, 0.0747f },
+    { -2.3913f, -22.9977f, 27.8398f, 0.4058f, 0.0778f },
+    { -2.3245f, -23.2791f, 27.8756f, 0.4088f, 0.0744f },
+    { -2.402f, -22.9656f, 27.7378f, 0.4045f, 0.0776f },
+    { -2.5093f, -22.6749f, 27.6034f, 0.4006f, 0.081f },
+    { -2.4865f, -22.7296f, 27.693f, 0.402f, 0.0808f },
+    { -2.6122f, -22.4572f, 27.519f, 0.3977f, 0.084f },
+    { 2.8841f, -21.4254f, 27.0747f, 0.6347f, 0.0828f },
+    { 2.9886f, -20.949f, 26.9323f, 0.6413f, 0.0868f },
+    { 2.4871f, -21.7431f, 26.7517f, 0.633f, 0.0728f },
+    { 3.1018f, -20.365f, 26.8271f, 0.6488f, 0.0923f },
+    { 2.2623f, -22.1151f, 26.7469f, 0.6285f, 0.0668f },
+    { 3.5105f, -19.8036f, 27.5518f, 0.6501f, 0.11f },
+    { 3.2627f, -19.6902f, 26.8714f, 0.6559f, 0.1007f },
+    { 3.7841f, -19.1796f, 28.1558f, 0.6527f, 0.1259f },
+    { 3.5722f, -19.056f, 27.5695f, 0.6581f, 0.1178f },
+    { 2.78f, -20.2748f, 26.0706f, 0.6552f, 0.0816f },
+    { 3.4088f, -18.9388f, 26.9889f, 0.6633f, 0.1102f },
+    { 2.6192f, -20.8655f, 26.2426f, 0.6472f, 0.0767f },
+    { 3.0603f, -19.5888f, 26.1844f, 0.6619f, 0.0916f },
+    { 2.332f, -20.1417f, 25.2136f, 0.6631f, 0.067f },
+    { 2.8578f, -19.4309f, 25.5075f, 0.668f, 0.0826f },
+    { 3.3312f, -18.844f, 26.4196f, 0.6683f, 0.1031f },
+    { 3.2365f, -18.7169f, 25.8344f, 0.6728f, 0.0982f },
+    { 3.4774f, -18.125f, 27.1034f, 0.6716f, 0.1188f },
+    { 3.4641f, -18.0767f, 26.6118f, 0.6756f, 0.1125f },
+    { 3.4539f, -17.9965f, 26.0906f, 0.6793f, 0.1065f },
+    { 3.6072f, -17.258f, 26.3275f, 0.6857f, 0.1148f },
+    { 3.5509f, -17.314f, 26.7759f, 0.6832f, 0.1207f },
+    { 3.5259f, -17.3311f, 27.1933f, 0.6807f, 0.1267f },
+    { 3.5974f, -18.2059f, 27.6097f, 0.6671f, 0.1258f },
+    { 3.6227f, -17.3801f, 27.6487f, 0.6766f, 0.1339f },
+    { 3.79f, -18.3048f, 28.1213f, 0.6623f, 0.1333f },
+    { 3.8009f, -17.451f, 28.1083f, 0.6726f, 0.1411f },
+    { 4.0071f, -19.2936f, 28.7427f, 0.6473f, 0.1345f },
+    { 4.0213f, -18.4072f, 28.629f, 0.6574f, 0.141f },
+    { 4.2004f, -19.345f, 29.3924f, 0.6415f, 0.1449f },
+    { 4.2252f, -18.4406f, 29.1983f, 0.6523f, 0.1506f },
+    { 4.0201f, -17.5341f, 28.5384f, 0.6672f, 0.1471f },
+    { 3.8366f, -16.7851f, 28.1152f, 0.6786f, 0.1458f },
+    { 4.2106f, -17.5501f, 29.0188f, 0.663f, 0.1555f },
+    { 4.0004f, -16.884f, 28.5068f, 0.6746f, 0.1512f },
+    { 3.8873f, -16.3001f, 28.2701f, 0.6845f, 0.1505f },
+    { 3.9987f, -16.4476f, 28.6258f, 0.6809f, 0.1542f },
+    { 4.1441f, -16.9289f, 28.9164f, 0.6709f, 0.1578f },
+    { 4.097f, -16.6124f, 28.9063f, 0.6773f, 0.1579f },
+    { 4.3025f, -17.4197f, 29.6293f, 0.659f, 0.1672f },
+    { 4.2354f, -16.8472f, 29.4234f, 0.6675f, 0.1672f },
+    { 4.3079f, -16.6601f, 29.9612f, 0.6643f, 0.1779f },
+    { 4.1472f, -16.4883f, 29.2264f, 0.6743f, 0.1653f },
+    { 4.2292f, -16.319f, 29.6989f, 0.6714f, 0.1726f },
+    { 0.8597f, -20.8158f, 25.4591f, 0.6503f, 0.0463f },
+    { 0.3978f, -20.7618f, 25.3682f, 0.6501f, 0.0399f },
+    { 0.9206f, -20.5188f, 25.0949f, 0.6565f, 0.0456f },
+    { 1.4499f, -20.9981f, 25.6562f, 0.6482f, 0.0553f },
+    { 0.4153f, -21.0328f, 25.6056f, 0.6456f, 0.0408f },
+    { 0.8617f, -21.109f, 25.6845f, 0.6454f, 0.047f },
+    { -0.f, -21.0193f, 25.5823f, 0.645f, 0.0353f },
+    { 0.0002f, -20.7652f, 25.349f, 0.6484f, 0.0351f },
+    { -0.f, -21.3067f, 25.7702f, 0.6415f, 0.0356f },
+    { 0.4266f, -20.5146f, 25.0067f, 0.6556f, 0.0386f },
+    { 0.001f, -20.5368f, 24.991f, 0.6537f, 0.033f },
+    { 0.0018f, -20.2803f, 24.532f, 0.659f, 0.0309f },
+    { 0.4622f, -20.2411f, 24.548f, 0.6616f, 0.0372f },
+    { 0.9786f, -20.1927f, 24.6308f, 0.6643f, 0.0435f },
+    { 1.5494f, -20.6265f, 25.2981f, 0.6553f, 0.0555f },
+    { 1.6023f, -20.2089f, 24.8162f, 0.6637f, 0.0552f },
+    { 2.1649f, -20.766f, 25.6645f, 0.6522f, 0.0664f },
+    { 2.0805f, -21.3081f, 26.0508f, 0.643f, 0.0656f },
+    { 2.5356f, -21.3564f, 26.5273f, 0.6393f, 0.0746f },
+    { 2.2348f, -21.7633f, 26.4642f, 0.6348f, 0.0675f },
+    { 1.7963f, -21.5449f, 26.0405f, 0.6399f, 0.0606f },
+    { 1.9963f, -21.8528f, 26.3204f, 0.6345f, 0.0631f },
+    { 1.37f, -21.2883f, 25.829f, 0.6435f, 0.0544f },
+    { 1.33f, -21.5553f, 25.9502f, 0.6396f, 0.0535f },
+    { 0.8935f, -21.4149f, 25.8591f, 0.6409f, 0.0474f },
+    { 1.6294f, -21.6741f, 26.0701f, 0.6379f, 0.0578f },
+    { 1.719f, -21.916f, 26.2426f, 0.6339f, 0.0586f },
+    { 1.3503f, -21.8571f, 26.1534f, 0.6347f, 0.0533f },
+    { 2.0453f, -22.1716f, 26.6053f, 0.6287f, 0.0629f },
+    { 1.7606f, -22.2031f, 26.4928f, 0.6288f, 0.0584f },
+    { 2.22f, -22.4441f, 26.9787f, 0.6229f, 0.0645f },
+    { 2.0185f, -22.4608f, 26.8321f, 0.6236f, 0.0612f },
+    { 2.1502f, -22.7781f, 27.1739f, 0.6174f, 0.0613f },
+    { 2.0953f, -23.1447f, 27.3466f, 0.6116f, 0.0578f },
+    { 1.9619f, -22.7611f, 27.0214f, 0.6185f, 0.0585f },
+    { 1.7401f, -22.4633f, 26.6989f, 0.6242f, 0.057f },
+    { 1.9215f, -23.1131f, 27.1937f, 0.6129f, 0.0555f },
+    { 1.3804f, -22.1588f, 26.3828f, 0.6297f, 0.053f },
+    { 1.6976f, -22.7403f, 26.8772f, 0.6196f, 0.0548f },
+    { 1.3698f, -22.4255f, 26.5828f, 0.6251f, 0.0519f },
+    { 0.9226f, -21.7503f, 26.0712f, 0.6359f, 0.0475f },
+    { 0.9404f, -22.0793f, 26.2911f, 0.6307f, 0.0471f },
+    { 0.4488f, -21.3334f, 25.7954f, 0.6413f, 0.0414f },
+    { 0.468f, -21.6694f, 26.0143f, 0.6365f, 0.0415f },
+    { -0.f, -21.6351f, 25.9922f, 0.6368f, 0.0353f },
+    { 0.4762f, -22.005f, 26.2335f, 0.6315f, 0.041f },
+    { -0.f, -21.9691f, 26.2133f, 0.632f, 0.0351f },
+    { -0.f, -22.2731f, 26.3985f, 0.628f, 0.034f },
+    { 0.4767f, -22.3047f, 26.424f, 0.6271f, 0.0401f },
+    { -0.f, -22.5803f, 26.5663f, 0.624f, 0.0329f },
+    { 0.9384f, -22.3663f, 26.4893f, 0.6261f, 0.0461f },
+    { 0.4764f, -22.6055f, 26.5961f, 0.6226f, 0.0388f },
+    { -0.f, -22.9238f, 26.7353f, 0.6187f, 0.031f },
+    { 1.3468f, -22.7024f, 26.7597f, 0.6206f, 0.0501f },
+    { 0.9322f, -22.655f, 26.6667f, 0.6215f, 0.0447f },
+    { 0.4822f, -22.9446f, 26.7597f, 0.6176f, 0.0371f },
+    { -0.f, -23.2635f, 26.8857f, 0.6134f, 0.029f },
+    { 0.4792f, -23.2823f, 26.9024f, 0.6125f, 0.0352f },
+    { -0.f, -23.5595f, 26.9978f, 0.6093f, 0.0275f },
+    { 0.9377f, -22.9889f, 26.8242f, 0.6164f, 0.0429f },
+    { 1.3399f, -23.0349f, 26.9199f, 0.6153f, 0.048f },
+    { 0.9305f, -23.3257f, 26.9595f, 0.6113f, 0.0409f },
+    { 1.673f, -23.0778f, 27.044f, 0.6142f, 0.0523f },
+    { 1.3261f, -23.3736f, 27.0642f, 0.6101f, 0.0457f },
+    { 1.6483f, -23.4209f, 27.2016f, 0.6087f, 0.0497f },
+    { 1.8795f, -23.4628f, 27.3566f, 0.6072f, 0.0525f },
+    { 1.6054f, -23.7145f, 27.3523f, 0.6037f, 0.0473f },
+    { 2.0365f, -23.498f, 27.51f, 0.6058f, 0.0545f },
+    { 1.9548f, -23.7918f, 27.6773f, 0.6005f, 0.0517f },
+    { 1.8181f, -23.7559f, 27.5176f, 0.6021f, 0.0499f },
+    { 1.9624f, -24.1036f, 27.9871f, 0.5936f, 0.0508f },
+    { 1.871f, -24.0734f, 27.8377f, 0.5952f, 0.0493f },
+    { 1.9402f, -24.4136f, 28.2474f, 0.5869f, 0.0497f },
+    { 1.891f, -24.4142f, 28.125f, 0.588f, 0.0484f },
+    { 1.8541f, -24.7175f, 28.3811f, 0.5811f, 0.0476f },
+    { 1.8059f, -24.39f, 27.9805f, 0.5895f, 0.0469f },
+    { 1.8019f, -24.7716f, 28.5365f, 0.5784f, 0.0485f },
+    { 1.8158f, -24.7225f, 28.2471f, 0.5823f, 0.0462f },
+    { 1.7297f, -24.9992f, 28.4936f, 0.5756f, 0.0457f },
+    { 1.7394f, -24.7039f, 28.1049f, 0.5838f, 0.0446f },
+    { 1.7175f, -24.9985f, 28.368f, 0.577f, 0.0444f },
+    { 1.7065f, -24.9853f, 28.5945f, 0.5745f, 0.0468f },
+    { 1.6187f, -25.2445f, 28.5931f, 0.5709f, 0.0439f },
+    { 1.7662f, -24.7687f, 28.6474f, 0.5771f, 0.0496f },
+    { 1.6721f, -24.9724f, 28.6788f, 0.5734f, 0.0479f },
+    { 1.5978f, -25.2248f, 28.6662f, 0.57f, 0.0449f },
+    { 1.5646f, -25.2018f, 28.7186f, 0.5693f, 0.0458f },
+    { 1.5218f, -25.4641f, 28.6552f, 0.5672f, 0.0418f },
+    { 1.4657f, -25.4033f, 28.7588f, 0.5658f, 0.0436f },
+    { 1.5023f, -25.4377f, 28.7186f, 0.5664f, 0.0428f },
+    { 1.3449f, -25.6011f, 28.8417f, 0.5617f, 0.0415f },
+    { 1.383f, -25.6413f, 28.7962f, 0.5624f, 0.0406f },
+    { 1.1717f, -25.8193f, 29.0098f, 0.5558f, 0.0394f },
+    { 1.2034f, -25.8532f, 28.9433f, 0.5569f, 0.0384f },
+    { 1.4014f, -25.6695f, 28.7251f, 0.5634f, 0.0396f },
+    { 1.2198f, -25.8724f, 28.8478f, 0.5583f, 0.0374f },
+    { 1.5189f, -25.4605f, 28.524f, 0.5688f, 0.0406f },
+    { 1.3996f, -25.6622f, 28.5861f, 0.5652f, 0.0384f },
+    { 1.6128f, -25.2439f, 28.4671f, 0.5724f, 0.0426f },
+    { 1.6514f, -24.9774f, 28.2101f, 0.5788f, 0.0427f },
+    { 1.5564f, -25.2182f, 28.2909f, 0.5746f, 0.0409f },
+    { 1.4693f, -25.4336f, 28.3422f, 0.5711f, 0.0389f },
+    { 1.513f, -24.9304f, 28.0124f, 0.5812f, 0.0404f },
+    { 1.4255f, -25.1624f, 28.0672f, 0.5774f, 0.0385f },
+    { 1.6002f, -24.6702f, 27.9378f, 0.5857f, 0.0426f },
+    { 1.3072f, -24.8711f, 27.7999f, 0.5838f, 0.0376f },
+    { 1.6763f, -24.3584f, 27.8188f, 0.5912f, 0.045f },
+    { 1.388f, -24.6212f, 27.7503f, 0.5878f, 0.0398f },
+    { 1.4703f, -24.3161f, 27.6401f, 0.5931f, 0.0423f },
+    { 1.0927f, -24.5564f, 27.5471f, 0.5903f, 0.0361f },
+    { 1.1561f, -24.2598f, 27.4444f, 0.5953f, 0.0385f },
+    { 1.5456f, -23.9994f, 27.4979f, 0.5987f, 0.0449f },
+    { 1.747f, -24.0389f, 27.673f, 0.5969f, 0.0475f },
+    { 1.2827f, -23.6692f, 27.1937f, 0.6053f, 0.0434f },
+    { 1.2219f, -23.954f, 27.3174f, 0.6005f, 0.041f },
+    { 0.8863f, -23.623f, 27.0705f, 0.6067f, 0.0386f },
+    { 0.4525f, -23.5788f, 27.0115f, 0.608f, 0.0332f },
+    { -0.f, -23.8474f, 27.0958f, 0.6052f, 0.026f },
+    { 0.4186f, -23.8645f, 27.1084f, 0.6036f, 0.0311f },
+    { -0.f, -24.1626f, 27.2041f, 0.5997f, 0.0241f },
+    { 0.8287f, -23.9075f, 27.1735f, 0.6022f, 0.0362f },
+    { 0.3939f, -24.1698f, 27.2143f, 0.5986f, 0.0291f },
+    { -0.f, -24.4781f, 27.3059f, 0.5943f, 0.0223f },
+    { 0.7814f, -24.2056f, 27.2847f, 0.5973f, 0.0339f },
+    { 0.3779f, -24.4738f, 27.3121f, 0.5936f, 0.0272f },
+    { -0.f, -24.7666f, 27.3845f, 0.5895f, 0.021f },
+    { 0.7455f, -24.4994f, 27.3827f, 0.5924f, 0.0319f },
+    { 0.37f, -24.7558f, 27.3847f, 0.589f, 0.0257f },
+    { -0.f, -25.0334f, 27.4606f, 0.5848f, 0.0196f },
+    { 1.0392f, -24.8135f, 27.5978f, 0.5861f, 0.0341f },
+    { 0.7223f, -24.7707f, 27.446f, 0.588f, 0.0302f },
+    { 0.3593f, -25.0204f, 27.4579f, 0.5844f, 0.0243f },
+    { -0.f, -25.2842f, 27.5552f, 0.5801f, 0.0188f },
+    { 0.3351f, -25.2719f, 27.5576f, 0.5799f, 0.0231f },
+    { -0.f, -25.511f, 27.666f, 0.5755f, 0.0179f },
+    { 0.6962f, -25.0269f, 27.5102f, 0.5837f, 0.0286f },
+    { 0.3044f, -25.5007f, 27.6755f, 0.5755f, 0.022f },
+    { -0.f, -25.7061f, 27.7912f, 0.5714f, 0.0175f },
+    { 0.6518f, -25.2756f, 27.6107f, 0.5793f, 0.0271f },
+    { 0.988f, -25.0541f, 27.6444f, 0.5823f, 0.0324f },
+    { 0.9314f, -25.3013f, 27.7349f, 0.578f, 0.0307f },
+    { 1.232f, -25.0999f, 27.8377f, 0.5801f, 0.0356f },
+    { 1.1663f, -25.3417f, 27.9127f, 0.5761f, 0.0339f },
+    { 1.3487f, -25.3899f, 28.1268f, 0.5737f, 0.0367f },
+    { 1.0894f, -25.5781f, 28.0173f, 0.5719f, 0.0322f },
+    { 1.3572f, -25.6366f, 28.4053f, 0.5675f, 0.0369f },
+    { 1.2537f, -25.61f, 28.2086f, 0.5698f, 0.0348f },
+    { 1.219f, -25.8627f, 28.7007f, 0.5605f, 0.0362f },
+    { 1.1875f, -25.8399f, 28.5217f, 0.563f, 0.0347f },
+    { 1.0044f, -26.0621f, 28.9698f, 0.5532f, 0.0349f },
+    { 1.0053f, -26.0515f, 28.8191f, 0.5556f, 0.0337f },
+    { 1.1119f, -25.8196f, 28.3302f, 0.5654f, 0.0329f },
+    { 0.9853f, -26.0314f, 28.6463f, 0.5582f, 0.0324f },
+    { 0.7827f, -26.2283f, 29.0376f, 0.5489f, 0.032f },
+    { 0.7868f, -26.2182f, 28.8925f, 0.5515f, 0.0309f },
+    { 0.9901f, -26.0544f, 29.0901f, 0.5512f, 0.036f },
+    { 0.9661f, -26.0303f, 29.1815f, 0.5496f, 0.037f },
+    { 0.7699f, -26.2257f, 29.1667f, 0.5466f, 0.0331f },
+    { 0.7483f, -26.2064f, 29.2754f, 0.5445f, 0.0342f },
+    { 0.5338f, -26.3584f, 29.1959f, 0.5429f, 0.0297f },
+    { 0.5442f, -26.3593f, 29.0692f, 0.5454f, 0.0286f },
+    { 0.2731f, -26.4434f, 29.2006f, 0.5399f, 0.0259f },
+    { -0.f, -26.4734f, 29.0847f, 0.5395f, 0.0209f },
+    { 0.2788f, -26.4432f, 29.0826f, 0.5424f, 0.0249f },
+    { 0.2829f, -26.4335f, 28.9536f, 0.545f, 0.0239f },
+    { -0.f, -26.4634f, 28.9588f, 0.5424f, 0.02f },
+    { 0.5503f, -26.3498f, 28.9332f, 0.548f, 0.0277f },
+    { 0.2812f, -26.4091f, 28.8185f, 0.5478f, 0.023f },
+    { -0.f, -26.4367f, 28.8258f, 0.5453f, 0.019f },
+    { 0.5454f, -26.3289f, 28.7902f, 0.5506f, 0.0267f },
+    { 0.7757f, -26.1987f, 28.7343f, 0.5541f, 0.0297f },
+    { 0.5228f, -26.2958f, 28.6422f, 0.5533f, 0.0256f },
+    { 0.937f, -26.0102f, 28.4598f, 0.5609f, 0.0308f },
+    { 0.743f, -26.1733f, 28.566f, 0.5568f, 0.0284f },
+    { 0.9805f, -25.7906f, 28.1442f, 0.5676f, 0.0306f },
+    { 0.8421f, -25.9762f, 28.2774f, 0.5633f, 0.0288f },
+    { 0.8643f, -25.5366f, 27.8528f, 0.5737f, 0.0292f },
+    { 0.7815f, -25.7416f, 27.9819f, 0.5696f, 0.0278f },
+    { 0.5966f, -25.5044f, 27.7329f, 0.575f, 0.0258f },
+    { 0.2744f, -25.6967f, 27.8035f, 0.5714f, 0.0211f },
+    { -0.f, -25.8702f, 27.9308f, 0.5673f, 0.0172f },
+    { 0.5384f, -25.7009f, 27.862f, 0.571f, 0.0246f },
+    { 0.2449f, -25.8617f, 27.9427f, 0.5675f, 0.0205f },
+    { -0.f, -26.0043f, 28.085f, 0.5634f, 0.0172f },
+    { 0.6822f, -25.9172f, 28.1169f, 0.5656f, 0.0264f },
+    { 0.4767f, -25.8676f, 27.9986f, 0.5672f, 0.0236f },
+    { 0.216f, -25.9972f, 28.0943f, 0.5638f, 0.0201f },
+    { -0.f, -26.1185f, 28.2452f, 0.5595f, 0.0172f },
+    { 0.2027f, -26.1119f, 28.2492f, 0.5602f, 0.0201f },
+    { -0.f, -26.2229f, 28.4027f, 0.5556f, 0.0175f },
+    { 0.4114f, -26.0069f, 28.1432f, 0.5635f, 0.0228f },
+    { 0.5657f, -26.0641f, 28.2528f, 0.5618f, 0.025f },
+    { 0.3469f, -26.0968f, 28.2504f, 0.5607f, 0.0221f },
+    { 0.6769f, -26.1319f, 28.401f, 0.5593f, 0.0268f },
+    { 0.4806f, -26.2442f, 28.4957f, 0.5559f, 0.0244f },
+    { 0.4168f, -26.1679f, 28.3573f, 0.5586f, 0.0232f },
+    { 0.2697f, -26.3647f, 28.6818f, 0.5506f, 0.0222f },
+    { -0.f, -26.3857f, 28.6925f, 0.5484f, 0.0185f },
+    { 0.2491f, -26.2998f, 28.5421f, 0.5536f, 0.0213f },
+    { -0.f, -26.3135f, 28.5533f, 0.5516f, 0.0179f },
+    { 0.2203f, -26.2142f, 28.3982f, 0.5568f, 0.0206f },
+    { 3.6072f, -17.258f, 26.3275f, 0.6012f, 0.354f },
+    { 3.7932f, -16.4901f, 26.5964f, 0.5983f, 0.3647f },
+    { 3.5509f, -17.314f, 26.7759f, 0.5975f, 0.355f },
+    { 3.6835f, -16.5826f, 26.927f, 0.5951f, 0.3625f },
+    { 3.5259f, -17.3311f, 27.1933f, 0.5938f, 0.3561f },
+    { 3.6041f, -17.0927f, 25.7789f, 0.6116f, 0.3594f },
+    { 3.6115f, -16.6393f, 27.2371f, 0.5932f, 0.3612f },
+    { 3.6227f, -17.3801f, 27.6487f, 0.5926f, 0.3564f },
+    { 3.9293f, -15.7486f, 26.9647f, 0.5931f, 0.3719f },
+    { 3.6847f, -16.7052f, 27.6626f, 0.5913f, 0.3595f },
+    { 3.8009f, -17.451f, 28.1083f, 0.5914f, 0.3567f },
+    { 3.8366f, -16.7851f, 28.1152f, 0.5895f, 0.3577f },
+    { 3.758f, -16.1708f, 27.8381f, 0.5893f, 0.3619f },
+    { 3.8873f, -16.3001f, 28.2701f, 0.5877f, 0.3587f },
+    { 3.6986f, -16.0455f, 27.447f, 0.5906f, 0.3651f },
+    { 3.7969f, -15.9104f, 27.2139f, 0.5915f, 0.3682f },
+    { 3.7517f, -15.5458f, 28.0354f, 0.5855f, 0.3663f },
+    { 3.8259f, -15.3252f, 27.7854f, 0.5852f, 0.3704f },
+    { 3.9331f, -15.0893f, 27.5001f, 0.5857f, 0.3752f },
+    { 3.817f, -15.7663f, 28.3621f, 0.5858f, 0.3626f },
+    { 3.7588f, -14.7909f, 28.4799f, 0.5778f, 0.3693f },
+    { 3.9431f, -15.989f, 28.7009f, 0.5864f, 0.3596f },
+    { 3.9987f, -16.4476f, 28.6258f, 0.5887f, 0.3578f },
+    { 3.7509f, -15.079f, 28.7509f, 0.5794f, 0.3649f },
+    { 3.8427f, -15.3611f, 29.0081f, 0.5813f, 0.3613f },
+    { 4.0515f, -16.2159f, 28.9873f, 0.5878f, 0.3579f },
+    { 4.097f, -16.6124f, 28.9063f, 0.5897f, 0.3569f },
+    { 4.1472f, -16.4883f, 29.2264f, 0.5897f, 0.3568f },
+    { 3.9817f, -15.6553f, 29.2488f, 0.5837f, 0.3585f },
+    { 4.1155f, -15.9793f, 29.4703f, 0.5865f, 0.3568f },
+    { 4.2292f, -16.319f, 29.6989f, 0.5897f, 0.3567f },
+    { 3.9806f, -15.1027f, 29.7548f, 0.5798f, 0.3547f },
+    { 4.1473f, -15.5282f, 29.9537f, 0.5843f, 0.3534f },
+    { 4.2932f, -15.993f, 30.179f, 0.5887f, 0.3529f },
+    { 4.3079f, -16.6601f, 29.9612f, 0.5914f, 0.3562f },
+    { 3.973f, -14.5543f, 30.1955f, 0.5764f, 0.3496f },
+    { 4.3954f, -16.3888f, 30.463f, 0.5915f, 0.3525f },
+    { 4.3576f, -17.2036f, 30.262f, 0.5931f, 0.3557f },
+    { 4.4379f, -16.9627f, 30.8089f, 0.5935f, 0.3521f },
+    { 4.4683f, -16.1069f, 30.9108f, 0.5925f, 0.3486f },
+    { 4.5047f, -16.7226f, 31.2858f, 0.5938f, 0.3486f },
+    { 4.5199f, -16.5086f, 31.7085f, 0.5998f, 0.3438f },
+    { 4.3396f, -15.6343f, 30.6116f, 0.5886f, 0.3489f },
+    { 4.4968f, -15.8879f, 31.2865f, 0.5952f, 0.3445f },
+    { 4.542f, -16.3313f, 32.0262f, 0.6059f, 0.339f },
+    { 4.1669f, -15.0565f, 30.3804f, 0.5825f, 0.3489f },
+    { 4.3687f, -15.3672f, 30.9416f, 0.5897f, 0.345f },
+    { 4.194f, -14.7577f, 30.6931f, 0.5824f, 0.3448f },
+    { 4.5373f, -15.7253f, 31.5588f, 0.5983f, 0.341f },
+    { 4.4187f, -15.1738f, 31.1658f, 0.5913f, 0.3416f },
+    { 4.6458f, -15.6122f, 31.6962f, 0.6003f, 0.3388f },
+    { 4.6299f, -16.2012f, 32.1879f, 0.6074f, 0.3378f },
+    { 4.5278f, -15.0364f, 31.2811f, 0.5929f, 0.3392f },
+    { 4.8035f, -15.5158f, 31.7432f, 0.602f, 0.3372f },
+    { 4.7541f, -16.1109f, 32.2436f, 0.6089f, 0.3367f },
+    { 4.885f, -16.0529f, 32.2431f, 0.61f, 0.3358f },
+    { 4.6995f, -14.9066f, 31.3222f, 0.5947f, 0.337f },
+    { 4.9914f, -15.4031f, 31.744f, 0.6038f, 0.3351f },
+    { 4.9603f, -16.0408f, 32.18f, 0.6111f, 0.3349f },
+    { 4.5139f, -14.2168f, 31.0204f, 0.5862f, 0.3357f },
+    { 4.9374f, -14.7362f, 31.3238f, 0.5971f, 0.3341f },
+    { 5.1296f, -15.3151f, 31.7003f, 0.6055f, 0.3332f },
+    { 5.1384f, -15.2927f, 31.6139f, 0.6067f, 0.3318f },
+    { 4.9177f, -16.0882f, 32.0479f, 0.6135f, 0.3333f },
+    { 5.152f, -14.5834f, 31.2879f, 0.5992f, 0.3314f },
+    { 5.1491f, -15.4001f, 31.3512f, 0.6097f, 0.3298f },
+    { 4.886f, -16.2396f, 31.7272f, 0.6158f, 0.3318f },
+    { 4.994f, -16.5397f, 31.0982f, 0.6239f, 0.3268f },
+    { 5.2539f, -14.5063f, 31.2164f, 0.6003f, 0.3299f },
+    { 5.3412f, -14.5746f, 30.9801f, 0.6031f, 0.3281f },
+    { 5.2929f, -15.7015f, 30.7788f, 0.6167f, 0.3259f },
+    { 5.1181f, -16.9117f, 30.3069f, 0.632f, 0.3218f },
+    { 5.438f, -16.1163f, 30.0437f, 0.6261f, 0.3206f },
+    { 5.1349f, -17.2792f, 29.4994f, 0.6418f, 0.3147f },
+    { 5.5118f, -14.8579f, 30.4501f, 0.6103f, 0.3244f },
+    { 5.4525f, -16.5641f, 29.2929f, 0.6361f, 0.3146f },
+    { 5.0713f, -17.6343f, 28.6446f, 0.6516f, 0.3075f },
+    { 5.6619f, -15.2907f, 29.7664f, 0.6201f, 0.3195f },
+    { 5.681f, -14.5941f, 29.4224f, 0.6148f, 0.3172f },
+    { 5.6877f, -15.8075f, 29.0692f, 0.6304f, 0.314f },
+    { 5.3933f, -17.0207f, 28.501f, 0.6465f, 0.3073f },
+    { 5.3175f, -17.462f, 27.6427f, 0.657f, 0.2983f },
+    { 4.9544f, -17.9692f, 27.7116f, 0.6644f, 0.2968f },
+    { 5.6539f, -16.3554f, 28.3605f, 0.6405f, 0.3076f },
+    { 5.3029f, -17.8164f, 27.0026f, 0.6645f, 0.2902f },
+    { 4.89f, -18.2493f, 27.0119f, 0.6772f, 0.2861f },
+    { 5.6249f, -16.8813f, 27.6425f, 0.6498f, 0.2999f },
+    { 5.6903f, -17.1778f, 27.1451f, 0.6546f, 0.2936f },
+    { 5.8578f, -15.7419f, 28.2077f, 0.6346f, 0.3072f },
+    { 5.8324f, -16.3099f, 27.7164f, 0.6429f, 0.3018f },
+    { 5.959f, -16.3054f, 27.4837f, 0.6431f, 0.2988f },
+    { 5.861f, -17.3203f, 27.0429f, 0.6551f, 0.2902f },
+    { 6.1588f, -16.3215f, 27.4523f, 0.6422f, 0.2968f },
+    { 5.4274f, -18.0122f, 26.8656f, 0.6658f, 0.2856f },
+    { 4.9842f, -18.4404f, 26.8572f, 0.6753f, 0.2818f },
+    { 5.6041f, -18.0693f, 27.1217f, 0.6621f, 0.2828f },
+    { 5.1359f, -18.5304f, 27.1633f, 0.6735f, 0.2775f },
+    { 6.0611f, -17.3393f, 27.2327f, 0.6522f, 0.2886f },
+    { 6.3602f, -16.3335f, 27.5978f, 0.6401f, 0.2954f },
+    { 6.215f, -17.2651f, 27.6113f, 0.6472f, 0.2874f },
+    { 6.492f, -16.3168f, 27.896f, 0.6368f, 0.2942f },
+    { 5.7463f, -18.0074f, 27.6611f, 0.6548f, 0.2803f },
+    { 6.5671f, -16.2869f, 28.297f, 0.6326f, 0.293f },
+    { 5.2444f, -18.5074f, 27.846f, 0.6598f, 0.2739f },
+    { 4.8035f, -18.7296f, 27.2557f, 0.6737f, 0.2736f },
+    { 6.3266f, -17.1153f, 28.1012f, 0.6409f, 0.2865f },
+    { 5.9005f, -17.8027f, 28.3044f, 0.6457f, 0.2789f },
+    { 4.6087f, -18.748f, 27.4861f, 0.67f, 0.2671f },
+    { 5.8463f, -17.7171f, 29.4272f, 0.6342f, 0.2739f },
+    { 4.3769f, -18.7017f, 28.0318f, 0.6634f, 0.2631f },
+    { 4.4531f, -18.7098f, 27.2989f, 0.6724f, 0.2657f },
+    { 4.8035f, -18.7296f, 27.2557f, 0.6784f, 0.2679f },
+    { 4.3387f, -18.5516f, 27.973f, 0.6643f, 0.2601f },
+    { 4.6575f, -18.6478f, 26.9545f, 0.6779f, 0.265f },
+    { 5.1359f, -18.5304f, 27.1633f, 0.6828f, 0.2661f },
+    { 4.9842f, -18.4404f, 26.8572f, 0.6817f, 0.2627f },
+    { 4.4146f, -18.5993f, 27.4192f, 0.6709f, 0.2627f },
+    { 4.5447f, -18.5043f, 27.1287f, 0.6749f, 0.2613f },
+    { 3.804f, -14.493f, 28.1488f, 0.577f, 0.3747f },
+    { 3.967f, -14.8232f, 27.0671f, 0.5876f, 0.3812f },
+    { 3.5415f, -13.9403f, 28.8571f, 0.5681f, 0.3707f },
+    { 3.9726f, -15.5434f, 26.5252f, 0.5966f, 0.3769f },
+    { 3.8237f, -14.1815f, 27.7111f, 0.5777f, 0.3816f },
+    { 3.8328f, -16.3169f, 26.1089f, 0.6039f, 0.3691f },
+    { 3.861f, -16.0815f, 25.5648f, 0.6099f, 0.375f },
+    { 3.6082f, -16.8525f, 25.2046f, 0.6186f, 0.3654f },
+    { 3.9852f, -15.2953f, 26.0051f, 0.6007f, 0.383f },
+    { 3.9368f, -15.8023f, 25.0642f, 0.6142f, 0.3819f },
+    { 3.9587f, -14.528f, 26.5595f, 0.5901f, 0.3881f },
+    { 4.0257f, -15.005f, 25.5143f, 0.604f, 0.39f },
+    { 3.9393f, -14.2048f, 26.0502f, 0.5925f, 0.3958f },
+    { 4.0679f, -14.6754f, 25.0451f, 0.6068f, 0.3974f },
+    { 3.9154f, -13.8559f, 25.5468f, 0.5949f, 0.4039f },
+    { 3.7569f, -13.5089f, 26.703f, 0.5806f, 0.3978f },
+    { 3.6112f, -12.9863f, 26.2462f, 0.5801f, 0.4079f },
+    { 3.8105f, -13.8543f, 27.2136f, 0.5791f, 0.3894f },
+    { 3.4352f, -12.6209f, 27.2937f, 0.5669f, 0.4004f },
+    { 3.5505f, -13.6433f, 28.4333f, 0.5678f, 0.3779f },
+    { 3.5578f, -13.025f, 27.5036f, 0.5692f, 0.394f },
+    { 3.5697f, -13.3488f, 27.9527f, 0.5685f, 0.386f },
+    { 3.1955f, -13.1678f, 29.0956f, 0.558f, 0.3738f },
+    { 3.3019f, -12.6371f, 28.2292f, 0.5588f, 0.3895f },
+    { 3.1611f, -13.4138f, 29.6888f, 0.5581f, 0.3636f },
+    { 3.2548f, -12.92f, 28.6251f, 0.5585f, 0.382f },
+    { 2.8065f, -12.7143f, 29.5594f, 0.5486f, 0.3725f },
+    { 3.2674f, -12.4405f, 27.9019f, 0.5595f, 0.3954f },
+    { 2.9491f, -12.2297f, 28.6569f, 0.55f, 0.3891f },
+    { 3.0217f, -12.0682f, 28.1793f, 0.5525f, 0.3966f },
+    { 3.1224f, -12.0856f, 27.5312f, 0.5585f, 0.404f },
+    { 3.2052f, -12.0936f, 26.8355f, 0.5654f, 0.4118f },
+    { 2.6274f, -11.5428f, 27.9375f, 0.5468f, 0.4064f },
+    { 3.5825f, -12.6808f, 25.5829f, 0.5847f, 0.4173f },
+    { 2.716f, -11.4141f, 27.4126f, 0.5511f, 0.4139f },
+    { 3.2243f, -11.9039f, 26.2149f, 0.5703f, 0.4204f },
+    { 3.8936f, -13.4837f, 25.0567f, 0.5976f, 0.4119f },
+    { 4.0856f, -14.3094f, 24.59f, 0.6094f, 0.4049f },
+    { 3.9363f, -13.059f, 24.5805f, 0.6005f, 0.4204f },
+    { 4.1509f, -13.8802f, 24.1373f, 0.6121f, 0.4132f },
+    { 4.0864f, -15.1546f, 24.1364f, 0.6206f, 0.3965f },
+    { 4.189f, -14.7808f, 23.6893f, 0.6236f, 0.4042f },
+    { 4.3359f, -13.3611f, 23.6754f, 0.6151f, 0.4228f },
+    { 3.6097f, -12.2985f, 25.0782f, 0.5879f, 0.4259f },
+    { 4.1059f, -12.5525f, 24.1186f, 0.6036f, 0.43f },
+    { 3.2356f, -11.5802f, 25.6897f, 0.5738f, 0.4292f },
+    { 3.7458f, -11.8524f, 24.634f, 0.5911f, 0.4348f },
+    { 2.7546f, -11.2056f, 26.8536f, 0.5552f, 0.4226f },
+    { 3.2949f, -11.186f, 25.2801f, 0.5762f, 0.4377f },
+    { 2.7607f, -10.9193f, 26.347f, 0.5585f, 0.4315f },
+    { 2.109f, -10.6382f, 27.3995f, 0.5401f, 0.4248f },
+    { 2.1319f, -10.3311f, 26.982f, 0.5424f, 0.4334f },
+    { 2.05f, -10.8977f, 27.8396f, 0.5371f, 0.4165f },
+    { 1.4242f, -9.8843f, 27.4774f, 0.5272f, 0.4351f },
+    { 1.3867f, -10.2343f, 27.7986f, 0.5259f, 0.4268f },
+    { 1.9582f, -11.1161f, 28.2342f, 0.5344f, 0.4092f },
+    { 1.3221f, -10.5504f, 28.1245f, 0.5243f, 0.4188f },
+    { 2.5307f, -11.6625f, 28.4265f, 0.5432f, 0.3992f },
+    { 1.8713f, -11.3163f, 28.6073f, 0.5322f, 0.4023f },
+    { 2.4678f, -11.8439f, 28.8779f, 0.5411f, 0.3914f },
+    { 2.8841f, -12.4763f, 29.0787f, 0.5493f, 0.3812f },
+    { 2.413f, -12.0692f, 29.3259f, 0.5401f, 0.3831f },
+    { 2.34f, -12.3206f, 29.8048f, 0.5393f, 0.3741f },
+    { 1.8268f, -11.5209f, 28.9833f, 0.5309f, 0.395f },
+    { 1.7525f, -12.0242f, 29.8116f, 0.5297f, 0.3784f },
+    { 1.7966f, -11.7502f, 29.3791f, 0.5301f, 0.3871f },
+    { 1.1722f, -11.0649f, 28.7232f, 0.5212f, 0.405f },
+    { 1.1473f, -11.2924f, 29.0166f, 0.5205f, 0.3984f },
+    { 1.2405f, -10.8224f, 28.4293f, 0.5226f, 0.4117f },
+    { 0.647f, -10.3782f, 28.2753f, 0.5132f, 0.4199f },
+    { 1.1409f, -11.5343f, 29.343f, 0.5203f, 0.3912f },
+    { 1.1279f, -11.8195f, 29.7357f, 0.5202f, 0.3828f },
+    { 0.5405f, -11.9935f, 30.1726f, 0.5115f, 0.3757f },
+    { 1.0996f, -12.1286f, 30.156f, 0.5201f, 0.3739f },
+    { -0.0014f, -12.2652f, 30.6039f, 0.503f, 0.3676f },
+    { 0.5156f, -12.3244f, 30.5589f, 0.5113f, 0.3673f },
+    { 1.0474f, -12.4418f, 30.5652f, 0.5197f, 0.3654f },
+    { 1.691f, -12.3193f, 30.2535f, 0.5292f, 0.3695f },
+    { 1.609f, -12.6118f, 30.6775f, 0.5285f, 0.3611f },
+    { 2.2518f, -12.581f, 30.2894f, 0.5385f, 0.3651f },
+    { 1.5171f, -12.904f, 31.165f, 0.5275f, 0.3523f },
+    { 2.1509f, -12.8336f, 30.7546f, 0.5375f, 0.3566f },
+    { 2.0447f, -13.0814f, 31.256f, 0.5363f, 0.348f },
+    { 2.7189f, -12.9293f, 30.0885f, 0.5478f, 0.3634f },
+    { 2.6241f, -13.1067f, 30.6553f, 0.5464f, 0.3541f },
+    { 2.5123f, -13.2709f, 31.2436f, 0.5445f, 0.3449f },
+    { 3.0161f, -13.3838f, 30.5227f, 0.5544f, 0.3522f },
+    { 2.9097f, -13.4342f, 31.1979f, 0.5517f, 0.3424f },
+    { 3.4024f, -13.8519f, 29.795f, 0.5644f, 0.3588f },
+    { 3.3147f, -13.6174f, 30.4999f, 0.5606f, 0.3496f },
+    { 3.2269f, -13.5331f, 31.1884f, 0.5573f, 0.34f },
+    { 3.0451f, -13.564f, 31.7983f, 0.5528f, 0.3323f },
+    { 3.5572f, -13.8107f, 30.5191f, 0.5657f, 0.3471f },
+    { 3.5558f, -13.5651f, 31.1692f, 0.5631f, 0.3375f },
+    { 3.5907f, -14.1359f, 29.9011f, 0.569f, 0.3553f },
+    { 3.8416f, -13.7316f, 30.8633f, 0.5697f, 0.3396f },
+    { 3.7812f, -13.9665f, 30.5124f, 0.5701f, 0.3455f },
+    { 3.6763f, -14.5838f, 29.3423f, 0.5737f, 0.3613f },
+    { 4.048f, -14.0271f, 30.7847f, 0.5756f, 0.3404f },
+    { 3.7809f, -14.3087f, 30.0352f, 0.5724f, 0.352f },
+    { 3.9917f, -14.2329f, 30.5478f, 0.5753f, 0.3448f },
+    { 3.816f, -14.8244f, 29.5498f, 0.5765f, 0.3575f },
+    { 3.5841f, -14.2714f, 29.1357f, 0.5705f, 0.3654f },
+    { 4.248f, -14.5578f, 30.8966f, 0.5833f, 0.3412f },
+    { 4.3484f, -14.3829f, 30.9959f, 0.5844f, 0.3384f },
+    { 4.153f, -13.8255f, 30.8793f, 0.5766f, 0.3371f },
+    { 3.9871f, -13.5376f, 30.9697f, 0.5713f, 0.3358f },
+    { 4.3231f, -13.6408f, 30.879f, 0.5787f, 0.3341f },
+    { 4.2036f, -13.3727f, 30.9392f, 0.5744f, 0.3329f },
+    { 4.7635f, -14.0435f, 30.9996f, 0.589f, 0.3324f },
+    { 4.5749f, -13.4859f, 30.8314f, 0.582f, 0.3307f },
+    { 5.0201f, -13.9072f, 30.9305f, 0.5921f, 0.3293f },
+    { 5.2067f, -13.8523f, 30.8099f, 0.5947f, 0.3272f },
+    { 4.8587f, -13.3897f, 30.7238f, 0.586f, 0.3274f },
+    { 5.363f, -13.9277f, 30.5454f, 0.5985f, 0.325f },
+    { 5.1247f, -13.3811f, 30.5435f, 0.5902f, 0.3247f },
+    { 5.3505f, -13.4826f, 30.2354f, 0.5954f, 0.3219f },
+    { 5.4399f, -13.2626f, 30.2381f, 0.5934f, 0.32f },
+    { 5.5136f, -13.7173f, 29.7444f, 0.6025f, 0.3187f },
+    { 5.5284f, -14.1821f, 30.0447f, 0.6057f, 0.3216f },
+    { 5.6751f, -14.1058f, 29.1627f, 0.6109f, 0.3149f },
+    { 5.6385f, -13.5064f, 29.7307f, 0.6005f, 0.3168f },
+    { 5.7991f, -15.142f, 28.7932f, 0.6249f, 0.3124f },
+    { 5.8957f, -14.6692f, 28.5828f, 0.6205f, 0.3105f },
+    { 6.0366f, -15.4036f, 28.0185f, 0.6312f, 0.3052f },
+    { 6.2557f, -15.2877f, 27.9908f, 0.6293f, 0.3036f },
+    { 6.0865f, -14.4907f, 28.5557f, 0.6183f, 0.3089f },
+    { 6.4512f, -15.3028f, 28.1137f, 0.6277f, 0.3021f },
+    { 5.8234f, -13.9054f, 29.1384f, 0.6088f, 0.3133f },
+    { 6.2837f, -14.498f, 28.6771f, 0.617f, 0.3075f },
+    { 6.5594f, -15.3575f, 28.3761f, 0.6255f, 0.3005f },
+    { 6.3992f, -14.5824f, 28.9124f, 0.6153f, 0.3058f },
+    { 6.6191f, -15.4481f, 28.7259f, 0.6229f, 0.2986f },
+    { 6.4798f, -14.7295f, 29.2222f, 0.6135f, 0.3037f },
+    { 6.669f, -15.5704f, 29.1112f, 0.6201f, 0.2964f },
+    { 6.5721f, -14.9252f, 29.5669f, 0.6116f, 0.301f },
+    { 6.5984f, -16.2594f, 28.7506f, 0.6281f, 0.2914f },
+    { 6.6163f, -15.6416f, 29.4069f, 0.6177f, 0.2948f },
+    { 6.5569f, -15.238f, 29.8307f, 0.6111f, 0.2972f },
+    { 6.5321f, -16.1155f, 29.2773f, 0.622f, 0.2907f },
+    { 6.3999f, -16.9078f, 28.6245f, 0.6341f, 0.2859f },
+    { 6.1132f, -17.4313f, 28.8723f, 0.6364f, 0.2797f },
+    { 6.0539f, -17.2975f, 29.7437f, 0.6272f, 0.2765f },
+    { 6.2213f, -17.0217f, 29.4649f, 0.627f, 0.2807f },
+    { 6.0241f, -17.127f, 30.3507f, 0.62f, 0.2749f },
+    { 6.0614f, -16.7024f, 30.1823f, 0.6173f, 0.2801f },
+    { 6.3452f, -16.6311f, 29.2266f, 0.626f, 0.2856f },
+    { 5.7727f, -16.4279f, 30.9617f, 0.6078f, 0.2788f },
+    { 6.0732f, -16.2738f, 29.9527f, 0.616f, 0.2855f },
+    { 6.3145f, -15.7366f, 29.8974f, 0.6132f, 0.2916f },
+    { 5.736f, -15.9117f, 30.7117f, 0.6057f, 0.2856f },
+    { 6.3544f, -14.7672f, 30.3446f, 0.6031f, 0.3f },
+    { 6.0374f, -15.3142f, 30.5314f, 0.604f, 0.2931f },
+    { 6.3646f, -14.4025f, 30.0752f, 0.6035f, 0.3047f },
+    { 6.1025f, -14.4976f, 30.8203f, 0.5966f, 0.3014f },
+    { 5.7924f, -15.0397f, 31.0995f, 0.5964f, 0.294f },
+    { 6.1035f, -14.0808f, 30.5935f, 0.5964f, 0.3069f },
+    { 6.2358f, -14.1622f, 29.7757f, 0.6046f, 0.3079f },
+    { 6.1353f, -13.9889f, 29.4982f, 0.6061f, 0.3102f },
+    { 5.9737f, -13.7772f, 30.3766f, 0.5964f, 0.3108f },
+    { 6.0142f, -13.898f, 29.275f, 0.6076f, 0.3118f },
+    { 5.8915f, -13.5746f, 30.1267f, 0.5975f, 0.3135f },
+    { 5.799f, -13.4815f, 29.8946f, 0.5991f, 0.3153f },
+    { 5.5518f, -13.2221f, 30.4319f, 0.5917f, 0.3184f },
+    { 5.6071f, -13.316f, 30.6947f, 0.5899f, 0.3162f },
+    { 5.1357f, -13.1428f, 30.5662f, 0.5875f, 0.3231f },
+    { 5.1859f, -13.0935f, 30.783f, 0.5856f, 0.3216f },
+    { 4.7926f, -13.1343f, 30.7636f, 0.5826f, 0.3263f },
+    { 4.477f, -13.2246f, 30.8792f, 0.5782f, 0.3296f },
+    { 4.0688f, -13.3254f, 31.2075f, 0.5706f, 0.3309f },
+    { 4.3993f, -13.182f, 31.1295f, 0.5752f, 0.328f },
+    { 4.7767f, -13.0839f, 30.9986f, 0.5803f, 0.3248f },
+    { 3.8323f, -13.4118f, 31.6906f, 0.5647f, 0.327f },
+    { 5.2213f, -13.1891f, 31.0988f, 0.5835f, 0.3189f },
+    { 4.2716f, -13.2805f, 31.5689f, 0.5707f, 0.3245f },
+    { 4.7657f, -13.1814f, 31.3773f, 0.5774f, 0.3217f },
+    { 5.6403f, -13.4973f, 31.0377f, 0.5879f, 0.3132f },
+    { 5.2215f, -13.3208f, 31.4405f, 0.5813f, 0.3162f },
+    { 5.8316f, -13.9107f, 31.0891f, 0.5903f, 0.3078f },
+    { 5.4404f, -13.5207f, 31.5165f, 0.5831f, 0.3121f },
+    { 5.8311f, -14.3525f, 31.273f, 0.591f, 0.302f },
+    { 5.5921f, -13.8423f, 31.5291f, 0.5854f, 0.3077f },
+    { 5.5702f, -14.2553f, 31.7178f, 0.5857f, 0.3022f },
+    { 5.324f, -14.6705f, 32.0273f, 0.5842f, 0.2962f },
+    { 5.2769f, -14.1796f, 32.1431f, 0.5804f, 0.3025f },
+    { 5.5609f, -14.8471f, 31.599f, 0.5899f, 0.2949f },
+    { 5.0531f, -14.5392f, 32.4034f, 0.5789f, 0.2975f },
+    { 4.857f, -14.8033f, 32.559f, 0.5779f, 0.2938f },
+    { 4.9612f, -14.9959f, 32.395f, 0.581f, 0.2913f },
+    { 4.7195f, -14.4826f, 32.7462f, 0.5738f, 0.2981f },
+    { 5.4856f, -15.6203f, 31.4124f, 0.5967f, 0.2858f },
+    { 5.1669f, -15.3678f, 32.1025f, 0.5874f, 0.2866f },
+    { 5.4944f, -16.1527f, 31.7403f, 0.5985f, 0.278f },
+    { 5.1811f, -15.9256f, 32.4308f, 0.59f, 0.2775f },
+    { 4.7873f, -15.7954f, 32.946f, 0.5828f, 0.2775f },
+    { 4.6886f, -15.4335f, 32.7182f, 0.5801f, 0.2843f },
+    { 4.2345f, -15.3963f, 33.1259f, 0.5733f, 0.2846f },
+    { 4.5894f, -15.1397f, 32.7583f, 0.5766f, 0.289f },
+    { 4.2229f, -15.1342f, 33.0899f, 0.5713f, 0.289f },
+    { 3.8757f, -15.0116f, 33.3628f, 0.5655f, 0.2912f },
+    { 3.6091f, -14.7966f, 33.4942f, 0.5604f, 0.2953f },
+    { 4.0394f, -14.7429f, 33.2989f, 0.5658f, 0.295f },
+    { 3.4841f, -14.5138f, 33.401f, 0.5576f, 0.3007f },
+    { 3.8252f, -14.6525f, 33.3869f, 0.5625f, 0.297f },
+    { 3.8243f, -14.4133f, 33.3196f, 0.5615f, 0.3009f },
+    { 4.1045f, -14.4132f, 33.2045f, 0.5652f, 0.2999f },
+    { 4.2773f, -14.8434f, 33.0996f, 0.57f, 0.2932f },
+    { 4.3834f, -14.4556f, 33.024f, 0.5692f, 0.2987f },
+    { 4.5722f, -14.8456f, 32.8423f, 0.5741f, 0.2931f },
+    { 4.5194f, -14.0497f, 32.8522f, 0.5694f, 0.3045f },
+    { 4.9084f, -14.0991f, 32.5374f, 0.5748f, 0.3035f },
+    { 4.1647f, -14.0671f, 33.0391f, 0.565f, 0.3051f },
+    { 4.6639f, -13.7046f, 32.5735f, 0.5709f, 0.3093f },
+    { 5.0159f, -13.7438f, 32.283f, 0.5758f, 0.3084f },
+    { 5.3363f, -13.8089f, 31.9237f, 0.5808f, 0.3076f },
+    { 5.2978f, -13.5868f, 31.8048f, 0.5804f, 0.3108f },
+    { 5.0868f, -13.4821f, 32.0073f, 0.5771f, 0.3123f },
+    { 5.166f, -13.3798f, 31.7349f, 0.579f, 0.3144f },
+    { 4.7685f, -13.4639f, 32.2728f, 0.5726f, 0.3132f },
+    { 4.7848f, -13.3714f, 32.0347f, 0.5736f, 0.3157f },
+    { 4.7662f, -13.3147f, 31.767f, 0.5748f, 0.3182f },
+    { 4.2055f, -13.4068f, 32.0101f, 0.5672f, 0.3204f },
+    { 4.3128f, -13.4473f, 32.2662f, 0.5673f, 0.3171f },
+    { 3.5709f, -13.5996f, 32.2927f, 0.5585f, 0.3213f },
+    { 4.41f, -13.5215f, 32.4719f, 0.568f, 0.3137f },
+    { 3.8791f, -13.6148f, 32.5056f, 0.5616f, 0.3166f },
+    { 4.3136f, -13.749f, 32.7623f, 0.5666f, 0.3097f },
+    { 3.8269f, -14.1251f, 33.1297f, 0.561f, 0.3057f },
+    { 3.9636f, -13.8251f, 32.848f, 0.5625f, 0.3105f },
+    { 3.4891f, -14.1972f, 33.1554f, 0.5569f, 0.3067f },
+    { 4.0857f, -13.6409f, 32.6049f, 0.564f, 0.3138f },
+    { 3.6126f, -13.8811f, 32.8295f, 0.5582f, 0.3126f },
+    { 3.1938f, -14.2538f, 33.1523f, 0.5533f, 0.3078f },
+    { 3.3087f, -13.9157f, 32.7787f, 0.5544f, 0.3148f },
+    { 3.0998f, -13.9276f, 32.7672f, 0.5517f, 0.3162f },
+    { 3.283f, -13.6656f, 32.31f, 0.5549f, 0.323f },
+    { 3.5408f, -13.5008f, 31.76f, 0.5605f, 0.3289f },
+    { 3.0844f, -13.6874f, 32.3291f, 0.5521f, 0.3241f },
+    { 3.8f, -13.4519f, 31.2643f, 0.5666f, 0.3334f },
+    { 3.3082f, -13.5506f, 31.7912f, 0.5569f, 0.3305f },
+    { 2.8399f, -13.6986f, 32.3373f, 0.5485f, 0.3254f },
+    { 2.4068f, -13.9112f, 32.8561f, 0.5418f, 0.3192f },
+    { 2.682f, -13.9249f, 32.813f, 0.5458f, 0.3182f },
+    { 2.9146f, -13.9272f, 32.7828f, 0.5491f, 0.3172f },
+    { 2.5668f, -14.2368f, 33.2367f, 0.5446f, 0.3106f },
+    { 2.2957f, -14.2128f, 33.3043f, 0.5406f, 0.3114f },
+    { 2.2162f, -14.6033f, 33.6957f, 0.5405f, 0.3034f },
+    { 1.9807f, -14.1749f, 33.3615f, 0.5357f, 0.3126f },
+    { 1.8941f, -14.5694f, 33.76f, 0.5354f, 0.3046f },
+    { 1.5403f, -14.5389f, 33.8235f, 0.5296f, 0.3058f },
+    { 1.841f, -14.9883f, 34.0774f, 0.5358f, 0.297f },
+    { 1.4843f, -14.9663f, 34.1522f, 0.5297f, 0.298f },
+    { 1.1271f, -14.962f, 34.2381f, 0.5235f, 0.2984f },
+    { 1.4653f, -15.3413f, 34.3641f, 0.5302f, 0.2913f },
+    { 1.461f, -15.6902f, 34.5178f, 0.5307f, 0.2852f },
+    { -0.f, -15.698f, 34.7237f, 0.5031f, 0.2855f },
+    { -0.3672f, -15.6976f, 34.7131f, 0.4961f, 0.2854f },
+    { -0.7332f, -15.6951f, 34.6751f, 0.489f, 0.2853f },
+    { -1.1072f, -15.3405f, 34.4523f, 0.4821f, 0.2917f },
+    { -1.0966f, -15.6894f, 34.6033f, 0.482f, 0.2852f },
+    { -1.4844f, -14.9663f, 34.1522f, 0.4754f, 0.2988f },
+    { -1.4653f, -15.3413f, 34.3641f, 0.4752f, 0.2916f },
+    { -1.8411f, -14.9883f, 34.0774f, 0.4689f, 0.298f },
+    { -1.461f, -15.6902f, 34.5178f, 0.4749f, 0.2849f },
+    { -1.8277f, -15.3596f, 34.2852f, 0.4684f, 0.2908f },
+    { -2.1721f, -15.016f, 34.0063f, 0.4629f, 0.297f },
+    { -2.4903f, -14.6281f, 33.6199f, 0.4585f, 0.3045f },
+    { -2.1665f, -15.3841f, 34.2115f, 0.4621f, 0.2897f },
+    { -2.4525f, -15.0374f, 33.9311f, 0.4579f, 0.2961f },
+    { -2.7957f, -14.2524f, 33.1802f, 0.4546f, 0.3125f },
+    { -2.7244f, -14.6453f, 33.5496f, 0.4547f, 0.3038f },
+    { -2.9147f, -13.9272f, 32.7828f, 0.453f, 0.3202f },
+    { -2.9271f, -14.6563f, 33.5019f, 0.4515f, 0.303f },
+    { -3.0845f, -13.6874f, 32.3291f, 0.4495f, 0.3273f },
+    { -2.9837f, -14.2651f, 33.1563f, 0.4517f, 0.3115f },
+    { -3.0998f, -13.9276f, 32.7672f, 0.4502f, 0.3192f },
+    { -3.2831f, -13.6656f, 32.31f, 0.4464f, 0.3263f },
+    { -3.3088f, -13.9157f, 32.7787f, 0.4472f, 0.3178f },
+    { -3.5709f, -13.5996f, 32.2927f, 0.4425f, 0.3247f },
+    { -3.1938f, -14.2538f, 33.1523f, 0.4488f, 0.3104f },
+    { -3.1598f, -14.6247f, 33.4585f, 0.4483f, 0.3026f },
+    { -3.6127f, -13.8811f, 32.8295f, 0.4433f, 0.3155f },
+    { -3.4891f, -14.1972f, 33.1554f, 0.4449f, 0.3094f },
+    { -3.8791f, -13.6148f, 32.5056f, 0.4394f, 0.3198f },
+    { -4.0858f, -13.6409f, 32.6049f, 0.437f, 0.317f },
+    { -3.9636f, -13.8251f, 32.848f, 0.4388f, 0.3135f },
+    { -4.41f, -13.5215f, 32.4719f, 0.4327f, 0.3171f },
+    { -4.3129f, -13.4473f, 32.2662f, 0.4333f, 0.3205f },
+    { -4.3136f, -13.749f, 32.7623f, 0.4345f, 0.3128f },
+    { -3.827f, -14.1251f, 33.1297f, 0.4406f, 0.3084f },
+    { -3.4841f, -14.5138f, 33.401f, 0.4444f, 0.303f },
+    { -4.1647f, -14.0671f, 33.0391f, 0.4364f, 0.3078f },
+    { -3.8243f, -14.4133f, 33.3196f, 0.4403f, 0.3033f },
+    { -3.2482f, -15.0551f, 33.6761f, 0.4453f, 0.2935f },
+    { -3.6091f, -14.7966f, 33.4942f, 0.4417f, 0.2973f },
+    { -3.8252f, -14.6525f, 33.3869f, 0.4394f, 0.2992f },
+    { -2.9306f, -15.0568f, 33.79f, 0.45f, 0.2944f },
+    { -2.6995f, -15.0514f, 33.8573f, 0.4537f, 0.2953f },
+    { -2.4538f, -15.4031f, 34.1389f, 0.4569f, 0.2887f },
+    { -2.7198f, -15.4161f, 34.0699f, 0.4522f, 0.2877f },
+    { -2.9949f, -15.4222f, 34.0069f, 0.4477f, 0.2866f },
+    { -2.4702f, -15.7471f, 34.2951f, 0.4557f, 0.2819f },
+    { -2.7538f, -15.7601f, 34.2329f, 0.4506f, 0.2807f },
+    { -2.1756f, -15.7299f, 34.3642f, 0.4612f, 0.283f },
+    { -2.4776f, -16.0911f, 34.4515f, 0.4547f, 0.2751f },
+    { -1.83f, -15.7073f, 34.4382f, 0.4678f, 0.2841f },
+    { -2.1752f, -16.0759f, 34.5172f, 0.4605f, 0.2762f },
+    { -1.8234f, -16.0551f, 34.5917f, 0.4674f, 0.2774f },
+    { -1.4494f, -16.0391f, 34.6719f, 0.4748f, 0.2783f },
+    { -1.0805f, -16.0382f, 34.7546f, 0.482f, 0.2787f },
+    { -1.0725f, -16.4944f, 34.9014f, 0.482f, 0.2706f },
+    { -1.4459f, -16.4948f, 34.821f, 0.4745f, 0.2701f },
+    { -1.8207f, -16.5082f, 34.737f, 0.467f, 0.2691f },
+    { -2.1733f, -16.5257f, 34.6563f, 0.4599f, 0.2679f },
+    { -2.4802f, -17.1912f, 34.6764f, 0.4526f, 0.2552f },
+    { -2.4797f, -16.5382f, 34.5859f, 0.4538f, 0.2667f },
+    { -2.7698f, -16.1044f, 34.3917f, 0.4493f, 0.2737f },
+    { -2.7611f, -17.2031f, 34.5806f, 0.4466f, 0.2537f },
+    { -3.0662f, -15.7704f, 34.1796f, 0.4454f, 0.2792f },
+    { -2.7711f, -16.5512f, 34.5173f, 0.448f, 0.2653f },
+    { -3.0907f, -16.1192f, 34.3351f, 0.4435f, 0.272f },
+    { -3.3393f, -15.4604f, 33.8903f, 0.4423f, 0.2848f },
+    { -3.4416f, -15.8047f, 34.0818f, 0.4394f, 0.2772f },
+    { -3.7538f, -15.2702f, 33.4616f, 0.4368f, 0.2885f },
+    { -3.8138f, -15.5693f, 33.6603f, 0.4348f, 0.2819f },
+    { -3.8757f, -15.0116f, 33.3628f, 0.4366f, 0.293f },
+    { -4.2346f, -15.3963f, 33.1259f, 0.4289f, 0.2859f },
+    { -3.9142f, -15.8898f, 33.886f, 0.4323f, 0.2745f },
+    { -4.3269f, -15.698f, 33.3384f, 0.4268f, 0.2792f },
+    { -3.4641f, -16.1503f, 34.2403f, 0.4373f, 0.27f },
+    { -3.9135f, -16.2124f, 34.0656f, 0.4305f, 0.2677f },
+    { -4.4024f, -16.0188f, 33.6043f, 0.4248f, 0.2719f },
+    { -4.7392f, -16.56f, 33.4335f, 0.4161f, 0.2628f },
+    { -4.8245f, -16.1846f, 33.2488f, 0.4179f, 0.2701f },
+    { -4.7873f, -15.7954f, 32.946f, 0.4197f, 0.2783f },
+    { -5.062f, -16.8354f, 32.8856f, 0.4079f, 0.2616f },
+    { -4.8793f, -17.1986f, 32.927f, 0.4054f, 0.2552f },
+    { -5.0919f, -17.5006f, 32.0754f, 0.3946f, 0.2572f },
+    { -5.3543f, -17.1214f, 32.0771f, 0.3978f, 0.2633f },
+    { -5.1986f, -16.3928f, 32.7384f, 0.4104f, 0.2696f },
+    { -5.5427f, -16.649f, 31.9922f, 0.4012f, 0.2708f },
+    { -5.7727f, -16.4279f, 30.9617f, 0.394f, 0.2799f },
+    { -5.4945f, -16.1527f, 31.7403f, 0.4036f, 0.2789f },
+    { -5.1811f, -15.9256f, 32.4308f, 0.4123f, 0.2784f },
+    { -5.7361f, -15.9117f, 30.7117f, 0.3956f, 0.2873f },
+    { -4.6886f, -15.4335f, 32.7182f, 0.422f, 0.2856f },
+    { -5.4857f, -15.6203f, 31.4124f, 0.4048f, 0.2875f },
+    { -5.1669f, -15.3678f, 32.1025f, 0.4143f, 0.2883f },
+    { -4.2229f, -15.1342f, 33.0899f, 0.4306f, 0.2907f },
+    { -4.5895f, -15.1397f, 32.7583f, 0.4252f, 0.2907f },
+    { -4.0394f, -14.7429f, 33.2989f, 0.436f, 0.2971f },
+    { -4.2774f, -14.8434f, 33.0996f, 0.4318f, 0.2952f },
+    { -4.1045f, -14.4132f, 33.2045f, 0.4364f, 0.3023f },
+    { -4.3834f, -14.4556f, 33.024f, 0.4323f, 0.3011f },
+    { -4.5194f, -14.0497f, 32.8522f, 0.4318f, 0.3072f },
+    { -4.6639f, -13.7046f, 32.5735f, 0.4299f, 0.3125f },
+    { -4.7196f, -14.4826f, 32.7462f, 0.4275f, 0.3006f },
+    { -4.5723f, -14.8456f, 32.8423f, 0.4276f, 0.2951f },
+    { -4.9084f, -14.0991f, 32.5374f, 0.4262f, 0.3063f },
+    { -4.8571f, -14.8033f, 32.559f, 0.4235f, 0.296f },
+    { -4.9613f, -14.9959f, 32.395f, 0.4205f, 0.2933f },
+    { -5.0531f, -14.5392f, 32.4034f, 0.4223f, 0.3f },
+    { -5.3241f, -14.6705f, 32.0273f, 0.4168f, 0.2987f },
+    { -5.561f, -14.8471f, 31.599f, 0.411f, 0.2973f },
+    { -5.7925f, -15.0397f, 31.0995f, 0.4043f, 0.2965f },
+    { -5.8312f, -14.3525f, 31.273f, 0.4092f, 0.3051f },
+    { -5.5702f, -14.2553f, 31.7178f, 0.4147f, 0.3052f },
+    { -6.1026f, -14.4976f, 30.8203f, 0.4034f, 0.3047f },
+    { -5.2769f, -14.1796f, 32.1431f, 0.4203f, 0.3054f },
+    { -5.8316f, -13.9107f, 31.0891f, 0.4094f, 0.3115f },
+    { -5.0159f, -13.7438f, 32.283f, 0.4248f, 0.3116f },
+    { -5.5921f, -13.8423f, 31.5291f, 0.4147f, 0.3113f },
+    { -5.3364f, -13.8089f, 31.9237f, 0.4195f, 0.3109f },
+    { -4.7685f, -13.4639f, 32.2728f, 0.4278f, 0.3166f },
+    { -5.0868f, -13.4821f, 32.0073f, 0.4231f, 0.3158f },
+    { -4.7849f, -13.3714f, 32.0347f, 0.4266f, 0.3194f },
+    { -4.2056f, -13.4068f, 32.0101f, 0.4331f, 0.3241f },
+    { -5.166f, -13.3798f, 31.7349f, 0.4208f, 0.3183f },
+    { -4.7663f, -13.3147f, 31.767f, 0.425f, 0.3221f },
+    { -5.2978f, -13.5868f, 31.8048f, 0.4196f, 0.3144f },
+    { -5.4404f, -13.5207f, 31.5165f, 0.4167f, 0.3159f },
+    { -5.2215f, -13.3208f, 31.4405f, 0.4183f, 0.3203f },
+    { -5.6403f, -13.4973f, 31.0377f, 0.4115f, 0.3173f },
+    { -4.7658f, -13.1814f, 31.3773f, 0.422f, 0.326f },
+    { -5.2214f, -13.1891f, 31.0988f, 0.4156f, 0.3234f },
+    { -4.2717f, -13.2805f, 31.5689f, 0.429f, 0.3286f },
+    { -4.7768f, -13.0839f, 30.9986f, 0.4185f, 0.3296f },
+    { -3.8323f, -13.4118f, 31.6906f, 0.4354f, 0.331f },
+    { -4.3994f, -13.182f, 31.1295f, 0.4238f, 0.3327f },
+    { -3.8f, -13.4519f, 31.2643f, 0.433f, 0.3377f },
+    { -4.0688f, -13.3254f, 31.2075f, 0.4287f, 0.3354f },
+    { -3.9871f, -13.5376f, 30.9697f, 0.4274f, 0.3406f },
+    { -4.477f, -13.2246f, 30.8792f, 0.4203f, 0.3347f },
+    { -4.2036f, -13.3727f, 30.9392f, 0.4242f, 0.3378f },
+    { -4.153f, -13.8255f, 30.8793f, 0.4211f, 0.3426f },
+    { -4.575f, -13.4859f, 30.8314f, 0.4159f, 0.3363f },
+    { -4.3232f, -13.6408f, 30.879f, 0.4191f, 0.3396f },
+    { -4.248f, -14.5578f, 30.8966f, 0.4126f, 0.3477f },
+    { -4.3484f, -14.3829f, 30.9959f, 0.4118f, 0.345f },
+    { -4.7635f, -14.0435f, 30.9996f, 0.4076f, 0.3392f },
+    { -5.0201f, -13.9072f, 30.9305f, 0.4047f, 0.3362f },
+    { -4.8587f, -13.3897f, 30.7238f, 0.4118f, 0.3331f },
+    { -5.1247f, -13.3811f, 30.5435f, 0.4076f, 0.3304f },
+    { -5.3505f, -13.4826f, 30.2354f, 0.4023f, 0.3277f },
+    { -5.1358f, -13.1428f, 30.5662f, 0.4108f, 0.3284f },
+    { -5.5137f, -13.7173f, 29.7444f, 0.3951f, 0.3245f },
+    { -5.4399f, -13.2626f, 30.2381f, 0.4048f, 0.3253f },
+    { -5.6751f, -14.1058f, 29.1627f, 0.3865f, 0.3206f },
+    { -5.6386f, -13.5064f, 29.7307f, 0.3975f, 0.3221f },
+    { -5.5519f, -13.2221f, 30.4319f, 0.4068f, 0.3233f },
+    { -5.7991f, -13.4815f, 29.8946f, 0.3992f, 0.3203f },
+    { -5.186f, -13.0935f, 30.783f, 0.413f, 0.3265f },
+    { -5.8235f, -13.9054f, 29.1384f, 0.389f, 0.3185f },
+    { -5.6071f, -13.316f, 30.6947f, 0.409f, 0.3208f },
+    { -6.0142f, -13.898f, 29.275f, 0.3906f, 0.3167f },
+    { -5.8915f, -13.5746f, 30.1267f, 0.4011f, 0.3181f },
+    { -5.9737f, -13.7772f, 30.3766f, 0.4026f, 0.315f },
+    { -4.7927f, -13.1343f, 30.7636f, 0.4158f, 0.3315f },
+    { -6.1035f, -14.0808f, 30.5935f, 0.4031f, 0.3107f },
+    { -6.2358f, -14.1622f, 29.7757f, 0.3942f, 0.3121f },
+    { -6.3647f, -14.4025f, 30.0752f, 0.3958f, 0.3085f },
+    { -6.1353f, -13.9889f, 29.4982f, 0.3924f, 0.3147f },
+    { -6.2837f, -14.498f, 28.6771f, 0.3812f, 0.3121f },
+    { -6.3992f, -14.5824f, 28.9124f, 0.3832f, 0.3101f },
+    { -6.4798f, -14.7295f, 29.2222f, 0.3854f, 0.3076f },
+    { -6.4512f, -15.3028f, 28.1137f, 0.3707f, 0.3062f },
+    { -6.0866f, -14.4907f, 28.5557f, 0.3796f, 0.3139f },
+    { -6.5594f, -15.3575f, 28.3761f, 0.3733f, 0.3043f },
+    { -6.2557f, -15.2877f, 27.9908f, 0.3688f, 0.3079f },
+    { -6.6191f, -15.4481f, 28.7259f, 0.3763f, 0.3021f },
+    { -5.8957f, -14.6692f, 28.5828f, 0.3769f, 0.3158f },
+    { -6.5722f, -14.9252f, 29.5669f, 0.3877f, 0.3046f },
+    { -5.7991f, -15.142f, 28.7932f, 0.3718f, 0.3183f },
+    { -5.8579f, -15.7419f, 28.2077f, 0.3622f, 0.3124f },
+    { -6.0367f, -15.4036f, 28.0185f, 0.3664f, 0.3099f },
+    { -5.8324f, -16.3099f, 27.7164f, 0.3546f, 0.3061f },
+    { -5.9591f, -16.3054f, 27.4837f, 0.3551f, 0.3025f },
+    { -6.1588f, -16.3215f, 27.4523f, 0.3565f, 0.3002f },
+    { -6.3602f, -16.3335f, 27.5978f, 0.3589f, 0.2986f },
+    { -6.4921f, -16.3168f, 27.896f, 0.3625f, 0.2973f },
+    { -6.5671f, -16.2869f, 28.297f, 0.3669f, 0.2958f },
+    { -6.669f, -15.5704f, 29.1112f, 0.3794f, 0.2996f },
+    { -6.5984f, -16.2594f, 28.7506f, 0.3718f, 0.2941f },
+    { -6.6163f, -15.6416f, 29.4069f, 0.3821f, 0.2977f },
+    { -6.5569f, -15.238f, 29.8307f, 0.3887f, 0.3003f },
+    { -6.3145f, -15.7366f, 29.8974f, 0.3871f, 0.2941f },
+    { -6.3544f, -14.7672f, 30.3446f, 0.3967f, 0.3033f },
+    { -6.0374f, -15.3142f, 30.5314f, 0.3965f, 0.2957f },
+    { -6.0733f, -16.2738f, 29.9527f, 0.3849f, 0.2874f },
+    { 0.9136f, -19.4706f, 23.5573f, 0.6653f, 0.3291f },
+    { 0.9682f, -19.8123f, 24.1056f, 0.6606f, 0.323f },
+    { 0.4433f, -19.5579f, 23.4703f, 0.6711f, 0.327f },
+    { 0.4654f, -19.8913f, 24.0189f, 0.6668f, 0.321f },
+    { 0.9786f, -20.1927f, 24.6308f, 0.6558f, 0.3155f },
+    { 1.6023f, -20.2089f, 24.8162f, 0.6497f, 0.3201f },
+    { 0.4622f, -20.2411f, 24.548f, 0.6624f, 0.3146f },
+    { 1.5428f, -19.7808f, 24.2722f, 0.6545f, 0.3261f },
+    { 2.332f, -20.1417f, 25.2136f, 0.6437f, 0.3248f },
+    { 0.0018f, -20.2803f, 24.532f, 0.669f, 0.3136f },
+    { 0.0025f, -19.942f, 23.9953f, 0.673f, 0.3196f },
+    { 0.0028f, -19.6105f, 23.4418f, 0.677f, 0.3255f },
+    { 0.0023f, -19.3744f, 22.932f, 0.68f, 0.3298f },
+    { 0.4033f, -19.3336f, 22.9531f, 0.6752f, 0.3319f },
+    { 0.0015f, -19.1881f, 22.4512f, 0.6829f, 0.3341f },
+    { 0.3697f, -19.1629f, 22.4634f, 0.6789f, 0.3362f },
+    { 0.0006f, -19.0058f, 21.9846f, 0.6859f, 0.3373f },
+    { 0.8389f, -19.2606f, 23.024f, 0.67f, 0.3343f },
+    { 0.367f, -18.9902f, 21.997f, 0.6822f, 0.34f },
+    { -0.f, -18.8151f, 21.503f, 0.689f, 0.3404f },
+    { 0.7805f, -19.1068f, 22.5159f, 0.6744f, 0.3388f },
+    { 0.3895f, -18.8042f, 21.518f, 0.6856f, 0.3436f },
+    { -0.0002f, -18.6034f, 20.9776f, 0.6934f, 0.3431f },
+    { 0.7749f, -18.9335f, 22.0434f, 0.678f, 0.3431f },
+    { 0.4315f, -18.5935f, 20.9903f, 0.6897f, 0.3473f },
+    { -0.0003f, -18.4005f, 20.4247f, 0.6978f, 0.3458f },
+    { 0.8149f, -18.7388f, 21.5638f, 0.6816f, 0.3474f },
+    { 1.3118f, -18.586f, 21.6412f, 0.6768f, 0.352f },
+    { 0.8932f, -18.5204f, 21.0343f, 0.6856f, 0.3518f },
+    { 1.2643f, -18.8262f, 22.1328f, 0.673f, 0.3469f },
+    { 1.415f, -18.3406f, 21.1153f, 0.6809f, 0.3572f },
+    { 1.2724f, -19.0399f, 22.6248f, 0.6689f, 0.342f },
+    { 1.3359f, -19.2056f, 23.1521f, 0.6642f, 0.3371f },
+    { 1.8096f, -18.5697f, 22.2883f, 0.6669f, 0.3523f },
+    { 1.4332f, -19.4202f, 23.7046f, 0.6593f, 0.3319f },
+    { 1.8081f, -18.8259f, 22.8126f, 0.6624f, 0.3466f },
+    { 1.8504f, -19.0237f, 23.3583f, 0.6577f, 0.341f },
+    { 2.1147f, -19.6186f, 24.5218f, 0.648f, 0.3302f },
+    { 2.8578f, -19.4309f, 25.5075f, 0.6356f, 0.33f },
+    { 1.9486f, -19.2568f, 23.9273f, 0.6528f, 0.3356f },
+    { 2.6098f, -19.1476f, 24.8575f, 0.6408f, 0.3352f },
+    { 3.2365f, -18.7169f, 25.8344f, 0.6276f, 0.3352f },
+    { 2.4067f, -18.8303f, 24.2407f, 0.6457f, 0.3407f },
+    { 3.0214f, -18.5029f, 25.2065f, 0.6322f, 0.3416f },
+    { 3.4539f, -17.9965f, 26.0906f, 0.6144f, 0.3446f },
+    { 2.3389f, -18.5704f, 23.6632f, 0.6502f, 0.347f },
+    { 2.8319f, -18.2374f, 24.5825f, 0.6376f, 0.3474f },
+    { 3.3433f, -17.8197f, 25.4959f, 0.6218f, 0.35f },
+    { 3.2488f, -17.5746f, 24.8905f, 0.6282f, 0.356f },
+    { 2.8136f, -17.9557f, 24.0089f, 0.6419f, 0.3545f },
+    { 3.2872f, -17.2897f, 24.3373f, 0.633f, 0.3633f },
+    { 3.6861f, -16.5721f, 24.6789f, 0.6236f, 0.3727f },
+    { 2.8826f, -17.6759f, 23.4471f, 0.6461f, 0.3619f },
+    { 4.0239f, -15.4899f, 24.5928f, 0.6175f, 0.3893f },
+    { 3.3887f, -16.9957f, 23.8034f, 0.637f, 0.371f },
+    { 3.7939f, -16.2723f, 24.1816f, 0.6275f, 0.3803f },
+    { 3.8883f, -15.9742f, 23.6926f, 0.6313f, 0.3874f },
+    { 3.4835f, -16.7235f, 23.2558f, 0.6414f, 0.3781f },
+    { 4.0207f, -15.6724f, 23.2245f, 0.6349f, 0.3944f },
+    { 3.6158f, -16.4671f, 22.731f, 0.6458f, 0.3847f },
+    { 4.3966f, -14.3527f, 23.2462f, 0.6267f, 0.4127f },
+    { 4.2429f, -15.3613f, 22.7899f, 0.6383f, 0.4016f },
+    { 4.5968f, -12.6153f, 23.1855f, 0.6179f, 0.4355f },
+    { 4.6456f, -13.9637f, 22.7974f, 0.6304f, 0.4208f },
+    { 4.504f, -15.0596f, 22.3661f, 0.6418f, 0.4086f },
+    { 4.2803f, -11.8721f, 23.7635f, 0.605f, 0.441f },
+    { 4.8442f, -12.5385f, 22.5657f, 0.6263f, 0.4403f },
+    { 3.8974f, -11.2787f, 24.3085f, 0.5926f, 0.4445f },
+    { 4.5991f, -11.2225f, 23.1284f, 0.6117f, 0.4533f },
+    { 4.3373f, -10.9258f, 23.6081f, 0.6025f, 0.454f },
+    { 4.8256f, -11.3375f, 22.6118f, 0.6201f, 0.455f },
+    { 4.6412f, -9.9331f, 22.9648f, 0.6087f, 0.4705f },
+    { 4.8691f, -10.1188f, 22.4273f, 0.6178f, 0.4712f },
+    { 5.1144f, -10.3294f, 21.8244f, 0.6279f, 0.4719f },
+    { 4.3908f, -9.7556f, 23.4816f, 0.5996f, 0.4697f },
+    { 5.0765f, -11.3843f, 22.0118f, 0.6292f, 0.4578f },
+    { 3.971f, -10.5139f, 24.1599f, 0.5911f, 0.4554f },
+    { 4.0385f, -9.5368f, 24.0752f, 0.5885f, 0.4688f },
+    { 3.431f, -10.0533f, 24.8929f, 0.5757f, 0.4559f },
+    { 3.5048f, -9.2271f, 24.8429f, 0.5735f, 0.4677f },
+    { 4.1715f, -8.3259f, 23.9411f, 0.5871f, 0.486f },
+    { 3.6203f, -8.1551f, 24.7637f, 0.5719f, 0.4833f },
+    { 4.5545f, -8.4036f, 23.2132f, 0.5995f, 0.489f },
+    { 4.3328f, -7.0074f, 23.7983f, 0.5862f, 0.5049f },
+    { 4.822f, -8.5427f, 22.5615f, 0.6104f, 0.4907f },
+    { 3.7594f, -6.9353f, 24.6717f, 0.5708f, 0.5013f },
+    { 4.7602f, -7.0036f, 22.9254f, 0.6004f, 0.5093f },
+    { 4.4848f, -5.7075f, 23.6871f, 0.5855f, 0.5238f },
+    { 3.0677f, -6.8127f, 25.4736f, 0.555f, 0.4987f },
+    { 3.9039f, -5.6658f, 24.5835f, 0.5701f, 0.5202f },
+    { 2.9487f, -7.9309f, 25.5508f, 0.5558f, 0.4815f },
+    { 3.2032f, -5.5785f, 25.3755f, 0.5548f, 0.5176f },
+    { 2.8527f, -8.8718f, 25.609f, 0.557f, 0.4671f },
+    { 2.2856f, -6.6646f, 26.132f, 0.5398f, 0.4972f },
+    { 2.2047f, -7.6928f, 26.1728f, 0.5405f, 0.4808f },
+    { 2.1454f, -8.5164f, 26.1976f, 0.5415f, 0.4675f },
+    { 1.4827f, -6.522f, 26.6075f, 0.5259f, 0.4966f },
+    { 2.7867f, -9.5742f, 25.6498f, 0.5587f, 0.4564f },
+    { 1.4414f, -7.4879f, 26.6108f, 0.5265f, 0.4809f },
+    { 2.1074f, -9.1071f, 26.2734f, 0.5426f, 0.4577f },
+    { 1.4179f, -8.2301f, 26.605f, 0.5274f, 0.4683f },
+    { 3.3705f, -10.6881f, 25.0073f, 0.5771f, 0.4464f },
+    { 2.7524f, -10.1115f, 25.7483f, 0.56f, 0.4479f },
+    { 2.7519f, -10.5573f, 25.9796f, 0.56f, 0.4397f },
+    { 2.0958f, -9.56f, 26.4196f, 0.5433f, 0.4497f },
+    { 2.1157f, -9.9699f, 26.6556f, 0.5434f, 0.4417f },
+    { 1.4085f, -8.7366f, 26.7265f, 0.5278f, 0.4591f },
+    { 1.4114f, -9.1244f, 26.9342f, 0.5279f, 0.4514f },
+    { 1.4245f, -9.5107f, 27.1869f, 0.5278f, 0.4433f },
+    { 0.7164f, -9.2664f, 27.4523f, 0.5148f, 0.4445f },
+    { 0.7129f, -9.6474f, 27.7159f, 0.5145f, 0.4363f },
+    { 0.6872f, -10.0263f, 27.997f, 0.514f, 0.4279f },
+    { -0.002f, -10.3358f, 28.3174f, 0.5029f, 0.4203f },
+    { -0.0012f, -9.9712f, 28.046f, 0.5029f, 0.4284f },
+    { -0.6904f, -10.0263f, 27.997f, 0.4916f, 0.4283f },
+    { -0.0006f, -9.5814f, 27.771f, 0.5029f, 0.4369f },
+    { -0.7145f, -9.6474f, 27.7159f, 0.491f, 0.4367f },
+    { -1.4263f, -9.8843f, 27.4774f, 0.4777f, 0.436f },
+    { -0.7173f, -9.2664f, 27.4523f, 0.4908f, 0.4449f },
+    { -2.1338f, -10.3311f, 26.982f, 0.4616f, 0.435f },
+    { -1.4256f, -9.5107f, 27.1869f, 0.4771f, 0.4442f },
+    { -2.7621f, -10.9193f, 26.347f, 0.4447f, 0.4337f },
+    { -2.1167f, -9.9699f, 26.6556f, 0.4608f, 0.4431f },
+    { -2.7526f, -10.5573f, 25.9796f, 0.4433f, 0.4419f },
+    { -1.4121f, -9.1244f, 26.9342f, 0.4771f, 0.4522f },
+    { -2.0965f, -9.56f, 26.4196f, 0.461f, 0.4511f },
+    { -3.3712f, -10.6881f, 25.0073f, 0.4259f, 0.449f },
+    { -2.7531f, -10.1115f, 25.7483f, 0.4436f, 0.4498f },
+    { -2.7873f, -9.5742f, 25.6498f, 0.4452f, 0.4582f },
+    { -2.8534f, -8.8718f, 25.609f, 0.4472f, 0.4687f },
+    { -2.1081f, -9.1071f, 26.2734f, 0.4619f, 0.459f },
+    { -2.1461f, -8.5164f, 26.1976f, 0.4632f, 0.4686f },
+    { -2.9494f, -7.9309f, 25.5508f, 0.4487f, 0.4829f },
+    { -2.2053f, -7.6928f, 26.1728f, 0.4644f, 0.4818f },
+    { -3.0684f, -6.8127f, 25.4736f, 0.4497f, 0.4998f },
+    { -2.2863f, -6.6646f, 26.132f, 0.4653f, 0.498f },
+    { -3.9046f, -5.6658f, 24.5835f, 0.4345f, 0.5215f },
+    { -3.2039f, -5.5785f, 25.3755f, 0.4502f, 0.5186f },
+    { -4.621f, -4.4088f, 23.5643f, 0.4195f, 0.544f },
+    { -4.0417f, -4.3654f, 24.4757f, 0.4349f, 0.5407f },
+    { -3.3337f, -4.2895f, 25.2603f, 0.4502f, 0.5382f },
+    { -5.0805f, -4.4117f, 22.5919f, 0.4043f, 0.548f },
+    { -4.1584f, -3.0531f, 24.3246f, 0.4345f, 0.56f },
+    { -5.4319f, -4.3538f, 21.5417f, 0.3891f, 0.5529f },
+    { -4.7322f, -3.0937f, 23.3863f, 0.4191f, 0.563f },
+    { -5.1656f, -3.122f, 22.4096f, 0.4043f, 0.5663f },
+    { -4.2339f, -1.787f, 24.1449f, 0.4338f, 0.5786f },
+    { -4.7882f, -1.8238f, 23.1851f, 0.4184f, 0.5814f },
+    { -5.4748f, -3.11f, 21.3905f, 0.3897f, 0.5702f },
+    { -5.1794f, -1.8683f, 22.2155f, 0.404f, 0.5842f },
+    { -5.6756f, -3.0296f, 20.3253f, 0.3752f, 0.5752f },
+    { -5.4374f, -1.8859f, 21.2336f, 0.3902f, 0.5874f },
+    { -5.6866f, -4.2153f, 20.3967f, 0.3732f, 0.5592f },
+    { -5.5921f, -1.842f, 20.2366f, 0.3767f, 0.5915f },
+    { -5.6847f, -2.9009f, 19.1205f, 0.3592f, 0.5813f },
+    { -5.5733f, -1.7571f, 19.1008f, 0.3617f, 0.5967f },
+    { -5.4468f, -0.6985f, 20.1358f, 0.3777f, 0.6074f },
+    { -5.4151f, -0.6518f, 19.0527f, 0.3633f, 0.6119f },
+    { -5.323f, -0.7176f, 21.0761f, 0.3905f, 0.6039f },
+    { -5.267f, 0.4512f, 18.984f, 0.3643f, 0.6273f },
+    { -5.1049f, -0.6984f, 22.0311f, 0.4038f, 0.6009f },
+    { -5.3024f, 0.4375f, 20.0263f, 0.3783f, 0.6234f },
+    { -5.1996f, 0.4373f, 20.9333f, 0.3906f, 0.6203f },
+    { -5.186f, 1.5882f, 18.9023f, 0.3648f, 0.6431f },
+    { -5.2216f, 1.6023f, 19.9117f, 0.3784f, 0.6398f },
+    { -5.0405f, 0.4766f, 17.6308f, 0.3462f, 0.6324f },
+    { -5.1557f, 2.744f, 18.8434f, 0.3653f, 0.6591f },
+    { -5.1669f, -0.5883f, 17.6695f, 0.345f, 0.6178f },
+    { -4.9857f, 1.5756f, 17.6321f, 0.3477f, 0.6475f },
+    { -4.6259f, 0.5428f, 16.166f, 0.3264f, 0.6385f },
+    { -5.311f, -1.6513f, 17.7021f, 0.3433f, 0.6033f },
+    { -4.6908f, -0.5049f, 16.1805f, 0.3248f, 0.6244f },
+    { -5.4187f, -2.7441f, 17.6827f, 0.3403f, 0.5888f },
+    { -4.7867f, -1.5518f, 16.2096f, 0.323f, 0.6104f },
+    { -5.7364f, -4.03f, 19.1088f, 0.3559f, 0.5665f },
+    { -5.7157f, -5.0912f, 19.0622f, 0.352f, 0.5531f },
+    { -5.4731f, -3.8316f, 17.6296f, 0.3364f, 0.5748f },
+    { -4.8733f, -2.6103f, 16.1746f, 0.3199f, 0.5967f },
+    { -5.4576f, -4.8784f, 17.5615f, 0.3317f, 0.5618f },
+    { -4.9258f, -3.6752f, 16.1129f, 0.3159f, 0.5832f },
+    { -5.6358f, -6.0617f, 18.9843f, 0.3475f, 0.5411f },
+    { -5.5102f, -6.9188f, 18.8786f, 0.3427f, 0.5307f },
+    { -5.3951f, -5.8521f, 17.5192f, 0.3271f, 0.5498f },
+    { -5.4109f, -7.6691f, 18.7511f, 0.3379f, 0.5219f },
+    { -5.3085f, -6.7199f, 17.5437f, 0.3236f, 0.5387f },
+    { -5.2485f, -7.483f, 17.5762f, 0.3206f, 0.5291f },
+    { -4.9217f, -7.4208f, 16.3097f, 0.3014f, 0.5355f },
+    { -4.8901f, -6.6489f, 16.1782f, 0.3035f, 0.5457f },
+    { -4.4181f, -7.4693f, 14.9799f, 0.2807f, 0.5421f },
+    { -4.8945f, -5.7514f, 16.0686f, 0.3066f, 0.5574f },
+    { -4.3061f, -6.6908f, 14.8223f, 0.283f, 0.5524f },
+    { -3.7496f, -7.7013f, 13.8263f, 0.2603f, 0.5484f },
+    { -3.5676f, -6.8775f, 13.6899f, 0.2637f, 0.5587f },
+    { -2.6859f, -7.2408f, 12.9953f, 0.247f, 0.5647f },
+    { -4.2359f, -5.7525f, 14.7078f, 0.2866f, 0.5643f },
+    { -3.4389f, -5.847f, 13.6111f, 0.2686f, 0.5707f },
+    { -4.1813f, -4.7053f, 14.6832f, 0.2911f, 0.5772f },
+    { -3.3332f, -4.7405f, 13.5912f, 0.2735f, 0.5837f },
+    { -2.5228f, -6.0262f, 12.9528f, 0.2538f, 0.5769f },
+    { -1.7543f, -7.5753f, 12.5778f, 0.2335f, 0.5712f },
+    { -2.4663f, -4.8162f, 12.9531f, 0.2601f, 0.5894f },
+    { -0.9231f, -8.9705f, 12.2122f, 0.2139f, 0.5718f },
+    { -1.5978f, -6.1896f, 12.5759f, 0.2419f, 0.5832f },
+    { -0.8664f, -7.6756f, 12.2769f, 0.2236f, 0.5795f },
+    { -0.7939f, -9.8878f, 12.0857f, 0.2047f, 0.5694f },
+    { -0.6161f, -10.7121f, 12.0559f, 0.1957f, 0.5698f },
+    { -0.0003f, -10.7285f, 12.0196f, 0.1912f, 0.5752f },
+    { -0.0003f, -9.895f, 11.9995f, 0.1981f, 0.5781f },
+    { -0.0003f, -8.962f, 12.0855f, 0.205f, 0.5811f },
+    { -0.0003f, -7.6672f, 12.1556f, 0.2155f, 0.5886f },
+    { -0.7738f, -6.2368f, 12.3236f, 0.2327f, 0.5899f },
+    { -0.0003f, -6.2313f, 12.2287f, 0.226f, 0.5961f },
+    { -1.6103f, -4.8821f, 12.6084f, 0.2495f, 0.5948f },
+    { -0.7951f, -4.8876f, 12.3965f, 0.2401f, 0.6003f },
+    { -0.0003f, -4.8754f, 12.3238f, 0.2314f, 0.6059f },
+    { -0.8556f, -3.6402f, 12.4792f, 0.2458f, 0.6108f },
+    { -0.0003f, -3.6194f, 12.4319f, 0.2368f, 0.6157f },
+    { -0.0003f, -2.4833f, 12.544f, 0.239f, 0.6255f },
+    { -1.6824f, -3.6618f, 12.6499f, 0.2556f, 0.6061f },
+    { -0.8804f, -2.5066f, 12.5553f, 0.2496f, 0.6213f },
+    { -0.0003f, -1.3835f, 12.6444f, 0.2412f, 0.6352f },
+    { -0.8421f, -1.4057f, 12.6309f, 0.2516f, 0.6323f },
+    { -0.0003f, -0.2359f, 12.7173f, 0.2426f, 0.6461f },
+    { -1.7046f, -2.5383f, 12.6748f, 0.2598f, 0.6174f },
+    { -0.7134f, -0.2566f, 12.712f, 0.2518f, 0.6441f },
+    { -0.0003f, 0.9183f, 12.859f, 0.2441f, 0.657f },
+    { -1.6859f, -1.2893f, 12.6659f, 0.2628f, 0.6307f },
+    { -0.5694f, 0.898f, 12.8729f, 0.251f, 0.6561f },
+    { -0.0003f, 2.038f, 13.1656f, 0.2437f, 0.6671f },
+    { -1.2749f, -0.1835f, 12.7011f, 0.2592f, 0.6437f },
+    { -0.4851f, 2.0153f, 13.1877f, 0.25f, 0.6675f },
+    { -0.0003f, 3.1054f, 13.4669f, 0.2433f, 0.6773f },
+    { -1.0726f, 0.8969f, 12.8702f, 0.2576f, 0.6558f },
+    { -0.9605f, 1.976f, 13.1725f, 0.2562f, 0.6677f },
+    { -1.4438f, 0.975f, 12.7885f, 0.2627f, 0.6563f },
+    { -1.5331f, 0.119f, 12.6747f, 0.263f, 0.6465f },
+    { -0.5369f, 3.0033f, 13.4779f, 0.2499f, 0.6781f },
+    { -1.876f, -0.1684f, 12.7147f, 0.2672f, 0.6426f },
+    { -1.8898f, 0.9083f, 12.788f, 0.2687f, 0.6549f },
+    { -2.4504f, -0.2707f, 13.0061f, 0.2753f, 0.6399f },
+    { -1.4172f, 1.9491f, 13.0265f, 0.2625f, 0.6676f },
+    { -2.5569f, 0.8713f, 13.0546f, 0.2779f, 0.6534f },
+    { -0.9841f, 3.0147f, 13.4485f, 0.2558f, 0.6795f },
+    { -1.4716f, 2.9679f, 13.2575f, 0.2627f, 0.6797f },
+    { -1.1887f, 3.9738f, 13.5391f, 0.2569f, 0.6912f },
+    { -0.8012f, 3.7698f, 13.5647f, 0.2521f, 0.6876f },
+    { -1.6258f, 3.9578f, 13.3504f, 0.2634f, 0.6921f },
+    { -0.5292f, 3.5216f, 13.4724f, 0.2485f, 0.6839f },
+    { -1.9661f, 1.925f, 12.9585f, 0.2702f, 0.667f },
+    { -2.0777f, 2.9025f, 13.145f, 0.2715f, 0.6791f },
+    { -2.7182f, 1.894f, 13.1769f, 0.2805f, 0.6658f },
+    { -2.8804f, 2.8583f, 13.3511f, 0.2829f, 0.6779f },
+    { -2.1976f, 3.8615f, 13.2665f, 0.2724f, 0.6915f },
+    { -3.6761f, 2.8161f, 13.9557f, 0.297f, 0.6757f },
+    { -2.9894f, 3.825f, 13.555f, 0.2849f, 0.6907f },
+    { -1.8339f, 4.8779f, 13.3203f, 0.2638f, 0.7041f },
+    { -2.3556f, 4.7798f, 13.2663f, 0.2728f, 0.7041f },
+    { -1.4266f, 4.953f, 13.5394f, 0.2574f, 0.7033f },
+    { -2.0501f, 5.6875f, 13.1822f, 0.2629f, 0.7154f },
+    { -1.0532f, 4.2824f, 13.5339f, 0.254f, 0.6945f },
+    { -1.6629f, 5.8037f, 13.4301f, 0.2562f, 0.7142f },
+    { -1.3726f, 5.9438f, 13.5233f, 0.2512f, 0.7142f },
+    { -1.8233f, 6.5378f, 13.2099f, 0.2539f, 0.7241f },
+    { -1.2398f, 5.2187f, 13.541f, 0.2535f, 0.7058f },
+    { -1.4998f, 6.6892f, 13.3368f, 0.2482f, 0.7236f },
+    { -1.1553f, 6.0662f, 13.5033f, 0.2473f, 0.7144f },
+    { -1.9902f, 7.3118f, 12.7804f, 0.252f, 0.7356f },
+    { -1.2274f, 7.0697f, 13.4952f, 0.2403f, 0.7248f },
+    { -1.6551f, 7.4604f, 12.8999f, 0.2463f, 0.7348f },
+    { -2.2488f, 6.4341f, 12.9188f, 0.2612f, 0.7265f },
+    { -2.5814f, 5.6349f, 13.088f, 0.2722f, 0.7169f },
+    { -2.4042f, 7.1653f, 12.5126f, 0.2591f, 0.738f },
+    { -3.1092f, 4.7741f, 13.6396f, 0.2859f, 0.704f },
+    { -2.7982f, 6.4121f, 12.7777f, 0.2707f, 0.7293f },
+    { -3.3039f, 5.6855f, 13.4556f, 0.2852f, 0.7179f },
+    { -3.7802f, 3.8327f, 14.2086f, 0.2998f, 0.6893f },
+    { -3.8866f, 4.8602f, 14.337f, 0.3014f, 0.7038f },
+    { -4.4795f, 5.0374f, 15.2556f, 0.3174f, 0.7035f },
+    { -4.0694f, 5.8775f, 14.1346f, 0.3005f, 0.7192f },
+    { -3.4932f, 6.5057f, 13.1008f, 0.2832f, 0.7312f },
+    { -4.7301f, 6.2492f, 14.9744f, 0.3164f, 0.7218f },
+    { -2.9292f, 7.0966f, 12.3816f, 0.2683f, 0.7408f },
+    { -4.2446f, 6.7848f, 13.7119f, 0.2975f, 0.7338f },
+    { -3.5973f, 7.1813f, 12.6724f, 0.28f, 0.7428f },
+    { -2.5651f, 7.7896f, 11.9811f, 0.2571f, 0.7495f },
+    { -3.0389f, 7.7099f, 11.8268f, 0.2649f, 0.7526f },
+    { -2.23f, 8.0027f, 12.1153f, 0.2508f, 0.7488f },
+    { -2.7803f, 8.2157f, 11.3418f, 0.2557f, 0.7605f },
+    { -2.6095f, 8.488f, 11.1885f, 0.2509f, 0.7635f },
+    { -3.1915f, 8.2737f, 11.0403f, 0.2603f, 0.7661f },
+    { -3.7843f, 8.3768f, 11.1001f, 0.2681f, 0.77f },
+    { -2.2533f, 8.7223f, 11.1508f, 0.245f, 0.764f },
+    { -3.2135f, 8.9785f, 10.0499f, 0.2518f, 0.7815f },
+    { -1.8893f, 8.1679f, 12.1815f, 0.2453f, 0.7482f },
+    { -2.6424f, 9.3586f, 9.9186f, 0.242f, 0.7823f },
+    { -1.8871f, 9.1072f, 11.2305f, 0.2371f, 0.764f },
+    { -2.1858f, 9.7707f, 10.0171f, 0.2335f, 0.7811f },
+    { -1.423f, 7.8798f, 13.0264f, 0.2386f, 0.7365f },
+    { -1.6212f, 8.528f, 12.2719f, 0.2382f, 0.7489f },
+    { -1.686f, 9.8316f, 11.4292f, 0.2264f, 0.7653f },
+    { -1.5037f, 9.3259f, 12.4785f, 0.2269f, 0.7524f },
+    { -1.3177f, 8.8387f, 13.3154f, 0.2252f, 0.7418f },
+    { -1.6844f, 10.7396f, 11.6546f, 0.2143f, 0.7673f },
+    { -1.5365f, 10.3309f, 12.7013f, 0.2154f, 0.7561f },
+    { -1.8522f, 11.2617f, 10.508f, 0.2132f, 0.7785f },
+    { -1.3306f, 10.0007f, 13.6088f, 0.209f, 0.749f },
+    { -1.9026f, 10.4453f, 10.247f, 0.2231f, 0.7802f },
+    { -2.1172f, 11.9321f, 9.3005f, 0.2068f, 0.7935f },
+    { -2.1918f, 11.2567f, 9.0115f, 0.2165f, 0.7967f },
+    { -2.3471f, 12.5546f, 8.2769f, 0.2005f, 0.8085f },
+    { -2.4823f, 10.6719f, 8.7468f, 0.2255f, 0.7998f },
+    { -2.4339f, 11.988f, 7.9756f, 0.2095f, 0.8104f },
+    { -2.409f, 12.9331f, 7.6817f, 0.1968f, 0.811f },
+    { -2.952f, 10.3122f, 8.5958f, 0.2333f, 0.803f },
+    { -2.7075f, 11.4725f, 7.6902f, 0.2172f, 0.8154f },
+    { -2.5092f, 12.3612f, 7.3921f, 0.205f, 0.8172f },
+    { -2.4209f, 13.1583f, 7.2984f, 0.193f, 0.8134f },
+    { -2.5191f, 12.5297f, 7.0336f, 0.2019f, 0.8205f },
+    { -2.7918f, 11.834f, 7.1182f, 0.2126f, 0.8232f },
+    { -2.5652f, 12.6466f, 6.6728f, 0.1992f, 0.824f },
+    { -2.5004f, 13.3208f, 6.9105f, 0.1908f, 0.817f },
+    { -2.8068f, 11.9588f, 6.7884f, 0.2098f, 0.827f },
+    { -2.6256f, 12.7151f, 6.1483f, 0.1952f, 0.829f },
+    { -2.5929f, 13.3988f, 6.3365f, 0.1886f, 0.8206f },
+    { -2.8241f, 12.0494f, 6.4586f, 0.2069f, 0.8306f },
+    { -2.8533f, 12.1199f, 5.9837f, 0.2025f, 0.8355f },
+    { -3.2813f, 11.7509f, 6.3428f, 0.2135f, 0.8363f },
+    { -3.3045f, 11.8159f, 5.8972f, 0.2089f, 0.8412f },
+    { -2.9043f, 12.1848f, 5.2186f, 0.1952f, 0.843f },
+    { -3.2672f, 11.6695f, 6.6509f, 0.2164f, 0.8325f },
+    { -3.3529f, 11.8807f, 5.1924f, 0.2016f, 0.8486f },
+    { -2.6785f, 12.7381f, 5.299f, 0.1885f, 0.8369f },
+    { -2.6442f, 13.3703f, 5.3946f, 0.1818f, 0.8306f },
+    { -2.7133f, 12.7271f, 4.4776f, 0.1818f, 0.8443f },
+    { -2.6679f, 13.2905f, 4.4611f, 0.1749f, 0.8406f },
+    { -2.9445f, 12.2273f, 4.4969f, 0.1881f, 0.8498f },
+    { -2.719f, 12.6933f, 4.0369f, 0.1778f, 0.8478f },
+    { -2.678f, 13.2148f, 3.9121f, 0.1713f, 0.8428f },
+    { -2.9413f, 12.2307f, 4.152f, 0.1843f, 0.8528f },
+    { -2.703f, 12.664f, 3.7883f, 0.1748f, 0.8491f },
+    { -2.6841f, 13.1716f, 3.5777f, 0.1676f, 0.8451f },
+    { -2.6956f, 13.1894f, 3.2881f, 0.1632f, 0.8454f },
+    { -2.9087f, 12.2137f, 3.983f, 0.1821f, 0.8538f },
+    { -2.6725f, 12.6664f, 3.5433f, 0.1714f, 0.8501f },
+    { -2.6939f, 13.2283f, 2.9969f, 0.1589f, 0.8457f },
+    { -2.6417f, 12.6636f, 3.2726f, 0.1675f, 0.8514f },
+    { -2.6603f, 13.2481f, 2.6574f, 0.1538f, 0.8471f },
+    { -2.8604f, 12.1949f, 3.789f, 0.1793f, 0.855f },
+    { -2.6249f, 12.6184f, 2.947f, 0.1632f, 0.8534f },
+    { -2.6119f, 13.2531f, 2.3349f, 0.1486f, 0.8485f },
+    { -2.8241f, 12.1505f, 3.5452f, 0.176f, 0.8567f },
+    { -3.2592f, 11.831f, 3.7193f, 0.1839f, 0.862f },
+    { -2.8274f, 12.0571f, 3.227f, 0.1721f, 0.8595f },
+    { -2.6071f, 12.56f, 2.6269f, 0.159f, 0.8556f },
+    { -2.5738f, 12.5175f, 2.3728f, 0.1555f, 0.8571f },
+    { -2.566f, 13.2472f, 2.0944f, 0.1456f, 0.849f },
+    { -2.8373f, 11.9463f, 2.8935f, 0.1682f, 0.8625f },
+    { -2.5313f, 12.5325f, 2.1073f, 0.1513f, 0.8581f },
+    { -2.5268f, 13.2282f, 1.858f, 0.1425f, 0.8496f },
+    { -2.4987f, 13.1936f, 1.5477f, 0.1379f, 0.852f },
+    { -2.8208f, 11.8496f, 2.604f, 0.1646f, 0.865f },
+    { -2.716f, 11.6718f, 2.2742f, 0.16f, 0.8678f },
+    { -2.4859f, 12.6468f, 1.7529f, 0.1452f, 0.8585f },
+    { -2.4653f, 13.1511f, 1.2609f, 0.1334f, 0.8545f },
+    { -2.4374f, 12.7392f, 1.4217f, 0.1395f, 0.859f },
+    { -2.5258f, 12.1104f, 1.8032f, 0.1493f, 0.8641f },
+    { -2.3855f, 12.6881f, 1.2257f, 0.1367f, 0.8606f },
+    { -2.4104f, 13.1086f, 1.0948f, 0.1317f, 0.8553f },
+    { -2.465f, 12.3303f, 1.5322f, 0.1437f, 0.8629f },
+    { -2.4127f, 12.1788f, 1.3605f, 0.1418f, 0.8652f },
+    { -2.4472f, 11.8063f, 1.5737f, 0.1474f, 0.8683f },
+    { -2.3183f, 11.9758f, 1.1673f, 0.1397f, 0.8683f },
+    { -2.3314f, 12.5559f, 1.0819f, 0.1351f, 0.8629f },
+    { -2.3647f, 12.9214f, 1.0142f, 0.1301f, 0.8561f },
+    { -2.3774f, 12.9855f, 0.8619f, 0.1277f, 0.8586f },
+    { -2.2763f, 12.4051f, 0.9074f, 0.1332f, 0.8657f },
+    { -2.3833f, 12.8375f, 0.6664f, 0.1254f, 0.8612f },
+    { -2.2217f, 12.2277f, 0.7152f, 0.1312f, 0.8688f },
+    { -2.2249f, 11.7711f, 0.9815f, 0.1378f, 0.8715f },
+    { -2.1691f, 12.0159f, 0.5182f, 0.1296f, 0.8724f },
+    { -2.3414f, 12.6068f, 0.4877f, 0.1243f, 0.8654f },
+    { -2.1451f, 11.561f, 0.7849f, 0.1359f, 0.8748f },
+    { -2.1428f, 11.834f, 0.3268f, 0.1282f, 0.8759f },
+    { -2.2997f, 12.3866f, 0.3184f, 0.1232f, 0.8696f },
+    { -2.0916f, 11.342f, 0.5594f, 0.1341f, 0.8784f },
+    { -2.0744f, 11.1707f, 0.3376f, 0.1324f, 0.8816f },
+    { -2.0821f, 10.8411f, 0.5937f, 0.1369f, 0.8822f },
+    { -2.0604f, 10.6141f, 0.3464f, 0.1351f, 0.8857f },
+    { -2.1036f, 11.1034f, 0.1518f, 0.1308f, 0.884f },
+    { -2.1399f, 11.1277f, 0.8408f, 0.1388f, 0.8783f },
+    { -2.0893f, 10.5394f, 0.1513f, 0.1334f, 0.888f },
+    { -2.1668f, 11.7466f, 0.1513f, 0.1268f, 0.8785f },
+    { -2.306f, 12.2701f, 0.1513f, 0.1222f, 0.8746f },
+    { -2.5793f, 12.6109f, 0.317f, 0.1171f, 0.8742f },
+    { -2.2007f, 11.0421f, 0.0112f, 0.1295f, 0.8866f },
+    { -2.5482f, 12.475f, 0.1533f, 0.1178f, 0.8754f },
+    { -2.9456f, 12.4995f, 0.3132f, 0.111f, 0.8788f },
+    { -2.2642f, 11.6913f, 0.0169f, 0.1254f, 0.8811f },
+    { -2.3526f, 12.0988f, 0.0562f, 0.1223f, 0.8775f },
+    { -2.5162f, 12.2178f, 0.0216f, 0.1197f, 0.8783f },
+    { -2.4581f, 11.606f, -0.0512f, 0.1239f, 0.8844f },
+    { -2.7531f, 12.2665f, 0.1338f, 0.1164f, 0.8804f },
+    { -2.8826f, 11.5879f, 0.1515f, 0.119f, 0.8903f },
+    { -2.6588f, 12.0526f, 0.0328f, 0.119f, 0.8817f },
+    { -2.7808f, 11.55f, 0.0693f, 0.1207f, 0.8891f },
+    { -2.8726f, 10.6615f, 0.108f, 0.127f, 0.9019f },
+    { -2.6598f, 11.5418f, -0.0386f, 0.1223f, 0.8873f },
+    { -2.7369f, 10.7479f, 0.024f, 0.1271f, 0.897f },
+    { -2.3872f, 10.8885f, -0.0752f, 0.1287f, 0.8904f },
+    { -2.6059f, 10.6432f, -0.1039f, 0.1287f, 0.8955f },
+    { -2.3172f, 10.3143f, -0.0605f, 0.1323f, 0.8931f },
+    { -2.4636f, 10.1085f, -0.0837f, 0.1329f, 0.8958f },
+    { -2.1735f, 10.4838f, 0.0138f, 0.1324f, 0.8902f },
+    { -2.1771f, 10.1506f, 0.05f, 0.1342f, 0.8916f },
+    { -2.2544f, 9.9262f, 0.0083f, 0.1348f, 0.8936f },
+    { -2.1235f, 10.084f, 0.1496f, 0.1352f, 0.8909f },
+    { -2.3709f, 9.7461f, -0.0008f, 0.1357f, 0.8953f },
+    { -2.2055f, 9.7668f, 0.1466f, 0.1366f, 0.8929f },
+    { -2.099f, 10.1684f, 0.3584f, 0.1368f, 0.8886f },
+    { -2.1293f, 10.4589f, 0.6429f, 0.1389f, 0.8848f },
+    { -2.1885f, 9.8378f, 0.3786f, 0.1383f, 0.8908f },
+    { -2.3247f, 9.5795f, 0.1433f, 0.1376f, 0.8944f },
+    { -2.2217f, 10.1411f, 0.729f, 0.1407f, 0.8871f },
+    { -2.4887f, 9.6601f, 0.0009f, 0.1364f, 0.8964f },
+    { -2.3236f, 9.6286f, 0.3968f, 0.1395f, 0.8926f },
+    { -2.4709f, 9.5139f, 0.1408f, 0.1382f, 0.8957f },
+    { -2.5561f, 9.9439f, -0.0678f, 0.1341f, 0.8972f },
+    { -2.5712f, 9.6674f, 0.0397f, 0.1368f, 0.897f },
+    { -2.6448f, 10.205f, -0.0519f, 0.1322f, 0.8982f },
+    { -2.6203f, 9.8229f, 0.002f, 0.1356f, 0.8978f },
+    { -2.6036f, 9.5701f, 0.1397f, 0.1382f, 0.8968f },
+    { -2.4992f, 9.5471f, 0.4022f, 0.1403f, 0.8942f },
+    { -2.682f, 9.748f, 0.1403f, 0.1374f, 0.8981f },
+    { -2.3662f, 9.9133f, 0.8077f, 0.1424f, 0.8892f },
+    { -2.6616f, 9.5904f, 0.3971f, 0.1406f, 0.8957f },
+    { -2.5696f, 9.8014f, 0.835f, 0.1438f, 0.8911f },
+    { -2.296f, 10.517f, 1.0639f, 0.1433f, 0.883f },
+    { -2.7591f, 9.7944f, 0.8192f, 0.1445f, 0.8929f },
+    { -2.4527f, 10.2774f, 1.1994f, 0.1456f, 0.8854f },
+    { -2.6721f, 10.1468f, 1.258f, 0.1477f, 0.8874f },
+    { -2.7573f, 9.7555f, 0.3837f, 0.1401f, 0.8973f },
+    { -2.8721f, 10.0889f, 1.2442f, 0.1489f, 0.8894f },
+    { -2.8619f, 9.8815f, 0.7687f, 0.1441f, 0.8947f },
+    { -2.7189f, 10.0012f, 0.1214f, 0.1355f, 0.899f },
+    { -2.6635f, 10.0157f, 0.0169f, 0.1344f, 0.8984f },
+    { -2.7267f, 10.2831f, 0.062f, 0.1321f, 0.8995f },
+    { -2.8035f, 10.254f, 0.1444f, 0.1327f, 0.9012f },
+    { -2.8245f, 9.9363f, 0.3064f, 0.1384f, 0.8999f },
+    { -2.8769f, 10.1934f, 0.0659f, 0.1333f, 0.9033f },
+    { -2.8893f, 9.9273f, 0.1239f, 0.1368f, 0.9029f },
+    { -2.9846f, 10.378f, 0.0067f, 0.1306f, 0.9058f },
+    { -3.2743f, 10.5918f, 0.0589f, 0.1288f, 0.9117f },
+    { -3.0109f, 9.9012f, -0.011f, 0.1364f, 0.9057f },
+    { -3.2722f, 10.4559f, -0.0154f, 0.1304f, 0.9114f },
+    { -3.6622f, 10.5269f, 0.076f, 0.1306f, 0.9214f },
+    { -3.0102f, 10.1355f, -0.0594f, 0.1338f, 0.9062f },
+    { -3.0738f, 10.2812f, -0.0658f, 0.1321f, 0.9074f },
+    { -3.2665f, 10.1146f, -0.1173f, 0.1343f, 0.9103f },
+    { -3.2751f, 10.31f, -0.112f, 0.1322f, 0.911f },
+    { -3.5593f, 10.3971f, -0.0141f, 0.1319f, 0.9166f },
+    { -3.4705f, 10.2885f, -0.0858f, 0.1328f, 0.9143f },
+    { -3.5252f, 10.1276f, -0.1009f, 0.1346f, 0.9145f },
+    { -3.6655f, 10.1718f, -0.0031f, 0.1346f, 0.9175f },
+    { -3.7611f, 10.2136f, 0.0992f, 0.135f, 0.9197f },
+    { -3.8857f, 10.2197f, 0.1292f, 0.1361f, 0.9217f },
+    { -3.8737f, 10.5192f, 0.0811f, 0.1324f, 0.9241f },
+    { -3.7764f, 9.8784f, 0.1179f, 0.1385f, 0.9181f },
+    { -4.0038f, 10.1972f, 0.0892f, 0.1378f, 0.9233f },
+    { -4.0721f, 10.5339f, 0.0638f, 0.1342f, 0.9268f },
+    { -3.896f, 9.8703f, 0.1477f, 0.1396f, 0.9195f },
+    { -4.0088f, 9.8471f, 0.1061f, 0.141f, 0.9207f },
+    { -3.906f, 9.5487f, 0.1649f, 0.1427f, 0.9176f },
+    { -4.0135f, 9.5324f, 0.1217f, 0.1438f, 0.9187f },
+    { -4.083f, 9.8216f, -0.004f, 0.1426f, 0.9219f },
+    { -4.0858f, 9.5142f, 0.0108f, 0.145f, 0.9199f },
+    { -4.0799f, 10.1534f, -0.0187f, 0.1398f, 0.9242f },
+    { -4.2039f, 9.7951f, -0.1014f, 0.1449f, 0.9232f },
+    { -4.1542f, 10.4006f, -0.033f, 0.1389f, 0.9267f },
+    { -4.3979f, 10.6039f, 0.0299f, 0.1408f, 0.931f },
+    { -4.191f, 10.0973f, -0.1207f, 0.1424f, 0.925f },
+    { -4.2093f, 9.5002f, -0.0863f, 0.1468f, 0.9213f },
+    { -4.4568f, 9.7691f, -0.1052f, 0.1485f, 0.9245f },
+    { -4.2213f, 9.2346f, -0.0655f, 0.1485f, 0.9197f },
+    { -4.4702f, 9.4967f, -0.0886f, 0.1499f, 0.9228f },
+    { -4.4141f, 10.038f, -0.1427f, 0.1461f, 0.9262f },
+    { -4.2238f, 10.2721f, -0.1086f, 0.1413f, 0.9265f },
+    { -4.7105f, 9.7585f, -0.0318f, 0.1524f, 0.9256f },
+    { -4.3833f, 10.4542f, -0.0463f, 0.142f, 0.9294f },
+    { -4.7528f, 10.6761f, 0.0655f, 0.1474f, 0.9352f },
+    { -4.3776f, 10.2757f, -0.1426f, 0.1436f, 0.9278f },
+    { -4.6341f, 10.3408f, -0.0328f, 0.147f, 0.9306f },
+    { -4.6434f, 10.0198f, -0.0897f, 0.1496f, 0.9275f },
+    { -4.5611f, 10.2184f, -0.1005f, 0.1468f, 0.9288f },
+    { -4.7733f, 10.0871f, 0.0333f, 0.1519f, 0.9289f },
+    { -4.8519f, 10.176f, 0.1106f, 0.1532f, 0.9305f },
+    { -4.8336f, 9.7784f, 0.1023f, 0.1553f, 0.926f },
+    { -4.9243f, 9.7964f, 0.2642f, 0.159f, 0.9257f },
+    { -4.8479f, 9.5f, 0.1244f, 0.156f, 0.924f },
+    { -4.9276f, 10.2228f, 0.0264f, 0.154f, 0.9327f },
+    { -4.8997f, 10.761f, -0.018f, 0.1485f, 0.9371f },
+    { -5.0565f, 10.6483f, -0.1488f, 0.1496f, 0.9391f },
+    { -5.04f, 10.1708f, -0.0887f, 0.1545f, 0.9352f },
+    { -5.071f, 9.9551f, -0.0127f, 0.1594f, 0.9313f },
+    { -5.0067f, 9.8965f, 0.0954f, 0.1586f, 0.9296f },
+    { -5.187f, 9.8063f, -0.0257f, 0.1615f, 0.9321f },
+    { -5.1403f, 9.7122f, 0.1162f, 0.1615f, 0.9291f },
+    { -5.3024f, 9.7091f, 0.0102f, 0.1638f, 0.9319f },
+    { -5.1072f, 9.713f, 0.3241f, 0.1623f, 0.926f },
+    { -5.3011f, 9.6281f, 0.1126f, 0.1633f, 0.9297f },
+    { -5.3999f, 9.7307f, -0.0338f, 0.1651f, 0.9327f },
+    { -5.2283f, 9.9634f, -0.1041f, 0.1666f, 0.9365f },
+    { -5.187f, 9.8063f, -0.0257f, 0.1637f, 0.9352f },
+    { -5.071f, 9.9551f, -0.0127f, 0.1639f, 0.9376f },
+    { -5.04f, 10.1708f, -0.0887f, 0.1687f, 0.9407f },
+    { -5.0565f, 10.6483f, -0.1488f, 0.1734f, 0.9438f },
+    { -5.2995f, 10.1449f, -0.1309f, 0.1693f, 0.9371f },
+    { -5.5137f, 9.869f, -0.0423f, 0.1674f, 0.9327f },
+    { -5.4621f, 9.6025f, 0.1082f, 0.1648f, 0.9298f },
+    { -5.6296f, 10.1856f, -0.0347f, 0.1711f, 0.9328f },
+    { -5.2858f, 9.6309f, 0.3488f, 0.1643f, 0.9266f },
+    { -5.6087f, 9.7332f, 0.106f, 0.1671f, 0.9299f },
+    { -5.471f, 9.6155f, 0.3459f, 0.166f, 0.927f },
+    { -5.2888f, 9.7861f, 0.7068f, 0.1671f, 0.9228f },
+    { -5.6394f, 9.7583f, 0.3299f, 0.1684f, 0.9274f },
+    { -5.1071f, 9.8404f, 0.6005f, 0.1648f, 0.9227f },
+    { -5.4828f, 9.8066f, 0.7034f, 0.169f, 0.9234f },
+    { -5.2901f, 10.0279f, 1.0732f, 0.1707f, 0.9186f },
+    { -5.6607f, 9.9651f, 0.6449f, 0.1713f, 0.9242f },
+    { -5.1196f, 10.035f, 0.8962f, 0.1679f, 0.9191f },
+    { -5.4863f, 10.0977f, 1.072f, 0.1728f, 0.9193f },
+    { -5.4701f, 10.4106f, 1.3429f, 0.1764f, 0.9151f },
+    { -5.67f, 10.2837f, 0.9755f, 0.1752f, 0.9206f },
+    { -5.2702f, 10.291f, 1.3349f, 0.1739f, 0.9144f },
+    { -5.6648f, 10.6444f, 1.2461f, 0.1793f, 0.9169f },
+    { -5.6486f, 11.0715f, 1.4478f, 0.184f, 0.9139f },
+    { -5.803f, 10.6256f, 0.8669f, 0.1787f, 0.9219f },
+    { -5.4486f, 10.7879f, 1.5364f, 0.1806f, 0.9116f },
+    { -5.7947f, 11.0405f, 1.1043f, 0.1833f, 0.919f },
+    { -5.6249f, 11.5893f, 1.5718f, 0.1898f, 0.9123f },
+    { -5.7718f, 11.5085f, 1.2975f, 0.1885f, 0.9167f },
+    { -5.8179f, 11.5924f, 0.9451f, 0.1886f, 0.9216f },
+    { -5.4361f, 11.2721f, 1.6729f, 0.1861f, 0.9092f },
+    { -5.8381f, 11.1743f, 0.7536f, 0.184f, 0.9237f },
+    { -5.1818f, 10.5324f, 1.5728f, 0.1768f, 0.9094f },
+    { -5.8383f, 10.9118f, 0.5271f, 0.1808f, 0.9262f },
+    { -5.1246f, 10.2374f, 1.1622f, 0.171f, 0.9153f },
+    { -4.9892f, 9.9546f, 0.6991f, 0.165f, 0.9196f },
+    { -4.9715f, 9.8179f, 0.4801f, 0.1623f, 0.9224f },
+    { -4.9158f, 9.5673f, 0.441f, 0.1603f, 0.9213f },
+    { -4.9132f, 9.6228f, 0.64f, 0.1624f, 0.9188f },
+    { -4.889f, 9.5176f, 0.2875f, 0.1583f, 0.9231f },
+    { -4.8567f, 9.2276f, 0.432f, 0.1587f, 0.92f },
+    { -4.8373f, 9.2349f, 0.2853f, 0.1572f, 0.9215f },
+    { -4.8281f, 9.2135f, 0.6165f, 0.1602f, 0.9178f },
+    { -4.7109f, 8.9383f, 0.4017f, 0.1574f, 0.9189f },
+    { -4.67f, 8.9006f, 0.5261f, 0.1585f, 0.9173f },
+    { -4.7193f, 9.1812f, 0.8915f, 0.1619f, 0.9149f },
+    { -4.5573f, 8.8672f, 0.6838f, 0.1593f, 0.9151f },
+    { -4.8665f, 9.6583f, 0.9393f, 0.1648f, 0.9157f },
+    { -4.4008f, 8.8738f, 0.825f, 0.1594f, 0.9124f },
+    { -5.0009f, 10.0824f, 0.979f, 0.1679f, 0.9163f },
+    { -4.5451f, 9.1977f, 1.248f, 0.1637f, 0.9106f },
+    { -4.8256f, 9.7464f, 1.2561f, 0.1676f, 0.9123f },
+    { -4.9657f, 10.0605f, 1.2031f, 0.1695f, 0.9135f },
+    { -5.0543f, 10.2713f, 1.374f, 0.1724f, 0.9118f },
+    { -4.8408f, 9.9601f, 1.5072f, 0.1705f, 0.9088f },
+    { -4.8825f, 10.286f, 1.7086f, 0.1742f, 0.9055f },
+    { -4.5517f, 9.6177f, 1.5774f, 0.1673f, 0.906f },
+    { -4.9212f, 10.7106f, 1.8758f, 0.1791f, 0.9023f },
+    { -4.5768f, 10.0207f, 1.8029f, 0.1709f, 0.902f },
+    { -5.1938f, 10.9887f, 1.7679f, 0.1826f, 0.9059f },
+    { -4.6165f, 10.494f, 1.976f, 0.1757f, 0.8984f },
+    { -4.9826f, 11.1444f, 2.0971f, 0.1849f, 0.8991f },
+    { -4.677f, 10.9503f, 2.2006f, 0.1814f, 0.8948f },
+    { -4.2781f, 10.3955f, 2.0478f, 0.1726f, 0.8943f },
+    { -4.3098f, 10.8767f, 2.2827f, 0.178f, 0.89f },
+    { -4.256f, 9.9079f, 1.8556f, 0.168f, 0.8985f },
+    { -4.2543f, 9.558f, 1.5999f, 0.165f, 0.9027f },
+    { -3.9607f, 10.3723f, 2.0776f, 0.1696f, 0.8907f },
+    { -3.8981f, 9.8094f, 1.8618f, 0.1643f, 0.8954f },
+    { -4.2522f, 9.267f, 1.2814f, 0.1623f, 0.9064f },
+    { -3.9826f, 9.5523f, 1.5847f, 0.1627f, 0.9002f },
+    { -4.2285f, 8.9562f, 0.9003f, 0.1586f, 0.9095f },
+    { -3.984f, 9.3382f, 1.2359f, 0.1603f, 0.9038f },
+    { -4.0786f, 9.0042f, 0.9046f, 0.1574f, 0.9074f },
+    { -4.186f, 8.7464f, 0.5676f, 0.1549f, 0.9117f },
+    { -3.7702f, 9.3725f, 1.5412f, 0.16f, 0.8999f },
+    { -4.0788f, 8.7618f, 0.6263f, 0.1538f, 0.9101f },
+    { -3.6386f, 9.4007f, 1.6419f, 0.1591f, 0.8977f },
+    { -3.7149f, 9.1506f, 1.3058f, 0.1577f, 0.9024f },
+    { -3.6023f, 10.052f, 1.8993f, 0.1628f, 0.8908f },
+    { -3.886f, 8.9675f, 0.9252f, 0.1564f, 0.9062f },
+    { -3.9891f, 8.9079f, 0.8325f, 0.1559f, 0.9073f },
+    { -3.9783f, 8.7288f, 0.628f, 0.1531f, 0.9095f },
+    { -3.6964f, 8.8572f, 0.9813f, 0.1549f, 0.9054f },
+    { -3.862f, 8.7208f, 0.6516f, 0.153f, 0.9089f },
+    { -4.036f, 8.809f, 0.4404f, 0.1509f, 0.9123f },
+    { -3.945f, 8.8179f, 0.4564f, 0.1504f, 0.9118f },
+    { -4.1275f, 8.7584f, 0.394f, 0.1521f, 0.9133f },
+    { -3.9922f, 8.9792f, 0.3209f, 0.1487f, 0.9141f },
+    { -4.0753f, 8.8805f, 0.3125f, 0.1499f, 0.9144f },
+    { -4.2341f, 8.7032f, 0.3513f, 0.1535f, 0.9146f },
+    { -4.1827f, 8.7826f, 0.2722f, 0.1512f, 0.9152f },
+    { -4.3014f, 8.7161f, 0.496f, 0.1561f, 0.9138f },
+    { -4.4259f, 8.7043f, 0.4556f, 0.1569f, 0.9157f },
+    { -4.3705f, 8.6805f, 0.3465f, 0.1549f, 0.9161f },
+    { -4.5411f, 8.7667f, 0.4405f, 0.1572f, 0.917f },
+    { -4.5313f, 8.7417f, 0.3674f, 0.1562f, 0.9177f },
+    { -4.7062f, 8.9769f, 0.278f, 0.156f, 0.9199f },
+    { -4.535f, 8.7923f, 0.2706f, 0.1547f, 0.9183f },
+    { -4.8021f, 9.2467f, 0.1233f, 0.1553f, 0.9223f },
+    { -4.6822f, 9.0129f, 0.1225f, 0.1545f, 0.9205f },
+    { -4.3626f, 8.7299f, 0.2678f, 0.1533f, 0.9166f },
+    { -4.5265f, 8.8444f, 0.1242f, 0.1536f, 0.9188f },
+    { -4.3736f, 8.7868f, 0.1306f, 0.1524f, 0.9175f },
+    { -4.2433f, 8.8394f, 0.1229f, 0.1509f, 0.9168f },
+    { -4.5136f, 8.9114f, 0.0298f, 0.1529f, 0.9193f },
+    { -4.1f, 8.9912f, 0.2019f, 0.1488f, 0.9159f },
+    { -4.3983f, 8.8791f, -0.0001f, 0.1519f, 0.9186f },
+    { -4.2913f, 8.9036f, 0.0247f, 0.1509f, 0.9179f },
+    { -4.1554f, 9.0017f, 0.0825f, 0.1491f, 0.9172f },
+    { -4.2539f, 9.0204f, -0.0289f, 0.1499f, 0.9186f },
+    { -4.4314f, 9.035f, -0.0592f, 0.1513f, 0.9198f },
+    { -4.6026f, 9.0358f, -0.0086f, 0.153f, 0.9205f },
+    { -4.6951f, 9.2531f, -0.0119f, 0.1532f, 0.9222f },
+    { -4.4598f, 9.2443f, -0.0782f, 0.1507f, 0.9212f },
+    { -4.7294f, 9.4984f, -0.0127f, 0.1533f, 0.9239f },
+    { -4.1046f, 9.2384f, 0.0361f, 0.1471f, 0.9183f },
+    { -4.0283f, 9.2337f, 0.1647f, 0.1464f, 0.9168f },
+    { -3.9893f, 9.1059f, 0.242f, 0.1474f, 0.9153f },
+    { -3.9114f, 9.2929f, 0.1923f, 0.1451f, 0.9161f },
+    { -4.0519f, 9.001f, 0.2564f, 0.1485f, 0.9152f },
+    { -3.9081f, 9.141f, 0.2414f, 0.1466f, 0.915f },
+    { -3.9135f, 9.0102f, 0.3252f, 0.1481f, 0.9137f },
+    { -3.7978f, 9.237f, 0.1817f, 0.1448f, 0.9148f },
+    { -3.8487f, 8.7835f, 0.4571f, 0.1501f, 0.9113f },
+    { -3.8334f, 9.1061f, 0.2508f, 0.1464f, 0.9142f },
+    { -3.8409f, 8.9729f, 0.3281f, 0.1479f, 0.9131f },
+    { -3.7076f, 8.6544f, 0.6659f, 0.1522f, 0.9083f },
+    { -3.7415f, 8.7044f, 0.4576f, 0.15f, 0.9104f },
+    { -3.7763f, 8.8668f, 0.3325f, 0.1483f, 0.912f },
+    { -3.5349f, 8.6013f, 0.6656f, 0.1512f, 0.9076f },
+    { -3.7903f, 9.0011f, 0.2664f, 0.147f, 0.9132f },
+    { -3.7501f, 8.9903f, 0.2157f, 0.1466f, 0.9128f },
+    { -3.5961f, 8.6505f, 0.4588f, 0.1498f, 0.9093f },
+    { -3.6742f, 8.7805f, 0.2956f, 0.1483f, 0.9107f },
+    { -3.7009f, 9.241f, 0.0581f, 0.1436f, 0.9137f },
+    { -3.6769f, 8.998f, 0.099f, 0.1456f, 0.9122f },
+    { -3.3853f, 8.6917f, 0.4614f, 0.1489f, 0.9077f },
+    { -3.5736f, 9.2382f, -0.0429f, 0.1426f, 0.912f },
+    { -3.364f, 8.6331f, 0.6455f, 0.1502f, 0.9066f },
+    { -3.3689f, 8.6699f, 0.8867f, 0.1514f, 0.905f },
+    { -3.498f, 8.7128f, 0.9766f, 0.1529f, 0.905f },
+    { -3.2968f, 8.8208f, 0.9899f, 0.1513f, 0.903f },
+    { -3.457f, 8.9694f, 1.3341f, 0.1546f, 0.9013f },
+    { -3.4615f, 9.6468f, 1.6776f, 0.1582f, 0.8941f },
+    { -3.328f, 9.286f, 1.3863f, 0.1539f, 0.8975f },
+    { -3.394f, 10.3563f, 1.9025f, 0.1618f, 0.8867f },
+    { -3.719f, 10.382f, 2.0519f, 0.1669f, 0.8884f },
+    { -3.2958f, 9.968f, 1.6744f, 0.1573f, 0.8903f },
+    { -3.5537f, 10.6821f, 2.0971f, 0.1669f, 0.8845f },
+    { -3.2216f, 10.5879f, 1.8672f, 0.1599f, 0.8834f },
+    { -3.848f, 10.9193f, 2.2996f, 0.1733f, 0.8844f },
+    { -3.2567f, 10.9453f, 2.1038f, 0.164f, 0.8797f },
+    { -3.1983f, 10.2216f, 1.6583f, 0.1564f, 0.8875f },
+    { -3.8412f, 11.2444f, 2.7094f, 0.1784f, 0.8791f },
+    { -3.2328f, 9.6211f, 1.3983f, 0.1534f, 0.8941f },
+    { -3.2333f, 9.0889f, 1.0248f, 0.1506f, 0.9003f },
+    { -3.1731f, 9.9203f, 1.437f, 0.1532f, 0.8912f },
+    { -3.2315f, 8.7758f, 0.6748f, 0.1493f, 0.9047f },
+    { -3.1785f, 9.4196f, 1.0597f, 0.1499f, 0.8971f },
+    { -3.1651f, 9.0132f, 0.6874f, 0.1481f, 0.9023f },
+    { -3.1949f, 8.8171f, 0.4648f, 0.1477f, 0.9058f },
+    { -3.1258f, 9.3224f, 0.7349f, 0.1471f, 0.8995f },
+    { -3.4113f, 8.777f, 0.3037f, 0.1477f, 0.9085f },
+    { -3.1107f, 9.0162f, 0.4685f, 0.1463f, 0.9037f },
+    { -3.1949f, 8.8797f, 0.3045f, 0.1465f, 0.9066f },
+    { -3.5941f, 8.8457f, 0.1338f, 0.1466f, 0.9106f },
+    { -3.4205f, 8.8204f, 0.1418f, 0.1464f, 0.9091f },
+    { -3.5616f, 9.0156f, -0.0108f, 0.1444f, 0.9112f },
+    { -3.532f, 8.9037f, 0.0388f, 0.1454f, 0.9105f },
+    { -3.4145f, 8.8852f, 0.0142f, 0.1451f, 0.9095f },
+    { -3.395f, 9.0346f, -0.041f, 0.1436f, 0.9096f },
+    { -3.3607f, 9.2619f, -0.0573f, 0.1418f, 0.9095f },
+    { -3.2333f, 9.0499f, 0.0087f, 0.1434f, 0.9078f },
+    { -3.1568f, 9.288f, 0.0066f, 0.1415f, 0.9069f },
+    { -3.3105f, 9.5603f, -0.0684f, 0.1394f, 0.9095f },
+    { -3.0712f, 9.5952f, 0.0055f, 0.1391f, 0.9061f },
+    { -3.5595f, 9.5311f, -0.0646f, 0.1401f, 0.9128f },
+    { -3.2704f, 9.8659f, -0.0849f, 0.1367f, 0.9097f },
+    { -3.5373f, 9.8442f, -0.0819f, 0.1373f, 0.9136f },
+    { -3.6978f, 9.5384f, 0.0318f, 0.1409f, 0.915f },
+    { -3.6814f, 9.8591f, 0.0135f, 0.1378f, 0.9163f },
+    { -3.7914f, 9.5538f, 0.1364f, 0.1417f, 0.9165f },
+    { 2.8813f, 10.1143f, 1.2643f, 0.8568f, 0.8879f },
+    { 2.9797f, 10.0928f, 1.1822f, 0.8572f, 0.8899f },
+    { 2.9858f, 10.4059f, 1.5302f, 0.8529f, 0.8843f },
+    { 2.6813f, 10.1722f, 1.2782f, 0.858f, 0.8859f },
+    { 2.8711f, 9.9069f, 0.7889f, 0.8616f, 0.8933f },
+    { 2.7683f, 9.8198f, 0.8394f, 0.8611f, 0.8914f },
+    { 2.8057f, 10.4785f, 1.5101f, 0.8545f, 0.8827f },
+    { 2.5788f, 9.8268f, 0.8552f, 0.8619f, 0.8896f },
+    { 2.4619f, 10.3028f, 1.2195f, 0.8601f, 0.8839f },
+    { 2.6708f, 9.6158f, 0.4172f, 0.865f, 0.8942f },
+    { 2.7665f, 9.7809f, 0.4038f, 0.8656f, 0.8959f },
+    { 2.5084f, 9.5725f, 0.4223f, 0.8654f, 0.8927f },
+    { 2.6913f, 9.7734f, 0.1604f, 0.8683f, 0.8966f },
+    { 2.3754f, 9.9387f, 0.8279f, 0.8633f, 0.8877f },
+    { 2.6128f, 9.5955f, 0.1599f, 0.8675f, 0.8954f },
+    { 2.3328f, 9.654f, 0.4169f, 0.8662f, 0.8912f },
+    { 2.4802f, 9.5393f, 0.161f, 0.8675f, 0.8942f },
+    { 2.5804f, 9.6928f, 0.0598f, 0.8689f, 0.8956f },
+    { 2.6295f, 9.8483f, 0.0221f, 0.8701f, 0.8964f },
+    { 2.4979f, 9.6855f, 0.0211f, 0.8693f, 0.895f },
+    { 2.6727f, 10.0411f, 0.037f, 0.8713f, 0.897f },
+    { 2.5653f, 9.9693f, -0.0477f, 0.8716f, 0.8958f },
+    { 2.654f, 10.2304f, -0.0318f, 0.8735f, 0.8968f },
+    { 2.7281f, 10.0266f, 0.1416f, 0.8702f, 0.8976f },
+    { 2.7359f, 10.3085f, 0.0821f, 0.8736f, 0.8981f },
+    { 2.8297f, 9.9605f, 0.3266f, 0.8673f, 0.8985f },
+    { 2.6151f, 10.6686f, -0.0837f, 0.877f, 0.8941f },
+    { 2.4728f, 10.1339f, -0.0636f, 0.8728f, 0.8944f },
+    { 2.7461f, 10.7733f, 0.0441f, 0.8786f, 0.8956f },
+    { 2.3801f, 9.7715f, 0.0193f, 0.8699f, 0.8939f },
+    { 2.3964f, 10.9139f, -0.0551f, 0.877f, 0.889f },
+    { 2.3339f, 9.6049f, 0.1634f, 0.8681f, 0.893f },
+    { 2.3264f, 10.3397f, -0.0404f, 0.8734f, 0.8917f },
+    { 2.2147f, 9.7922f, 0.1667f, 0.8691f, 0.8915f },
+    { 2.2636f, 9.9516f, 0.0284f, 0.8709f, 0.8922f },
+    { 2.1977f, 9.8632f, 0.3988f, 0.8674f, 0.8894f },
+    { 2.1327f, 10.1093f, 0.1697f, 0.8705f, 0.8895f },
+    { 2.231f, 10.1665f, 0.7491f, 0.865f, 0.8856f },
+    { 2.1082f, 10.1938f, 0.3785f, 0.8689f, 0.8872f },
+    { 2.1385f, 10.4843f, 0.663f, 0.8668f, 0.8833f },
+    { 2.0696f, 10.6395f, 0.3665f, 0.8707f, 0.8843f },
+    { 2.0913f, 10.8665f, 0.6138f, 0.8688f, 0.8807f },
+    { 2.2035f, 10.8422f, 0.9413f, 0.8647f, 0.8791f },
+    { 2.1491f, 11.1531f, 0.8609f, 0.8669f, 0.8768f },
+    { 2.3052f, 10.5424f, 1.084f, 0.8624f, 0.8815f },
+    { 2.2827f, 11.129f, 1.1313f, 0.8629f, 0.8757f },
+    { 2.411f, 10.8316f, 1.2699f, 0.8601f, 0.8785f },
+    { 2.5923f, 10.5897f, 1.4149f, 0.8572f, 0.881f },
+    { 2.3905f, 11.3495f, 1.361f, 0.8598f, 0.8727f },
+    { 2.5485f, 11.0332f, 1.4446f, 0.857f, 0.8762f },
+    { 2.6704f, 10.799f, 1.4957f, 0.8555f, 0.8788f },
+    { 2.3305f, 11.6314f, 1.2745f, 0.8626f, 0.8701f },
+    { 2.8514f, 10.7889f, 1.6373f, 0.8522f, 0.8791f },
+    { 2.7178f, 11.1464f, 1.7462f, 0.8519f, 0.8743f },
+    { 2.5408f, 11.5083f, 1.7581f, 0.8539f, 0.8698f },
+    { 2.9442f, 11.1345f, 2.0223f, 0.8464f, 0.8744f },
+    { 2.7241f, 11.6942f, 2.2911f, 0.8458f, 0.8662f },
+    { 2.4564f, 11.8317f, 1.5938f, 0.8583f, 0.8667f },
+    { 3.0737f, 10.7147f, 1.7624f, 0.8489f, 0.8803f },
+    { 3.0672f, 10.2795f, 1.4504f, 0.8535f, 0.8867f },
+    { 3.2534f, 10.9607f, 2.1204f, 0.8419f, 0.8779f },
+    { 3.0284f, 9.9941f, 1.0508f, 0.8582f, 0.8922f },
+    { 3.2771f, 11.2525f, 2.3838f, 0.8378f, 0.8742f },
+    { 2.9303f, 9.9106f, 0.7094f, 0.8621f, 0.8953f },
+    { 2.989f, 9.6532f, 0.6067f, 0.8618f, 0.8976f },
+    { 2.9223f, 9.6255f, 0.3576f, 0.8643f, 0.9f },
+    { 3.0789f, 9.7048f, 0.8889f, 0.8587f, 0.8951f },
+    { 2.9982f, 9.2899f, 0.3303f, 0.8623f, 0.9017f },
+    { 3.1018f, 10.0789f, 1.3187f, 0.8548f, 0.8896f },
+    { 3.0599f, 9.2968f, 0.5144f, 0.8607f, 0.9f },
+    { 3.1414f, 9.7837f, 1.1831f, 0.8556f, 0.8926f },
+    { 3.1453f, 9.3371f, 0.7501f, 0.8586f, 0.8981f },
+    { 3.1426f, 10.1387f, 1.4702f, 0.8526f, 0.888f },
+    { 3.1408f, 10.365f, 1.6102f, 0.8507f, 0.8849f },
+    { 3.1823f, 9.9457f, 1.4571f, 0.8524f, 0.8897f },
+    { 3.2075f, 10.247f, 1.6785f, 0.8492f, 0.8859f },
+    { 3.2277f, 10.6108f, 1.8865f, 0.8458f, 0.8818f },
+    { 3.2589f, 9.6318f, 1.4177f, 0.8522f, 0.8926f },
+    { 3.207f, 9.4325f, 1.077f, 0.8557f, 0.8957f },
+    { 3.3147f, 9.9842f, 1.6945f, 0.8483f, 0.8887f },
+    { 3.3198f, 9.0642f, 1.0336f, 0.855f, 0.8988f },
+    { 3.4006f, 10.3755f, 1.9213f, 0.844f, 0.885f },
+    { 3.4048f, 9.2526f, 1.4036f, 0.8517f, 0.896f },
+    { 3.5093f, 9.6352f, 1.6978f, 0.8474f, 0.8926f },
+    { 3.5431f, 10.6917f, 2.1118f, 0.8392f, 0.8826f },
+    { 3.617f, 10.0648f, 1.9183f, 0.8429f, 0.8892f },
+    { 3.8337f, 10.9162f, 2.3153f, 0.8329f, 0.8824f },
+    { 3.7115f, 10.394f, 2.0674f, 0.839f, 0.8866f },
+    { 3.96f, 10.3825f, 2.1061f, 0.8362f, 0.8888f },
+    { 3.9155f, 9.8229f, 1.8833f, 0.8412f, 0.8939f },
+    { 3.7089f, 9.3675f, 1.6621f, 0.8464f, 0.8962f },
+    { 4.272f, 9.9314f, 1.8888f, 0.8375f, 0.8969f },
+    { 3.5873f, 8.8919f, 1.3481f, 0.851f, 0.8999f },
+    { 4.0046f, 9.5654f, 1.6048f, 0.8429f, 0.8987f },
+    { 3.4412f, 8.7624f, 0.9885f, 0.8543f, 0.9016f },
+    { 3.831f, 9.3486f, 1.5614f, 0.8455f, 0.8984f },
+    { 3.795f, 9.1201f, 1.3204f, 0.8479f, 0.901f },
+    { 3.7829f, 8.8563f, 0.979f, 0.8506f, 0.904f },
+    { 3.9949f, 9.3605f, 1.252f, 0.8453f, 0.9023f },
+    { 3.6425f, 8.6604f, 0.9724f, 0.8527f, 0.9036f },
+    { 3.9031f, 9.0221f, 0.921f, 0.8492f, 0.9047f },
+    { 3.8745f, 8.7979f, 0.6376f, 0.8526f, 0.9075f },
+    { 4.0278f, 9.0422f, 0.9155f, 0.8484f, 0.9057f },
+    { 3.9524f, 8.9813f, 0.8227f, 0.8496f, 0.9058f },
+    { 3.7844f, 8.6866f, 0.6523f, 0.8533f, 0.9069f },
+    { 3.933f, 8.8113f, 0.6125f, 0.8525f, 0.9081f },
+    { 3.8589f, 8.8444f, 0.4548f, 0.8555f, 0.9098f },
+    { 3.9198f, 8.8793f, 0.4541f, 0.8552f, 0.9103f },
+    { 4.0016f, 8.8022f, 0.635f, 0.8519f, 0.9083f },
+    { 3.9881f, 8.8439f, 0.4532f, 0.8548f, 0.9107f },
+    { 3.9871f, 9.007f, 0.3392f, 0.8569f, 0.9126f },
+    { 4.1813f, 8.9348f, 0.9585f, 0.8478f, 0.9072f },
+    { 3.914f, 9.0446f, 0.3397f, 0.8576f, 0.9123f },
+    { 4.2472f, 9.2807f, 1.311f, 0.844f, 0.9047f },
+    { 4.2635f, 9.5833f, 1.6201f, 0.8409f, 0.9011f },
+    { 4.548f, 9.2127f, 1.2807f, 0.8431f, 0.9087f },
+    { 4.5608f, 9.6431f, 1.5975f, 0.8388f, 0.9045f },
+    { 4.6045f, 10.0444f, 1.8469f, 0.8345f, 0.9005f },
+    { 4.3145f, 10.4135f, 2.1201f, 0.8327f, 0.8925f },
+    { 4.9196f, 10.3036f, 1.7553f, 0.8313f, 0.9041f },
+    { 4.7001f, 10.5125f, 2.0914f, 0.8291f, 0.8968f },
+    { 4.3557f, 10.8848f, 2.3644f, 0.8275f, 0.8881f },
+    { 3.8397f, 11.2366f, 2.6842f, 0.828f, 0.8779f },
+    { 4.7902f, 10.9573f, 2.3454f, 0.8234f, 0.8933f },
+    { 3.2917f, 11.4421f, 2.6801f, 0.834f, 0.871f },
+    { 4.3605f, 11.2006f, 2.6719f, 0.8228f, 0.8842f },
+    { 3.8269f, 11.4084f, 3.0181f, 0.824f, 0.8744f },
+    { 3.2978f, 11.5702f, 2.9809f, 0.8304f, 0.8682f },
+    { 4.3516f, 11.4118f, 2.9843f, 0.8186f, 0.8808f },
+    { 3.824f, 11.536f, 3.2954f, 0.8206f, 0.8716f },
+    { 2.8648f, 11.9419f, 2.8534f, 0.8379f, 0.8617f },
+    { 4.8175f, 11.2886f, 2.623f, 0.8184f, 0.8899f },
+    { 3.296f, 11.6772f, 3.2577f, 0.8271f, 0.8656f },
+    { 2.8351f, 11.8608f, 2.5992f, 0.8413f, 0.8637f },
+    { 2.6286f, 12.5684f, 2.6166f, 0.8468f, 0.8544f },
+    { 2.5884f, 12.5363f, 2.3813f, 0.8502f, 0.8557f },
+    { 2.872f, 12.0243f, 3.1279f, 0.8344f, 0.8595f },
+    { 2.6236f, 13.2711f, 2.3452f, 0.8569f, 0.8469f },
+    { 2.6564f, 12.6086f, 2.9039f, 0.8429f, 0.8527f },
+    { 2.5764f, 13.2705f, 2.1112f, 0.86f, 0.8475f },
+    { 2.6738f, 13.2549f, 2.6549f, 0.8518f, 0.8456f },
+    { 2.5419f, 12.5562f, 2.1246f, 0.8543f, 0.8566f },
+    { 2.5364f, 13.2531f, 1.8774f, 0.8631f, 0.848f },
+    { 2.508f, 13.219f, 1.5679f, 0.8677f, 0.8505f },
+    { 2.4952f, 12.6722f, 1.7731f, 0.8605f, 0.8569f },
+    { 2.4745f, 13.1765f, 1.281f, 0.8723f, 0.8529f },
+    { 2.535f, 12.1358f, 1.8234f, 0.8563f, 0.8626f },
+    { 2.4466f, 12.7646f, 1.4419f, 0.8662f, 0.8575f },
+    { 2.3947f, 12.7135f, 1.2458f, 0.869f, 0.8591f },
+    { 2.4196f, 13.134f, 1.1149f, 0.874f, 0.8538f },
+    { 2.4742f, 12.3557f, 1.5524f, 0.862f, 0.8614f },
+    { 2.4219f, 12.2042f, 1.3807f, 0.8639f, 0.8637f },
+    { 2.3275f, 12.0012f, 1.1875f, 0.866f, 0.8668f },
+    { 2.3405f, 12.5813f, 1.102f, 0.8706f, 0.8614f },
+    { 2.3739f, 12.9468f, 1.0343f, 0.8756f, 0.8546f },
+    { 2.3866f, 13.0109f, 0.882f, 0.878f, 0.8571f },
+    { 2.2854f, 12.4305f, 0.9275f, 0.8725f, 0.8642f },
+    { 2.3925f, 12.8629f, 0.6866f, 0.8803f, 0.8597f },
+    { 2.2341f, 11.7965f, 1.0016f, 0.8679f, 0.87f },
+    { 2.2309f, 12.2531f, 0.7353f, 0.8745f, 0.8673f },
+    { 2.1783f, 12.0412f, 0.5383f, 0.8761f, 0.871f },
+    { 2.3506f, 12.6322f, 0.5078f, 0.8814f, 0.8639f },
+    { 2.1543f, 11.5864f, 0.805f, 0.8698f, 0.8733f },
+    { 2.152f, 11.8594f, 0.3469f, 0.8776f, 0.8744f },
+    { 2.3089f, 12.412f, 0.3385f, 0.8825f, 0.8682f },
+    { 2.1008f, 11.3674f, 0.5795f, 0.8717f, 0.8769f },
+    { 2.0836f, 11.1961f, 0.3577f, 0.8734f, 0.8802f },
+    { 2.2285f, 11.4067f, 1.0557f, 0.8651f, 0.8733f },
+    { 2.0985f, 10.5647f, 0.1714f, 0.8723f, 0.8866f },
+    { 2.1127f, 11.1288f, 0.1719f, 0.8749f, 0.8826f },
+    { 2.1863f, 10.176f, 0.0701f, 0.8715f, 0.8902f },
+    { 2.1826f, 10.5092f, 0.034f, 0.8733f, 0.8888f },
+    { 2.2098f, 11.0674f, 0.0313f, 0.8762f, 0.8852f },
+    { 2.176f, 11.772f, 0.1714f, 0.8789f, 0.8771f },
+    { 2.3152f, 12.2955f, 0.1714f, 0.8835f, 0.8732f },
+    { 2.5885f, 12.6363f, 0.3371f, 0.8887f, 0.8728f },
+    { 2.2734f, 11.7167f, 0.037f, 0.8803f, 0.8797f },
+    { 2.4673f, 11.6314f, -0.0311f, 0.8818f, 0.883f },
+    { 2.3617f, 12.1242f, 0.0763f, 0.8835f, 0.8761f },
+    { 2.669f, 11.5672f, -0.0185f, 0.8834f, 0.8859f },
+    { 2.5254f, 12.2432f, 0.0417f, 0.8861f, 0.8769f },
+    { 2.668f, 12.078f, 0.053f, 0.8868f, 0.8803f },
+    { 2.7901f, 11.5754f, 0.0894f, 0.8851f, 0.8878f },
+    { 2.7623f, 12.2919f, 0.1539f, 0.8894f, 0.879f },
+    { 2.5574f, 12.5004f, 0.1734f, 0.888f, 0.874f },
+    { 2.9547f, 12.5249f, 0.3333f, 0.8948f, 0.8774f },
+    { 2.8918f, 11.6133f, 0.1717f, 0.8868f, 0.889f },
+    { 2.8818f, 10.6869f, 0.1282f, 0.8788f, 0.9006f },
+    { 2.8127f, 10.2794f, 0.1646f, 0.873f, 0.8998f },
+    { 2.8861f, 10.2188f, 0.086f, 0.8724f, 0.9019f },
+    { 2.8882f, 9.9497f, 0.144f, 0.8688f, 0.9015f },
+    { 2.9297f, 9.6182f, 0.1624f, 0.8659f, 0.9022f },
+    { 3.0111f, 9.924f, 0.0091f, 0.8693f, 0.9043f },
+    { 3.0076f, 9.295f, 0.158f, 0.8635f, 0.9035f },
+    { 3.0443f, 9.6101f, 0.0256f, 0.8666f, 0.9047f },
+    { 3.1129f, 9.2964f, 0.026f, 0.8641f, 0.9055f },
+    { 3.299f, 9.5797f, -0.0483f, 0.8663f, 0.9081f },
+    { 3.339f, 9.2782f, -0.0372f, 0.8638f, 0.9081f },
+    { 3.2109f, 9.06f, 0.026f, 0.8622f, 0.9064f },
+    { 3.3835f, 9.054f, -0.0209f, 0.862f, 0.9081f },
+    { 3.1189f, 9.0506f, 0.1476f, 0.8617f, 0.9048f },
+    { 3.2939f, 8.9438f, 0.0577f, 0.861f, 0.9068f },
+    { 3.1023f, 9.0303f, 0.3067f, 0.8606f, 0.9034f },
+    { 3.265f, 8.8921f, 0.1417f, 0.8602f, 0.9062f },
+    { 3.423f, 8.9043f, 0.0315f, 0.8605f, 0.908f },
+    { 3.2524f, 8.8536f, 0.2945f, 0.8591f, 0.9052f },
+    { 3.4477f, 8.8266f, 0.1507f, 0.8592f, 0.9077f },
+    { 3.5409f, 8.9263f, 0.0577f, 0.8602f, 0.909f },
+    { 3.5656f, 9.0395f, 0.0094f, 0.8612f, 0.9097f },
+    { 3.6077f, 8.8663f, 0.1511f, 0.859f, 0.9092f },
+    { 3.4668f, 8.767f, 0.3013f, 0.8579f, 0.907f },
+    { 3.6861f, 9.0234f, 0.1192f, 0.8601f, 0.9107f },
+    { 3.575f, 9.2613f, -0.0227f, 0.863f, 0.9106f },
+    { 3.6985f, 8.7986f, 0.3094f, 0.8574f, 0.9093f },
+    { 3.7101f, 9.2664f, 0.0783f, 0.8621f, 0.9122f },
+    { 3.7592f, 9.0157f, 0.2358f, 0.8591f, 0.9114f },
+    { 3.5635f, 9.5549f, -0.0444f, 0.8655f, 0.9114f },
+    { 3.8069f, 9.2624f, 0.2019f, 0.8609f, 0.9134f },
+    { 3.2744f, 9.8898f, -0.0647f, 0.869f, 0.9083f },
+    { 3.707f, 9.5638f, 0.052f, 0.8648f, 0.9136f },
+    { 3.5452f, 9.8692f, -0.0617f, 0.8684f, 0.9122f },
+    { 3.0194f, 10.1609f, -0.0393f, 0.8719f, 0.9048f },
+    { 3.2757f, 10.14f, -0.0971f, 0.8714f, 0.9089f },
+    { 2.9938f, 10.4034f, 0.0269f, 0.8751f, 0.9044f },
+    { 3.2835f, 10.6172f, 0.0791f, 0.8769f, 0.9103f },
+    { 3.083f, 10.3066f, -0.0456f, 0.8736f, 0.906f },
+    { 3.2814f, 10.4813f, 0.0048f, 0.8753f, 0.91f },
+    { 3.6713f, 10.5523f, 0.0962f, 0.8751f, 0.92f },
+    { 3.2843f, 10.3354f, -0.0919f, 0.8735f, 0.9096f },
+    { 3.5684f, 10.4225f, 0.0061f, 0.8738f, 0.9152f },
+    { 3.5343f, 10.153f, -0.0807f, 0.8711f, 0.9131f },
+    { 3.4796f, 10.3139f, -0.0656f, 0.8729f, 0.913f },
+    { 3.6746f, 10.1972f, 0.0171f, 0.8711f, 0.9161f },
+    { 3.6905f, 9.8845f, 0.0337f, 0.8679f, 0.9149f },
+    { 3.7702f, 10.239f, 0.1194f, 0.8708f, 0.9183f },
+    { 3.7856f, 9.9038f, 0.1381f, 0.8672f, 0.9167f },
+    { 3.8006f, 9.5792f, 0.1565f, 0.8639f, 0.9151f },
+    { 3.9052f, 9.8957f, 0.1679f, 0.8661f, 0.9181f },
+    { 3.9152f, 9.5741f, 0.1851f, 0.863f, 0.9162f },
+    { 3.9206f, 9.3183f, 0.2125f, 0.8606f, 0.9147f },
+    { 3.9172f, 9.1664f, 0.2616f, 0.859f, 0.9136f },
+    { 4.0375f, 9.2591f, 0.1848f, 0.8593f, 0.9154f },
+    { 3.8425f, 9.1315f, 0.271f, 0.8592f, 0.9128f },
+    { 3.9985f, 9.1313f, 0.2622f, 0.8583f, 0.9139f },
+    { 3.8502f, 9.0071f, 0.3426f, 0.8577f, 0.9117f },
+    { 4.0703f, 8.8942f, 0.3421f, 0.8558f, 0.9128f },
+    { 3.7893f, 8.7405f, 0.4553f, 0.8556f, 0.909f },
+    { 3.7951f, 8.8949f, 0.347f, 0.8573f, 0.9106f },
+    { 3.6636f, 8.5848f, 0.6508f, 0.8544f, 0.9061f },
+    { 3.6774f, 8.6541f, 0.4536f, 0.8559f, 0.9078f },
+    { 3.5129f, 8.5998f, 0.6273f, 0.8554f, 0.9051f },
+    { 3.5327f, 8.6109f, 0.8769f, 0.8541f, 0.9036f },
+    { 3.3645f, 8.7439f, 0.6607f, 0.8563f, 0.9033f },
+    { 3.4898f, 8.6716f, 0.4478f, 0.8567f, 0.9062f },
+    { 3.2412f, 9.0033f, 0.6878f, 0.8575f, 0.9009f },
+    { 3.2936f, 8.7892f, 0.4484f, 0.8579f, 0.9043f },
+    { 3.1559f, 9.0032f, 0.4661f, 0.8593f, 0.9022f },
+    { 3.7994f, 9.0265f, 0.2866f, 0.8586f, 0.9117f },
+    { 4.8499f, 9.9855f, 1.5274f, 0.8355f, 0.9075f },
+    { 5.2104f, 10.5495f, 1.6098f, 0.8287f, 0.9083f },
+    { 4.8317f, 9.7742f, 1.2762f, 0.8387f, 0.9109f },
+    { 5.042f, 10.705f, 2.0023f, 0.8258f, 0.9009f },
+    { 5.1494f, 11.1139f, 2.2594f, 0.8201f, 0.8979f },
+    { 5.3242f, 10.9626f, 1.8935f, 0.8226f, 0.9046f },
+    { 5.174f, 11.4548f, 2.5174f, 0.815f, 0.895f },
+    { 5.4166f, 11.3724f, 2.1392f, 0.8168f, 0.902f },
+    { 4.8159f, 11.5315f, 2.8961f, 0.8142f, 0.887f },
+    { 5.4222f, 11.7529f, 2.3744f, 0.8114f, 0.8997f },
+    { 4.3517f, 11.5693f, 3.2434f, 0.8151f, 0.8782f },
+    { 5.1635f, 11.7182f, 2.7699f, 0.8106f, 0.8922f },
+    { 4.8189f, 11.711f, 3.1367f, 0.8106f, 0.8845f },
+    { 3.8328f, 11.623f, 3.519f, 0.8178f, 0.8695f },
+    { 4.366f, 11.6776f, 3.4565f, 0.8122f, 0.8761f },
+    { 3.3016f, 11.7566f, 3.4971f, 0.8241f, 0.8634f },
+    { 3.8553f, 11.6733f, 3.6918f, 0.8155f, 0.8679f },
+    { 2.8813f, 12.0903f, 3.3902f, 0.8311f, 0.8574f },
+    { 3.33f, 11.8018f, 3.6859f, 0.8215f, 0.8619f },
+    { 2.9174f, 12.122f, 3.6078f, 0.828f, 0.8561f },
+    { 2.6808f, 12.6358f, 3.1975f, 0.8388f, 0.8511f },
+    { 2.7081f, 13.2238f, 2.9815f, 0.8466f, 0.8443f },
+    { 2.7108f, 12.6289f, 3.4517f, 0.835f, 0.8502f },
+    { 2.7078f, 13.1798f, 3.266f, 0.8423f, 0.8442f },
+    { 2.9567f, 12.1424f, 3.8065f, 0.8252f, 0.8549f },
+    { 2.7349f, 12.6253f, 3.6972f, 0.8316f, 0.8492f },
+    { 2.6929f, 13.1613f, 3.5547f, 0.8379f, 0.8441f },
+    { 2.6837f, 13.2067f, 3.8937f, 0.8344f, 0.8418f },
+    { 2.7416f, 12.6626f, 3.9648f, 0.8285f, 0.8476f },
+    { 2.6708f, 13.2856f, 4.4497f, 0.8308f, 0.8395f },
+    { 2.7263f, 12.708f, 4.4321f, 0.8242f, 0.8438f },
+    { 2.645f, 13.368f, 5.3892f, 0.8238f, 0.8295f },
+    { 2.9755f, 12.1748f, 4.0121f, 0.8226f, 0.8534f },
+    { 3.3667f, 11.8319f, 3.8559f, 0.8192f, 0.8606f },
+    { 2.9641f, 12.1923f, 4.4074f, 0.8184f, 0.8499f },
+    { 3.3972f, 11.866f, 4.0389f, 0.8166f, 0.8592f },
+    { 3.8889f, 11.7086f, 3.8526f, 0.8132f, 0.8667f },
+    { 4.3999f, 11.7413f, 3.631f, 0.8097f, 0.8747f },
+    { 3.9312f, 11.7507f, 4.0404f, 0.8106f, 0.8652f },
+    { 4.8361f, 11.8396f, 3.3497f, 0.8075f, 0.8825f },
+    { 4.4473f, 11.7875f, 3.8037f, 0.8072f, 0.8733f },
+    { 4.8768f, 11.9293f, 3.5398f, 0.8046f, 0.881f },
+    { 5.1655f, 11.8949f, 3.0103f, 0.8071f, 0.8898f },
+    { 5.178f, 12.0281f, 3.2386f, 0.804f, 0.8878f },
+    { 5.3935f, 12.0474f, 2.6121f, 0.8068f, 0.8974f },
+    { 5.3831f, 12.1988f, 2.8652f, 0.8035f, 0.8949f },
+    { 5.5052f, 12.594f, 2.429f, 0.8014f, 0.9033f },
+    { 5.5545f, 12.2369f, 2.2131f, 0.8065f, 0.9046f },
+    { 5.4636f, 12.7007f, 2.7023f, 0.7983f, 0.9006f },
+    { 5.5752f, 11.7508f, 2.0176f, 0.8128f, 0.9056f },
+    { 5.4711f, 13.3111f, 2.1727f, 0.7949f, 0.9109f },
+    { 5.6234f, 12.7228f, 2.0316f, 0.8022f, 0.9092f },
+    { 5.5305f, 11.2572f, 1.8055f, 0.8191f, 0.9075f },
+    { 5.6728f, 12.1612f, 1.8853f, 0.8089f, 0.909f },
+    { 5.6812f, 13.0267f, 1.8279f, 0.8003f, 0.9131f },
+    { 5.4728f, 13.5158f, 1.8285f, 0.795f, 0.9161f },
+    { 5.7576f, 12.5155f, 1.7328f, 0.8059f, 0.9123f },
+    { 5.0497f, 13.9429f, 1.7214f, 0.7904f, 0.9218f },
+    { 5.7846f, 12.0222f, 1.5567f, 0.8115f, 0.9134f },
+    { 5.4799f, 13.5268f, 1.5329f, 0.7964f, 0.9197f },
+    { 5.7111f, 13.1158f, 1.5849f, 0.8006f, 0.9165f },
+    { 5.7705f, 12.7163f, 1.5793f, 0.8045f, 0.9151f },
+    { 5.0602f, 13.8452f, 1.4277f, 0.7927f, 0.9248f },
+    { 5.8054f, 12.4819f, 1.4032f, 0.8074f, 0.9167f },
+    { 5.6964f, 12.9575f, 1.2855f, 0.8031f, 0.9199f },
+    { 5.8066f, 12.0818f, 1.1617f, 0.8121f, 0.919f },
+    { 5.4581f, 13.3538f, 1.1861f, 0.7992f, 0.9235f },
+    { 5.6791f, 12.6568f, 1.0043f, 0.8068f, 0.9227f },
+    { 5.449f, 13.1106f, 0.8803f, 0.8024f, 0.9266f },
+    { 5.7016f, 12.319f, 0.8162f, 0.8106f, 0.9244f },
+    { 5.4946f, 12.9106f, 0.7075f, 0.8049f, 0.928f },
+    { 5.2734f, 13.1339f, 0.6692f, 0.8021f, 0.9309f },
+    { 5.1572f, 13.2879f, 0.8016f, 0.8f, 0.9306f },
+    { 5.2178f, 13.0369f, 0.5876f, 0.8031f, 0.9326f },
+    { 5.5161f, 12.731f, 0.5903f, 0.8069f, 0.9293f },
+    { 5.0911f, 13.576f, 1.0878f, 0.7963f, 0.9282f },
+    { 4.8331f, 13.2244f, 0.7278f, 0.7993f, 0.9354f },
+    { 4.6732f, 13.6581f, 1.062f, 0.7937f, 0.933f },
+    { 4.5914f, 14.0104f, 1.3651f, 0.7893f, 0.9302f },
+    { 4.2823f, 13.6344f, 1.1802f, 0.7905f, 0.9371f },
+    { 4.2135f, 13.9616f, 1.4407f, 0.7864f, 0.9341f },
+    { 4.5719f, 14.1908f, 1.6289f, 0.7866f, 0.9277f },
+    { 4.1996f, 14.1424f, 1.6734f, 0.7836f, 0.9315f },
+    { 5.0195f, 13.9097f, 2.0156f, 0.7887f, 0.9186f },
+    { 4.1864f, 14.1853f, 1.9284f, 0.7812f, 0.9289f },
+    { 5.336f, 13.2725f, 2.5301f, 0.7924f, 0.9072f },
+    { 4.5482f, 14.2171f, 1.905f, 0.7843f, 0.925f },
+    { 4.9295f, 13.7863f, 2.3572f, 0.7865f, 0.915f },
+    { 5.2527f, 13.2143f, 2.8494f, 0.7904f, 0.9038f },
+    { 4.454f, 14.1068f, 2.2453f, 0.7814f, 0.9219f },
+    { 5.419f, 12.727f, 2.9893f, 0.7959f, 0.8977f },
+    { 4.8271f, 13.682f, 2.7019f, 0.784f, 0.9115f },
+    { 5.1689f, 13.2728f, 3.1232f, 0.7876f, 0.9015f },
+    { 5.3771f, 12.3037f, 3.1197f, 0.8005f, 0.8926f },
+    { 5.3608f, 12.843f, 3.2465f, 0.7927f, 0.8958f },
+    { 5.199f, 12.1612f, 3.4546f, 0.8007f, 0.8862f },
+    { 5.3619f, 12.4585f, 3.3615f, 0.797f, 0.8908f },
+    { 4.9296f, 12.0017f, 3.7366f, 0.8017f, 0.8797f },
+    { 5.2237f, 12.2844f, 3.679f, 0.7972f, 0.8846f },
+    { 4.5022f, 11.8436f, 4.0116f, 0.8043f, 0.8717f },
+    { 4.9831f, 12.0782f, 3.9699f, 0.7985f, 0.8779f },
+    { 5.247f, 12.3882f, 3.9326f, 0.7938f, 0.8827f },
+    { 4.517f, 11.8776f, 4.4042f, 0.7997f, 0.8678f },
+    { 5.3451f, 12.6182f, 3.612f, 0.7933f, 0.8891f },
+    { 4.986f, 12.1253f, 4.3937f, 0.7937f, 0.8736f },
+    { 5.3345f, 12.7378f, 3.8925f, 0.7898f, 0.8868f },
+    { 5.2341f, 12.4635f, 4.3859f, 0.7889f, 0.8783f },
+    { 5.3096f, 12.9855f, 3.5166f, 0.7892f, 0.8939f },
+    { 5.2862f, 13.0913f, 3.8426f, 0.7858f, 0.891f },
+    { 5.1057f, 13.3777f, 3.4154f, 0.7845f, 0.8993f },
+    { 5.0839f, 13.4584f, 3.7902f, 0.7812f, 0.8957f },
+    { 4.7598f, 13.706f, 3.0052f, 0.7815f, 0.9088f },
+    { 4.7222f, 13.7858f, 3.3308f, 0.7786f, 0.9058f },
+    { 4.3526f, 13.996f, 2.6007f, 0.7784f, 0.9186f },
+    { 4.3074f, 14.0206f, 2.9224f, 0.7758f, 0.9155f },
+    { 4.2937f, 14.1021f, 3.2704f, 0.7731f, 0.9119f },
+    { 3.9861f, 14.0945f, 2.9047f, 0.7721f, 0.9196f },
+    { 4.7094f, 13.849f, 3.7425f, 0.7755f, 0.9016f },
+    { 3.9546f, 14.2186f, 3.2416f, 0.7694f, 0.9161f },
+    { 4.2867f, 14.1619f, 3.7048f, 0.77f, 0.9074f },
+    { 3.94f, 14.2964f, 3.682f, 0.7662f, 0.9115f },
+    { 3.6561f, 14.2101f, 3.2348f, 0.7665f, 0.9193f },
+    { 3.6268f, 14.3038f, 3.6728f, 0.7631f, 0.9148f },
+    { 3.7285f, 14.0581f, 2.9186f, 0.7694f, 0.9225f },
+    { 3.3492f, 14.1516f, 3.2406f, 0.7634f, 0.9224f },
+    { 4.0393f, 14.022f, 2.6f, 0.7748f, 0.9227f },
+    { 4.1195f, 14.0987f, 2.2559f, 0.7781f, 0.9258f },
+    { 3.808f, 13.9559f, 2.6369f, 0.7724f, 0.9252f },
+    { 3.8587f, 14.0117f, 2.3024f, 0.7756f, 0.9284f },
+    { 3.4675f, 14.0415f, 2.9304f, 0.7667f, 0.9252f },
+    { 3.5793f, 13.9934f, 2.6484f, 0.77f, 0.9277f },
+    { 3.881f, 14.0889f, 1.9817f, 0.7787f, 0.9316f },
+    { 3.6041f, 14.0955f, 2.2979f, 0.7733f, 0.9311f },
+    { 3.8751f, 14.0506f, 1.7415f, 0.7811f, 0.9344f },
+    { 3.8708f, 13.8912f, 1.5278f, 0.7836f, 0.9374f },
+    { 3.5407f, 14.1682f, 1.7198f, 0.7783f, 0.9376f },
+    { 3.5077f, 13.9916f, 1.4999f, 0.7806f, 0.9409f },
+    { 3.8976f, 13.6051f, 1.2869f, 0.7872f, 0.941f },
+    { 4.3556f, 13.2571f, 0.9298f, 0.795f, 0.9401f },
+    { 3.4987f, 13.6706f, 1.2266f, 0.7841f, 0.9454f },
+    { 4.8246f, 12.9097f, 0.5405f, 0.8027f, 0.9385f },
+    { 3.9249f, 13.2605f, 1.0506f, 0.7913f, 0.9447f },
+    { 4.3834f, 12.9263f, 0.7273f, 0.799f, 0.943f },
+    { 5.2252f, 12.8418f, 0.4596f, 0.8053f, 0.9343f },
+    { 5.5488f, 12.5294f, 0.453f, 0.8092f, 0.9306f },
+    { 5.2608f, 12.6387f, 0.3059f, 0.8079f, 0.9356f },
+    { 5.7373f, 12.0058f, 0.6636f, 0.8141f, 0.9258f },
+    { 5.5702f, 12.3542f, 0.301f, 0.8114f, 0.9319f },
+    { 5.7595f, 11.7791f, 0.4892f, 0.8169f, 0.9275f },
+    { 5.8271f, 11.6178f, 0.9652f, 0.8172f, 0.9209f },
+    { 5.8473f, 11.1997f, 0.7738f, 0.8218f, 0.9229f },
+    { 5.7906f, 11.5409f, 1.3403f, 0.8171f, 0.9156f },
+    { 5.8039f, 11.0659f, 1.1244f, 0.8223f, 0.9181f },
+    { 5.6782f, 11.605f, 1.7046f, 0.8154f, 0.9102f },
+    { 5.6688f, 11.0945f, 1.496f, 0.8214f, 0.9126f },
+    { 5.479f, 10.8033f, 1.5847f, 0.8248f, 0.9103f },
+    { 5.4792f, 10.436f, 1.363f, 0.8291f, 0.914f },
+    { 5.2793f, 10.3164f, 1.3551f, 0.8317f, 0.9132f },
+    { 5.6739f, 10.6698f, 1.2662f, 0.8263f, 0.9159f },
+    { 5.2993f, 10.0533f, 1.0934f, 0.835f, 0.9174f },
+    { 5.8122f, 10.651f, 0.887f, 0.827f, 0.9209f },
+    { 5.4955f, 10.1231f, 1.0921f, 0.8328f, 0.9182f },
+    { 5.6791f, 10.3091f, 0.9956f, 0.8305f, 0.9195f },
+    { 5.8474f, 10.9372f, 0.5472f, 0.825f, 0.9253f },
+    { 5.8029f, 10.3499f, 0.606f, 0.8307f, 0.924f },
+    { 5.6698f, 9.9905f, 0.665f, 0.8344f, 0.923f },
+    { 5.8268f, 10.7991f, 0.3218f, 0.8272f, 0.9278f },
+    { 5.492f, 9.832f, 0.7235f, 0.8367f, 0.9222f },
+    { 5.7772f, 10.1762f, 0.3355f, 0.8332f, 0.9268f },
+    { 5.6486f, 9.7837f, 0.35f, 0.8374f, 0.9262f },
+    { 5.7848f, 10.7541f, 0.1339f, 0.8284f, 0.9301f },
+    { 5.7359f, 10.1436f, 0.1292f, 0.8345f, 0.9292f },
+    { 5.4801f, 9.6409f, 0.366f, 0.8398f, 0.9258f },
+    { 5.6179f, 9.7586f, 0.1261f, 0.8387f, 0.9287f },
+    { 5.2979f, 9.8115f, 0.7269f, 0.8386f, 0.9216f },
+    { 5.4713f, 9.6279f, 0.1283f, 0.841f, 0.9286f },
+    { 5.1288f, 10.0604f, 0.9164f, 0.8377f, 0.9179f },
+    { 5.295f, 9.6563f, 0.369f, 0.8414f, 0.9253f },
+    { 5.1163f, 9.8658f, 0.6207f, 0.8409f, 0.9214f },
+    { 5.3103f, 9.6535f, 0.1327f, 0.8425f, 0.9284f },
+    { 5.1337f, 10.2628f, 1.1824f, 0.8346f, 0.9141f },
+    { 4.993f, 9.9842f, 0.7193f, 0.8407f, 0.9183f },
+    { 5.0634f, 10.2967f, 1.3942f, 0.8333f, 0.9105f },
+    { 5.007f, 10.1102f, 0.9991f, 0.8378f, 0.9151f },
+    { 4.9734f, 10.087f, 1.2232f, 0.8364f, 0.9122f },
+    { 4.8635f, 9.6932f, 0.9595f, 0.8412f, 0.9144f },
+    { 4.9012f, 9.665f, 0.6601f, 0.8434f, 0.9177f },
+    { 4.7257f, 9.2127f, 0.932f, 0.8446f, 0.9132f },
+    { 4.3862f, 8.8226f, 0.9243f, 0.8476f, 0.9095f },
+    { 4.8395f, 9.2721f, 0.6517f, 0.8458f, 0.9163f },
+    { 4.1106f, 8.7016f, 0.6448f, 0.8514f, 0.9091f },
+    { 4.6162f, 8.8693f, 0.7852f, 0.8476f, 0.9121f },
+    { 4.2828f, 8.6256f, 0.6348f, 0.8508f, 0.9103f },
+    { 4.0802f, 8.737f, 0.4521f, 0.854f, 0.9111f },
+    { 4.2387f, 8.6574f, 0.4505f, 0.8529f, 0.9117f },
+    { 4.2067f, 8.804f, 0.305f, 0.8546f, 0.9135f },
+    { 4.0611f, 9.0264f, 0.2766f, 0.8571f, 0.9138f },
+    { 4.1092f, 9.0166f, 0.222f, 0.8569f, 0.9145f },
+    { 4.2848f, 8.8804f, 0.1431f, 0.8547f, 0.9153f },
+    { 4.1645f, 9.0271f, 0.1026f, 0.8565f, 0.9157f },
+    { 4.1138f, 9.2638f, 0.0563f, 0.8585f, 0.9169f },
+    { 4.351f, 8.9551f, 0.0448f, 0.8547f, 0.9165f },
+    { 4.0227f, 9.5578f, 0.1418f, 0.8619f, 0.9173f },
+    { 4.28f, 9.0579f, -0.0087f, 0.8557f, 0.9171f },
+    { 4.5213f, 8.9632f, 0.0201f, 0.8537f, 0.9171f },
+    { 4.2356f, 9.2684f, -0.0453f, 0.8572f, 0.9183f },
+    { 4.512f, 8.8743f, 0.1508f, 0.8532f, 0.9157f },
+    { 4.5084f, 9.1088f, -0.039f, 0.8543f, 0.9184f },
+    { 4.6743f, 9.0219f, 0.05f, 0.8528f, 0.9177f },
+    { 4.7266f, 9.1439f, 0.0115f, 0.8527f, 0.919f },
+    { 4.7272f, 8.9698f, 0.1444f, 0.852f, 0.9169f },
+    { 4.5003f, 8.8015f, 0.3083f, 0.8526f, 0.9143f },
+    { 4.5061f, 8.7041f, 0.448f, 0.8516f, 0.9128f },
+    { 4.7387f, 8.9107f, 0.3058f, 0.8511f, 0.9157f },
+    { 4.541f, 8.6905f, 0.5977f, 0.8501f, 0.9118f },
+    { 4.7516f, 8.843f, 0.448f, 0.8502f, 0.9143f },
+    { 4.8116f, 9.1273f, 0.1426f, 0.8511f, 0.9187f },
+    { 4.829f, 9.0843f, 0.3062f, 0.8498f, 0.9178f },
+    { 4.7351f, 9.3345f, 0.0082f, 0.8525f, 0.9208f },
+    { 4.8302f, 9.3278f, 0.1434f, 0.8504f, 0.9208f },
+    { 4.4898f, 9.3033f, -0.058f, 0.855f, 0.9198f },
+    { 4.7403f, 9.5521f, 0.0074f, 0.8524f, 0.9225f },
+    { 4.4825f, 9.5394f, -0.0684f, 0.8558f, 0.9214f },
+    { 4.2192f, 9.5299f, -0.0661f, 0.8589f, 0.9199f },
+    { 4.7201f, 9.7909f, -0.0117f, 0.8533f, 0.9243f },
+    { 4.095f, 9.5396f, 0.031f, 0.8607f, 0.9185f },
+    { 4.018f, 9.8725f, 0.1263f, 0.8647f, 0.9193f },
+    { 4.0921f, 9.847f, 0.0162f, 0.8631f, 0.9205f },
+    { 3.8949f, 10.2451f, 0.1494f, 0.8696f, 0.9203f },
+    { 3.8829f, 10.5446f, 0.1012f, 0.8733f, 0.9227f },
+    { 4.013f, 10.2226f, 0.1093f, 0.8679f, 0.9219f },
+    { 4.0813f, 10.5593f, 0.0839f, 0.8715f, 0.9254f },
+    { 4.0891f, 10.1788f, 0.0014f, 0.8659f, 0.9228f },
+    { 4.2132f, 9.8216f, -0.0812f, 0.8609f, 0.9218f },
+    { 4.1634f, 10.426f, -0.0129f, 0.8669f, 0.9253f },
+    { 4.4071f, 10.6293f, 0.05f, 0.865f, 0.9296f },
+    { 4.2001f, 10.1227f, -0.1005f, 0.8633f, 0.9236f },
+    { 4.4668f, 9.7988f, -0.085f, 0.8572f, 0.9232f },
+    { 4.4232f, 10.0634f, -0.1225f, 0.8597f, 0.9248f },
+    { 4.2329f, 10.2975f, -0.0884f, 0.8645f, 0.9251f },
+    { 4.3925f, 10.4796f, -0.0262f, 0.8638f, 0.928f },
+    { 4.762f, 10.7015f, 0.0856f, 0.8584f, 0.9339f },
+    { 4.3868f, 10.3011f, -0.1224f, 0.8622f, 0.9264f },
+    { 4.6433f, 10.3662f, -0.0127f, 0.8588f, 0.9293f },
+    { 4.6526f, 10.0452f, -0.0695f, 0.8561f, 0.9262f },
+    { 4.5703f, 10.2438f, -0.0804f, 0.859f, 0.9274f },
+    { 4.7825f, 10.1125f, 0.0535f, 0.8539f, 0.9275f },
+    { 4.8611f, 10.2014f, 0.1307f, 0.8526f, 0.9291f },
+    { 4.8406f, 9.8105f, 0.1225f, 0.8504f, 0.9246f },
+    { 4.9368f, 10.2482f, 0.0466f, 0.8518f, 0.9313f },
+    { 4.9089f, 10.7864f, 0.0022f, 0.8573f, 0.9358f },
+    { 5.0656f, 10.6737f, -0.1286f, 0.8562f, 0.9377f },
+    { 5.0491f, 10.1962f, -0.0685f, 0.8513f, 0.9338f },
+    { 5.0801f, 9.9805f, 0.0074f, 0.8464f, 0.93f },
+    { 5.0159f, 9.9219f, 0.1155f, 0.8472f, 0.9282f },
+    { 5.1962f, 9.8317f, -0.0056f, 0.8444f, 0.9308f },
+    { 4.9312f, 9.8241f, 0.2844f, 0.8467f, 0.9244f },
+    { 5.1495f, 9.7376f, 0.1363f, 0.8443f, 0.9278f },
+    { 5.3116f, 9.7345f, 0.0303f, 0.8421f, 0.9307f },
+    { 5.1164f, 9.7384f, 0.3443f, 0.8434f, 0.9247f },
+    { 4.9746f, 9.8481f, 0.5003f, 0.8433f, 0.9211f },
+    { 4.9007f, 9.6118f, 0.4612f, 0.8453f, 0.9201f },
+    { 4.8777f, 9.5641f, 0.3077f, 0.8474f, 0.9218f },
+    { 4.8665f, 9.2961f, 0.4602f, 0.8471f, 0.9185f },
+    { 4.7944f, 8.975f, 0.6067f, 0.8479f, 0.9146f },
+    { 4.709f, 8.8245f, 0.5469f, 0.8494f, 0.9135f },
+    { 4.8443f, 9.0401f, 0.4539f, 0.8487f, 0.9164f },
+    { 4.8492f, 9.3072f, 0.3074f, 0.8485f, 0.92f },
+    { 4.8481f, 9.5523f, 0.1446f, 0.8497f, 0.9226f },
+    { 4.8967f, -13.0141f, 1.9229f, 0.9319f, 0.4652f },
+    { 4.5808f, -13.1967f, 2.0102f, 0.9298f, 0.4613f },
+    { 4.922f, -13.3157f, 1.7409f, 0.9357f, 0.4643f },
+    { 5.2039f, -13.0006f, 1.5495f, 0.9393f, 0.4681f },
+    { 4.7872f, -12.6196f, 2.0432f, 0.9271f, 0.4659f },
+    { 5.1807f, -12.7442f, 1.7034f, 0.9357f, 0.4691f },
+    { 5.1536f, -13.3289f, 1.3663f, 0.9419f, 0.4662f },
+    { 5.4172f, -12.7518f, 1.308f, 0.9437f, 0.4706f },
+    { 4.8976f, -13.6439f, 1.4895f, 0.9392f, 0.4629f },
+    { 5.3432f, -13.0306f, 1.172f, 0.9454f, 0.4684f },
+    { 4.6211f, -13.4696f, 1.7936f, 0.9337f, 0.461f },
+    { 4.6363f, -13.7358f, 1.5008f, 0.9375f, 0.4602f },
+    { 4.2876f, -13.3055f, 2.0364f, 0.9287f, 0.4578f },
+    { 4.8579f, -14.1181f, 1.1608f, 0.9431f, 0.4602f },
+    { 4.3467f, -13.5507f, 1.7939f, 0.9326f, 0.4581f },
+    { 4.6465f, -14.1423f, 1.1596f, 0.9418f, 0.4583f },
+    { 4.3896f, -13.7803f, 1.4278f, 0.9368f, 0.4579f },
+    { 5.0798f, -13.9049f, 1.0999f, 0.9449f, 0.4626f },
+    { 4.8109f, -14.484f, 0.8462f, 0.9466f, 0.4575f },
+    { 5.2559f, -13.648f, 0.9919f, 0.9473f, 0.4645f },
+    { 5.0054f, -14.394f, 0.8328f, 0.9477f, 0.4592f },
+    { 4.6409f, -14.4496f, 0.8383f, 0.9459f, 0.4561f },
+    { 5.4052f, -12.9887f, 0.9474f, 0.9498f, 0.4678f },
+    { 4.4886f, -14.1282f, 1.1077f, 0.9414f, 0.4569f },
+    { 5.5127f, -12.7965f, 1.1049f, 0.9483f, 0.4703f },
+    { 5.5356f, -12.9751f, 0.9051f, 0.9529f, 0.4685f },
+    { 5.6496f, -12.726f, 1.2294f, 0.9469f, 0.4726f },
+    { 5.7098f, -12.964f, 1.0744f, 0.9513f, 0.4714f },
+    { 5.4775f, -12.5099f, 1.4172f, 0.941f, 0.4729f },
+    { 5.8824f, -12.8743f, 1.0755f, 0.9513f, 0.4737f },
+    { 5.0341f, -12.3837f, 1.8817f, 0.9299f, 0.47f },
+    { 5.8128f, -12.5873f, 1.2257f, 0.9469f, 0.475f },
+    { 5.2393f, -12.0983f, 1.7116f, 0.9323f, 0.4742f },
+    { 5.6655f, -12.2421f, 1.3687f, 0.9415f, 0.4765f },
+    { 6.0249f, -12.6953f, 0.9978f, 0.9517f, 0.476f },
+    { 5.9424f, -12.3517f, 1.1641f, 0.9469f, 0.4779f },
+    { 5.7794f, -11.9485f, 1.3282f, 0.941f, 0.4801f },
+    { 6.0704f, -13.0085f, 0.7713f, 0.9568f, 0.4744f },
+    { 5.4062f, -11.7989f, 1.6061f, 0.9333f, 0.4784f },
+    { 6.1089f, -12.4158f, 0.9305f, 0.9509f, 0.479f },
+    { 6.1781f, -12.7706f, 0.7409f, 0.956f, 0.477f },
+    { 5.9783f, -11.9901f, 1.1149f, 0.9452f, 0.4814f },
+    { 6.042f, -11.9394f, 0.8735f, 0.9482f, 0.4836f },
+    { 5.7673f, -11.5224f, 1.3071f, 0.9386f, 0.4842f },
+    { 6.1145f, -12.2962f, 0.717f, 0.9531f, 0.4817f },
+    { 5.878f, -11.4908f, 1.0667f, 0.942f, 0.4861f },
+    { 5.7319f, -11.1697f, 0.8266f, 0.9427f, 0.4909f },
+    { 5.6445f, -11.0344f, 1.2754f, 0.9354f, 0.4888f },
+    { 5.7624f, -11.4526f, 0.6909f, 0.9468f, 0.4899f },
+    { 5.5991f, -10.8418f, 1.008f, 0.9377f, 0.4924f },
+    { 5.3324f, -10.468f, 0.8013f, 0.9375f, 0.498f },
+    { 5.4265f, -10.5548f, 1.203f, 0.9327f, 0.4937f },
+    { 5.3272f, -10.6735f, 0.6711f, 0.941f, 0.498f },
+    { 5.2496f, -10.2813f, 0.9674f, 0.9338f, 0.4984f },
+    { 4.9379f, -10.0476f, 0.9733f, 0.9323f, 0.5022f },
+    { 5.132f, -10.1523f, 1.1691f, 0.9301f, 0.4985f },
+    { 4.8492f, -9.9445f, 1.1697f, 0.9292f, 0.5024f },
+    { 5.0324f, -10.1195f, 1.4067f, 0.9265f, 0.4979f },
+    { 5.2766f, -10.3942f, 1.3794f, 0.9288f, 0.4945f },
+    { 5.3635f, -10.6545f, 1.4788f, 0.9292f, 0.4914f },
+    { 5.4571f, -11.0418f, 1.5203f, 0.931f, 0.4873f },
+    { 5.0116f, -10.202f, 1.6757f, 0.9232f, 0.4958f },
+    { 5.4928f, -11.4565f, 1.5481f, 0.9329f, 0.4828f },
+    { 5.1723f, -10.5965f, 1.7589f, 0.9237f, 0.4904f },
+    { 5.2165f, -10.9734f, 1.8177f, 0.9244f, 0.4856f },
+    { 5.161f, -11.3473f, 1.9101f, 0.9244f, 0.4805f },
+    { 5.0842f, -10.597f, 2.1308f, 0.9176f, 0.4881f },
+    { 5.0376f, -10.235f, 2.0272f, 0.918f, 0.4931f },
+    { 5.0559f, -10.9766f, 2.2526f, 0.917f, 0.4827f },
+    { 5.034f, -11.6942f, 2.0181f, 0.9238f, 0.4755f },
+    { 5.0627f, -10.3351f, 2.6144f, 0.91f, 0.4901f },
+    { 4.8637f, -11.9905f, 2.124f, 0.9227f, 0.4709f },
+    { 4.7693f, -11.6359f, 2.4696f, 0.9153f, 0.4717f },
+    { 4.6487f, -12.2095f, 2.2134f, 0.9212f, 0.4664f },
+    { 4.5367f, -11.8613f, 2.5448f, 0.9142f, 0.4666f },
+    { 4.9513f, -11.3357f, 2.3722f, 0.9162f, 0.4771f },
+    { 5.0658f, -10.7116f, 2.7519f, 0.9088f, 0.4845f },
+    { 4.7866f, -11.375f, 2.9878f, 0.9064f, 0.4729f },
+    { 4.982f, -11.0673f, 2.88f, 0.9076f, 0.4788f },
+    { 4.5248f, -11.6225f, 3.0713f, 0.9054f, 0.4671f },
+    { 4.9516f, -11.2626f, 3.7481f, 0.8949f, 0.4747f },
+    { 4.6865f, -11.5409f, 3.8265f, 0.894f, 0.4688f },
+    { 4.2417f, -11.7983f, 3.1261f, 0.9046f, 0.4616f },
+    { 4.3386f, -11.7473f, 3.8808f, 0.8934f, 0.4626f },
+    { 4.2805f, -11.9958f, 2.5983f, 0.9129f, 0.4617f },
+    { 3.9418f, -11.8498f, 3.9f, 0.8934f, 0.4562f },
+    { 4.3875f, -12.3248f, 2.2723f, 0.9193f, 0.4621f },
+    { 3.9022f, -11.8692f, 3.1421f, 0.9041f, 0.4556f },
+    { 3.9514f, -12.018f, 2.6227f, 0.9117f, 0.4559f },
+    { 4.4952f, -12.7701f, 2.123f, 0.925f, 0.4618f },
+    { 4.2059f, -12.8702f, 2.1557f, 0.9238f, 0.4579f },
+    { 4.0308f, -12.3383f, 2.2738f, 0.9177f, 0.4564f },
+    { 3.9668f, -12.9549f, 2.1762f, 0.9236f, 0.4545f },
+    { 3.7719f, -12.5592f, 2.186f, 0.9201f, 0.452f },
+    { 4.0722f, -13.354f, 2.073f, 0.9279f, 0.4553f },
+    { 3.6034f, -12.8067f, 2.0694f, 0.9228f, 0.4492f },
+    { 4.1445f, -13.6472f, 1.8285f, 0.9319f, 0.4557f },
+    { 3.808f, -13.1249f, 2.0977f, 0.9252f, 0.4521f },
+    { 3.9457f, -13.3848f, 2.0297f, 0.9279f, 0.4536f },
+    { 3.9653f, -13.6578f, 1.8556f, 0.9309f, 0.4534f },
+    { 3.7597f, -13.4811f, 1.8336f, 0.9293f, 0.4509f },
+    { 4.2003f, -13.9238f, 1.5022f, 0.9359f, 0.4555f },
+    { 4.0075f, -14.0971f, 1.4854f, 0.936f, 0.4529f },
+    { 4.3635f, -14.1652f, 1.1063f, 0.9409f, 0.4558f },
+    { 4.2564f, -14.2734f, 1.1537f, 0.9404f, 0.4546f },
+    { 4.4272f, -14.2266f, 1.0165f, 0.9423f, 0.4559f },
+    { 4.3723f, -14.4119f, 0.8169f, 0.9449f, 0.4541f },
+    { 4.4369f, -14.3981f, 0.7918f, 0.9455f, 0.4545f },
+    { 4.5111f, -14.3885f, 0.8173f, 0.9455f, 0.4551f },
+    { 4.4895f, -14.3334f, 0.5726f, 0.9488f, 0.4535f },
+    { 4.609f, -14.4186f, 0.6052f, 0.9488f, 0.4545f },
+    { 4.7645f, -14.4875f, 0.6375f, 0.9489f, 0.4559f },
+    { 4.7671f, -14.3495f, 0.5387f, 0.9502f, 0.4556f },
+    { 4.9537f, -14.4612f, 0.6476f, 0.9495f, 0.4576f },
+    { 4.918f, -14.3049f, 0.5285f, 0.9508f, 0.457f },
+    { 4.6571f, -14.2447f, 0.4743f, 0.9507f, 0.4544f },
+    { 5.0752f, -14.2379f, 0.5622f, 0.9512f, 0.4587f },
+    { 4.8918f, -14.1235f, 0.4598f, 0.9519f, 0.4567f },
+    { 5.1297f, -14.3314f, 0.6466f, 0.9503f, 0.4593f },
+    { 5.1442f, -14.0678f, 0.528f, 0.9522f, 0.4596f },
+    { 5.1774f, -14.2123f, 0.8045f, 0.9489f, 0.4609f },
+    { 5.2455f, -14.0902f, 0.6454f, 0.9513f, 0.4609f },
+    { 5.3301f, -13.4923f, 0.8519f, 0.9501f, 0.4648f },
+    { 5.2794f, -13.9715f, 0.7681f, 0.9502f, 0.4622f },
+    { 5.4f, -13.0722f, 0.7274f, 0.9541f, 0.4659f },
+    { 5.3433f, -13.4196f, 0.701f, 0.953f, 0.4641f },
+    { 5.3137f, -13.7398f, 0.7014f, 0.9519f, 0.4628f },
+    { 5.5313f, -13.1279f, 0.6732f, 0.9571f, 0.4669f },
+    { 5.3111f, -13.7721f, 0.6236f, 0.9528f, 0.4623f },
+    { 5.3368f, -13.4117f, 0.5606f, 0.9554f, 0.4631f },
+    { 5.2244f, -13.7764f, 0.4762f, 0.9541f, 0.4606f },
+    { 5.3883f, -13.15f, 0.5469f, 0.9574f, 0.4643f },
+    { 5.2963f, -13.4317f, 0.4207f, 0.9571f, 0.4616f },
+    { 5.3f, -13.0304f, 0.3572f, 0.9615f, 0.4606f },
+    { 5.532f, -13.2153f, 0.4563f, 0.9606f, 0.4658f },
+    { 5.7159f, -13.3143f, 0.532f, 0.9605f, 0.4687f },
+    { 5.72f, -13.1805f, 0.8072f, 0.9562f, 0.4699f },
+    { 5.9087f, -13.1429f, 0.8166f, 0.9564f, 0.4722f },
+    { 5.9104f, -13.3169f, 0.5472f, 0.9611f, 0.471f },
+    { 6.0808f, -13.2151f, 0.5428f, 0.9612f, 0.4732f },
+    { 6.1924f, -13.0008f, 0.5597f, 0.9601f, 0.4758f },
+    { 6.0583f, -13.2388f, 0.3706f, 0.9642f, 0.4727f },
+    { 6.1239f, -12.5459f, 0.5755f, 0.9569f, 0.4805f },
+    { 6.1586f, -13.053f, 0.4002f, 0.9629f, 0.4756f },
+    { 6.0991f, -12.6733f, 0.4275f, 0.9599f, 0.4802f },
+    { 5.7544f, -11.7223f, 0.568f, 0.9507f, 0.4889f },
+    { 5.7719f, -12.0103f, 0.4251f, 0.9549f, 0.4876f },
+    { 5.3176f, -10.952f, 0.5521f, 0.9449f, 0.4972f },
+    { 5.3869f, -11.3576f, 0.4203f, 0.95f, 0.4948f },
+    { 5.0473f, -10.6571f, 0.5428f, 0.9429f, 0.5015f },
+    { 5.467f, -11.9147f, 0.2857f, 0.9558f, 0.4923f },
+    { 5.8066f, -12.3496f, 0.3049f, 0.9593f, 0.4859f },
+    { 6.0058f, -12.6793f, 0.3342f, 0.9629f, 0.4796f },
+    { 6.0526f, -12.9645f, 0.2884f, 0.965f, 0.4759f },
+    { 6.0092f, -13.1374f, 0.299f, 0.9659f, 0.4714f },
+    { 5.1781f, -11.3864f, 0.3753f, 0.9496f, 0.4983f },
+    { 5.9061f, -13.3202f, 0.3655f, 0.9639f, 0.4705f },
+    { 5.8886f, -13.1424f, 0.2677f, 0.9665f, 0.469f },
+    { 6.0526f, -12.9645f, 0.2884f, 0.9698f, 0.4704f },
+    { 5.733f, -13.3042f, 0.3531f, 0.9632f, 0.4684f },
+    { 5.8505f, -12.7729f, 0.25f, 0.9701f, 0.4646f },
+    { 6.0058f, -12.6793f, 0.3342f, 0.9725f, 0.4686f },
+    { 5.8066f, -12.3496f, 0.3049f, 0.9742f, 0.4587f },
+    { 5.7271f, -13.0944f, 0.2588f, 0.9658f, 0.4664f },
+    { 5.6539f, -12.6291f, 0.2373f, 0.9699f, 0.4605f },
+    { 5.467f, -11.9147f, 0.2857f, 0.976f, 0.4487f },
+    { 5.57f, -13.1976f, 0.3011f, 0.963f, 0.4656f },
+    { 5.5649f, -12.6842f, 0.2026f, 0.9686f, 0.4602f },
+    { 5.597f, -13.0341f, 0.2144f, 0.9653f, 0.4644f },
+    { 5.4443f, -12.4002f, 0.2181f, 0.9701f, 0.4556f },
+    { 5.1781f, -11.3864f, 0.3753f, 0.9794f, 0.438f },
+    { 5.2764f, -12.1257f, 0.3041f, 0.9712f, 0.4503f },
+    { 4.7772f, -10.8251f, 0.4851f, 0.9827f, 0.4272f },
+    { 5.4916f, -12.7938f, 0.2207f, 0.9666f, 0.4606f },
+    { 5.4176f, -12.8536f, 0.266f, 0.965f, 0.4603f },
+    { 5.0928f, -11.9861f, 0.3885f, 0.971f, 0.4463f },
+    { 4.9248f, -12.1069f, 0.3993f, 0.9689f, 0.4454f },
+    { 4.7208f, -11.7244f, 0.3826f, 0.9713f, 0.4385f },
+    { 4.9518f, -12.7024f, 0.3266f, 0.9635f, 0.4522f },
+    { 4.9485f, -12.9955f, 0.2122f, 0.9611f, 0.4545f },
+    { 5.1386f, -13.1987f, 0.2198f, 0.9599f, 0.4584f },
+    { 4.7462f, -12.9962f, 0.218f, 0.9606f, 0.4512f },
+    { 5.2074f, -13.4427f, 0.2714f, 0.9579f, 0.4598f },
+    { 5.0592f, -13.2647f, 0.1516f, 0.9594f, 0.4571f },
+    { 4.9346f, -13.1713f, 0.1156f, 0.9599f, 0.4548f },
+    { 5.0816f, -13.4389f, 0.1507f, 0.9581f, 0.4578f },
+    { 4.8118f, -13.1593f, 0.1414f, 0.9597f, 0.4529f },
+    { 4.9301f, -13.4145f, 0.0963f, 0.9581f, 0.4556f },
+    { 4.7758f, -13.3843f, 0.1133f, 0.9581f, 0.4534f },
+    { 5.0576f, -13.5959f, 0.1989f, 0.9566f, 0.4579f },
+    { 4.9228f, -13.652f, 0.1484f, 0.9562f, 0.4563f },
+    { 5.1347f, -13.6669f, 0.3069f, 0.9557f, 0.4591f },
+    { 4.9003f, -13.8105f, 0.2659f, 0.9546f, 0.4566f },
+    { 4.8832f, -13.9484f, 0.3895f, 0.9531f, 0.4567f },
+    { 4.5044f, -14.0159f, 0.3571f, 0.9523f, 0.4523f },
+    { 4.678f, -13.7504f, 0.2115f, 0.955f, 0.4536f },
+    { 4.7816f, -13.6176f, 0.1471f, 0.9563f, 0.4544f },
+    { 4.6414f, -13.3634f, 0.2067f, 0.9578f, 0.4513f },
+    { 4.4798f, -13.3643f, 0.3053f, 0.9569f, 0.4491f },
+    { 4.5876f, -12.61f, 0.3248f, 0.9628f, 0.4461f },
+    { 4.137f, -12.7913f, 0.3112f, 0.9582f, 0.442f },
+    { 4.5136f, -11.5681f, 0.2804f, 0.9706f, 0.4345f },
+    { 4.2438f, -13.3999f, 0.3382f, 0.9552f, 0.4465f },
+    { 4.3628f, -12.1186f, 0.2289f, 0.9647f, 0.4388f },
+    { 4.0497f, -12.3549f, 0.2118f, 0.9603f, 0.4377f },
+    { 4.2534f, -11.5577f, 0.1716f, 0.9676f, 0.432f },
+    { 3.6559f, -12.7828f, 0.3248f, 0.9541f, 0.4368f },
+    { 4.2106f, -11.9052f, 0.1638f, 0.9647f, 0.4351f },
+    { 3.9712f, -11.9942f, 0.1249f, 0.9618f, 0.4335f },
+    { 3.8907f, -11.6126f, 0.1354f, 0.9631f, 0.4292f },
+    { 3.6714f, -12.2518f, 0.229f, 0.9571f, 0.4328f },
+    { 3.7193f, -12.0033f, 0.1639f, 0.959f, 0.4312f },
+    { 3.5422f, -11.6991f, 0.1717f, 0.9585f, 0.4269f },
+    { 3.3248f, -11.7836f, 0.2804f, 0.955f, 0.4255f },
+    { 3.2063f, -11.9735f, 0.3826f, 0.9523f, 0.4259f },
+    { 3.2754f, -11.2615f, 0.3318f, 0.9568f, 0.4204f },
+    { 3.5071f, -11.3889f, 0.2358f, 0.9594f, 0.4237f },
+    { 3.8244f, -11.2626f, 0.2184f, 0.9643f, 0.4253f },
+    { 3.7886f, -10.9968f, 0.349f, 0.9653f, 0.4223f },
+    { 4.1763f, -11.2655f, 0.2359f, 0.9688f, 0.4283f },
+    { 4.3671f, -11.0716f, 0.3319f, 0.9726f, 0.428f },
+    { 3.7654f, -10.7577f, 0.5074f, 0.9664f, 0.4193f },
+    { 4.5691f, -10.4006f, 0.6691f, 0.9834f, 0.4231f },
+    { 3.7367f, -10.4881f, 0.674f, 0.9676f, 0.4157f },
+    { 4.5252f, -10.1788f, 0.8304f, 0.984f, 0.4189f },
+    { 3.715f, -10.2422f, 0.8434f, 0.969f, 0.4116f },
+    { 2.8345f, -11.1189f, 0.484f, 0.9512f, 0.415f },
+    { 2.9206f, -10.6192f, 0.6801f, 0.9546f, 0.4104f },
+    { 2.9218f, -10.3625f, 0.8505f, 0.9539f, 0.4044f },
+    { 2.5239f, -10.7579f, 0.6867f, 0.9469f, 0.4094f },
+    { 2.5012f, -10.5157f, 0.8535f, 0.9469f, 0.4061f },
+    { 2.5488f, -11.0713f, 0.5433f, 0.9467f, 0.4127f },
+    { 2.3635f, -11.1338f, 0.7097f, 0.9421f, 0.4125f },
+    { 2.3135f, -10.8961f, 0.8789f, 0.9399f, 0.4078f },
+    { 2.4216f, -11.449f, 0.5555f, 0.9432f, 0.4156f },
+    { 2.5622f, -11.4476f, 0.4211f, 0.946f, 0.4162f },
+    { 2.4821f, -11.853f, 0.3947f, 0.9437f, 0.4194f },
+    { 2.6663f, -11.7825f, 0.3501f, 0.9465f, 0.4198f },
+    { 2.9495f, -12.2977f, 0.3819f, 0.9479f, 0.4267f },
+    { 2.6012f, -12.3737f, 0.2394f, 0.944f, 0.4244f },
+    { 3.1546f, -12.3764f, 0.3993f, 0.95f, 0.4292f },
+    { 2.8295f, -12.4864f, 0.2776f, 0.9459f, 0.4273f },
+    { 3.3407f, -12.9483f, 0.3264f, 0.95f, 0.4358f },
+    { 3.1327f, -13.3244f, 0.3623f, 0.9456f, 0.4377f },
+    { 3.4402f, -13.22f, 0.2114f, 0.9498f, 0.4389f },
+    { 3.3297f, -13.4461f, 0.2189f, 0.9474f, 0.4399f },
+    { 3.6292f, -13.1809f, 0.2176f, 0.9517f, 0.4397f },
+    { 3.4222f, -13.4898f, 0.1505f, 0.948f, 0.4408f },
+    { 4.008f, -13.4497f, 0.3053f, 0.9531f, 0.4443f },
+    { 3.5049f, -13.3763f, 0.1145f, 0.9495f, 0.4404f },
+    { 3.4591f, -13.6588f, 0.1497f, 0.9473f, 0.4421f },
+    { 3.6157f, -13.342f, 0.1408f, 0.9506f, 0.4407f },
+    { 3.3477f, -13.6943f, 0.2708f, 0.9459f, 0.4417f },
+    { 3.5868f, -13.6021f, 0.0957f, 0.9488f, 0.4424f },
+    { 3.5338f, -13.804f, 0.1985f, 0.9469f, 0.4435f },
+    { 3.7196f, -13.5413f, 0.1132f, 0.9502f, 0.4426f },
+    { 3.6738f, -13.8238f, 0.1483f, 0.9481f, 0.4443f },
+    { 3.4904f, -13.8925f, 0.3066f, 0.9457f, 0.4438f },
+    { 3.2836f, -13.6963f, 0.4355f, 0.9441f, 0.4416f },
+    { 3.7541f, -13.9681f, 0.266f, 0.9476f, 0.4459f },
+    { 3.4598f, -14.0153f, 0.4799f, 0.944f, 0.4445f },
+    { 3.7937f, -13.7582f, 0.1471f, 0.9495f, 0.4446f },
+    { 3.9394f, -13.8567f, 0.2117f, 0.95f, 0.4462f },
+    { 3.8222f, -14.0953f, 0.3895f, 0.9472f, 0.4472f },
+    { 3.8466f, -13.4937f, 0.2067f, 0.9516f, 0.4431f },
+    { 4.2007f, -14.0598f, 0.3571f, 0.9506f, 0.4496f },
+    { 4.3432f, -13.975f, 0.3895f, 0.9518f, 0.4504f },
+    { 4.4083f, -14.3109f, 0.5618f, 0.9486f, 0.4528f },
+    { 4.3404f, -14.3535f, 0.5726f, 0.9481f, 0.4524f },
+    { 4.2857f, -14.514f, 0.8368f, 0.9444f, 0.4533f },
+    { 4.2612f, -14.4636f, 0.6052f, 0.9473f, 0.452f },
+    { 4.1383f, -14.3162f, 0.4743f, 0.9483f, 0.4504f },
+    { 4.167f, -14.6177f, 0.8422f, 0.944f, 0.4523f },
+    { 3.8726f, -14.2659f, 0.4598f, 0.9467f, 0.4484f },
+    { 4.1449f, -14.5664f, 0.638f, 0.9462f, 0.4514f },
+    { 4.0778f, -14.4426f, 0.539f, 0.947f, 0.4505f },
+    { 4.0064f, -14.6367f, 0.824f, 0.9434f, 0.4511f },
+    { 3.9663f, -14.5872f, 0.6499f, 0.945f, 0.4503f },
+    { 3.9168f, -14.4424f, 0.5291f, 0.946f, 0.4494f },
+    { 3.6333f, -14.2726f, 0.5301f, 0.9443f, 0.4468f },
+    { 3.7601f, -14.4142f, 0.5644f, 0.9446f, 0.4483f },
+    { 3.7672f, -14.5044f, 0.6516f, 0.9438f, 0.4487f },
+    { 3.5896f, -14.2964f, 0.6539f, 0.9426f, 0.4467f },
+    { 3.4333f, -14.0001f, 0.6468f, 0.9418f, 0.4445f },
+    { 3.2983f, -13.6523f, 0.6206f, 0.9416f, 0.4421f },
+    { 3.4788f, -13.9474f, 0.8439f, 0.9396f, 0.4452f },
+    { 3.1783f, -13.4096f, 0.636f, 0.941f, 0.4401f },
+    { 3.3394f, -13.5672f, 0.838f, 0.9385f, 0.4429f },
+    { 3.2089f, -13.2774f, 0.8886f, 0.9371f, 0.4408f },
+    { 3.3547f, -13.4458f, 1.0996f, 0.935f, 0.4435f },
+    { 3.2084f, -13.1289f, 1.1471f, 0.9331f, 0.441f },
+    { 3.069f, -13.2252f, 1.0514f, 0.9347f, 0.4393f },
+    { 3.037f, -13.0062f, 1.2868f, 0.9309f, 0.4389f },
+    { 3.0673f, -13.4287f, 0.7539f, 0.939f, 0.4389f },
+    { 2.9118f, -13.2714f, 1.2116f, 0.9325f, 0.4378f },
+    { 3.0342f, -13.5636f, 0.4699f, 0.9423f, 0.4381f },
+    { 2.8696f, -13.0044f, 1.4131f, 0.9292f, 0.4372f },
+    { 2.9325f, -13.5371f, 0.8848f, 0.9368f, 0.438f },
+    { 2.7292f, -13.2766f, 1.2546f, 0.9315f, 0.4362f },
+    { 2.9268f, -13.7187f, 0.5532f, 0.9404f, 0.4376f },
+    { 2.7413f, -13.5624f, 0.9393f, 0.9353f, 0.4365f },
+    { 2.735f, -13.0502f, 1.4204f, 0.9291f, 0.436f },
+    { 2.5397f, -13.1656f, 1.2337f, 0.931f, 0.434f },
+    { 2.6018f, -12.8933f, 1.4195f, 0.9284f, 0.434f },
+    { 2.7631f, -12.6876f, 1.5478f, 0.9263f, 0.4354f },
+    { 2.4094f, -12.6762f, 1.3393f, 0.929f, 0.4305f },
+    { 3.0012f, -12.7924f, 1.476f, 0.9275f, 0.4384f },
+    { 2.4909f, -12.4197f, 1.4899f, 0.9268f, 0.4305f },
+    { 2.9915f, -12.6047f, 1.635f, 0.9248f, 0.4383f },
+    { 2.5771f, -12.1689f, 1.6554f, 0.9242f, 0.4307f },
+    { 2.8328f, -12.4216f, 1.7039f, 0.9236f, 0.4358f },
+    { 3.1312f, -12.6641f, 1.6642f, 0.9249f, 0.4404f },
+    { 3.181f, -12.9344f, 1.4071f, 0.9291f, 0.4408f },
+    { 3.323f, -12.8947f, 1.7191f, 0.9259f, 0.444f },
+    { 3.348f, -13.2383f, 1.3964f, 0.9308f, 0.4439f },
+    { 3.5092f, -13.8238f, 1.1091f, 0.9366f, 0.4461f },
+    { 3.5287f, -13.5882f, 1.4269f, 0.9326f, 0.4471f },
+    { 3.6455f, -14.271f, 0.8508f, 0.9408f, 0.4475f },
+    { 3.7051f, -14.1297f, 1.1405f, 0.9379f, 0.4488f },
+    { 3.8258f, -14.51f, 0.8477f, 0.9421f, 0.4496f },
+    { 4.0226f, -14.5274f, 1.053f, 0.9411f, 0.4518f },
+    { 3.8928f, -14.364f, 1.1397f, 0.9394f, 0.4509f },
+    { 4.1335f, -14.4334f, 1.1417f, 0.9405f, 0.453f },
+    { 3.7495f, -13.868f, 1.4818f, 0.9341f, 0.45f },
+    { 3.5412f, -13.1994f, 1.7817f, 0.9275f, 0.4478f },
+    { 3.333f, -12.5343f, 1.9948f, 0.9214f, 0.4445f },
+    { 3.4313f, -12.2762f, 2.1502f, 0.9183f, 0.4462f },
+    { 2.994f, -12.2877f, 1.8882f, 0.921f, 0.4383f },
+    { 3.5197f, -12.0803f, 2.3129f, 0.9153f, 0.4477f },
+    { 3.0236f, -12.0232f, 2.0936f, 0.9178f, 0.4386f },
+    { 2.6339f, -11.9321f, 1.8383f, 0.9213f, 0.431f },
+    { 2.6272f, -11.7175f, 2.0411f, 0.9183f, 0.4308f },
+    { 2.3586f, -11.5555f, 1.7309f, 0.923f, 0.4237f },
+    { 2.3065f, -11.3444f, 1.9557f, 0.9196f, 0.4231f },
+    { 2.3394f, -11.8309f, 1.5561f, 0.9256f, 0.4246f },
+    { 2.1256f, -10.889f, 1.8004f, 0.9217f, 0.4158f },
+    { 2.2837f, -12.0292f, 1.3905f, 0.9282f, 0.4245f },
+    { 2.2126f, -11.0697f, 1.5819f, 0.9253f, 0.4164f },
+    { 2.2344f, -11.3916f, 1.4724f, 0.927f, 0.4187f },
+    { 2.2007f, -11.3653f, 1.3255f, 0.9294f, 0.417f },
+    { 2.2456f, -12.2538f, 1.2311f, 0.9304f, 0.4249f },
+    { 2.2139f, -10.6073f, 1.3499f, 0.9297f, 0.4074f },
+    { 2.1447f, -10.432f, 1.6228f, 0.9241f, 0.4086f },
+    { 2.077f, -10.3259f, 1.8584f, 0.9186f, 0.4098f },
+    { 2.1982f, -11.481f, 1.1462f, 0.9324f, 0.4169f },
+    { 2.2776f, -10.7249f, 1.0845f, 0.9348f, 0.4076f },
+    { 2.2192f, -11.6981f, 0.9531f, 0.9354f, 0.4179f },
+    { 2.2292f, -12.5203f, 1.0534f, 0.9325f, 0.4259f },
+    { 2.2561f, -11.9759f, 0.7646f, 0.9376f, 0.4198f },
+    { 2.2388f, -12.8442f, 0.8328f, 0.9346f, 0.4275f },
+    { 2.3546f, -12.9615f, 1.1568f, 0.9312f, 0.4309f },
+    { 2.3486f, -13.2986f, 0.8955f, 0.9338f, 0.4319f },
+    { 2.5334f, -13.4883f, 0.9364f, 0.9344f, 0.4345f },
+    { 2.7523f, -13.7794f, 0.6051f, 0.9388f, 0.4365f },
+    { 2.5535f, -13.7309f, 0.6284f, 0.9375f, 0.4349f },
+    { 2.3731f, -13.5584f, 0.6258f, 0.9363f, 0.4328f },
+    { 2.7435f, -13.7994f, 0.3829f, 0.9405f, 0.4361f },
+    { 2.2713f, -13.1201f, 0.6065f, 0.9365f, 0.429f },
+    { 2.5706f, -13.7627f, 0.4103f, 0.9393f, 0.4348f },
+    { 2.4098f, -13.6113f, 0.4177f, 0.9382f, 0.4331f },
+    { 2.3083f, -12.2745f, 0.5798f, 0.9393f, 0.4221f },
+    { 2.3237f, -13.2426f, 0.4113f, 0.9383f, 0.43f },
+    { 2.3752f, -12.5539f, 0.3976f, 0.9406f, 0.4247f },
+    { 2.4095f, -13.2236f, 0.3085f, 0.9397f, 0.4302f },
+    { 2.4653f, -12.8685f, 0.2619f, 0.9413f, 0.4277f },
+    { 2.4755f, -13.5013f, 0.2788f, 0.9398f, 0.4326f },
+    { 2.5871f, -13.2724f, 0.2167f, 0.9415f, 0.4314f },
+    { 2.5804f, -13.6541f, 0.308f, 0.9401f, 0.4341f },
+    { 2.695f, -13.6284f, 0.2582f, 0.9412f, 0.4346f },
+    { 2.7051f, -13.087f, 0.188f, 0.9429f, 0.4306f },
+    { 2.8178f, -13.5377f, 0.221f, 0.9424f, 0.4348f },
+    { 2.8902f, -13.7336f, 0.3373f, 0.9419f, 0.4368f },
+    { 2.9724f, -13.577f, 0.2751f, 0.9433f, 0.4369f },
+    { 2.8887f, -13.436f, 0.1685f, 0.9433f, 0.4349f },
+    { 2.79f, -13.1075f, 0.1492f, 0.9435f, 0.4315f },
+    { 2.8815f, -13.1776f, 0.1801f, 0.944f, 0.4332f },
+    { 2.781f, -12.803f, 0.1717f, 0.9444f, 0.4293f },
+    { 2.9617f, -13.2034f, 0.2404f, 0.9447f, 0.4344f },
+    { 3.0273f, -11.6136f, 3.0313f, 0.9049f, 0.4398f },
+    { 3.0186f, -11.6885f, 2.568f, 0.911f, 0.439f },
+    { 3.4709f, -11.8024f, 3.1089f, 0.9042f, 0.448f },
+    { 3.1353f, -11.6471f, 3.7953f, 0.8946f, 0.4425f },
+    { 2.651f, -11.3185f, 2.9141f, 0.9062f, 0.4318f },
+    { 3.5001f, -11.9063f, 2.6106f, 0.911f, 0.4479f },
+    { 3.5302f, -11.8165f, 3.8734f, 0.8937f, 0.4495f },
+    { 3.0403f, -11.8368f, 2.2929f, 0.9147f, 0.439f },
+    { 2.5987f, -11.3922f, 2.5008f, 0.9118f, 0.4306f },
+    { 2.6009f, -11.5345f, 2.2624f, 0.9151f, 0.4306f },
+    { 2.2551f, -11.1762f, 2.1892f, 0.9161f, 0.4228f },
+    { 2.2768f, -11.0292f, 2.3904f, 0.9129f, 0.4228f },
+    { 2.0567f, -10.7644f, 2.0414f, 0.9176f, 0.4158f },
+    { 2.0893f, -10.6111f, 2.218f, 0.9142f, 0.4156f },
+    { 2.1124f, -10.1696f, 2.0291f, 0.9156f, 0.4086f },
+    { 2.3669f, -10.936f, 2.7579f, 0.9078f, 0.424f },
+    { 2.2f, -10.4846f, 2.5633f, 0.9091f, 0.4163f },
+    { 2.2241f, -10.0239f, 2.3804f, 0.9127f, 0.4074f },
+    { 2.7884f, -11.3413f, 3.6597f, 0.8964f, 0.435f },
+    { 2.5212f, -10.9291f, 3.4902f, 0.8983f, 0.4272f },
+    { 2.3656f, -10.4403f, 3.3102f, 0.8996f, 0.4193f },
+    { 2.3854f, -9.9496f, 3.1581f, 0.9007f, 0.4114f },
+    { 2.4929f, -10.4267f, 4.119f, 0.8898f, 0.4223f },
+    { 2.5012f, -9.92f, 4.0087f, 0.8887f, 0.4154f },
+    { 2.4761f, -9.9081f, 4.579f, 0.884f, 0.4155f },
+    { 2.6444f, -10.9395f, 4.2588f, 0.8886f, 0.4302f },
+    { 2.4888f, -10.3921f, 4.6499f, 0.8835f, 0.4231f },
+    { 2.4107f, -9.9193f, 4.9847f, 0.8793f, 0.4156f },
+    { 2.9002f, -11.3801f, 4.4081f, 0.8866f, 0.4378f },
+    { 2.6413f, -10.8982f, 4.7353f, 0.8827f, 0.4306f },
+    { 3.2261f, -11.7045f, 4.5316f, 0.8847f, 0.4448f },
+    { 2.8759f, -11.3544f, 4.8296f, 0.8812f, 0.4379f },
+    { 3.1836f, -11.701f, 4.912f, 0.8796f, 0.4447f },
+    { 3.5884f, -11.8686f, 4.5944f, 0.8837f, 0.4509f },
+    { 3.5556f, -11.8782f, 4.9617f, 0.8786f, 0.4508f },
+    { 3.9974f, -11.8849f, 4.609f, 0.8833f, 0.457f },
+    { 3.996f, -11.8995f, 4.9816f, 0.878f, 0.457f },
+    { 4.4635f, -11.7662f, 4.5882f, 0.8832f, 0.4638f },
+    { 4.8795f, -11.5372f, 4.5412f, 0.8835f, 0.4706f },
+    { 4.509f, -11.7782f, 4.9745f, 0.8777f, 0.4643f },
+    { 3.9747f, -11.9021f, 5.2022f, 0.8749f, 0.4569f },
+    { 4.9611f, -11.5321f, 4.9459f, 0.8777f, 0.4715f },
+    { 3.4996f, -11.8725f, 5.1753f, 0.8756f, 0.4502f },
+    { 4.5098f, -11.7823f, 5.21f, 0.8743f, 0.4643f },
+    { 3.9708f, -11.9016f, 5.4551f, 0.8713f, 0.4569f },
+    { 3.1039f, -11.6822f, 5.1374f, 0.8765f, 0.4438f },
+    { 3.4885f, -11.8783f, 5.4348f, 0.872f, 0.4502f },
+    { 2.8066f, -11.3201f, 5.0967f, 0.8777f, 0.437f },
+    { 3.083f, -11.6936f, 5.4088f, 0.8729f, 0.4436f },
+    { 2.5902f, -10.8597f, 5.0567f, 0.8788f, 0.43f },
+    { 2.7834f, -11.3331f, 5.3817f, 0.8741f, 0.4369f },
+    { 2.4366f, -10.3742f, 5.0211f, 0.8794f, 0.4229f },
+    { 2.5691f, -10.8783f, 5.3602f, 0.8752f, 0.43f },
+    { 2.42f, -10.4104f, 5.3508f, 0.8758f, 0.4233f },
+    { 2.4055f, -9.9593f, 5.3418f, 0.8761f, 0.4166f },
+    { 2.3834f, -10.5135f, 5.9262f, 0.8695f, 0.4232f },
+    { 2.3892f, -10.0557f, 5.9413f, 0.873f, 0.4177f },
+    { 2.5228f, -10.968f, 5.9161f, 0.8687f, 0.4296f },
+    { 2.2713f, -10.696f, 7.0344f, 0.8575f, 0.4215f },
+    { 2.2905f, -10.2364f, 7.0742f, 0.8583f, 0.4155f },
+    { 2.3956f, -11.1428f, 6.9949f, 0.8564f, 0.4277f },
+    { 2.1394f, -10.9077f, 8.3876f, 0.8431f, 0.4186f },
+    { 2.1702f, -10.4366f, 8.4372f, 0.8437f, 0.4133f },
+    { 2.2585f, -11.3609f, 8.3308f, 0.8414f, 0.4245f },
+    { 2.0434f, -11.0983f, 9.6977f, 0.83f, 0.4149f },
+    { 2.0893f, -10.5915f, 9.727f, 0.8328f, 0.4095f },
+    { 2.1822f, -11.5807f, 9.658f, 0.8271f, 0.4206f },
+    { 1.9761f, -11.232f, 10.7365f, 0.8201f, 0.4114f },
+    { 2.0312f, -10.6857f, 10.7345f, 0.822f, 0.4057f },
+    { 2.1454f, -11.7558f, 10.7375f, 0.8158f, 0.4168f },
+    { 1.9301f, -11.2732f, 11.2757f, 0.8156f, 0.4089f },
+    { 1.9797f, -10.704f, 11.2506f, 0.8213f, 0.4045f },
+    { 2.1268f, -11.8399f, 11.3305f, 0.8099f, 0.4139f },
+    { 1.884f, -11.2863f, 11.5443f, 0.8138f, 0.407f },
+    { 1.923f, -10.6822f, 11.5008f, 0.8207f, 0.4034f },
+    { 2.1035f, -11.9022f, 11.659f, 0.8069f, 0.4117f },
+    { 1.8166f, -11.3359f, 11.7713f, 0.8122f, 0.4053f },
+    { 1.8495f, -10.6562f, 11.711f, 0.8206f, 0.4018f },
+    { 2.0524f, -12.0121f, 11.9448f, 0.804f, 0.4096f },
+    { 1.7405f, -11.4195f, 11.9613f, 0.8107f, 0.4038f },
+    { 1.7732f, -10.6401f, 11.884f, 0.8206f, 0.4002f },
+    { 1.9777f, -12.1801f, 12.1871f, 0.8011f, 0.4077f },
+    { 1.6687f, -11.5348f, 12.119f, 0.809f, 0.4024f },
+    { 1.7083f, -10.6481f, 12.0226f, 0.8206f, 0.3991f },
+    { 1.8835f, -12.4169f, 12.3852f, 0.7979f, 0.4059f },
+    { 1.5482f, -11.6413f, 12.2311f, 0.8077f, 0.4005f },
+    { 1.6118f, -10.6644f, 12.1117f, 0.8206f, 0.398f },
+    { 1.7121f, -12.6502f, 12.5318f, 0.7952f, 0.4033f },
+    { 1.326f, -11.6987f, 12.2843f, 0.8074f, 0.3975f },
+    { 1.4402f, -10.6735f, 12.1362f, 0.8211f, 0.3961f },
+    { 1.4061f, -12.8072f, 12.6196f, 0.794f, 0.3989f },
+    { 0.9895f, -11.7223f, 12.2953f, 0.8076f, 0.3926f },
+    { 1.1295f, -10.6859f, 12.1122f, 0.8216f, 0.3942f },
+    { 0.6154f, -10.7121f, 12.0559f, 0.8215f, 0.3862f },
+    { 0.9969f, -12.8817f, 12.6675f, 0.7938f, 0.3925f },
+    { 0.5263f, -11.7274f, 12.281f, 0.8078f, 0.3849f },
+    { -0.0003f, -10.7285f, 12.0196f, 0.8214f, 0.3782f },
+    { -0.0003f, -11.7253f, 12.2675f, 0.808f, 0.3759f },
+    { 0.5162f, -12.8669f, 12.6942f, 0.7942f, 0.3839f },
+    { -0.0003f, -12.8372f, 12.7022f, 0.7946f, 0.3737f },
+    { 1.1227f, -14.0634f, 13.1203f, 0.78f, 0.3925f },
+    { 0.5755f, -14.0637f, 13.2282f, 0.7807f, 0.3834f },
+    { -0.0003f, -14.0165f, 13.2825f, 0.7823f, 0.3736f },
+    { 1.6126f, -13.8735f, 13.0137f, 0.781f, 0.4002f },
+    { 1.4259f, -15.0922f, 13.6603f, 0.7667f, 0.3936f },
+    { 0.8166f, -15.1546f, 13.8713f, 0.7672f, 0.3842f },
+    { -0.0003f, -15.3064f, 14.1622f, 0.7699f, 0.3734f },
+    { 1.3521f, -15.9765f, 14.6116f, 0.7533f, 0.3871f },
+    { 0.8458f, -16.1277f, 14.9104f, 0.7525f, 0.3792f },
+    { 0.5804f, -16.4493f, 15.2536f, 0.7491f, 0.374f },
+    { -0.0003f, -16.1579f, 14.9429f, 0.7607f, 0.3701f },
+    { 1.4395f, -16.7462f, 15.72f, 0.7388f, 0.3823f },
+    { 0.4856f, -16.8379f, 15.7595f, 0.7429f, 0.3703f },
+    { -0.0003f, -16.6682f, 15.5615f, 0.7515f, 0.3667f },
+    { 1.0759f, -16.9429f, 15.9188f, 0.7379f, 0.3768f },
+    { 0.8478f, -17.0482f, 16.0964f, 0.7369f, 0.3732f },
+    { 1.4008f, -17.2583f, 16.6717f, 0.7276f, 0.3774f },
+    { 0.9643f, -17.3022f, 16.6566f, 0.7299f, 0.3721f },
+    { 0.4911f, -17.1903f, 16.5465f, 0.7339f, 0.3668f },
+    { -0.0003f, -17.0955f, 16.4678f, 0.7387f, 0.3617f },
+    { 0.5382f, -17.5104f, 17.469f, 0.7238f, 0.3635f },
+    { -0.0003f, -17.4611f, 17.477f, 0.726f, 0.3566f },
+    { -0.0003f, -17.7863f, 18.4043f, 0.7169f, 0.3534f },
+    { 1.0735f, -17.5499f, 17.4721f, 0.7206f, 0.3699f },
+    { 0.568f, -17.8022f, 18.3816f, 0.7139f, 0.3602f },
+    { -0.0003f, -18.0514f, 19.2115f, 0.7077f, 0.3502f },
+    { 1.6023f, -17.4709f, 17.5132f, 0.7174f, 0.3762f },
+    { 0.5706f, -18.0468f, 19.2059f, 0.7054f, 0.357f },
+    { -0.0003f, -18.2363f, 19.8605f, 0.7027f, 0.348f },
+    { 1.1421f, -17.7816f, 18.3745f, 0.7106f, 0.3671f },
+    { 0.5362f, -18.2252f, 19.8637f, 0.6991f, 0.354f },
+    { 1.1533f, -17.985f, 19.2287f, 0.7016f, 0.3638f },
+    { 1.7277f, -17.6562f, 18.4441f, 0.7067f, 0.3739f },
+    { 1.7596f, -17.818f, 19.3199f, 0.6971f, 0.3707f },
+    { 1.0905f, -18.1478f, 19.9f, 0.6951f, 0.3602f },
+    { 2.4071f, -17.5103f, 19.4856f, 0.6916f, 0.3785f },
+    { 0.4836f, -18.3899f, 20.4327f, 0.6942f, 0.3508f },
+    { 0.9913f, -18.3122f, 20.4735f, 0.6901f, 0.3562f },
+    { 1.6805f, -17.9602f, 19.9959f, 0.6904f, 0.3668f },
+    { 1.5469f, -18.1215f, 20.5639f, 0.6854f, 0.3623f },
+    { 2.319f, -17.6362f, 20.1669f, 0.6846f, 0.3744f },
+    { 2.1555f, -17.8019f, 20.7188f, 0.6796f, 0.3694f },
+    { 1.9938f, -18.028f, 21.2515f, 0.6752f, 0.3639f },
+    { 3.0189f, -17.1493f, 20.4282f, 0.6774f, 0.3835f },
+    { 1.8673f, -18.2917f, 21.7722f, 0.6711f, 0.3581f },
+    { 2.8224f, -17.337f, 20.9532f, 0.6727f, 0.3781f },
+    { 2.6267f, -17.5565f, 21.4611f, 0.6684f, 0.3722f },
+    { 2.385f, -18.0655f, 22.533f, 0.6594f, 0.3599f },
+    { 2.4686f, -17.8015f, 21.9788f, 0.6642f, 0.3661f },
+    { 3.4853f, -16.7277f, 21.308f, 0.6641f, 0.3876f },
+    { 3.2575f, -16.947f, 21.7854f, 0.66f, 0.3816f },
+    { 3.7113f, -16.5078f, 20.8172f, 0.6685f, 0.3936f },
+    { 4.0815f, -15.9748f, 21.8243f, 0.6534f, 0.3977f },
+    { 4.3277f, -15.7199f, 21.3715f, 0.6576f, 0.404f },
+    { 4.6288f, -15.3862f, 20.8955f, 0.6619f, 0.4114f },
+    { 3.8297f, -16.2207f, 22.2657f, 0.6497f, 0.3913f },
+    { 3.976f, -16.2598f, 20.1058f, 0.6757f, 0.4006f },
+    { 4.7531f, -14.7862f, 21.9305f, 0.646f, 0.4151f },
+    { 3.0675f, -17.1738f, 22.289f, 0.6558f, 0.3753f },
+    { 2.9549f, -17.416f, 22.8584f, 0.6509f, 0.3688f },
+    { 2.3503f, -18.3286f, 23.1018f, 0.6547f, 0.3535f },
+    { 3.9363f, -8.9777f, 3.8118f, 0.8951f, 0.5181f },
+    { 4.3274f, -9.0574f, 3.8534f, 0.8937f, 0.5124f },
+    { 4.0154f, -9.0474f, 2.9986f, 0.9051f, 0.5158f },
+    { 3.5338f, -9.0621f, 2.9957f, 0.9067f, 0.5223f },
+    { 3.8994f, -8.8373f, 4.2096f, 0.8898f, 0.5192f },
+    { 3.5414f, -8.987f, 3.824f, 0.8961f, 0.5237f },
+    { 3.5461f, -9.134f, 2.1679f, 0.9171f, 0.5204f },
+    { 3.0562f, -9.2237f, 3.0261f, 0.9085f, 0.529f },
+    { 2.9818f, -9.3009f, 2.1914f, 0.9197f, 0.5277f },
+    { 4.0978f, -9.1333f, 2.189f, 0.915f, 0.5132f },
+    { 2.9308f, -9.4045f, 1.7687f, 0.9255f, 0.527f },
+    { 4.4392f, -9.18f, 3.0532f, 0.9035f, 0.5096f },
+    { 3.5488f, -9.269f, 1.7585f, 0.9226f, 0.5191f },
+    { 4.5292f, -9.3195f, 2.2546f, 0.9135f, 0.5068f },
+    { 4.1449f, -9.3223f, 1.8021f, 0.9204f, 0.5113f },
+    { 4.5876f, -9.5568f, 1.863f, 0.9191f, 0.5044f },
+    { 4.7756f, -9.4371f, 3.1462f, 0.902f, 0.5035f },
+    { 3.5689f, -9.4579f, 1.5605f, 0.9258f, 0.518f },
+    { 4.8318f, -9.6208f, 2.3544f, 0.9123f, 0.5009f },
+    { 2.9112f, -9.5603f, 1.5618f, 0.9288f, 0.5263f },
+    { 4.883f, -9.8889f, 1.9389f, 0.9184f, 0.4984f },
+    { 4.9972f, -9.9654f, 2.4781f, 0.9111f, 0.4954f },
+    { 4.6478f, -9.7815f, 1.6561f, 0.9225f, 0.5029f },
+    { 4.9952f, -9.7958f, 3.2643f, 0.9005f, 0.4973f },
+    { 5.1184f, -10.1958f, 3.3952f, 0.8991f, 0.4913f },
+    { 4.7212f, -9.245f, 4.0561f, 0.8905f, 0.5062f },
+    { 5.0181f, -9.6935f, 4.0736f, 0.8899f, 0.4986f },
+    { 5.1657f, -10.5768f, 3.5263f, 0.8976f, 0.4858f },
+    { 5.1887f, -10.1105f, 4.18f, 0.8884f, 0.4924f },
+    { 5.1169f, -10.934f, 3.6474f, 0.8962f, 0.4803f },
+    { 5.2743f, -10.4958f, 4.2911f, 0.8869f, 0.4869f },
+    { 5.1378f, -11.2227f, 4.4771f, 0.8843f, 0.4765f },
+    { 5.2617f, -10.8623f, 4.3943f, 0.8855f, 0.4818f },
+    { 5.2188f, -11.1789f, 4.9018f, 0.8782f, 0.4776f },
+    { 4.9731f, -11.5253f, 5.2f, 0.874f, 0.4718f },
+    { 5.3219f, -10.7788f, 4.8407f, 0.8791f, 0.4831f },
+    { 4.501f, -11.7775f, 5.4652f, 0.8706f, 0.4644f },
+    { 5.2328f, -11.1435f, 5.1739f, 0.8743f, 0.4783f },
+    { 4.9574f, -11.5165f, 5.4627f, 0.8702f, 0.4719f },
+    { 3.9675f, -11.9759f, 5.963f, 0.8641f, 0.4567f },
+    { 4.4945f, -11.8498f, 5.9711f, 0.8633f, 0.4641f },
+    { 3.4697f, -11.9561f, 5.9541f, 0.865f, 0.4497f },
+    { 3.9483f, -12.2029f, 6.9487f, 0.8504f, 0.4554f },
+    { 3.0447f, -11.7751f, 5.9422f, 0.866f, 0.4431f },
+    { 3.3908f, -12.1661f, 6.9469f, 0.8518f, 0.448f },
+    { 2.7361f, -11.4171f, 5.9255f, 0.8674f, 0.4363f },
+    { 2.9123f, -11.9665f, 6.9535f, 0.8533f, 0.4409f },
+    { 2.5949f, -11.5958f, 6.9687f, 0.8549f, 0.4341f },
+    { 2.4489f, -11.8278f, 8.2724f, 0.8395f, 0.4308f },
+    { 2.7807f, -12.2206f, 8.2241f, 0.8375f, 0.4376f },
+    { 2.3873f, -12.0715f, 9.5977f, 0.8243f, 0.4267f },
+    { 2.745f, -12.4899f, 9.5355f, 0.8215f, 0.4336f },
+    { 2.3863f, -12.2803f, 10.7002f, 0.8118f, 0.4228f },
+    { 2.7798f, -12.727f, 10.6469f, 0.8079f, 0.43f },
+    { 2.422f, -12.4073f, 11.3357f, 0.8046f, 0.4202f },
+    { 2.86f, -12.8844f, 11.3176f, 0.7995f, 0.4277f },
+    { 2.444f, -12.5106f, 11.7267f, 0.8002f, 0.418f },
+    { 2.9162f, -13.0141f, 11.7671f, 0.7939f, 0.4256f },
+    { 2.4019f, -12.6479f, 12.0961f, 0.7961f, 0.4154f },
+    { 2.8787f, -13.1686f, 12.2148f, 0.7888f, 0.4225f },
+    { 2.3145f, -12.862f, 12.4217f, 0.792f, 0.4126f },
+    { 2.7805f, -13.4169f, 12.6207f, 0.7837f, 0.4188f },
+    { 2.2008f, -13.1956f, 12.6812f, 0.7875f, 0.4098f },
+    { 2.6539f, -13.8284f, 12.9451f, 0.7782f, 0.4149f },
+    { 1.9903f, -13.5618f, 12.8776f, 0.7836f, 0.4061f },
+    { 2.4158f, -14.3107f, 13.2119f, 0.773f, 0.4098f },
+    { 1.9827f, -14.7714f, 13.4454f, 0.769f, 0.4024f },
+    { 1.9658f, -15.7931f, 14.2937f, 0.7543f, 0.3966f },
+    { 2.5537f, -15.3747f, 13.8935f, 0.7582f, 0.4065f },
+    { 1.9588f, -16.537f, 15.4693f, 0.7394f, 0.3901f },
+    { 2.765f, -16.2037f, 15.117f, 0.7404f, 0.4021f },
+    { 2.4137f, -16.8435f, 16.465f, 0.7256f, 0.3913f },
+    { 3.1298f, -16.4707f, 16.384f, 0.7238f, 0.4014f },
+    { 1.8631f, -17.0937f, 16.6039f, 0.7263f, 0.3835f },
+    { 2.1522f, -17.2771f, 17.5547f, 0.7144f, 0.3831f },
+    { 2.7509f, -16.9724f, 17.5591f, 0.7116f, 0.3913f },
+    { 2.3425f, -17.4033f, 18.5651f, 0.7022f, 0.3815f },
+    { 3.0042f, -17.0002f, 18.7121f, 0.6972f, 0.3903f },
+    { 3.1136f, -17.0261f, 19.7324f, 0.6849f, 0.3879f },
+    { 3.7117f, -16.4683f, 18.8218f, 0.6926f, 0.4006f },
+    { 3.4445f, -16.5387f, 17.5943f, 0.7083f, 0.4011f },
+    { 4.4639f, -15.8287f, 18.8307f, 0.6893f, 0.4126f },
+    { 4.279f, -15.9581f, 17.728f, 0.7036f, 0.413f },
+    { 4.0885f, -15.9386f, 16.4897f, 0.7193f, 0.4144f },
+    { 5.1221f, -15.1322f, 18.8547f, 0.6861f, 0.4245f },
+    { 5.053f, -15.2557f, 17.9066f, 0.6985f, 0.4255f },
+    { 4.7004f, -15.4955f, 19.7365f, 0.6767f, 0.4148f },
+    { 5.0963f, -15.0416f, 19.4717f, 0.6782f, 0.4232f },
+    { 5.0457f, -14.9034f, 20.3843f, 0.6663f, 0.4212f },
+    { 5.4085f, -14.5063f, 19.7763f, 0.6724f, 0.4299f },
+    { 5.5474f, -14.4294f, 19.0098f, 0.6819f, 0.4342f },
+    { 5.628f, -13.8367f, 20.0929f, 0.6662f, 0.4375f },
+    { 5.5647f, -14.4567f, 18.0764f, 0.694f, 0.4369f },
+    { 5.7945f, -13.7028f, 19.2027f, 0.6774f, 0.443f },
+    { 5.8692f, -13.6144f, 18.2172f, 0.6902f, 0.4475f },
+    { 5.5627f, -14.3722f, 16.9675f, 0.7082f, 0.4408f },
+    { 5.88f, -13.448f, 17.1951f, 0.7036f, 0.4523f },
+    { 6.0215f, -12.7821f, 18.3086f, 0.687f, 0.4576f },
+    { 4.997f, -15.2411f, 16.7087f, 0.7137f, 0.4282f },
+    { 6.0436f, -12.5844f, 17.3207f, 0.7002f, 0.4629f },
+    { 4.0327f, -15.7147f, 15.3688f, 0.7333f, 0.4183f },
+    { 4.9987f, -15.0307f, 15.5936f, 0.7277f, 0.4329f },
+    { 4.2524f, -15.2309f, 14.6181f, 0.7423f, 0.4261f },
+    { 5.5661f, -14.1529f, 15.9232f, 0.7216f, 0.4457f },
+    { 5.1029f, -14.5671f, 14.8937f, 0.7366f, 0.4396f },
+    { 5.5996f, -13.7755f, 15.1838f, 0.7315f, 0.4513f },
+    { 5.8631f, -13.2186f, 16.2316f, 0.7163f, 0.4571f },
+    { 5.8543f, -12.9409f, 15.422f, 0.7273f, 0.4618f },
+    { 6.0181f, -12.3653f, 16.3927f, 0.7128f, 0.4676f },
+    { 5.9787f, -12.148f, 15.5415f, 0.7247f, 0.4717f },
+    { 6.0533f, -11.5627f, 16.4604f, 0.7105f, 0.4775f },
+    { 5.9898f, -11.3833f, 15.5811f, 0.723f, 0.4814f },
+    { 6.0857f, -11.7647f, 17.3807f, 0.6977f, 0.4728f },
+    { 5.9044f, -10.6331f, 15.5791f, 0.722f, 0.4911f },
+    { 5.9908f, -10.7801f, 16.4885f, 0.7087f, 0.4873f },
+    { 6.0605f, -11.9688f, 18.3591f, 0.6843f, 0.4673f },
+    { 6.0385f, -10.9721f, 17.4116f, 0.6955f, 0.4825f },
+    { 5.9178f, -12.9349f, 19.3397f, 0.6735f, 0.452f },
+    { 5.9511f, -12.1541f, 19.413f, 0.6702f, 0.4612f },
+    { 5.7239f, -13.0891f, 20.313f, 0.6607f, 0.4459f },
+    { 5.3419f, -14.1395f, 20.8294f, 0.6576f, 0.4299f },
+    { 5.0218f, -14.4948f, 21.4344f, 0.6511f, 0.4219f },
+    { 5.4311f, -13.2907f, 21.1273f, 0.6502f, 0.4393f },
+    { 5.1203f, -13.5074f, 21.7963f, 0.6417f, 0.4329f },
+    { 4.8727f, -13.7068f, 22.3336f, 0.6353f, 0.4271f },
+    { 5.0849f, -12.4589f, 21.9869f, 0.6342f, 0.4447f },
+    { 5.419f, -12.3915f, 21.2782f, 0.6444f, 0.4495f },
+    { 5.4117f, -11.4764f, 21.2821f, 0.6407f, 0.4607f },
+    { 5.7424f, -12.3015f, 20.4251f, 0.6565f, 0.455f },
+    { 5.7294f, -11.5118f, 20.418f, 0.6538f, 0.4646f },
+    { 5.928f, -11.3888f, 19.4146f, 0.6679f, 0.4704f },
+    { 6.0251f, -11.1836f, 18.3773f, 0.6821f, 0.4769f },
+    { 5.9089f, -10.4186f, 18.3885f, 0.6798f, 0.4863f },
+    { 5.8914f, -10.2075f, 17.4345f, 0.6934f, 0.4921f },
+    { 5.8114f, -10.027f, 16.4856f, 0.7073f, 0.4972f },
+    { 5.6337f, -9.4718f, 17.4706f, 0.6911f, 0.5018f },
+    { 5.6844f, -9.9022f, 15.5283f, 0.7217f, 0.5013f },
+    { 5.496f, -9.313f, 16.4604f, 0.7064f, 0.5073f },
+    { 5.2916f, -9.1952f, 15.4214f, 0.7225f, 0.5124f },
+    { 5.1813f, -8.6511f, 16.4225f, 0.7054f, 0.5168f },
+    { 4.8785f, -8.5582f, 15.2822f, 0.7235f, 0.523f },
+    { 5.0843f, -9.1212f, 14.5021f, 0.737f, 0.5163f },
+    { 4.4052f, -8.5292f, 14.1381f, 0.7431f, 0.53f },
+    { 5.5389f, -9.8175f, 14.6465f, 0.7352f, 0.5044f },
+    { 4.3264f, -8.6788f, 13.6385f, 0.752f, 0.529f },
+    { 5.7994f, -10.5162f, 14.7241f, 0.7346f, 0.4941f },
+    { 4.9381f, -9.0938f, 13.8508f, 0.7474f, 0.5178f },
+    { 5.4034f, -9.7577f, 13.9245f, 0.7462f, 0.5063f },
+    { 5.9154f, -11.2214f, 14.7502f, 0.7351f, 0.4846f },
+    { 5.6956f, -10.4144f, 13.9645f, 0.7459f, 0.4962f },
+    { 5.9365f, -11.9372f, 14.7401f, 0.736f, 0.4752f },
+    { 5.8502f, -11.0718f, 13.9754f, 0.7463f, 0.487f },
+    { 5.8491f, -12.6508f, 14.6798f, 0.7377f, 0.4659f },
+    { 5.9025f, -11.7375f, 13.9616f, 0.7471f, 0.478f },
+    { 5.6393f, -13.3494f, 14.5549f, 0.7402f, 0.4567f },
+    { 5.8428f, -12.384f, 13.9186f, 0.7484f, 0.4693f },
+    { 5.2298f, -14.0174f, 14.3512f, 0.7439f, 0.4466f },
+    { 5.6613f, -12.9835f, 13.8422f, 0.7502f, 0.461f },
+    { 5.3f, -13.5486f, 13.7083f, 0.753f, 0.452f },
+    { 4.7011f, -14.0916f, 13.4933f, 0.7573f, 0.4412f },
+    { 5.3309f, -13.1828f, 13.0524f, 0.7624f, 0.456f },
+    { 4.5432f, -14.6392f, 14.0541f, 0.7493f, 0.4347f },
+    { 4.7748f, -13.6434f, 12.9414f, 0.7655f, 0.446f },
+    { 3.986f, -14.403f, 13.2709f, 0.763f, 0.4305f },
+    { 5.6686f, -12.6918f, 13.1419f, 0.7601f, 0.4643f },
+    { 5.3402f, -12.9419f, 12.4708f, 0.7705f, 0.4589f },
+    { 5.8348f, -12.1572f, 13.2101f, 0.7585f, 0.472f },
+    { 5.6644f, -12.488f, 12.5505f, 0.7684f, 0.4668f },
+    { 5.8768f, -11.5655f, 13.2575f, 0.7573f, 0.4802f },
+    { 5.8247f, -11.9871f, 12.6259f, 0.7667f, 0.4741f },
+    { 5.8045f, -10.9499f, 13.2877f, 0.7563f, 0.4886f },
+    { 5.8598f, -11.4375f, 12.6796f, 0.7655f, 0.4817f },
+    { 5.6278f, -10.3435f, 13.3044f, 0.7558f, 0.4973f },
+    { 5.7887f, -10.871f, 12.7182f, 0.7647f, 0.4894f },
+    { 5.2976f, -9.6627f, 13.2609f, 0.7564f, 0.5077f },
+    { 5.6307f, -10.3189f, 12.748f, 0.7641f, 0.4972f },
+    { 4.8177f, -9.0399f, 13.3943f, 0.7547f, 0.5188f },
+    { 4.2807f, -8.6874f, 13.3059f, 0.7575f, 0.5286f },
+    { 4.6878f, -8.8861f, 13.0593f, 0.7604f, 0.5212f },
+    { 4.2547f, -8.6647f, 13.0505f, 0.7617f, 0.5285f },
+    { 3.5948f, -8.7686f, 13.1824f, 0.7629f, 0.5381f },
+    { 3.4751f, -8.7142f, 13.3161f, 0.7609f, 0.5406f },
+    { 3.6736f, -8.7719f, 12.9833f, 0.7656f, 0.5364f },
+    { 4.0144f, -8.1877f, 14.0188f, 0.7437f, 0.5382f },
+    { 2.6683f, -9.1975f, 12.7399f, 0.7762f, 0.5483f },
+    { 4.5978f, -8.0374f, 15.1341f, 0.7239f, 0.5315f },
+    { 3.2218f, -8.6008f, 13.2401f, 0.7617f, 0.5451f },
+    { 3.7489f, -7.7013f, 13.8263f, 0.7436f, 0.5464f },
+    { 2.4219f, -9.1872f, 12.7008f, 0.7777f, 0.5515f },
+    { 2.9275f, -8.1893f, 13.0885f, 0.7617f, 0.5522f },
+    { 4.4174f, -7.4693f, 14.9799f, 0.7232f, 0.54f },
+    { 3.5669f, -6.8775f, 13.6899f, 0.7403f, 0.5568f },
+    { 5.004f, -8.0543f, 16.3817f, 0.7041f, 0.525f },
+    { 4.3055f, -6.6908f, 14.8223f, 0.7209f, 0.5504f },
+    { 4.9211f, -7.4208f, 16.3097f, 0.7024f, 0.5334f },
+    { 5.3851f, -8.7789f, 17.5136f, 0.6886f, 0.5108f },
+    { 5.265f, -8.1427f, 17.5575f, 0.6859f, 0.5187f },
+    { 4.8896f, -6.6489f, 16.1782f, 0.7003f, 0.5437f },
+    { 5.2479f, -7.483f, 17.5762f, 0.6831f, 0.5269f },
+    { 5.4096f, -8.3192f, 18.608f, 0.6702f, 0.5122f },
+    { 5.308f, -6.7199f, 17.5437f, 0.6802f, 0.5367f },
+    { 5.4102f, -7.6691f, 18.7511f, 0.6658f, 0.5197f },
+    { 5.5079f, -8.9558f, 18.485f, 0.6741f, 0.5048f },
+    { 5.4205f, -7.992f, 19.8066f, 0.6509f, 0.511f },
+    { 5.7054f, -9.6658f, 18.4181f, 0.6773f, 0.4959f },
+    { 5.8482f, -10.6352f, 19.3611f, 0.6662f, 0.4799f },
+    { 5.7116f, -9.8893f, 19.269f, 0.6652f, 0.4897f },
+    { 5.6905f, -10.7315f, 20.2895f, 0.6529f, 0.4747f },
+    { 5.4171f, -10.5816f, 21.1112f, 0.6398f, 0.4726f },
+    { 5.2181f, -9.34f, 21.378f, 0.6313f, 0.4866f },
+    { 5.4431f, -9.7436f, 20.7374f, 0.6425f, 0.4848f },
+    { 5.6312f, -9.9721f, 20.0373f, 0.654f, 0.4853f },
+    { 5.337f, -8.5247f, 20.6972f, 0.6391f, 0.5003f },
+    { 5.5678f, -9.1961f, 19.266f, 0.663f, 0.4985f },
+    { 5.467f, -9.053f, 20.1854f, 0.6486f, 0.4961f },
+    { 5.5603f, -9.4057f, 19.8299f, 0.6552f, 0.4933f },
+    { 5.4664f, -8.6004f, 19.4798f, 0.6578f, 0.5049f },
+    { 5.443f, -7.2608f, 20.1426f, 0.6433f, 0.5188f },
+    { 5.5095f, -6.9188f, 18.8786f, 0.6611f, 0.5286f },
+    { 5.2388f, -7.8766f, 21.2132f, 0.6292f, 0.5061f },
+    { 5.3946f, -5.8521f, 17.5192f, 0.6768f, 0.5479f },
+    { 5.0272f, -8.8972f, 21.9679f, 0.6208f, 0.4892f },
+    { 5.1339f, -6.9928f, 21.8447f, 0.617f, 0.5146f },
+    { 5.514f, -6.3876f, 20.3886f, 0.6369f, 0.529f },
+    { 4.9401f, -5.6892f, 22.7411f, 0.6004f, 0.5283f },
+    { 5.3047f, -5.5811f, 21.6818f, 0.6159f, 0.5342f },
+    { 4.6203f, -4.4088f, 23.5643f, 0.5852f, 0.5427f },
+    { 5.0798f, -4.4117f, 22.5919f, 0.6001f, 0.5466f },
+    { 4.041f, -4.3654f, 24.4757f, 0.57f, 0.5396f },
+    { 4.7315f, -3.0937f, 23.3863f, 0.5857f, 0.5619f },
+    { 3.333f, -4.2895f, 25.2603f, 0.5549f, 0.5373f },
+    { 4.1577f, -3.0531f, 24.3246f, 0.5705f, 0.5591f },
+    { 3.4349f, -3.0068f, 25.1319f, 0.5552f, 0.5566f },
+    { 2.3887f, -5.4602f, 26.0083f, 0.5398f, 0.5162f },
+    { 2.4872f, -4.1893f, 25.8526f, 0.5401f, 0.536f },
+    { 1.5454f, -5.345f, 26.4585f, 0.526f, 0.5156f },
+    { 0.7289f, -6.4157f, 26.8608f, 0.514f, 0.4968f },
+    { 1.6046f, -4.0993f, 26.2577f, 0.5263f, 0.5353f },
+    { 0.7121f, -7.3631f, 26.8465f, 0.5144f, 0.4812f },
+    { 0.7584f, -5.2665f, 26.703f, 0.514f, 0.5155f },
+    { 0.7051f, -8.0824f, 26.8277f, 0.5148f, 0.4688f },
+    { 0.7052f, -8.5471f, 26.9718f, 0.515f, 0.4598f },
+    { -0.0003f, -8.0432f, 26.8928f, 0.503f, 0.469f },
+    { 0.7098f, -8.8956f, 27.2047f, 0.5149f, 0.4524f },
+    { -0.0003f, -8.4976f, 27.0425f, 0.503f, 0.4601f },
+    { -0.0003f, -8.8329f, 27.2789f, 0.503f, 0.4528f },
+    { -0.0003f, -9.1981f, 27.5185f, 0.503f, 0.4451f },
+    { -0.7105f, -8.8956f, 27.2047f, 0.4907f, 0.4528f },
+    { -0.7058f, -8.5471f, 26.9718f, 0.4907f, 0.4602f },
+    { -1.4092f, -8.7366f, 26.7265f, 0.4773f, 0.4599f },
+    { -1.4186f, -8.2301f, 26.605f, 0.4779f, 0.469f },
+    { -0.7058f, -8.0824f, 26.8277f, 0.4909f, 0.4691f },
+    { -1.4421f, -7.4879f, 26.6108f, 0.4789f, 0.4815f },
+    { -1.4833f, -6.522f, 26.6075f, 0.4796f, 0.4972f },
+    { -0.7127f, -7.3631f, 26.8465f, 0.4914f, 0.4815f },
+    { -2.3894f, -5.4602f, 26.0083f, 0.4655f, 0.5169f },
+    { -1.5461f, -5.345f, 26.4585f, 0.4796f, 0.516f },
+    { -2.4879f, -4.1893f, 25.8526f, 0.4653f, 0.5366f },
+    { -3.4356f, -3.0068f, 25.1319f, 0.45f, 0.5574f },
+    { -3.511f, -1.7644f, 24.9822f, 0.4494f, 0.5758f },
+    { -2.555f, -2.9613f, 25.7159f, 0.4653f, 0.5554f },
+    { -1.6053f, -4.0993f, 26.2577f, 0.4794f, 0.5357f },
+    { -2.6138f, -1.7627f, 25.5843f, 0.4649f, 0.5734f },
+    { -1.636f, -2.9276f, 26.0989f, 0.4794f, 0.5539f },
+    { -3.561f, -0.596f, 24.8033f, 0.4483f, 0.5931f },
+    { -1.672f, -1.7729f, 25.9737f, 0.4792f, 0.5715f },
+    { -4.2472f, -0.6249f, 23.9512f, 0.4329f, 0.5956f },
+    { -2.6874f, -0.5796f, 25.4441f, 0.4637f, 0.5911f },
+    { -3.5983f, 0.5635f, 24.6403f, 0.4472f, 0.6101f },
+    { -4.7579f, -0.6609f, 22.9922f, 0.4179f, 0.5982f },
+    { -4.2375f, 0.5172f, 23.7863f, 0.4322f, 0.6121f },
+    { -5.0114f, 0.4521f, 21.8805f, 0.4038f, 0.6173f },
+    { -4.7025f, 0.4796f, 22.8406f, 0.4177f, 0.6146f },
+    { -5.1348f, 1.6211f, 20.8203f, 0.3907f, 0.6369f },
+    { -4.968f, 1.648f, 21.788f, 0.4041f, 0.6341f },
+    { -4.6834f, 1.6823f, 22.7629f, 0.418f, 0.6315f },
+    { -5.1349f, 2.7968f, 20.7233f, 0.3908f, 0.6534f },
+    { -4.2437f, 1.7236f, 23.6931f, 0.4322f, 0.6293f },
+    { -4.9877f, 2.8377f, 21.7128f, 0.4043f, 0.6507f },
+    { -4.7198f, 2.8889f, 22.7106f, 0.4184f, 0.6484f },
+    { -5.2057f, 3.9273f, 20.6285f, 0.3907f, 0.6691f },
+    { -5.0838f, 3.9701f, 21.6143f, 0.404f, 0.6666f },
+    { -4.2936f, 2.9485f, 23.6425f, 0.4324f, 0.6465f },
+    { -4.8309f, 4.0412f, 22.6354f, 0.4181f, 0.6645f },
+    { -3.6351f, 1.7794f, 24.5386f, 0.4466f, 0.6276f },
+    { -4.4149f, 4.1464f, 23.6053f, 0.4322f, 0.6632f },
+    { -3.7028f, 3.0245f, 24.4895f, 0.4464f, 0.6452f },
+    { -2.8441f, 1.8572f, 25.259f, 0.4614f, 0.6266f },
+    { -2.941f, 3.1249f, 25.2327f, 0.4608f, 0.6446f },
+    { -2.7671f, 0.6172f, 25.3255f, 0.4624f, 0.6087f },
+    { -2.0439f, 3.2028f, 25.7993f, 0.4752f, 0.6443f },
+    { -1.747f, -0.5785f, 25.8737f, 0.4782f, 0.5894f },
+    { -1.9372f, 1.9146f, 25.7953f, 0.476f, 0.6259f },
+    { -1.8418f, 0.6519f, 25.8104f, 0.477f, 0.6076f },
+    { -0.9201f, 0.6414f, 26.0634f, 0.4904f, 0.6066f },
+    { -0.8602f, -0.5954f, 26.0922f, 0.4911f, 0.5883f },
+    { -0.9811f, 1.9093f, 26.0882f, 0.4898f, 0.625f },
+    { -0.0003f, 0.6249f, 26.1319f, 0.5031f, 0.6061f },
+    { -1.047f, 3.2113f, 26.1167f, 0.4893f, 0.6435f },
+    { -0.0003f, 1.891f, 26.1738f, 0.5031f, 0.6244f },
+    { -2.1724f, 4.5094f, 25.7929f, 0.4745f, 0.6627f },
+    { -0.0003f, 3.1982f, 26.2131f, 0.5031f, 0.643f },
+    { -3.0804f, 4.4049f, 25.2344f, 0.4604f, 0.6626f },
+    { -1.122f, 4.5505f, 26.0987f, 0.4888f, 0.6624f },
+    { -2.2863f, 5.8102f, 25.7521f, 0.474f, 0.6808f },
+    { -3.8325f, 4.2721f, 24.4848f, 0.4463f, 0.6626f },
+    { -3.2126f, 5.6579f, 25.2226f, 0.4602f, 0.6799f },
+    { -2.3492f, 7.0806f, 25.653f, 0.4738f, 0.6984f },
+    { -3.9637f, 5.4748f, 24.4853f, 0.4465f, 0.6792f },
+    { -1.1867f, 5.8977f, 26.0325f, 0.4884f, 0.6812f },
+    { -3.2877f, 6.8447f, 25.1558f, 0.4603f, 0.6962f },
+    { -1.2219f, 7.2238f, 25.9159f, 0.4882f, 0.6997f },
+    { -4.5379f, 5.2952f, 23.5812f, 0.4324f, 0.679f },
+    { -4.9433f, 5.1493f, 22.5752f, 0.4181f, 0.6798f },
+    { -4.5931f, 6.373f, 23.5697f, 0.4334f, 0.6936f },
+    { -5.1879f, 5.0675f, 21.5319f, 0.404f, 0.6818f },
+    { -4.9835f, 6.2231f, 22.5676f, 0.4195f, 0.6942f },
+    { -5.2318f, 6.1523f, 21.5047f, 0.4053f, 0.6964f },
+    { -5.2999f, 5.039f, 20.5412f, 0.3909f, 0.6845f },
+    { -5.3702f, 6.1583f, 20.4666f, 0.3918f, 0.6997f },
+    { -5.3076f, 5.053f, 19.6931f, 0.3796f, 0.6875f },
+    { -5.4308f, 6.2391f, 19.5393f, 0.3799f, 0.704f },
+    { -5.2289f, 3.9072f, 19.7644f, 0.379f, 0.6717f },
+    { -5.4328f, 6.3719f, 18.5388f, 0.367f, 0.7095f },
+    { -5.1989f, 2.7681f, 19.8163f, 0.3785f, 0.656f },
+    { -5.1599f, 3.9033f, 18.8431f, 0.3666f, 0.6749f },
+    { -5.2389f, 5.101f, 18.7815f, 0.3675f, 0.6914f },
+    { -4.9811f, 2.717f, 17.6561f, 0.3493f, 0.6631f },
+    { -5.005f, 3.9092f, 17.6856f, 0.3508f, 0.6793f },
+    { -4.6324f, 1.6037f, 16.245f, 0.329f, 0.6526f },
+    { -4.681f, 2.7127f, 16.3545f, 0.3316f, 0.6674f },
+    { -4.0264f, 0.6786f, 14.7885f, 0.3074f, 0.645f },
+    { -4.1376f, 1.7117f, 14.885f, 0.3105f, 0.6582f },
+    { -3.9755f, -0.3984f, 14.7798f, 0.3049f, 0.6311f },
+    { -3.3131f, 0.8121f, 13.6881f, 0.2907f, 0.6504f },
+    { -3.9823f, -1.4859f, 14.7922f, 0.3024f, 0.6172f },
+    { -3.1767f, -0.3075f, 13.6581f, 0.2877f, 0.6367f },
+    { -3.1151f, -1.4497f, 13.653f, 0.2846f, 0.6228f },
+    { -2.4025f, -1.4389f, 12.9951f, 0.2725f, 0.6264f },
+    { -3.5f, 1.8312f, 13.7848f, 0.2939f, 0.6631f },
+    { -4.2611f, 2.7566f, 15.039f, 0.3137f, 0.6719f },
+    { -4.3491f, 3.8692f, 15.2198f, 0.3162f, 0.687f },
+    { -4.7421f, 3.9046f, 16.4313f, 0.3335f, 0.6836f },
+    { -4.8905f, 5.183f, 16.3565f, 0.3342f, 0.7017f },
+    { -5.1217f, 5.1742f, 17.6005f, 0.3516f, 0.6969f },
+    { -5.2006f, 6.5511f, 16.0111f, 0.3332f, 0.7221f },
+    { -5.3954f, 6.5339f, 17.2809f, 0.3507f, 0.7168f },
+    { -4.963f, 7.3191f, 14.4349f, 0.3128f, 0.7391f },
+    { -5.579f, 8.1592f, 15.3789f, 0.3308f, 0.7471f },
+    { -4.3278f, 7.4822f, 13.1792f, 0.2931f, 0.7462f },
+    { -5.0403f, 8.0619f, 13.6962f, 0.306f, 0.7531f },
+    { -3.6747f, 7.7818f, 12.0468f, 0.2752f, 0.755f },
+    { -4.3728f, 8.068f, 12.4251f, 0.2865f, 0.7589f },
+    { -4.4333f, 8.6408f, 11.3378f, 0.2773f, 0.7744f },
+    { -5.0331f, 8.6315f, 12.7455f, 0.2969f, 0.7663f },
+    { -5.5391f, 8.9347f, 14.0916f, 0.3174f, 0.7638f },
+    { -5.0127f, 9.1818f, 11.5703f, 0.2859f, 0.7815f },
+    { -5.483f, 9.4458f, 12.9744f, 0.306f, 0.7768f },
+    { -4.5181f, 9.356f, 10.0649f, 0.2663f, 0.7928f },
+    { -5.3939f, 9.9468f, 11.7754f, 0.294f, 0.7908f },
+    { -3.9274f, 9.1176f, 9.9232f, 0.2588f, 0.7881f },
+    { -3.5199f, 10.1495f, 8.5516f, 0.2404f, 0.8062f },
+    { -4.1053f, 10.1554f, 8.6074f, 0.2474f, 0.8097f },
+    { -3.1604f, 11.1791f, 7.4986f, 0.224f, 0.8203f },
+    { -3.7056f, 11.0647f, 7.4271f, 0.2304f, 0.8247f },
+    { -3.2462f, 11.5552f, 6.9432f, 0.2191f, 0.8287f },
+    { -3.7839f, 11.4657f, 6.884f, 0.2254f, 0.8334f },
+    { -4.2557f, 11.0864f, 7.5022f, 0.2373f, 0.8283f },
+    { -3.8057f, 11.5896f, 6.6151f, 0.2226f, 0.8372f },
+    { -4.3166f, 11.5064f, 6.9574f, 0.232f, 0.8372f },
+    { -4.6362f, 10.369f, 8.7536f, 0.2544f, 0.8139f },
+    { -4.7401f, 11.2852f, 7.6801f, 0.2444f, 0.8318f },
+    { -5.0061f, 9.864f, 10.2793f, 0.274f, 0.799f },
+    { -5.0407f, 10.8292f, 8.981f, 0.2617f, 0.819f },
+    { -5.3034f, 10.5664f, 10.5239f, 0.2816f, 0.8065f },
+    { -5.0877f, 11.7026f, 7.9169f, 0.2515f, 0.8361f },
+    { -5.2429f, 11.4331f, 9.2493f, 0.2691f, 0.8249f },
+    { -4.7822f, 11.71f, 7.12f, 0.2389f, 0.8408f },
+    { -5.2184f, 12.2174f, 8.1848f, 0.2586f, 0.8408f },
+    { -4.3281f, 11.6473f, 6.6754f, 0.229f, 0.8413f },
+    { -5.1186f, 12.1095f, 7.3285f, 0.2457f, 0.8449f },
+    { -4.7837f, 11.866f, 6.8034f, 0.2355f, 0.8453f },
+    { -4.3305f, 11.7409f, 6.3587f, 0.2255f, 0.8455f },
+    { -4.766f, 11.9756f, 6.4598f, 0.2318f, 0.8497f },
+    { -3.8217f, 11.6739f, 6.3135f, 0.2194f, 0.8412f },
+    { -3.8498f, 11.7352f, 5.8742f, 0.2149f, 0.8464f },
+    { -4.3597f, 11.8101f, 5.8999f, 0.2208f, 0.8511f },
+    { -3.9077f, 11.7902f, 5.1926f, 0.2079f, 0.8541f },
+    { -4.7852f, 12.0559f, 5.9664f, 0.2268f, 0.8558f },
+    { -4.4518f, 11.8778f, 5.1918f, 0.214f, 0.8597f },
+    { -3.9505f, 11.8246f, 4.5607f, 0.2013f, 0.861f },
+    { -3.3886f, 11.9264f, 4.5362f, 0.1946f, 0.8552f },
+    { -3.3739f, 11.9341f, 4.2365f, 0.1911f, 0.858f },
+    { -3.9335f, 11.8243f, 4.2705f, 0.1978f, 0.8638f },
+    { -3.3326f, 11.9174f, 4.1017f, 0.1891f, 0.8589f },
+    { -3.8903f, 11.8023f, 4.1425f, 0.1959f, 0.8647f },
+    { -3.2885f, 11.8897f, 3.94f, 0.1868f, 0.8601f },
+    { -3.8548f, 11.7718f, 3.9972f, 0.1938f, 0.8658f },
+    { -3.8302f, 11.709f, 3.7931f, 0.1911f, 0.8677f },
+    { -3.2618f, 11.721f, 3.4078f, 0.1802f, 0.865f },
+    { -4.4204f, 11.7889f, 3.7648f, 0.1977f, 0.8743f },
+    { -3.2779f, 11.5834f, 3.0529f, 0.1761f, 0.8687f },
+    { -3.8197f, 11.59f, 3.4887f, 0.1873f, 0.8707f },
+    { -4.3928f, 11.6441f, 3.4693f, 0.1936f, 0.8771f },
+    { -3.8234f, 11.43f, 3.1167f, 0.1829f, 0.8746f },
+    { -4.368f, 11.4447f, 3.096f, 0.1887f, 0.8808f },
+    { -4.3401f, 11.2077f, 2.6663f, 0.1834f, 0.8853f },
+    { -3.289f, 11.4418f, 2.7025f, 0.1722f, 0.8723f },
+    { -3.2852f, 11.2459f, 2.3786f, 0.1683f, 0.876f },
+    { -2.9382f, 11.1116f, 2.003f, 0.1594f, 0.876f },
+    { -3.065f, 10.6897f, 1.7424f, 0.1568f, 0.8819f },
+    { -2.7085f, 11.121f, 1.7261f, 0.1537f, 0.8759f },
+    { -3.1316f, 10.3396f, 1.5901f, 0.155f, 0.8865f },
+    { -2.8422f, 10.7635f, 1.6171f, 0.1534f, 0.8806f },
+    { -3.1334f, 10.1133f, 1.4501f, 0.1531f, 0.8895f },
+    { -2.6612f, 10.7736f, 1.4755f, 0.1502f, 0.8804f },
+    { -3.1322f, 9.7583f, 1.163f, 0.15f, 0.8941f },
+    { -3.0926f, 10.0535f, 1.2985f, 0.1508f, 0.8911f },
+    { -3.0749f, 9.6809f, 0.8687f, 0.1469f, 0.8965f },
+    { -3.0676f, 9.2885f, 0.4999f, 0.1449f, 0.9014f },
+    { -3.0205f, 9.969f, 1.0306f, 0.1474f, 0.8937f },
+    { -3.0926f, 9.0474f, 0.3062f, 0.145f, 0.9048f },
+    { -3.0004f, 9.6338f, 0.5866f, 0.1439f, 0.899f },
+    { -3.0341f, 9.2884f, 0.3151f, 0.1433f, 0.9031f },
+    { -3.2392f, 8.8985f, 0.1384f, 0.1454f, 0.9076f },
+    { -3.2888f, 8.9359f, 0.045f, 0.1446f, 0.9083f },
+    { -3.133f, 9.0565f, 0.1387f, 0.144f, 0.9062f },
+    { -3.0559f, 9.2925f, 0.1407f, 0.1421f, 0.9049f },
+    { -2.9492f, 9.6106f, 0.3375f, 0.1414f, 0.9014f },
+    { -2.9618f, 9.6049f, 0.1423f, 0.1397f, 0.9036f },
+    { -2.9263f, 9.8867f, 0.6893f, 0.1435f, 0.8967f },
+    { -2.9706f, 10.0674f, 1.1621f, 0.1484f, 0.8914f },
+    { -3.0581f, 10.2541f, 1.4303f, 0.1522f, 0.8882f },
+    { -2.9766f, 10.3805f, 1.5101f, 0.1527f, 0.8858f },
+    { -2.7965f, 10.4531f, 1.4899f, 0.1512f, 0.8842f },
+    { -2.5831f, 10.5643f, 1.3948f, 0.1485f, 0.8826f },
+    { -2.4018f, 10.8062f, 1.2497f, 0.1456f, 0.88f },
+    { -2.5393f, 11.0078f, 1.4245f, 0.1487f, 0.8777f },
+    { -2.5316f, 11.4829f, 1.7379f, 0.1518f, 0.8713f },
+    { -2.3813f, 11.3241f, 1.3408f, 0.1459f, 0.8742f },
+    { -2.3213f, 11.606f, 1.2544f, 0.1431f, 0.8716f },
+    { -2.2735f, 11.1036f, 1.1112f, 0.1428f, 0.8772f },
+    { -2.2193f, 11.3813f, 1.0356f, 0.1406f, 0.8748f },
+    { -2.1943f, 10.8168f, 0.9212f, 0.141f, 0.8806f },
+    { 3.7503f, -14.9867f, 13.7382f, 0.756f, 0.4235f },
+    { 3.314f, -15.5668f, 14.3028f, 0.7492f, 0.4139f },
+    { 3.0218f, -14.8314f, 13.4781f, 0.7639f, 0.4154f },
+    { 3.2763f, -14.2731f, 13.1149f, 0.77f, 0.4218f },
+    { 4.0998f, -13.9045f, 12.8302f, 0.77f, 0.4357f },
+    { 3.4053f, -13.7967f, 12.7401f, 0.7762f, 0.4265f },
+    { 3.4969f, -13.4993f, 12.2903f, 0.7822f, 0.4307f },
+    { 3.5305f, -13.3155f, 11.7998f, 0.7883f, 0.4339f },
+    { 4.1705f, -13.5799f, 12.3458f, 0.7768f, 0.4397f },
+    { 4.8136f, -13.3499f, 12.4042f, 0.7731f, 0.4495f },
+    { 5.3323f, -12.7959f, 11.9247f, 0.778f, 0.4609f },
+    { 4.8226f, -13.1711f, 11.8702f, 0.7804f, 0.4521f },
+    { 4.1962f, -13.3796f, 11.8318f, 0.7837f, 0.4428f },
+    { 3.4852f, -13.1799f, 11.303f, 0.7948f, 0.4362f },
+    { 4.1752f, -13.254f, 11.3027f, 0.7907f, 0.4451f },
+    { 3.407f, -13.018f, 10.5997f, 0.8041f, 0.4384f },
+    { 4.8074f, -13.0669f, 11.3276f, 0.7878f, 0.454f },
+    { 4.1156f, -13.1054f, 10.576f, 0.8006f, 0.4474f },
+    { 3.3413f, -12.7553f, 9.4898f, 0.8184f, 0.4417f },
+    { 3.324f, -12.4515f, 8.1975f, 0.8352f, 0.4452f },
+    { 4.0259f, -12.836f, 9.4696f, 0.8156f, 0.4503f },
+    { 3.9541f, -12.5128f, 8.1912f, 0.8331f, 0.4532f },
+    { 4.7539f, -12.9418f, 10.5932f, 0.7979f, 0.456f },
+    { 4.6486f, -12.7005f, 9.4837f, 0.8134f, 0.4585f },
+    { 4.5023f, -12.0847f, 6.9584f, 0.8492f, 0.4629f },
+    { 4.5464f, -12.3968f, 8.2038f, 0.8314f, 0.461f },
+    { 4.9441f, -11.5886f, 5.9739f, 0.8628f, 0.4715f },
+    { 4.9635f, -11.8246f, 6.9734f, 0.8483f, 0.4702f },
+    { 5.2182f, -11.1287f, 5.4454f, 0.8704f, 0.4786f },
+    { 5.2097f, -11.2032f, 5.9675f, 0.8628f, 0.4782f },
+    { 5.3295f, -10.7135f, 5.1327f, 0.875f, 0.4842f },
+    { 5.3165f, -10.6964f, 5.4165f, 0.8709f, 0.4846f },
+    { 5.3038f, -10.3117f, 5.0776f, 0.8759f, 0.4896f },
+    { 5.3102f, -10.3919f, 4.7615f, 0.8803f, 0.4884f },
+    { 5.2112f, -10.0102f, 4.6754f, 0.8816f, 0.4936f },
+    { 5.2013f, -9.9342f, 5.0169f, 0.8769f, 0.4947f },
+    { 5.0524f, -9.6256f, 4.5933f, 0.8829f, 0.4992f },
+    { 5.0677f, -9.5773f, 4.959f, 0.8778f, 0.4997f },
+    { 5.2856f, -10.3015f, 5.3793f, 0.8716f, 0.4899f },
+    { 5.1748f, -9.9216f, 5.3403f, 0.8723f, 0.4951f },
+    { 5.3167f, -10.7729f, 5.955f, 0.8631f, 0.4842f },
+    { 5.2907f, -10.3772f, 5.94f, 0.8635f, 0.4897f },
+    { 5.2422f, -11.4354f, 6.9911f, 0.8479f, 0.4769f },
+    { 5.364f, -10.9882f, 7.0112f, 0.8478f, 0.4831f },
+    { 5.0259f, -12.1286f, 8.2321f, 0.8301f, 0.4683f },
+    { 5.3176f, -11.733f, 8.273f, 0.8293f, 0.475f },
+    { 5.1418f, -12.4044f, 9.5208f, 0.8117f, 0.466f },
+    { 5.4377f, -12.0035f, 9.5696f, 0.8106f, 0.4727f },
+    { 5.2555f, -12.6129f, 10.6362f, 0.7959f, 0.4638f },
+    { 5.5539f, -12.2046f, 10.69f, 0.7945f, 0.4706f },
+    { 5.3115f, -12.7148f, 11.3754f, 0.7856f, 0.4623f },
+    { 5.6174f, -12.2943f, 11.4435f, 0.7838f, 0.4695f },
+    { 5.6477f, -12.3597f, 12.0053f, 0.776f, 0.4685f },
+    { 5.8046f, -11.8738f, 12.0882f, 0.7743f, 0.4755f },
+    { 5.7668f, -11.8175f, 11.5193f, 0.7824f, 0.4762f },
+    { 5.8388f, -11.3493f, 12.1498f, 0.7731f, 0.4826f },
+    { 5.6961f, -11.732f, 10.7548f, 0.7934f, 0.4771f },
+    { 5.8016f, -11.2965f, 11.5898f, 0.7812f, 0.4832f },
+    { 5.7759f, -10.8144f, 12.1941f, 0.7724f, 0.4898f },
+    { 5.739f, -10.7597f, 11.6428f, 0.7805f, 0.4903f },
+    { 5.6412f, -10.2974f, 12.2252f, 0.7719f, 0.4969f },
+    { 5.4258f, -9.7933f, 12.7306f, 0.7644f, 0.5046f },
+    { 5.5962f, -10.2356f, 11.666f, 0.7804f, 0.4973f },
+    { 5.0316f, -9.1739f, 12.9111f, 0.7622f, 0.5147f },
+    { 5.4632f, -9.8035f, 12.2408f, 0.7719f, 0.5036f },
+    { 5.214f, -9.3059f, 12.6274f, 0.7663f, 0.5113f },
+    { 4.8726f, -8.9363f, 12.7473f, 0.7651f, 0.5184f },
+    { 5.2702f, -9.3377f, 12.2385f, 0.7722f, 0.5099f },
+    { 4.6043f, -8.7353f, 12.7946f, 0.7649f, 0.5231f },
+    { 4.9586f, -8.918f, 12.5348f, 0.7683f, 0.5173f },
+    { 4.6227f, -8.6905f, 12.549f, 0.7687f, 0.5227f },
+    { 4.2471f, -8.6324f, 12.8241f, 0.7654f, 0.5282f },
+    { 4.2568f, -8.6118f, 12.5785f, 0.7693f, 0.5273f },
+    { 3.9092f, -8.6863f, 12.7396f, 0.7683f, 0.5323f },
+    { 3.8041f, -8.7323f, 12.8629f, 0.7669f, 0.5342f },
+    { 3.6394f, -8.813f, 12.5948f, 0.7721f, 0.5351f },
+    { 3.4424f, -8.9274f, 12.591f, 0.7734f, 0.5379f },
+    { 3.9115f, -8.6703f, 12.5317f, 0.7715f, 0.5312f },
+    { 3.5851f, -8.8385f, 12.4386f, 0.7749f, 0.535f },
+    { 4.2967f, -8.6264f, 12.2699f, 0.774f, 0.5257f },
+    { 3.9148f, -8.6879f, 12.2324f, 0.7762f, 0.53f },
+    { 3.5617f, -8.8821f, 12.1511f, 0.7794f, 0.5341f },
+    { 4.6823f, -8.718f, 12.2604f, 0.7731f, 0.521f },
+    { 3.2759f, -9.0887f, 12.3293f, 0.7788f, 0.5391f },
+    { 5.023f, -8.957f, 12.2384f, 0.7727f, 0.5158f },
+    { 5.0183f, -8.9935f, 11.8478f, 0.7786f, 0.5148f },
+    { 5.2355f, -9.3252f, 11.7745f, 0.7793f, 0.5097f },
+    { 5.4146f, -9.7491f, 11.6972f, 0.7802f, 0.504f },
+    { 5.2202f, -9.5803f, 10.9816f, 0.7914f, 0.5064f },
+    { 5.4898f, -10.1316f, 10.9077f, 0.7918f, 0.4984f },
+    { 5.6582f, -10.6673f, 10.8908f, 0.7916f, 0.4911f },
+    { 5.0046f, -9.5206f, 9.781f, 0.8096f, 0.5071f },
+    { 5.7289f, -11.2102f, 10.8308f, 0.7923f, 0.484f },
+    { 5.3163f, -9.9837f, 9.7881f, 0.8086f, 0.4998f },
+    { 5.5136f, -10.4978f, 9.7646f, 0.8084f, 0.4927f },
+    { 5.6017f, -11.0216f, 9.7038f, 0.8088f, 0.4858f },
+    { 5.5774f, -11.5313f, 9.6305f, 0.8097f, 0.4791f },
+    { 5.4527f, -11.2664f, 8.3235f, 0.8287f, 0.4813f },
+    { 5.4626f, -10.7848f, 8.3806f, 0.8282f, 0.4877f },
+    { 5.3543f, -10.5541f, 7.0332f, 0.8477f, 0.489f },
+    { 5.3566f, -10.2981f, 8.43f, 0.828f, 0.4942f },
+    { 5.2386f, -10.1152f, 7.0529f, 0.8479f, 0.4949f },
+    { 5.1733f, -9.9795f, 5.9255f, 0.864f, 0.4951f },
+    { 5.0423f, -9.6533f, 7.0656f, 0.8483f, 0.5015f },
+    { 5.0338f, -9.5339f, 5.306f, 0.8731f, 0.5005f },
+    { 5.0067f, -9.5433f, 5.9147f, 0.8647f, 0.5013f },
+    { 4.8955f, -9.2428f, 4.9082f, 0.8788f, 0.5045f },
+    { 4.8546f, -9.173f, 5.2457f, 0.8743f, 0.5057f },
+    { 4.85f, -9.2612f, 4.5547f, 0.8836f, 0.5047f },
+    { 4.6775f, -8.9326f, 4.8689f, 0.8796f, 0.5092f },
+    { 4.6205f, -8.9405f, 4.5987f, 0.8833f, 0.5096f },
+    { 4.4616f, -8.9141f, 4.3737f, 0.8865f, 0.5116f },
+    { 4.6292f, -8.8731f, 5.1288f, 0.8762f, 0.5103f },
+    { 4.2042f, -8.8705f, 4.2499f, 0.8887f, 0.515f },
+    { 4.1224f, -8.6958f, 4.4444f, 0.886f, 0.5168f },
+    { 3.89f, -8.6889f, 4.4058f, 0.8869f, 0.5197f },
+    { 4.3207f, -8.7614f, 4.4878f, 0.8851f, 0.5141f },
+    { 4.3776f, -8.7083f, 4.6513f, 0.8828f, 0.5138f },
+    { 4.1352f, -8.6094f, 4.6387f, 0.8833f, 0.5171f },
+    { 4.4294f, -8.6944f, 4.8425f, 0.8803f, 0.5135f },
+    { 4.1669f, -8.5764f, 4.8303f, 0.8808f, 0.517f },
+    { 3.8934f, -8.5955f, 4.6141f, 0.8841f, 0.52f },
+    { 4.1422f, -8.5616f, 5.0166f, 0.8785f, 0.5175f },
+    { 3.8999f, -8.5494f, 4.8257f, 0.8814f, 0.5201f },
+    { 4.3832f, -8.6606f, 5.0281f, 0.8779f, 0.5143f },
+    { 3.8996f, -8.5433f, 5.0314f, 0.8788f, 0.5203f },
+    { 3.638f, -8.5847f, 4.8219f, 0.882f, 0.5233f },
+    { 3.8975f, -8.5876f, 5.2419f, 0.8761f, 0.5205f },
+    { 3.6525f, -8.6179f, 4.6309f, 0.8844f, 0.5229f },
+    { 3.6493f, -8.5726f, 5.0093f, 0.8796f, 0.5233f },
+    { 3.3761f, -8.7062f, 4.8294f, 0.8827f, 0.5269f },
+    { 3.6401f, -8.6143f, 5.2118f, 0.877f, 0.5237f },
+    { 3.395f, -8.6808f, 5.0199f, 0.8801f, 0.5267f },
+    { 3.4374f, -8.6966f, 5.1916f, 0.8777f, 0.5264f },
+    { 3.2877f, -8.8258f, 5.3469f, 0.876f, 0.5288f },
+    { 3.1407f, -8.8993f, 5.1325f, 0.8794f, 0.5309f },
+    { 3.5644f, -8.7425f, 5.4482f, 0.874f, 0.5251f },
+    { 3.0185f, -9.1218f, 5.8163f, 0.8703f, 0.5337f },
+    { 3.8984f, -8.6931f, 5.4681f, 0.873f, 0.5206f },
+    { 3.4605f, -8.8944f, 5.9922f, 0.8668f, 0.527f },
+    { 4.2171f, -8.7211f, 5.4382f, 0.8728f, 0.5164f },
+    { 3.8909f, -8.809f, 5.9956f, 0.8657f, 0.521f },
+    { 4.1344f, -8.5987f, 5.2139f, 0.8759f, 0.5176f },
+    { 4.3316f, -8.6724f, 5.1909f, 0.8759f, 0.5149f },
+    { 4.4757f, -8.7925f, 5.3335f, 0.8737f, 0.5128f },
+    { 4.7286f, -9.0753f, 5.7803f, 0.8672f, 0.5085f },
+    { 4.3118f, -8.868f, 5.9713f, 0.8652f, 0.5151f },
+    { 4.7484f, -9.2479f, 7.0775f, 0.849f, 0.5083f },
+    { 4.3399f, -8.9784f, 7.0947f, 0.8496f, 0.515f },
+    { 3.8637f, -8.8847f, 7.1103f, 0.8504f, 0.5218f },
+    { 4.8243f, -9.3891f, 8.468f, 0.8291f, 0.5081f },
+    { 3.3668f, -9.0072f, 7.1177f, 0.8516f, 0.5288f },
+    { 4.3956f, -9.0674f, 8.4678f, 0.8302f, 0.5151f },
+    { 3.8948f, -8.9372f, 8.4688f, 0.8315f, 0.5224f },
+    { 4.5735f, -9.1502f, 9.7502f, 0.8113f, 0.5144f },
+    { 5.1442f, -9.8161f, 8.4573f, 0.8283f, 0.5011f },
+    { 4.7453f, -9.165f, 10.7322f, 0.7965f, 0.5142f },
+    { 4.0623f, -8.9833f, 9.7279f, 0.8132f, 0.522f },
+    { 5.0821f, -9.2389f, 11.3811f, 0.7856f, 0.5113f },
+    { 4.7827f, -9.0497f, 11.204f, 0.7892f, 0.5154f },
+    { 4.9636f, -9.0381f, 11.5536f, 0.7832f, 0.5144f },
+    { 4.7225f, -8.784f, 11.8668f, 0.779f, 0.5192f },
+    { 4.7528f, -8.8931f, 11.4781f, 0.785f, 0.5174f },
+    { 4.38f, -8.6994f, 11.8548f, 0.7803f, 0.5234f },
+    { 4.0229f, -8.7425f, 11.8348f, 0.7819f, 0.5275f },
+    { 4.4354f, -8.8041f, 11.4473f, 0.7865f, 0.5214f },
+    { 3.6753f, -8.9105f, 11.7746f, 0.7846f, 0.5316f },
+    { 4.0881f, -8.8405f, 11.446f, 0.7878f, 0.5257f },
+    { 3.7847f, -8.9552f, 11.4966f, 0.7884f, 0.5297f },
+    { 4.3915f, -8.914f, 11.1618f, 0.7912f, 0.5209f },
+    { 3.963f, -8.9883f, 11.173f, 0.7928f, 0.5267f },
+    { 4.2625f, -8.9875f, 10.6911f, 0.7987f, 0.5213f },
+    { 3.7396f, -9.1103f, 10.7087f, 0.8006f, 0.5286f },
+    { 3.589f, -9.131f, 11.3092f, 0.7924f, 0.5319f },
+    { 3.5103f, -9.1307f, 9.7459f, 0.8149f, 0.5298f },
+    { 3.155f, -9.4789f, 10.9051f, 0.8009f, 0.5373f },
+    { 3.3613f, -9.2004f, 11.6418f, 0.7888f, 0.5358f },
+    { 2.9783f, -9.608f, 11.4804f, 0.7943f, 0.5413f },
+    { 3.2627f, -9.1888f, 12.0291f, 0.7837f, 0.5383f },
+    { 2.9006f, -9.6003f, 11.8623f, 0.7895f, 0.5434f },
+    { 2.8832f, -9.4646f, 12.163f, 0.7846f, 0.5443f },
+    { 2.3579f, -10.1091f, 11.6465f, 0.797f, 0.5504f },
+    { 2.4235f, -10.129f, 11.3344f, 0.8006f, 0.5492f },
+    { 1.923f, -10.6822f, 11.5008f, 0.8052f, 0.5583f },
+    { 1.9797f, -10.704f, 11.2506f, 0.8072f, 0.5582f },
+    { 2.3064f, -10.0098f, 11.8993f, 0.7936f, 0.5511f },
+    { 1.8495f, -10.6562f, 11.711f, 0.8042f, 0.5587f },
+    { 2.4633f, -10.0938f, 10.7688f, 0.8073f, 0.5478f },
+    { 2.0312f, -10.6857f, 10.7345f, 0.8092f, 0.5582f },
+    { 2.956f, -9.5072f, 9.7675f, 0.817f, 0.5381f },
+    { 2.4379f, -10.0276f, 9.7557f, 0.8199f, 0.5471f },
+    { 2.0893f, -10.5915f, 9.727f, 0.8233f, 0.5564f },
+    { 3.3583f, -9.0847f, 8.4829f, 0.8329f, 0.53f },
+    { 2.849f, -9.4358f, 8.4909f, 0.8345f, 0.5379f },
+    { 2.9019f, -9.3069f, 7.1152f, 0.853f, 0.5362f },
+    { 2.4299f, -9.9162f, 8.4736f, 0.8364f, 0.546f },
+    { 2.1702f, -10.4366f, 8.4372f, 0.8373f, 0.5545f },
+    { 2.5219f, -9.745f, 7.1009f, 0.8543f, 0.5438f },
+    { 2.2905f, -10.2364f, 7.0742f, 0.8557f, 0.5516f },
+    { 2.6112f, -9.5969f, 5.947f, 0.8698f, 0.5419f },
+    { 2.3892f, -10.0557f, 5.9413f, 0.8741f, 0.5486f },
+    { 2.4055f, -9.9593f, 5.3418f, 0.879f, 0.5479f },
+    { 2.595f, -9.5545f, 5.3217f, 0.8785f, 0.5417f },
+    { 2.4107f, -9.9193f, 4.9847f, 0.8839f, 0.5472f },
+    { 2.8771f, -9.2f, 5.2616f, 0.8785f, 0.5358f },
+    { 2.5771f, -9.5506f, 4.9428f, 0.8841f, 0.5416f },
+    { 2.6614f, -9.5179f, 4.528f, 0.89f, 0.5399f },
+    { 2.4761f, -9.9081f, 4.579f, 0.8909f, 0.5458f },
+    { 2.8413f, -9.2347f, 4.8993f, 0.8837f, 0.5363f },
+    { 2.7249f, -9.4978f, 3.9477f, 0.8983f, 0.5376f },
+    { 2.5012f, -9.92f, 4.0087f, 0.8979f, 0.5444f },
+    { 2.3854f, -9.9496f, 3.1581f, 0.9134f, 0.5427f },
+    { 2.9328f, -9.196f, 4.52f, 0.8888f, 0.5344f },
+    { 3.1224f, -9.1188f, 3.9985f, 0.8953f, 0.5303f },
+    { 2.6446f, -9.5318f, 3.0718f, 0.9108f, 0.5358f },
+    { 2.2241f, -10.0239f, 2.3804f, 0.9288f, 0.541f },
+    { 2.5129f, -9.6134f, 2.2593f, 0.9227f, 0.5347f },
+    { 2.1124f, -10.1696f, 2.0291f, 0.9326f, 0.5417f },
+    { 2.4225f, -9.736f, 1.8691f, 0.9289f, 0.5344f },
+    { 2.077f, -10.3259f, 1.8584f, 0.9363f, 0.5423f },
+    { 2.3879f, -9.8871f, 1.6798f, 0.9323f, 0.5339f },
+    { 2.1447f, -10.432f, 1.6228f, 0.9391f, 0.5385f },
+    { 2.424f, -10.0541f, 1.4702f, 0.9359f, 0.5323f },
+    { 2.2139f, -10.6073f, 1.3499f, 0.9418f, 0.5347f },
+    { 2.9309f, -9.7942f, 1.3744f, 0.9327f, 0.5253f },
+    { 2.4772f, -10.2163f, 1.2542f, 0.9393f, 0.5303f },
+    { 2.2776f, -10.7249f, 1.0845f, 0.9449f, 0.5322f },
+    { 2.4943f, -10.3526f, 1.0457f, 0.9424f, 0.5286f },
+    { 2.3135f, -10.8961f, 0.8789f, 0.948f, 0.5298f },
+    { 2.5012f, -10.5157f, 0.8535f, 0.9453f, 0.5271f },
+    { 2.9533f, -10.0303f, 1.1978f, 0.9365f, 0.5243f },
+    { 2.9415f, -10.193f, 1.0231f, 0.9395f, 0.5234f },
+    { 2.9218f, -10.3625f, 0.8505f, 0.9426f, 0.5245f },
+    { 3.6331f, -9.691f, 1.3671f, 0.9294f, 0.5168f },
+    { 3.696f, -9.9146f, 1.1824f, 0.933f, 0.5157f },
+    { 3.7124f, -10.0747f, 1.0104f, 0.9359f, 0.515f },
+    { 3.715f, -10.2422f, 0.8434f, 0.9385f, 0.5144f },
+    { 4.4851f, -10.0191f, 0.9971f, 0.933f, 0.5067f },
+    { 4.5252f, -10.1788f, 0.8304f, 0.9344f, 0.5043f },
+    { 4.4224f, -9.8818f, 1.1817f, 0.9301f, 0.5074f },
+    { 4.9972f, -10.1958f, 0.8095f, 0.9354f, 0.502f },
+    { 4.5691f, -10.4006f, 0.6691f, 0.9389f, 0.5043f },
+    { 4.7438f, -9.8833f, 1.4111f, 0.9259f, 0.5024f },
+    { 4.3106f, -9.7267f, 1.3966f, 0.9269f, 0.5085f },
+    { 4.2011f, -9.5437f, 1.6129f, 0.9236f, 0.5099f },
+    { 5.0144f, -10.3926f, 0.666f, 0.939f, 0.5021f },
+    { 4.7772f, -10.8251f, 0.4851f, 0.9434f, 0.5044f },
+    { 5.1541f, -11.0084f, 0.4398f, 0.9471f, 0.499f },
+    { 4.7018f, 0.4796f, 22.8405f, 0.5875f, 0.6138f },
+    { 4.6827f, 1.6823f, 22.7625f, 0.5872f, 0.6308f },
+    { 4.2368f, 0.5172f, 23.7863f, 0.5731f, 0.6115f },
+    { 4.7572f, -0.6609f, 22.9922f, 0.5872f, 0.5974f },
+    { 4.9673f, 1.648f, 21.7865f, 0.6011f, 0.6334f },
+    { 5.0107f, 0.4521f, 21.8801f, 0.6013f, 0.6165f },
+    { 4.2465f, -0.6249f, 23.9512f, 0.5724f, 0.5949f },
+    { 5.1043f, -0.6984f, 22.0311f, 0.6011f, 0.6f },
+    { 4.7875f, -1.8238f, 23.185f, 0.5865f, 0.5805f },
+    { 3.5976f, 0.5635f, 24.6403f, 0.5583f, 0.6096f },
+    { 4.2332f, -1.787f, 24.1449f, 0.5714f, 0.5778f },
+    { 4.243f, 1.7236f, 23.6931f, 0.5732f, 0.6287f },
+    { 3.5603f, -0.596f, 24.8033f, 0.5571f, 0.5926f },
+    { 4.7191f, 2.8889f, 22.7101f, 0.5869f, 0.6477f },
+    { 4.987f, 2.8377f, 21.7106f, 0.6009f, 0.65f },
+    { 4.2929f, 2.9485f, 23.6425f, 0.5731f, 0.6459f },
+    { 5.1341f, 2.7968f, 20.7154f, 0.6144f, 0.6526f },
+    { 5.0831f, 3.9701f, 21.6129f, 0.6013f, 0.6659f },
+    { 5.1341f, 1.6211f, 20.8124f, 0.6144f, 0.6361f },
+    { 5.2049f, 3.9273f, 20.6237f, 0.6146f, 0.6684f },
+    { 5.1982f, 2.7681f, 19.7955f, 0.6268f, 0.6553f },
+    { 5.2282f, 3.9072f, 19.7526f, 0.6262f, 0.671f },
+    { 5.1989f, 0.4373f, 20.9275f, 0.6144f, 0.6194f },
+    { 5.2209f, 1.6023f, 19.8875f, 0.6269f, 0.6389f },
+    { 5.155f, 2.7436f, 18.8113f, 0.64f, 0.6583f },
+    { 5.3017f, 0.4375f, 20.0047f, 0.6269f, 0.6225f },
+    { 5.1591f, 3.9031f, 18.826f, 0.6387f, 0.6742f },
+    { 5.1853f, 1.5875f, 18.8623f, 0.6406f, 0.6423f },
+    { 4.9801f, 2.7156f, 17.6229f, 0.6561f, 0.6622f },
+    { 4.9849f, 1.573f, 17.5872f, 0.6577f, 0.6466f },
+    { 5.2663f, 0.4504f, 18.9452f, 0.641f, 0.6263f },
+    { 5.0397f, 0.4735f, 17.5819f, 0.6591f, 0.6314f },
+    { 5.4461f, -0.6985f, 20.1234f, 0.6272f, 0.6064f },
+    { 5.4144f, -0.6523f, 19.0262f, 0.6417f, 0.6108f },
+    { 5.3223f, -0.7176f, 21.073f, 0.6144f, 0.6029f },
+    { 5.1787f, -1.8683f, 22.2155f, 0.6008f, 0.5831f },
+    { 5.4367f, -1.8859f, 21.2328f, 0.6145f, 0.5862f },
+    { 5.5914f, -1.842f, 20.2335f, 0.6279f, 0.5902f },
+    { 5.4741f, -3.11f, 21.3905f, 0.6148f, 0.5689f },
+    { 5.165f, -3.122f, 22.4096f, 0.6004f, 0.5651f },
+    { 5.4312f, -4.3538f, 21.5417f, 0.6153f, 0.5514f },
+    { 3.5103f, -1.7644f, 24.9822f, 0.5559f, 0.5752f },
+    { 2.5543f, -2.9613f, 25.7159f, 0.5402f, 0.5548f },
+    { 2.6131f, -1.7627f, 25.5843f, 0.5407f, 0.5729f },
+    { 1.6354f, -2.9276f, 26.0989f, 0.5263f, 0.5535f },
+    { 2.6868f, -0.5796f, 25.4441f, 0.5419f, 0.5906f },
+    { 1.6713f, -1.7729f, 25.9737f, 0.5266f, 0.5712f },
+    { 0.8143f, -1.7864f, 26.1729f, 0.5144f, 0.5702f },
+    { 1.7463f, -0.5785f, 25.8737f, 0.5276f, 0.5891f },
+    { 0.7973f, -2.9166f, 26.3035f, 0.5143f, 0.5528f },
+    { 0.8596f, -0.5954f, 26.0922f, 0.515f, 0.5881f },
+    { 0.7861f, -4.054f, 26.4811f, 0.5143f, 0.5349f },
+    { -0.0003f, -2.9169f, 26.3611f, 0.503f, 0.5525f },
+    { -0.0003f, -5.2365f, 26.7737f, 0.503f, 0.5156f },
+    { -0.0003f, -1.794f, 26.2249f, 0.5031f, 0.5699f },
+    { -0.0003f, -4.0426f, 26.5474f, 0.503f, 0.5348f },
+    { -0.7868f, -4.054f, 26.4811f, 0.4917f, 0.5351f },
+    { -0.798f, -2.9166f, 26.3035f, 0.4917f, 0.5529f },
+    { -0.7591f, -5.2665f, 26.703f, 0.4919f, 0.5157f },
+    { -0.815f, -1.7864f, 26.1729f, 0.4916f, 0.5703f },
+    { -0.0003f, -0.6084f, 26.1487f, 0.5031f, 0.5878f },
+    { 0.9194f, 0.6414f, 26.0634f, 0.5157f, 0.6064f },
+    { 0.9804f, 1.9093f, 26.0882f, 0.5163f, 0.6248f },
+    { 1.8411f, 0.6519f, 25.8104f, 0.5289f, 0.6073f },
+    { 1.0463f, 3.2113f, 26.1167f, 0.5168f, 0.6434f },
+    { 1.9365f, 1.9146f, 25.7953f, 0.5299f, 0.6257f },
+    { 2.0432f, 3.2028f, 25.7993f, 0.5307f, 0.6441f },
+    { 2.7664f, 0.6172f, 25.3255f, 0.5433f, 0.6083f },
+    { 2.8434f, 1.8572f, 25.259f, 0.5443f, 0.6262f },
+    { 3.6344f, 1.7794f, 24.5386f, 0.5589f, 0.6271f },
+    { 2.9403f, 3.1249f, 25.2327f, 0.5449f, 0.6443f },
+    { 2.1717f, 4.5094f, 25.7929f, 0.5314f, 0.6625f },
+    { 3.7021f, 3.0245f, 24.4895f, 0.5592f, 0.6447f },
+    { 3.0797f, 4.4049f, 25.2344f, 0.5454f, 0.6623f },
+    { 1.1213f, 4.5505f, 26.0987f, 0.5173f, 0.6623f },
+    { 2.2856f, 5.8102f, 25.7521f, 0.532f, 0.6806f },
+    { -0.0003f, 4.5551f, 26.1885f, 0.5031f, 0.6621f },
+    { 1.186f, 5.8977f, 26.0325f, 0.5177f, 0.6811f },
+    { -0.0003f, 5.9253f, 26.1104f, 0.5031f, 0.6813f },
+    { 2.3485f, 7.0806f, 25.653f, 0.5322f, 0.6982f },
+    { 1.2213f, 7.2238f, 25.9159f, 0.5178f, 0.6997f },
+    { -0.0003f, 7.2723f, 25.9888f, 0.5031f, 0.7002f },
+    { 2.339f, 8.2293f, 25.506f, 0.5318f, 0.7142f },
+    { 1.2132f, 8.4089f, 25.7582f, 0.5177f, 0.7163f },
+    { -0.0003f, 8.4711f, 25.8303f, 0.5031f, 0.7171f },
+    { -1.2139f, 8.4089f, 25.7582f, 0.4884f, 0.7164f },
+    { -0.0003f, 9.3965f, 25.6414f, 0.5031f, 0.7304f },
+    { 1.1479f, 9.333f, 25.5685f, 0.517f, 0.7296f },
+    { -1.1486f, 9.333f, 25.5685f, 0.4891f, 0.7296f },
+    { -2.3397f, 8.2293f, 25.506f, 0.4742f, 0.7144f },
+    { -0.0003f, 10.1831f, 25.4373f, 0.5031f, 0.7419f },
+    { -2.2366f, 9.1652f, 25.3213f, 0.4753f, 0.7276f },
+    { -1.0572f, 10.1246f, 25.3622f, 0.49f, 0.7412f },
+    { -3.29f, 7.9392f, 25.0375f, 0.4608f, 0.7112f },
+    { -2.089f, 9.9853f, 25.1105f, 0.4767f, 0.7395f },
+    { -4.0361f, 6.5856f, 24.4521f, 0.447f, 0.6943f },
+    { -3.2039f, 8.9154f, 24.8713f, 0.4619f, 0.7248f },
+    { -4.0464f, 7.6412f, 24.3722f, 0.4478f, 0.7085f },
+    { -4.5902f, 7.4381f, 23.5295f, 0.4348f, 0.7078f },
+    { -3.9912f, 8.6783f, 24.2325f, 0.4489f, 0.7226f },
+    { -3.0706f, 9.8012f, 24.6562f, 0.463f, 0.7373f },
+    { -4.5389f, 8.5486f, 23.419f, 0.4363f, 0.7226f },
+    { -4.9686f, 7.3292f, 22.5519f, 0.4215f, 0.7089f },
+    { -3.8907f, 9.6591f, 24.0258f, 0.4498f, 0.7361f },
+    { -5.2284f, 7.314f, 21.4822f, 0.4076f, 0.7117f },
+    { -5.403f, 7.3866f, 20.3967f, 0.3938f, 0.7161f },
+    { -5.1906f, 8.6423f, 21.414f, 0.4104f, 0.7291f },
+    { -5.5255f, 7.5411f, 19.3718f, 0.381f, 0.7217f },
+    { -5.3846f, 8.8253f, 20.3233f, 0.3971f, 0.7349f },
+    { -5.5187f, 9.0349f, 19.2593f, 0.3843f, 0.7414f },
+    { -5.6018f, 7.7489f, 18.2673f, 0.3674f, 0.7289f },
+    { -5.6059f, 9.2648f, 18.1194f, 0.3707f, 0.749f },
+    { -5.6376f, 7.9811f, 16.9426f, 0.351f, 0.7377f },
+    { -5.6595f, 9.5085f, 16.8014f, 0.355f, 0.7581f },
+    { -5.6701f, 9.7854f, 15.4559f, 0.3394f, 0.7682f },
+    { -5.6286f, 10.1149f, 14.2339f, 0.3257f, 0.7788f },
+    { -5.4719f, 11.1316f, 15.4415f, 0.3458f, 0.786f },
+    { -5.5497f, 10.4849f, 13.0779f, 0.3132f, 0.7901f },
+    { -5.4167f, 11.3269f, 14.2366f, 0.332f, 0.7948f },
+    { -5.3345f, 11.5493f, 13.1093f, 0.3193f, 0.8039f },
+    { -5.4484f, 10.8831f, 11.9307f, 0.3011f, 0.802f },
+    { -5.2433f, 11.8316f, 12.0421f, 0.3076f, 0.8138f },
+    { -5.3217f, 11.3879f, 10.7561f, 0.289f, 0.8155f },
+    { -5.1162f, 12.2048f, 10.9556f, 0.296f, 0.8249f },
+    { -5.1668f, 12.0777f, 9.5183f, 0.2765f, 0.8314f },
+    { -4.9263f, 12.7f, 9.7707f, 0.2835f, 0.838f },
+    { -5.0517f, 12.7088f, 8.4557f, 0.2658f, 0.8454f },
+    { -4.718f, 13.2694f, 8.6514f, 0.2723f, 0.8513f },
+    { -4.742f, 12.8932f, 11.1023f, 0.3022f, 0.834f },
+    { -4.635f, 13.2367f, 9.9892f, 0.2899f, 0.8442f },
+    { -4.8461f, 12.6334f, 12.1154f, 0.3134f, 0.8248f },
+    { -4.2633f, 13.3532f, 11.1917f, 0.3076f, 0.8423f },
+    { -4.9388f, 12.4399f, 13.1215f, 0.3247f, 0.8163f },
+    { -4.3325f, 13.1938f, 12.1597f, 0.3186f, 0.8345f },
+    { -5.0113f, 12.2951f, 14.2134f, 0.3374f, 0.8085f },
+    { -4.4158f, 13.0879f, 13.1305f, 0.3297f, 0.827f },
+    { -3.8189f, 13.4248f, 13.1521f, 0.3345f, 0.8357f },
+    { -4.4616f, 12.9945f, 14.187f, 0.3422f, 0.8202f },
+    { -3.7782f, 13.4181f, 12.1839f, 0.3231f, 0.8422f },
+    { -3.8167f, 13.4003f, 14.1804f, 0.347f, 0.83f },
+    { -3.1105f, 13.3862f, 14.1362f, 0.3511f, 0.8406f },
+    { -3.1924f, 13.3953f, 13.1427f, 0.3387f, 0.8443f },
+    { -2.8788f, 13.4577f, 15.2898f, 0.3666f, 0.8379f },
+    { -3.2301f, 13.3541f, 12.1626f, 0.3268f, 0.8494f },
+    { -3.8046f, 13.3933f, 15.2874f, 0.3605f, 0.8245f },
+    { -2.377f, 12.8257f, 13.9972f, 0.3543f, 0.8542f },
+    { -4.5042f, 12.928f, 15.3276f, 0.3558f, 0.8133f },
+    { -2.5805f, 12.9442f, 13.0588f, 0.342f, 0.8549f },
+    { -2.0576f, 12.7217f, 14.8265f, 0.3661f, 0.8553f },
+    { -1.7723f, 11.9599f, 13.8417f, 0.356f, 0.8686f },
+    { -1.4725f, 11.8282f, 14.5892f, 0.366f, 0.8706f },
+    { -1.2112f, 11.8805f, 15.1383f, 0.3739f, 0.8709f },
+    { -2.0628f, 12.2053f, 12.9435f, 0.3444f, 0.8667f },
+    { -1.2007f, 10.8601f, 14.4502f, 0.3635f, 0.8845f },
+    { -2.735f, 13.0499f, 12.0701f, 0.3294f, 0.8574f },
+    { -1.4528f, 11.0297f, 13.7482f, 0.3555f, 0.8818f },
+    { -2.2961f, 12.4941f, 11.9423f, 0.3316f, 0.8668f },
+    { -1.1288f, 9.7579f, 14.2589f, 0.3612f, 0.8978f },
+    { -0.9929f, 9.6113f, 14.5338f, 0.3626f, 0.9008f },
+    { -1.3306f, 10.0007f, 13.6088f, 0.354f, 0.8944f },
+    { -1.0442f, 10.8364f, 14.8581f, 0.3687f, 0.8853f },
+    { -0.8269f, 9.5039f, 14.6277f, 0.364f, 0.9038f },
+    { -0.9468f, 10.8561f, 15.0097f, 0.3723f, 0.8862f },
+    { -0.8719f, 10.8164f, 14.9427f, 0.375f, 0.8889f },
+    { -0.7439f, 9.9177f, 14.7631f, 0.368f, 0.9033f },
+    { -0.9253f, 12.0285f, 15.4927f, 0.3812f, 0.8708f },
+    { -0.8092f, 10.7329f, 14.7361f, 0.3775f, 0.8928f },
+    { -0.6971f, 10.0415f, 14.6663f, 0.3719f, 0.9029f },
+    { -0.7819f, 11.6416f, 15.1879f, 0.3821f, 0.8787f },
+    { -0.7192f, 11.3879f, 14.8596f, 0.3834f, 0.8851f },
+    { -0.4135f, 11.6045f, 15.0082f, 0.3899f, 0.8836f },
+    { -0.6715f, 11.1417f, 14.5362f, 0.3848f, 0.8914f },
+    { -0.7488f, 10.6212f, 14.4691f, 0.3804f, 0.8971f },
+    { -0.5715f, 10.9306f, 14.3564f, 0.386f, 0.8962f },
+    { -0.6389f, 10.0952f, 14.4387f, 0.378f, 0.9045f },
+    { -0.3874f, 11.368f, 14.6301f, 0.3903f, 0.8901f },
+    { -0.6181f, 10.538f, 14.2547f, 0.3835f, 0.901f },
+    { -0.3666f, 11.0463f, 14.3372f, 0.3896f, 0.8967f },
+    { -0.0001f, 11.4076f, 14.6837f, 0.3962f, 0.8911f },
+    { -0.0018f, 11.6032f, 15.0887f, 0.3971f, 0.8849f },
+    { -0.0001f, 11.1011f, 14.3649f, 0.3953f, 0.8973f },
+    { -0.4512f, 11.8558f, 15.3953f, 0.3893f, 0.8771f },
+    { -0.0071f, 11.8101f, 15.4895f, 0.3965f, 0.8796f },
+    { -0.4804f, 12.1236f, 15.7996f, 0.3901f, 0.8713f },
+    { -0.0106f, 12.0403f, 15.8944f, 0.396f, 0.8744f },
+    { -0.0072f, 12.3059f, 16.3114f, 0.3999f, 0.8718f },
+    { -0.4812f, 12.4098f, 16.2293f, 0.3938f, 0.8672f },
+    { -0.0021f, 12.6176f, 16.7592f, 0.4038f, 0.8692f },
+    { -0.9902f, 12.576f, 15.9618f, 0.3866f, 0.8628f },
+    { -0.4805f, 12.7329f, 16.6973f, 0.3991f, 0.8633f },
+    { -0.5057f, 13.1117f, 17.2167f, 0.4048f, 0.8581f },
+    { -0.0003f, 12.9865f, 17.2565f, 0.4091f, 0.8642f },
+    { -1.07f, 12.9699f, 16.4626f, 0.3922f, 0.857f },
+    { -0.5301f, 13.4813f, 17.8228f, 0.4113f, 0.8523f },
+    { -0.0003f, 13.3477f, 17.8407f, 0.4143f, 0.8592f },
+    { -0.0003f, 13.6363f, 18.5492f, 0.4223f, 0.8536f },
+    { -1.1267f, 13.3613f, 17.0712f, 0.399f, 0.8508f },
+    { -1.1501f, 13.7149f, 17.7728f, 0.4068f, 0.8447f },
+    { -0.5274f, 13.7766f, 18.5512f, 0.4192f, 0.8466f },
+    { -0.0003f, 13.813f, 19.3012f, 0.4303f, 0.8479f },
+    { -0.5209f, 13.95f, 19.3138f, 0.4272f, 0.8411f },
+    { -0.0003f, 13.8383f, 20.0157f, 0.4365f, 0.8426f },
+    { -1.1297f, 13.9953f, 18.5528f, 0.4155f, 0.8391f },
+    { -0.5343f, 13.9537f, 20.0227f, 0.4341f, 0.8358f },
+    { -0.0003f, 13.7809f, 20.5947f, 0.4427f, 0.8373f },
+    { -1.0998f, 14.1484f, 19.3233f, 0.4239f, 0.834f },
+    { -0.532f, 13.8761f, 20.595f, 0.4396f, 0.8318f },
+    { -0.0003f, 13.7095f, 20.9402f, 0.4437f, 0.8359f },
+    { -1.0945f, 14.1204f, 19.9966f, 0.4311f, 0.8293f },
+    { -0.4783f, 13.8055f, 20.9478f, 0.4429f, 0.83f },
+    { -0.0003f, 13.6841f, 21.1754f, 0.4447f, 0.8346f },
+    { -1.1513f, 14.0008f, 20.6888f, 0.4384f, 0.8239f },
+    { -0.4597f, 13.7801f, 21.2063f, 0.4454f, 0.8289f },
+    { -0.0003f, 13.7652f, 21.4233f, 0.4464f, 0.8336f },
+    { -0.9314f, 13.9312f, 21.0935f, 0.4437f, 0.8239f },
+    { -0.5622f, 13.8384f, 21.496f, 0.4485f, 0.8265f },
+    { -0.0003f, 14.0549f, 21.559f, 0.448f, 0.8326f },
+    { -0.8149f, 13.8899f, 21.2816f, 0.4461f, 0.8244f },
+    { -1.0362f, 13.933f, 21.5698f, 0.4494f, 0.8207f },
+    { -0.654f, 14.0989f, 21.6692f, 0.4514f, 0.8262f },
+    { -0.0003f, 14.6554f, 21.4572f, 0.4483f, 0.8375f },
+    { -1.3346f, 13.9244f, 21.5004f, 0.448f, 0.8172f },
+    { -1.3242f, 14.0824f, 21.9726f, 0.4552f, 0.8169f },
+    { -0.6031f, 14.6805f, 21.5782f, 0.4534f, 0.8312f },
+    { -0.0003f, 15.4936f, 21.2115f, 0.4486f, 0.8425f },
+    { -0.5173f, 15.5091f, 21.3276f, 0.4548f, 0.8403f },
+    { -1.116f, 14.7282f, 21.8622f, 0.4586f, 0.8255f },
+    { -0.5043f, 16.5107f, 21.0219f, 0.4557f, 0.8523f },
+    { -0.0003f, 16.4965f, 20.9155f, 0.449f, 0.855f },
+    { -0.9723f, 15.5559f, 21.6035f, 0.4608f, 0.8366f },
+    { -0.4843f, 17.5789f, 20.7219f, 0.4561f, 0.8657f },
+    { -0.0003f, 17.5626f, 20.6271f, 0.4495f, 0.8675f },
+    { -0.0003f, 18.5905f, 20.4041f, 0.4505f, 0.8803f },
+    { -0.9421f, 16.5538f, 21.2929f, 0.4623f, 0.8496f },
+    { -0.9034f, 17.6175f, 20.9858f, 0.4626f, 0.8637f },
+    { -0.3777f, 18.6074f, 20.4887f, 0.4558f, 0.8791f },
+    { -0.0003f, 19.6043f, 20.2235f, 0.4516f, 0.8931f },
+    { -1.1927f, 17.668f, 21.3983f, 0.4692f, 0.8615f },
+    { -0.7343f, 18.6425f, 20.7373f, 0.4616f, 0.8777f },
+    { -0.2814f, 19.6187f, 20.3017f, 0.4558f, 0.8927f },
+    { -0.2927f, 20.6356f, 20.14f, 0.4568f, 0.9066f },
+    { -0.0003f, 20.6278f, 20.0624f, 0.4524f, 0.9077f },
+    { -0.5834f, 19.6509f, 20.5356f, 0.4608f, 0.8915f },
+    { -0.3353f, 21.6518f, 19.9999f, 0.4588f, 0.9206f },
+    { -0.0003f, 21.6511f, 19.9227f, 0.4533f, 0.9222f },
+    { -0.0003f, 22.6642f, 19.8065f, 0.4574f, 0.9367f },
+    { -0.5993f, 20.6644f, 20.3691f, 0.4619f, 0.9053f },
+    { -0.6624f, 21.68f, 20.225f, 0.464f, 0.9191f },
+    { -0.3329f, 22.6614f, 19.8775f, 0.4617f, 0.9348f },
+    { -0.0003f, 23.5865f, 19.6999f, 0.4615f, 0.9512f },
+    { -0.9738f, 21.7613f, 20.5915f, 0.4704f, 0.9176f },
+    { -0.653f, 22.6943f, 20.0904f, 0.4667f, 0.933f },
+    { -0.3108f, 23.5824f, 19.7639f, 0.4654f, 0.9477f },
+    { -0.2939f, 24.3334f, 19.65f, 0.4696f, 0.9582f },
+    { -0.0003f, 24.3372f, 19.5892f, 0.4664f, 0.9608f },
+    { -0.608f, 23.6209f, 19.9621f, 0.4698f, 0.9457f },
+    { -0.2643f, 24.9753f, 19.5648f, 0.4746f, 0.9667f },
+    { -0.0003f, 24.9852f, 19.506f, 0.4713f, 0.9703f },
+    { -0.5644f, 24.3735f, 19.8367f, 0.4735f, 0.9559f },
+    { -0.4974f, 25.0095f, 19.7351f, 0.4778f, 0.9644f },
+    { -0.7887f, 24.5087f, 20.1537f, 0.4785f, 0.9543f },
+    { -0.669f, 25.152f, 20.0105f, 0.4821f, 0.9629f },
+    { -0.382f, 25.5863f, 19.6782f, 0.4829f, 0.9716f },
+    { -0.2036f, 25.5689f, 19.5373f, 0.4807f, 0.9738f },
+    { -0.0003f, 25.5994f, 19.4818f, 0.4795f, 0.9768f },
+    { -0.5106f, 25.7606f, 19.8785f, 0.4867f, 0.9707f },
+    { -0.1563f, 26.084f, 19.5666f, 0.4873f, 0.9788f },
+    { -0.0003f, 26.1381f, 19.5143f, 0.4877f, 0.9832f },
+    { -0.0003f, 26.5594f, 19.6012f, 0.4954f, 0.9839f },
+    { -0.2906f, 25.9796f, 19.6607f, 0.487f, 0.976f },
+    { -0.1666f, 26.4902f, 19.6515f, 0.4936f, 0.981f },
+    { -0.0003f, 26.7918f, 19.8057f, 0.5031f, 0.9814f },
+    { -0.3358f, 26.2386f, 19.7587f, 0.491f, 0.977f },
+    { -0.1965f, 26.7157f, 19.8431f, 0.4983f, 0.9802f },
+    { -0.3893f, 26.4481f, 19.9526f, 0.495f, 0.9764f },
+    { -0.5753f, 25.9494f, 20.1314f, 0.4909f, 0.9698f },
+    { -0.2078f, 26.6887f, 20.1921f, 0.5001f, 0.9762f },
+    { -0.7479f, 25.3257f, 20.3366f, 0.4869f, 0.9617f },
+    { -0.4f, 26.4444f, 20.2526f, 0.4971f, 0.9734f },
+    { -0.5618f, 26.0106f, 20.4296f, 0.4939f, 0.9678f },
+    { -0.7029f, 25.4539f, 20.6593f, 0.491f, 0.9604f },
+    { -0.3659f, 26.3298f, 20.5152f, 0.4979f, 0.97f },
+    { -0.9003f, 24.6831f, 20.5258f, 0.4839f, 0.9532f },
+    { -0.2205f, 26.466f, 20.5793f, 0.5002f, 0.9706f },
+    { -0.4588f, 26.0326f, 20.704f, 0.4965f, 0.9657f },
+    { -0.2548f, 26.1042f, 20.8854f, 0.4997f, 0.9649f },
+    { -0.5482f, 25.5489f, 20.9408f, 0.4949f, 0.9593f },
+    { -0.8327f, 24.8411f, 20.8777f, 0.489f, 0.9524f },
+    { -0.2981f, 25.6232f, 21.1437f, 0.499f, 0.9586f },
+    { -1.022f, 23.9241f, 20.7031f, 0.4816f, 0.9431f },
+    { -0.6304f, 24.9663f, 21.176f, 0.4937f, 0.9518f },
+    { -0.8787f, 23.7523f, 20.301f, 0.4755f, 0.9442f },
+    { -0.9478f, 22.8044f, 20.4451f, 0.4728f, 0.9315f },
+    { -1.1023f, 22.9511f, 20.8725f, 0.4794f, 0.9304f },
+    { -1.1433f, 21.8724f, 21.0393f, 0.4774f, 0.9163f },
+    { -0.9342f, 20.7197f, 20.7458f, 0.4686f, 0.9036f },
+    { -1.0447f, 21.9898f, 21.5088f, 0.4845f, 0.9153f },
+    { -0.9269f, 19.6894f, 20.9246f, 0.4677f, 0.8896f },
+    { -1.1468f, 20.7964f, 21.2087f, 0.4759f, 0.902f },
+    { -1.0863f, 20.8897f, 21.6963f, 0.4832f, 0.9008f },
+    { -1.1573f, 19.7432f, 21.3996f, 0.4752f, 0.8877f },
+    { -1.1196f, 19.8214f, 21.8919f, 0.4824f, 0.8863f },
+    { -1.2189f, 18.7335f, 21.6314f, 0.4756f, 0.8736f },
+    { -1.1383f, 18.8132f, 22.1208f, 0.4826f, 0.8722f },
+    { -1.0494f, 18.6806f, 21.1442f, 0.4684f, 0.8756f },
+    { -1.2961f, 17.7346f, 21.8857f, 0.4759f, 0.8595f },
+    { -1.1573f, 17.8219f, 22.3744f, 0.4829f, 0.8581f },
+    { -1.2477f, 16.6262f, 21.6808f, 0.4686f, 0.8473f },
+    { -1.3535f, 16.7143f, 22.1448f, 0.4751f, 0.8452f },
+    { -1.3034f, 15.6342f, 21.9663f, 0.4667f, 0.8336f },
+    { -1.4488f, 14.7707f, 22.2298f, 0.464f, 0.8213f },
+    { -1.43f, 15.7228f, 22.4081f, 0.4731f, 0.8312f },
+    { -1.6409f, 14.1113f, 22.4142f, 0.4611f, 0.8114f },
+    { -1.5646f, 14.8104f, 22.6754f, 0.4701f, 0.8179f },
+    { -1.7232f, 14.0758f, 22.8767f, 0.467f, 0.8071f },
+    { -1.8367f, 13.7319f, 22.4621f, 0.4587f, 0.8052f },
+    { -1.872f, 13.6172f, 22.9416f, 0.4645f, 0.8002f },
+    { -1.598f, 14.0537f, 23.4133f, 0.4745f, 0.8033f },
+    { -1.6492f, 13.8398f, 22.0095f, 0.4536f, 0.8108f },
+    { -1.7298f, 13.5123f, 23.5314f, 0.4723f, 0.7954f },
+    { -1.6282f, 13.8682f, 21.3102f, 0.4442f, 0.8147f },
+    { -1.9653f, 13.695f, 21.8913f, 0.4501f, 0.8069f },
+    { -1.758f, 14.0202f, 20.4264f, 0.4324f, 0.819f },
+    { -2.1221f, 13.5052f, 22.3858f, 0.4553f, 0.8007f },
+    { -2.0883f, 13.8199f, 21.0215f, 0.4381f, 0.8113f },
+    { -2.0973f, 13.3013f, 22.9139f, 0.4615f, 0.795f },
+    { -1.8894f, 13.0859f, 23.5959f, 0.4703f, 0.7888f },
+    { -2.4857f, 12.9945f, 22.8375f, 0.4568f, 0.7892f },
+    { -2.583f, 13.3042f, 22.1975f, 0.4493f, 0.7958f },
+    { -2.1447f, 12.6346f, 23.6548f, 0.4676f, 0.7814f },
+    { -2.447f, 13.5754f, 21.6278f, 0.4436f, 0.8028f },
+    { -3.0151f, 12.6933f, 22.673f, 0.4502f, 0.7831f },
+    { -3.1701f, 13.0933f, 21.9117f, 0.4414f, 0.7907f },
+    { -3.0395f, 13.4441f, 21.2528f, 0.435f, 0.7985f },
+    { -2.6184f, 13.7671f, 20.6544f, 0.4305f, 0.8079f },
+    { -3.6882f, 13.2643f, 20.7998f, 0.4253f, 0.794f },
+    { -2.2343f, 13.9551f, 20.3098f, 0.4285f, 0.8146f },
+    { -3.122f, 13.6973f, 20.2286f, 0.4223f, 0.8052f },
+    { -2.3802f, 14.0307f, 19.9015f, 0.4229f, 0.8159f },
+    { -1.707f, 14.1589f, 19.8901f, 0.4266f, 0.8233f },
+    { -1.7953f, 14.1956f, 19.3017f, 0.4196f, 0.8264f },
+    { -2.6029f, 14.0399f, 19.3661f, 0.4155f, 0.817f },
+    { -1.8827f, 14.09f, 18.5499f, 0.4109f, 0.8305f },
+    { -2.7576f, 13.9793f, 18.5997f, 0.406f, 0.8201f },
+    { -3.5181f, 13.6293f, 19.6337f, 0.413f, 0.8045f },
+    { -3.7254f, 13.5817f, 18.7592f, 0.4018f, 0.8073f },
+    { -4.4313f, 12.8784f, 20.1622f, 0.4125f, 0.7878f },
+    { -4.5763f, 12.8739f, 18.945f, 0.3977f, 0.7928f },
+    { -3.8341f, 12.8372f, 21.5433f, 0.4321f, 0.7852f },
+    { -3.6632f, 12.3946f, 22.3815f, 0.4415f, 0.7774f },
+    { -4.4358f, 12.3151f, 21.2596f, 0.4235f, 0.777f },
+    { -2.5799f, 12.2228f, 23.5785f, 0.4622f, 0.7744f },
+    { -4.2529f, 11.8828f, 22.1554f, 0.4335f, 0.7694f },
+    { -3.2792f, 11.9149f, 23.2369f, 0.4523f, 0.7693f },
+    { -1.5873f, 12.361f, 24.3834f, 0.4797f, 0.7753f },
+    { -1.8961f, 11.6434f, 24.5455f, 0.4767f, 0.7643f },
+    { -3.9467f, 11.4758f, 22.945f, 0.443f, 0.7626f },
+    { -2.9468f, 11.3432f, 23.9574f, 0.4609f, 0.7601f },
+    { -4.6073f, 10.9426f, 22.1872f, 0.4289f, 0.7566f },
+    { -3.5707f, 11.1387f, 23.5491f, 0.4512f, 0.7573f },
+    { -4.8361f, 11.3061f, 21.2282f, 0.4178f, 0.7635f },
+    { -4.2868f, 10.6704f, 23.018f, 0.4391f, 0.7513f },
+    { -4.8027f, 9.7632f, 22.3377f, 0.4261f, 0.741f },
+    { -3.7648f, 10.5457f, 23.7446f, 0.4501f, 0.7486f },
+    { -4.4381f, 9.6457f, 23.2459f, 0.4378f, 0.7373f },
+    { -2.9311f, 10.6245f, 24.391f, 0.4636f, 0.7492f },
+    { -4.9157f, 8.534f, 22.4673f, 0.4237f, 0.7248f },
+    { -5.0745f, 10.014f, 21.3221f, 0.4138f, 0.7469f },
+    { -5.2649f, 10.3015f, 20.2495f, 0.4013f, 0.7538f },
+    { -4.9936f, 11.6424f, 20.1781f, 0.4059f, 0.7709f },
+    { -5.1004f, 11.8326f, 19.0739f, 0.3932f, 0.7776f },
+    { -5.3853f, 10.5292f, 19.1704f, 0.3887f, 0.7607f },
+    { -4.6221f, 12.8934f, 17.781f, 0.3841f, 0.7988f },
+    { -5.1478f, 11.9487f, 17.9011f, 0.3797f, 0.7844f },
+    { -5.4523f, 10.7285f, 18.0219f, 0.3753f, 0.7681f },
+    { -5.4825f, 10.9307f, 16.741f, 0.3606f, 0.7768f },
+    { -5.1277f, 12.0623f, 16.6454f, 0.3654f, 0.7924f },
+    { -5.0716f, 12.1766f, 15.3888f, 0.351f, 0.8007f },
+    { -4.5779f, 12.9029f, 16.5504f, 0.3699f, 0.8059f },
+    { -3.8156f, 13.4523f, 16.4918f, 0.3749f, 0.8183f },
+    { -3.8044f, 13.5307f, 17.6851f, 0.389f, 0.8123f },
+    { -2.859f, 13.8602f, 17.6456f, 0.3945f, 0.8246f },
+    { -2.9223f, 13.6935f, 16.5472f, 0.3813f, 0.8299f },
+    { -1.9503f, 13.8814f, 17.6943f, 0.4009f, 0.8354f },
+    { -1.9791f, 13.6092f, 16.7942f, 0.3902f, 0.8411f },
+    { -1.878f, 13.2197f, 16.0065f, 0.3815f, 0.8484f },
+    { -1.5555f, 12.6592f, 15.4878f, 0.3771f, 0.8585f },
+    { 5.7358f, -4.03f, 19.1077f, 0.6483f, 0.565f },
+    { 5.6859f, -4.2153f, 20.3967f, 0.6311f, 0.5576f },
+    { 5.715f, -5.0912f, 19.0622f, 0.6521f, 0.5513f },
+    { 5.4726f, -3.8316f, 17.6253f, 0.6678f, 0.5733f },
+    { 5.684f, -2.9009f, 19.1162f, 0.6453f, 0.5799f },
+    { 5.418f, -2.7441f, 17.6653f, 0.6642f, 0.5874f },
+    { 5.4571f, -4.8784f, 17.5615f, 0.6724f, 0.5601f },
+    { 5.3103f, -1.6518f, 17.6694f, 0.6616f, 0.6021f },
+    { 5.6352f, -6.0617f, 18.9843f, 0.6564f, 0.5392f },
+    { 4.8727f, -2.6103f, 16.15f, 0.6846f, 0.5953f },
+    { 5.6137f, -5.3536f, 20.4456f, 0.6332f, 0.5423f },
+    { 5.6749f, -3.0296f, 20.3253f, 0.6293f, 0.5738f },
+    { 5.5726f, -1.7572f, 19.0887f, 0.643f, 0.5955f },
+    { 5.1662f, -0.5903f, 17.6254f, 0.6602f, 0.6167f },
+    { 4.625f, 0.5235f, 16.1364f, 0.6786f, 0.6372f },
+    { 4.6901f, -0.5171f, 16.1394f, 0.6802f, 0.6231f },
+    { 4.7861f, -1.5548f, 16.168f, 0.6819f, 0.6092f },
+    { 3.9816f, -1.4956f, 14.7769f, 0.702f, 0.6158f },
+    { 4.0438f, -2.5505f, 14.7477f, 0.705f, 0.6024f },
+    { 3.9748f, -0.4371f, 14.7861f, 0.6995f, 0.6294f },
+    { 3.1516f, -2.5366f, 13.6362f, 0.7225f, 0.6082f },
+    { 3.1144f, -1.4635f, 13.6693f, 0.7194f, 0.6212f },
+    { 4.0253f, 0.6169f, 14.8303f, 0.6968f, 0.6429f },
+    { 3.176f, -0.363f, 13.7121f, 0.7161f, 0.6346f },
+    { 4.631f, 1.5871f, 16.2316f, 0.676f, 0.6514f },
+    { 4.135f, 1.6584f, 14.9645f, 0.6934f, 0.6564f },
+    { 4.679f, 2.703f, 16.3555f, 0.6733f, 0.6663f },
+    { 5.0039f, 3.9086f, 17.6701f, 0.6543f, 0.6784f },
+    { 4.2571f, 2.725f, 15.1344f, 0.6902f, 0.6704f },
+    { 4.7401f, 3.9002f, 16.4387f, 0.6713f, 0.6826f },
+    { 5.238f, 5.1009f, 18.7781f, 0.6376f, 0.6907f },
+    { 5.1206f, 5.1741f, 17.6f, 0.6534f, 0.6961f },
+    { 5.3069f, 5.053f, 19.6901f, 0.6256f, 0.6868f },
+    { 5.3945f, 6.5339f, 17.2836f, 0.6542f, 0.716f },
+    { 5.2992f, 5.039f, 20.54f, 0.6144f, 0.6838f },
+    { 5.432f, 6.3719f, 18.5394f, 0.6381f, 0.7088f },
+    { 5.4301f, 6.2391f, 19.5393f, 0.6253f, 0.7033f },
+    { 5.3695f, 6.1583f, 20.4666f, 0.6135f, 0.6991f },
+    { 5.6011f, 7.7489f, 18.2674f, 0.6378f, 0.7282f },
+    { 5.1872f, 5.0675f, 21.5315f, 0.6013f, 0.6812f },
+    { 5.5248f, 7.5411f, 19.3718f, 0.6242f, 0.7211f },
+    { 5.2311f, 6.1523f, 21.5047f, 0.6001f, 0.6958f },
+    { 5.4023f, 7.3866f, 20.3967f, 0.6115f, 0.7155f },
+    { 4.8302f, 4.0412f, 22.6351f, 0.5873f, 0.6639f },
+    { 4.9426f, 5.1493f, 22.5751f, 0.5873f, 0.6793f },
+    { 4.4142f, 4.1464f, 23.6053f, 0.5733f, 0.6627f },
+    { 3.8318f, 4.2721f, 24.4848f, 0.5593f, 0.6622f },
+    { 4.5372f, 5.2952f, 23.5812f, 0.5732f, 0.6786f },
+    { 4.9828f, 6.2231f, 22.5676f, 0.586f, 0.6938f },
+    { 3.963f, 5.4748f, 24.4853f, 0.5592f, 0.6788f },
+    { 5.2277f, 7.314f, 21.4822f, 0.5979f, 0.7112f },
+    { 4.5925f, 6.373f, 23.5697f, 0.5722f, 0.6932f },
+    { 4.9679f, 7.3292f, 22.5519f, 0.584f, 0.7084f },
+    { 5.3839f, 8.8253f, 20.3233f, 0.6083f, 0.7344f },
+    { 5.1899f, 8.6423f, 21.414f, 0.5951f, 0.7287f },
+    { 5.518f, 9.0349f, 19.2593f, 0.6211f, 0.7409f },
+    { 5.2642f, 10.3015f, 20.2495f, 0.6042f, 0.7535f },
+    { 5.6052f, 9.2648f, 18.1194f, 0.6346f, 0.7484f },
+    { 5.3846f, 10.5292f, 19.1704f, 0.6168f, 0.7603f },
+    { 5.4516f, 10.7285f, 18.0219f, 0.6301f, 0.7676f },
+    { 5.4818f, 10.9307f, 16.741f, 0.6447f, 0.7763f },
+    { 5.1471f, 11.9487f, 17.9011f, 0.6259f, 0.784f },
+    { 5.0997f, 11.8326f, 19.0739f, 0.6124f, 0.7772f },
+    { 5.127f, 12.0623f, 16.6454f, 0.6401f, 0.7919f },
+    { 4.9929f, 11.6424f, 20.1781f, 0.5997f, 0.7706f },
+    { 5.6588f, 9.5085f, 16.8014f, 0.6502f, 0.7575f },
+    { 5.4712f, 11.1316f, 15.4415f, 0.6595f, 0.7854f },
+    { 5.6368f, 7.9811f, 16.9433f, 0.6541f, 0.737f },
+    { 5.6694f, 9.7854f, 15.4559f, 0.6658f, 0.7675f },
+    { 5.5782f, 8.1592f, 15.3803f, 0.6741f, 0.7463f },
+    { 5.1992f, 6.551f, 16.0166f, 0.6717f, 0.7212f },
+    { 5.6279f, 10.1149f, 14.2339f, 0.6794f, 0.7781f },
+    { 4.8886f, 5.1818f, 16.3646f, 0.6706f, 0.7007f },
+    { 4.9619f, 7.3191f, 14.4404f, 0.6919f, 0.7382f },
+    { 4.345f, 3.8544f, 15.2854f, 0.6878f, 0.6857f },
+    { 4.7279f, 6.249f, 14.9834f, 0.6882f, 0.7208f },
+    { 4.476f, 5.0335f, 15.2807f, 0.687f, 0.7025f },
+    { 3.6709f, 2.7705f, 14.1181f, 0.706f, 0.6739f },
+    { 3.7748f, 3.8113f, 14.3134f, 0.7037f, 0.6879f },
+    { 4.0667f, 5.8772f, 14.1449f, 0.7039f, 0.7181f },
+    { 3.8821f, 4.8545f, 14.3721f, 0.7028f, 0.7027f },
+    { 3.1062f, 4.7703f, 13.6626f, 0.7181f, 0.7028f },
+    { 4.2434f, 6.7848f, 13.7193f, 0.7069f, 0.7328f },
+    { 3.3019f, 5.6853f, 13.462f, 0.719f, 0.7167f },
+    { 3.4923f, 6.5057f, 13.1056f, 0.7211f, 0.73f },
+    { 4.3271f, 7.4822f, 13.1832f, 0.7115f, 0.7452f },
+    { 3.5966f, 7.1813f, 12.6751f, 0.7243f, 0.7417f },
+    { 5.0396f, 8.0619f, 13.6988f, 0.6987f, 0.7522f },
+    { 4.3721f, 8.068f, 12.4261f, 0.7181f, 0.7579f },
+    { 5.5384f, 8.9347f, 14.0922f, 0.6875f, 0.763f },
+    { 5.0324f, 8.6315f, 12.7462f, 0.7079f, 0.7654f },
+    { 3.674f, 7.7818f, 12.0475f, 0.7292f, 0.754f },
+    { 4.4326f, 8.6408f, 11.3379f, 0.7274f, 0.7735f },
+    { 3.0382f, 7.7099f, 11.827f, 0.7394f, 0.7515f },
+    { 3.7837f, 8.3768f, 11.1001f, 0.7364f, 0.769f },
+    { 2.9286f, 7.0966f, 12.3823f, 0.7359f, 0.7396f },
+    { 3.1908f, 8.2737f, 11.0403f, 0.744f, 0.765f },
+    { 2.7975f, 6.4121f, 12.7789f, 0.7334f, 0.7281f },
+    { 2.5644f, 7.7896f, 11.9811f, 0.7469f, 0.7483f },
+    { 2.4035f, 7.1653f, 12.5126f, 0.7449f, 0.7368f },
+    { 2.5806f, 5.6348f, 13.0896f, 0.7319f, 0.7157f },
+    { 2.2482f, 6.4341f, 12.9188f, 0.7428f, 0.7252f },
+    { 1.9895f, 7.3118f, 12.7804f, 0.7519f, 0.7344f },
+    { 2.0497f, 5.6875f, 13.1822f, 0.741f, 0.7141f },
+    { 1.8227f, 6.5378f, 13.2099f, 0.7499f, 0.7228f },
+    { 2.2293f, 8.0027f, 12.1153f, 0.753f, 0.7476f },
+    { 1.4992f, 6.6892f, 13.3368f, 0.7555f, 0.7222f },
+    { 1.6544f, 7.4604f, 12.8999f, 0.7574f, 0.7335f },
+    { 1.6624f, 5.8037f, 13.4301f, 0.7476f, 0.7128f },
+    { 1.372f, 5.9438f, 13.5233f, 0.7525f, 0.7128f },
+    { 1.8335f, 4.8779f, 13.3203f, 0.74f, 0.7028f },
+    { 1.2267f, 7.0689f, 13.4971f, 0.7631f, 0.7234f },
+    { 1.4262f, 4.953f, 13.5394f, 0.7463f, 0.7019f },
+    { 2.3547f, 4.7788f, 13.2721f, 0.7311f, 0.7028f },
+    { 2.9858f, 3.8109f, 13.6257f, 0.7185f, 0.6893f },
+    { 2.1965f, 3.858f, 13.2842f, 0.7311f, 0.6901f },
+    { 2.8769f, 2.8281f, 13.4651f, 0.7201f, 0.6762f },
+    { 1.6255f, 3.9578f, 13.3504f, 0.7402f, 0.6906f },
+    { 2.0766f, 2.895f, 13.1793f, 0.7318f, 0.6776f },
+    { 1.9651f, 1.9123f, 13.0108f, 0.7331f, 0.6654f },
+    { 1.4713f, 2.9679f, 13.2644f, 0.7407f, 0.6782f },
+    { 1.1883f, 3.9738f, 13.5391f, 0.7466f, 0.6897f },
+    { 0.9837f, 3.0147f, 13.4539f, 0.7476f, 0.678f },
+    { 1.4167f, 1.9491f, 13.0542f, 0.7408f, 0.6661f },
+    { 0.5363f, 3.0033f, 13.4808f, 0.7534f, 0.6765f },
+    { 0.96f, 1.976f, 13.1939f, 0.7471f, 0.6662f },
+    { 1.8891f, 0.8936f, 12.8477f, 0.7347f, 0.6533f },
+    { 1.4432f, 0.975f, 12.8334f, 0.7407f, 0.6549f },
+    { 2.7159f, 1.8434f, 13.2946f, 0.7225f, 0.6637f },
+    { 3.4967f, 1.7546f, 13.9357f, 0.7092f, 0.6608f },
+    { 2.5558f, 0.8128f, 13.149f, 0.7254f, 0.6512f },
+    { 3.3118f, 0.7235f, 13.7918f, 0.7127f, 0.6479f },
+    { 2.4497f, -0.3074f, 13.0634f, 0.7283f, 0.638f },
+    { 1.8753f, -0.1776f, 12.7586f, 0.7364f, 0.641f },
+    { 2.4018f, -1.4481f, 13.0182f, 0.7313f, 0.6248f },
+    { 1.6852f, -1.2908f, 12.6835f, 0.741f, 0.6292f },
+    { 2.4164f, -2.5404f, 12.9938f, 0.7345f, 0.6124f },
+    { 1.7039f, -2.5383f, 12.6811f, 0.744f, 0.6158f },
+    { 2.4517f, -3.6434f, 12.9773f, 0.7385f, 0.6001f },
+    { 1.6817f, -3.6618f, 12.6523f, 0.7483f, 0.6045f },
+    { 3.2402f, -3.6172f, 13.6118f, 0.7261f, 0.5953f },
+    { 1.6096f, -4.8821f, 12.6091f, 0.7545f, 0.5931f },
+    { 4.123f, -3.6158f, 14.7125f, 0.7086f, 0.589f },
+    { 2.4656f, -4.8162f, 12.9556f, 0.7439f, 0.5877f },
+    { 4.9253f, -3.6752f, 16.1076f, 0.6884f, 0.5816f },
+    { 4.9192f, -4.7412f, 16.0628f, 0.693f, 0.5682f },
+    { 4.1807f, -4.7053f, 14.6856f, 0.713f, 0.5755f },
+    { 4.8941f, -5.7514f, 16.0687f, 0.6974f, 0.5555f },
+    { 4.2354f, -5.7525f, 14.7084f, 0.7173f, 0.5624f },
+    { 3.3325f, -4.7405f, 13.5949f, 0.7305f, 0.582f },
+    { 3.4382f, -5.847f, 13.612f, 0.7354f, 0.5689f },
+    { 2.5221f, -6.0262f, 12.9534f, 0.7502f, 0.5752f },
+    { 2.6852f, -7.2408f, 12.9953f, 0.757f, 0.5628f },
+    { 1.5971f, -6.1896f, 12.576f, 0.7621f, 0.5815f },
+    { 1.7536f, -7.5753f, 12.5778f, 0.7706f, 0.5695f },
+    { 1.9525f, -8.9534f, 12.5499f, 0.7802f, 0.5584f },
+    { 0.8657f, -7.6756f, 12.2769f, 0.7806f, 0.5778f },
+    { 0.9224f, -8.9705f, 12.2122f, 0.7903f, 0.5701f },
+    { 0.7731f, -6.2368f, 12.3237f, 0.7714f, 0.5883f },
+    { -0.0003f, -7.6672f, 12.1556f, 0.7887f, 0.587f },
+    { -0.0003f, -8.962f, 12.0855f, 0.7994f, 0.5795f },
+    { -0.0003f, -6.2313f, 12.2287f, 0.7781f, 0.5946f },
+    { 0.7932f, -9.8878f, 12.0857f, 0.7996f, 0.5678f },
+    { -0.0003f, -9.895f, 11.9995f, 0.8063f, 0.5766f },
+    { -0.0003f, -10.7285f, 12.0196f, 0.8132f, 0.5737f },
+    { 0.6154f, -10.7121f, 12.0559f, 0.8087f, 0.5682f },
+    { 1.1295f, -10.6859f, 12.1122f, 0.8041f, 0.5627f },
+    { 1.4459f, -9.8731f, 12.2265f, 0.7942f, 0.5606f },
+    { 1.4402f, -10.6735f, 12.1362f, 0.8032f, 0.5613f },
+    { 1.8168f, -9.8572f, 12.304f, 0.7911f, 0.5567f },
+    { 1.6118f, -10.6644f, 12.1117f, 0.8022f, 0.56f },
+    { 2.0162f, -9.8487f, 12.3099f, 0.7898f, 0.5546f },
+    { 2.1543f, -9.8558f, 12.236f, 0.7897f, 0.5529f },
+    { 1.7083f, -10.6481f, 12.0226f, 0.8027f, 0.5595f },
+    { 2.839f, -9.2114f, 12.6568f, 0.7766f, 0.5458f },
+    { 3.0035f, -9.1951f, 12.4948f, 0.7779f, 0.5434f },
+    { 2.246f, -9.9017f, 12.095f, 0.791f, 0.5517f },
+    { 1.7732f, -10.6401f, 11.884f, 0.8032f, 0.5591f },
+    { -0.0003f, -6.3716f, 26.9319f, 0.503f, 0.4972f },
+    { -0.0003f, -7.3208f, 26.9138f, 0.503f, 0.4815f },
+    { -0.7296f, -6.4157f, 26.8608f, 0.4919f, 0.4971f },
+    { 0.7945f, -4.8876f, 12.3966f, 0.7639f, 0.5988f },
+    { -0.0003f, -4.8754f, 12.3238f, 0.7726f, 0.6045f },
+    { 0.8549f, -3.6402f, 12.48f, 0.7581f, 0.6093f },
+    { -0.0003f, -3.6194f, 12.4319f, 0.7671f, 0.6143f },
+    { -0.0003f, -2.4833f, 12.544f, 0.7648f, 0.6241f },
+    { 0.8797f, -2.5066f, 12.5585f, 0.7542f, 0.6198f },
+    { -0.0003f, -1.3835f, 12.6444f, 0.7624f, 0.6339f },
+    { 0.8414f, -1.4057f, 12.6386f, 0.7521f, 0.6308f },
+    { -0.0003f, -0.2359f, 12.7173f, 0.7608f, 0.6447f },
+    { 0.7128f, -0.2566f, 12.7268f, 0.7517f, 0.6426f },
+    { -0.0003f, 0.9183f, 12.859f, 0.7592f, 0.6555f },
+    { 1.2742f, -0.1835f, 12.7298f, 0.7444f, 0.6422f },
+    { 0.5688f, 0.898f, 12.891f, 0.7524f, 0.6546f },
+    { -0.0003f, 2.038f, 13.1656f, 0.7596f, 0.6656f },
+    { 1.5324f, 0.119f, 12.7158f, 0.7406f, 0.6451f },
+    { 1.0719f, 0.8969f, 12.9041f, 0.7458f, 0.6543f },
+    { 0.4845f, 2.0153f, 13.1993f, 0.7533f, 0.666f },
+    { -0.0003f, 3.1054f, 13.4669f, 0.7599f, 0.6756f },
+    { 0.8007f, 3.7698f, 13.5647f, 0.7513f, 0.686f },
+    { 0.5285f, 3.5216f, 13.4724f, 0.7548f, 0.6823f },
+    { 1.0527f, 4.2824f, 13.5339f, 0.7495f, 0.693f },
+    { 1.2393f, 5.2187f, 13.541f, 0.7502f, 0.7044f },
+    { 0.8084f, 3.8951f, 13.4642f, 0.7522f, 0.6878f },
+    { 1.1547f, 6.0662f, 13.5033f, 0.7563f, 0.713f },
+    { 1.0674f, 4.5083f, 13.4715f, 0.7504f, 0.6959f },
+    { 1.0681f, 5.3099f, 13.4643f, 0.7534f, 0.7047f },
+    { 0.8142f, 3.8808f, 13.3739f, 0.7529f, 0.688f },
+    { 0.9623f, 4.5819f, 13.3384f, 0.753f, 0.6965f },
+    { 0.9351f, 5.3614f, 13.2925f, 0.7566f, 0.7045f },
+    { 0.9868f, 6.1292f, 13.4114f, 0.7594f, 0.7124f },
+    { 0.855f, 4.6375f, 13.0955f, 0.7566f, 0.6967f },
+    { 0.7469f, 5.4249f, 13.1158f, 0.7606f, 0.7039f },
+    { 0.7699f, 3.9314f, 13.1891f, 0.7554f, 0.6887f },
+    { 0.6803f, 4.7265f, 12.8655f, 0.7609f, 0.6969f },
+    { 0.4377f, 3.4047f, 13.3076f, 0.7577f, 0.6813f },
+    { -0.0003f, 3.2044f, 13.2823f, 0.7637f, 0.6753f },
+    { 0.4233f, 3.4076f, 13.0803f, 0.7605f, 0.6821f },
+    { -0.0003f, 3.1774f, 13.036f, 0.7674f, 0.675f },
+    { 0.6891f, 4.0069f, 12.9038f, 0.759f, 0.6896f },
+    { 0.3802f, 3.5189f, 12.8005f, 0.7634f, 0.6837f },
+    { -0.0003f, 3.3104f, 12.7709f, 0.7689f, 0.6785f },
+    { 0.5445f, 4.1403f, 12.6526f, 0.7631f, 0.6907f },
+    { 0.3102f, 3.7168f, 12.5728f, 0.7662f, 0.6859f },
+    { -0.0003f, 3.5827f, 12.5672f, 0.7704f, 0.6819f },
+    { -0.0003f, 3.9734f, 12.5049f, 0.7711f, 0.6878f },
+    { 0.215f, 3.9799f, 12.502f, 0.7683f, 0.6884f },
+    { 0.3084f, 4.3642f, 12.57f, 0.7672f, 0.6923f },
+    { -0.0003f, 4.4602f, 12.5706f, 0.7719f, 0.6936f },
+    { 0.3731f, 4.8999f, 12.7705f, 0.7659f, 0.6975f },
+    { -0.0003f, 5.0078f, 12.7568f, 0.7712f, 0.6982f },
+    { 0.4104f, 5.5524f, 13.0248f, 0.7656f, 0.7034f },
+    { -0.0003f, 5.632f, 13.0006f, 0.7704f, 0.7029f },
+    { 0.7739f, 6.1852f, 13.3081f, 0.7628f, 0.7111f },
+    { 0.4216f, 6.2868f, 13.2541f, 0.7675f, 0.7097f },
+    { -0.0003f, 6.3489f, 13.2394f, 0.7728f, 0.7081f },
+    { 1.0076f, 7.0592f, 13.6235f, 0.767f, 0.7203f },
+    { 0.7806f, 7.0807f, 13.5982f, 0.7698f, 0.7183f },
+    { 0.4228f, 7.1309f, 13.5889f, 0.7739f, 0.7158f },
+    { -0.0003f, 7.1643f, 13.5852f, 0.7752f, 0.7133f },
+    { -0.0003f, 8.0842f, 14.1499f, 0.7911f, 0.7176f },
+    { 0.4301f, 8.1123f, 14.1593f, 0.7871f, 0.7214f },
+    { -0.0003f, 8.8934f, 14.65f, 0.8071f, 0.7219f },
+    { 0.7865f, 8.1846f, 14.1419f, 0.7837f, 0.725f },
+    { 0.4328f, 8.9751f, 14.6639f, 0.8003f, 0.7265f },
+    { 0.4202f, 9.4632f, 14.8009f, 0.8065f, 0.7314f },
+    { -0.0003f, 9.3768f, 14.8019f, 0.8093f, 0.7254f },
+    { -0.0003f, 9.6432f, 14.7088f, 0.8115f, 0.729f },
+    { 0.3952f, 9.7109f, 14.691f, 0.8092f, 0.7362f },
+    { 0.6946f, 10.0341f, 14.6844f, 0.807f, 0.7435f },
+    { 0.7362f, 9.888f, 14.8354f, 0.8038f, 0.7374f },
+    { 0.8195f, 9.4523f, 14.753f, 0.8006f, 0.7314f },
+    { 0.9852f, 9.5815f, 14.6061f, 0.7995f, 0.736f },
+    { 0.9948f, 8.2695f, 14.1001f, 0.7815f, 0.7282f },
+    { 1.1263f, 9.7504f, 14.277f, 0.7985f, 0.7406f },
+    { 1.1425f, 8.4574f, 13.877f, 0.7797f, 0.7328f },
+    { 1.3299f, 10.0007f, 13.6088f, 0.7929f, 0.7478f },
+    { 1.317f, 8.8387f, 13.3154f, 0.7776f, 0.7406f },
+    { 1.5358f, 10.3309f, 12.7013f, 0.7874f, 0.7549f },
+    { 1.4223f, 7.8798f, 13.0264f, 0.7648f, 0.7352f },
+    { 1.503f, 9.3259f, 12.4785f, 0.7763f, 0.7512f },
+    { 1.6837f, 10.7396f, 11.6546f, 0.7892f, 0.7661f },
+    { 1.8886f, 8.1679f, 12.1815f, 0.7584f, 0.7469f },
+    { 1.6205f, 8.528f, 12.2719f, 0.7654f, 0.7477f },
+    { 1.6853f, 9.8316f, 11.4292f, 0.7773f, 0.7641f },
+    { 1.8515f, 11.2617f, 10.508f, 0.7909f, 0.7773f },
+    { 1.8864f, 9.1072f, 11.2305f, 0.7667f, 0.7628f },
+    { 1.9019f, 10.4453f, 10.247f, 0.781f, 0.7791f },
+    { 2.1165f, 11.9321f, 9.3005f, 0.7977f, 0.7924f },
+    { 2.2526f, 8.7223f, 11.1508f, 0.759f, 0.7629f },
+    { 2.1851f, 9.7707f, 10.0171f, 0.7707f, 0.78f },
+    { 2.1911f, 11.2567f, 9.0115f, 0.7881f, 0.7956f },
+    { 2.3464f, 12.5546f, 8.2769f, 0.8046f, 0.8074f },
+    { 2.4332f, 11.988f, 7.9756f, 0.7956f, 0.8094f },
+    { 2.4084f, 12.9331f, 7.6817f, 0.8085f, 0.8098f },
+    { 2.4817f, 10.6719f, 8.7468f, 0.7792f, 0.7988f },
+    { 2.6417f, 9.3586f, 9.9186f, 0.7623f, 0.7812f },
+    { 2.7068f, 11.4725f, 7.6902f, 0.7878f, 0.8144f },
+    { 2.6088f, 8.488f, 11.1885f, 0.7532f, 0.7624f },
+    { 2.7796f, 8.2157f, 11.3418f, 0.7485f, 0.7593f },
+    { 3.2128f, 8.9785f, 10.0499f, 0.7527f, 0.7804f },
+    { 3.9267f, 9.1176f, 9.9232f, 0.7459f, 0.7871f },
+    { 2.9513f, 10.3122f, 8.5958f, 0.7715f, 0.8019f },
+    { 3.5192f, 10.1495f, 8.5516f, 0.7645f, 0.8052f },
+    { 3.1597f, 11.1791f, 7.4986f, 0.7812f, 0.8193f },
+    { 4.1046f, 10.1554f, 8.6074f, 0.7576f, 0.8087f },
+    { 3.7049f, 11.0647f, 7.4271f, 0.7748f, 0.8237f },
+    { 3.7832f, 11.4657f, 6.884f, 0.78f, 0.8324f },
+    { 4.2551f, 11.0864f, 7.5022f, 0.768f, 0.8273f },
+    { 4.5174f, 9.356f, 10.0649f, 0.7386f, 0.7918f },
+    { 4.6355f, 10.369f, 8.7536f, 0.7507f, 0.8129f },
+    { 5.012f, 9.1818f, 11.5704f, 0.7189f, 0.7805f },
+    { 5.0054f, 9.864f, 10.2793f, 0.731f, 0.798f },
+    { 5.4823f, 9.4458f, 12.9745f, 0.699f, 0.776f },
+    { 5.3932f, 9.9468f, 11.7754f, 0.7111f, 0.7899f },
+    { 5.549f, 10.4849f, 13.0779f, 0.6919f, 0.7893f },
+    { 5.4477f, 10.8831f, 11.9307f, 0.704f, 0.8011f },
+    { 5.3338f, 11.5493f, 13.1093f, 0.686f, 0.8032f },
+    { 5.2426f, 11.8316f, 12.0421f, 0.6977f, 0.813f },
+    { 5.416f, 11.3269f, 14.2366f, 0.6733f, 0.7942f },
+    { 4.9381f, 12.4399f, 13.1215f, 0.6807f, 0.8156f },
+    { 5.0106f, 12.2951f, 14.2134f, 0.668f, 0.8079f },
+    { 5.0709f, 12.1766f, 15.3888f, 0.6544f, 0.8002f },
+    { 4.4151f, 13.0879f, 13.1305f, 0.6758f, 0.8263f },
+    { 4.4609f, 12.9945f, 14.187f, 0.6633f, 0.8196f },
+    { 4.5772f, 12.9029f, 16.5504f, 0.6356f, 0.8055f },
+    { 4.5035f, 12.928f, 15.3276f, 0.6498f, 0.8128f },
+    { 3.8039f, 13.3933f, 15.2874f, 0.6452f, 0.8241f },
+    { 3.815f, 13.4523f, 16.4918f, 0.6308f, 0.818f },
+    { 4.6214f, 12.8934f, 17.781f, 0.6215f, 0.7985f },
+    { 3.8037f, 13.5307f, 17.6851f, 0.6167f, 0.8121f },
+    { 4.5756f, 12.8739f, 18.945f, 0.608f, 0.7925f },
+    { 3.7247f, 13.5817f, 18.7592f, 0.604f, 0.8071f },
+    { 4.4306f, 12.8784f, 20.1622f, 0.5933f, 0.7876f },
+    { 3.5174f, 13.6293f, 19.6337f, 0.5929f, 0.8044f },
+    { 2.7569f, 13.9793f, 18.5997f, 0.5999f, 0.82f },
+    { 2.6022f, 14.0399f, 19.3661f, 0.5904f, 0.817f },
+    { 2.8583f, 13.8602f, 17.6456f, 0.6113f, 0.8245f },
+    { 1.7946f, 14.1956f, 19.3017f, 0.5864f, 0.8264f },
+    { 2.9216f, 13.6935f, 16.5472f, 0.6246f, 0.8298f },
+    { 1.882f, 14.09f, 18.5499f, 0.5951f, 0.8305f },
+    { 1.9496f, 13.8814f, 17.6943f, 0.6051f, 0.8354f },
+    { 1.9785f, 13.6092f, 16.7942f, 0.6158f, 0.8411f },
+    { 1.129f, 13.9953f, 18.5528f, 0.5906f, 0.8391f },
+    { 2.877f, 13.4577f, 15.2898f, 0.6392f, 0.8377f },
+    { 1.1494f, 13.7149f, 17.7728f, 0.5993f, 0.8447f },
+    { 1.8703f, 13.2197f, 16.0065f, 0.6243f, 0.8486f },
+    { 1.126f, 13.3613f, 17.0712f, 0.6071f, 0.8509f },
+    { 0.5267f, 13.7766f, 18.5512f, 0.5869f, 0.8466f },
+    { 1.0588f, 12.9699f, 16.4626f, 0.6137f, 0.8574f },
+    { 0.505f, 13.1117f, 17.2167f, 0.6014f, 0.8582f },
+    { 0.4729f, 12.7329f, 16.6973f, 0.6068f, 0.8638f },
+    { 0.9477f, 12.576f, 15.9618f, 0.6186f, 0.8642f },
+    { 1.5269f, 12.6592f, 15.4878f, 0.6283f, 0.8593f },
+    { 0.4527f, 12.4098f, 16.2293f, 0.6115f, 0.8686f },
+    { -0.0021f, 12.6176f, 16.7592f, 0.6023f, 0.8693f },
+    { -0.0072f, 12.3059f, 16.3114f, 0.6056f, 0.8727f },
+    { -0.0003f, 12.9865f, 17.2565f, 0.5971f, 0.8643f },
+    { 0.4381f, 12.1236f, 15.7996f, 0.6146f, 0.8736f },
+    { -0.0106f, 12.0403f, 15.8944f, 0.6089f, 0.8762f },
+    { -0.0071f, 11.8101f, 15.4895f, 0.6088f, 0.8816f },
+    { 0.852f, 12.0238f, 15.5043f, 0.6235f, 0.8735f },
+    { 0.4229f, 11.8558f, 15.3953f, 0.6156f, 0.8797f },
+    { -0.0018f, 11.6032f, 15.0887f, 0.6087f, 0.887f },
+    { 0.4061f, 11.6045f, 15.0082f, 0.6155f, 0.8864f },
+    { 0.7394f, 11.6366f, 15.1999f, 0.6229f, 0.8819f },
+    { 0.3871f, 11.368f, 14.6301f, 0.6153f, 0.8931f },
+    { -0.0001f, 11.4076f, 14.6837f, 0.6095f, 0.8937f },
+    { 0.7081f, 11.3866f, 14.8626f, 0.622f, 0.8883f },
+    { 0.3662f, 11.0463f, 14.3372f, 0.6162f, 0.8998f },
+    { -0.0001f, 11.1011f, 14.3649f, 0.6103f, 0.9004f },
+    { 0.6708f, 11.1417f, 14.5362f, 0.6208f, 0.8945f },
+    { 0.571f, 10.9306f, 14.3564f, 0.6198f, 0.8993f },
+    { 0.8016f, 10.7279f, 14.7481f, 0.6285f, 0.8958f },
+    { 0.7481f, 10.6212f, 14.4691f, 0.6256f, 0.9001f },
+    { 0.6174f, 10.538f, 14.2547f, 0.6226f, 0.904f },
+    { 0.3442f, 10.5396f, 14.2058f, 0.6193f, 0.9067f },
+    { -0.0002f, 10.5616f, 14.2227f, 0.6158f, 0.9087f },
+    { 0.5464f, 10.1991f, 14.2905f, 0.6251f, 0.9081f },
+    { 0.3371f, 10.0681f, 14.2426f, 0.6235f, 0.9119f },
+    { -0.0003f, 10.0436f, 14.2586f, 0.6212f, 0.917f },
+    { 0.6382f, 10.0952f, 14.4387f, 0.6285f, 0.9073f },
+    { 0.3608f, 9.8522f, 14.4546f, 0.6279f, 0.9136f },
+    { -0.0003f, 9.8015f, 14.4742f, 0.6257f, 0.9194f },
+    { 0.6946f, 10.0341f, 14.6844f, 0.6347f, 0.9053f },
+    { 0.3952f, 9.7109f, 14.691f, 0.6324f, 0.9135f },
+    { -0.0003f, 9.6432f, 14.7088f, 0.6301f, 0.9217f },
+    { 0.7362f, 9.888f, 14.8354f, 0.64f, 0.9062f },
+    { 0.8432f, 10.7966f, 14.9909f, 0.6312f, 0.892f },
+    { 0.8195f, 9.4523f, 14.753f, 0.6454f, 0.907f },
+    { 0.9042f, 10.8264f, 15.082f, 0.6343f, 0.8889f },
+    { 1.0156f, 10.8166f, 14.9063f, 0.638f, 0.8867f },
+    { 0.9852f, 9.5815f, 14.6061f, 0.6462f, 0.9018f },
+    { 1.1686f, 11.8756f, 15.1503f, 0.6315f, 0.8723f },
+    { 1.193f, 10.8551f, 14.4623f, 0.6434f, 0.8843f },
+    { 1.1263f, 9.7504f, 14.277f, 0.6471f, 0.8966f },
+    { 1.4613f, 11.827f, 14.5922f, 0.6399f, 0.8707f },
+    { 2.0499f, 12.7217f, 14.8265f, 0.6395f, 0.8553f },
+    { 1.7716f, 11.9599f, 13.8417f, 0.65f, 0.8681f },
+    { 2.3763f, 12.8257f, 13.9972f, 0.6514f, 0.8537f },
+    { 3.1098f, 13.3862f, 14.1362f, 0.6545f, 0.8401f },
+    { 3.816f, 13.4003f, 14.1804f, 0.6587f, 0.8295f },
+    { 3.8182f, 13.4248f, 13.1521f, 0.6712f, 0.835f },
+    { 3.1917f, 13.3953f, 13.1427f, 0.667f, 0.8437f },
+    { 4.3318f, 13.1938f, 12.1597f, 0.687f, 0.8337f },
+    { 3.7775f, 13.4181f, 12.1839f, 0.6825f, 0.8414f },
+    { 2.5798f, 12.9442f, 13.0588f, 0.6637f, 0.8542f },
+    { 3.2294f, 13.3541f, 12.1626f, 0.6789f, 0.8486f },
+    { 2.0621f, 12.2053f, 12.9435f, 0.6615f, 0.8659f },
+    { 2.7343f, 13.0499f, 12.0701f, 0.6763f, 0.8566f },
+    { 1.4521f, 11.0297f, 13.7482f, 0.6511f, 0.881f },
+    { 1.3299f, 10.0007f, 13.6088f, 0.6534f, 0.8931f },
+    { 1.7181f, 11.3124f, 12.8403f, 0.6607f, 0.878f },
+    { 1.5358f, 10.3309f, 12.7013f, 0.6598f, 0.8895f },
+    { 2.2954f, 12.4941f, 11.9423f, 0.6743f, 0.8659f },
+    { 1.9162f, 11.6756f, 11.8148f, 0.6721f, 0.8771f },
+    { 1.6837f, 10.7396f, 11.6546f, 0.6698f, 0.8892f },
+    { 2.0929f, 12.0991f, 10.6999f, 0.684f, 0.8788f },
+    { 1.8515f, 11.2617f, 10.508f, 0.6798f, 0.8889f },
+    { 2.1165f, 11.9321f, 9.3005f, 0.6928f, 0.8924f },
+    { 2.4741f, 12.7983f, 10.8628f, 0.6869f, 0.8688f },
+    { 2.2947f, 12.5633f, 9.5243f, 0.6958f, 0.8838f },
+    { 2.3464f, 12.5546f, 8.2769f, 0.7058f, 0.8959f },
+    { 2.8428f, 13.1999f, 11.0367f, 0.6887f, 0.8612f },
+    { 2.6004f, 13.0899f, 9.7297f, 0.6983f, 0.8757f },
+    { 2.4536f, 13.0012f, 8.5161f, 0.7057f, 0.8896f },
+    { 2.5016f, 13.3458f, 7.9037f, 0.7123f, 0.8935f },
+    { 2.4084f, 12.9331f, 7.6817f, 0.7102f, 0.8988f },
+    { 2.7053f, 13.4454f, 8.6674f, 0.7088f, 0.8834f },
+    { 2.5287f, 13.6209f, 7.4948f, 0.7174f, 0.8962f },
+    { 2.4202f, 13.1583f, 7.2984f, 0.7146f, 0.9016f },
+    { 2.4997f, 13.3208f, 6.9105f, 0.7195f, 0.9042f },
+    { 2.6855f, 13.6929f, 8.0586f, 0.7147f, 0.8888f },
+    { 2.7194f, 13.9705f, 7.6586f, 0.7197f, 0.8913f },
+    { 2.6249f, 13.8501f, 7.0971f, 0.7227f, 0.8981f },
+    { 2.5926f, 13.3982f, 6.3351f, 0.7244f, 0.9067f },
+    { 2.8683f, 14.2602f, 7.8254f, 0.7212f, 0.8872f },
+    { 2.7263f, 13.9685f, 6.4935f, 0.7293f, 0.902f },
+    { 2.8135f, 14.2316f, 7.2845f, 0.725f, 0.8926f },
+    { 2.9389f, 14.4624f, 7.5246f, 0.7254f, 0.8884f },
+    { 2.9724f, 14.4757f, 6.7496f, 0.7322f, 0.8945f },
+    { 3.0631f, 14.6481f, 7.2964f, 0.7292f, 0.8883f },
+    { 3.1059f, 14.7082f, 7.5154f, 0.728f, 0.886f },
+    { 2.9961f, 14.3084f, 5.5096f, 0.7422f, 0.9053f },
+    { 3.0428f, 14.6278f, 7.7321f, 0.7254f, 0.8851f },
+    { 3.2175f, 14.8342f, 7.516f, 0.7294f, 0.8846f },
+    { 2.9995f, 14.5111f, 7.9803f, 0.7224f, 0.8838f },
+    { 3.2345f, 14.7909f, 7.1931f, 0.732f, 0.8871f },
+    { 3.1672f, 14.8133f, 7.8219f, 0.7265f, 0.8827f },
+    { 3.2426f, 14.6832f, 6.6086f, 0.7366f, 0.8921f },
+    { 3.266f, 14.5111f, 5.5176f, 0.7454f, 0.9015f },
+    { 3.5196f, 14.7524f, 6.5874f, 0.7394f, 0.8893f },
+    { 3.5677f, 14.5759f, 5.5077f, 0.7484f, 0.8983f },
+    { 3.4778f, 14.8669f, 7.1552f, 0.7346f, 0.8848f },
+    { 3.8899f, 14.5599f, 5.4967f, 0.7516f, 0.895f },
+    { 3.4406f, 14.9268f, 7.4818f, 0.7318f, 0.8825f },
+    { 3.8499f, 14.7373f, 6.5644f, 0.7425f, 0.886f },
+    { 3.8175f, 14.8521f, 7.1227f, 0.7376f, 0.8816f },
+    { 3.8125f, 14.9127f, 7.4503f, 0.7348f, 0.8793f },
+    { 4.1837f, 14.599f, 6.5403f, 0.746f, 0.8823f },
+    { 3.4063f, 14.9396f, 7.8383f, 0.7286f, 0.8801f },
+    { 4.1568f, 14.7311f, 7.1026f, 0.7408f, 0.8781f },
+    { 3.8549f, 14.9277f, 7.8254f, 0.7319f, 0.8763f },
+    { 4.1817f, 14.8031f, 7.433f, 0.7378f, 0.8757f },
+    { 3.1376f, 14.7446f, 8.1084f, 0.7236f, 0.8808f },
+    { 3.3965f, 14.8899f, 8.1883f, 0.7256f, 0.8776f },
+    { 3.1828f, 14.6447f, 8.3728f, 0.7214f, 0.8783f },
+    { 3.4328f, 14.762f, 8.4957f, 0.723f, 0.8747f },
+    { 3.8905f, 14.8764f, 8.1987f, 0.7289f, 0.8731f },
+    { 3.865f, 14.7383f, 8.5208f, 0.7258f, 0.8705f },
+    { 4.2919f, 14.8042f, 7.7932f, 0.7352f, 0.8723f },
+    { 4.3666f, 14.7392f, 8.1476f, 0.7325f, 0.869f },
+    { 4.2853f, 14.6127f, 8.4605f, 0.7291f, 0.8667f },
+    { 4.572f, 14.5132f, 8.0429f, 0.7354f, 0.8665f },
+    { 4.4962f, 14.596f, 7.7516f, 0.7376f, 0.8696f },
+    { 4.4995f, 14.4242f, 8.3274f, 0.7321f, 0.8644f },
+    { 4.397f, 14.609f, 7.4417f, 0.74f, 0.8727f },
+    { 4.1861f, 14.4263f, 8.7174f, 0.726f, 0.8645f },
+    { 4.3993f, 14.4886f, 7.1013f, 0.7437f, 0.8745f },
+    { 4.4712f, 14.2986f, 6.5161f, 0.7501f, 0.878f },
+    { 4.5603f, 14.2303f, 7.1853f, 0.7453f, 0.8708f },
+    { 4.5807f, 14.1026f, 5.4715f, 0.7602f, 0.8863f },
+    { 4.5109f, 14.3955f, 7.4241f, 0.7418f, 0.8705f },
+    { 4.5799f, 14.3372f, 7.6456f, 0.7402f, 0.8679f },
+    { 4.6355f, 14.2356f, 7.9033f, 0.7382f, 0.8648f },
+    { 4.6552f, 14.0618f, 7.4207f, 0.7442f, 0.8669f },
+    { 4.7299f, 13.8859f, 6.6101f, 0.7535f, 0.872f },
+    { 4.8974f, 13.7097f, 5.4371f, 0.7654f, 0.8814f },
+    { 4.7863f, 13.7421f, 7.1598f, 0.7493f, 0.8654f },
+    { 5.0367f, 13.5556f, 4.4099f, 0.7756f, 0.89f },
+    { 4.6858f, 13.9436f, 7.7476f, 0.7414f, 0.8631f },
+    { 4.8025f, 13.6092f, 7.5715f, 0.7455f, 0.8607f },
+    { 4.654f, 13.8363f, 8.1059f, 0.7375f, 0.8596f },
+    { 4.773f, 13.4527f, 8.0052f, 0.7409f, 0.8562f },
+    { 5.0652f, 13.2046f, 7.3707f, 0.751f, 0.8573f },
+    { 4.5938f, 14.1673f, 8.1872f, 0.735f, 0.8624f },
+    { 5.0435f, 13.0376f, 7.8069f, 0.7465f, 0.8524f },
+    { 4.4112f, 14.2663f, 8.5655f, 0.7294f, 0.8622f },
+    { 4.5225f, 14.0866f, 8.4048f, 0.7324f, 0.8607f },
+    { 4.5689f, 13.8206f, 8.4458f, 0.7331f, 0.8577f },
+    { 4.4394f, 13.977f, 8.7174f, 0.7286f, 0.8585f },
+    { 4.7173f, 13.2694f, 8.6514f, 0.7333f, 0.8504f },
+    { 4.2074f, 14.1817f, 8.9035f, 0.7242f, 0.8613f },
+    { 5.051f, 12.7088f, 8.4557f, 0.7398f, 0.8445f },
+    { 4.5314f, 13.6144f, 9.0897f, 0.7254f, 0.8525f },
+    { 5.1661f, 12.0777f, 9.5183f, 0.7289f, 0.8305f },
+    { 4.6343f, 13.2367f, 9.9892f, 0.7157f, 0.8434f },
+    { 4.9256f, 12.7f, 9.7707f, 0.722f, 0.8371f },
+    { 5.2422f, 11.4331f, 9.2493f, 0.7362f, 0.8239f },
+    { 5.321f, 11.3879f, 10.7561f, 0.7162f, 0.8146f },
+    { 5.2177f, 12.2174f, 8.1848f, 0.7468f, 0.8398f },
+    { 5.3027f, 10.5664f, 10.5239f, 0.7235f, 0.8056f },
+    { 5.087f, 11.7026f, 7.9169f, 0.7539f, 0.8352f },
+    { 5.04f, 10.8292f, 8.981f, 0.7435f, 0.818f },
+    { 4.7394f, 11.2852f, 7.6801f, 0.7609f, 0.8309f },
+    { 4.3159f, 11.5064f, 6.9574f, 0.7734f, 0.8362f },
+    { 4.7815f, 11.71f, 7.12f, 0.7665f, 0.8399f },
+    { 5.1179f, 12.1095f, 7.3285f, 0.7598f, 0.844f },
+    { 4.3274f, 11.6473f, 6.6754f, 0.7765f, 0.8404f },
+    { 5.2352f, 12.5901f, 7.5638f, 0.7532f, 0.8483f },
+    { 4.783f, 11.866f, 6.8034f, 0.77f, 0.8444f },
+    { 5.1213f, 12.2693f, 6.9706f, 0.7636f, 0.8487f },
+    { 5.2471f, 12.7509f, 7.1641f, 0.7573f, 0.8531f },
+    { 5.0378f, 13.3506f, 6.9457f, 0.7549f, 0.8623f },
+    { 5.2057f, 12.8996f, 6.7635f, 0.761f, 0.8582f },
+    { 5.0352f, 13.4137f, 6.3399f, 0.7606f, 0.8687f },
+    { 5.1313f, 13.3324f, 5.3614f, 0.7705f, 0.8776f },
+    { 5.1783f, 12.9809f, 6.1909f, 0.7664f, 0.8647f },
+    { 5.2427f, 13.1953f, 4.3993f, 0.7803f, 0.886f },
+    { 5.2323f, 12.9398f, 5.2752f, 0.7755f, 0.8738f },
+    { 5.3051f, 12.8381f, 4.386f, 0.7846f, 0.8823f },
+    { 4.6769f, 13.9398f, 4.4021f, 0.77f, 0.8954f },
+    { 4.2289f, 14.4173f, 5.4846f, 0.7553f, 0.8911f },
+    { 4.2705f, 14.2503f, 4.3885f, 0.7647f, 0.9008f },
+    { 3.9244f, 14.3896f, 4.3818f, 0.7608f, 0.9048f },
+    { 3.6082f, 14.4041f, 4.3811f, 0.7577f, 0.9081f },
+    { 3.2912f, 14.34f, 4.385f, 0.7545f, 0.9114f },
+    { 3.3047f, 14.2357f, 3.6758f, 0.7599f, 0.9181f },
+    { 3.062f, 13.9797f, 3.2879f, 0.7598f, 0.9258f },
+    { 3.0127f, 14.0449f, 3.7103f, 0.7563f, 0.9217f },
+    { 3.005f, 14.1488f, 4.3994f, 0.751f, 0.9152f },
+    { 2.7691f, 13.9109f, 5.4667f, 0.7383f, 0.9105f },
+    { 2.645f, 13.368f, 5.3892f, 0.7342f, 0.9165f },
+    { 2.7809f, 13.7816f, 4.4299f, 0.7468f, 0.9198f },
+    { 2.6708f, 13.2856f, 4.4497f, 0.7439f, 0.9263f },
+    { 2.6837f, 13.2067f, 3.8937f, 0.7469f, 0.9305f },
+    { 2.7899f, 13.6847f, 3.7959f, 0.7518f, 0.9259f },
+    { 2.6929f, 13.1613f, 3.5547f, 0.7499f, 0.9347f },
+    { 2.8226f, 13.6312f, 3.4054f, 0.7551f, 0.9298f },
+    { 2.7078f, 13.1798f, 3.266f, 0.7529f, 0.9369f },
+    { 2.906f, 13.632f, 3.0989f, 0.7585f, 0.9324f },
+    { 2.7081f, 13.2238f, 2.9815f, 0.7559f, 0.939f },
+    { 3.1958f, 13.9358f, 2.9779f, 0.7633f, 0.9283f },
+    { 2.9711f, 13.685f, 2.8045f, 0.7618f, 0.9349f },
+    { 2.6738f, 13.2549f, 2.6549f, 0.7587f, 0.9437f },
+    { 3.3135f, 13.961f, 2.6868f, 0.7668f, 0.9308f },
+    { 2.9488f, 13.788f, 2.4503f, 0.7649f, 0.9388f },
+    { 2.6236f, 13.2711f, 2.3452f, 0.7614f, 0.9483f },
+    { 3.3146f, 14.1032f, 2.321f, 0.7701f, 0.9344f },
+    { 2.8847f, 13.8714f, 2.1142f, 0.7675f, 0.9428f },
+    { 2.824f, 13.8654f, 1.8741f, 0.7695f, 0.9458f },
+    { 2.5764f, 13.2705f, 2.1112f, 0.7636f, 0.9507f },
+    { 3.2553f, 14.2286f, 1.9705f, 0.7728f, 0.9382f },
+    { 2.7746f, 13.7622f, 1.6427f, 0.7719f, 0.9489f },
+    { 2.5364f, 13.2531f, 1.8774f, 0.7658f, 0.953f },
+    { 2.508f, 13.219f, 1.5679f, 0.77f, 0.9563f },
+    { 3.1918f, 14.2037f, 1.7251f, 0.7747f, 0.9413f },
+    { 3.1378f, 14.0272f, 1.4928f, 0.7768f, 0.9447f },
+    { 2.7444f, 13.5541f, 1.3328f, 0.7756f, 0.9532f },
+    { 2.4745f, 13.1765f, 1.281f, 0.7742f, 0.9595f },
+    { 3.579f, 14.2022f, 1.961f, 0.7762f, 0.9346f },
+    { 3.107f, 13.6979f, 1.1813f, 0.7806f, 0.9497f },
+    { 3.4905f, 13.2919f, 0.9556f, 0.7884f, 0.9502f },
+    { 2.6834f, 13.3453f, 1.0534f, 0.779f, 0.9576f },
+    { 3.023f, 13.2921f, 0.8059f, 0.7852f, 0.9564f },
+    { 2.5417f, 13.24f, 0.9136f, 0.7801f, 0.9611f },
+    { 2.4196f, 13.134f, 1.1149f, 0.7756f, 0.9607f },
+    { 2.3739f, 12.9468f, 1.0343f, 0.7771f, 0.9619f },
+    { 2.3866f, 13.0109f, 0.882f, 0.7802f, 0.964f },
+    { 2.3925f, 12.8629f, 0.6866f, 0.7832f, 0.966f },
+    { 2.6526f, 13.1256f, 0.6934f, 0.7844f, 0.9622f },
+    { 2.3506f, 12.6322f, 0.5078f, 0.7865f, 0.9694f },
+    { 2.6443f, 12.8846f, 0.5058f, 0.7885f, 0.9651f },
+    { 2.3089f, 12.412f, 0.3385f, 0.7899f, 0.9728f },
+    { 2.5885f, 12.6363f, 0.3371f, 0.7923f, 0.9687f },
+    { 3.0254f, 12.9405f, 0.5711f, 0.7904f, 0.9602f },
+    { 2.9547f, 12.5249f, 0.3333f, 0.7948f, 0.9646f },
+    { 3.4602f, 12.9424f, 0.7425f, 0.7926f, 0.9542f },
+    { 3.9218f, 12.9258f, 0.8509f, 0.7953f, 0.9481f },
+    { 3.4466f, 12.6436f, 0.5645f, 0.7966f, 0.9569f },
+    { 3.1684f, 12.2247f, 0.2163f, 0.8021f, 0.9635f },
+    { 3.9069f, 12.633f, 0.6741f, 0.799f, 0.9508f },
+    { 3.0357f, 11.6385f, 0.1072f, 0.81f, 0.9681f },
+    { 2.8918f, 11.6133f, 0.1717f, 0.8091f, 0.9705f },
+    { 3.4882f, 12.417f, 0.3989f, 0.8004f, 0.9581f },
+    { 3.2933f, 12.029f, 0.1496f, 0.8056f, 0.9627f },
+    { 3.2217f, 11.6369f, 0.0273f, 0.8111f, 0.9654f },
+    { 3.5132f, 12.1161f, 0.2354f, 0.8051f, 0.9593f },
+    { 3.8986f, 12.4145f, 0.5067f, 0.8022f, 0.9526f },
+    { 3.4497f, 11.5947f, 0.0634f, 0.8124f, 0.9624f },
+    { 4.3658f, 12.6449f, 0.554f, 0.8024f, 0.9457f },
+    { 3.8903f, 12.0642f, 0.331f, 0.8073f, 0.9546f },
+    { 4.3031f, 12.4164f, 0.3912f, 0.8053f, 0.9481f },
+    { 4.849f, 12.538f, 0.3119f, 0.8077f, 0.9412f },
+    { 4.6007f, 12.2217f, 0.1991f, 0.8104f, 0.9456f },
+    { 4.2589f, 12.1046f, 0.2266f, 0.8094f, 0.9502f },
+    { 4.4685f, 12.0118f, 0.1329f, 0.8123f, 0.9482f },
+    { 4.2966f, 11.5736f, 0.0478f, 0.8168f, 0.952f },
+    { 4.5171f, 11.6051f, 0.0022f, 0.818f, 0.9492f },
+    { 4.6905f, 11.6294f, 0.0768f, 0.8187f, 0.9467f },
+    { 4.825f, 11.6341f, 0.1387f, 0.8194f, 0.9445f },
+    { 4.6101f, 11.0217f, 0.0114f, 0.826f, 0.9499f },
+    { 4.762f, 10.7015f, 0.0856f, 0.8317f, 0.9478f },
+    { 4.9089f, 10.7864f, 0.0022f, 0.8323f, 0.9454f },
+    { 4.4071f, 10.6293f, 0.05f, 0.8309f, 0.9538f },
+    { 4.9287f, 11.6067f, 0.0551f, 0.8206f, 0.9426f },
+    { 5.0656f, 10.6737f, -0.1286f, 0.8329f, 0.9429f },
+    { 5.0409f, 12.3152f, 0.1289f, 0.812f, 0.9397f },
+    { 5.0769f, 11.5697f, -0.0534f, 0.8215f, 0.9404f },
+    { 5.2903f, 12.5178f, 0.1472f, 0.8099f, 0.9363f },
+    { 5.1306f, 12.0898f, 0.0243f, 0.8152f, 0.939f },
+    { 5.3171f, 12.2347f, 0.0132f, 0.8137f, 0.9366f },
+    { 5.345f, 11.5454f, -0.0662f, 0.8216f, 0.937f },
+    { 5.5577f, 12.2536f, 0.1398f, 0.813f, 0.9332f },
+    { 5.5061f, 12.0545f, 0.0447f, 0.8155f, 0.9344f },
+    { 5.7584f, 11.633f, 0.3083f, 0.8189f, 0.9294f },
+    { 5.724f, 11.5616f, 0.1363f, 0.8202f, 0.9313f },
+    { 5.6037f, 11.5405f, 0.002f, 0.821f, 0.9337f },
+    { 5.6583f, 10.7656f, -0.0093f, 0.8291f, 0.9328f },
+    { 5.3842f, 10.7971f, -0.1002f, 0.8298f, 0.9368f },
+    { 5.6388f, 10.211f, -0.0146f, 0.8349f, 0.9317f },
+    { 5.4454f, 10.3373f, -0.0979f, 0.8344f, 0.9352f },
+    { 5.3087f, 10.1703f, -0.1107f, 0.8368f, 0.936f },
+    { 5.5229f, 9.8944f, -0.0222f, 0.8385f, 0.9316f },
+    { 5.4091f, 9.7561f, -0.0137f, 0.8408f, 0.9315f },
+    { 5.2375f, 9.9888f, -0.084f, 0.8394f, 0.9353f },
+    { 5.1962f, 9.8317f, -0.0056f, 0.8423f, 0.934f },
+    { 5.0491f, 10.1962f, -0.0685f, 0.8375f, 0.9396f },
+    { 5.0801f, 9.9805f, 0.0074f, 0.8422f, 0.9363f },
+    { 3.5983f, -8.8419f, 4.2353f, 0.8903f, 0.5235f },
+    { 3.6526f, -8.6959f, 4.4355f, 0.8871f, 0.5228f },
+    { 3.3438f, -8.8723f, 4.3502f, 0.8894f, 0.5272f },
+    { 3.1788f, -8.9167f, 4.5777f, 0.8869f, 0.5299f },
+    { 3.4679f, -8.7498f, 4.4716f, 0.8872f, 0.5254f },
+    { 3.4138f, -8.713f, 4.6363f, 0.8851f, 0.5262f },
+    { 3.1091f, -8.938f, 4.8583f, 0.8833f, 0.5313f },
+    { 3.0389f, 13.4441f, 21.2528f, 0.5709f, 0.7984f },
+    { 2.4463f, 13.5754f, 21.6278f, 0.5624f, 0.8027f },
+    { 3.1694f, 13.0933f, 21.9117f, 0.5645f, 0.7906f },
+    { 3.6875f, 13.2643f, 20.7998f, 0.5806f, 0.7939f },
+    { 2.6177f, 13.7671f, 20.6544f, 0.5755f, 0.8079f },
+    { 2.5823f, 13.3042f, 22.1975f, 0.5566f, 0.7957f },
+    { 3.8334f, 12.8372f, 21.5433f, 0.5738f, 0.7851f },
+    { 1.9646f, 13.695f, 21.8913f, 0.5559f, 0.8068f },
+    { 3.0144f, 12.6934f, 22.673f, 0.5558f, 0.783f },
+    { 2.0876f, 13.8199f, 21.0215f, 0.5679f, 0.8113f },
+    { 2.1214f, 13.5052f, 22.3858f, 0.5507f, 0.8006f },
+    { 2.2336f, 13.9551f, 20.3098f, 0.5775f, 0.8146f },
+    { 1.6276f, 13.8682f, 21.3102f, 0.5619f, 0.8146f },
+    { 3.1214f, 13.6973f, 20.2286f, 0.5836f, 0.8051f },
+    { 1.7573f, 14.0202f, 20.4264f, 0.5735f, 0.819f },
+    { 2.3795f, 14.0307f, 19.9015f, 0.583f, 0.8158f },
+    { 1.7064f, 14.1589f, 19.8901f, 0.5794f, 0.8233f },
+    { 1.1506f, 14.0008f, 20.6888f, 0.5677f, 0.8239f },
+    { 1.0938f, 14.1204f, 19.9966f, 0.575f, 0.8293f },
+    { 1.0991f, 14.1484f, 19.3233f, 0.5821f, 0.834f },
+    { 0.5202f, 13.95f, 19.3138f, 0.5789f, 0.8411f },
+    { 0.5336f, 13.9537f, 20.0227f, 0.5719f, 0.8358f },
+    { 0.5313f, 13.8761f, 20.595f, 0.5665f, 0.8318f },
+    { -0.0003f, 13.8383f, 20.0157f, 0.5696f, 0.8426f },
+    { -0.0003f, 13.813f, 19.3012f, 0.5758f, 0.848f },
+    { -0.0003f, 13.7809f, 20.5947f, 0.5634f, 0.8373f },
+    { -0.0003f, 13.6363f, 18.5492f, 0.5838f, 0.8536f },
+    { -0.0003f, 13.7095f, 20.9402f, 0.5623f, 0.8359f },
+    { 0.5294f, 13.4813f, 17.8228f, 0.5948f, 0.8524f },
+    { -0.0003f, 13.3477f, 17.8407f, 0.5918f, 0.8593f },
+    { 0.4777f, 13.8055f, 20.9478f, 0.5632f, 0.83f },
+    { -0.0003f, 13.6841f, 21.1754f, 0.5613f, 0.8345f },
+    { 0.459f, 13.7801f, 21.2063f, 0.5606f, 0.8288f },
+    { -0.0003f, 13.7652f, 21.4233f, 0.5597f, 0.8335f },
+    { 0.9307f, 13.9312f, 21.0935f, 0.5623f, 0.8239f },
+    { 1.3339f, 13.9244f, 21.5004f, 0.5581f, 0.8172f },
+    { 0.8142f, 13.8899f, 21.2816f, 0.5599f, 0.8244f },
+    { 1.6485f, 13.8398f, 22.0095f, 0.5524f, 0.8107f },
+    { 1.0356f, 13.933f, 21.5698f, 0.5566f, 0.8206f },
+    { 1.3235f, 14.0824f, 21.9726f, 0.5509f, 0.8168f },
+    { 0.5615f, 13.8384f, 21.496f, 0.5576f, 0.8265f },
+    { -0.0003f, 14.0549f, 21.559f, 0.558f, 0.8325f },
+    { 0.6533f, 14.0989f, 21.6692f, 0.5547f, 0.8262f },
+    { -0.0003f, 14.6554f, 21.4572f, 0.5577f, 0.8375f },
+    { 0.6025f, 14.6805f, 21.5782f, 0.5526f, 0.8311f },
+    { -0.0003f, 15.4936f, 21.2115f, 0.5574f, 0.8424f },
+    { 1.1153f, 14.7282f, 21.8622f, 0.5475f, 0.8255f },
+    { 0.5166f, 15.5091f, 21.3276f, 0.5513f, 0.8402f },
+    { 0.5036f, 16.5107f, 21.0219f, 0.5503f, 0.8522f },
+    { -0.0003f, 16.4965f, 20.9155f, 0.557f, 0.8549f },
+    { 0.9716f, 15.5559f, 21.6035f, 0.5452f, 0.8365f },
+    { 0.4836f, 17.5789f, 20.7219f, 0.5499f, 0.8656f },
+    { -0.0003f, 17.5626f, 20.6271f, 0.5565f, 0.8674f },
+    { -0.0003f, 18.5905f, 20.4041f, 0.5555f, 0.8802f },
+    { 0.377f, 18.6074f, 20.4887f, 0.5502f, 0.8791f },
+    { -0.0003f, 19.6043f, 20.2235f, 0.5545f, 0.893f },
+    { 0.9027f, 17.6175f, 20.9858f, 0.5434f, 0.8636f },
+    { 0.9414f, 16.5538f, 21.2929f, 0.5438f, 0.8496f },
+    { 1.192f, 17.668f, 21.3983f, 0.5369f, 0.8614f },
+    { 1.247f, 16.6262f, 21.6808f, 0.5375f, 0.8472f },
+    { 0.7336f, 18.6425f, 20.7373f, 0.5444f, 0.8776f },
+    { 1.2954f, 17.7346f, 21.8857f, 0.5302f, 0.8594f },
+    { 0.2808f, 19.6187f, 20.3017f, 0.5503f, 0.8926f },
+    { 1.0488f, 18.6806f, 21.1442f, 0.5377f, 0.8755f },
+    { 0.5827f, 19.6509f, 20.5356f, 0.5452f, 0.8914f },
+    { 0.292f, 20.6356f, 20.14f, 0.5493f, 0.9065f },
+    { -0.0003f, 20.6278f, 20.0624f, 0.5536f, 0.9076f },
+    { 0.5986f, 20.6644f, 20.3691f, 0.5442f, 0.9052f },
+    { 0.3346f, 21.6518f, 19.9999f, 0.5473f, 0.9205f },
+    { -0.0003f, 21.6511f, 19.9227f, 0.5528f, 0.9221f },
+    { -0.0003f, 22.6642f, 19.8065f, 0.5487f, 0.9366f },
+    { 0.6617f, 21.68f, 20.225f, 0.5421f, 0.919f },
+    { 0.3323f, 22.6614f, 19.8775f, 0.5444f, 0.9347f },
+    { -0.0003f, 23.5865f, 19.6999f, 0.5447f, 0.9511f },
+    { 0.9731f, 21.7613f, 20.5915f, 0.5357f, 0.9175f },
+    { 0.6523f, 22.6943f, 20.0904f, 0.5395f, 0.9329f },
+    { 0.3101f, 23.5824f, 19.7639f, 0.5407f, 0.9476f },
+    { 0.2933f, 24.3334f, 19.65f, 0.5365f, 0.9581f },
+    { -0.0003f, 24.3372f, 19.5892f, 0.5398f, 0.9607f },
+    { 0.6073f, 23.6209f, 19.9621f, 0.5363f, 0.9456f },
+    { 0.2636f, 24.9753f, 19.5648f, 0.5316f, 0.9667f },
+    { -0.0003f, 24.9852f, 19.506f, 0.5349f, 0.9703f },
+    { 0.5637f, 24.3735f, 19.8367f, 0.5327f, 0.9559f },
+    { 0.4967f, 25.0095f, 19.7351f, 0.5284f, 0.9643f },
+    { 0.2029f, 25.5689f, 19.5373f, 0.5255f, 0.9738f },
+    { -0.0003f, 25.5994f, 19.4818f, 0.5267f, 0.9767f },
+    { 0.3813f, 25.5863f, 19.6782f, 0.5233f, 0.9716f },
+    { 0.1556f, 26.084f, 19.5666f, 0.5189f, 0.9788f },
+    { -0.0003f, 26.1381f, 19.5143f, 0.5186f, 0.9832f },
+    { -0.0003f, 26.5594f, 19.6012f, 0.5108f, 0.9838f },
+    { 0.2899f, 25.9796f, 19.6607f, 0.5192f, 0.976f },
+    { 0.1659f, 26.4902f, 19.6515f, 0.5126f, 0.981f },
+    { 0.3351f, 26.2386f, 19.7587f, 0.5152f, 0.977f },
+    { 0.5099f, 25.7606f, 19.8785f, 0.5195f, 0.9707f },
+    { 0.1958f, 26.7157f, 19.8431f, 0.5079f, 0.9802f },
+    { 0.3886f, 26.4481f, 19.9526f, 0.5112f, 0.9764f },
+    { -0.0003f, 26.7635f, 20.1911f, 0.5031f, 0.977f },
+    { 0.2071f, 26.6887f, 20.1921f, 0.5061f, 0.9762f },
+    { -0.0003f, 26.5314f, 20.6195f, 0.5031f, 0.9709f },
+    { -0.0003f, 26.1523f, 20.9529f, 0.5031f, 0.9648f },
+    { 0.2541f, 26.1042f, 20.8854f, 0.5065f, 0.9649f },
+    { -0.0003f, 25.6551f, 21.2255f, 0.5031f, 0.9583f },
+    { 0.2198f, 26.466f, 20.5793f, 0.506f, 0.9706f },
+    { 0.2974f, 25.6232f, 21.1437f, 0.5072f, 0.9586f },
+    { -0.0003f, 25.0688f, 21.4716f, 0.5031f, 0.951f },
+    { 0.5475f, 25.5489f, 20.9408f, 0.5113f, 0.9593f },
+    { -0.3379f, 25.0428f, 21.3875f, 0.4984f, 0.9512f },
+    { 0.3372f, 25.0428f, 21.3875f, 0.5078f, 0.9512f },
+    { -0.0003f, 24.3154f, 21.7187f, 0.5031f, 0.9416f },
+    { -0.369f, 24.2895f, 21.6361f, 0.498f, 0.9417f },
+    { 0.3683f, 24.2895f, 21.6361f, 0.5082f, 0.9417f },
+    { -0.0003f, 23.3171f, 21.9944f, 0.5031f, 0.9288f },
+    { -0.6953f, 24.2122f, 21.4172f, 0.4928f, 0.9421f },
+    { -0.3864f, 23.2897f, 21.9087f, 0.4977f, 0.9289f },
+    { -0.9369f, 24.0839f, 21.0906f, 0.4874f, 0.9425f },
+    { -0.7331f, 23.2134f, 21.6718f, 0.492f, 0.9292f },
+    { -1.0012f, 23.094f, 21.3039f, 0.4859f, 0.9297f },
+    { -0.7688f, 22.0946f, 21.9153f, 0.4912f, 0.9146f },
+    { -0.4062f, 22.1679f, 22.1747f, 0.4973f, 0.9144f },
+    { -0.8274f, 20.9802f, 22.1231f, 0.4901f, 0.9f },
+    { -0.0003f, 22.1967f, 22.2676f, 0.5031f, 0.9143f },
+    { -0.4448f, 21.0486f, 22.4036f, 0.4967f, 0.8996f },
+    { -0.8725f, 19.9036f, 22.3237f, 0.4894f, 0.8855f },
+    { -0.8676f, 18.8983f, 22.5455f, 0.4895f, 0.8714f },
+    { -0.4742f, 19.9693f, 22.6175f, 0.4963f, 0.885f },
+    { -0.8503f, 17.9108f, 22.7973f, 0.4899f, 0.8572f },
+    { -0.4665f, 18.9675f, 22.8385f, 0.4963f, 0.871f },
+    { -0.4489f, 17.9826f, 23.0871f, 0.4966f, 0.8568f },
+    { -0.0003f, 18.998f, 22.9522f, 0.5031f, 0.8709f },
+    { -0.0003f, 18.0142f, 23.1988f, 0.5031f, 0.8567f },
+    { -0.0003f, 19.9981f, 22.7299f, 0.5031f, 0.8849f },
+    { -0.0003f, 21.0773f, 22.5072f, 0.5031f, 0.8995f },
+    { 0.4735f, 19.9693f, 22.6175f, 0.5099f, 0.885f },
+    { 0.4658f, 18.9675f, 22.8385f, 0.5098f, 0.871f },
+    { 0.4441f, 21.0486f, 22.4036f, 0.5095f, 0.8996f },
+    { 0.8718f, 19.9036f, 22.3237f, 0.5168f, 0.8854f },
+    { 0.4055f, 22.1679f, 22.1747f, 0.5089f, 0.9144f },
+    { 0.8267f, 20.9802f, 22.1231f, 0.5161f, 0.8999f },
+    { 0.3857f, 23.2897f, 21.9087f, 0.5085f, 0.9289f },
+    { 0.7324f, 23.2134f, 21.6718f, 0.5142f, 0.9292f },
+    { 0.6946f, 24.2122f, 21.4172f, 0.5134f, 0.942f },
+    { 0.6297f, 24.9663f, 21.176f, 0.5125f, 0.9517f },
+    { 0.9362f, 24.0839f, 21.0906f, 0.5188f, 0.9425f },
+    { 0.832f, 24.8411f, 20.8777f, 0.5172f, 0.9524f },
+    { 0.7022f, 25.4539f, 20.6593f, 0.5152f, 0.9604f },
+    { 1.0213f, 23.9241f, 20.7031f, 0.5246f, 0.9431f },
+    { 0.4581f, 26.0326f, 20.704f, 0.5097f, 0.9657f },
+    { 0.3652f, 26.3298f, 20.5152f, 0.5083f, 0.97f },
+    { 0.5612f, 26.0106f, 20.4296f, 0.5124f, 0.9678f },
+    { 0.3993f, 26.4444f, 20.2526f, 0.5092f, 0.9734f },
+    { 0.5746f, 25.9494f, 20.1314f, 0.5153f, 0.9698f },
+    { 0.7472f, 25.3257f, 20.3366f, 0.5193f, 0.9617f },
+    { 0.6683f, 25.152f, 20.0105f, 0.524f, 0.9629f },
+    { 0.788f, 24.5087f, 20.1537f, 0.5277f, 0.9543f },
+    { 0.8996f, 24.6831f, 20.5258f, 0.5222f, 0.9532f },
+    { 0.878f, 23.7523f, 20.301f, 0.5307f, 0.9441f },
+    { 0.9471f, 22.8044f, 20.4451f, 0.5334f, 0.9315f },
+    { 1.1016f, 22.9511f, 20.8725f, 0.5268f, 0.9304f },
+    { 1.1426f, 21.8724f, 21.0393f, 0.5287f, 0.9163f },
+    { 1.0005f, 23.094f, 21.3039f, 0.5203f, 0.9296f },
+    { 1.044f, 21.9898f, 21.5087f, 0.5217f, 0.9153f },
+    { 0.7681f, 22.0946f, 21.9153f, 0.515f, 0.9146f },
+    { 1.0856f, 20.8897f, 21.6963f, 0.523f, 0.9007f },
+    { 1.1461f, 20.7964f, 21.2087f, 0.5302f, 0.902f },
+    { 1.119f, 19.8214f, 21.8919f, 0.5237f, 0.8863f },
+    { 0.8669f, 18.8983f, 22.5455f, 0.5166f, 0.8714f },
+    { 1.1566f, 19.7432f, 21.3996f, 0.5309f, 0.8877f },
+    { 0.4482f, 17.9826f, 23.0871f, 0.5096f, 0.8568f },
+    { 1.1376f, 18.8132f, 22.1208f, 0.5235f, 0.8722f },
+    { 0.8496f, 17.9108f, 22.7973f, 0.5163f, 0.8572f },
+    { -0.0003f, 16.9837f, 23.4948f, 0.5031f, 0.8416f },
+    { 0.4477f, 16.9543f, 23.3838f, 0.5097f, 0.8417f },
+    { -0.4484f, 16.9543f, 23.3838f, 0.4965f, 0.8417f },
+    { -0.0003f, 15.9468f, 23.8069f, 0.5031f, 0.8262f },
+    { -0.8583f, 16.8874f, 23.088f, 0.4896f, 0.8422f },
+    { -0.4854f, 15.9221f, 23.6942f, 0.4958f, 0.8264f },
+    { -1.1918f, 16.8044f, 22.6444f, 0.4823f, 0.8434f },
+    { -1.2715f, 15.8005f, 22.9207f, 0.4806f, 0.8289f },
+    { -0.9245f, 15.867f, 23.3881f, 0.4884f, 0.8272f },
+    { -1.4261f, 14.85f, 23.1934f, 0.4776f, 0.815f },
+    { -1.0818f, 14.8887f, 23.6681f, 0.4858f, 0.8129f },
+    { -1.2552f, 14.0486f, 23.9049f, 0.4831f, 0.8006f },
+    { -1.3693f, 13.443f, 24.0751f, 0.4817f, 0.7917f },
+    { -0.6847f, 14.0638f, 24.2319f, 0.4929f, 0.7993f },
+    { -0.5804f, 14.9257f, 23.9841f, 0.4944f, 0.8118f },
+    { -0.0003f, 14.9438f, 24.1025f, 0.5031f, 0.8116f },
+    { -0.0003f, 14.0765f, 24.3543f, 0.5031f, 0.799f },
+    { 0.4847f, 15.9221f, 23.6942f, 0.5103f, 0.8264f },
+    { 0.5797f, 14.9257f, 23.9841f, 0.5118f, 0.8118f },
+    { 0.8576f, 16.8874f, 23.088f, 0.5165f, 0.8422f },
+    { 0.9238f, 15.867f, 23.3881f, 0.5178f, 0.8272f },
+    { 1.1912f, 16.8044f, 22.6444f, 0.5239f, 0.8434f },
+    { 1.2708f, 15.8005f, 22.9207f, 0.5256f, 0.8289f },
+    { 1.0811f, 14.8887f, 23.6681f, 0.5203f, 0.8128f },
+    { 0.684f, 14.0638f, 24.2319f, 0.5133f, 0.7993f },
+    { 1.4254f, 14.85f, 23.1934f, 0.5285f, 0.815f },
+    { 1.2545f, 14.0486f, 23.9049f, 0.523f, 0.8006f },
+    { 1.3686f, 13.443f, 24.0751f, 0.5244f, 0.7916f },
+    { 1.4293f, 15.7228f, 22.4081f, 0.533f, 0.8311f },
+    { 1.5973f, 14.0537f, 23.4133f, 0.5317f, 0.8033f },
+    { 1.5639f, 14.8104f, 22.6754f, 0.536f, 0.8179f },
+    { 1.3027f, 15.6342f, 21.9663f, 0.5393f, 0.8336f },
+    { 1.7225f, 14.0758f, 22.8767f, 0.5391f, 0.807f },
+    { 1.3528f, 16.7143f, 22.1448f, 0.5311f, 0.8451f },
+    { 1.4481f, 14.7707f, 22.2298f, 0.5421f, 0.8212f },
+    { 1.1566f, 17.8219f, 22.3744f, 0.5232f, 0.858f },
+    { 1.2182f, 18.7335f, 21.6313f, 0.5305f, 0.8735f },
+    { 0.9262f, 19.6894f, 20.9246f, 0.5384f, 0.8896f },
+    { 0.9336f, 20.7197f, 20.7458f, 0.5376f, 0.9036f },
+    { 2.0966f, 13.3013f, 22.9139f, 0.5445f, 0.7949f },
+    { 2.4851f, 12.9945f, 22.8375f, 0.5492f, 0.7891f },
+    { 1.836f, 13.7319f, 22.4621f, 0.5473f, 0.8051f },
+    { 1.6402f, 14.1113f, 22.4142f, 0.545f, 0.8113f },
+    { 1.8713f, 13.6172f, 22.9416f, 0.5415f, 0.8001f },
+    { 1.7291f, 13.5123f, 23.5314f, 0.5337f, 0.7953f },
+    { 1.8887f, 13.0859f, 23.5959f, 0.5357f, 0.7887f },
+    { 2.144f, 12.6346f, 23.6548f, 0.5385f, 0.7813f },
+    { 1.4654f, 12.9283f, 24.2206f, 0.5254f, 0.7839f },
+    { 0.749f, 13.4351f, 24.4159f, 0.514f, 0.7901f },
+    { -0.0003f, 13.4466f, 24.5356f, 0.5031f, 0.7898f },
+    { 0.7945f, 12.8979f, 24.5773f, 0.5144f, 0.7821f },
+    { -0.7496f, 13.4351f, 24.4159f, 0.4921f, 0.7901f },
+    { -0.0003f, 12.9146f, 24.6885f, 0.5031f, 0.7821f },
+    { -1.4661f, 12.9283f, 24.2206f, 0.4808f, 0.7839f },
+    { -0.7952f, 12.8979f, 24.5773f, 0.4918f, 0.7822f },
+    { -0.8411f, 12.3104f, 24.7571f, 0.4915f, 0.7734f },
+    { -0.0003f, 12.3408f, 24.8552f, 0.5031f, 0.7736f },
+    { -0.8966f, 11.6545f, 24.951f, 0.4912f, 0.7637f },
+    { -0.0003f, 11.6997f, 25.0365f, 0.5031f, 0.7641f },
+    { 0.8404f, 12.3104f, 24.7571f, 0.5146f, 0.7734f },
+    { 1.5867f, 12.361f, 24.3834f, 0.5264f, 0.7752f },
+    { 0.8959f, 11.6545f, 24.951f, 0.5149f, 0.7637f },
+    { 2.5792f, 12.2228f, 23.5785f, 0.5438f, 0.7744f },
+    { 1.8954f, 11.6434f, 24.5455f, 0.5294f, 0.7642f },
+    { 3.6625f, 12.3946f, 22.3815f, 0.5644f, 0.7773f },
+    { 3.2785f, 11.9149f, 23.2369f, 0.5536f, 0.7691f },
+    { 4.4351f, 12.3151f, 21.2596f, 0.5823f, 0.7768f },
+    { 4.2522f, 11.8828f, 22.1554f, 0.5723f, 0.7692f },
+    { 4.8354f, 11.3061f, 21.2282f, 0.5879f, 0.7632f },
+    { 4.6066f, 10.9426f, 22.1872f, 0.5769f, 0.7563f },
+    { 5.0738f, 10.014f, 21.3221f, 0.5918f, 0.7465f },
+    { 4.802f, 9.7632f, 22.3377f, 0.5796f, 0.7407f },
+    { 4.915f, 8.534f, 22.4673f, 0.5819f, 0.7244f },
+    { 4.2862f, 10.6704f, 23.018f, 0.5667f, 0.7511f },
+    { 4.4374f, 9.6457f, 23.2459f, 0.568f, 0.7371f },
+    { 4.5382f, 8.5486f, 23.419f, 0.5694f, 0.7223f },
+    { 4.5895f, 7.4381f, 23.5295f, 0.5708f, 0.7074f },
+    { 3.89f, 9.6591f, 24.0258f, 0.556f, 0.7359f },
+    { 4.0354f, 6.5856f, 24.4521f, 0.5587f, 0.6939f },
+    { 3.9905f, 8.6783f, 24.2325f, 0.5569f, 0.7223f },
+    { 4.0457f, 7.6412f, 24.3722f, 0.5579f, 0.7082f },
+    { 3.2893f, 7.9392f, 25.0375f, 0.5451f, 0.711f },
+    { 3.2033f, 8.9154f, 24.8713f, 0.544f, 0.7246f },
+    { 3.0699f, 9.8012f, 24.6562f, 0.5429f, 0.7371f },
+    { 2.2359f, 9.1652f, 25.3213f, 0.5307f, 0.7275f },
+    { 2.0883f, 9.9853f, 25.1105f, 0.5294f, 0.7394f },
+    { 2.9304f, 10.6245f, 24.391f, 0.5424f, 0.7491f },
+    { 1.9456f, 10.7868f, 24.8851f, 0.5284f, 0.7512f },
+    { 3.7641f, 10.5457f, 23.7446f, 0.5558f, 0.7484f },
+    { 3.57f, 11.1387f, 23.5491f, 0.5547f, 0.7571f },
+    { 2.9461f, 11.3432f, 23.9574f, 0.5451f, 0.76f },
+    { 3.946f, 11.4758f, 22.945f, 0.5629f, 0.7624f },
+    { 0.9703f, 10.9122f, 25.1545f, 0.5155f, 0.7527f },
+    { 1.0565f, 10.1246f, 25.3622f, 0.5162f, 0.7411f },
+    { -0.0003f, 10.9657f, 25.2331f, 0.5031f, 0.7533f },
+    { -0.9709f, 10.9122f, 25.1545f, 0.4907f, 0.7527f },
+    { -1.9463f, 10.7868f, 24.8851f, 0.4777f, 0.7513f },
+    { 3.287f, 6.8447f, 25.1558f, 0.5456f, 0.696f },
+    { 3.2119f, 5.6579f, 25.2226f, 0.5457f, 0.6797f },
+    { 3.9483f, 11.7775f, 4.4105f, 0.8061f, 0.8616f },
+    { 3.4011f, 11.8823f, 4.4059f, 0.8123f, 0.8557f },
+    { 2.9129f, 12.168f, 5.175f, 0.8108f, 0.8424f },
+    { 3.3579f, 11.859f, 5.1277f, 0.8046f, 0.8483f },
+    { 4.4442f, 11.8577f, 5.1308f, 0.7924f, 0.8594f },
+    { 3.9061f, 11.7672f, 5.1185f, 0.7986f, 0.8539f },
+    { 4.8874f, 12.1094f, 5.1621f, 0.7864f, 0.8646f },
+    { 4.3573f, 11.8051f, 5.8847f, 0.785f, 0.8504f },
+    { 5.1505f, 12.5011f, 5.2095f, 0.7808f, 0.8695f },
+    { 5.0749f, 12.4856f, 6.0611f, 0.7726f, 0.86f },
+    { 4.7821f, 12.0522f, 5.9569f, 0.7789f, 0.855f },
+    { 5.0861f, 12.4015f, 6.5981f, 0.7674f, 0.8535f },
+    { 4.7653f, 11.9756f, 6.4598f, 0.7738f, 0.8488f },
+    { 4.3298f, 11.7409f, 6.3587f, 0.78f, 0.8446f },
+    { 3.805f, 11.5896f, 6.6151f, 0.7828f, 0.8363f },
+    { 3.821f, 11.6739f, 6.3135f, 0.786f, 0.8402f },
+    { 3.8489f, 11.7294f, 5.8557f, 0.7909f, 0.8457f },
+    { 3.2665f, 11.6695f, 6.6509f, 0.7889f, 0.8315f },
+    { 3.3052f, 11.8105f, 5.881f, 0.7967f, 0.8404f },
+    { 3.2806f, 11.7509f, 6.3428f, 0.792f, 0.8353f },
+    { 2.8549f, 12.1157f, 5.9728f, 0.803f, 0.8346f },
+    { 2.8234f, 12.0494f, 6.4586f, 0.7985f, 0.8296f },
+    { 2.8061f, 11.9588f, 6.7884f, 0.7955f, 0.8259f },
+    { 2.5645f, 12.6466f, 6.6728f, 0.8062f, 0.823f },
+    { 2.5184f, 12.5297f, 7.0336f, 0.8034f, 0.8195f },
+    { 2.7911f, 11.834f, 7.1182f, 0.7926f, 0.8222f },
+    { 3.2455f, 11.5552f, 6.9432f, 0.7862f, 0.8277f },
+    { 2.5085f, 12.3612f, 7.3921f, 0.8003f, 0.8161f },
+    { 2.4202f, 13.1583f, 7.2984f, 0.8123f, 0.8123f },
+    { 2.4997f, 13.3208f, 6.9105f, 0.8146f, 0.8159f },
+    { 2.6264f, 12.7128f, 6.1428f, 0.8103f, 0.828f },
+    { 2.5926f, 13.3982f, 6.3351f, 0.8169f, 0.8195f },
+    { 2.6841f, 12.729f, 5.277f, 0.8172f, 0.8361f },
+    { 3.3255f, 14.01f, 9.3253f, 0.7117f, 0.8683f },
+    { 2.9809f, 13.7747f, 9.1135f, 0.7093f, 0.875f },
+    { 3.2781f, 13.6603f, 10.1472f, 0.7021f, 0.8622f },
+    { 3.7678f, 13.7303f, 10.2014f, 0.7056f, 0.8558f },
+    { 3.4016f, 14.3139f, 8.9435f, 0.7172f, 0.8709f },
+    { 3.8057f, 14.0426f, 9.3755f, 0.7155f, 0.862f },
+    { 3.744f, 13.485f, 11.2192f, 0.6937f, 0.8485f },
+    { 4.2593f, 13.607f, 10.1431f, 0.7103f, 0.8495f },
+    { 4.2626f, 13.3532f, 11.1917f, 0.698f, 0.8415f },
+    { 3.2494f, 13.3976f, 11.172f, 0.6905f, 0.8548f },
+    { 2.9086f, 13.4512f, 9.9636f, 0.7001f, 0.8687f },
+    { 3.1092f, 14.1413f, 8.7486f, 0.7152f, 0.8764f },
+    { 2.9302f, 13.9927f, 8.4628f, 0.7151f, 0.8814f },
+    { 3.4547f, 14.5664f, 8.7506f, 0.7203f, 0.8723f },
+    { 2.8576f, 14.068f, 8.1466f, 0.7174f, 0.885f },
+    { 3.022f, 14.4066f, 8.2304f, 0.7199f, 0.8816f },
+    { 3.0535f, 14.2875f, 8.431f, 0.7179f, 0.8798f },
+    { 3.2057f, 14.4611f, 8.5935f, 0.7189f, 0.8764f },
+    { 3.8244f, 14.5406f, 8.7855f, 0.7228f, 0.8681f },
+    { 3.8146f, 14.3107f, 8.987f, 0.7203f, 0.8657f },
+    { 4.2611f, 13.9012f, 9.2888f, 0.7202f, 0.8566f },
+    { 4.7413f, 12.8932f, 11.1023f, 0.7033f, 0.8332f },
+    { 4.8454f, 12.6334f, 12.1154f, 0.692f, 0.824f },
+    { 5.1155f, 12.2048f, 10.9556f, 0.7094f, 0.8241f },
+    { 3.5941f, 10.983f, -0.0377f, 0.8214f, 0.9631f },
+    { 3.3602f, 11.0759f, -0.0362f, 0.8193f, 0.9658f },
+    { 3.6787f, 11.4894f, 0.1088f, 0.8144f, 0.9597f },
+    { 3.8677f, 11.2985f, 0.057f, 0.8179f, 0.9582f },
+    { 4.0673f, 11.4873f, 0.103f, 0.8164f, 0.955f },
+    { 3.8598f, 10.9162f, -0.057f, 0.8236f, 0.9601f },
+    { 4.361f, 11.055f, -0.0595f, 0.8242f, 0.9533f },
+    { 4.1279f, 10.9833f, -0.0471f, 0.824f, 0.9565f },
+    { 4.5076f, 11.1937f, -0.0331f, 0.8232f, 0.9508f },
+    { 4.3972f, 10.7807f, -0.01f, 0.8284f, 0.9538f },
+    { 4.0813f, 10.5593f, 0.0839f, 0.8302f, 0.9598f },
+    { 4.1254f, 10.7359f, -0.0084f, 0.828f, 0.9577f },
+    { 3.8829f, 10.5446f, 0.1012f, 0.8295f, 0.9619f },
+    { 3.868f, 10.7167f, -0.0049f, 0.8271f, 0.9612f },
+    { 3.6713f, 10.5523f, 0.0962f, 0.8287f, 0.964f },
+    { 3.6028f, 10.7299f, 0.0029f, 0.8256f, 0.9645f },
+    { 3.2835f, 10.6172f, 0.0791f, 0.8261f, 0.9701f },
+    { 3.3073f, 10.7827f, 0.0172f, 0.8234f, 0.9682f },
+    { 2.8818f, 10.6869f, 0.1282f, 0.8234f, 0.9763f },
+    { 3.084f, 11.0329f, 0.0485f, 0.8188f, 0.9702f },
+    { 3.2079f, 11.2185f, -0.0033f, 0.8168f, 0.9674f },
+    { 2.6664f, -22.045f, 32.7682f, 0.1046f, 0.1323f },
+    { 2.8081f, -21.9612f, 32.7774f, 0.1173f, 0.1339f },
+    { 2.638f, -22.0696f, 32.8595f, 0.1015f, 0.139f },
+    { 2.4649f, -22.1216f, 32.8619f, 0.0879f, 0.1384f },
+    { 2.8257f, -21.941f, 32.7152f, 0.1194f, 0.1292f },
+    { 2.4277f, -22.1325f, 32.9759f, 0.0845f, 0.1465f },
+    { 2.7764f, -21.9896f, 32.8592f, 0.1138f, 0.1399f },
+    { 2.5977f, -22.0924f, 32.9699f, 0.0975f, 0.147f },
+    { 2.2592f, -22.1438f, 32.9745f, 0.0722f, 0.1456f },
+    { 2.3853f, -22.1374f, 33.1057f, 0.0807f, 0.1558f },
+    { 2.2238f, -22.1414f, 33.0969f, 0.0691f, 0.1542f },
+    { 2.2847f, -22.141f, 32.8679f, 0.0745f, 0.1381f },
+    { 2.1274f, -22.1285f, 32.9658f, 0.0627f, 0.1445f },
+    { 2.4897f, -22.1055f, 32.7681f, 0.0904f, 0.1315f },
+    { 2.1253f, -22.1234f, 32.8789f, 0.0629f, 0.1383f },
+    { 2.6769f, -22.0227f, 32.7005f, 0.1063f, 0.1272f },
+    { 2.2977f, -22.1314f, 32.7797f, 0.0758f, 0.1317f },
+    { 2.4951f, -22.0851f, 32.6988f, 0.0915f, 0.1263f },
+    { 2.6789f, -22.0143f, 32.658f, 0.1082f, 0.1222f },
+    { 2.8345f, -21.9364f, 32.6753f, 0.1209f, 0.1252f },
+    { 2.4927f, -22.0755f, 32.6555f, 0.0918f, 0.1219f },
+    { 2.9468f, -21.8583f, 32.6977f, 0.1337f, 0.1282f },
+    { 2.2957f, -22.1135f, 32.7126f, 0.076f, 0.1267f },
+    { 2.2894f, -22.1044f, 32.6696f, 0.0753f, 0.1215f },
+    { 2.1102f, -22.1116f, 32.8059f, 0.062f, 0.133f },
+    { 2.094f, -22.0934f, 32.7447f, 0.0609f, 0.1285f },
+    { 2.0823f, -22.0849f, 32.7026f, 0.0597f, 0.1244f },
+    { 1.927f, -22.0558f, 32.7903f, 0.0487f, 0.1314f },
+    { 1.907f, -22.0466f, 32.7491f, 0.044f, 0.1272f },
+    { 1.9603f, -22.0765f, 32.8466f, 0.0511f, 0.1355f },
+    { 1.8315f, -22.0315f, 32.8447f, 0.0418f, 0.135f },
+    { 1.7989f, -22.0192f, 32.8037f, 0.0385f, 0.1312f },
+    { 1.8813f, -22.0566f, 32.9015f, 0.0453f, 0.1391f },
+    { 1.7854f, -22.016f, 32.9045f, 0.0384f, 0.139f },
+    { 1.7455f, -22.0037f, 32.8649f, 0.0329f, 0.1351f },
+    { 1.843f, -22.0419f, 32.9621f, 0.0424f, 0.1431f },
+    { 1.7662f, -22.0049f, 32.9665f, 0.0367f, 0.1431f },
+    { 1.7345f, -22.0012f, 32.9309f, 0.0338f, 0.1398f },
+    { 1.7452f, -22.0087f, 32.9762f, 0.0348f, 0.1445f },
+    { 1.7629f, -22.0056f, 33.0132f, 0.0359f, 0.1473f },
+    { 1.7992f, -22.013f, 33.0616f, 0.0369f, 0.1501f },
+    { 1.8152f, -22.0222f, 33.0199f, 0.0399f, 0.1469f },
+    { 1.875f, -22.0444f, 33.0866f, 0.0439f, 0.1517f },
+    { 1.8525f, -22.0311f, 33.1239f, 0.041f, 0.155f },
+    { 1.9071f, -22.067f, 33.0308f, 0.0467f, 0.1481f },
+    { 1.9486f, -22.0696f, 33.1615f, 0.0488f, 0.1573f },
+    { 1.9248f, -22.0563f, 33.1987f, 0.045f, 0.16f },
+    { 1.9816f, -22.0916f, 33.1018f, 0.0517f, 0.1533f },
+    { 1.9412f, -22.0797f, 32.9643f, 0.0495f, 0.1436f },
+    { 2.0704f, -22.1158f, 33.1665f, 0.0577f, 0.1583f },
+    { 2.0048f, -22.0945f, 32.9071f, 0.0542f, 0.1399f },
+    { 2.0145f, -22.1023f, 33.0233f, 0.0545f, 0.148f },
+    { 2.0462f, -22.108f, 32.9636f, 0.0569f, 0.144f },
+    { 2.1044f, -22.1263f, 33.0685f, 0.0607f, 0.1516f },
+    { 2.1871f, -22.1332f, 33.2131f, 0.0658f, 0.1622f },
+    { 2.0391f, -22.0961f, 33.2395f, 0.0548f, 0.1632f },
+    { 2.0177f, -22.0853f, 33.2844f, 0.052f, 0.1672f },
+    { 2.1577f, -22.1188f, 33.3008f, 0.063f, 0.1682f },
+    { 2.1394f, -22.1131f, 33.3554f, 0.059f, 0.1744f },
+    { 2.3453f, -22.1372f, 33.2295f, 0.077f, 0.1645f },
+    { 2.3155f, -22.1327f, 33.3254f, 0.0741f, 0.1712f },
+    { 2.2978f, -22.1352f, 33.3863f, 0.0716f, 0.1768f },
+    { 2.5517f, -22.1094f, 33.0954f, 0.0932f, 0.1561f },
+    { 2.5104f, -22.1197f, 33.215f, 0.0893f, 0.1646f },
+    { 2.4842f, -22.1222f, 33.3079f, 0.0867f, 0.1712f },
+    { 2.4711f, -22.1286f, 33.3671f, 0.0841f, 0.1792f },
+    { 2.6474f, -22.0725f, 33.1683f, 0.1006f, 0.1623f },
+    { 2.6355f, -22.0716f, 33.243f, 0.0993f, 0.1678f },
+    { 2.6375f, -22.0705f, 33.2883f, 0.0994f, 0.1723f },
+    { 2.6859f, -22.0526f, 33.0663f, 0.1044f, 0.1549f },
+    { 2.7332f, -22.0218f, 33.1208f, 0.1084f, 0.1594f },
+    { 2.7592f, -22.0038f, 33.1502f, 0.1106f, 0.1619f },
+    { 2.7788f, -21.9918f, 33.1779f, 0.1147f, 0.1654f },
+    { 2.7846f, -21.9892f, 33.0428f, 0.1134f, 0.1539f },
+    { 2.8449f, -21.9417f, 33.0491f, 0.1191f, 0.1549f },
+    { 2.8771f, -21.9229f, 33.0644f, 0.1232f, 0.1569f },
+    { 2.7344f, -22.0217f, 32.9568f, 0.1093f, 0.147f },
+    { 2.8371f, -21.9448f, 32.9467f, 0.119f, 0.147f },
+    { 2.8814f, -21.9046f, 32.8609f, 0.1239f, 0.1408f },
+    { 2.9057f, -21.886f, 32.9502f, 0.1258f, 0.1478f },
+    { 2.9456f, -21.8632f, 32.9574f, 0.1318f, 0.1483f },
+    { 2.9546f, -21.8372f, 32.8642f, 0.1314f, 0.1416f },
+    { 2.9975f, -21.8118f, 32.8668f, 0.1375f, 0.1425f },
+    { 2.915f, -21.8738f, 32.7886f, 0.1277f, 0.1355f },
+    { 2.9874f, -21.8028f, 32.7947f, 0.1354f, 0.1367f },
+    { 3.0277f, -21.7754f, 32.7969f, 0.1432f, 0.1367f },
+    { 2.9354f, -21.8576f, 32.7333f, 0.13f, 0.1314f },
+    { 3.0002f, -21.7902f, 32.7455f, 0.1371f, 0.133f },
+    { 3.0031f, -21.7964f, 32.7156f, 0.1377f, 0.1301f },
+    { 3.0314f, -21.7607f, 32.7519f, 0.1424f, 0.1343f },
+    { 3.0221f, -21.7745f, 32.7298f, 0.1416f, 0.1319f },
+    { -0.882f, -26.6387f, 31.6722f, 0.791f, 0.1774f },
+    { -1.0327f, -26.5914f, 31.4833f, 0.7854f, 0.1737f },
+    { -0.9242f, -26.6266f, 31.5471f, 0.7886f, 0.1745f },
+    { -1.0229f, -26.5625f, 31.3806f, 0.7845f, 0.1707f },
+    { -0.8176f, -26.6218f, 31.6577f, 0.7923f, 0.1764f },
+    { -0.9527f, -26.5997f, 31.4586f, 0.787f, 0.1723f },
+    { -0.7452f, -26.5856f, 31.7496f, 0.7954f, 0.1776f },
+    { -0.8644f, -26.6184f, 31.5491f, 0.79f, 0.174f },
+    { -0.7887f, -26.5818f, 31.629f, 0.7927f, 0.1752f },
+    { -0.9163f, -26.6027f, 31.4484f, 0.7879f, 0.1716f },
+    { -0.8296f, -26.5805f, 31.5275f, 0.7906f, 0.1729f },
+    { -0.982f, -26.5599f, 31.3445f, 0.7853f, 0.1692f },
+    { -0.8729f, -26.5739f, 31.4365f, 0.7889f, 0.1707f },
+    { -1.0321f, -26.5295f, 31.2531f, 0.7834f, 0.1669f },
+    { -0.9237f, -26.5546f, 31.3473f, 0.7871f, 0.1685f },
+    { -0.9564f, -26.5383f, 31.2706f, 0.7859f, 0.1665f },
+    { -0.8302f, -26.5236f, 31.4364f, 0.7902f, 0.17f },
+    { -0.8611f, -26.5175f, 31.3617f, 0.7891f, 0.1681f },
+    { -0.796f, -26.5264f, 31.5202f, 0.7916f, 0.1721f },
+    { -0.7966f, -26.4656f, 31.4488f, 0.7916f, 0.1696f },
+    { -0.7602f, -26.5278f, 31.6181f, 0.7933f, 0.1742f },
+    { -0.7702f, -26.4671f, 31.5276f, 0.7926f, 0.1715f },
+    { -0.7389f, -26.4679f, 31.6221f, 0.7942f, 0.1735f },
+    { -0.7802f, -26.414f, 31.4742f, 0.7927f, 0.1697f },
+    { -0.7584f, -26.4132f, 31.5501f, 0.7936f, 0.1713f },
+    { -0.7094f, -26.4678f, 31.735f, 0.7964f, 0.1755f },
+    { -0.7309f, -26.4105f, 31.6384f, 0.7949f, 0.173f },
+    { -0.7244f, -26.5292f, 31.7352f, 0.7959f, 0.1764f },
+    { -0.6829f, -26.5321f, 31.8268f, 0.7985f, 0.1779f },
+    { -0.6753f, -26.4685f, 31.8204f, 0.7988f, 0.1767f },
+    { -0.6298f, -26.5376f, 31.848f, 0.8006f, 0.1781f },
+    { -0.6297f, -26.472f, 31.8326f, 0.8006f, 0.1768f },
+    { -0.5671f, -26.5465f, 31.815f, 0.8026f, 0.177f },
+    { -0.575f, -26.4791f, 31.7922f, 0.8021f, 0.1757f },
+    { -0.5136f, -26.4908f, 31.7197f, 0.8037f, 0.1737f },
+    { -0.4587f, -26.5038f, 31.6381f, 0.805f, 0.1714f },
+    { -0.5777f, -26.4186f, 31.7977f, 0.8015f, 0.1749f },
+    { -0.4235f, -26.5148f, 31.5699f, 0.8057f, 0.1694f },
+    { -0.5193f, -26.4295f, 31.7252f, 0.8029f, 0.1731f },
+    { -0.4671f, -26.4423f, 31.6428f, 0.8039f, 0.171f },
+    { -0.4003f, -26.5226f, 31.5012f, 0.8058f, 0.1675f },
+    { -0.4338f, -26.453f, 31.5765f, 0.8045f, 0.1693f },
+    { -0.3814f, -26.5257f, 31.4181f, 0.8052f, 0.1653f },
+    { -0.4095f, -26.462f, 31.5119f, 0.8045f, 0.1676f },
+    { -0.4803f, -26.3782f, 31.6663f, 0.8028f, 0.171f },
+    { -0.4469f, -26.3924f, 31.6027f, 0.8033f, 0.1695f },
+    { -0.5253f, -26.3707f, 31.7415f, 0.802f, 0.1727f },
+    { -0.5197f, -26.3012f, 31.7025f, 0.8015f, 0.1713f },
+    { -0.579f, -26.3575f, 31.806f, 0.8009f, 0.1743f },
+    { -0.5433f, -26.3094f, 31.7503f, 0.8011f, 0.1725f },
+    { -0.5831f, -26.2881f, 31.7917f, 0.8003f, 0.1734f },
+    { -0.6265f, -26.3577f, 31.8351f, 0.8f, 0.1751f },
+    { -0.6296f, -26.4134f, 31.8343f, 0.8003f, 0.1758f },
+    { -0.6727f, -26.4115f, 31.8206f, 0.7988f, 0.1758f },
+    { -0.6642f, -26.3531f, 31.8161f, 0.7989f, 0.1749f },
+    { -0.7044f, -26.4102f, 31.7419f, 0.7969f, 0.1747f },
+    { -0.695f, -26.3543f, 31.7505f, 0.7974f, 0.174f },
+    { -0.7156f, -26.3507f, 31.6657f, 0.7959f, 0.1726f },
+    { -0.7413f, -26.3601f, 31.5877f, 0.7947f, 0.1714f },
+    { -0.6721f, -26.2839f, 31.7027f, 0.7973f, 0.1724f },
+    { -0.6668f, -26.2979f, 31.7551f, 0.798f, 0.1734f },
+    { -0.6384f, -26.2855f, 31.7954f, 0.799f, 0.1738f },
+    { -0.6169f, -26.3005f, 31.8165f, 0.7997f, 0.1741f },
+    { -0.5927f, -26.2139f, 31.7231f, 0.7993f, 0.1716f },
+    { -0.6996f, -26.3029f, 31.6403f, 0.7962f, 0.1716f },
+    { -0.6968f, -26.2894f, 31.6121f, 0.7961f, 0.1709f },
+    { -0.7556f, -26.3586f, 31.5247f, 0.794f, 0.1701f },
+    { -0.7688f, -26.3523f, 31.4545f, 0.7935f, 0.1688f },
+    { -0.7192f, -26.2963f, 31.5426f, 0.7953f, 0.1698f },
+    { -0.7898f, -26.4083f, 31.4078f, 0.7923f, 0.1681f },
+    { -0.6997f, -26.2718f, 31.5344f, 0.7959f, 0.1693f },
+    { -0.76f, -26.3348f, 31.4078f, 0.7937f, 0.1677f },
+    { -0.7402f, -26.3281f, 31.3609f, 0.794f, 0.1667f },
+    { -0.7831f, -26.4003f, 31.3533f, 0.7923f, 0.1668f },
+    { -0.811f, -26.4637f, 31.3833f, 0.791f, 0.1679f },
+    { -0.8738f, -26.5115f, 31.2998f, 0.7886f, 0.1663f },
+    { -0.8081f, -26.4614f, 31.3306f, 0.7909f, 0.1664f },
+    { -0.9457f, -26.5411f, 31.2168f, 0.7861f, 0.1646f },
+    { -0.8532f, -26.5091f, 31.2544f, 0.7892f, 0.1647f },
+    { -0.7565f, -26.3937f, 31.3131f, 0.793f, 0.1657f },
+    { -0.7826f, -26.4586f, 31.2906f, 0.7916f, 0.1651f },
+    { -0.8972f, -26.5526f, 31.1801f, 0.7875f, 0.1628f },
+    { -0.8117f, -26.5172f, 31.2234f, 0.7904f, 0.1632f },
+    { -0.9885f, -26.5855f, 31.1455f, 0.7844f, 0.1625f },
+    { -0.9202f, -26.6319f, 31.0413f, 0.7857f, 0.1595f },
+    { -0.8779f, -26.5948f, 31.1096f, 0.788f, 0.1602f },
+    { -0.7274f, -26.6387f, 31.0129f, 0.7918f, 0.1564f },
+    { -0.8167f, -26.5622f, 31.1546f, 0.7901f, 0.1609f },
+    { -0.7335f, -26.6024f, 31.0924f, 0.793f, 0.1583f },
+    { -0.5373f, -26.6619f, 31.0152f, 0.7995f, 0.1561f },
+    { -0.5836f, -26.6319f, 31.104f, 0.7987f, 0.1576f },
+    { -0.7115f, -26.5757f, 31.1458f, 0.7937f, 0.1595f },
+    { -0.7612f, -26.5428f, 31.2046f, 0.792f, 0.1617f },
+    { -0.5888f, -26.5988f, 31.1588f, 0.7983f, 0.159f },
+    { -0.7487f, -26.4703f, 31.263f, 0.7927f, 0.1638f },
+    { -0.6873f, -26.5697f, 31.2001f, 0.7945f, 0.1606f },
+    { -0.7206f, -26.5115f, 31.2478f, 0.7935f, 0.1626f },
+    { -0.7252f, -26.4031f, 31.2865f, 0.7937f, 0.1647f },
+    { -0.7046f, -26.443f, 31.2726f, 0.7943f, 0.1637f },
+    { -0.709f, -26.3306f, 31.346f, 0.7946f, 0.1661f },
+    { -0.6926f, -26.3635f, 31.3236f, 0.795f, 0.1652f },
+    { -0.6677f, -26.2679f, 31.4935f, 0.7964f, 0.1684f },
+    { -0.6989f, -26.2758f, 31.4726f, 0.7956f, 0.1683f },
+    { -0.6643f, -26.2988f, 31.4455f, 0.7963f, 0.1673f },
+    { -0.6258f, -26.3076f, 31.4851f, 0.7974f, 0.1675f },
+    { -0.6484f, -26.3962f, 31.3329f, 0.7962f, 0.1647f },
+    { -0.6584f, -26.4851f, 31.2713f, 0.7955f, 0.1629f },
+    { -0.552f, -26.4267f, 31.3343f, 0.7987f, 0.1641f },
+    { -0.5622f, -26.3477f, 31.4538f, 0.7989f, 0.1665f },
+    { -0.5043f, -26.3369f, 31.5046f, 0.8005f, 0.1671f },
+    { -0.5505f, -26.5007f, 31.2825f, 0.7986f, 0.1625f },
+    { -0.455f, -26.4327f, 31.3626f, 0.8013f, 0.1642f },
+    { -0.6674f, -26.5507f, 31.2453f, 0.7951f, 0.1617f },
+    { -0.5757f, -26.5815f, 31.2121f, 0.7984f, 0.1602f },
+    { -0.5582f, -26.5566f, 31.2559f, 0.7986f, 0.1613f },
+    { -0.4398f, -26.4992f, 31.302f, 0.8018f, 0.1625f },
+    { -0.4697f, -26.583f, 31.2357f, 0.802f, 0.1604f },
+    { -0.4021f, -26.4324f, 31.3757f, 0.8026f, 0.1644f },
+    { -0.4482f, -26.5461f, 31.2755f, 0.802f, 0.1615f },
+    { -0.3855f, -26.4899f, 31.3255f, 0.8032f, 0.163f },
+    { -0.4128f, -26.5789f, 31.2664f, 0.8039f, 0.161f },
+    { -0.3928f, -26.5362f, 31.3003f, 0.8036f, 0.1621f },
+    { -0.3952f, -26.4143f, 31.4204f, 0.8029f, 0.1654f },
+    { -0.3722f, -26.4782f, 31.3656f, 0.8038f, 0.1641f },
+    { -0.4645f, -26.3258f, 31.5433f, 0.8016f, 0.1679f },
+    { -0.4018f, -26.4095f, 31.4745f, 0.8033f, 0.1667f },
+    { -0.4535f, -26.3561f, 31.4843f, 0.8016f, 0.1667f },
+    { -0.4535f, -26.3382f, 31.5559f, 0.8021f, 0.1682f },
+    { -0.4853f, -26.3134f, 31.6249f, 0.8018f, 0.1696f },
+    { -0.4863f, -26.3252f, 31.6486f, 0.8021f, 0.1702f },
+    { -0.4285f, -26.3965f, 31.5487f, 0.8033f, 0.1683f },
+    { -0.3846f, -26.4697f, 31.4347f, 0.8042f, 0.1658f },
+    { -0.3759f, -26.5287f, 31.3434f, 0.8043f, 0.1632f },
+    { -0.3865f, -26.5768f, 31.3185f, 0.805f, 0.1624f },
+    { -0.3832f, -26.6234f, 31.2892f, 0.806f, 0.1615f },
+    { -0.4195f, -26.6212f, 31.2261f, 0.8046f, 0.1599f },
+    { -0.3451f, -26.6696f, 31.2543f, 0.8078f, 0.1606f },
+    { -0.3867f, -26.6663f, 31.1818f, 0.8063f, 0.1587f },
+    { -0.4807f, -26.6184f, 31.1877f, 0.8024f, 0.1591f },
+    { -0.458f, -26.6608f, 31.1365f, 0.8037f, 0.1577f },
+    { -3.0143f, -21.5308f, 33.9174f, 0.4501f, 0.1807f },
+    { -2.7575f, -21.6592f, 34.0951f, 0.4557f, 0.1809f },
+    { -3.0413f, -21.3705f, 34.0315f, 0.4494f, 0.1842f },
+    { -2.9398f, -21.6465f, 33.7579f, 0.4508f, 0.177f },
+    { -3.2835f, -21.24f, 33.7981f, 0.4433f, 0.1835f },
+    { -3.317f, -20.9972f, 33.8518f, 0.4413f, 0.1874f },
+    { -3.5189f, -20.8868f, 33.5515f, 0.435f, 0.1858f },
+    { -3.3739f, -20.6695f, 33.8624f, 0.438f, 0.1921f },
+    { -3.5735f, -20.5491f, 33.5359f, 0.4312f, 0.1904f },
+    { -3.6894f, -20.4693f, 33.1503f, 0.4249f, 0.1871f },
+    { -3.8546f, -20.0498f, 32.6106f, 0.4137f, 0.1864f },
+    { -3.7604f, -20.0485f, 33.09f, 0.4201f, 0.1923f },
+    { -3.6473f, -20.1284f, 33.5237f, 0.4271f, 0.1961f },
+    { -3.7516f, -19.6268f, 33.5623f, 0.4234f, 0.2034f },
+    { -3.5993f, -19.1356f, 34.0095f, 0.4282f, 0.2151f },
+    { -3.5439f, -19.7177f, 33.9388f, 0.4308f, 0.2061f },
+    { -3.4506f, -20.2465f, 33.876f, 0.4343f, 0.1982f },
+    { -3.2962f, -19.8061f, 34.2236f, 0.4377f, 0.2076f },
+    { -3.3474f, -19.1917f, 34.276f, 0.4349f, 0.217f },
+    { -3.0883f, -19.2159f, 34.4956f, 0.4413f, 0.2189f },
+    { -3.058f, -18.5939f, 34.4867f, 0.4398f, 0.2287f },
+    { -3.3082f, -18.5895f, 34.2857f, 0.4336f, 0.2267f },
+    { -3.0175f, -17.9453f, 34.4668f, 0.4397f, 0.2395f },
+    { -2.7626f, -17.9263f, 34.6158f, 0.4457f, 0.2414f },
+    { -2.8109f, -23.6794f, 28.273f, 0.4199f, 0.0866f },
+    { -2.7602f, -23.9511f, 28.2741f, 0.4234f, 0.0844f },
+    { -2.639f, -23.9728f, 28.2019f, 0.4233f, 0.0823f },
+    { -2.6853f, -23.7229f, 28.2013f, 0.4201f, 0.0841f },
+    { -2.5047f, -23.9764f, 28.2722f, 0.4234f, 0.0802f },
+    { -2.543f, -23.7394f, 28.2646f, 0.4203f, 0.0819f },
+    { -2.4576f, -24.2674f, 28.2768f, 0.4271f, 0.0782f },
+    { -2.3631f, -23.9743f, 28.4802f, 0.4234f, 0.077f },
+    { -2.5794f, -23.554f, 28.2387f, 0.4179f, 0.0834f },
+    { -2.7201f, -23.5268f, 28.1906f, 0.4175f, 0.0857f },
+    { -2.6029f, -23.3729f, 28.1971f, 0.4154f, 0.0847f },
+    { -2.7457f, -23.3409f, 28.1744f, 0.415f, 0.0871f },
+    { -2.8412f, -23.4655f, 28.243f, 0.417f, 0.088f },
+    { -2.8333f, -23.3225f, 28.2138f, 0.4149f, 0.0885f },
+    { -2.933f, -23.3261f, 28.3873f, 0.4158f, 0.0912f },
+    { -4.0945f, -20.4671f, 31.5076f, 0.4042f, 0.1663f },
+    { -4.2542f, -19.9615f, 30.3936f, 0.3896f, 0.1574f },
+    { -3.9948f, -20.1755f, 32.121f, 0.4085f, 0.1784f },
+    { -4.2682f, -19.8555f, 31.2373f, 0.3959f, 0.1706f },
+    { -4.323f, -19.281f, 30.1672f, 0.3813f, 0.1615f },
+    { -4.194f, -14.7577f, 30.6931f, 0.413f, 0.3511f },
+    { -3.9918f, -14.2329f, 30.5478f, 0.422f, 0.3502f },
+    { -3.6105f, -17.0839f, 25.7795f, 0.3808f, 0.3669f },
+    { -3.349f, -17.7844f, 25.4979f, 0.3723f, 0.3587f },
+    { -3.4572f, -17.9772f, 26.0915f, 0.3768f, 0.3542f },
+    { -3.8395f, -16.3169f, 26.1089f, 0.3895f, 0.3763f },
+    { -3.9795f, -15.5434f, 26.5252f, 0.399f, 0.384f },
+    { -3.9738f, -14.8233f, 27.0672f, 0.4098f, 0.3873f },
+    { -3.2561f, -17.5321f, 24.8931f, 0.3681f, 0.3639f },
+    { -2.8106f, -17.8745f, 24.0124f, 0.3561f, 0.3618f },
+    { -2.828f, -18.1261f, 24.5873f, 0.3597f, 0.3561f },
+    { -2.3316f, -18.1934f, 23.1065f, 0.3442f, 0.3601f },
+    { -2.3087f, -18.3803f, 23.6688f, 0.3482f, 0.3548f },
+    { -3.0182f, -18.3939f, 25.2107f, 0.3643f, 0.3517f },
+    { -3.2345f, -18.6308f, 25.8371f, 0.369f, 0.3477f },
+    { -2.3709f, -18.598f, 24.2466f, 0.3523f, 0.3499f },
+    { -2.5811f, -18.888f, 24.8643f, 0.3571f, 0.3458f },
+    { -2.8411f, -19.1829f, 25.5138f, 0.3621f, 0.3421f },
+    { -1.8863f, -18.9612f, 23.9329f, 0.3457f, 0.3446f },
+    { -2.065f, -19.2727f, 24.5292f, 0.3504f, 0.3406f },
+    { -2.3057f, -19.741f, 25.2227f, 0.3552f, 0.3365f },
+    { -1.798f, -18.7722f, 23.3645f, 0.3413f, 0.3489f },
+    { -1.3757f, -19.2296f, 23.7078f, 0.3398f, 0.3397f },
+    { -1.4967f, -19.5539f, 24.2763f, 0.344f, 0.3355f },
+    { -1.5773f, -19.958f, 24.8206f, 0.3482f, 0.3312f },
+    { -0.9384f, -19.7524f, 24.1059f, 0.3383f, 0.331f },
+    { -0.9615f, -20.124f, 24.6305f, 0.3412f, 0.3258f },
+    { -0.8769f, -19.4219f, 23.5579f, 0.3344f, 0.3355f },
+    { -0.452f, -19.8887f, 24.0183f, 0.3336f, 0.3274f },
+    { -0.4539f, -20.2364f, 24.5469f, 0.3379f, 0.3223f },
+    { 0.0018f, -20.2803f, 24.532f, 0.3346f, 0.3188f },
+    { 0.0025f, -19.942f, 23.9953f, 0.3295f, 0.3244f },
+    { 0.0028f, -19.6105f, 23.4418f, 0.3243f, 0.3299f },
+    { -0.4273f, -19.557f, 23.4701f, 0.3295f, 0.3323f },
+    { 0.0023f, -19.3744f, 22.932f, 0.3215f, 0.3337f },
+    { -0.3905f, -19.3331f, 22.9531f, 0.3257f, 0.3364f },
+    { 0.0015f, -19.1881f, 22.4512f, 0.3186f, 0.3374f },
+    { -0.3623f, -19.1623f, 22.4634f, 0.3222f, 0.34f },
+    { 0.0006f, -19.0058f, 21.9846f, 0.3155f, 0.3402f },
+    { -0.8093f, -19.2191f, 23.0249f, 0.3302f, 0.3396f },
+    { -1.2883f, -19.042f, 23.156f, 0.3353f, 0.3438f },
+    { -1.7754f, -18.6313f, 22.8192f, 0.337f, 0.3533f },
+    { -1.2436f, -18.9108f, 22.6291f, 0.3311f, 0.3477f },
+    { -1.7941f, -18.4644f, 22.2923f, 0.333f, 0.3576f },
+    { -1.251f, -18.7557f, 22.1355f, 0.3273f, 0.3516f },
+    { -0.7635f, -19.0737f, 22.517f, 0.3262f, 0.3433f },
+    { -0.7674f, -18.9154f, 22.0441f, 0.3227f, 0.3469f },
+    { -0.3638f, -18.9898f, 21.997f, 0.3189f, 0.3433f },
+    { -0.f, -18.8151f, 21.503f, 0.3124f, 0.343f },
+    { -0.389f, -18.8041f, 21.518f, 0.3159f, 0.3463f },
+    { -0.0002f, -18.6034f, 20.9776f, 0.3096f, 0.3447f },
+    { -0.8134f, -18.7342f, 21.564f, 0.3197f, 0.3504f },
+    { -0.432f, -18.5935f, 20.9903f, 0.3131f, 0.3491f },
+    { -0.0003f, -18.4005f, 20.4247f, 0.3067f, 0.3465f },
+    { -0.8937f, -18.5204f, 21.0343f, 0.3169f, 0.3539f },
+    { -0.4841f, -18.3899f, 20.4327f, 0.3097f, 0.3518f },
+    { -0.5368f, -18.2252f, 19.8637f, 0.3053f, 0.3546f },
+    { -0.0003f, -18.2363f, 19.8605f, 0.3018f, 0.3486f },
+    { -0.9919f, -18.3122f, 20.4735f, 0.3136f, 0.3574f },
+    { -0.5713f, -18.0468f, 19.2059f, 0.2992f, 0.3576f },
+    { -0.0003f, -18.0514f, 19.2115f, 0.2969f, 0.3508f },
+    { -1.0912f, -18.1478f, 19.9f, 0.3091f, 0.361f },
+    { -1.154f, -17.985f, 19.2287f, 0.3028f, 0.3644f },
+    { -1.6812f, -17.9602f, 19.9959f, 0.3135f, 0.368f },
+    { -1.7603f, -17.818f, 19.3199f, 0.307f, 0.3717f },
+    { -1.1428f, -17.7816f, 18.3745f, 0.294f, 0.3675f },
+    { -0.5687f, -17.8022f, 18.3816f, 0.2908f, 0.3607f },
+    { -0.0003f, -17.7863f, 18.4043f, 0.2879f, 0.3539f },
+    { -0.5389f, -17.5104f, 17.469f, 0.2813f, 0.3638f },
+    { -0.0003f, -17.4611f, 17.477f, 0.279f, 0.357f },
+    { -0.0003f, -17.0955f, 16.4678f, 0.2666f, 0.3618f },
+    { -1.0742f, -17.5499f, 17.4721f, 0.2843f, 0.3702f },
+    { -0.4918f, -17.1903f, 16.5465f, 0.2713f, 0.3669f },
+    { -0.0003f, -16.6682f, 15.5615f, 0.2542f, 0.3667f },
+    { -1.7284f, -17.6562f, 18.4441f, 0.2977f, 0.3746f },
+    { -0.4863f, -16.8379f, 15.7595f, 0.2626f, 0.3703f },
+    { -0.0003f, -16.1579f, 14.9429f, 0.2455f, 0.3704f },
+    { -0.965f, -17.3022f, 16.6566f, 0.2752f, 0.3722f },
+    { -0.5811f, -16.4493f, 15.2536f, 0.2567f, 0.3742f },
+    { -0.0003f, -15.3064f, 14.1622f, 0.2369f, 0.3742f },
+    { -0.8485f, -17.0482f, 16.0964f, 0.2684f, 0.3732f },
+    { -0.8173f, -15.1546f, 13.8713f, 0.2386f, 0.385f },
+    { -0.0003f, -14.0165f, 13.2825f, 0.2227f, 0.3769f },
+    { -0.5762f, -14.0637f, 13.2282f, 0.2246f, 0.385f },
+    { -0.0003f, -12.8372f, 12.7022f, 0.2084f, 0.3797f },
+    { -1.1234f, -14.0634f, 13.1203f, 0.2256f, 0.3929f },
+    { -0.5169f, -12.8669f, 12.6942f, 0.211f, 0.386f },
+    { -0.0003f, -11.7253f, 12.2675f, 0.1981f, 0.379f },
+    { -1.4068f, -12.8072f, 12.6196f, 0.212f, 0.3986f },
+    { -0.9976f, -12.8817f, 12.6675f, 0.2121f, 0.3927f },
+    { -0.527f, -11.7274f, 12.281f, 0.1985f, 0.3862f },
+    { -0.0003f, -10.7285f, 12.0196f, 0.1878f, 0.3784f },
+    { -0.6161f, -10.7121f, 12.0559f, 0.1864f, 0.3859f },
+    { -0.9902f, -11.7223f, 12.2953f, 0.1987f, 0.3924f },
+    { -1.1302f, -10.6859f, 12.1122f, 0.185f, 0.3933f },
+    { -1.4409f, -10.6735f, 12.1362f, 0.1854f, 0.3953f },
+    { -1.3266f, -11.6987f, 12.2843f, 0.1989f, 0.397f },
+    { -1.6125f, -10.6644f, 12.1117f, 0.1858f, 0.3973f },
+    { -1.5489f, -11.6413f, 12.2311f, 0.1984f, 0.4001f },
+    { -1.709f, -10.6481f, 12.0226f, 0.1858f, 0.3984f },
+    { -1.6694f, -11.5348f, 12.119f, 0.1971f, 0.402f },
+    { -4.6258f, -13.4743f, 1.7911f, 0.0716f, 0.462f },
+    { -4.9023f, -13.6485f, 1.4871f, 0.0663f, 0.4638f },
+    { -4.3514f, -13.5554f, 1.7915f, 0.0727f, 0.4591f },
+    { -4.641f, -13.7405f, 1.4984f, 0.0679f, 0.4613f },
+    { -4.8626f, -14.1227f, 1.1584f, 0.0624f, 0.4612f },
+    { -5.0845f, -13.9096f, 1.0975f, 0.0606f, 0.4636f },
+    { -4.6512f, -14.1469f, 1.1572f, 0.0636f, 0.4593f },
+    { -4.8156f, -14.4887f, 0.8438f, 0.0589f, 0.4585f },
+    { -4.3943f, -13.785f, 1.4253f, 0.0685f, 0.4589f },
+    { -4.6457f, -14.4543f, 0.8359f, 0.0596f, 0.4571f },
+    { -4.4933f, -14.1329f, 1.1053f, 0.064f, 0.4579f },
+    { -4.1492f, -13.6518f, 1.826f, 0.0734f, 0.4568f },
+    { -4.3682f, -14.1699f, 1.1038f, 0.0645f, 0.4569f },
+    { -4.077f, -13.3586f, 2.0706f, 0.0773f, 0.4564f },
+    { -4.205f, -13.9285f, 1.4997f, 0.0694f, 0.4566f },
+    { -3.9504f, -13.3895f, 2.0273f, 0.0773f, 0.4547f },
+    { -3.97f, -13.6624f, 1.8531f, 0.0743f, 0.4545f },
+    { -3.8127f, -13.1296f, 2.0953f, 0.0799f, 0.4532f },
+    { -3.6081f, -12.8113f, 2.0669f, 0.0823f, 0.4503f },
+    { -3.7645f, -13.4858f, 1.8311f, 0.0759f, 0.452f },
+    { -4.0122f, -14.1018f, 1.483f, 0.0693f, 0.454f },
+    { -3.5459f, -13.2041f, 1.7793f, 0.0776f, 0.449f },
+    { -4.2611f, -14.2781f, 1.1512f, 0.065f, 0.4557f },
+    { -3.7543f, -13.8726f, 1.4793f, 0.0711f, 0.4511f },
+    { -4.1383f, -14.4381f, 1.1392f, 0.0648f, 0.4541f },
+    { -3.8975f, -14.3687f, 1.1373f, 0.0659f, 0.4519f },
+    { -3.5334f, -13.5929f, 1.4245f, 0.0726f, 0.4482f },
+    { -3.7099f, -14.1343f, 1.138f, 0.0673f, 0.4499f },
+    { -3.3528f, -13.243f, 1.394f, 0.0742f, 0.445f },
+    { -3.514f, -13.8284f, 1.1067f, 0.0686f, 0.4472f },
+    { -3.3278f, -12.8994f, 1.7167f, 0.0791f, 0.4451f },
+    { -3.3595f, -13.4505f, 1.0972f, 0.0701f, 0.4446f },
+    { -3.3377f, -12.5389f, 1.9924f, 0.0836f, 0.4456f },
+    { -3.1359f, -12.6688f, 1.6618f, 0.08f, 0.4416f },
+    { -3.1858f, -12.939f, 1.4047f, 0.0759f, 0.442f },
+    { -2.8375f, -12.4263f, 1.7015f, 0.0812f, 0.4371f },
+    { -2.9962f, -12.6094f, 1.6326f, 0.0801f, 0.4395f },
+    { -3.0059f, -12.7971f, 1.4736f, 0.0774f, 0.4396f },
+    { -3.2131f, -13.1336f, 1.1447f, 0.0719f, 0.4422f },
+    { -2.7679f, -12.6923f, 1.5454f, 0.0785f, 0.4366f },
+    { -3.0417f, -13.0109f, 1.2844f, 0.0741f, 0.4401f },
+    { -2.5819f, -12.1736f, 1.653f, 0.0805f, 0.4321f },
+    { -2.3441f, -11.8356f, 1.5537f, 0.079f, 0.4261f },
+    { -2.2392f, -11.3963f, 1.47f, 0.0777f, 0.4205f },
+    { -2.4956f, -12.4244f, 1.4875f, 0.078f, 0.4318f },
+    { -2.2054f, -11.37f, 1.3231f, 0.0754f, 0.4188f },
+    { -2.2884f, -12.0339f, 1.3881f, 0.0765f, 0.4259f },
+    { -2.2029f, -11.4857f, 1.1438f, 0.0724f, 0.4185f },
+    { -2.2824f, -10.7296f, 1.0821f, 0.0702f, 0.4096f },
+    { -2.2503f, -12.2585f, 1.2287f, 0.0743f, 0.4263f },
+    { -2.2239f, -11.7028f, 0.9507f, 0.0694f, 0.4194f },
+    { -2.3183f, -10.9008f, 0.8764f, 0.065f, 0.4094f },
+    { -2.2339f, -12.525f, 1.051f, 0.0723f, 0.4273f },
+    { -2.4141f, -12.6809f, 1.3369f, 0.0758f, 0.4318f },
+    { -2.3593f, -12.9661f, 1.1543f, 0.0736f, 0.4322f },
+    { -2.6065f, -12.898f, 1.4171f, 0.0764f, 0.4353f },
+    { -2.5444f, -13.1703f, 1.2312f, 0.0738f, 0.4353f },
+    { -2.8743f, -13.0091f, 1.4106f, 0.0757f, 0.4384f },
+    { -2.7397f, -13.0549f, 1.4179f, 0.0758f, 0.4372f },
+    { -2.7339f, -13.2812f, 1.2522f, 0.0734f, 0.4374f },
+    { -2.9165f, -13.276f, 1.2092f, 0.0724f, 0.439f },
+    { -3.0737f, -13.2299f, 1.049f, 0.0703f, 0.4404f },
+    { -2.9372f, -13.5417f, 0.8824f, 0.0683f, 0.4392f },
+    { -3.2136f, -13.2821f, 0.8862f, 0.068f, 0.442f },
+    { -3.072f, -13.4333f, 0.7515f, 0.0661f, 0.4401f },
+    { -3.1831f, -13.4143f, 0.6335f, 0.0642f, 0.4412f },
+    { -3.3441f, -13.5718f, 0.8356f, 0.0666f, 0.444f },
+    { -3.3031f, -13.6569f, 0.6182f, 0.0636f, 0.4432f },
+    { -3.4836f, -13.952f, 0.8415f, 0.0656f, 0.4463f },
+    { -3.4381f, -14.0048f, 0.6444f, 0.0634f, 0.4456f },
+    { -3.6503f, -14.2756f, 0.8484f, 0.0644f, 0.4486f },
+    { -3.5943f, -14.3011f, 0.6515f, 0.0626f, 0.4478f },
+    { -3.8306f, -14.5147f, 0.8453f, 0.0632f, 0.4507f },
+    { -3.772f, -14.5091f, 0.6492f, 0.0616f, 0.4498f },
+    { -3.7649f, -14.4189f, 0.562f, 0.0607f, 0.4493f },
+    { -4.0112f, -14.6414f, 0.8216f, 0.0619f, 0.4521f },
+    { -3.9711f, -14.5919f, 0.6475f, 0.0604f, 0.4513f },
+    { -3.9216f, -14.4471f, 0.5267f, 0.0594f, 0.4505f },
+    { -3.6381f, -14.2773f, 0.5277f, 0.061f, 0.4479f },
+    { -3.4646f, -14.0199f, 0.4775f, 0.0613f, 0.4455f },
+    { -3.8773f, -14.2706f, 0.4574f, 0.0586f, 0.4494f },
+    { -4.0825f, -14.4473f, 0.5366f, 0.0584f, 0.4515f },
+    { -4.1497f, -14.5711f, 0.6356f, 0.0592f, 0.4524f },
+    { -4.143f, -14.3209f, 0.4719f, 0.0571f, 0.4514f },
+    { -3.8269f, -14.1f, 0.3871f, 0.0581f, 0.4483f },
+    { -4.2659f, -14.4683f, 0.6028f, 0.0581f, 0.453f },
+    { -4.2054f, -14.0645f, 0.3547f, 0.0548f, 0.4505f },
+    { -4.1718f, -14.6224f, 0.8398f, 0.0614f, 0.4533f },
+    { -4.0273f, -14.5321f, 1.0506f, 0.0642f, 0.4528f },
+    { -4.2904f, -14.5187f, 0.8344f, 0.061f, 0.4544f },
+    { -4.3451f, -14.3582f, 0.5702f, 0.0573f, 0.4534f },
+    { -4.377f, -14.4166f, 0.8145f, 0.0605f, 0.4551f },
+    { -4.413f, -14.3156f, 0.5594f, 0.0569f, 0.4538f },
+    { -4.4417f, -14.4027f, 0.7894f, 0.06f, 0.4555f },
+    { -4.432f, -14.2313f, 1.014f, 0.0631f, 0.4569f },
+    { -4.5159f, -14.3931f, 0.8149f, 0.06f, 0.4561f },
+    { -4.4942f, -14.3381f, 0.5702f, 0.0567f, 0.4545f },
+    { -4.6137f, -14.4232f, 0.6028f, 0.0567f, 0.4555f },
+    { -4.7692f, -14.4921f, 0.6351f, 0.0565f, 0.4569f },
+    { -4.6618f, -14.2494f, 0.4719f, 0.0547f, 0.4554f },
+    { -4.7718f, -14.3541f, 0.5363f, 0.0553f, 0.4565f },
+    { -4.9227f, -14.3095f, 0.5261f, 0.0547f, 0.4579f },
+    { -4.9584f, -14.4658f, 0.6452f, 0.056f, 0.4585f },
+    { -5.0102f, -14.3987f, 0.8304f, 0.0578f, 0.4601f },
+    { -5.0799f, -14.2426f, 0.5598f, 0.0544f, 0.4596f },
+    { -5.2607f, -13.6527f, 0.9895f, 0.0583f, 0.4654f },
+    { -5.1344f, -14.3361f, 0.6442f, 0.0552f, 0.4602f },
+    { -5.1821f, -14.2169f, 0.8021f, 0.0566f, 0.4618f },
+    { -5.41f, -12.9934f, 0.945f, 0.0558f, 0.4686f },
+    { -5.3348f, -13.497f, 0.8495f, 0.0555f, 0.4657f },
+    { -5.5405f, -12.9798f, 0.9027f, 0.0529f, 0.4693f },
+    { -5.4048f, -13.0768f, 0.7249f, 0.0516f, 0.4667f },
+    { -5.7248f, -13.1851f, 0.8048f, 0.0496f, 0.4706f },
+    { -5.5361f, -13.1325f, 0.6708f, 0.0487f, 0.4677f },
+    { -5.7207f, -13.3189f, 0.5296f, 0.0453f, 0.4694f },
+    { -5.3931f, -13.1547f, 0.5445f, 0.0483f, 0.4651f },
+    { -5.5368f, -13.2199f, 0.4538f, 0.0452f, 0.4666f },
+    { -5.348f, -13.4243f, 0.6986f, 0.0527f, 0.465f },
+    { -5.2841f, -13.9761f, 0.7657f, 0.0553f, 0.4631f },
+    { -5.3184f, -13.7445f, 0.699f, 0.0537f, 0.4637f },
+    { -5.2502f, -14.0949f, 0.643f, 0.0543f, 0.4618f },
+    { -5.3158f, -13.7767f, 0.6212f, 0.0528f, 0.4631f },
+    { -5.3415f, -13.4164f, 0.5582f, 0.0502f, 0.4639f },
+    { -5.301f, -13.4364f, 0.4182f, 0.0485f, 0.4625f },
+    { -5.3039f, -13.0351f, 0.3547f, 0.0442f, 0.4614f },
+    { -5.2291f, -13.7811f, 0.4738f, 0.0515f, 0.4615f },
+    { -5.149f, -14.0725f, 0.5256f, 0.0534f, 0.4605f },
+    { -4.8965f, -14.1282f, 0.4574f, 0.0536f, 0.4576f },
+    { -4.8879f, -13.953f, 0.3871f, 0.0524f, 0.4576f },
+    { -4.5091f, -14.0205f, 0.3547f, 0.0532f, 0.4532f },
+    { -5.1394f, -13.6716f, 0.3045f, 0.0498f, 0.46f },
+    { -4.3479f, -13.9796f, 0.3871f, 0.0537f, 0.4513f },
+    { -4.905f, -13.8152f, 0.2635f, 0.051f, 0.4575f },
+    { -4.2485f, -13.4045f, 0.3357f, 0.0503f, 0.4474f },
+    { -5.0623f, -13.6006f, 0.1965f, 0.049f, 0.4587f },
+    { -4.0127f, -13.4544f, 0.3029f, 0.0522f, 0.4452f },
+    { -5.0863f, -13.4435f, 0.1483f, 0.0476f, 0.4586f },
+    { -3.8513f, -13.4984f, 0.2042f, 0.0538f, 0.4441f },
+    { -5.2122f, -13.4473f, 0.269f, 0.0478f, 0.4606f },
+    { -5.1434f, -13.2033f, 0.2173f, 0.0457f, 0.4592f },
+    { -5.064f, -13.2694f, 0.1492f, 0.0462f, 0.4579f },
+    { -4.9393f, -13.176f, 0.1132f, 0.0457f, 0.4557f },
+    { -4.9532f, -13.0002f, 0.2097f, 0.0445f, 0.4554f },
+    { -4.9349f, -13.4191f, 0.0939f, 0.0474f, 0.4564f },
+    { -4.8166f, -13.164f, 0.139f, 0.0459f, 0.4538f },
+    { -4.9275f, -13.6566f, 0.146f, 0.0493f, 0.4572f },
+    { -4.7805f, -13.389f, 0.1109f, 0.0475f, 0.4543f },
+    { -4.751f, -13.0009f, 0.2155f, 0.045f, 0.4521f },
+    { -4.7863f, -13.6223f, 0.1447f, 0.0492f, 0.4553f },
+    { -4.9541f, -12.707f, 0.3241f, 0.0421f, 0.453f },
+    { -4.6461f, -13.3681f, 0.2042f, 0.0477f, 0.4522f },
+    { -4.6827f, -13.7551f, 0.2091f, 0.0505f, 0.4545f },
+    { -4.4845f, -13.369f, 0.3029f, 0.0485f, 0.45f },
+    { -4.591f, -12.6147f, 0.3223f, 0.0428f, 0.447f },
+    { -4.1417f, -12.796f, 0.3087f, 0.0472f, 0.4429f },
+    { -3.6606f, -12.7875f, 0.3223f, 0.0512f, 0.4378f },
+    { -4.3657f, -12.1233f, 0.2264f, 0.0408f, 0.4396f },
+    { -3.6339f, -13.1856f, 0.2152f, 0.0536f, 0.4407f },
+    { -4.0544f, -12.3596f, 0.2093f, 0.0451f, 0.4387f },
+    { -3.4449f, -13.2247f, 0.209f, 0.0554f, 0.44f },
+    { -4.2145f, -11.9098f, 0.1613f, 0.0407f, 0.4359f },
+    { -3.5096f, -13.3809f, 0.1121f, 0.0558f, 0.4415f },
+    { -4.2563f, -11.5623f, 0.1692f, 0.0378f, 0.4328f },
+    { -3.6204f, -13.3467f, 0.1384f, 0.0547f, 0.4418f },
+    { -3.5915f, -13.6067f, 0.0932f, 0.0565f, 0.4434f },
+    { -3.7243f, -13.546f, 0.1107f, 0.0551f, 0.4437f },
+    { -3.9441f, -13.8614f, 0.2093f, 0.0553f, 0.4472f },
+    { -3.7984f, -13.7628f, 0.1447f, 0.0559f, 0.4456f },
+    { -3.7588f, -13.9727f, 0.2636f, 0.0577f, 0.447f },
+    { -3.6785f, -13.8285f, 0.1459f, 0.0572f, 0.4454f },
+    { -3.4951f, -13.8971f, 0.3042f, 0.0595f, 0.4449f },
+    { -3.5386f, -13.8086f, 0.196f, 0.0584f, 0.4445f },
+    { -3.4639f, -13.6634f, 0.1472f, 0.0579f, 0.4432f },
+    { -3.3524f, -13.699f, 0.2683f, 0.0594f, 0.4428f },
+    { -3.2884f, -13.701f, 0.4331f, 0.0611f, 0.4427f },
+    { -3.1375f, -13.3291f, 0.3598f, 0.0596f, 0.4388f },
+    { -3.3345f, -13.4507f, 0.2164f, 0.0578f, 0.441f },
+    { -3.427f, -13.4945f, 0.148f, 0.0572f, 0.4419f },
+    { -3.3455f, -12.953f, 0.3239f, 0.0552f, 0.4369f },
+    { -3.211f, -11.9782f, 0.3801f, 0.0528f, 0.4271f },
+    { -3.6761f, -12.2564f, 0.2265f, 0.0482f, 0.4338f },
+    { -3.1594f, -12.3811f, 0.3969f, 0.0551f, 0.4303f },
+    { -3.9759f, -11.9989f, 0.1225f, 0.0436f, 0.4344f },
+    { -3.3295f, -11.7882f, 0.2779f, 0.0502f, 0.4266f },
+    { -3.8954f, -11.6172f, 0.133f, 0.0422f, 0.4301f },
+    { -3.724f, -12.0079f, 0.1614f, 0.0463f, 0.4321f },
+    { -3.5469f, -11.7038f, 0.1692f, 0.0468f, 0.4279f },
+    { -3.511f, -11.3935f, 0.2334f, 0.0458f, 0.4247f },
+    { -3.2783f, -11.2662f, 0.3293f, 0.0484f, 0.4214f },
+    { -3.8274f, -11.2672f, 0.2159f, 0.041f, 0.4262f },
+    { -3.7861f, -11.0014f, 0.3465f, 0.04f, 0.4231f },
+    { -4.1763f, -11.2702f, 0.2335f, 0.0367f, 0.4291f },
+    { -4.511f, -11.5728f, 0.2779f, 0.035f, 0.4353f },
+    { -4.361f, -11.0762f, 0.3295f, 0.033f, 0.4287f },
+    { -4.7141f, -11.7291f, 0.3801f, 0.0344f, 0.4392f },
+    { -4.7547f, -10.8298f, 0.4827f, 0.0232f, 0.4276f },
+    { -4.9199f, -12.1116f, 0.3969f, 0.0368f, 0.4461f },
+    { -5.0861f, -11.9908f, 0.3861f, 0.0348f, 0.4469f },
+    { -5.274f, -12.1304f, 0.3016f, 0.0346f, 0.4509f },
+    { -5.4205f, -12.8583f, 0.2635f, 0.0407f, 0.461f },
+    { -5.5747f, -13.2022f, 0.2986f, 0.0428f, 0.4664f },
+    { -5.4955f, -12.7985f, 0.2182f, 0.0392f, 0.4613f },
+    { -5.7378f, -13.3088f, 0.3506f, 0.0426f, 0.4691f },
+    { -5.6018f, -13.0388f, 0.2119f, 0.0405f, 0.4651f },
+    { -5.7319f, -13.099f, 0.2563f, 0.04f, 0.4671f },
+    { -5.9109f, -13.3249f, 0.3631f, 0.0419f, 0.4712f },
+    { -5.8933f, -13.147f, 0.2653f, 0.0393f, 0.4697f },
+    { -6.0631f, -13.2434f, 0.3681f, 0.0417f, 0.4734f },
+    { -6.014f, -13.1421f, 0.2966f, 0.0399f, 0.4721f },
+    { -6.0574f, -12.9692f, 0.286f, 0.0361f, 0.471f },
+    { -5.8552f, -12.7775f, 0.2475f, 0.0357f, 0.4652f },
+    { -6.0081f, -12.6839f, 0.3318f, 0.0334f, 0.4692f },
+    { -5.8057f, -12.3543f, 0.3025f, 0.0316f, 0.4593f },
+    { -5.6586f, -12.6338f, 0.2348f, 0.0359f, 0.4612f },
+    { -5.4642f, -11.9194f, 0.2832f, 0.0298f, 0.4494f },
+    { -5.5696f, -12.6888f, 0.2001f, 0.0372f, 0.4609f },
+    { -5.4472f, -12.4049f, 0.2156f, 0.0356f, 0.4563f },
+    { -5.1638f, -11.3911f, 0.3729f, 0.0265f, 0.4385f },
+    { -3.7558f, -10.7624f, 0.505f, 0.039f, 0.4202f },
+    { -4.5267f, -10.4053f, 0.6667f, 0.0227f, 0.4233f },
+    { -3.7205f, -10.4928f, 0.6716f, 0.0379f, 0.4164f },
+    { -4.4664f, -10.1835f, 0.828f, 0.0222f, 0.4191f },
+    { -3.6899f, -10.2469f, 0.841f, 0.0367f, 0.4123f },
+    { -2.838f, -11.1236f, 0.4815f, 0.0539f, 0.4163f },
+    { -2.9201f, -10.6238f, 0.6776f, 0.0506f, 0.4116f },
+    { -2.9192f, -10.3672f, 0.8481f, 0.0512f, 0.4056f },
+    { -2.9542f, -12.3024f, 0.3795f, 0.0572f, 0.4279f },
+    { -2.5287f, -10.7626f, 0.6843f, 0.0581f, 0.4107f },
+    { -2.506f, -10.5204f, 0.8511f, 0.0581f, 0.4075f },
+    { -2.5535f, -11.076f, 0.5409f, 0.0583f, 0.414f },
+    { -2.3682f, -11.1384f, 0.7072f, 0.0629f, 0.4139f },
+    { -2.4264f, -11.4536f, 0.5531f, 0.0617f, 0.4169f },
+    { -2.2608f, -11.9805f, 0.7622f, 0.0672f, 0.4212f },
+    { -2.313f, -12.2791f, 0.5774f, 0.0656f, 0.4235f },
+    { -2.2435f, -12.8489f, 0.8304f, 0.0702f, 0.4288f },
+    { -2.276f, -13.1248f, 0.604f, 0.0683f, 0.4303f },
+    { -2.3533f, -13.3033f, 0.8931f, 0.071f, 0.4332f },
+    { -2.3778f, -13.563f, 0.6234f, 0.0686f, 0.4341f },
+    { -2.5381f, -13.493f, 0.934f, 0.0705f, 0.4357f },
+    { -2.5582f, -13.7355f, 0.626f, 0.0675f, 0.4361f },
+    { -2.746f, -13.567f, 0.9368f, 0.0697f, 0.4377f },
+    { -2.757f, -13.784f, 0.6027f, 0.0662f, 0.4377f },
+    { -2.9315f, -13.7233f, 0.5507f, 0.0647f, 0.4388f },
+    { -3.0389f, -13.5682f, 0.4675f, 0.0628f, 0.4392f },
+    { -2.8949f, -13.7382f, 0.3348f, 0.0632f, 0.438f },
+    { -2.9771f, -13.5816f, 0.2726f, 0.0618f, 0.4381f },
+    { -2.9664f, -13.208f, 0.238f, 0.0604f, 0.4355f },
+    { -2.8342f, -12.4911f, 0.2752f, 0.0591f, 0.4285f },
+    { -2.8862f, -13.1822f, 0.1776f, 0.061f, 0.4344f },
+    { -2.671f, -11.7872f, 0.3477f, 0.0585f, 0.421f },
+    { -2.7857f, -12.8076f, 0.1693f, 0.0607f, 0.4305f },
+    { -2.606f, -12.3783f, 0.237f, 0.061f, 0.4257f },
+    { -2.5669f, -11.4523f, 0.4187f, 0.059f, 0.4175f },
+    { -2.4868f, -11.8577f, 0.3923f, 0.0613f, 0.4207f },
+    { -2.3799f, -12.5586f, 0.3952f, 0.0643f, 0.426f },
+    { -2.47f, -12.8732f, 0.2595f, 0.0636f, 0.4289f },
+    { -2.3285f, -13.2473f, 0.4089f, 0.0666f, 0.4312f },
+    { -2.4143f, -13.2283f, 0.3061f, 0.0653f, 0.4314f },
+    { -2.4145f, -13.6159f, 0.4153f, 0.0668f, 0.4343f },
+    { -2.4802f, -13.506f, 0.2764f, 0.0652f, 0.4338f },
+    { -2.5918f, -13.2771f, 0.2143f, 0.0635f, 0.4326f },
+    { -2.5852f, -13.6587f, 0.3056f, 0.0649f, 0.4353f },
+    { -2.5753f, -13.7673f, 0.4079f, 0.0657f, 0.436f },
+    { -2.6997f, -13.6331f, 0.2558f, 0.0638f, 0.4358f },
+    { -2.7482f, -13.8041f, 0.3805f, 0.0645f, 0.4373f },
+    { -2.8225f, -13.5423f, 0.2185f, 0.0627f, 0.436f },
+    { -2.7098f, -13.0917f, 0.1855f, 0.0621f, 0.4319f },
+    { -2.8934f, -13.4406f, 0.166f, 0.0618f, 0.4361f },
+    { -2.7947f, -13.1122f, 0.1468f, 0.0615f, 0.4327f },
+    { -4.9196f, -4.7412f, 16.0622f, 0.3111f, 0.57f },
+    { -4.1236f, -3.6158f, 14.7123f, 0.2956f, 0.5906f },
+    { -3.2409f, -3.6172f, 13.6059f, 0.2779f, 0.5969f },
+    { -4.0444f, -2.5505f, 14.7592f, 0.2993f, 0.6038f },
+    { -3.1523f, -2.5366f, 13.631f, 0.2815f, 0.6098f },
+    { -2.4524f, -3.6434f, 12.972f, 0.2655f, 0.6017f },
+    { -2.4172f, -2.5404f, 12.9848f, 0.2694f, 0.6139f },
+    { -0.809f, 3.8951f, 13.4642f, 0.2512f, 0.6893f },
+    { -1.0679f, 4.5083f, 13.4715f, 0.2532f, 0.6974f },
+    { -0.8148f, 3.8808f, 13.3739f, 0.2505f, 0.6895f },
+    { -1.0686f, 5.3099f, 13.4643f, 0.2503f, 0.7062f },
+    { -0.9629f, 4.5819f, 13.3384f, 0.2505f, 0.698f },
+    { -0.9357f, 5.3614f, 13.2925f, 0.2469f, 0.706f },
+    { -0.9874f, 6.1292f, 13.4114f, 0.2442f, 0.7138f },
+    { -0.8556f, 4.6375f, 13.0955f, 0.2469f, 0.6983f },
+    { -0.7705f, 3.9314f, 13.1891f, 0.248f, 0.6903f },
+    { -0.4384f, 3.4047f, 13.3076f, 0.2455f, 0.683f },
+    { -0.0003f, 3.2044f, 13.2823f, 0.2394f, 0.677f },
+    { -0.424f, 3.4076f, 13.0803f, 0.2428f, 0.6838f },
+    { -0.0003f, 3.1774f, 13.036f, 0.2356f, 0.6768f },
+    { -0.6898f, 4.0069f, 12.9038f, 0.2444f, 0.6912f },
+    { -0.3809f, 3.5189f, 12.8005f, 0.2398f, 0.6855f },
+    { -0.0003f, 3.3104f, 12.7709f, 0.2342f, 0.6803f },
+    { -0.5452f, 4.1403f, 12.6526f, 0.2402f, 0.6924f },
+    { -0.3109f, 3.7168f, 12.5728f, 0.237f, 0.6877f },
+    { -0.0003f, 3.5827f, 12.5672f, 0.2327f, 0.6838f },
+    { -0.6809f, 4.7265f, 12.8654f, 0.2425f, 0.6985f },
+    { -0.2157f, 3.9799f, 12.502f, 0.2349f, 0.6902f },
+    { -0.0003f, 3.9734f, 12.5049f, 0.232f, 0.6896f },
+    { -0.3091f, 4.3642f, 12.57f, 0.2361f, 0.694f },
+    { -0.0003f, 4.4602f, 12.5706f, 0.2314f, 0.6954f },
+    { -0.3738f, 4.8999f, 12.7705f, 0.2375f, 0.6991f },
+    { -0.0003f, 5.0078f, 12.7568f, 0.2322f, 0.7f },
+    { -0.7476f, 5.4249f, 13.1158f, 0.2429f, 0.7055f },
+    { -0.4111f, 5.5524f, 13.0248f, 0.2378f, 0.7051f },
+    { -0.0003f, 5.632f, 13.0006f, 0.233f, 0.7046f },
+    { -0.7746f, 6.1852f, 13.3081f, 0.2407f, 0.7127f },
+    { -0.4223f, 6.2868f, 13.2541f, 0.2359f, 0.7112f },
+    { -0.0003f, 6.3489f, 13.2394f, 0.2305f, 0.7097f },
+    { -1.0083f, 7.0641f, 13.6114f, 0.2363f, 0.7219f },
+    { -0.7813f, 7.0881f, 13.5801f, 0.2335f, 0.7201f },
+    { -0.4235f, 7.1358f, 13.5768f, 0.2293f, 0.7176f },
+    { -0.0003f, 7.1643f, 13.5852f, 0.228f, 0.7148f },
+    { -0.0003f, 8.0842f, 14.1499f, 0.2115f, 0.7194f },
+    { -0.4308f, 8.1321f, 14.1111f, 0.2155f, 0.7238f },
+    { -0.0003f, 8.8934f, 14.65f, 0.1949f, 0.724f },
+    { -0.7872f, 8.2144f, 14.0696f, 0.2188f, 0.7276f },
+    { -0.4335f, 9.0048f, 14.5916f, 0.2024f, 0.7296f },
+    { -0.4209f, 9.4831f, 14.7527f, 0.1981f, 0.7348f },
+    { -0.0003f, 9.3768f, 14.8019f, 0.1945f, 0.7298f },
+    { -0.0003f, 9.6432f, 14.7088f, 0.1942f, 0.7355f },
+    { -0.3959f, 9.7159f, 14.6789f, 0.1982f, 0.7395f },
+    { -0.6971f, 10.0415f, 14.6663f, 0.2023f, 0.7435f },
+    { -0.7439f, 9.9177f, 14.7631f, 0.2017f, 0.7397f },
+    { -0.8269f, 9.5039f, 14.6277f, 0.2011f, 0.736f },
+    { -0.9929f, 9.6113f, 14.5338f, 0.2018f, 0.7389f },
+    { -0.9955f, 8.2893f, 14.0519f, 0.2209f, 0.7303f },
+    { -1.1288f, 9.7579f, 14.2589f, 0.2025f, 0.7418f },
+    { -1.1432f, 8.4623f, 13.8649f, 0.2227f, 0.7343f },
+    { -3.599f, -8.8419f, 4.2353f, 0.1149f, 0.5247f },
+    { -3.6533f, -8.6959f, 4.4355f, 0.118f, 0.5241f },
+    { -3.3445f, -8.8723f, 4.3502f, 0.1157f, 0.5284f },
+    { -3.1795f, -8.9167f, 4.5777f, 0.1183f, 0.5311f },
+    { -3.4686f, -8.7498f, 4.4716f, 0.1179f, 0.5266f },
+    { -3.4145f, -8.713f, 4.6363f, 0.12f, 0.5274f },
+    { -3.1098f, -8.938f, 4.8583f, 0.1218f, 0.5325f },
+    { -3.1414f, -8.8993f, 5.1325f, 0.1257f, 0.5321f },
+    { -3.3957f, -8.6808f, 5.0199f, 0.1249f, 0.528f },
+    { -3.2884f, -8.8258f, 5.3469f, 0.129f, 0.5301f },
+    { -3.4381f, -8.6966f, 5.1916f, 0.1273f, 0.5277f },
+    { -2.6679f, 13.2905f, 4.4611f, 0.263f, 0.9273f },
+    { -2.678f, 13.2148f, 3.9121f, 0.2601f, 0.9317f },
+    { -2.7813f, 13.7825f, 4.4305f, 0.26f, 0.9209f },
+    { -2.6442f, 13.3703f, 5.3946f, 0.2725f, 0.9174f },
+    { -2.7892f, 13.6883f, 3.7986f, 0.2552f, 0.9272f },
+    { -2.6841f, 13.1716f, 3.5777f, 0.2573f, 0.9361f },
+    { -2.7697f, 13.9109f, 5.4667f, 0.2682f, 0.9115f },
+    { -2.5929f, 13.3988f, 6.3365f, 0.282f, 0.9075f },
+    { -3.0052f, 14.1515f, 4.4014f, 0.2557f, 0.9163f },
+    { -2.727f, 13.9685f, 6.4935f, 0.277f, 0.9028f },
+    { -2.9968f, 14.3084f, 5.5096f, 0.2642f, 0.9063f },
+    { -2.6256f, 13.8501f, 7.0971f, 0.2835f, 0.8989f },
+    { -2.5004f, 13.3208f, 6.9105f, 0.2868f, 0.9049f },
+    { -2.9731f, 14.4757f, 6.7496f, 0.274f, 0.8953f },
+    { -2.5294f, 13.6209f, 7.4948f, 0.2887f, 0.897f },
+    { -2.4209f, 13.1583f, 7.2984f, 0.2916f, 0.9024f },
+    { -2.409f, 12.9331f, 7.6817f, 0.2959f, 0.8995f },
+    { -2.8142f, 14.2316f, 7.2845f, 0.2811f, 0.8935f },
+    { -2.7201f, 13.9705f, 7.6586f, 0.2864f, 0.8921f },
+    { -2.5022f, 13.3458f, 7.9037f, 0.2938f, 0.8943f },
+    { -2.3471f, 12.5546f, 8.2769f, 0.3003f, 0.8967f },
+    { -2.9396f, 14.4624f, 7.5246f, 0.2807f, 0.8892f },
+    { -2.4543f, 13.0012f, 8.5161f, 0.3004f, 0.8904f },
+    { -2.6862f, 13.6929f, 8.0586f, 0.2914f, 0.8896f },
+    { -2.869f, 14.2602f, 7.8254f, 0.2848f, 0.888f },
+    { -2.2954f, 12.5633f, 9.5243f, 0.3103f, 0.8846f },
+    { -2.1172f, 11.9321f, 9.3005f, 0.3133f, 0.8933f },
+    { -2.0936f, 12.0991f, 10.6999f, 0.322f, 0.8797f },
+    { -1.8522f, 11.2617f, 10.508f, 0.3264f, 0.8899f },
+    { -1.6844f, 10.7396f, 11.6546f, 0.3366f, 0.8904f },
+    { -1.9169f, 11.6756f, 11.8148f, 0.3341f, 0.8781f },
+    { -1.5365f, 10.3309f, 12.7013f, 0.3468f, 0.8909f },
+    { -2.4748f, 12.7983f, 10.8628f, 0.319f, 0.8697f },
+    { -1.7188f, 11.3124f, 12.8403f, 0.3455f, 0.8791f },
+    { -2.8435f, 13.1999f, 11.0367f, 0.3172f, 0.8621f },
+    { -2.6011f, 13.0899f, 9.7297f, 0.3077f, 0.8765f },
+    { -3.2501f, 13.3976f, 11.172f, 0.3153f, 0.8557f },
+    { -2.9093f, 13.4512f, 9.9636f, 0.3058f, 0.8695f },
+    { -2.706f, 13.4454f, 8.6674f, 0.2972f, 0.8842f },
+    { -3.2788f, 13.6603f, 10.1472f, 0.3037f, 0.863f },
+    { -2.8583f, 14.068f, 8.1466f, 0.2886f, 0.8858f },
+    { -2.9816f, 13.7747f, 9.1135f, 0.2966f, 0.8758f },
+    { -2.9309f, 13.9927f, 8.4628f, 0.2909f, 0.8822f },
+    { -3.1098f, 14.1413f, 8.7486f, 0.2907f, 0.8773f },
+    { -3.3262f, 14.01f, 9.3253f, 0.2941f, 0.8691f },
+    { -3.4023f, 14.3139f, 8.9435f, 0.2887f, 0.8717f },
+    { -3.7685f, 13.7303f, 10.2014f, 0.3001f, 0.8566f },
+    { -3.8064f, 14.0426f, 9.3755f, 0.2903f, 0.8628f },
+    { -3.7447f, 13.485f, 11.2192f, 0.312f, 0.8493f },
+    { -4.26f, 13.607f, 10.1431f, 0.2954f, 0.8504f },
+    { -4.5321f, 13.6144f, 9.0897f, 0.2802f, 0.8534f },
+    { -4.2618f, 13.9012f, 9.2888f, 0.2856f, 0.8574f },
+    { -3.8153f, 14.3107f, 8.987f, 0.2855f, 0.8665f },
+    { -4.2081f, 14.1817f, 8.9035f, 0.2816f, 0.8622f },
+    { -4.4401f, 13.977f, 8.7174f, 0.2772f, 0.8593f },
+    { -3.8251f, 14.5406f, 8.7855f, 0.283f, 0.8689f },
+    { -3.4553f, 14.5664f, 8.7506f, 0.2856f, 0.8731f },
+    { -4.1868f, 14.4263f, 8.7174f, 0.2798f, 0.8654f },
+    { -3.4335f, 14.762f, 8.4957f, 0.283f, 0.8755f },
+    { -3.8657f, 14.7383f, 8.5208f, 0.2801f, 0.8713f },
+    { -3.2064f, 14.4611f, 8.5935f, 0.2871f, 0.8772f },
+    { -3.1835f, 14.6447f, 8.3728f, 0.2846f, 0.8791f },
+    { -3.0542f, 14.2875f, 8.431f, 0.288f, 0.8806f },
+    { -3.0227f, 14.4066f, 8.2304f, 0.2861f, 0.8824f },
+    { -3.0002f, 14.5111f, 7.9803f, 0.2836f, 0.8846f },
+    { -3.1383f, 14.7446f, 8.1084f, 0.2824f, 0.8817f },
+    { -3.0435f, 14.6278f, 7.7321f, 0.2807f, 0.8859f },
+    { -3.1679f, 14.8133f, 7.8219f, 0.2796f, 0.8836f },
+    { -3.1066f, 14.7082f, 7.5154f, 0.278f, 0.8868f },
+    { -3.3972f, 14.8899f, 8.1883f, 0.2804f, 0.8784f },
+    { -3.407f, 14.9396f, 7.8383f, 0.2773f, 0.881f },
+    { -3.8912f, 14.8764f, 8.1987f, 0.277f, 0.874f },
+    { -3.8556f, 14.9277f, 7.8254f, 0.2741f, 0.8771f },
+    { -4.286f, 14.6127f, 8.4605f, 0.2767f, 0.8676f },
+    { -4.3673f, 14.7392f, 8.1476f, 0.2734f, 0.8699f },
+    { -4.2926f, 14.8042f, 7.7932f, 0.2707f, 0.8732f },
+    { -4.5727f, 14.5132f, 8.0429f, 0.2704f, 0.8674f },
+    { -4.5002f, 14.4242f, 8.3274f, 0.2736f, 0.8653f },
+    { -4.4119f, 14.2663f, 8.5655f, 0.2764f, 0.863f },
+    { -4.6362f, 14.2356f, 7.9033f, 0.2676f, 0.8657f },
+    { -4.5696f, 13.8206f, 8.4458f, 0.2726f, 0.8585f },
+    { -4.5945f, 14.1673f, 8.1872f, 0.2708f, 0.8633f },
+    { -4.5232f, 14.0866f, 8.4048f, 0.2734f, 0.8616f },
+    { -4.6547f, 13.8363f, 8.1059f, 0.2682f, 0.8605f },
+    { -4.7737f, 13.4527f, 8.0052f, 0.2647f, 0.8571f },
+    { -4.6865f, 13.9436f, 7.7476f, 0.2644f, 0.864f },
+    { -5.0441f, 13.0376f, 7.8069f, 0.2591f, 0.8533f },
+    { -4.8032f, 13.6092f, 7.5715f, 0.2603f, 0.8616f },
+    { -5.2359f, 12.5901f, 7.5638f, 0.2524f, 0.8492f },
+    { -5.0659f, 13.2046f, 7.3707f, 0.2547f, 0.8582f },
+    { -4.787f, 13.7421f, 7.1598f, 0.2565f, 0.8663f },
+    { -5.2478f, 12.7509f, 7.1641f, 0.2484f, 0.854f },
+    { -4.6558f, 14.0618f, 7.4207f, 0.2616f, 0.8678f },
+    { -5.0385f, 13.3506f, 6.9457f, 0.2508f, 0.8633f },
+    { -4.7306f, 13.8859f, 6.6101f, 0.2524f, 0.873f },
+    { -5.2064f, 12.8996f, 6.7635f, 0.2447f, 0.8591f },
+    { -5.122f, 12.2693f, 6.9706f, 0.242f, 0.8496f },
+    { -5.0868f, 12.4015f, 6.5981f, 0.2382f, 0.8544f },
+    { -5.0772f, 12.4876f, 6.0657f, 0.2331f, 0.8608f },
+    { -5.1795f, 12.9815f, 6.1921f, 0.2394f, 0.8656f },
+    { -4.8977f, 12.1239f, 5.2002f, 0.2199f, 0.8651f },
+    { -5.1576f, 12.5088f, 5.228f, 0.2253f, 0.8701f },
+    { -5.0359f, 13.4138f, 6.34f, 0.2452f, 0.8696f },
+    { -5.2347f, 12.9419f, 5.2802f, 0.2304f, 0.8746f },
+    { -5.1321f, 13.3325f, 5.3617f, 0.2355f, 0.8784f },
+    { -5.2569f, 12.4906f, 4.4438f, 0.2179f, 0.8786f },
+    { -5.3192f, 12.8563f, 4.4164f, 0.2218f, 0.8829f },
+    { -5.2531f, 13.2119f, 4.4195f, 0.226f, 0.8867f },
+    { -5.0132f, 12.1632f, 4.4882f, 0.2134f, 0.8736f },
+    { -5.3802f, 12.8001f, 3.9895f, 0.2175f, 0.8869f },
+    { -5.3038f, 12.4582f, 4.0719f, 0.2141f, 0.8824f },
+    { -4.5349f, 11.9224f, 4.5359f, 0.2077f, 0.8674f },
+    { -5.0411f, 12.1571f, 4.1574f, 0.2101f, 0.8772f },
+    { -4.5368f, 11.9222f, 4.2339f, 0.2044f, 0.8706f },
+    { -4.4975f, 11.8959f, 4.1032f, 0.2025f, 0.8715f },
+    { -5.0194f, 12.1215f, 4.0147f, 0.2081f, 0.8783f },
+    { -4.457f, 11.8622f, 3.9615f, 0.2004f, 0.8726f },
+    { -4.9858f, 12.072f, 3.8667f, 0.2059f, 0.8793f },
+    { -4.9459f, 11.978f, 3.6691f, 0.2029f, 0.8808f },
+    { -4.9056f, 11.8086f, 3.3773f, 0.1987f, 0.8834f },
+    { -5.3226f, 12.1838f, 3.5404f, 0.2063f, 0.8864f },
+    { -4.8499f, 11.5785f, 3.0087f, 0.1934f, 0.8868f },
+    { -5.2825f, 12.0091f, 3.2407f, 0.2021f, 0.8889f },
+    { -5.2072f, 11.7825f, 2.8724f, 0.197f, 0.892f },
+    { -4.7643f, 11.3021f, 2.5807f, 0.1875f, 0.8908f },
+    { -5.0926f, 11.498f, 2.4602f, 0.1911f, 0.8955f },
+    { -5.2361f, 11.4346f, 1.9754f, 0.1886f, 0.9031f },
+    { -5.3334f, 11.8202f, 2.3067f, 0.1948f, 0.9003f },
+    { -5.4398f, 12.1238f, 2.6931f, 0.2007f, 0.8974f },
+    { -5.495f, 12.2937f, 2.1221f, 0.1996f, 0.9059f },
+    { -5.5098f, 12.3232f, 3.0655f, 0.2054f, 0.8942f },
+    { -5.548f, 12.6695f, 2.4766f, 0.2057f, 0.9037f },
+    { -5.5732f, 12.8289f, 2.8574f, 0.21f, 0.9003f },
+    { -5.487f, 13.3522f, 2.1924f, 0.2117f, 0.9116f },
+    { -5.532f, 12.4698f, 3.3834f, 0.2093f, 0.8915f },
+    { -5.4149f, 13.4073f, 2.6432f, 0.2153f, 0.9072f },
+    { -5.3315f, 12.3127f, 3.7467f, 0.2095f, 0.8849f },
+    { -5.3211f, 12.4021f, 3.9078f, 0.212f, 0.8838f },
+    { -5.4954f, 12.6145f, 3.606f, 0.2125f, 0.8899f },
+    { -5.4336f, 12.7329f, 3.7893f, 0.2152f, 0.8887f },
+    { -5.4789f, 13.0078f, 3.4493f, 0.2162f, 0.8952f },
+    { -5.3254f, 13.1572f, 3.9221f, 0.2214f, 0.8913f },
+    { -5.3877f, 13.109f, 3.6664f, 0.219f, 0.8937f },
+    { -5.1164f, 13.5296f, 3.8622f, 0.2259f, 0.8962f },
+    { -5.1687f, 13.5105f, 3.5474f, 0.2235f, 0.8993f },
+    { -5.0454f, 13.5734f, 4.428f, 0.2308f, 0.8909f },
+    { -4.7618f, 13.9178f, 3.4405f, 0.229f, 0.906f },
+    { -4.8981f, 13.7097f, 5.4372f, 0.2406f, 0.8824f },
+    { -4.7301f, 13.9171f, 3.8018f, 0.2316f, 0.9022f },
+    { -4.5813f, 14.1026f, 5.4715f, 0.2459f, 0.8872f },
+    { -4.6826f, 13.9568f, 4.4169f, 0.2364f, 0.8963f },
+    { -4.4719f, 14.2986f, 6.5161f, 0.2559f, 0.879f },
+    { -4.2296f, 14.4173f, 5.4846f, 0.2509f, 0.8921f },
+    { -4.1844f, 14.599f, 6.5403f, 0.26f, 0.8832f },
+    { -4.4f, 14.4886f, 7.1013f, 0.2622f, 0.8754f },
+    { -4.1575f, 14.7311f, 7.1026f, 0.2652f, 0.879f },
+    { -4.561f, 14.2303f, 7.1853f, 0.2605f, 0.8717f },
+    { -4.5806f, 14.3372f, 7.6456f, 0.2656f, 0.8688f },
+    { -4.5116f, 14.3955f, 7.4241f, 0.264f, 0.8714f },
+    { -4.3977f, 14.609f, 7.4417f, 0.2659f, 0.8736f },
+    { -4.4969f, 14.596f, 7.7516f, 0.2682f, 0.8705f },
+    { -4.1824f, 14.8031f, 7.433f, 0.2682f, 0.8766f },
+    { -3.8132f, 14.9127f, 7.4503f, 0.2712f, 0.8802f },
+    { -3.8182f, 14.8521f, 7.1227f, 0.2684f, 0.8825f },
+    { -3.4413f, 14.9268f, 7.4818f, 0.2743f, 0.8834f },
+    { -3.8506f, 14.7373f, 6.5644f, 0.2636f, 0.8869f },
+    { -3.4785f, 14.8669f, 7.1552f, 0.2715f, 0.8857f },
+    { -3.2182f, 14.8342f, 7.516f, 0.2766f, 0.8855f },
+    { -3.2352f, 14.7909f, 7.1931f, 0.274f, 0.8879f },
+    { -3.5203f, 14.7524f, 6.5874f, 0.2667f, 0.8902f },
+    { -3.0638f, 14.6481f, 7.2964f, 0.2769f, 0.8892f },
+    { -3.2433f, 14.6832f, 6.6086f, 0.2695f, 0.893f },
+    { -3.2667f, 14.5111f, 5.5176f, 0.2609f, 0.9025f },
+    { -3.5684f, 14.5759f, 5.5077f, 0.2579f, 0.8993f },
+    { -3.8906f, 14.5599f, 5.4967f, 0.2547f, 0.896f },
+    { -4.2732f, 14.2653f, 4.4f, 0.2418f, 0.9017f },
+    { -3.9254f, 14.4022f, 4.3908f, 0.2457f, 0.9058f },
+    { -4.2957f, 14.2221f, 3.7506f, 0.2369f, 0.9081f },
+    { -3.6084f, 14.4137f, 4.3878f, 0.2489f, 0.9092f },
+    { -3.9422f, 14.3468f, 3.7179f, 0.2407f, 0.9123f },
+    { -4.3106f, 14.2238f, 3.3577f, 0.2343f, 0.9123f },
+    { -3.9582f, 14.3216f, 3.3112f, 0.2379f, 0.9167f },
+    { -4.3315f, 14.2068f, 3.0427f, 0.232f, 0.9155f },
+    { -4.8159f, 13.8932f, 3.1472f, 0.2266f, 0.9087f },
+    { -3.991f, 14.2545f, 3.004f, 0.2356f, 0.92f },
+    { -5.2598f, 13.4486f, 3.2914f, 0.2208f, 0.9013f },
+    { -4.3793f, 14.209f, 2.7256f, 0.2295f, 0.9185f },
+    { -4.8888f, 13.8862f, 2.8432f, 0.224f, 0.9113f },
+    { -5.5553f, 12.8992f, 3.2023f, 0.2131f, 0.8971f },
+    { -5.3538f, 13.3965f, 3.016f, 0.218f, 0.9035f },
+    { -4.9771f, 13.9399f, 2.4498f, 0.2211f, 0.9149f },
+    { -5.0299f, 13.953f, 2.0625f, 0.2182f, 0.9188f },
+    { -4.4746f, 14.2686f, 2.3265f, 0.2262f, 0.9218f },
+    { -4.5568f, 14.2672f, 1.953f, 0.2227f, 0.925f },
+    { -4.0445f, 14.2057f, 2.705f, 0.233f, 0.9229f },
+    { -4.1227f, 14.2354f, 2.323f, 0.2295f, 0.9261f },
+    { -4.5649f, 14.0867f, 1.7126f, 0.2198f, 0.9276f },
+    { -4.1874f, 14.2318f, 1.9618f, 0.2258f, 0.9291f },
+    { -3.8018f, 14.0926f, 2.7187f, 0.2354f, 0.9258f },
+    { -3.852f, 14.108f, 2.3525f, 0.2318f, 0.929f },
+    { -3.7237f, 14.179f, 2.9957f, 0.2382f, 0.9231f },
+    { -3.5682f, 14.0861f, 2.7043f, 0.2376f, 0.9285f },
+    { -3.6533f, 14.2885f, 3.2878f, 0.2408f, 0.9201f },
+    { -3.459f, 14.1231f, 2.9825f, 0.2407f, 0.9261f },
+    { -3.3444f, 14.202f, 3.2747f, 0.2437f, 0.9234f },
+    { -3.6258f, 14.3423f, 3.6999f, 0.2438f, 0.9158f },
+    { -3.3028f, 14.2596f, 3.6927f, 0.2469f, 0.9192f },
+    { -3.0579f, 14.0048f, 3.3049f, 0.2473f, 0.927f },
+    { -3.2913f, 14.346f, 4.3893f, 0.2521f, 0.9125f },
+    { -3.0113f, 14.0559f, 3.7182f, 0.2506f, 0.9229f },
+    { -2.8201f, 13.6399f, 3.4112f, 0.252f, 0.9311f },
+    { -2.6956f, 13.1894f, 3.2881f, 0.2543f, 0.9384f },
+    { -2.9002f, 13.649f, 3.1086f, 0.2487f, 0.9337f },
+    { -2.6939f, 13.2283f, 2.9969f, 0.2513f, 0.9408f },
+    { -3.1876f, 13.9814f, 3.0062f, 0.244f, 0.9294f },
+    { -2.9625f, 13.7031f, 2.8133f, 0.2454f, 0.9362f },
+    { -2.6603f, 13.2481f, 2.6574f, 0.2482f, 0.9452f },
+    { -3.3024f, 14.0137f, 2.7173f, 0.2405f, 0.9318f },
+    { -2.9397f, 13.7896f, 2.4479f, 0.2421f, 0.94f },
+    { -2.6119f, 13.2531f, 2.3349f, 0.2451f, 0.9497f },
+    { -3.5936f, 14.1541f, 2.3288f, 0.2339f, 0.9319f },
+    { -3.3039f, 14.1294f, 2.3333f, 0.237f, 0.9353f },
+    { -2.8759f, 13.8538f, 2.0993f, 0.2391f, 0.9438f },
+    { -3.2462f, 14.2213f, 1.961f, 0.2339f, 0.9391f },
+    { -2.815f, 13.8408f, 1.8546f, 0.237f, 0.9467f },
+    { -2.566f, 13.2472f, 2.0944f, 0.2428f, 0.9519f },
+    { -3.183f, 14.1825f, 1.707f, 0.2318f, 0.942f },
+    { -3.5698f, 14.2149f, 1.9608f, 0.2306f, 0.9354f },
+    { -3.8743f, 14.1224f, 1.9955f, 0.2282f, 0.9322f },
+    { -3.5318f, 14.1565f, 1.7054f, 0.2282f, 0.9381f },
+    { -4.201f, 14.0832f, 1.7254f, 0.2228f, 0.9316f },
+    { -3.8687f, 14.0333f, 1.7461f, 0.2254f, 0.9348f },
+    { -3.1287f, 14.0029f, 1.4731f, 0.2295f, 0.9452f },
+    { -3.4986f, 13.9696f, 1.4811f, 0.2257f, 0.9412f },
+    { -3.8642f, 13.8448f, 1.5321f, 0.2225f, 0.9375f },
+    { -2.7654f, 13.737f, 1.6227f, 0.2345f, 0.9496f },
+    { -2.5268f, 13.2282f, 1.858f, 0.2405f, 0.9541f },
+    { -2.4987f, 13.1936f, 1.5477f, 0.2363f, 0.9571f },
+    { -2.7351f, 13.5287f, 1.3126f, 0.2307f, 0.9537f },
+    { -2.4653f, 13.1511f, 1.2609f, 0.2321f, 0.9601f },
+    { -3.0978f, 13.6725f, 1.1611f, 0.2257f, 0.95f },
+    { -2.6741f, 13.3199f, 1.0333f, 0.2273f, 0.958f },
+    { -2.5325f, 13.2146f, 0.8934f, 0.2262f, 0.9614f },
+    { -2.4104f, 13.1086f, 1.0948f, 0.2306f, 0.9612f },
+    { -2.3647f, 12.9214f, 1.0142f, 0.2291f, 0.9623f },
+    { -2.3774f, 12.9855f, 0.8619f, 0.2261f, 0.9643f },
+    { -2.3833f, 12.8375f, 0.6664f, 0.2231f, 0.9662f },
+    { -2.6434f, 13.1002f, 0.6732f, 0.2219f, 0.9624f },
+    { -2.3414f, 12.6068f, 0.4877f, 0.2198f, 0.9695f },
+    { -3.0138f, 13.2667f, 0.7857f, 0.2211f, 0.9565f },
+    { -2.635f, 12.8592f, 0.4857f, 0.2179f, 0.9652f },
+    { -2.2997f, 12.3866f, 0.3184f, 0.2165f, 0.9729f },
+    { -2.5793f, 12.6109f, 0.317f, 0.2141f, 0.9688f },
+    { -3.0162f, 12.9151f, 0.5509f, 0.2159f, 0.9602f },
+    { -2.9456f, 12.4995f, 0.3132f, 0.2117f, 0.9647f },
+    { -3.4813f, 13.2665f, 0.9354f, 0.2179f, 0.9501f },
+    { -3.451f, 12.917f, 0.7223f, 0.2138f, 0.9541f },
+    { -3.4895f, 13.6452f, 1.2064f, 0.2221f, 0.9455f },
+    { -3.9161f, 13.2305f, 1.0341f, 0.2149f, 0.9445f },
+    { -3.89f, 13.5613f, 1.2814f, 0.2189f, 0.9409f },
+    { -4.348f, 13.2133f, 0.9243f, 0.2111f, 0.94f },
+    { -4.2792f, 13.5353f, 1.2185f, 0.2155f, 0.9369f },
+    { -4.2146f, 13.8356f, 1.5117f, 0.2196f, 0.9339f },
+    { -4.5734f, 13.8063f, 1.4798f, 0.2166f, 0.9301f },
+    { -4.6565f, 13.5055f, 1.129f, 0.2123f, 0.933f },
+    { -4.9964f, 13.8245f, 1.7772f, 0.2159f, 0.9221f },
+    { -4.9643f, 13.6212f, 1.4966f, 0.2132f, 0.9253f },
+    { -5.3747f, 13.4026f, 1.816f, 0.211f, 0.9173f },
+    { -5.5771f, 12.7266f, 1.923f, 0.2035f, 0.9112f },
+    { -5.3177f, 13.3207f, 1.5193f, 0.2093f, 0.921f },
+    { -5.4469f, 11.7963f, 1.8391f, 0.1926f, 0.9076f },
+    { -5.5992f, 12.1551f, 1.7022f, 0.1964f, 0.9116f },
+    { -5.579f, 12.9272f, 1.726f, 0.2051f, 0.9151f },
+    { -5.7371f, 11.9687f, 1.4458f, 0.1937f, 0.9152f },
+    { -5.6772f, 12.4365f, 1.5788f, 0.1991f, 0.9146f },
+    { -5.564f, 12.9453f, 1.5051f, 0.2047f, 0.9181f },
+    { -5.6675f, 12.5954f, 1.4694f, 0.2006f, 0.9169f },
+    { -5.7385f, 12.3895f, 1.3236f, 0.1978f, 0.918f },
+    { -5.5954f, 12.8308f, 1.234f, 0.2024f, 0.921f },
+    { -5.3442f, 13.2014f, 1.1697f, 0.2066f, 0.9244f },
+    { -5.0214f, 13.4103f, 1.1237f, 0.2096f, 0.9286f },
+    { -5.4137f, 13.0534f, 0.8611f, 0.2036f, 0.9271f },
+    { -4.8228f, 13.1786f, 0.7216f, 0.2069f, 0.9356f },
+    { -5.133f, 13.2275f, 0.7955f, 0.2061f, 0.9309f },
+    { -5.647f, 12.6061f, 0.9763f, 0.1991f, 0.9233f },
+    { -5.4855f, 12.8852f, 0.6873f, 0.2012f, 0.9284f },
+    { -5.783f, 12.0397f, 1.1267f, 0.1936f, 0.9198f },
+    { -5.6924f, 12.2936f, 0.7961f, 0.1953f, 0.925f },
+    { -5.7281f, 11.9804f, 0.6435f, 0.1918f, 0.9265f },
+    { -5.5069f, 12.7056f, 0.5702f, 0.1992f, 0.9297f },
+    { -5.2643f, 13.1085f, 0.6491f, 0.204f, 0.9312f },
+    { -5.2087f, 13.0115f, 0.5674f, 0.2031f, 0.933f },
+    { -5.5396f, 12.504f, 0.4328f, 0.1969f, 0.9311f },
+    { -5.216f, 12.8164f, 0.4395f, 0.2009f, 0.9347f },
+    { -4.8155f, 12.8843f, 0.5204f, 0.2036f, 0.9388f },
+    { -5.561f, 12.3288f, 0.2808f, 0.1947f, 0.9324f },
+    { -4.3743f, 12.9009f, 0.7071f, 0.2073f, 0.9431f },
+    { -5.2517f, 12.6133f, 0.2858f, 0.1983f, 0.936f },
+    { -4.8398f, 12.5126f, 0.2917f, 0.1985f, 0.9415f },
+    { -5.2811f, 12.4924f, 0.127f, 0.1963f, 0.9367f },
+    { -5.0317f, 12.2898f, 0.1087f, 0.1942f, 0.9401f },
+    { -5.1215f, 12.0645f, 0.0041f, 0.191f, 0.9395f },
+    { -5.0677f, 11.5443f, -0.0736f, 0.1847f, 0.941f },
+    { -5.308f, 12.2094f, -0.007f, 0.1925f, 0.9371f },
+    { -5.5485f, 12.2282f, 0.1196f, 0.1931f, 0.9338f },
+    { -5.497f, 12.0291f, 0.0246f, 0.1907f, 0.935f },
+    { -5.7492f, 11.6076f, 0.2882f, 0.1871f, 0.9301f },
+    { -5.3358f, 11.52f, -0.0864f, 0.1846f, 0.9377f },
+    { -5.7148f, 11.5362f, 0.1162f, 0.1858f, 0.932f },
+    { -5.5946f, 11.5151f, -0.0182f, 0.1851f, 0.9344f },
+    { -5.3751f, 10.7717f, -0.1204f, 0.1764f, 0.9377f },
+    { -4.9195f, 11.5813f, 0.0349f, 0.1857f, 0.9432f },
+    { -4.8997f, 10.761f, -0.018f, 0.174f, 0.9462f },
+    { -4.8158f, 11.6087f, 0.1186f, 0.1869f, 0.9451f },
+    { -4.7528f, 10.6761f, 0.0655f, 0.1747f, 0.9486f },
+    { -4.5915f, 12.1963f, 0.1789f, 0.1959f, 0.946f },
+    { -4.6813f, 11.604f, 0.0567f, 0.1877f, 0.9473f },
+    { -4.6009f, 10.9963f, -0.0087f, 0.1804f, 0.9506f },
+    { -4.3979f, 10.6039f, 0.0299f, 0.1756f, 0.9545f },
+    { -4.4593f, 11.9864f, 0.1127f, 0.1941f, 0.9486f },
+    { -4.388f, 10.7553f, -0.0301f, 0.1781f, 0.9545f },
+    { -4.0721f, 10.5339f, 0.0638f, 0.1764f, 0.9605f },
+    { -4.5079f, 11.5797f, -0.0179f, 0.1884f, 0.9498f },
+    { -4.4984f, 11.1684f, -0.0533f, 0.1832f, 0.9514f },
+    { -4.2497f, 12.0792f, 0.2064f, 0.197f, 0.9505f },
+    { -4.2874f, 11.5482f, 0.0277f, 0.1896f, 0.9525f },
+    { -4.3519f, 11.0297f, -0.0797f, 0.1823f, 0.954f },
+    { -3.8812f, 12.0388f, 0.3108f, 0.1992f, 0.9549f },
+    { -4.1162f, 10.7105f, -0.0286f, 0.1786f, 0.9584f },
+    { -3.8737f, 10.5192f, 0.0811f, 0.1772f, 0.9625f },
+    { -3.8589f, 10.6913f, -0.025f, 0.1796f, 0.9618f },
+    { -3.6622f, 10.5269f, 0.076f, 0.1779f, 0.9646f },
+    { -4.1187f, 10.9579f, -0.0673f, 0.1826f, 0.9571f },
+    { -4.0581f, 11.4619f, 0.0828f, 0.1901f, 0.9555f },
+    { -3.8506f, 10.8908f, -0.0771f, 0.183f, 0.9607f },
+    { -3.8585f, 11.2731f, 0.0368f, 0.1886f, 0.9587f },
+    { -3.5936f, 10.7045f, -0.0173f, 0.1811f, 0.9651f },
+    { -3.2743f, 10.5918f, 0.0589f, 0.1807f, 0.9707f },
+    { -3.2981f, 10.7573f, -0.003f, 0.1833f, 0.9688f },
+    { -2.8726f, 10.6615f, 0.108f, 0.1834f, 0.9769f },
+    { -3.5849f, 10.9576f, -0.0578f, 0.1852f, 0.9636f },
+    { -3.6696f, 11.464f, 0.0887f, 0.1921f, 0.9601f },
+    { -3.351f, 11.0505f, -0.0564f, 0.1873f, 0.9663f },
+    { -3.4405f, 11.5693f, 0.0432f, 0.1942f, 0.9627f },
+    { -3.0749f, 11.0075f, 0.0283f, 0.1879f, 0.9706f },
+    { -2.8826f, 11.5879f, 0.1515f, 0.1976f, 0.9708f },
+    { -3.1987f, 11.1931f, -0.0235f, 0.1899f, 0.9679f },
+    { -3.0265f, 11.6131f, 0.087f, 0.1966f, 0.9684f },
+    { -3.2125f, 11.6115f, 0.0071f, 0.1955f, 0.9658f },
+    { -3.1592f, 12.1993f, 0.1962f, 0.2044f, 0.9637f },
+    { -3.4374f, 12.6182f, 0.5443f, 0.2098f, 0.957f },
+    { -3.2841f, 12.0036f, 0.1294f, 0.2009f, 0.963f },
+    { -3.9127f, 12.9004f, 0.8307f, 0.211f, 0.948f },
+    { -3.479f, 12.3916f, 0.3787f, 0.2061f, 0.9582f },
+    { -3.8978f, 12.6076f, 0.6539f, 0.2074f, 0.9509f },
+    { -4.3567f, 12.6195f, 0.5338f, 0.2039f, 0.9459f },
+    { -3.8895f, 12.3891f, 0.4865f, 0.2042f, 0.9528f },
+    { -4.294f, 12.391f, 0.371f, 0.2011f, 0.9483f },
+    { -3.5041f, 12.0907f, 0.2152f, 0.2014f, 0.9596f },
+    { -5.7503f, 11.7537f, 0.4691f, 0.1891f, 0.9282f },
+    { -5.8177f, 10.7737f, 0.3017f, 0.1788f, 0.9287f },
+    { -5.7938f, 10.3245f, 0.5859f, 0.1751f, 0.925f },
+    { -5.7681f, 10.1508f, 0.3154f, 0.1726f, 0.9279f },
+    { -5.7757f, 10.7287f, 0.1138f, 0.1776f, 0.931f },
+    { -5.7268f, 10.1182f, 0.1091f, 0.1714f, 0.9303f },
+    { -5.6491f, 10.7403f, -0.0294f, 0.1769f, 0.9337f },
+    { -5.4362f, 10.3119f, -0.1181f, 0.1716f, 0.9362f },
+    { -0.0003f, 10.0436f, 14.2586f, 0.3856f, 0.9139f },
+    { -0.3377f, 10.0681f, 14.2426f, 0.3831f, 0.9089f },
+    { -0.0002f, 10.5616f, 14.2227f, 0.3905f, 0.9056f },
+    { -0.3615f, 9.8522f, 14.4546f, 0.3788f, 0.9108f },
+    { -0.0003f, 9.8015f, 14.4742f, 0.3812f, 0.9164f },
+    { -0.0003f, 9.6432f, 14.7088f, 0.3768f, 0.9189f },
+    { -0.3959f, 9.7159f, 14.6789f, 0.3744f, 0.9109f },
+    { -0.5471f, 10.1991f, 14.2905f, 0.3814f, 0.9051f },
+    { -0.3448f, 10.5396f, 14.2058f, 0.3869f, 0.9036f },
+    { -2.4078f, -17.5103f, 19.4856f, 0.3121f, 0.3799f },
+    { -2.3197f, -17.6362f, 20.1669f, 0.3188f, 0.3761f },
+    { -1.5475f, -18.1215f, 20.5639f, 0.318f, 0.3639f },
+    { -2.6664f, -22.045f, 32.7682f, 0.215f, 0.1334f },
+    { -2.638f, -22.0696f, 32.8595f, 0.2186f, 0.14f },
+    { -2.8081f, -21.9612f, 32.7774f, 0.2023f, 0.136f },
+    { -2.8256f, -21.941f, 32.7152f, 0.1997f, 0.1314f },
+    { -2.4649f, -22.1216f, 32.8619f, 0.2324f, 0.1382f },
+    { -2.9354f, -21.8576f, 32.7333f, 0.1892f, 0.1345f },
+    { -2.7764f, -21.9896f, 32.8592f, 0.2063f, 0.1418f },
+    { -2.915f, -21.8738f, 32.7886f, 0.1918f, 0.1385f },
+    { -2.9468f, -21.8583f, 32.6977f, 0.1852f, 0.1316f },
+    { -2.8345f, -21.9364f, 32.6753f, 0.1979f, 0.1275f },
+    { -2.6769f, -22.0227f, 32.7005f, 0.2129f, 0.1284f },
+    { -2.6789f, -22.0143f, 32.658f, 0.2106f, 0.1235f },
+    { -2.4898f, -22.1055f, 32.7681f, 0.2293f, 0.1315f },
+    { -2.4951f, -22.0851f, 32.6988f, 0.2278f, 0.1263f },
+    { -2.4928f, -22.0755f, 32.6555f, 0.2272f, 0.1218f },
+    { -2.2957f, -22.1135f, 32.7126f, 0.2435f, 0.1254f },
+    { -2.2895f, -22.1044f, 32.6696f, 0.2438f, 0.1201f },
+    { -2.2978f, -22.1314f, 32.7797f, 0.2441f, 0.1305f },
+    { -2.094f, -22.0934f, 32.7447f, 0.259f, 0.1261f },
+    { -2.0824f, -22.0849f, 32.7026f, 0.2599f, 0.1218f },
+    { -2.1102f, -22.1116f, 32.8059f, 0.2582f, 0.1307f },
+    { -2.2848f, -22.141f, 32.8679f, 0.2459f, 0.1368f },
+    { -2.1253f, -22.1234f, 32.8789f, 0.2577f, 0.1362f },
+    { -2.2592f, -22.1438f, 32.9745f, 0.2489f, 0.1443f },
+    { -2.1274f, -22.1285f, 32.9658f, 0.2584f, 0.1424f },
+    { -2.4277f, -22.1325f, 32.9759f, 0.2365f, 0.1462f },
+    { -2.2238f, -22.1414f, 33.0969f, 0.2527f, 0.1527f },
+    { -2.5978f, -22.0924f, 32.9699f, 0.2233f, 0.1478f },
+    { -2.3853f, -22.1374f, 33.1057f, 0.2411f, 0.1553f },
+    { -2.1045f, -22.1263f, 33.0685f, 0.261f, 0.1494f },
+    { -2.0462f, -22.108f, 32.9636f, 0.2642f, 0.1414f },
+    { -2.1872f, -22.1332f, 33.2131f, 0.2567f, 0.1606f },
+    { -2.0145f, -22.1023f, 33.0233f, 0.267f, 0.1453f },
+    { -2.0048f, -22.0945f, 32.9071f, 0.2667f, 0.1371f },
+    { -2.0704f, -22.1158f, 33.1665f, 0.2646f, 0.156f },
+    { -1.9412f, -22.0797f, 32.9643f, 0.2718f, 0.1405f },
+    { -1.9816f, -22.0916f, 33.1018f, 0.2702f, 0.1505f },
+    { -1.9604f, -22.0765f, 32.8466f, 0.2694f, 0.1324f },
+    { -1.927f, -22.0558f, 32.7903f, 0.2716f, 0.128f },
+    { -1.9071f, -22.0466f, 32.7491f, 0.2759f, 0.1234f },
+    { -1.8814f, -22.0566f, 32.9015f, 0.2756f, 0.1355f },
+    { -1.8316f, -22.0315f, 32.8447f, 0.2789f, 0.1311f },
+    { -1.7989f, -22.0192f, 32.8037f, 0.2819f, 0.127f },
+    { -1.9072f, -22.067f, 33.0308f, 0.2749f, 0.1447f },
+    { -1.8431f, -22.0419f, 32.9621f, 0.2789f, 0.1394f },
+    { -1.7854f, -22.016f, 32.9045f, 0.2826f, 0.1349f },
+    { -1.7455f, -22.0037f, 32.8649f, 0.2878f, 0.1305f },
+    { -1.8153f, -22.0222f, 33.0199f, 0.2817f, 0.143f },
+    { -1.7663f, -22.0049f, 32.9665f, 0.2846f, 0.1389f },
+    { -1.7345f, -22.0012f, 32.9309f, 0.2873f, 0.1353f },
+    { -1.7452f, -22.0087f, 32.9762f, 0.2867f, 0.1401f },
+    { -1.7629f, -22.0056f, 33.0132f, 0.2858f, 0.1431f },
+    { -1.7992f, -22.013f, 33.0616f, 0.285f, 0.146f },
+    { -1.875f, -22.0444f, 33.0866f, 0.2781f, 0.1482f },
+    { -1.8526f, -22.0311f, 33.1239f, 0.2813f, 0.1513f },
+    { -1.9487f, -22.0696f, 33.1615f, 0.2735f, 0.1542f },
+    { -1.9249f, -22.0563f, 33.1987f, 0.2776f, 0.1567f },
+    { -2.0392f, -22.0961f, 33.2395f, 0.2679f, 0.1607f },
+    { -2.0178f, -22.0853f, 33.2844f, 0.2711f, 0.1646f },
+    { -2.1578f, -22.1188f, 33.3008f, 0.26f, 0.1665f },
+    { -2.1394f, -22.1131f, 33.3554f, 0.2645f, 0.1724f },
+    { -2.3454f, -22.1372f, 33.2295f, 0.2455f, 0.1638f },
+    { -2.3155f, -22.1327f, 33.3254f, 0.249f, 0.1703f },
+    { -2.2979f, -22.1352f, 33.3863f, 0.252f, 0.1758f },
+    { -2.5517f, -22.1094f, 33.0954f, 0.2284f, 0.1566f },
+    { -2.5104f, -22.1197f, 33.215f, 0.2331f, 0.1649f },
+    { -2.4842f, -22.1222f, 33.3079f, 0.2362f, 0.1714f },
+    { -2.4712f, -22.1286f, 33.3671f, 0.2395f, 0.1792f },
+    { -2.6474f, -22.0725f, 33.1683f, 0.2214f, 0.1634f },
+    { -2.6356f, -22.0716f, 33.243f, 0.2231f, 0.1689f },
+    { -2.6376f, -22.0705f, 33.2883f, 0.2235f, 0.1735f },
+    { -2.6859f, -22.0526f, 33.0663f, 0.217f, 0.1563f },
+    { -2.7332f, -22.0218f, 33.1208f, 0.2133f, 0.1612f },
+    { -2.7592f, -22.0038f, 33.1502f, 0.2113f, 0.1639f },
+    { -2.7789f, -21.9918f, 33.1779f, 0.2074f, 0.1677f },
+    { -2.7847f, -21.9892f, 33.0428f, 0.2078f, 0.156f },
+    { -2.8449f, -21.9417f, 33.0491f, 0.2021f, 0.1574f },
+    { -2.8771f, -21.9229f, 33.0644f, 0.1981f, 0.1598f },
+    { -2.7344f, -22.0217f, 32.9568f, 0.2114f, 0.1486f },
+    { -2.8372f, -21.9448f, 32.9467f, 0.2016f, 0.1494f },
+    { -2.8814f, -21.9046f, 32.8609f, 0.1961f, 0.1435f },
+    { -2.9057f, -21.886f, 32.9502f, 0.1948f, 0.1508f },
+    { -2.9456f, -21.8632f, 32.9574f, 0.1887f, 0.1518f },
+    { -2.9546f, -21.8372f, 32.8642f, 0.1886f, 0.145f },
+    { -2.9975f, -21.8118f, 32.8668f, 0.1824f, 0.1463f },
+    { -2.9875f, -21.8028f, 32.7947f, 0.1842f, 0.1402f },
+    { -3.0278f, -21.7754f, 32.7969f, 0.1762f, 0.1409f },
+    { -3.0002f, -21.7902f, 32.7455f, 0.1821f, 0.1367f },
+    { -3.0314f, -21.7607f, 32.7519f, 0.1768f, 0.1384f },
+    { -3.0031f, -21.7964f, 32.7156f, 0.1813f, 0.1338f },
+    { -3.0221f, -21.7745f, 32.7298f, 0.1774f, 0.1359f },
+};
+
+static unsigned short dog_indices[] = {
+    0, 1, 2,
+    1, 3, 2,
+    1, 4, 3,
+    5, 2, 3,
+    4, 6, 3,
+    4, 7, 6,
+    8, 5, 3,
+    8, 3, 6,
+    7, 9, 6,
+    7, 10, 9,
+    11, 8, 6,
+    11, 6, 9,
+    5, 8, 12,
+    8, 11, 13,
+    8, 13, 12,
+    5, 12, 14,
+    15, 5, 14,
+    16, 12, 13,
+    15, 14, 17,
+    18, 15, 17,
+    19, 14, 12,
+    16, 19, 12,
+    19, 20, 14,
+    20, 17, 14,
+    19, 16, 21,
+    20, 19, 22,
+    19, 21, 22,
+    20, 23, 17,
+    18, 17, 24,
+    23, 24, 17,
+    25, 18, 24,
+    23, 20, 26,
+    20, 22, 26,
+    25, 24, 27,
+    28, 25, 27,
+    29, 27, 24,
+    23, 29, 24,
+    28, 27, 30,
+    31, 28, 30,
+    29, 32, 27,
+    32, 30, 27,
+    29, 23, 33,
+    23, 26, 33,
+    32, 29, 34,
+    29, 33, 34,
+    32, 35, 30,
+    31, 30, 36,
+    35, 36, 30,
+    37, 31, 36,
+    35, 32, 38,
+    32, 34, 38,
+    37, 36, 39,
+    40, 37, 39,
+    41, 39, 36,
+    35, 41, 36,
+    40, 39, 42,
+    43, 40, 42,
+    43, 42, 44,
+    45, 42, 39,
+    41, 45, 39,
+    42, 46, 44,
+    42, 45, 46,
+    47, 44, 46,
+    48, 47, 46,
+    47, 48, 49,
+    45, 50, 46,
+    48, 46, 50,
+    45, 51, 50,
+    45, 41, 51,
+    52, 48, 50,
+    41, 53, 51,
+    41, 35, 53,
+    35, 38, 53,
+    51, 54, 50,
+    52, 50, 54,
+    55, 51, 53,
+    51, 55, 54,
+    56, 55, 53,
+    56, 53, 38,
+    55, 57, 54,
+    58, 56, 38,
+    58, 38, 34,
+    55, 56, 59,
+    55, 59, 57,
+    56, 58, 60,
+    56, 60, 59,
+    61, 58, 34,
+    61, 34, 33,
+    58, 62, 60,
+    58, 61, 62,
+    63, 61, 33,
+    63, 33, 26,
+    61, 64, 62,
+    61, 63, 64,
+    65, 63, 26,
+    65, 26, 22,
+    63, 66, 64,
+    63, 65, 66,
+    67, 65, 22,
+    67, 22, 21,
+    65, 68, 66,
+    65, 67, 68,
+    69, 66, 68,
+    67, 70, 68,
+    69, 71, 66,
+    71, 64, 66,
+    72, 69, 68,
+    72, 68, 70,
+    71, 73, 64,
+    73, 62, 64,
+    73, 74, 62,
+    74, 60, 62,
+    73, 71, 75,
+    74, 76, 60,
+    76, 59, 60,
+    73, 77, 74,
+    77, 73, 75,
+    77, 78, 74,
+    76, 74, 78,
+    77, 75, 79,
+    59, 76, 80,
+    59, 80, 57,
+    81, 77, 79,
+    77, 81, 78,
+    81, 79, 82,
+    81, 83, 78,
+    84, 82, 79,
+    85, 78, 83,
+    85, 76, 78,
+    86, 85, 83,
+    76, 85, 87,
+    86, 88, 85,
+    88, 87, 85,
+    86, 83, 89,
+    86, 89, 88,
+    83, 90, 89,
+    83, 81, 90,
+    89, 91, 88,
+    81, 92, 90,
+    92, 81, 82,
+    93, 89, 90,
+    89, 93, 91,
+    94, 90, 92,
+    94, 93, 90,
+    92, 82, 95,
+    96, 94, 92,
+    96, 92, 95,
+    93, 94, 97,
+    94, 96, 98,
+    94, 98, 97,
+    93, 97, 99,
+    93, 99, 91,
+    97, 100, 99,
+    101, 91, 99,
+    97, 102, 100,
+    102, 97, 98,
+    103, 99, 100,
+    103, 101, 99,
+    102, 104, 100,
+    105, 103, 100,
+    105, 100, 104,
+    103, 105, 106,
+    107, 105, 104,
+    108, 106, 105,
+    107, 108, 105,
+    109, 103, 106,
+    109, 106, 108,
+    107, 104, 110,
+    108, 107, 111,
+    107, 110, 111,
+    104, 112, 110,
+    104, 102, 112,
+    113, 111, 110,
+    114, 110, 112,
+    114, 113, 110,
+    102, 115, 112,
+    116, 114, 112,
+    116, 112, 115,
+    115, 102, 117,
+    118, 116, 115,
+    102, 119, 117,
+    119, 102, 98,
+    118, 115, 120,
+    115, 117, 120,
+    118, 120, 121,
+    118, 121, 116,
+    122, 120, 117,
+    121, 123, 116,
+    114, 116, 123,
+    120, 124, 121,
+    120, 122, 124,
+    125, 121, 124,
+    121, 125, 123,
+    126, 125, 124,
+    125, 127, 123,
+    126, 124, 128,
+    122, 128, 124,
+    125, 126, 129,
+    125, 129, 127,
+    130, 126, 128,
+    126, 131, 129,
+    126, 130, 131,
+    132, 129, 131,
+    130, 128, 133,
+    129, 132, 134,
+    129, 134, 127,
+    130, 135, 131,
+    136, 132, 131,
+    136, 131, 135,
+    135, 130, 137,
+    130, 133, 137,
+    138, 136, 135,
+    135, 137, 139,
+    138, 135, 139,
+    140, 139, 137,
+    136, 138, 141,
+    142, 140, 137,
+    142, 137, 133,
+    136, 141, 143,
+    132, 136, 143,
+    132, 143, 144,
+    132, 144, 134,
+    145, 143, 141,
+    143, 146, 144,
+    143, 145, 146,
+    147, 134, 144,
+    148, 144, 146,
+    148, 147, 144,
+    147, 149, 134,
+    149, 127, 134,
+    148, 150, 147,
+    149, 151, 127,
+    151, 123, 127,
+    151, 114, 123,
+    114, 151, 152,
+    113, 114, 152,
+    149, 153, 151,
+    153, 152, 151,
+    153, 149, 154,
+    149, 147, 154,
+    150, 154, 147,
+    153, 155, 152,
+    153, 154, 156,
+    155, 153, 156,
+    150, 157, 154,
+    157, 156, 154,
+    155, 158, 152,
+    113, 152, 158,
+    155, 156, 159,
+    160, 113, 158,
+    113, 160, 111,
+    155, 161, 158,
+    161, 155, 159,
+    160, 158, 162,
+    161, 162, 158,
+    160, 163, 111,
+    108, 111, 163,
+    164, 160, 162,
+    160, 164, 163,
+    165, 108, 163,
+    165, 109, 108,
+    164, 166, 163,
+    165, 163, 166,
+    164, 167, 166,
+    109, 165, 168,
+    167, 164, 169,
+    164, 162, 169,
+    170, 169, 162,
+    161, 170, 162,
+    167, 169, 171,
+    170, 161, 172,
+    161, 159, 172,
+    170, 173, 169,
+    170, 172, 173,
+    173, 171, 169,
+    172, 174, 173,
+    173, 175, 171,
+    175, 173, 174,
+    172, 176, 174,
+    176, 172, 159,
+    177, 175, 174,
+    178, 176, 159,
+    178, 159, 156,
+    157, 178, 156,
+    176, 179, 174,
+    177, 174, 179,
+    176, 178, 180,
+    176, 180, 179,
+    178, 157, 181,
+    178, 181, 180,
+    157, 182, 181,
+    157, 150, 182,
+    183, 180, 181,
+    150, 184, 182,
+    150, 148, 184,
+    185, 181, 182,
+    185, 183, 181,
+    186, 185, 182,
+    186, 182, 184,
+    183, 185, 187,
+    185, 186, 188,
+    185, 188, 187,
+    189, 186, 184,
+    186, 190, 188,
+    186, 189, 190,
+    189, 184, 191,
+    148, 191, 184,
+    191, 148, 146,
+    191, 146, 192,
+    145, 192, 146,
+    193, 189, 191,
+    193, 191, 192,
+    189, 193, 194,
+    189, 194, 190,
+    193, 192, 195,
+    193, 196, 194,
+    196, 193, 195,
+    197, 195, 192,
+    145, 197, 192,
+    196, 195, 198,
+    145, 199, 197,
+    199, 145, 141,
+    197, 200, 195,
+    200, 198, 195,
+    199, 201, 197,
+    200, 197, 201,
+    199, 141, 202,
+    138, 202, 141,
+    203, 199, 202,
+    199, 203, 201,
+    202, 138, 204,
+    138, 139, 204,
+    203, 202, 205,
+    202, 204, 205,
+    206, 204, 139,
+    140, 206, 139,
+    207, 205, 204,
+    206, 207, 204,
+    206, 140, 208,
+    207, 206, 209,
+    206, 208, 209,
+    140, 210, 208,
+    140, 142, 210,
+    211, 209, 208,
+    212, 208, 210,
+    212, 211, 208,
+    142, 213, 210,
+    214, 212, 210,
+    214, 210, 213,
+    142, 215, 213,
+    215, 142, 133,
+    216, 214, 213,
+    215, 133, 217,
+    128, 217, 133,
+    128, 122, 217,
+    215, 218, 213,
+    216, 213, 218,
+    219, 215, 217,
+    215, 219, 218,
+    219, 217, 220,
+    122, 220, 217,
+    219, 221, 218,
+    122, 222, 220,
+    222, 122, 117,
+    222, 117, 119,
+    223, 219, 220,
+    219, 223, 221,
+    222, 224, 220,
+    223, 220, 224,
+    222, 225, 224,
+    225, 222, 119,
+    226, 223, 224,
+    225, 119, 227,
+    119, 98, 227,
+    96, 227, 98,
+    225, 227, 228,
+    96, 229, 227,
+    229, 228, 227,
+    230, 225, 228,
+    230, 228, 229,
+    225, 230, 224,
+    226, 224, 230,
+    231, 230, 229,
+    231, 226, 230,
+    231, 229, 232,
+    226, 231, 233,
+    234, 232, 229,
+    96, 234, 229,
+    235, 231, 232,
+    234, 96, 236,
+    96, 95, 236,
+    234, 237, 232,
+    234, 236, 238,
+    237, 234, 238,
+    237, 239, 232,
+    235, 232, 239,
+    237, 238, 240,
+    239, 237, 241,
+    237, 240, 241,
+    242, 235, 239,
+    239, 241, 243,
+    242, 239, 243,
+    244, 243, 241,
+    235, 242, 245,
+    246, 244, 241,
+    246, 241, 240,
+    235, 245, 247,
+    231, 235, 247,
+    231, 247, 233,
+    248, 247, 245,
+    249, 233, 247,
+    248, 249, 247,
+    249, 250, 233,
+    250, 251, 233,
+    226, 233, 251,
+    223, 226, 251,
+    223, 251, 221,
+    250, 252, 251,
+    252, 221, 251,
+    252, 250, 253,
+    250, 249, 253,
+    252, 254, 221,
+    254, 218, 221,
+    254, 216, 218,
+    254, 252, 255,
+    254, 255, 216,
+    252, 253, 255,
+    255, 256, 216,
+    214, 216, 256,
+    257, 255, 253,
+    255, 257, 256,
+    258, 214, 256,
+    214, 258, 212,
+    257, 259, 256,
+    258, 256, 259,
+    260, 257, 253,
+    260, 253, 249,
+    248, 260, 249,
+    257, 260, 261,
+    257, 261, 259,
+    260, 248, 262,
+    260, 262, 261,
+    248, 263, 262,
+    264, 261, 262,
+    248, 265, 263,
+    265, 248, 245,
+    266, 262, 263,
+    266, 264, 262,
+    265, 267, 263,
+    268, 266, 263,
+    268, 263, 267,
+    264, 266, 269,
+    266, 268, 270,
+    266, 270, 269,
+    264, 269, 271,
+    261, 264, 271,
+    261, 271, 259,
+    272, 259, 271,
+    272, 258, 259,
+    273, 271, 269,
+    273, 272, 271,
+    258, 272, 274,
+    258, 274, 212,
+    211, 212, 274,
+    272, 275, 274,
+    272, 273, 275,
+    276, 211, 274,
+    276, 274, 275,
+    211, 276, 277,
+    211, 277, 209,
+    278, 276, 275,
+    277, 279, 209,
+    207, 209, 279,
+    276, 280, 277,
+    276, 278, 280,
+    281, 277, 280,
+    277, 281, 279,
+    282, 207, 279,
+    207, 282, 205,
+    281, 283, 279,
+    282, 279, 283,
+    282, 284, 205,
+    203, 205, 284,
+    285, 282, 283,
+    282, 285, 284,
+    286, 203, 284,
+    203, 286, 201,
+    285, 287, 284,
+    286, 284, 287,
+    288, 201, 286,
+    288, 200, 201,
+    289, 286, 287,
+    289, 288, 286,
+    200, 288, 290,
+    200, 290, 198,
+    288, 289, 291,
+    288, 291, 290,
+    289, 292, 291,
+    290, 293, 198,
+    292, 289, 294,
+    289, 287, 294,
+    295, 290, 291,
+    290, 295, 293,
+    296, 291, 292,
+    296, 295, 291,
+    297, 296, 292,
+    297, 292, 298,
+    292, 294, 298,
+    297, 299, 296,
+    297, 298, 300,
+    299, 297, 300,
+    299, 301, 296,
+    295, 296, 301,
+    299, 300, 302,
+    299, 303, 301,
+    303, 299, 302,
+    304, 295, 301,
+    303, 305, 301,
+    304, 301, 305,
+    303, 306, 305,
+    295, 304, 307,
+    306, 303, 308,
+    303, 302, 308,
+    309, 295, 307,
+    295, 309, 293,
+    309, 307, 310,
+    311, 293, 309,
+    312, 309, 310,
+    312, 311, 309,
+    311, 313, 293,
+    313, 198, 293,
+    313, 196, 198,
+    313, 314, 196,
+    314, 194, 196,
+    313, 311, 315,
+    314, 313, 315,
+    314, 316, 194,
+    316, 190, 194,
+    314, 315, 317,
+    316, 314, 317,
+    316, 318, 190,
+    318, 188, 190,
+    316, 317, 319,
+    318, 316, 319,
+    318, 320, 188,
+    320, 187, 188,
+    318, 319, 321,
+    320, 318, 321,
+    187, 320, 322,
+    320, 321, 323,
+    320, 323, 322,
+    187, 322, 324,
+    183, 187, 324,
+    325, 322, 323,
+    183, 324, 326,
+    180, 183, 326,
+    180, 326, 179,
+    327, 324, 322,
+    325, 327, 322,
+    328, 326, 324,
+    327, 328, 324,
+    329, 179, 326,
+    328, 329, 326,
+    329, 177, 179,
+    328, 327, 330,
+    329, 328, 331,
+    328, 330, 331,
+    177, 329, 332,
+    329, 331, 332,
+    177, 332, 333,
+    175, 177, 333,
+    334, 332, 331,
+    175, 333, 335,
+    175, 335, 171,
+    336, 333, 332,
+    334, 336, 332,
+    333, 336, 337,
+    333, 337, 335,
+    336, 334, 338,
+    336, 338, 337,
+    334, 339, 338,
+    340, 337, 338,
+    334, 341, 339,
+    341, 334, 331,
+    341, 331, 330,
+    342, 338, 339,
+    342, 340, 338,
+    341, 343, 339,
+    344, 342, 339,
+    344, 339, 343,
+    340, 342, 345,
+    342, 344, 346,
+    342, 346, 345,
+    344, 347, 346,
+    340, 345, 348,
+    344, 349, 347,
+    349, 344, 343,
+    350, 340, 348,
+    340, 350, 337,
+    350, 335, 337,
+    350, 351, 335,
+    351, 171, 335,
+    351, 167, 171,
+    167, 351, 166,
+    352, 166, 351,
+    350, 352, 351,
+    352, 165, 166,
+    352, 350, 353,
+    350, 348, 353,
+    165, 352, 354,
+    352, 353, 354,
+    165, 354, 168,
+    355, 354, 353,
+    356, 168, 354,
+    355, 356, 354,
+    357, 355, 353,
+    357, 353, 348,
+    355, 358, 356,
+    359, 357, 348,
+    359, 348, 345,
+    355, 357, 360,
+    358, 355, 360,
+    359, 361, 357,
+    361, 360, 357,
+    362, 359, 345,
+    362, 345, 346,
+    361, 359, 363,
+    359, 362, 363,
+    364, 362, 346,
+    364, 346, 347,
+    365, 363, 362,
+    364, 365, 362,
+    365, 366, 363,
+    365, 364, 367,
+    366, 368, 363,
+    361, 363, 368,
+    366, 365, 369,
+    365, 367, 369,
+    370, 361, 368,
+    361, 370, 360,
+    370, 371, 360,
+    358, 360, 371,
+    370, 368, 372,
+    370, 373, 371,
+    373, 370, 372,
+    374, 358, 371,
+    373, 375, 371,
+    374, 371, 375,
+    358, 374, 376,
+    358, 376, 356,
+    377, 374, 375,
+    378, 356, 376,
+    356, 378, 168,
+    374, 379, 376,
+    374, 377, 379,
+    380, 378, 376,
+    380, 376, 379,
+    378, 381, 168,
+    109, 168, 381,
+    103, 109, 381,
+    378, 382, 381,
+    378, 380, 382,
+    103, 381, 383,
+    382, 383, 381,
+    384, 103, 383,
+    103, 384, 101,
+    382, 385, 383,
+    384, 383, 386,
+    385, 386, 383,
+    385, 382, 387,
+    380, 387, 382,
+    385, 388, 386,
+    380, 389, 387,
+    389, 380, 379,
+    390, 385, 387,
+    385, 390, 388,
+    389, 391, 387,
+    390, 387, 391,
+    389, 379, 392,
+    377, 392, 379,
+    393, 389, 392,
+    389, 393, 391,
+    377, 394, 392,
+    393, 392, 395,
+    394, 395, 392,
+    394, 377, 396,
+    377, 375, 396,
+    394, 397, 395,
+    398, 396, 375,
+    373, 398, 375,
+    394, 396, 399,
+    397, 394, 399,
+    398, 400, 396,
+    400, 399, 396,
+    398, 373, 401,
+    373, 372, 401,
+    400, 398, 402,
+    398, 401, 402,
+    400, 403, 399,
+    400, 402, 404,
+    403, 400, 404,
+    403, 405, 399,
+    397, 399, 405,
+    403, 404, 406,
+    403, 407, 405,
+    407, 403, 406,
+    408, 397, 405,
+    407, 409, 405,
+    408, 405, 409,
+    407, 410, 409,
+    410, 407, 411,
+    407, 406, 411,
+    410, 412, 409,
+    413, 411, 406,
+    414, 409, 412,
+    414, 408, 409,
+    415, 414, 412,
+    416, 413, 406,
+    416, 406, 404,
+    413, 416, 417,
+    418, 416, 404,
+    418, 404, 402,
+    416, 419, 417,
+    416, 418, 419,
+    420, 417, 419,
+    421, 418, 402,
+    421, 402, 401,
+    418, 422, 419,
+    418, 421, 422,
+    423, 420, 419,
+    423, 419, 422,
+    420, 423, 424,
+    423, 425, 424,
+    426, 424, 425,
+    427, 423, 422,
+    423, 427, 425,
+    428, 426, 425,
+    426, 428, 429,
+    427, 430, 425,
+    428, 425, 430,
+    427, 422, 431,
+    421, 431, 422,
+    432, 427, 431,
+    427, 432, 430,
+    421, 433, 431,
+    433, 421, 401,
+    433, 401, 372,
+    433, 434, 431,
+    432, 431, 434,
+    435, 433, 372,
+    433, 435, 434,
+    435, 372, 368,
+    366, 435, 368,
+    435, 366, 436,
+    435, 436, 434,
+    366, 369, 436,
+    437, 434, 436,
+    437, 432, 434,
+    438, 436, 369,
+    438, 437, 436,
+    432, 437, 439,
+    432, 439, 430,
+    437, 438, 440,
+    437, 440, 439,
+    441, 438, 369,
+    441, 369, 367,
+    438, 442, 440,
+    438, 441, 442,
+    443, 440, 442,
+    441, 444, 442,
+    443, 445, 440,
+    445, 439, 440,
+    446, 443, 442,
+    446, 442, 444,
+    445, 447, 439,
+    447, 430, 439,
+    447, 428, 430,
+    428, 447, 448,
+    428, 448, 429,
+    449, 429, 448,
+    447, 450, 448,
+    447, 445, 450,
+    451, 449, 448,
+    451, 448, 450,
+    449, 451, 452,
+    445, 453, 450,
+    445, 443, 453,
+    454, 451, 450,
+    454, 450, 453,
+    451, 455, 452,
+    451, 454, 455,
+    456, 452, 455,
+    457, 456, 455,
+    456, 457, 458,
+    454, 459, 455,
+    457, 455, 459,
+    454, 460, 459,
+    460, 454, 453,
+    461, 457, 459,
+    460, 453, 462,
+    443, 462, 453,
+    443, 446, 462,
+    460, 463, 459,
+    461, 459, 463,
+    464, 460, 462,
+    460, 464, 463,
+    464, 462, 465,
+    446, 465, 462,
+    464, 466, 463,
+    446, 467, 465,
+    467, 446, 444,
+    468, 464, 465,
+    464, 468, 466,
+    467, 469, 465,
+    468, 465, 469,
+    467, 470, 469,
+    471, 468, 469,
+    470, 467, 472,
+    467, 444, 472,
+    470, 473, 469,
+    471, 469, 473,
+    470, 474, 473,
+    475, 471, 473,
+    474, 470, 476,
+    470, 472, 476,
+    474, 477, 473,
+    475, 473, 477,
+    477, 474, 478,
+    479, 475, 477,
+    474, 480, 478,
+    474, 476, 480,
+    477, 478, 481,
+    479, 477, 481,
+    482, 481, 478,
+    483, 482, 478,
+    483, 478, 480,
+    482, 484, 481,
+    482, 483, 485,
+    482, 485, 484,
+    484, 486, 481,
+    479, 481, 486,
+    485, 487, 484,
+    484, 488, 486,
+    488, 484, 487,
+    489, 479, 486,
+    488, 490, 486,
+    489, 486, 490,
+    479, 489, 491,
+    475, 479, 491,
+    492, 489, 490,
+    475, 491, 493,
+    471, 475, 493,
+    494, 491, 489,
+    492, 494, 489,
+    494, 495, 491,
+    495, 493, 491,
+    494, 492, 496,
+    495, 494, 497,
+    494, 496, 497,
+    495, 498, 493,
+    471, 493, 499,
+    498, 499, 493,
+    468, 471, 499,
+    468, 499, 466,
+    500, 466, 499,
+    498, 500, 499,
+    500, 501, 466,
+    501, 463, 466,
+    501, 461, 463,
+    500, 498, 502,
+    501, 500, 503,
+    500, 502, 503,
+    461, 501, 504,
+    501, 503, 504,
+    461, 504, 505,
+    457, 461, 505,
+    457, 505, 458,
+    506, 458, 505,
+    507, 506, 505,
+    507, 505, 504,
+    506, 507, 508,
+    509, 507, 504,
+    509, 504, 503,
+    507, 510, 508,
+    507, 509, 510,
+    511, 508, 510,
+    512, 509, 503,
+    512, 503, 502,
+    509, 513, 510,
+    509, 512, 513,
+    514, 511, 510,
+    514, 510, 513,
+    511, 514, 515,
+    514, 516, 515,
+    517, 515, 516,
+    518, 514, 513,
+    514, 518, 516,
+    519, 517, 516,
+    517, 519, 520,
+    518, 521, 516,
+    519, 516, 521,
+    518, 513, 522,
+    512, 522, 513,
+    523, 518, 522,
+    518, 523, 521,
+    512, 524, 522,
+    524, 512, 502,
+    523, 522, 525,
+    524, 525, 522,
+    524, 502, 526,
+    498, 526, 502,
+    498, 495, 526,
+    495, 497, 526,
+    527, 524, 526,
+    527, 526, 497,
+    524, 527, 525,
+    528, 527, 497,
+    528, 497, 496,
+    527, 529, 525,
+    527, 528, 529,
+    530, 525, 529,
+    530, 523, 525,
+    528, 531, 529,
+    523, 530, 532,
+    523, 532, 521,
+    533, 530, 529,
+    533, 529, 531,
+    530, 534, 532,
+    530, 533, 534,
+    535, 521, 532,
+    535, 519, 521,
+    536, 535, 532,
+    536, 532, 534,
+    519, 535, 537,
+    519, 537, 520,
+    538, 520, 537,
+    535, 539, 537,
+    535, 536, 539,
+    540, 538, 537,
+    540, 537, 539,
+    538, 540, 541,
+    540, 542, 541,
+    543, 541, 542,
+    544, 540, 539,
+    540, 544, 542,
+    545, 543, 542,
+    543, 545, 546,
+    544, 547, 542,
+    545, 542, 547,
+    544, 539, 548,
+    536, 548, 539,
+    549, 544, 548,
+    544, 549, 547,
+    536, 550, 548,
+    550, 536, 534,
+    549, 548, 551,
+    550, 551, 548,
+    550, 534, 552,
+    533, 552, 534,
+    550, 553, 551,
+    553, 550, 552,
+    533, 554, 552,
+    554, 533, 531,
+    553, 552, 555,
+    554, 555, 552,
+    556, 553, 555,
+    554, 557, 555,
+    553, 556, 558,
+    553, 558, 551,
+    556, 555, 559,
+    557, 559, 555,
+    556, 560, 558,
+    561, 556, 559,
+    556, 561, 560,
+    562, 551, 558,
+    562, 549, 551,
+    563, 562, 558,
+    563, 558, 560,
+    549, 562, 564,
+    549, 564, 547,
+    562, 563, 565,
+    562, 565, 564,
+    566, 547, 564,
+    566, 545, 547,
+    567, 564, 565,
+    567, 566, 564,
+    545, 566, 568,
+    545, 568, 546,
+    569, 546, 568,
+    566, 570, 568,
+    566, 567, 570,
+    571, 569, 568,
+    571, 568, 570,
+    569, 571, 572,
+    571, 573, 572,
+    574, 572, 573,
+    575, 571, 570,
+    571, 575, 573,
+    576, 574, 573,
+    574, 576, 577,
+    575, 578, 573,
+    576, 573, 578,
+    575, 570, 579,
+    567, 579, 570,
+    580, 575, 579,
+    575, 580, 578,
+    567, 581, 579,
+    581, 567, 565,
+    580, 579, 582,
+    581, 582, 579,
+    581, 565, 583,
+    563, 583, 565,
+    581, 584, 582,
+    584, 581, 583,
+    563, 585, 583,
+    585, 563, 560,
+    584, 583, 586,
+    585, 586, 583,
+    585, 560, 587,
+    561, 587, 560,
+    585, 588, 586,
+    588, 585, 587,
+    561, 589, 587,
+    588, 587, 590,
+    589, 590, 587,
+    589, 561, 591,
+    561, 559, 591,
+    590, 589, 592,
+    593, 591, 559,
+    557, 593, 559,
+    589, 591, 594,
+    589, 594, 592,
+    591, 593, 595,
+    591, 595, 594,
+    593, 557, 596,
+    593, 597, 595,
+    593, 596, 597,
+    557, 598, 596,
+    557, 554, 598,
+    554, 531, 598,
+    599, 598, 531,
+    528, 599, 531,
+    599, 528, 496,
+    599, 600, 598,
+    600, 596, 598,
+    599, 496, 601,
+    600, 599, 601,
+    492, 601, 496,
+    596, 600, 602,
+    596, 602, 597,
+    600, 601, 603,
+    600, 603, 602,
+    601, 492, 604,
+    601, 604, 603,
+    492, 490, 604,
+    605, 604, 490,
+    488, 605, 490,
+    606, 603, 604,
+    605, 606, 604,
+    488, 607, 605,
+    607, 488, 487,
+    606, 605, 608,
+    607, 608, 605,
+    606, 609, 603,
+    609, 602, 603,
+    610, 606, 608,
+    609, 611, 602,
+    611, 597, 602,
+    609, 606, 612,
+    606, 610, 612,
+    611, 609, 613,
+    609, 612, 613,
+    611, 614, 597,
+    614, 595, 597,
+    614, 611, 615,
+    611, 613, 615,
+    614, 616, 595,
+    616, 594, 595,
+    616, 614, 617,
+    614, 615, 617,
+    616, 618, 594,
+    618, 592, 594,
+    618, 616, 619,
+    616, 617, 619,
+    618, 620, 592,
+    618, 619, 621,
+    620, 618, 621,
+    620, 622, 592,
+    590, 592, 622,
+    620, 621, 623,
+    624, 590, 622,
+    624, 588, 590,
+    620, 625, 622,
+    625, 620, 623,
+    624, 622, 626,
+    625, 626, 622,
+    588, 624, 627,
+    588, 627, 586,
+    628, 624, 626,
+    624, 628, 627,
+    629, 586, 627,
+    629, 584, 586,
+    630, 627, 628,
+    630, 629, 627,
+    584, 629, 631,
+    584, 631, 582,
+    629, 630, 632,
+    629, 632, 631,
+    633, 582, 631,
+    633, 580, 582,
+    634, 631, 632,
+    634, 633, 631,
+    580, 633, 635,
+    580, 635, 578,
+    633, 634, 636,
+    633, 636, 635,
+    637, 578, 635,
+    637, 576, 578,
+    638, 635, 636,
+    638, 637, 635,
+    576, 637, 639,
+    576, 639, 577,
+    415, 577, 639,
+    414, 415, 639,
+    637, 640, 639,
+    414, 639, 640,
+    637, 638, 640,
+    408, 414, 640,
+    408, 640, 641,
+    638, 641, 640,
+    397, 408, 641,
+    397, 641, 395,
+    638, 642, 641,
+    642, 395, 641,
+    642, 638, 636,
+    642, 393, 395,
+    642, 636, 643,
+    393, 642, 643,
+    634, 643, 636,
+    393, 643, 391,
+    634, 644, 643,
+    644, 391, 643,
+    644, 634, 632,
+    644, 390, 391,
+    644, 632, 645,
+    390, 644, 645,
+    630, 645, 632,
+    390, 645, 388,
+    630, 646, 645,
+    646, 388, 645,
+    646, 630, 628,
+    388, 646, 647,
+    388, 647, 386,
+    646, 628, 648,
+    646, 648, 647,
+    628, 626, 648,
+    649, 386, 647,
+    649, 384, 386,
+    650, 647, 648,
+    650, 649, 647,
+    651, 648, 626,
+    651, 650, 648,
+    625, 651, 626,
+    649, 650, 652,
+    651, 625, 653,
+    625, 623, 653,
+    650, 651, 654,
+    650, 654, 652,
+    651, 655, 654,
+    655, 651, 656,
+    651, 653, 656,
+    657, 654, 655,
+    658, 656, 653,
+    657, 659, 654,
+    659, 652, 654,
+    660, 657, 655,
+    660, 655, 661,
+    655, 656, 661,
+    657, 660, 662,
+    660, 661, 662,
+    657, 662, 663,
+    659, 657, 663,
+    664, 662, 661,
+    665, 661, 656,
+    665, 664, 661,
+    658, 665, 656,
+    664, 666, 662,
+    666, 663, 662,
+    665, 667, 664,
+    666, 664, 668,
+    667, 668, 664,
+    666, 669, 663,
+    667, 665, 670,
+    665, 658, 670,
+    666, 671, 669,
+    671, 666, 668,
+    669, 672, 663,
+    659, 663, 672,
+    671, 673, 669,
+    674, 659, 672,
+    659, 674, 652,
+    669, 675, 672,
+    675, 669, 673,
+    674, 672, 676,
+    675, 676, 672,
+    674, 677, 652,
+    649, 652, 677,
+    384, 649, 677,
+    384, 677, 101,
+    674, 678, 677,
+    678, 101, 677,
+    678, 674, 676,
+    101, 678, 91,
+    678, 88, 91,
+    88, 678, 87,
+    678, 676, 87,
+    679, 87, 676,
+    679, 76, 87,
+    675, 679, 676,
+    76, 679, 80,
+    675, 680, 679,
+    680, 80, 679,
+    680, 675, 673,
+    680, 681, 80,
+    681, 57, 80,
+    680, 673, 682,
+    681, 680, 682,
+    681, 683, 57,
+    683, 54, 57,
+    683, 52, 54,
+    683, 681, 684,
+    681, 682, 684,
+    52, 683, 685,
+    683, 684, 685,
+    52, 685, 686,
+    48, 52, 686,
+    48, 686, 49,
+    687, 49, 686,
+    688, 687, 686,
+    688, 686, 685,
+    687, 688, 689,
+    690, 688, 685,
+    690, 685, 684,
+    688, 691, 689,
+    688, 690, 691,
+    692, 689, 691,
+    693, 690, 684,
+    693, 684, 682,
+    690, 694, 691,
+    690, 693, 694,
+    695, 692, 691,
+    695, 691, 694,
+    692, 695, 696,
+    695, 697, 696,
+    698, 696, 697,
+    699, 695, 694,
+    695, 699, 697,
+    699, 694, 700,
+    693, 700, 694,
+    699, 701, 697,
+    693, 702, 700,
+    702, 693, 682,
+    702, 682, 673,
+    671, 702, 673,
+    702, 671, 703,
+    702, 703, 700,
+    671, 668, 703,
+    704, 700, 703,
+    704, 699, 700,
+    699, 704, 701,
+    705, 703, 668,
+    705, 704, 703,
+    667, 705, 668,
+    704, 705, 706,
+    704, 706, 701,
+    705, 667, 707,
+    705, 707, 706,
+    667, 670, 707,
+    708, 706, 707,
+    709, 707, 670,
+    709, 708, 707,
+    710, 709, 670,
+    710, 670, 658,
+    708, 709, 711,
+    712, 710, 658,
+    712, 658, 653,
+    712, 653, 623,
+    709, 710, 713,
+    709, 713, 711,
+    710, 712, 714,
+    710, 714, 713,
+    715, 712, 623,
+    712, 715, 714,
+    715, 623, 621,
+    716, 715, 621,
+    716, 621, 619,
+    717, 714, 715,
+    716, 717, 715,
+    717, 718, 714,
+    718, 713, 714,
+    717, 716, 719,
+    718, 720, 713,
+    720, 711, 713,
+    718, 717, 721,
+    718, 721, 720,
+    717, 719, 721,
+    720, 722, 711,
+    721, 723, 720,
+    722, 720, 723,
+    721, 724, 723,
+    724, 721, 719,
+    725, 722, 723,
+    724, 726, 723,
+    725, 723, 726,
+    727, 724, 719,
+    724, 728, 726,
+    724, 727, 728,
+    727, 719, 729,
+    716, 729, 719,
+    729, 716, 619,
+    729, 619, 617,
+    730, 729, 617,
+    730, 727, 729,
+    730, 617, 615,
+    727, 730, 731,
+    727, 731, 728,
+    732, 730, 615,
+    732, 615, 613,
+    730, 733, 731,
+    734, 732, 613,
+    734, 613, 612,
+    730, 732, 735,
+    733, 730, 735,
+    734, 736, 732,
+    736, 735, 732,
+    737, 734, 612,
+    737, 612, 610,
+    736, 734, 738,
+    734, 737, 738,
+    736, 739, 735,
+    736, 738, 740,
+    739, 736, 740,
+    739, 741, 735,
+    733, 735, 741,
+    739, 740, 742,
+    743, 733, 741,
+    741, 739, 744,
+    739, 742, 744,
+    743, 741, 745,
+    741, 744, 745,
+    743, 746, 733,
+    743, 745, 746,
+    746, 731, 733,
+    746, 747, 731,
+    747, 728, 731,
+    745, 748, 746,
+    747, 746, 748,
+    728, 747, 749,
+    728, 749, 726,
+    750, 747, 748,
+    751, 726, 749,
+    751, 725, 726,
+    747, 752, 749,
+    747, 750, 752,
+    753, 751, 749,
+    753, 749, 752,
+    725, 751, 754,
+    751, 753, 755,
+    751, 755, 754,
+    725, 754, 756,
+    722, 725, 756,
+    757, 754, 755,
+    722, 756, 758,
+    722, 758, 711,
+    708, 711, 758,
+    759, 708, 758,
+    708, 759, 706,
+    759, 701, 706,
+    759, 758, 760,
+    756, 760, 758,
+    759, 761, 701,
+    761, 759, 760,
+    761, 697, 701,
+    761, 698, 697,
+    761, 760, 762,
+    698, 761, 762,
+    756, 763, 760,
+    763, 762, 760,
+    763, 756, 754,
+    757, 763, 754,
+    698, 762, 764,
+    765, 698, 764,
+    766, 765, 767,
+    765, 764, 767,
+    768, 767, 764,
+    769, 768, 764,
+    769, 764, 762,
+    768, 769, 770,
+    763, 769, 762,
+    769, 771, 770,
+    769, 763, 771,
+    772, 770, 771,
+    763, 773, 771,
+    763, 757, 773,
+    774, 772, 771,
+    774, 771, 773,
+    772, 774, 775,
+    776, 772, 775,
+    777, 774, 773,
+    776, 775, 778,
+    779, 776, 778,
+    779, 778, 780,
+    781, 775, 774,
+    777, 781, 774,
+    782, 778, 775,
+    781, 782, 775,
+    778, 783, 780,
+    778, 782, 783,
+    784, 780, 783,
+    785, 784, 783,
+    784, 785, 786,
+    782, 787, 783,
+    785, 783, 787,
+    782, 788, 787,
+    782, 781, 788,
+    789, 785, 787,
+    781, 790, 788,
+    781, 777, 790,
+    788, 791, 787,
+    789, 787, 791,
+    788, 792, 791,
+    792, 788, 790,
+    793, 789, 791,
+    792, 794, 791,
+    793, 791, 794,
+    795, 792, 790,
+    792, 796, 794,
+    792, 795, 796,
+    795, 790, 797,
+    777, 797, 790,
+    795, 798, 796,
+    797, 777, 799,
+    777, 773, 799,
+    757, 799, 773,
+    800, 795, 797,
+    795, 800, 798,
+    797, 799, 801,
+    800, 797, 801,
+    757, 802, 799,
+    802, 801, 799,
+    802, 757, 755,
+    800, 801, 803,
+    802, 755, 804,
+    753, 804, 755,
+    802, 805, 801,
+    805, 802, 804,
+    805, 803, 801,
+    753, 806, 804,
+    806, 753, 752,
+    805, 804, 807,
+    806, 807, 804,
+    808, 805, 807,
+    805, 808, 803,
+    806, 809, 807,
+    806, 752, 810,
+    809, 806, 810,
+    750, 810, 752,
+    809, 811, 807,
+    808, 807, 811,
+    809, 810, 812,
+    750, 813, 810,
+    813, 812, 810,
+    813, 750, 814,
+    750, 748, 814,
+    812, 813, 815,
+    813, 814, 816,
+    813, 816, 815,
+    817, 814, 748,
+    745, 817, 748,
+    817, 745, 744,
+    814, 818, 816,
+    814, 817, 818,
+    819, 817, 744,
+    819, 744, 742,
+    817, 820, 818,
+    821, 819, 742,
+    817, 819, 822,
+    821, 742, 823,
+    740, 823, 742,
+    819, 821, 824,
+    819, 824, 822,
+    740, 825, 823,
+    825, 740, 738,
+    826, 821, 823,
+    827, 825, 738,
+    827, 738, 737,
+    825, 828, 823,
+    826, 823, 828,
+    829, 827, 737,
+    829, 737, 610,
+    829, 610, 830,
+    610, 608, 830,
+    827, 829, 831,
+    829, 830, 831,
+    827, 831, 832,
+    825, 827, 832,
+    833, 831, 830,
+    825, 832, 834,
+    828, 825, 834,
+    835, 832, 831,
+    833, 835, 831,
+    835, 836, 832,
+    836, 834, 832,
+    835, 833, 837,
+    836, 835, 838,
+    835, 837, 838,
+    836, 839, 834,
+    836, 838, 840,
+    839, 836, 840,
+    839, 841, 834,
+    828, 834, 841,
+    839, 840, 842,
+    839, 842, 841,
+    843, 828, 841,
+    843, 826, 828,
+    842, 844, 841,
+    843, 841, 844,
+    842, 845, 844,
+    826, 843, 846,
+    845, 842, 847,
+    840, 847, 842,
+    826, 846, 848,
+    821, 826, 848,
+    821, 848, 824,
+    849, 824, 848,
+    850, 848, 846,
+    850, 849, 848,
+    849, 851, 824,
+    851, 822, 824,
+    850, 852, 849,
+    851, 849, 853,
+    852, 853, 849,
+    851, 854, 822,
+    852, 855, 853,
+    856, 851, 853,
+    855, 857, 853,
+    856, 853, 857,
+    851, 856, 858,
+    854, 851, 858,
+    859, 856, 857,
+    860, 858, 856,
+    859, 860, 856,
+    859, 857, 861,
+    860, 859, 862,
+    859, 861, 862,
+    857, 863, 861,
+    857, 855, 863,
+    864, 862, 861,
+    865, 861, 863,
+    865, 864, 861,
+    855, 866, 863,
+    867, 865, 863,
+    867, 863, 866,
+    855, 868, 866,
+    855, 852, 868,
+    869, 867, 866,
+    852, 870, 868,
+    852, 850, 870,
+    868, 871, 866,
+    869, 866, 871,
+    868, 872, 871,
+    872, 868, 870,
+    873, 869, 871,
+    872, 874, 871,
+    873, 871, 874,
+    875, 872, 870,
+    876, 873, 874,
+    875, 870, 877,
+    850, 877, 870,
+    877, 850, 846,
+    877, 846, 878,
+    843, 878, 846,
+    879, 877, 878,
+    879, 875, 877,
+    878, 843, 880,
+    879, 878, 881,
+    878, 880, 881,
+    879, 882, 875,
+    843, 883, 880,
+    883, 843, 844,
+    882, 879, 884,
+    879, 881, 884,
+    883, 844, 885,
+    845, 885, 844,
+    886, 883, 885,
+    845, 887, 885,
+    886, 888, 883,
+    888, 880, 883,
+    886, 885, 889,
+    887, 889, 885,
+    888, 890, 880,
+    890, 881, 880,
+    890, 891, 881,
+    891, 884, 881,
+    890, 888, 892,
+    890, 893, 891,
+    890, 892, 893,
+    888, 894, 892,
+    888, 886, 894,
+    892, 895, 893,
+    886, 896, 894,
+    896, 886, 889,
+    897, 892, 894,
+    892, 897, 895,
+    898, 894, 896,
+    898, 897, 894,
+    896, 889, 899,
+    900, 898, 896,
+    900, 896, 899,
+    901, 899, 889,
+    887, 901, 889,
+    901, 902, 899,
+    902, 903, 899,
+    900, 899, 903,
+    902, 904, 903,
+    901, 887, 905,
+    906, 901, 905,
+    907, 905, 887,
+    845, 907, 887,
+    907, 845, 847,
+    906, 905, 908,
+    909, 906, 908,
+    907, 910, 905,
+    910, 908, 905,
+    910, 907, 911,
+    907, 847, 911,
+    910, 912, 908,
+    910, 911, 912,
+    909, 908, 913,
+    912, 913, 908,
+    914, 909, 913,
+    915, 914, 916,
+    914, 913, 916,
+    917, 916, 913,
+    912, 917, 913,
+    917, 912, 918,
+    911, 918, 912,
+    919, 917, 918,
+    911, 920, 918,
+    920, 911, 847,
+    840, 920, 847,
+    920, 840, 838,
+    919, 918, 921,
+    920, 921, 918,
+    922, 919, 921,
+    923, 920, 838,
+    920, 923, 921,
+    923, 838, 837,
+    922, 921, 924,
+    923, 924, 921,
+    925, 922, 924,
+    922, 925, 926,
+    923, 927, 924,
+    927, 923, 837,
+    925, 924, 928,
+    927, 928, 924,
+    925, 929, 926,
+    930, 926, 929,
+    931, 930, 929,
+    925, 932, 929,
+    932, 925, 928,
+    931, 929, 933,
+    932, 933, 929,
+    934, 931, 933,
+    934, 933, 935,
+    936, 934, 935,
+    937, 936, 938,
+    936, 935, 938,
+    939, 938, 935,
+    940, 935, 933,
+    940, 939, 935,
+    932, 940, 933,
+    940, 932, 941,
+    932, 928, 941,
+    939, 940, 942,
+    940, 941, 942,
+    939, 942, 943,
+    944, 939, 943,
+    945, 942, 941,
+    944, 943, 946,
+    947, 944, 946,
+    948, 943, 942,
+    945, 948, 942,
+    948, 949, 943,
+    949, 946, 943,
+    948, 945, 950,
+    949, 948, 951,
+    948, 950, 951,
+    949, 952, 946,
+    947, 946, 953,
+    952, 953, 946,
+    954, 947, 953,
+    954, 953, 955,
+    956, 954, 955,
+    956, 955, 957,
+    958, 955, 953,
+    952, 958, 953,
+    955, 959, 957,
+    955, 958, 959,
+    960, 957, 959,
+    958, 952, 961,
+    958, 962, 959,
+    958, 961, 962,
+    963, 960, 959,
+    963, 959, 962,
+    960, 963, 964,
+    965, 960, 964,
+    966, 963, 962,
+    965, 964, 967,
+    968, 965, 967,
+    968, 967, 969,
+    970, 964, 963,
+    966, 970, 963,
+    971, 967, 964,
+    970, 971, 964,
+    967, 972, 969,
+    967, 971, 972,
+    973, 969, 972,
+    974, 973, 972,
+    973, 974, 975,
+    971, 976, 972,
+    974, 972, 976,
+    971, 977, 976,
+    971, 970, 977,
+    978, 974, 976,
+    970, 979, 977,
+    970, 966, 979,
+    977, 980, 976,
+    978, 976, 980,
+    977, 981, 980,
+    981, 977, 979,
+    982, 978, 980,
+    981, 983, 980,
+    982, 980, 983,
+    984, 981, 979,
+    981, 985, 983,
+    981, 984, 985,
+    984, 979, 986,
+    966, 986, 979,
+    987, 984, 986,
+    986, 966, 988,
+    966, 962, 988,
+    961, 988, 962,
+    986, 988, 989,
+    987, 986, 989,
+    961, 990, 988,
+    990, 989, 988,
+    990, 961, 991,
+    952, 991, 961,
+    952, 949, 991,
+    949, 992, 991,
+    949, 951, 992,
+    993, 991, 992,
+    993, 990, 991,
+    951, 994, 992,
+    995, 993, 992,
+    995, 992, 994,
+    990, 993, 996,
+    993, 995, 997,
+    993, 997, 996,
+    990, 996, 998,
+    989, 990, 998,
+    999, 996, 997,
+    989, 998, 1000,
+    987, 989, 1000,
+    1001, 998, 996,
+    999, 1001, 996,
+    1001, 1002, 998,
+    1002, 1000, 998,
+    1001, 999, 1003,
+    1002, 1001, 1004,
+    1001, 1003, 1004,
+    1002, 1005, 1000,
+    987, 1000, 1006,
+    1005, 1006, 1000,
+    984, 987, 1006,
+    984, 1006, 985,
+    1007, 985, 1006,
+    1005, 1007, 1006,
+    985, 1007, 1008,
+    985, 1008, 983,
+    1007, 1005, 1009,
+    1010, 983, 1008,
+    1010, 982, 983,
+    1007, 1011, 1008,
+    1007, 1009, 1011,
+    1012, 1010, 1008,
+    1012, 1008, 1011,
+    982, 1010, 1013,
+    1010, 1012, 1014,
+    1010, 1014, 1013,
+    982, 1013, 1015,
+    978, 982, 1015,
+    1016, 1015, 1013,
+    978, 1015, 1017,
+    974, 978, 1017,
+    974, 1017, 975,
+    1018, 975, 1017,
+    1019, 1017, 1015,
+    1019, 1018, 1017,
+    1016, 1019, 1015,
+    1018, 1019, 1020,
+    1021, 1018, 1020,
+    1016, 1022, 1019,
+    1022, 1020, 1019,
+    1021, 1020, 1023,
+    1024, 1021, 1023,
+    1024, 1023, 1025,
+    1026, 1023, 1020,
+    1022, 1026, 1020,
+    1023, 1027, 1025,
+    1023, 1026, 1027,
+    1028, 1025, 1027,
+    1029, 1028, 1027,
+    1028, 1029, 1030,
+    1029, 1027, 1031,
+    1026, 1031, 1027,
+    1029, 1032, 1030,
+    1033, 1030, 1032,
+    1034, 1033, 1032,
+    1029, 1035, 1032,
+    1035, 1029, 1031,
+    1034, 1032, 1036,
+    1035, 1036, 1032,
+    1035, 1031, 1036,
+    1037, 1034, 1036,
+    1031, 1038, 1036,
+    1037, 1036, 1038,
+    1031, 1026, 1038,
+    1039, 1037, 1038,
+    1026, 1040, 1038,
+    1039, 1038, 1040,
+    1040, 1026, 1041,
+    1026, 1022, 1041,
+    1042, 1039, 1040,
+    1043, 1041, 1022,
+    1016, 1043, 1022,
+    1043, 1016, 1013,
+    1043, 1013, 1014,
+    1043, 1044, 1041,
+    1044, 1043, 1014,
+    1040, 1041, 1045,
+    1044, 1045, 1041,
+    1042, 1040, 1045,
+    1044, 1014, 1046,
+    1012, 1046, 1014,
+    1044, 1047, 1045,
+    1047, 1044, 1046,
+    1042, 1045, 1048,
+    1047, 1048, 1045,
+    1049, 1042, 1048,
+    1042, 1049, 1039,
+    1047, 1050, 1048,
+    1049, 1051, 1039,
+    1037, 1039, 1051,
+    1052, 1037, 1051,
+    1052, 1051, 1053,
+    1054, 1052, 1053,
+    1049, 1055, 1051,
+    1055, 1053, 1051,
+    1049, 1048, 1056,
+    1055, 1049, 1056,
+    1050, 1056, 1048,
+    1055, 1057, 1053,
+    1050, 1058, 1056,
+    1055, 1056, 1059,
+    1058, 1059, 1056,
+    1060, 1055, 1059,
+    1055, 1060, 1057,
+    1058, 1061, 1059,
+    1060, 1059, 1062,
+    1061, 1062, 1059,
+    1063, 1060, 1062,
+    1060, 1063, 1064,
+    1060, 1064, 1057,
+    1063, 1062, 1065,
+    1063, 1065, 1064,
+    1062, 1066, 1065,
+    1062, 1061, 1066,
+    1067, 1064, 1065,
+    1068, 1065, 1066,
+    1068, 1067, 1065,
+    1067, 1069, 1064,
+    1069, 1057, 1064,
+    1068, 1070, 1067,
+    1057, 1069, 1071,
+    1057, 1071, 1053,
+    1054, 1053, 1071,
+    1072, 1054, 1071,
+    1054, 1072, 1073,
+    1072, 1071, 1074,
+    1069, 1074, 1071,
+    1072, 1075, 1073,
+    1076, 1073, 1075,
+    1077, 1072, 1074,
+    1072, 1077, 1075,
+    1078, 1076, 1075,
+    1076, 1078, 1079,
+    1077, 1080, 1075,
+    1078, 1075, 1080,
+    1078, 1081, 1079,
+    1082, 1079, 1081,
+    1083, 1078, 1080,
+    1078, 1083, 1081,
+    1084, 1082, 1081,
+    1083, 1085, 1081,
+    1084, 1081, 1085,
+    1082, 1084, 1086,
+    1087, 1082, 1086,
+    1088, 1084, 1085,
+    1087, 1086, 1089,
+    1090, 1087, 1089,
+    1091, 1086, 1084,
+    1088, 1091, 1084,
+    1091, 1092, 1086,
+    1092, 1089, 1086,
+    1092, 1091, 1093,
+    1092, 1094, 1089,
+    1092, 1093, 1094,
+    1090, 1089, 1095,
+    1094, 1095, 1089,
+    1096, 1090, 1095,
+    1096, 1095, 1097,
+    1098, 1096, 1097,
+    1098, 1097, 1099,
+    1100, 1097, 1095,
+    1094, 1100, 1095,
+    1097, 1101, 1099,
+    1097, 1100, 1101,
+    1102, 1099, 1101,
+    1100, 1094, 1103,
+    1093, 1103, 1094,
+    1100, 1104, 1101,
+    1105, 1100, 1103,
+    1100, 1105, 1104,
+    1106, 1101, 1104,
+    1106, 1102, 1101,
+    1105, 1107, 1104,
+    1102, 1106, 1108,
+    1109, 1102, 1108,
+    1110, 1106, 1104,
+    1110, 1104, 1107,
+    1110, 1111, 1106,
+    1111, 1108, 1106,
+    1109, 1108, 1112,
+    1113, 1109, 1112,
+    1113, 1112, 1114,
+    1115, 1112, 1108,
+    1111, 1115, 1108,
+    1112, 1116, 1114,
+    1112, 1115, 1116,
+    1117, 1114, 1116,
+    1115, 1111, 1118,
+    1115, 1119, 1116,
+    1115, 1118, 1119,
+    1120, 1117, 1116,
+    1120, 1116, 1119,
+    1117, 1120, 1121,
+    1122, 1117, 1121,
+    1123, 1120, 1119,
+    1122, 1121, 1124,
+    1125, 1122, 1124,
+    1125, 1124, 1126,
+    1127, 1121, 1120,
+    1123, 1127, 1120,
+    1128, 1124, 1121,
+    1127, 1128, 1121,
+    1124, 1129, 1126,
+    1124, 1128, 1129,
+    1130, 1126, 1129,
+    1131, 1130, 1129,
+    1131, 1129, 1132,
+    1128, 1132, 1129,
+    1133, 1131, 1132,
+    1128, 1134, 1132,
+    1128, 1127, 1134,
+    1133, 1132, 1135,
+    1134, 1135, 1132,
+    1136, 1133, 1135,
+    1133, 1136, 1137,
+    1134, 1138, 1135,
+    1136, 1139, 1137,
+    1140, 1137, 1139,
+    1141, 1140, 1139,
+    1141, 1139, 1142,
+    1143, 1141, 1142,
+    1136, 1144, 1139,
+    1144, 1142, 1139,
+    1144, 1136, 1145,
+    1136, 1135, 1145,
+    1138, 1145, 1135,
+    1144, 1146, 1142,
+    1144, 1145, 1147,
+    1146, 1144, 1147,
+    1138, 1148, 1145,
+    1148, 1147, 1145,
+    1146, 1149, 1142,
+    1143, 1142, 1149,
+    1146, 1147, 1150,
+    1151, 1143, 1149,
+    1143, 1151, 1152,
+    1146, 1153, 1149,
+    1153, 1146, 1150,
+    1151, 1149, 1154,
+    1153, 1154, 1149,
+    1151, 1155, 1152,
+    1156, 1152, 1155,
+    1157, 1156, 1155,
+    1151, 1158, 1155,
+    1158, 1151, 1154,
+    1157, 1155, 1159,
+    1158, 1159, 1155,
+    1160, 1157, 1159,
+    1160, 1159, 1161,
+    1162, 1160, 1161,
+    1158, 1163, 1159,
+    1163, 1161, 1159,
+    1162, 1161, 1164,
+    1165, 1162, 1164,
+    1163, 1166, 1161,
+    1166, 1164, 1161,
+    1163, 1158, 1167,
+    1158, 1154, 1167,
+    1166, 1163, 1168,
+    1163, 1167, 1168,
+    1169, 1167, 1154,
+    1153, 1169, 1154,
+    1170, 1168, 1167,
+    1169, 1170, 1167,
+    1169, 1153, 1171,
+    1153, 1150, 1171,
+    1170, 1169, 1172,
+    1169, 1171, 1172,
+    1170, 1172, 1173,
+    1174, 1171, 1150,
+    1175, 1172, 1171,
+    1174, 1175, 1171,
+    1176, 1174, 1150,
+    1176, 1150, 1147,
+    1148, 1176, 1147,
+    1174, 1176, 1177,
+    1176, 1148, 1178,
+    1174, 1177, 1179,
+    1175, 1174, 1179,
+    1176, 1180, 1177,
+    1180, 1176, 1178,
+    1181, 1177, 1180,
+    1181, 1182, 1177,
+    1182, 1179, 1177,
+    1183, 1181, 1180,
+    1182, 1184, 1179,
+    1183, 1180, 1185,
+    1180, 1178, 1185,
+    1182, 1181, 1186,
+    1187, 1185, 1178,
+    1182, 1186, 1188,
+    1184, 1182, 1188,
+    1181, 1189, 1186,
+    1181, 1183, 1189,
+    1190, 1186, 1189,
+    1190, 1191, 1186,
+    1191, 1188, 1186,
+    1192, 1190, 1189,
+    1191, 1193, 1188,
+    1192, 1189, 1194,
+    1183, 1194, 1189,
+    1191, 1190, 1195,
+    1194, 1183, 1196,
+    1191, 1195, 1197,
+    1193, 1191, 1197,
+    1190, 1198, 1195,
+    1190, 1192, 1198,
+    1199, 1195, 1198,
+    1192, 1200, 1198,
+    1199, 1201, 1195,
+    1201, 1197, 1195,
+    1202, 1199, 1198,
+    1202, 1198, 1200,
+    1201, 1199, 1203,
+    1199, 1202, 1204,
+    1199, 1204, 1203,
+    1202, 1205, 1204,
+    1201, 1203, 1206,
+    1202, 1207, 1205,
+    1207, 1202, 1200,
+    1208, 1201, 1206,
+    1201, 1208, 1197,
+    1208, 1209, 1197,
+    1193, 1197, 1209,
+    1208, 1206, 1210,
+    1208, 1211, 1209,
+    1211, 1208, 1210,
+    1212, 1193, 1209,
+    1211, 1213, 1209,
+    1212, 1209, 1213,
+    1193, 1212, 1214,
+    1193, 1214, 1188,
+    1184, 1188, 1214,
+    1212, 1215, 1214,
+    1216, 1184, 1214,
+    1216, 1214, 1215,
+    1184, 1216, 1217,
+    1184, 1217, 1179,
+    1175, 1179, 1217,
+    1216, 1218, 1217,
+    1219, 1175, 1217,
+    1219, 1217, 1218,
+    1216, 1220, 1218,
+    1220, 1216, 1215,
+    1221, 1219, 1218,
+    1220, 1222, 1218,
+    1221, 1218, 1222,
+    1220, 1215, 1223,
+    1220, 1224, 1222,
+    1224, 1220, 1223,
+    1225, 1223, 1215,
+    1212, 1225, 1215,
+    1225, 1212, 1213,
+    1225, 1226, 1223,
+    1225, 1213, 1226,
+    1226, 1227, 1223,
+    1224, 1223, 1227,
+    1213, 1228, 1226,
+    1213, 1211, 1228,
+    1229, 1226, 1228,
+    1226, 1229, 1227,
+    1211, 1230, 1228,
+    1211, 1210, 1230,
+    1231, 1228, 1230,
+    1231, 1229, 1228,
+    1210, 1232, 1230,
+    1233, 1231, 1230,
+    1233, 1230, 1232,
+    1210, 1234, 1232,
+    1234, 1210, 1206,
+    1235, 1233, 1232,
+    1236, 1234, 1206,
+    1236, 1206, 1203,
+    1234, 1237, 1232,
+    1235, 1232, 1237,
+    1234, 1236, 1238,
+    1239, 1235, 1237,
+    1237, 1234, 1240,
+    1234, 1238, 1240,
+    1239, 1237, 1241,
+    1237, 1240, 1241,
+    1239, 1242, 1235,
+    1239, 1241, 1242,
+    1242, 1243, 1235,
+    1233, 1235, 1243,
+    1241, 1244, 1242,
+    1245, 1233, 1243,
+    1233, 1245, 1231,
+    1242, 1246, 1243,
+    1246, 1242, 1244,
+    1245, 1243, 1247,
+    1246, 1247, 1243,
+    1245, 1248, 1231,
+    1229, 1231, 1248,
+    1249, 1245, 1247,
+    1245, 1249, 1248,
+    1249, 1247, 1250,
+    1249, 1251, 1248,
+    1247, 1252, 1250,
+    1247, 1246, 1252,
+    1249, 1250, 1253,
+    1251, 1249, 1253,
+    1254, 1253, 1250,
+    1251, 1253, 1255,
+    1256, 1254, 1250,
+    1256, 1250, 1252,
+    1254, 1257, 1253,
+    1257, 1255, 1253,
+    1254, 1256, 1258,
+    1257, 1254, 1259,
+    1254, 1258, 1259,
+    1257, 1260, 1255,
+    1257, 1259, 1261,
+    1260, 1257, 1261,
+    1262, 1261, 1259,
+    1260, 1263, 1255,
+    1264, 1262, 1259,
+    1264, 1259, 1258,
+    1265, 1255, 1263,
+    1265, 1251, 1255,
+    1265, 1266, 1251,
+    1266, 1248, 1251,
+    1266, 1229, 1248,
+    1265, 1267, 1266,
+    1267, 1265, 1263,
+    1229, 1266, 1268,
+    1267, 1268, 1266,
+    1269, 1229, 1268,
+    1229, 1269, 1227,
+    1267, 1270, 1268,
+    1271, 1227, 1269,
+    1271, 1224, 1227,
+    1269, 1268, 1272,
+    1270, 1272, 1268,
+    1273, 1271, 1269,
+    1273, 1269, 1272,
+    1224, 1271, 1274,
+    1224, 1274, 1222,
+    1271, 1273, 1275,
+    1271, 1275, 1274,
+    1276, 1222, 1274,
+    1276, 1221, 1222,
+    1277, 1274, 1275,
+    1277, 1276, 1274,
+    1221, 1276, 1278,
+    1276, 1277, 1279,
+    1276, 1279, 1278,
+    1221, 1278, 1280,
+    1219, 1221, 1280,
+    1281, 1278, 1279,
+    1219, 1280, 1282,
+    1175, 1219, 1282,
+    1283, 1280, 1278,
+    1281, 1283, 1278,
+    1283, 1284, 1280,
+    1284, 1282, 1280,
+    1281, 1285, 1283,
+    1284, 1283, 1286,
+    1285, 1286, 1283,
+    1284, 1287, 1282,
+    1288, 1284, 1286,
+    1284, 1288, 1287,
+    1287, 1289, 1282,
+    1175, 1282, 1289,
+    1172, 1175, 1289,
+    1172, 1289, 1173,
+    1287, 1290, 1289,
+    1290, 1173, 1289,
+    1290, 1287, 1291,
+    1288, 1291, 1287,
+    1290, 1292, 1173,
+    1288, 1293, 1291,
+    1294, 1290, 1291,
+    1290, 1294, 1292,
+    1293, 1295, 1291,
+    1294, 1291, 1295,
+    1293, 1288, 1296,
+    1288, 1286, 1296,
+    1293, 1296, 1297,
+    1295, 1293, 1297,
+    1298, 1296, 1286,
+    1285, 1298, 1286,
+    1298, 1299, 1296,
+    1299, 1297, 1296,
+    1298, 1285, 1300,
+    1299, 1298, 1301,
+    1298, 1300, 1301,
+    1285, 1302, 1300,
+    1285, 1281, 1302,
+    1303, 1301, 1300,
+    1281, 1304, 1302,
+    1304, 1281, 1279,
+    1305, 1300, 1302,
+    1305, 1303, 1300,
+    1306, 1302, 1304,
+    1306, 1305, 1302,
+    1304, 1279, 1307,
+    1277, 1307, 1279,
+    1308, 1306, 1304,
+    1308, 1304, 1307,
+    1277, 1309, 1307,
+    1309, 1277, 1275,
+    1308, 1307, 1310,
+    1309, 1310, 1307,
+    1311, 1308, 1310,
+    1308, 1311, 1306,
+    1309, 1312, 1310,
+    1311, 1313, 1306,
+    1305, 1306, 1313,
+    1311, 1310, 1314,
+    1312, 1314, 1310,
+    1315, 1311, 1314,
+    1311, 1315, 1313,
+    1314, 1312, 1316,
+    1315, 1314, 1317,
+    1314, 1316, 1317,
+    1315, 1318, 1313,
+    1319, 1305, 1313,
+    1319, 1313, 1318,
+    1305, 1319, 1303,
+    1318, 1315, 1320,
+    1315, 1317, 1320,
+    1321, 1319, 1318,
+    1318, 1320, 1322,
+    1321, 1318, 1322,
+    1319, 1321, 1323,
+    1319, 1323, 1303,
+    1321, 1322, 1324,
+    1325, 1303, 1323,
+    1303, 1325, 1301,
+    1321, 1326, 1323,
+    1326, 1321, 1324,
+    1327, 1325, 1323,
+    1327, 1323, 1326,
+    1325, 1328, 1301,
+    1299, 1301, 1328,
+    1325, 1327, 1329,
+    1325, 1329, 1328,
+    1330, 1299, 1328,
+    1299, 1330, 1297,
+    1329, 1331, 1328,
+    1330, 1328, 1331,
+    1330, 1332, 1297,
+    1295, 1297, 1332,
+    1333, 1330, 1331,
+    1334, 1295, 1332,
+    1334, 1294, 1295,
+    1332, 1330, 1335,
+    1330, 1333, 1335,
+    1334, 1332, 1336,
+    1332, 1335, 1336,
+    1294, 1334, 1337,
+    1294, 1337, 1292,
+    1334, 1338, 1337,
+    1339, 1292, 1337,
+    1338, 1334, 1340,
+    1334, 1336, 1340,
+    1341, 1337, 1338,
+    1341, 1339, 1337,
+    1342, 1341, 1338,
+    1339, 1341, 1343,
+    1342, 1338, 1344,
+    1338, 1340, 1344,
+    1341, 1342, 1345,
+    1341, 1345, 1343,
+    1342, 1346, 1345,
+    1346, 1342, 1347,
+    1342, 1344, 1347,
+    1348, 1345, 1346,
+    1349, 1347, 1344,
+    1348, 1350, 1345,
+    1350, 1343, 1345,
+    1351, 1349, 1344,
+    1351, 1344, 1340,
+    1352, 1351, 1340,
+    1352, 1340, 1336,
+    1351, 1353, 1349,
+    1351, 1352, 1353,
+    1354, 1352, 1336,
+    1354, 1336, 1335,
+    1352, 1355, 1353,
+    1352, 1354, 1355,
+    1356, 1354, 1335,
+    1356, 1335, 1333,
+    1354, 1357, 1355,
+    1354, 1356, 1357,
+    1358, 1355, 1357,
+    1356, 1359, 1357,
+    1358, 1360, 1355,
+    1360, 1353, 1355,
+    1361, 1358, 1357,
+    1361, 1357, 1359,
+    1353, 1360, 1362,
+    1353, 1362, 1349,
+    1363, 1349, 1362,
+    1349, 1363, 1347,
+    1363, 1364, 1347,
+    1346, 1347, 1364,
+    1365, 1363, 1362,
+    1366, 1346, 1364,
+    1366, 1348, 1346,
+    1363, 1367, 1364,
+    1363, 1365, 1367,
+    1366, 1364, 1368,
+    1367, 1368, 1364,
+    1366, 1369, 1348,
+    1369, 1366, 1368,
+    1369, 1370, 1348,
+    1350, 1348, 1370,
+    1369, 1368, 1371,
+    1369, 1372, 1370,
+    1372, 1369, 1371,
+    1373, 1371, 1368,
+    1367, 1373, 1368,
+    1372, 1371, 1374,
+    1373, 1367, 1375,
+    1365, 1375, 1367,
+    1373, 1376, 1371,
+    1376, 1374, 1371,
+    1377, 1373, 1375,
+    1373, 1377, 1376,
+    1365, 1378, 1375,
+    1377, 1375, 1379,
+    1378, 1379, 1375,
+    1378, 1365, 1380,
+    1365, 1362, 1380,
+    1360, 1380, 1362,
+    1378, 1380, 1381,
+    1360, 1382, 1380,
+    1382, 1381, 1380,
+    1383, 1378, 1381,
+    1378, 1383, 1379,
+    1382, 1384, 1381,
+    1383, 1381, 1385,
+    1384, 1385, 1381,
+    1383, 1386, 1379,
+    1387, 1383, 1385,
+    1383, 1387, 1386,
+    1384, 1388, 1385,
+    1387, 1385, 1389,
+    1388, 1389, 1385,
+    1384, 1390, 1388,
+    1384, 1382, 1390,
+    1388, 1391, 1389,
+    1382, 1392, 1390,
+    1382, 1360, 1392,
+    1390, 1393, 1388,
+    1391, 1388, 1393,
+    1390, 1394, 1393,
+    1394, 1390, 1392,
+    1395, 1391, 1393,
+    1394, 1396, 1393,
+    1395, 1393, 1396,
+    1397, 1394, 1392,
+    1394, 1398, 1396,
+    1394, 1397, 1398,
+    1397, 1392, 1399,
+    1360, 1399, 1392,
+    1360, 1358, 1399,
+    1358, 1400, 1399,
+    1358, 1361, 1400,
+    1401, 1397, 1399,
+    1401, 1399, 1400,
+    1397, 1401, 1402,
+    1397, 1402, 1398,
+    1403, 1401, 1400,
+    1403, 1400, 1404,
+    1361, 1404, 1400,
+    1401, 1403, 1405,
+    1404, 1361, 1406,
+    1407, 1401, 1405,
+    1401, 1407, 1402,
+    1408, 1403, 1404,
+    1408, 1404, 1409,
+    1404, 1406, 1409,
+    1408, 1410, 1403,
+    1410, 1405, 1403,
+    1410, 1408, 1411,
+    1408, 1409, 1411,
+    1410, 1412, 1405,
+    1410, 1411, 1413,
+    1412, 1410, 1413,
+    1412, 1414, 1405,
+    1407, 1405, 1414,
+    1412, 1413, 1415,
+    1412, 1415, 1414,
+    1416, 1407, 1414,
+    1415, 1417, 1414,
+    1416, 1414, 1417,
+    1416, 1418, 1407,
+    1418, 1402, 1407,
+    1419, 1416, 1417,
+    1418, 1420, 1402,
+    1420, 1398, 1402,
+    1416, 1421, 1418,
+    1416, 1419, 1421,
+    1421, 1422, 1418,
+    1420, 1418, 1422,
+    1419, 1423, 1421,
+    1398, 1420, 1424,
+    1398, 1424, 1396,
+    1425, 1396, 1424,
+    1425, 1395, 1396,
+    1420, 1426, 1424,
+    1427, 1425, 1424,
+    1427, 1424, 1426,
+    1425, 1428, 1395,
+    1425, 1427, 1429,
+    1428, 1425, 1429,
+    1430, 1427, 1426,
+    1430, 1431, 1427,
+    1430, 1426, 1431,
+    1431, 1429, 1427,
+    1426, 1432, 1431,
+    1426, 1420, 1432,
+    1431, 1433, 1429,
+    1433, 1431, 1432,
+    1420, 1434, 1432,
+    1434, 1420, 1422,
+    1435, 1433, 1432,
+    1435, 1432, 1434,
+    1433, 1436, 1429,
+    1428, 1429, 1436,
+    1433, 1435, 1437,
+    1433, 1438, 1436,
+    1438, 1433, 1437,
+    1439, 1428, 1436,
+    1438, 1440, 1436,
+    1439, 1436, 1440,
+    1428, 1439, 1441,
+    1428, 1441, 1395,
+    1391, 1395, 1441,
+    1439, 1442, 1441,
+    1443, 1391, 1441,
+    1443, 1441, 1442,
+    1391, 1443, 1444,
+    1391, 1444, 1389,
+    1445, 1443, 1442,
+    1446, 1389, 1444,
+    1446, 1387, 1389,
+    1443, 1447, 1444,
+    1443, 1445, 1447,
+    1448, 1446, 1444,
+    1448, 1444, 1447,
+    1387, 1446, 1449,
+    1387, 1449, 1386,
+    1446, 1448, 1450,
+    1446, 1450, 1449,
+    1448, 1451, 1450,
+    1452, 1386, 1449,
+    1448, 1453, 1451,
+    1453, 1448, 1447,
+    1452, 1454, 1386,
+    1454, 1379, 1386,
+    1454, 1377, 1379,
+    1377, 1454, 1455,
+    1377, 1455, 1376,
+    1454, 1456, 1455,
+    1454, 1452, 1456,
+    1457, 1376, 1455,
+    1376, 1457, 1374,
+    1458, 1455, 1456,
+    1458, 1457, 1455,
+    1459, 1458, 1456,
+    1457, 1458, 1460,
+    1459, 1456, 1461,
+    1452, 1461, 1456,
+    1458, 1459, 1462,
+    1458, 1462, 1460,
+    1452, 1463, 1461,
+    1463, 1452, 1449,
+    1463, 1449, 1450,
+    1464, 1463, 1450,
+    1464, 1450, 1451,
+    1463, 1465, 1461,
+    1466, 1464, 1451,
+    1463, 1464, 1467,
+    1466, 1451, 1468,
+    1453, 1468, 1451,
+    1464, 1466, 1469,
+    1464, 1469, 1467,
+    1470, 1466, 1468,
+    1466, 1470, 1469,
+    1453, 1471, 1468,
+    1470, 1468, 1472,
+    1471, 1472, 1468,
+    1471, 1453, 1473,
+    1453, 1447, 1473,
+    1445, 1473, 1447,
+    1471, 1473, 1474,
+    1445, 1475, 1473,
+    1475, 1474, 1473,
+    1475, 1445, 1476,
+    1445, 1442, 1476,
+    1475, 1477, 1474,
+    1478, 1476, 1442,
+    1439, 1478, 1442,
+    1478, 1439, 1440,
+    1475, 1476, 1479,
+    1477, 1475, 1479,
+    1478, 1480, 1476,
+    1480, 1479, 1476,
+    1480, 1478, 1481,
+    1478, 1440, 1481,
+    1480, 1482, 1479,
+    1483, 1481, 1440,
+    1438, 1483, 1440,
+    1480, 1481, 1484,
+    1482, 1480, 1484,
+    1483, 1485, 1481,
+    1485, 1484, 1481,
+    1483, 1438, 1486,
+    1438, 1437, 1486,
+    1485, 1483, 1487,
+    1483, 1486, 1487,
+    1485, 1488, 1484,
+    1485, 1487, 1489,
+    1488, 1485, 1489,
+    1488, 1490, 1484,
+    1482, 1484, 1490,
+    1488, 1489, 1491,
+    1488, 1492, 1490,
+    1488, 1491, 1492,
+    1493, 1482, 1490,
+    1492, 1494, 1490,
+    1493, 1490, 1494,
+    1482, 1493, 1495,
+    1482, 1495, 1479,
+    1477, 1479, 1495,
+    1493, 1496, 1495,
+    1497, 1477, 1495,
+    1497, 1495, 1496,
+    1477, 1497, 1498,
+    1477, 1498, 1474,
+    1499, 1497, 1496,
+    1500, 1474, 1498,
+    1500, 1471, 1474,
+    1471, 1500, 1472,
+    1497, 1501, 1498,
+    1497, 1499, 1501,
+    1502, 1500, 1498,
+    1502, 1498, 1501,
+    1500, 1502, 1503,
+    1500, 1503, 1472,
+    1504, 1502, 1501,
+    1505, 1472, 1503,
+    1505, 1470, 1472,
+    1502, 1506, 1503,
+    1502, 1504, 1506,
+    1507, 1505, 1503,
+    1507, 1503, 1506,
+    1505, 1508, 1470,
+    1508, 1469, 1470,
+    1505, 1507, 1509,
+    1508, 1505, 1509,
+    1508, 1510, 1469,
+    1510, 1467, 1469,
+    1508, 1509, 1511,
+    1510, 1508, 1511,
+    1510, 1512, 1467,
+    1510, 1511, 1513,
+    1512, 1510, 1513,
+    1512, 1514, 1467,
+    1463, 1467, 1514,
+    1465, 1463, 1514,
+    1512, 1515, 1514,
+    1465, 1514, 1516,
+    1515, 1516, 1514,
+    1515, 1512, 1517,
+    1512, 1513, 1517,
+    1515, 1518, 1516,
+    1515, 1517, 1519,
+    1518, 1515, 1519,
+    1520, 1517, 1513,
+    1521, 1519, 1517,
+    1520, 1521, 1517,
+    1522, 1520, 1513,
+    1522, 1513, 1511,
+    1520, 1523, 1521,
+    1520, 1522, 1524,
+    1523, 1520, 1524,
+    1525, 1522, 1511,
+    1525, 1511, 1509,
+    1526, 1524, 1522,
+    1525, 1526, 1522,
+    1526, 1527, 1524,
+    1528, 1525, 1509,
+    1528, 1509, 1507,
+    1526, 1525, 1529,
+    1530, 1528, 1507,
+    1530, 1507, 1506,
+    1525, 1528, 1531,
+    1530, 1506, 1532,
+    1504, 1532, 1506,
+    1530, 1533, 1528,
+    1533, 1530, 1532,
+    1533, 1531, 1528,
+    1533, 1532, 1534,
+    1533, 1535, 1531,
+    1535, 1533, 1534,
+    1536, 1534, 1532,
+    1504, 1536, 1532,
+    1535, 1534, 1537,
+    1536, 1504, 1538,
+    1504, 1501, 1538,
+    1499, 1538, 1501,
+    1534, 1536, 1539,
+    1534, 1539, 1537,
+    1536, 1538, 1540,
+    1536, 1541, 1539,
+    1541, 1536, 1540,
+    1542, 1540, 1538,
+    1499, 1542, 1538,
+    1541, 1540, 1543,
+    1542, 1499, 1544,
+    1499, 1496, 1544,
+    1542, 1545, 1540,
+    1545, 1543, 1540,
+    1545, 1542, 1546,
+    1542, 1544, 1546,
+    1543, 1545, 1547,
+    1545, 1546, 1548,
+    1545, 1548, 1547,
+    1546, 1549, 1548,
+    1543, 1547, 1550,
+    1546, 1551, 1549,
+    1551, 1546, 1544,
+    1552, 1543, 1550,
+    1552, 1541, 1543,
+    1552, 1553, 1541,
+    1553, 1539, 1541,
+    1552, 1550, 1554,
+    1553, 1552, 1554,
+    1553, 1555, 1539,
+    1555, 1537, 1539,
+    1555, 1553, 1556,
+    1553, 1554, 1556,
+    1555, 1557, 1537,
+    1555, 1556, 1557,
+    1557, 1558, 1537,
+    1535, 1537, 1558,
+    1556, 1559, 1557,
+    1560, 1535, 1558,
+    1535, 1560, 1531,
+    1557, 1561, 1558,
+    1561, 1557, 1559,
+    1560, 1558, 1562,
+    1561, 1562, 1558,
+    1563, 1531, 1560,
+    1563, 1525, 1531,
+    1525, 1563, 1529,
+    1564, 1563, 1560,
+    1564, 1560, 1562,
+    1564, 1565, 1563,
+    1564, 1562, 1565,
+    1565, 1529, 1563,
+    1562, 1566, 1565,
+    1562, 1561, 1566,
+    1565, 1567, 1529,
+    1567, 1565, 1566,
+    1567, 1568, 1529,
+    1526, 1529, 1568,
+    1527, 1526, 1568,
+    1567, 1569, 1568,
+    1527, 1568, 1570,
+    1569, 1570, 1568,
+    1569, 1567, 1571,
+    1569, 1572, 1570,
+    1567, 1573, 1571,
+    1573, 1567, 1566,
+    1569, 1571, 1574,
+    1572, 1569, 1574,
+    1575, 1571, 1573,
+    1576, 1574, 1571,
+    1575, 1576, 1571,
+    1573, 1566, 1577,
+    1561, 1577, 1566,
+    1578, 1575, 1573,
+    1578, 1573, 1577,
+    1575, 1578, 1579,
+    1578, 1577, 1580,
+    1578, 1580, 1579,
+    1577, 1561, 1581,
+    1577, 1581, 1580,
+    1561, 1582, 1581,
+    1582, 1561, 1559,
+    1583, 1580, 1581,
+    1584, 1581, 1582,
+    1584, 1583, 1581,
+    1583, 1585, 1580,
+    1585, 1579, 1580,
+    1583, 1584, 1586,
+    1585, 1583, 1587,
+    1583, 1586, 1587,
+    1585, 1588, 1579,
+    1585, 1587, 1589,
+    1588, 1585, 1589,
+    1588, 1590, 1579,
+    1575, 1579, 1590,
+    1576, 1575, 1590,
+    1588, 1591, 1590,
+    1576, 1590, 1592,
+    1591, 1592, 1590,
+    1593, 1576, 1592,
+    1576, 1593, 1574,
+    1591, 1594, 1592,
+    1594, 1595, 1592,
+    1593, 1592, 1595,
+    1594, 1591, 1596,
+    1597, 1593, 1595,
+    1591, 1598, 1596,
+    1591, 1588, 1598,
+    1599, 1596, 1598,
+    1588, 1589, 1598,
+    1600, 1599, 1598,
+    1600, 1598, 1589,
+    1599, 1600, 1601,
+    1602, 1600, 1589,
+    1602, 1589, 1587,
+    1600, 1603, 1601,
+    1600, 1602, 1603,
+    1604, 1601, 1603,
+    1605, 1602, 1587,
+    1605, 1587, 1586,
+    1602, 1606, 1603,
+    1602, 1605, 1606,
+    1607, 1604, 1603,
+    1607, 1603, 1606,
+    1604, 1607, 1608,
+    1607, 1609, 1608,
+    1610, 1608, 1609,
+    1611, 1607, 1606,
+    1607, 1611, 1609,
+    1612, 1610, 1609,
+    1610, 1612, 1613,
+    1611, 1614, 1609,
+    1612, 1609, 1614,
+    1611, 1606, 1615,
+    1605, 1615, 1606,
+    1616, 1611, 1615,
+    1611, 1616, 1614,
+    1605, 1617, 1615,
+    1617, 1605, 1586,
+    1616, 1615, 1618,
+    1617, 1618, 1615,
+    1617, 1586, 1619,
+    1584, 1619, 1586,
+    1617, 1620, 1618,
+    1620, 1617, 1619,
+    1584, 1621, 1619,
+    1621, 1584, 1582,
+    1621, 1622, 1619,
+    1620, 1619, 1622,
+    1621, 1582, 1623,
+    1621, 1623, 1622,
+    1582, 1559, 1623,
+    1624, 1623, 1559,
+    1556, 1624, 1559,
+    1624, 1556, 1554,
+    1623, 1624, 1625,
+    1623, 1625, 1622,
+    1626, 1624, 1554,
+    1626, 1554, 1550,
+    1624, 1627, 1625,
+    1624, 1626, 1627,
+    1628, 1622, 1625,
+    1628, 1620, 1622,
+    1629, 1628, 1625,
+    1629, 1625, 1627,
+    1620, 1628, 1630,
+    1620, 1630, 1618,
+    1628, 1629, 1631,
+    1628, 1631, 1630,
+    1632, 1618, 1630,
+    1632, 1616, 1618,
+    1633, 1630, 1631,
+    1633, 1632, 1630,
+    1616, 1632, 1634,
+    1616, 1634, 1614,
+    1632, 1633, 1635,
+    1632, 1635, 1634,
+    1636, 1614, 1634,
+    1636, 1612, 1614,
+    1637, 1634, 1635,
+    1637, 1636, 1634,
+    1612, 1636, 1638,
+    1612, 1638, 1613,
+    1639, 1613, 1638,
+    1636, 1640, 1638,
+    1636, 1637, 1640,
+    1641, 1639, 1638,
+    1641, 1638, 1640,
+    1639, 1641, 1642,
+    1643, 1639, 1642,
+    1644, 1641, 1640,
+    1643, 1642, 1645,
+    1646, 1643, 1645,
+    1646, 1645, 1647,
+    1648, 1642, 1641,
+    1644, 1648, 1641,
+    1649, 1645, 1642,
+    1648, 1649, 1642,
+    1645, 1650, 1647,
+    1645, 1649, 1650,
+    1651, 1647, 1650,
+    1652, 1651, 1650,
+    1651, 1652, 1653,
+    1652, 1650, 1654,
+    1649, 1654, 1650,
+    1652, 1655, 1653,
+    1656, 1653, 1655,
+    1657, 1652, 1654,
+    1652, 1657, 1655,
+    1649, 1658, 1654,
+    1657, 1654, 1659,
+    1658, 1659, 1654,
+    1658, 1649, 1660,
+    1649, 1648, 1660,
+    1658, 1661, 1659,
+    1662, 1660, 1648,
+    1644, 1662, 1648,
+    1658, 1660, 1663,
+    1661, 1658, 1663,
+    1662, 1664, 1660,
+    1664, 1663, 1660,
+    1662, 1644, 1665,
+    1644, 1640, 1665,
+    1637, 1665, 1640,
+    1662, 1665, 1666,
+    1664, 1662, 1666,
+    1637, 1667, 1665,
+    1667, 1666, 1665,
+    1667, 1637, 1635,
+    1664, 1666, 1668,
+    1667, 1635, 1669,
+    1633, 1669, 1635,
+    1667, 1670, 1666,
+    1670, 1667, 1669,
+    1670, 1668, 1666,
+    1633, 1671, 1669,
+    1671, 1633, 1631,
+    1670, 1669, 1672,
+    1671, 1672, 1669,
+    1673, 1670, 1672,
+    1670, 1673, 1668,
+    1672, 1671, 1674,
+    1673, 1672, 1675,
+    1672, 1674, 1675,
+    1673, 1676, 1668,
+    1673, 1675, 1677,
+    1676, 1673, 1677,
+    1678, 1668, 1676,
+    1678, 1664, 1668,
+    1664, 1678, 1663,
+    1678, 1679, 1663,
+    1661, 1663, 1679,
+    1680, 1678, 1676,
+    1678, 1680, 1679,
+    1680, 1676, 1681,
+    1676, 1677, 1681,
+    1680, 1682, 1679,
+    1680, 1681, 1683,
+    1682, 1680, 1683,
+    1684, 1679, 1682,
+    1684, 1661, 1679,
+    1685, 1684, 1682,
+    1661, 1684, 1686,
+    1685, 1682, 1687,
+    1682, 1683, 1687,
+    1685, 1688, 1684,
+    1688, 1686, 1684,
+    1688, 1685, 1689,
+    1685, 1687, 1689,
+    1688, 1690, 1686,
+    1688, 1689, 1691,
+    1690, 1688, 1691,
+    1692, 1689, 1687,
+    1693, 1691, 1689,
+    1692, 1693, 1689,
+    1694, 1692, 1687,
+    1694, 1687, 1683,
+    1693, 1692, 1695,
+    1696, 1694, 1683,
+    1696, 1683, 1681,
+    1692, 1694, 1697,
+    1692, 1697, 1695,
+    1694, 1696, 1698,
+    1694, 1698, 1697,
+    1699, 1696, 1681,
+    1699, 1681, 1677,
+    1696, 1700, 1698,
+    1696, 1699, 1700,
+    1701, 1699, 1677,
+    1701, 1677, 1675,
+    1699, 1702, 1700,
+    1699, 1701, 1702,
+    1703, 1701, 1675,
+    1703, 1675, 1674,
+    1701, 1704, 1702,
+    1701, 1703, 1704,
+    1705, 1702, 1704,
+    1703, 1706, 1704,
+    1705, 1707, 1702,
+    1707, 1700, 1702,
+    1708, 1705, 1704,
+    1708, 1704, 1706,
+    1705, 1709, 1707,
+    1705, 1708, 1709,
+    1707, 1710, 1700,
+    1710, 1698, 1700,
+    1710, 1707, 1711,
+    1709, 1711, 1707,
+    1710, 1712, 1698,
+    1712, 1697, 1698,
+    1713, 1710, 1711,
+    1710, 1713, 1712,
+    1712, 1714, 1697,
+    1714, 1695, 1697,
+    1713, 1715, 1712,
+    1714, 1712, 1715,
+    1714, 1716, 1695,
+    1717, 1714, 1715,
+    1714, 1717, 1716,
+    1716, 1718, 1695,
+    1693, 1695, 1718,
+    1717, 1719, 1716,
+    1720, 1693, 1718,
+    1693, 1720, 1691,
+    1716, 1721, 1718,
+    1721, 1716, 1719,
+    1720, 1718, 1722,
+    1721, 1722, 1718,
+    1720, 1723, 1691,
+    1690, 1691, 1723,
+    1724, 1720, 1722,
+    1720, 1724, 1723,
+    1721, 1725, 1722,
+    1724, 1722, 1726,
+    1725, 1726, 1722,
+    1724, 1727, 1723,
+    1725, 1721, 1728,
+    1729, 1723, 1727,
+    1729, 1690, 1723,
+    1721, 1730, 1728,
+    1730, 1721, 1719,
+    1690, 1729, 1731,
+    1730, 1719, 1732,
+    1733, 1690, 1731,
+    1690, 1733, 1686,
+    1734, 1686, 1733,
+    1734, 1661, 1686,
+    1661, 1734, 1659,
+    1735, 1734, 1733,
+    1736, 1659, 1734,
+    1735, 1736, 1734,
+    1736, 1657, 1659,
+    1735, 1733, 1737,
+    1735, 1737, 1736,
+    1733, 1731, 1737,
+    1657, 1736, 1738,
+    1737, 1738, 1736,
+    1739, 1657, 1738,
+    1657, 1739, 1655,
+    1737, 1740, 1738,
+    1740, 1737, 1731,
+    1739, 1738, 1741,
+    1740, 1741, 1738,
+    1742, 1655, 1739,
+    1742, 1656, 1655,
+    1743, 1739, 1741,
+    1743, 1742, 1739,
+    1656, 1742, 1744,
+    1745, 1656, 1744,
+    1743, 1746, 1742,
+    1746, 1744, 1742,
+    1745, 1744, 1747,
+    1748, 1745, 1747,
+    1746, 1749, 1744,
+    1749, 1747, 1744,
+    1746, 1743, 1750,
+    1743, 1741, 1750,
+    1749, 1746, 1751,
+    1746, 1750, 1751,
+    1752, 1750, 1741,
+    1740, 1752, 1741,
+    1753, 1751, 1750,
+    1752, 1753, 1750,
+    1740, 1754, 1752,
+    1754, 1740, 1731,
+    1754, 1731, 1729,
+    1754, 1755, 1752,
+    1753, 1752, 1755,
+    1756, 1754, 1729,
+    1754, 1756, 1755,
+    1756, 1729, 1727,
+    1756, 1757, 1755,
+    1756, 1727, 1758,
+    1756, 1758, 1757,
+    1727, 1759, 1758,
+    1727, 1724, 1759,
+    1758, 1760, 1757,
+    1724, 1761, 1759,
+    1761, 1724, 1726,
+    1762, 1758, 1759,
+    1758, 1762, 1760,
+    1763, 1759, 1761,
+    1763, 1762, 1759,
+    1764, 1763, 1761,
+    1764, 1761, 1765,
+    1761, 1726, 1765,
+    1764, 1766, 1763,
+    1767, 1765, 1726,
+    1725, 1767, 1726,
+    1764, 1765, 1768,
+    1766, 1764, 1768,
+    1769, 1768, 1765,
+    1767, 1769, 1765,
+    1766, 1768, 1770,
+    1769, 1771, 1768,
+    1771, 1770, 1768,
+    1767, 1772, 1769,
+    1771, 1769, 1773,
+    1772, 1773, 1769,
+    1772, 1767, 1774,
+    1772, 1775, 1773,
+    1767, 1776, 1774,
+    1767, 1725, 1776,
+    1725, 1728, 1776,
+    1772, 1774, 1777,
+    1775, 1772, 1777,
+    1778, 1774, 1776,
+    1779, 1777, 1774,
+    1778, 1779, 1774,
+    1780, 1778, 1776,
+    1780, 1776, 1728,
+    1779, 1778, 1781,
+    1782, 1780, 1728,
+    1782, 1728, 1730,
+    1778, 1780, 1783,
+    1778, 1783, 1781,
+    1784, 1782, 1730,
+    1784, 1730, 1732,
+    1784, 1785, 1782,
+    1784, 1732, 1785,
+    1785, 1786, 1782,
+    1780, 1782, 1786,
+    1732, 1787, 1785,
+    1788, 1780, 1786,
+    1780, 1788, 1783,
+    1785, 1789, 1786,
+    1789, 1785, 1787,
+    1788, 1786, 1790,
+    1789, 1790, 1786,
+    1791, 1783, 1788,
+    1792, 1788, 1790,
+    1792, 1791, 1788,
+    1791, 1793, 1783,
+    1793, 1781, 1783,
+    1791, 1792, 1794,
+    1793, 1791, 1795,
+    1791, 1794, 1795,
+    1793, 1796, 1781,
+    1792, 1797, 1794,
+    1792, 1790, 1797,
+    1796, 1793, 1798,
+    1793, 1795, 1798,
+    1796, 1799, 1781,
+    1779, 1781, 1799,
+    1800, 1779, 1799,
+    1779, 1800, 1777,
+    1796, 1801, 1799,
+    1800, 1802, 1777,
+    1775, 1777, 1802,
+    1800, 1799, 1803,
+    1801, 1803, 1799,
+    1804, 1800, 1803,
+    1800, 1804, 1802,
+    1801, 1805, 1803,
+    1804, 1803, 1806,
+    1805, 1806, 1803,
+    1804, 1807, 1802,
+    1805, 1808, 1806,
+    1808, 1805, 1809,
+    1808, 1810, 1806,
+    1805, 1811, 1809,
+    1805, 1801, 1811,
+    1812, 1809, 1811,
+    1801, 1813, 1811,
+    1801, 1796, 1813,
+    1796, 1798, 1813,
+    1814, 1812, 1811,
+    1814, 1811, 1813,
+    1812, 1814, 1815,
+    1816, 1812, 1815,
+    1817, 1814, 1813,
+    1817, 1813, 1798,
+    1818, 1815, 1814,
+    1817, 1818, 1814,
+    1816, 1815, 1818,
+    1819, 1816, 1818,
+    1820, 1817, 1798,
+    1817, 1820, 1818,
+    1820, 1798, 1795,
+    1819, 1818, 1821,
+    1820, 1821, 1818,
+    1822, 1819, 1821,
+    1823, 1820, 1795,
+    1820, 1823, 1821,
+    1823, 1795, 1794,
+    1822, 1821, 1824,
+    1823, 1824, 1821,
+    1825, 1822, 1824,
+    1826, 1823, 1794,
+    1826, 1794, 1797,
+    1824, 1823, 1827,
+    1823, 1826, 1827,
+    1825, 1824, 1828,
+    1824, 1827, 1828,
+    1825, 1828, 1829,
+    1828, 1830, 1829,
+    1831, 1829, 1830,
+    1832, 1828, 1827,
+    1828, 1832, 1830,
+    1833, 1831, 1830,
+    1831, 1833, 1834,
+    1833, 1830, 1835,
+    1832, 1835, 1830,
+    1833, 1836, 1834,
+    1837, 1834, 1836,
+    1838, 1837, 1836,
+    1833, 1839, 1836,
+    1839, 1833, 1835,
+    1838, 1836, 1840,
+    1839, 1840, 1836,
+    1841, 1838, 1840,
+    1841, 1840, 1842,
+    1843, 1841, 1842,
+    1839, 1844, 1840,
+    1844, 1842, 1840,
+    1843, 1842, 1845,
+    1846, 1843, 1845,
+    1844, 1847, 1842,
+    1847, 1845, 1842,
+    1846, 1845, 1848,
+    1849, 1846, 1848,
+    1847, 1850, 1845,
+    1850, 1848, 1845,
+    1849, 1848, 1851,
+    1852, 1849, 1851,
+    1850, 1853, 1848,
+    1853, 1851, 1848,
+    1852, 1851, 1854,
+    1855, 1852, 1854,
+    1853, 1856, 1851,
+    1856, 1854, 1851,
+    1855, 1854, 1857,
+    1858, 1855, 1857,
+    1858, 1857, 1859,
+    1857, 1860, 1859,
+    1861, 1859, 1860,
+    1862, 1857, 1854,
+    1857, 1862, 1860,
+    1856, 1862, 1854,
+    1863, 1861, 1860,
+    1862, 1864, 1860,
+    1863, 1860, 1864,
+    1861, 1863, 1865,
+    1866, 1861, 1865,
+    1867, 1863, 1864,
+    1866, 1865, 1868,
+    1869, 1866, 1868,
+    1869, 1868, 1870,
+    1871, 1865, 1863,
+    1867, 1871, 1863,
+    1872, 1868, 1865,
+    1871, 1872, 1865,
+    1868, 1873, 1870,
+    1868, 1872, 1873,
+    1874, 1870, 1873,
+    1875, 1874, 1873,
+    1874, 1875, 1876,
+    1875, 1873, 1877,
+    1872, 1877, 1873,
+    1875, 1878, 1876,
+    1879, 1876, 1878,
+    1880, 1875, 1877,
+    1875, 1880, 1878,
+    1881, 1879, 1878,
+    1879, 1881, 1882,
+    1880, 1883, 1878,
+    1881, 1878, 1883,
+    1880, 1884, 1883,
+    1880, 1877, 1884,
+    1885, 1881, 1883,
+    1877, 1886, 1884,
+    1877, 1872, 1886,
+    1884, 1887, 1883,
+    1885, 1883, 1887,
+    1884, 1888, 1887,
+    1888, 1884, 1886,
+    1889, 1885, 1887,
+    1888, 1890, 1887,
+    1889, 1887, 1890,
+    1891, 1888, 1886,
+    1891, 1886, 1892,
+    1872, 1892, 1886,
+    1888, 1891, 1893,
+    1892, 1872, 1894,
+    1888, 1893, 1895,
+    1890, 1888, 1895,
+    1896, 1891, 1892,
+    1890, 1895, 1897,
+    1891, 1896, 1898,
+    1891, 1898, 1893,
+    1896, 1892, 1899,
+    1892, 1894, 1899,
+    1896, 1900, 1898,
+    1896, 1899, 1900,
+    1901, 1898, 1900,
+    1899, 1902, 1900,
+    1901, 1903, 1898,
+    1903, 1893, 1898,
+    1904, 1901, 1900,
+    1904, 1900, 1902,
+    1903, 1905, 1893,
+    1905, 1895, 1893,
+    1905, 1903, 1906,
+    1905, 1907, 1895,
+    1907, 1897, 1895,
+    1905, 1906, 1908,
+    1907, 1905, 1908,
+    1903, 1909, 1906,
+    1903, 1901, 1909,
+    1901, 1910, 1909,
+    1901, 1904, 1910,
+    1911, 1906, 1909,
+    1912, 1909, 1910,
+    1912, 1911, 1909,
+    1911, 1913, 1906,
+    1913, 1908, 1906,
+    1911, 1912, 1914,
+    1913, 1911, 1915,
+    1911, 1914, 1915,
+    1908, 1913, 1916,
+    1913, 1915, 1917,
+    1913, 1917, 1916,
+    1908, 1916, 1918,
+    1907, 1908, 1918,
+    1919, 1916, 1917,
+    1920, 1918, 1916,
+    1919, 1920, 1916,
+    1907, 1918, 1921,
+    1920, 1922, 1918,
+    1922, 1921, 1918,
+    1923, 1907, 1921,
+    1907, 1923, 1897,
+    1922, 1924, 1921,
+    1923, 1921, 1925,
+    1924, 1925, 1921,
+    1923, 1926, 1897,
+    1927, 1923, 1925,
+    1923, 1927, 1926,
+    1924, 1928, 1925,
+    1927, 1925, 1929,
+    1928, 1929, 1925,
+    1930, 1927, 1929,
+    1927, 1930, 1926,
+    1924, 1931, 1928,
+    1924, 1922, 1931,
+    1922, 1932, 1931,
+    1922, 1920, 1932,
+    1931, 1933, 1928,
+    1920, 1934, 1932,
+    1920, 1919, 1934,
+    1935, 1931, 1932,
+    1931, 1935, 1933,
+    1936, 1935, 1932,
+    1936, 1932, 1934,
+    1935, 1937, 1933,
+    1935, 1936, 1937,
+    1938, 1933, 1937,
+    1936, 1939, 1937,
+    1940, 1938, 1937,
+    1940, 1937, 1939,
+    1938, 1941, 1933,
+    1941, 1928, 1933,
+    1928, 1941, 1929,
+    1940, 1942, 1938,
+    1941, 1943, 1929,
+    1930, 1929, 1943,
+    1941, 1938, 1944,
+    1942, 1944, 1938,
+    1945, 1941, 1944,
+    1942, 1946, 1944,
+    1941, 1945, 1947,
+    1943, 1941, 1947,
+    1945, 1944, 1948,
+    1946, 1948, 1944,
+    1949, 1945, 1948,
+    1946, 1950, 1948,
+    1949, 1951, 1945,
+    1951, 1947, 1945,
+    1949, 1948, 1952,
+    1950, 1952, 1948,
+    1949, 1953, 1951,
+    1953, 1949, 1952,
+    1951, 1954, 1947,
+    1953, 1955, 1951,
+    1954, 1951, 1955,
+    1954, 1956, 1947,
+    1943, 1947, 1956,
+    1957, 1943, 1956,
+    1957, 1930, 1943,
+    1957, 1958, 1930,
+    1957, 1956, 1958,
+    1958, 1926, 1930,
+    1956, 1959, 1958,
+    1956, 1954, 1959,
+    1958, 1960, 1926,
+    1960, 1958, 1959,
+    1960, 1897, 1926,
+    1960, 1890, 1897,
+    1960, 1889, 1890,
+    1889, 1960, 1959,
+    1889, 1959, 1961,
+    1954, 1961, 1959,
+    1885, 1889, 1961,
+    1961, 1954, 1955,
+    1885, 1961, 1962,
+    1961, 1955, 1962,
+    1885, 1962, 1963,
+    1881, 1885, 1963,
+    1881, 1963, 1882,
+    1964, 1882, 1963,
+    1965, 1963, 1962,
+    1965, 1964, 1963,
+    1966, 1962, 1955,
+    1966, 1965, 1962,
+    1953, 1966, 1955,
+    1964, 1965, 1967,
+    1968, 1964, 1967,
+    1966, 1969, 1965,
+    1966, 1953, 1969,
+    1969, 1967, 1965,
+    1953, 1952, 1969,
+    1968, 1967, 1970,
+    1971, 1968, 1970,
+    1971, 1970, 1972,
+    1969, 1973, 1967,
+    1973, 1970, 1967,
+    1973, 1969, 1952,
+    1950, 1973, 1952,
+    1970, 1974, 1972,
+    1970, 1973, 1974,
+    1975, 1972, 1974,
+    1973, 1950, 1976,
+    1973, 1977, 1974,
+    1973, 1976, 1977,
+    1978, 1975, 1974,
+    1978, 1974, 1977,
+    1975, 1978, 1979,
+    1980, 1975, 1979,
+    1981, 1978, 1977,
+    1980, 1979, 1982,
+    1983, 1980, 1982,
+    1984, 1979, 1978,
+    1981, 1984, 1978,
+    1984, 1985, 1979,
+    1985, 1982, 1979,
+    1984, 1981, 1986,
+    1985, 1984, 1987,
+    1984, 1986, 1987,
+    1981, 1491, 1986,
+    1489, 1986, 1491,
+    1491, 1981, 1988,
+    1981, 1977, 1988,
+    1491, 1988, 1492,
+    1976, 1988, 1977,
+    1989, 1492, 1988,
+    1976, 1989, 1988,
+    1492, 1989, 1494,
+    1989, 1976, 1990,
+    1950, 1990, 1976,
+    1950, 1946, 1990,
+    1946, 1942, 1990,
+    1991, 1990, 1942,
+    1991, 1989, 1990,
+    1940, 1991, 1942,
+    1991, 1940, 1939,
+    1989, 1991, 1992,
+    1991, 1939, 1992,
+    1989, 1992, 1494,
+    1551, 1992, 1939,
+    1936, 1551, 1939,
+    1551, 1936, 1934,
+    1993, 1494, 1992,
+    1551, 1993, 1992,
+    1993, 1493, 1494,
+    1493, 1993, 1496,
+    1993, 1544, 1496,
+    1993, 1551, 1544,
+    1551, 1934, 1549,
+    1919, 1549, 1934,
+    1919, 1994, 1549,
+    1994, 1919, 1917,
+    1994, 1548, 1549,
+    1994, 1917, 1995,
+    1915, 1995, 1917,
+    1994, 1996, 1548,
+    1996, 1994, 1995,
+    1996, 1547, 1548,
+    1915, 1997, 1995,
+    1997, 1915, 1914,
+    1996, 1995, 1998,
+    1997, 1998, 1995,
+    1996, 1999, 1547,
+    1999, 1996, 1998,
+    1999, 1550, 1547,
+    1999, 1626, 1550,
+    1626, 1999, 2000,
+    1999, 1998, 2000,
+    1626, 2000, 1627,
+    2001, 2000, 1998,
+    1997, 2001, 1998,
+    2002, 1627, 2000,
+    2001, 2002, 2000,
+    2002, 1629, 1627,
+    2001, 1997, 2003,
+    1629, 2002, 2004,
+    1629, 2004, 1631,
+    1671, 1631, 2004,
+    2002, 2001, 2005,
+    2002, 2005, 2004,
+    2001, 2003, 2005,
+    2006, 1671, 2004,
+    2006, 2004, 2005,
+    1671, 2006, 1674,
+    2007, 2006, 2005,
+    2007, 2005, 2003,
+    2008, 1674, 2006,
+    2007, 2008, 2006,
+    2008, 1703, 1674,
+    1703, 2008, 1706,
+    2008, 2007, 2009,
+    2008, 2009, 1706,
+    2007, 2010, 2009,
+    2010, 2007, 2003,
+    2011, 1706, 2009,
+    2011, 1708, 1706,
+    2012, 2009, 2010,
+    2012, 2011, 2009,
+    1708, 2011, 2013,
+    1708, 2013, 1709,
+    2011, 2012, 2014,
+    2011, 2014, 2013,
+    2015, 1709, 2013,
+    1709, 2015, 1711,
+    2016, 2013, 2014,
+    2016, 2015, 2013,
+    2015, 2017, 1711,
+    1713, 1711, 2017,
+    2015, 2016, 2018,
+    2015, 2018, 2017,
+    2019, 1713, 2017,
+    1713, 2019, 1715,
+    2018, 2020, 2017,
+    2019, 2017, 2020,
+    2019, 2021, 1715,
+    1717, 1715, 2021,
+    2022, 2019, 2020,
+    2019, 2022, 2021,
+    2023, 1717, 2021,
+    1717, 2023, 1719,
+    2023, 1732, 1719,
+    1732, 2023, 1787,
+    2023, 2021, 2024,
+    2022, 2024, 2021,
+    2023, 2025, 1787,
+    2025, 2023, 2024,
+    2026, 1787, 2025,
+    2026, 1789, 1787,
+    2027, 2026, 2025,
+    2027, 2025, 2028,
+    2025, 2024, 2028,
+    2027, 2029, 2026,
+    2027, 2028, 2029,
+    2029, 2030, 2026,
+    1789, 2026, 2030,
+    2028, 2031, 2029,
+    2032, 2028, 2024,
+    2028, 2032, 2031,
+    2022, 2032, 2024,
+    2033, 2029, 2031,
+    2029, 2033, 2030,
+    2032, 2022, 2034,
+    2022, 2020, 2034,
+    2035, 2034, 2020,
+    2018, 2035, 2020,
+    2035, 2018, 2036,
+    2016, 2036, 2018,
+    2035, 2037, 2034,
+    2016, 2038, 2036,
+    2038, 2016, 2014,
+    2039, 2035, 2036,
+    2035, 2039, 2037,
+    2038, 2040, 2036,
+    2039, 2036, 2040,
+    2038, 2014, 2041,
+    2012, 2041, 2014,
+    2042, 2038, 2041,
+    2038, 2042, 2040,
+    2012, 2043, 2041,
+    2043, 2012, 2010,
+    2043, 2044, 2041,
+    2042, 2041, 2044,
+    2043, 2010, 2045,
+    2043, 2045, 2044,
+    2010, 2003, 2045,
+    1997, 2045, 2003,
+    2045, 1997, 1914,
+    2045, 1914, 2044,
+    1912, 2044, 1914,
+    1912, 2042, 2044,
+    2042, 1912, 1910,
+    2042, 1910, 2040,
+    1904, 2040, 1910,
+    1904, 2039, 2040,
+    2039, 1904, 2046,
+    2039, 2046, 2037,
+    1904, 2047, 2046,
+    2047, 1904, 1902,
+    2048, 2037, 2046,
+    2049, 2046, 2047,
+    2049, 2048, 2046,
+    2050, 2049, 2047,
+    2050, 2047, 2051,
+    2050, 2051, 2049,
+    2047, 1902, 2051,
+    2051, 2052, 2049,
+    2048, 2049, 2052,
+    2053, 2051, 1902,
+    2051, 2053, 2052,
+    1899, 2053, 1902,
+    2053, 1899, 1894,
+    2053, 2054, 2052,
+    2055, 2053, 1894,
+    2056, 2052, 2054,
+    2056, 2048, 2052,
+    2054, 2053, 2057,
+    2053, 2055, 2057,
+    2058, 2056, 2054,
+    2058, 2054, 2059,
+    2054, 2057, 2059,
+    2058, 2060, 2056,
+    2058, 2059, 2060,
+    2060, 2061, 2056,
+    2048, 2056, 2061,
+    2059, 2062, 2060,
+    2063, 2048, 2061,
+    2059, 2064, 2062,
+    2064, 2059, 2057,
+    2048, 2063, 2065,
+    2037, 2048, 2065,
+    2037, 2065, 2034,
+    2032, 2034, 2065,
+    2066, 2065, 2063,
+    2066, 2032, 2065,
+    2067, 2066, 2063,
+    2067, 2063, 2068,
+    2067, 2068, 2066,
+    2063, 2061, 2068,
+    2032, 2066, 2069,
+    2068, 2069, 2066,
+    2070, 2068, 2061,
+    2068, 2070, 2069,
+    2060, 2070, 2061,
+    2070, 2060, 2062,
+    2071, 2032, 2069,
+    2032, 2071, 2031,
+    2070, 2072, 2069,
+    2071, 2069, 2072,
+    2073, 2031, 2071,
+    2073, 2033, 2031,
+    2074, 2071, 2072,
+    2074, 2073, 2071,
+    2074, 2072, 2075,
+    2073, 2074, 2076,
+    2074, 2075, 2076,
+    2073, 2076, 2077,
+    2033, 2073, 2077,
+    1856, 2076, 2075,
+    1856, 1853, 2076,
+    1853, 2077, 2076,
+    1862, 1856, 2075,
+    1853, 1850, 2077,
+    1850, 2078, 2077,
+    2033, 2077, 2078,
+    1850, 1847, 2078,
+    2079, 2033, 2078,
+    2033, 2079, 2030,
+    1847, 2080, 2078,
+    2079, 2078, 2080,
+    1847, 1844, 2080,
+    2081, 2030, 2079,
+    2081, 1789, 2030,
+    2082, 2079, 2080,
+    2082, 2081, 2079,
+    1844, 2083, 2080,
+    2082, 2080, 2083,
+    1844, 1839, 2083,
+    1839, 1835, 2083,
+    2084, 2082, 2083,
+    2084, 2083, 1835,
+    2082, 2084, 2081,
+    1832, 2084, 1835,
+    2084, 2085, 2081,
+    2084, 1832, 2085,
+    1789, 2081, 2085,
+    1832, 2086, 2085,
+    2086, 1832, 1827,
+    2086, 1827, 1826,
+    2087, 1789, 2085,
+    2087, 2085, 2086,
+    1789, 2087, 1790,
+    2088, 2086, 1826,
+    2088, 2087, 2086,
+    2088, 1826, 1797,
+    2087, 2088, 2089,
+    2088, 1797, 2089,
+    2087, 2089, 1790,
+    1790, 2089, 1797,
+    2090, 2091, 2092,
+    2090, 2092, 2093,
+    2090, 2094, 2091,
+    2095, 2090, 2093,
+    2090, 2095, 2094,
+    2096, 2093, 2092,
+    2095, 2093, 2097,
+    2096, 2098, 2093,
+    2098, 2097, 2093,
+    2099, 2096, 2092,
+    2098, 2096, 2100,
+    2099, 2092, 2101,
+    2091, 2101, 2092,
+    2096, 2099, 2102,
+    2096, 2102, 2100,
+    2103, 2099, 2101,
+    2099, 2104, 2102,
+    2099, 2103, 2105,
+    2104, 2099, 2105,
+    2103, 2101, 2106,
+    2107, 2102, 2104,
+    2108, 2103, 2106,
+    2107, 2109, 2102,
+    2109, 2100, 2102,
+    2108, 2110, 2103,
+    2110, 2105, 2103,
+    2108, 2111, 2110,
+    2108, 2106, 2111,
+    2110, 2112, 2105,
+    2111, 2113, 2110,
+    2112, 2110, 2113,
+    2111, 2114, 2113,
+    2114, 2115, 2113,
+    2114, 2111, 2116,
+    2106, 2116, 2111,
+    2117, 2114, 2116,
+    2118, 2113, 2115,
+    2119, 2118, 2115,
+    2118, 2112, 2113,
+    2119, 2120, 2118,
+    2120, 2121, 2118,
+    2112, 2118, 2121,
+    2120, 2122, 2121,
+    2123, 2112, 2121,
+    2122, 2124, 2121,
+    2123, 2121, 2124,
+    2124, 2122, 2125,
+    2122, 2126, 2125,
+    2127, 2123, 2124,
+    2128, 2125, 2126,
+    2129, 2128, 2126,
+    2124, 2125, 2130,
+    2127, 2124, 2130,
+    2128, 2131, 2125,
+    2131, 2130, 2125,
+    2128, 2129, 2132,
+    2129, 2133, 2132,
+    2131, 2128, 2134,
+    2128, 2132, 2134,
+    2135, 2132, 2133,
+    2136, 2135, 2133,
+    2137, 2134, 2132,
+    2135, 2137, 2132,
+    2135, 2136, 2138,
+    2136, 2139, 2138,
+    2137, 2135, 2140,
+    2135, 2138, 2140,
+    2141, 2138, 2139,
+    2142, 2141, 2139,
+    2143, 2140, 2138,
+    2141, 2143, 2138,
+    2141, 2142, 2144,
+    2142, 2145, 2144,
+    2143, 2141, 2146,
+    2141, 2144, 2146,
+    2147, 2144, 2145,
+    2148, 2147, 2145,
+    2148, 2149, 2147,
+    2147, 2150, 2144,
+    2150, 2146, 2144,
+    2149, 2151, 2147,
+    2150, 2147, 2151,
+    2149, 2152, 2151,
+    2152, 2153, 2151,
+    2154, 2151, 2153,
+    2154, 2150, 2151,
+    2155, 2154, 2153,
+    2155, 2156, 2154,
+    2156, 2157, 2154,
+    2150, 2154, 2157,
+    2156, 2158, 2157,
+    2159, 2150, 2157,
+    2150, 2159, 2146,
+    2158, 2160, 2157,
+    2159, 2157, 2160,
+    2158, 2161, 2160,
+    2159, 2162, 2146,
+    2143, 2146, 2162,
+    2163, 2159, 2160,
+    2159, 2163, 2162,
+    2161, 2164, 2160,
+    2163, 2160, 2164,
+    2161, 2165, 2164,
+    2166, 2163, 2164,
+    2165, 2167, 2164,
+    2166, 2164, 2167,
+    2167, 2165, 2168,
+    2163, 2166, 2169,
+    2170, 2166, 2167,
+    2171, 2163, 2169,
+    2163, 2171, 2162,
+    2172, 2169, 2166,
+    2170, 2172, 2166,
+    2171, 2169, 2173,
+    2172, 2174, 2169,
+    2174, 2173, 2169,
+    2175, 2162, 2171,
+    2175, 2143, 2162,
+    2143, 2175, 2140,
+    2176, 2175, 2171,
+    2176, 2171, 2173,
+    2175, 2177, 2140,
+    2175, 2176, 2177,
+    2137, 2140, 2177,
+    2178, 2137, 2177,
+    2137, 2178, 2134,
+    2176, 2179, 2177,
+    2178, 2177, 2179,
+    2179, 2176, 2180,
+    2176, 2173, 2180,
+    2181, 2178, 2179,
+    2182, 2180, 2173,
+    2174, 2182, 2173,
+    2179, 2180, 2183,
+    2181, 2179, 2183,
+    2182, 2184, 2180,
+    2184, 2183, 2180,
+    2182, 2174, 2185,
+    2184, 2182, 2186,
+    2182, 2185, 2186,
+    2184, 2187, 2183,
+    2174, 2188, 2185,
+    2174, 2172, 2188,
+    2187, 2184, 2189,
+    2184, 2186, 2189,
+    2187, 2190, 2183,
+    2181, 2183, 2190,
+    2187, 2191, 2190,
+    2192, 2181, 2190,
+    2191, 2187, 2193,
+    2187, 2189, 2193,
+    2191, 2194, 2190,
+    2192, 2190, 2194,
+    2191, 2195, 2194,
+    2196, 2192, 2194,
+    2195, 2191, 2197,
+    2191, 2193, 2197,
+    2195, 2198, 2194,
+    2196, 2194, 2198,
+    2195, 2199, 2198,
+    2200, 2196, 2198,
+    2199, 2195, 2201,
+    2195, 2197, 2201,
+    2199, 2202, 2198,
+    2200, 2198, 2202,
+    2199, 2203, 2202,
+    2196, 2200, 2204,
+    2196, 2204, 2192,
+    2203, 2199, 2205,
+    2199, 2201, 2205,
+    2204, 2206, 2192,
+    2181, 2192, 2206,
+    2178, 2181, 2206,
+    2178, 2206, 2134,
+    2131, 2134, 2206,
+    2204, 2131, 2206,
+    2131, 2204, 2207,
+    2200, 2207, 2204,
+    2130, 2131, 2207,
+    2200, 2208, 2207,
+    2208, 2200, 2202,
+    2130, 2207, 2209,
+    2208, 2209, 2207,
+    2127, 2130, 2209,
+    2127, 2209, 2123,
+    2209, 2210, 2123,
+    2209, 2208, 2210,
+    2112, 2123, 2210,
+    2211, 2112, 2210,
+    2112, 2211, 2105,
+    2104, 2105, 2211,
+    2212, 2104, 2211,
+    2212, 2107, 2104,
+    2212, 2211, 2213,
+    2212, 2213, 2107,
+    2211, 2210, 2213,
+    2208, 2213, 2210,
+    2213, 2214, 2107,
+    2213, 2208, 2214,
+    2208, 2202, 2214,
+    2109, 2107, 2214,
+    2203, 2214, 2202,
+    2203, 2109, 2214,
+    2109, 2203, 2215,
+    2109, 2215, 2100,
+    2203, 2205, 2215,
+    2215, 2216, 2100,
+    2098, 2100, 2216,
+    2217, 2215, 2205,
+    2215, 2217, 2216,
+    2218, 2098, 2216,
+    2098, 2218, 2097,
+    2218, 2216, 2219,
+    2217, 2219, 2216,
+    2218, 2220, 2097,
+    2221, 2218, 2219,
+    2218, 2221, 2220,
+    2222, 2097, 2220,
+    2222, 2095, 2097,
+    2095, 2222, 2223,
+    2095, 2223, 2094,
+    2224, 2222, 2220,
+    2222, 2225, 2223,
+    2222, 2224, 2225,
+    2224, 2220, 2226,
+    2221, 2226, 2220,
+    2224, 2227, 2225,
+    2228, 2224, 2226,
+    2224, 2228, 2227,
+    2221, 2229, 2226,
+    2228, 2226, 2230,
+    2229, 2230, 2226,
+    2231, 2228, 2230,
+    2229, 2221, 2232,
+    2228, 2231, 2233,
+    2228, 2233, 2227,
+    2229, 2234, 2230,
+    2231, 2230, 2235,
+    2234, 2235, 2230,
+    2234, 2229, 2236,
+    2229, 2232, 2236,
+    2234, 2237, 2235,
+    2234, 2236, 2238,
+    2237, 2234, 2238,
+    2239, 2238, 2236,
+    2237, 2240, 2235,
+    2241, 2239, 2236,
+    2241, 2236, 2232,
+    2237, 2238, 2242,
+    2243, 2241, 2232,
+    2244, 2237, 2242,
+    2237, 2244, 2240,
+    2245, 2242, 2238,
+    2239, 2245, 2238,
+    2244, 2242, 2246,
+    2242, 2245, 2247,
+    2242, 2247, 2246,
+    2245, 2239, 2248,
+    2245, 2249, 2247,
+    2245, 2248, 2249,
+    2239, 2250, 2248,
+    2239, 2241, 2250,
+    2248, 2251, 2249,
+    2241, 2252, 2250,
+    2241, 2243, 2252,
+    2253, 2248, 2250,
+    2248, 2253, 2251,
+    2254, 2253, 2250,
+    2254, 2250, 2252,
+    2253, 2255, 2251,
+    2253, 2254, 2256,
+    2253, 2256, 2255,
+    2257, 2254, 2252,
+    2254, 2258, 2256,
+    2254, 2257, 2258,
+    2257, 2252, 2259,
+    2243, 2259, 2252,
+    2257, 2260, 2258,
+    2261, 2257, 2259,
+    2257, 2261, 2260,
+    2243, 2262, 2259,
+    2261, 2259, 2263,
+    2262, 2263, 2259,
+    2262, 2243, 2264,
+    2243, 2232, 2264,
+    2221, 2264, 2232,
+    2221, 2219, 2264,
+    2219, 2265, 2264,
+    2262, 2264, 2265,
+    2219, 2217, 2265,
+    2266, 2262, 2265,
+    2262, 2266, 2263,
+    2217, 2267, 2265,
+    2266, 2265, 2267,
+    2267, 2217, 2268,
+    2269, 2266, 2267,
+    2217, 2270, 2268,
+    2270, 2217, 2205,
+    2270, 2205, 2201,
+    2271, 2270, 2201,
+    2271, 2201, 2197,
+    2272, 2268, 2270,
+    2271, 2272, 2270,
+    2273, 2271, 2197,
+    2273, 2197, 2193,
+    2272, 2271, 2274,
+    2275, 2273, 2193,
+    2275, 2193, 2189,
+    2271, 2273, 2276,
+    2271, 2276, 2274,
+    2273, 2275, 2277,
+    2273, 2277, 2276,
+    2278, 2275, 2189,
+    2278, 2189, 2186,
+    2275, 2279, 2277,
+    2275, 2278, 2279,
+    2280, 2278, 2186,
+    2280, 2186, 2185,
+    2278, 2281, 2279,
+    2278, 2280, 2281,
+    2282, 2280, 2185,
+    2282, 2185, 2188,
+    2280, 2283, 2281,
+    2280, 2282, 2283,
+    2284, 2281, 2283,
+    2282, 2285, 2283,
+    2284, 2286, 2281,
+    2286, 2279, 2281,
+    2287, 2284, 2283,
+    2287, 2283, 2285,
+    2286, 2288, 2279,
+    2288, 2277, 2279,
+    2288, 2289, 2277,
+    2289, 2276, 2277,
+    2288, 2286, 2290,
+    2289, 2291, 2276,
+    2291, 2274, 2276,
+    2289, 2288, 2292,
+    2288, 2290, 2292,
+    2291, 2289, 2293,
+    2289, 2292, 2293,
+    2291, 2294, 2274,
+    2291, 2293, 2295,
+    2294, 2291, 2295,
+    2294, 2296, 2274,
+    2272, 2274, 2296,
+    2294, 2295, 2297,
+    2298, 2272, 2296,
+    2272, 2298, 2268,
+    2294, 2299, 2296,
+    2299, 2294, 2297,
+    2298, 2296, 2300,
+    2299, 2300, 2296,
+    2298, 2301, 2268,
+    2267, 2268, 2301,
+    2269, 2267, 2301,
+    2298, 2302, 2301,
+    2302, 2298, 2300,
+    2269, 2301, 2303,
+    2302, 2303, 2301,
+    2304, 2269, 2303,
+    2302, 2305, 2303,
+    2269, 2304, 2306,
+    2266, 2269, 2306,
+    2266, 2306, 2263,
+    2307, 2263, 2306,
+    2307, 2261, 2263,
+    2308, 2306, 2304,
+    2308, 2307, 2306,
+    2309, 2308, 2304,
+    2261, 2307, 2310,
+    2261, 2310, 2260,
+    2309, 2304, 2311,
+    2304, 2303, 2311,
+    2305, 2311, 2303,
+    2309, 2311, 2312,
+    2309, 2312, 2308,
+    2311, 2305, 2313,
+    2311, 2313, 2312,
+    2312, 2314, 2308,
+    2307, 2308, 2314,
+    2315, 2312, 2313,
+    2312, 2315, 2314,
+    2316, 2315, 2313,
+    2315, 2317, 2314,
+    2316, 2313, 2318,
+    2305, 2318, 2313,
+    2319, 2316, 2318,
+    2320, 2314, 2317,
+    2320, 2307, 2314,
+    2321, 2320, 2317,
+    2307, 2320, 2310,
+    2321, 2322, 2320,
+    2322, 2310, 2320,
+    2322, 2321, 2323,
+    2321, 2324, 2323,
+    2322, 2325, 2310,
+    2325, 2260, 2310,
+    2325, 2322, 2326,
+    2322, 2323, 2326,
+    2325, 2327, 2260,
+    2327, 2258, 2260,
+    2327, 2325, 2328,
+    2325, 2326, 2328,
+    2327, 2329, 2258,
+    2329, 2256, 2258,
+    2329, 2327, 2330,
+    2327, 2328, 2330,
+    2256, 2329, 2331,
+    2256, 2331, 2255,
+    2329, 2332, 2331,
+    2329, 2330, 2332,
+    2333, 2255, 2331,
+    2334, 2331, 2332,
+    2334, 2333, 2331,
+    2333, 2335, 2255,
+    2335, 2251, 2255,
+    2335, 2333, 2336,
+    2335, 2337, 2251,
+    2337, 2249, 2251,
+    2335, 2336, 2338,
+    2337, 2335, 2338,
+    2333, 2339, 2336,
+    2338, 2336, 2339,
+    2333, 2334, 2339,
+    2337, 2338, 2340,
+    2341, 2337, 2340,
+    2337, 2341, 2249,
+    2341, 2247, 2249,
+    2342, 2340, 2338,
+    2341, 2340, 2342,
+    2341, 2343, 2247,
+    2343, 2341, 2342,
+    2343, 2246, 2247,
+    2343, 2342, 2344,
+    2343, 2345, 2246,
+    2345, 2343, 2344,
+    2345, 2346, 2246,
+    2244, 2246, 2346,
+    2345, 2344, 2347,
+    2347, 2344, 2342,
+    2345, 2348, 2346,
+    2348, 2345, 2347,
+    2349, 2244, 2346,
+    2244, 2349, 2240,
+    2348, 2350, 2346,
+    2349, 2346, 2350,
+    2348, 2347, 2351,
+    2352, 2348, 2351,
+    2348, 2352, 2350,
+    2353, 2351, 2347,
+    2352, 2351, 2353,
+    2354, 2353, 2347,
+    2354, 2347, 2342,
+    2354, 2342, 2338,
+    2354, 2338, 2339,
+    2355, 2352, 2353,
+    2352, 2355, 2356,
+    2352, 2356, 2350,
+    2355, 2353, 2357,
+    2358, 2350, 2356,
+    2358, 2349, 2350,
+    2355, 2359, 2356,
+    2358, 2360, 2349,
+    2360, 2240, 2349,
+    2361, 2358, 2356,
+    2361, 2356, 2359,
+    2360, 2358, 2362,
+    2358, 2361, 2362,
+    2360, 2363, 2240,
+    2363, 2235, 2240,
+    2363, 2231, 2235,
+    2363, 2360, 2364,
+    2360, 2362, 2364,
+    2231, 2363, 2365,
+    2363, 2364, 2365,
+    2231, 2365, 2233,
+    2366, 2365, 2364,
+    2367, 2233, 2365,
+    2366, 2367, 2365,
+    2367, 2368, 2233,
+    2368, 2227, 2233,
+    2367, 2366, 2369,
+    2368, 2370, 2227,
+    2370, 2225, 2227,
+    2368, 2367, 2371,
+    2367, 2369, 2371,
+    2370, 2368, 2372,
+    2368, 2371, 2372,
+    2370, 2373, 2225,
+    2373, 2223, 2225,
+    2373, 2370, 2374,
+    2370, 2372, 2374,
+    2373, 2375, 2223,
+    2375, 2094, 2223,
+    2375, 2373, 2376,
+    2373, 2374, 2376,
+    2094, 2375, 2377,
+    2094, 2377, 2091,
+    2375, 2378, 2377,
+    2375, 2376, 2378,
+    2379, 2091, 2377,
+    2091, 2379, 2101,
+    2379, 2106, 2101,
+    2106, 2379, 2116,
+    2380, 2379, 2377,
+    2380, 2377, 2378,
+    2379, 2381, 2116,
+    2379, 2380, 2381,
+    2117, 2116, 2381,
+    2382, 2117, 2381,
+    2382, 2381, 2383,
+    2380, 2383, 2381,
+    2384, 2382, 2383,
+    2380, 2385, 2383,
+    2385, 2380, 2378,
+    2384, 2383, 2386,
+    2385, 2386, 2383,
+    2387, 2384, 2386,
+    2385, 2378, 2388,
+    2376, 2388, 2378,
+    2385, 2389, 2386,
+    2389, 2385, 2388,
+    2387, 2386, 2390,
+    2389, 2390, 2386,
+    2391, 2387, 2390,
+    2391, 2390, 2392,
+    2393, 2391, 2392,
+    2389, 2394, 2390,
+    2394, 2392, 2390,
+    2393, 2392, 2395,
+    2396, 2393, 2395,
+    2394, 2397, 2392,
+    2397, 2395, 2392,
+    2396, 2395, 2398,
+    2399, 2396, 2398,
+    2399, 2398, 2400,
+    2401, 2398, 2395,
+    2397, 2401, 2395,
+    2398, 2402, 2400,
+    2398, 2401, 2402,
+    2403, 2400, 2402,
+    2404, 2403, 2402,
+    2404, 2402, 2405,
+    2401, 2405, 2402,
+    2406, 2404, 2405,
+    2406, 2405, 2407,
+    2405, 2408, 2407,
+    2405, 2401, 2408,
+    2409, 2407, 2408,
+    2401, 2410, 2408,
+    2401, 2397, 2410,
+    2411, 2409, 2408,
+    2411, 2408, 2410,
+    2409, 2411, 2412,
+    2397, 2413, 2410,
+    2397, 2394, 2413,
+    2414, 2411, 2410,
+    2414, 2410, 2413,
+    2411, 2415, 2412,
+    2411, 2414, 2415,
+    2416, 2412, 2415,
+    2414, 2417, 2415,
+    2418, 2416, 2415,
+    2418, 2415, 2417,
+    2416, 2418, 2419,
+    2417, 2414, 2420,
+    2421, 2416, 2419,
+    2416, 2421, 2422,
+    2421, 2423, 2422,
+    2424, 2422, 2423,
+    2421, 2419, 2425,
+    2426, 2424, 2423,
+    2424, 2426, 2324,
+    2426, 2323, 2324,
+    2421, 2427, 2423,
+    2427, 2421, 2425,
+    2426, 2423, 2428,
+    2427, 2428, 2423,
+    2426, 2429, 2323,
+    2429, 2426, 2428,
+    2429, 2326, 2323,
+    2429, 2430, 2326,
+    2430, 2328, 2326,
+    2429, 2428, 2431,
+    2430, 2429, 2431,
+    2430, 2432, 2328,
+    2432, 2330, 2328,
+    2430, 2431, 2433,
+    2432, 2430, 2433,
+    2330, 2432, 2434,
+    2330, 2434, 2332,
+    2432, 2433, 2435,
+    2432, 2435, 2434,
+    2436, 2332, 2434,
+    2436, 2334, 2332,
+    2437, 2434, 2435,
+    2437, 2436, 2434,
+    2334, 2436, 2438,
+    2334, 2438, 2339,
+    2436, 2439, 2438,
+    2339, 2438, 2439,
+    2436, 2437, 2439,
+    2354, 2339, 2439,
+    2437, 2440, 2439,
+    2437, 2441, 2440,
+    2441, 2437, 2435,
+    2439, 2440, 2442,
+    2441, 2442, 2440,
+    2354, 2439, 2442,
+    2441, 2435, 2443,
+    2433, 2443, 2435,
+    2444, 2441, 2443,
+    2441, 2444, 2442,
+    2433, 2445, 2443,
+    2445, 2433, 2431,
+    2444, 2443, 2446,
+    2445, 2446, 2443,
+    2447, 2445, 2431,
+    2447, 2431, 2428,
+    2427, 2447, 2428,
+    2445, 2447, 2448,
+    2445, 2448, 2446,
+    2447, 2427, 2449,
+    2447, 2449, 2448,
+    2427, 2425, 2449,
+    2450, 2448, 2449,
+    2451, 2449, 2425,
+    2451, 2450, 2449,
+    2452, 2451, 2425,
+    2452, 2425, 2419,
+    2450, 2451, 2453,
+    2454, 2452, 2419,
+    2454, 2419, 2418,
+    2451, 2452, 2455,
+    2451, 2455, 2453,
+    2452, 2454, 2456,
+    2452, 2456, 2455,
+    2457, 2454, 2418,
+    2457, 2418, 2417,
+    2454, 2458, 2456,
+    2454, 2457, 2458,
+    2457, 2417, 2459,
+    2417, 2420, 2459,
+    2457, 2460, 2458,
+    2457, 2459, 2461,
+    2460, 2457, 2461,
+    2462, 2461, 2459,
+    2463, 2458, 2460,
+    2464, 2462, 2459,
+    2464, 2459, 2420,
+    2462, 2464, 2371,
+    2464, 2372, 2371,
+    2462, 2371, 2369,
+    2464, 2465, 2372,
+    2465, 2464, 2420,
+    2465, 2374, 2372,
+    2465, 2420, 2466,
+    2414, 2466, 2420,
+    2466, 2414, 2413,
+    2465, 2467, 2374,
+    2467, 2465, 2466,
+    2467, 2376, 2374,
+    2376, 2467, 2388,
+    2467, 2466, 2468,
+    2467, 2468, 2388,
+    2466, 2413, 2468,
+    2389, 2388, 2468,
+    2394, 2468, 2413,
+    2394, 2389, 2468,
+    2469, 2462, 2369,
+    2462, 2469, 2461,
+    2469, 2369, 2470,
+    2366, 2470, 2369,
+    2469, 2471, 2461,
+    2460, 2461, 2471,
+    2472, 2469, 2470,
+    2469, 2472, 2471,
+    2473, 2460, 2471,
+    2473, 2463, 2460,
+    2473, 2471, 2474,
+    2463, 2473, 2474,
+    2472, 2474, 2471,
+    2463, 2474, 2475,
+    2472, 2476, 2474,
+    2476, 2475, 2474,
+    2476, 2472, 2477,
+    2472, 2470, 2477,
+    2476, 2478, 2475,
+    2479, 2477, 2470,
+    2366, 2479, 2470,
+    2479, 2366, 2364,
+    2479, 2364, 2362,
+    2480, 2479, 2362,
+    2479, 2480, 2477,
+    2480, 2362, 2361,
+    2480, 2481, 2477,
+    2476, 2477, 2481,
+    2478, 2476, 2481,
+    2482, 2480, 2361,
+    2480, 2482, 2481,
+    2482, 2361, 2359,
+    2482, 2483, 2481,
+    2478, 2481, 2483,
+    2482, 2359, 2484,
+    2483, 2482, 2484,
+    2485, 2484, 2359,
+    2355, 2485, 2359,
+    2485, 2355, 2357,
+    2485, 2357, 2486,
+    2486, 2357, 2353,
+    2354, 2486, 2353,
+    2487, 2485, 2486,
+    2485, 2487, 2484,
+    2487, 2486, 2488,
+    2487, 2489, 2484,
+    2483, 2484, 2489,
+    2490, 2487, 2488,
+    2487, 2490, 2489,
+    2491, 2488, 2486,
+    2490, 2488, 2491,
+    2354, 2491, 2486,
+    2490, 2492, 2489,
+    2493, 2483, 2489,
+    2493, 2489, 2492,
+    2493, 2478, 2483,
+    2490, 2494, 2492,
+    2494, 2490, 2491,
+    2478, 2493, 2495,
+    2478, 2495, 2475,
+    2493, 2496, 2495,
+    2496, 2493, 2492,
+    2497, 2475, 2495,
+    2497, 2463, 2475,
+    2463, 2497, 2458,
+    2497, 2456, 2458,
+    2498, 2497, 2495,
+    2497, 2498, 2456,
+    2498, 2495, 2496,
+    2498, 2455, 2456,
+    2498, 2499, 2455,
+    2499, 2498, 2496,
+    2499, 2453, 2455,
+    2499, 2496, 2500,
+    2496, 2492, 2500,
+    2494, 2500, 2492,
+    2453, 2499, 2501,
+    2499, 2500, 2501,
+    2494, 2502, 2500,
+    2502, 2501, 2500,
+    2502, 2494, 2503,
+    2494, 2491, 2503,
+    2504, 2503, 2491,
+    2502, 2503, 2504,
+    2354, 2504, 2491,
+    2502, 2505, 2501,
+    2505, 2502, 2504,
+    2505, 2506, 2501,
+    2453, 2501, 2506,
+    2450, 2453, 2506,
+    2450, 2506, 2507,
+    2448, 2450, 2507,
+    2448, 2507, 2446,
+    2508, 2507, 2506,
+    2505, 2508, 2506,
+    2509, 2446, 2507,
+    2508, 2509, 2507,
+    2509, 2444, 2446,
+    2508, 2505, 2510,
+    2505, 2504, 2510,
+    2508, 2510, 2511,
+    2511, 2510, 2504,
+    2509, 2508, 2511,
+    2354, 2511, 2504,
+    2354, 2442, 2511,
+    2509, 2511, 2512,
+    2442, 2512, 2511,
+    2444, 2509, 2512,
+    2444, 2512, 2442,
+    2513, 2514, 2515,
+    2513, 2515, 2516,
+    2517, 2513, 2516,
+    2514, 2518, 2515,
+    2514, 2519, 2518,
+    2519, 2520, 2518,
+    2521, 2518, 2520,
+    2522, 2521, 2520,
+    2523, 2515, 2518,
+    2521, 2523, 2518,
+    2523, 2524, 2515,
+    2524, 2516, 2515,
+    2523, 2521, 2525,
+    2524, 2523, 2526,
+    2523, 2525, 2526,
+    2524, 2527, 2516,
+    2521, 2528, 2525,
+    2521, 2522, 2528,
+    2527, 2524, 2529,
+    2524, 2526, 2529,
+    2527, 2530, 2516,
+    2517, 2516, 2530,
+    2531, 2517, 2530,
+    2531, 2530, 2532,
+    2533, 2531, 2532,
+    2527, 2534, 2530,
+    2534, 2532, 2530,
+    2533, 2532, 2535,
+    2536, 2533, 2535,
+    2536, 2535, 2537,
+    2538, 2535, 2532,
+    2534, 2538, 2532,
+    2535, 2539, 2537,
+    2535, 2538, 2539,
+    10, 2537, 2539,
+    2540, 10, 2539,
+    10, 2540, 9,
+    2538, 2541, 2539,
+    2540, 2539, 2541,
+    2538, 2542, 2541,
+    2538, 2534, 2542,
+    2543, 2540, 2541,
+    2534, 2544, 2542,
+    2534, 2527, 2544,
+    2527, 2529, 2544,
+    2542, 2545, 2541,
+    2543, 2541, 2545,
+    2546, 2542, 2544,
+    2542, 2546, 2545,
+    2547, 2546, 2544,
+    2547, 2544, 2529,
+    2546, 2548, 2545,
+    2549, 2547, 2529,
+    2549, 2529, 2526,
+    2546, 2547, 2550,
+    2546, 2550, 2548,
+    2547, 2549, 2551,
+    2547, 2551, 2550,
+    2552, 2549, 2526,
+    2552, 2526, 2525,
+    2549, 2553, 2551,
+    2549, 2552, 2553,
+    2554, 2552, 2525,
+    2554, 2525, 2528,
+    2552, 2555, 2553,
+    2552, 2554, 2555,
+    2556, 2553, 2555,
+    2554, 2557, 2555,
+    2556, 2558, 2553,
+    2558, 2551, 2553,
+    2559, 2556, 2555,
+    2559, 2555, 2557,
+    2558, 2556, 2560,
+    2556, 2559, 2561,
+    2556, 2561, 2560,
+    2558, 2562, 2551,
+    2562, 2550, 2551,
+    2558, 2560, 2563,
+    2562, 2558, 2563,
+    2550, 2562, 2564,
+    2550, 2564, 2548,
+    2562, 2563, 2565,
+    2562, 2566, 2564,
+    2566, 2562, 2565,
+    2567, 2548, 2564,
+    2568, 2564, 2566,
+    2568, 2567, 2564,
+    2567, 2569, 2548,
+    2569, 2545, 2548,
+    2569, 2543, 2545,
+    2567, 2570, 2569,
+    2543, 2569, 2571,
+    2570, 2571, 2569,
+    2572, 2543, 2571,
+    2543, 2572, 2540,
+    2572, 9, 2540,
+    2572, 11, 9,
+    2572, 2571, 2573,
+    11, 2572, 2573,
+    2574, 2573, 2571,
+    2570, 2574, 2571,
+    11, 2573, 2575,
+    2574, 2576, 2573,
+    2576, 2575, 2573,
+    2574, 2570, 2577,
+    2576, 2574, 2578,
+    2574, 2577, 2578,
+    2570, 2579, 2577,
+    2570, 2567, 2579,
+    2567, 2568, 2579,
+    2580, 2577, 2579,
+    2581, 2579, 2568,
+    2581, 2580, 2579,
+    2582, 2581, 2568,
+    2582, 2568, 2566,
+    2582, 2566, 2583,
+    2566, 2565, 2583,
+    2581, 2582, 2584,
+    2582, 2583, 2584,
+    2581, 2584, 2585,
+    2580, 2581, 2585,
+    2586, 2584, 2583,
+    2587, 2585, 2584,
+    2586, 2587, 2584,
+    2580, 2585, 2588,
+    2587, 2589, 2585,
+    2589, 2588, 2585,
+    2587, 2586, 2590,
+    2587, 2590, 2589,
+    2591, 2586, 2583,
+    2591, 2583, 2565,
+    2586, 2592, 2590,
+    2586, 2591, 2592,
+    2593, 2591, 2565,
+    2593, 2565, 2563,
+    2591, 2594, 2592,
+    2595, 2593, 2563,
+    2595, 2563, 2560,
+    2591, 2593, 2596,
+    2594, 2591, 2596,
+    2595, 2597, 2593,
+    2597, 2596, 2593,
+    2598, 2595, 2560,
+    2598, 2560, 2561,
+    2597, 2595, 2599,
+    2595, 2598, 2599,
+    2597, 2600, 2596,
+    2597, 2599, 2601,
+    2600, 2597, 2601,
+    2600, 2602, 2596,
+    2594, 2596, 2602,
+    2600, 2601, 2603,
+    2604, 2594, 2602,
+    2600, 2605, 2602,
+    2605, 2600, 2603,
+    2604, 2602, 2606,
+    2605, 2606, 2602,
+    2604, 2607, 2594,
+    2607, 2592, 2594,
+    2608, 2604, 2606,
+    2604, 2608, 2607,
+    2607, 2609, 2592,
+    2609, 2590, 2592,
+    2608, 2610, 2607,
+    2609, 2607, 2610,
+    2590, 2609, 2611,
+    2590, 2611, 2589,
+    2612, 2609, 2610,
+    2613, 2589, 2611,
+    2589, 2613, 2588,
+    2609, 2614, 2611,
+    2609, 2612, 2614,
+    2615, 2613, 2611,
+    2615, 2611, 2614,
+    2613, 2615, 2616,
+    2617, 2615, 2614,
+    2613, 2616, 2618,
+    2613, 2618, 2588,
+    2615, 2619, 2616,
+    2615, 2617, 2619,
+    2616, 2620, 2618,
+    2621, 2616, 2619,
+    2616, 2621, 2620,
+    2622, 2588, 2618,
+    2622, 2580, 2588,
+    2580, 2622, 2577,
+    2622, 2578, 2577,
+    2623, 2622, 2618,
+    2622, 2623, 2578,
+    2623, 2618, 2620,
+    2623, 2624, 2578,
+    2576, 2578, 2624,
+    2625, 2623, 2620,
+    2623, 2625, 2624,
+    2626, 2576, 2624,
+    2576, 2626, 2575,
+    2625, 2627, 2624,
+    2626, 2624, 2627,
+    2625, 2620, 2628,
+    2621, 2628, 2620,
+    2629, 2625, 2628,
+    2625, 2629, 2627,
+    2621, 2630, 2628,
+    2629, 2628, 2631,
+    2630, 2631, 2628,
+    2621, 2632, 2630,
+    2632, 2621, 2619,
+    2632, 2633, 2630,
+    2632, 2619, 2634,
+    2617, 2634, 2619,
+    2632, 2635, 2633,
+    2635, 2632, 2634,
+    2636, 2630, 2633,
+    2630, 2636, 2631,
+    2635, 2637, 2633,
+    2638, 2633, 2637,
+    2638, 2636, 2633,
+    2637, 2635, 2639,
+    2640, 2638, 2637,
+    2637, 2639, 2641,
+    2640, 2637, 2641,
+    2640, 2642, 2638,
+    2640, 2641, 2643,
+    2642, 2640, 2643,
+    2642, 2644, 2638,
+    2636, 2638, 2644,
+    2642, 2645, 2644,
+    2645, 2642, 2646,
+    2642, 2643, 2646,
+    2645, 2647, 2644,
+    2645, 2646, 2647,
+    2648, 2644, 2647,
+    2648, 2636, 2644,
+    2646, 2649, 2647,
+    2650, 2648, 2647,
+    2650, 2647, 2649,
+    2646, 2651, 2649,
+    2651, 2646, 2643,
+    2652, 2650, 2649,
+    2653, 2651, 2643,
+    2653, 2643, 2641,
+    2651, 2654, 2649,
+    2652, 2649, 2654,
+    2651, 2653, 2655,
+    2651, 2656, 2654,
+    2656, 2651, 2655,
+    2657, 2652, 2654,
+    2656, 2658, 2654,
+    2657, 2654, 2658,
+    2656, 2659, 2658,
+    2657, 2660, 2652,
+    2659, 2656, 2661,
+    2656, 2655, 2661,
+    2662, 2657, 2658,
+    2657, 2662, 2660,
+    2662, 2658, 2663,
+    2659, 2663, 2658,
+    2662, 2664, 2660,
+    2659, 2665, 2663,
+    2659, 2661, 2665,
+    2666, 2662, 2663,
+    2662, 2666, 2664,
+    2666, 2663, 2667,
+    2665, 2667, 2663,
+    2666, 2668, 2664,
+    2665, 2669, 2667,
+    2670, 2666, 2667,
+    2669, 2671, 2667,
+    2670, 2667, 2671,
+    2666, 2670, 2672,
+    2668, 2666, 2672,
+    2673, 2670, 2671,
+    2674, 2672, 2670,
+    2673, 2674, 2670,
+    2673, 2671, 2675,
+    2673, 2676, 2674,
+    2676, 2673, 2675,
+    2677, 2675, 2671,
+    2669, 2677, 2671,
+    2676, 2675, 2678,
+    2669, 2679, 2677,
+    2677, 2680, 2675,
+    2680, 2678, 2675,
+    2679, 2681, 2677,
+    2680, 2677, 2681,
+    2669, 2682, 2679,
+    2669, 2665, 2682,
+    2665, 2683, 2682,
+    2661, 2683, 2665,
+    2661, 2684, 2683,
+    2684, 2682, 2683,
+    2684, 2661, 2655,
+    2682, 2684, 2685,
+    2682, 2685, 2679,
+    2686, 2684, 2655,
+    2686, 2655, 2653,
+    2684, 2687, 2685,
+    2684, 2686, 2687,
+    2688, 2679, 2685,
+    2679, 2688, 2681,
+    2689, 2688, 2685,
+    2689, 2685, 2687,
+    2688, 2690, 2681,
+    2688, 2689, 2691,
+    2688, 2691, 2690,
+    2692, 2681, 2690,
+    2692, 2680, 2681,
+    2691, 2693, 2690,
+    2694, 2692, 2690,
+    2694, 2690, 2693,
+    2680, 2692, 2695,
+    2692, 2694, 2696,
+    2692, 2696, 2695,
+    2680, 2695, 2697,
+    2678, 2680, 2697,
+    2698, 2695, 2696,
+    2699, 2697, 2695,
+    2698, 2699, 2695,
+    2678, 2697, 2700,
+    2699, 2701, 2697,
+    2701, 2700, 2697,
+    2702, 2678, 2700,
+    2702, 2676, 2678,
+    2701, 2703, 2700,
+    2676, 2702, 2704,
+    2676, 2704, 2674,
+    2702, 2700, 2705,
+    2703, 2705, 2700,
+    2702, 2706, 2704,
+    2706, 2702, 2705,
+    2707, 2674, 2704,
+    2674, 2707, 2672,
+    2708, 2704, 2706,
+    2708, 2707, 2704,
+    2709, 2708, 2706,
+    2707, 2710, 2672,
+    2668, 2672, 2710,
+    2707, 2708, 2711,
+    2707, 2712, 2710,
+    2712, 2707, 2711,
+    2713, 2668, 2710,
+    2712, 2714, 2710,
+    2713, 2710, 2714,
+    2712, 2715, 2714,
+    2713, 2716, 2668,
+    2716, 2664, 2668,
+    2715, 2712, 2717,
+    2712, 2711, 2717,
+    2715, 2717, 2718,
+    2715, 2718, 2714,
+    2719, 2717, 2711,
+    2720, 2714, 2718,
+    2720, 2713, 2714,
+    2717, 2721, 2718,
+    2717, 2719, 2721,
+    2722, 2720, 2718,
+    2722, 2718, 2721,
+    2722, 2723, 2720,
+    2723, 2722, 2721,
+    2713, 2720, 2724,
+    2723, 2724, 2720,
+    2716, 2713, 2724,
+    2723, 2721, 2725,
+    2719, 2725, 2721,
+    2723, 2726, 2724,
+    2726, 2723, 2725,
+    2716, 2724, 2727,
+    2726, 2727, 2724,
+    2728, 2716, 2727,
+    2716, 2728, 2664,
+    2728, 2660, 2664,
+    2660, 2728, 2729,
+    2660, 2729, 2652,
+    2650, 2652, 2729,
+    2728, 2730, 2729,
+    2728, 2727, 2730,
+    2731, 2650, 2729,
+    2731, 2729, 2730,
+    2650, 2731, 2732,
+    2648, 2650, 2732,
+    2733, 2731, 2730,
+    2648, 2732, 2734,
+    2636, 2648, 2734,
+    2735, 2732, 2731,
+    2733, 2735, 2731,
+    2735, 2736, 2732,
+    2736, 2734, 2732,
+    2735, 2733, 2737,
+    2736, 2735, 2738,
+    2735, 2737, 2738,
+    2736, 2739, 2734,
+    2736, 2738, 2740,
+    2739, 2736, 2740,
+    2739, 2741, 2734,
+    2636, 2734, 2741,
+    2739, 2740, 2742,
+    2743, 2636, 2741,
+    2636, 2743, 2631,
+    2739, 2744, 2741,
+    2744, 2739, 2742,
+    2743, 2741, 2745,
+    2744, 2745, 2741,
+    2746, 2631, 2743,
+    2746, 2629, 2631,
+    2747, 2743, 2745,
+    2747, 2746, 2743,
+    2747, 2745, 2748,
+    2747, 2748, 2746,
+    2745, 2749, 2748,
+    2745, 2744, 2749,
+    2748, 2750, 2746,
+    2629, 2746, 2750,
+    2748, 2751, 2750,
+    2751, 2748, 2749,
+    2752, 2629, 2750,
+    2629, 2752, 2627,
+    2752, 2750, 2753,
+    2751, 2753, 2750,
+    2754, 2627, 2752,
+    2754, 2626, 2627,
+    2755, 2752, 2753,
+    2755, 2754, 2752,
+    2626, 2754, 2756,
+    2626, 2756, 2575,
+    2754, 2755, 2757,
+    2754, 2757, 2756,
+    2758, 2575, 2756,
+    2758, 11, 2575,
+    11, 2758, 13,
+    2759, 2758, 2756,
+    2759, 2756, 2757,
+    2760, 13, 2758,
+    2759, 2760, 2758,
+    2760, 16, 13,
+    16, 2760, 2761,
+    16, 2761, 21,
+    2760, 2759, 2762,
+    2760, 2762, 2761,
+    2759, 2763, 2762,
+    2763, 2759, 2757,
+    2764, 2761, 2762,
+    2763, 2757, 2765,
+    2755, 2765, 2757,
+    2766, 2762, 2763,
+    2766, 2764, 2762,
+    2767, 2763, 2765,
+    2767, 2766, 2763,
+    2765, 2755, 2768,
+    2755, 2753, 2768,
+    2767, 2765, 2769,
+    2765, 2768, 2769,
+    2766, 2767, 2770,
+    2767, 2769, 2770,
+    2766, 2770, 2771,
+    2764, 2766, 2771,
+    2772, 2770, 2769,
+    2773, 2771, 2770,
+    2772, 2773, 2770,
+    2764, 2771, 2774,
+    2775, 2772, 2769,
+    2775, 2769, 2768,
+    2776, 2775, 2768,
+    2776, 2768, 2753,
+    2751, 2776, 2753,
+    2775, 2776, 2777,
+    2751, 2778, 2776,
+    2778, 2777, 2776,
+    2779, 2775, 2777,
+    2775, 2779, 2772,
+    2778, 2780, 2777,
+    2779, 2781, 2772,
+    2773, 2772, 2781,
+    2779, 2777, 2782,
+    2780, 2782, 2777,
+    2783, 2779, 2782,
+    2779, 2783, 2781,
+    2780, 2784, 2782,
+    2783, 2782, 2785,
+    2784, 2785, 2782,
+    2783, 2786, 2781,
+    2787, 2783, 2785,
+    2783, 2787, 2786,
+    2788, 2781, 2786,
+    2788, 2773, 2781,
+    2787, 2789, 2786,
+    2773, 2788, 2790,
+    2773, 2790, 2771,
+    2790, 2774, 2771,
+    2788, 2791, 2790,
+    2790, 2792, 2774,
+    2792, 2790, 2791,
+    2792, 70, 2774,
+    2793, 2774, 70,
+    2793, 2764, 2774,
+    2764, 2793, 2761,
+    2793, 21, 2761,
+    2793, 67, 21,
+    67, 2793, 70,
+    2792, 72, 70,
+    2792, 2794, 72,
+    2794, 2792, 2791,
+    2794, 2795, 72,
+    69, 72, 2795,
+    2794, 2796, 2795,
+    2797, 69, 2795,
+    69, 2797, 71,
+    2797, 75, 71,
+    2797, 2795, 2798,
+    2796, 2798, 2795,
+    2797, 2799, 75,
+    2799, 2797, 2798,
+    2799, 79, 75,
+    2799, 84, 79,
+    2799, 2798, 2800,
+    84, 2799, 2800,
+    2796, 2801, 2798,
+    2801, 2800, 2798,
+    2796, 2794, 2801,
+    2794, 2791, 2801,
+    2802, 2801, 2791,
+    2801, 2802, 2800,
+    2788, 2802, 2791,
+    2802, 2788, 2786,
+    2802, 2786, 2789,
+    2802, 2803, 2800,
+    84, 2800, 2803,
+    2804, 2802, 2789,
+    2802, 2804, 2803,
+    2805, 84, 2803,
+    84, 2805, 82,
+    2805, 95, 82,
+    2805, 2803, 2806,
+    2804, 2806, 2803,
+    2805, 2807, 95,
+    2807, 2805, 2806,
+    2807, 236, 95,
+    2807, 2808, 236,
+    2808, 238, 236,
+    2807, 2806, 2809,
+    2808, 2807, 2809,
+    238, 2808, 2810,
+    238, 2810, 240,
+    2808, 2809, 2811,
+    2808, 2811, 2810,
+    2812, 2809, 2806,
+    2804, 2812, 2806,
+    2809, 2813, 2811,
+    2809, 2812, 2813,
+    2812, 2804, 2814,
+    2804, 2789, 2814,
+    2812, 2815, 2813,
+    2812, 2814, 2815,
+    2816, 2814, 2789,
+    2787, 2816, 2789,
+    2814, 2817, 2815,
+    2814, 2816, 2817,
+    2816, 2787, 2818,
+    2787, 2785, 2818,
+    2816, 2819, 2817,
+    2816, 2818, 2819,
+    2820, 2818, 2785,
+    2784, 2820, 2785,
+    2818, 2821, 2819,
+    2818, 2820, 2821,
+    2820, 2784, 2822,
+    2820, 2823, 2821,
+    2820, 2822, 2823,
+    2784, 2824, 2822,
+    2784, 2780, 2824,
+    2822, 2825, 2823,
+    2780, 2826, 2824,
+    2780, 2778, 2826,
+    2827, 2822, 2824,
+    2822, 2827, 2825,
+    2828, 2827, 2824,
+    2828, 2824, 2826,
+    2827, 2829, 2825,
+    2827, 2828, 2830,
+    2827, 2830, 2829,
+    2831, 2828, 2826,
+    2828, 2832, 2830,
+    2828, 2831, 2832,
+    2831, 2826, 2833,
+    2778, 2833, 2826,
+    2778, 2751, 2833,
+    2751, 2834, 2833,
+    2834, 2751, 2749,
+    2835, 2831, 2833,
+    2835, 2833, 2834,
+    2831, 2835, 2836,
+    2831, 2836, 2832,
+    2837, 2835, 2834,
+    2834, 2749, 2838,
+    2837, 2834, 2838,
+    2744, 2838, 2749,
+    2744, 2742, 2838,
+    2742, 2839, 2838,
+    2837, 2838, 2839,
+    2742, 2840, 2839,
+    2840, 2742, 2740,
+    2841, 2837, 2839,
+    2842, 2840, 2740,
+    2842, 2740, 2738,
+    2840, 2843, 2839,
+    2841, 2839, 2843,
+    2840, 2842, 2844,
+    2840, 2845, 2843,
+    2845, 2840, 2844,
+    2846, 2841, 2843,
+    2845, 2847, 2843,
+    2846, 2843, 2847,
+    2846, 2848, 2841,
+    2849, 2846, 2847,
+    2846, 2849, 2848,
+    2848, 2850, 2841,
+    2837, 2841, 2850,
+    2835, 2837, 2850,
+    2835, 2850, 2836,
+    2848, 2851, 2850,
+    2851, 2836, 2850,
+    2851, 2848, 2852,
+    2849, 2852, 2848,
+    2851, 2853, 2836,
+    2853, 2832, 2836,
+    2854, 2851, 2852,
+    2853, 2855, 2832,
+    2855, 2830, 2832,
+    2853, 2851, 2856,
+    2851, 2854, 2856,
+    2855, 2853, 2857,
+    2853, 2856, 2857,
+    2830, 2855, 2858,
+    2830, 2858, 2829,
+    2855, 2859, 2858,
+    2855, 2857, 2859,
+    2860, 2829, 2858,
+    2861, 2858, 2859,
+    2861, 2860, 2858,
+    2860, 2862, 2829,
+    2862, 2825, 2829,
+    2860, 2861, 2863,
+    2862, 2864, 2825,
+    2864, 2823, 2825,
+    2862, 2860, 2865,
+    2860, 2863, 2865,
+    2864, 2862, 2866,
+    2862, 2865, 2866,
+    2864, 2867, 2823,
+    2867, 2821, 2823,
+    2867, 2864, 2868,
+    2864, 2866, 2868,
+    2867, 2869, 2821,
+    2869, 2819, 2821,
+    2869, 2867, 2870,
+    2867, 2868, 2870,
+    2869, 2871, 2819,
+    2871, 2817, 2819,
+    2871, 2869, 2872,
+    2869, 2870, 2872,
+    2871, 2873, 2817,
+    2873, 2815, 2817,
+    2873, 2871, 2874,
+    2871, 2872, 2874,
+    2873, 2875, 2815,
+    2875, 2813, 2815,
+    2875, 2873, 2876,
+    2873, 2874, 2876,
+    2875, 2877, 2813,
+    2877, 2811, 2813,
+    2877, 2875, 2878,
+    2875, 2876, 2878,
+    2877, 2879, 2811,
+    2879, 2810, 2811,
+    2879, 2877, 2880,
+    2877, 2878, 2880,
+    2879, 2881, 2810,
+    2881, 240, 2810,
+    2881, 246, 240,
+    2881, 2879, 2882,
+    2879, 2880, 2882,
+    246, 2881, 2883,
+    2881, 2882, 2883,
+    246, 2883, 2884,
+    244, 246, 2884,
+    2885, 2883, 2882,
+    2886, 2884, 2883,
+    2885, 2886, 2883,
+    244, 2884, 2887,
+    2888, 2885, 2882,
+    2888, 2882, 2880,
+    2889, 2888, 2880,
+    2889, 2880, 2878,
+    2885, 2888, 2890,
+    2891, 2889, 2878,
+    2891, 2878, 2876,
+    2888, 2889, 2892,
+    2888, 2892, 2890,
+    2889, 2891, 2893,
+    2889, 2893, 2892,
+    2894, 2891, 2876,
+    2894, 2876, 2874,
+    2891, 2895, 2893,
+    2891, 2894, 2895,
+    2896, 2894, 2874,
+    2896, 2874, 2872,
+    2894, 2897, 2895,
+    2894, 2896, 2897,
+    2898, 2896, 2872,
+    2898, 2872, 2870,
+    2896, 2899, 2897,
+    2896, 2898, 2899,
+    2900, 2898, 2870,
+    2900, 2870, 2868,
+    2898, 2901, 2899,
+    2898, 2900, 2901,
+    2902, 2900, 2868,
+    2902, 2868, 2866,
+    2900, 2903, 2901,
+    2900, 2902, 2903,
+    2904, 2902, 2866,
+    2904, 2866, 2865,
+    2902, 2905, 2903,
+    2902, 2904, 2905,
+    2906, 2904, 2865,
+    2906, 2865, 2863,
+    2904, 2907, 2905,
+    2904, 2906, 2907,
+    2908, 2905, 2907,
+    2906, 2909, 2907,
+    2908, 2910, 2905,
+    2910, 2903, 2905,
+    2911, 2908, 2907,
+    2911, 2907, 2909,
+    2910, 2912, 2903,
+    2912, 2901, 2903,
+    2912, 2913, 2901,
+    2913, 2899, 2901,
+    2912, 2910, 2914,
+    2913, 2915, 2899,
+    2915, 2897, 2899,
+    2913, 2912, 2916,
+    2912, 2914, 2916,
+    2915, 2913, 2917,
+    2913, 2916, 2917,
+    2915, 2918, 2897,
+    2918, 2895, 2897,
+    2918, 2915, 2919,
+    2915, 2917, 2919,
+    2918, 2920, 2895,
+    2920, 2893, 2895,
+    2920, 2918, 2921,
+    2918, 2919, 2921,
+    2920, 2922, 2893,
+    2922, 2892, 2893,
+    2922, 2920, 2923,
+    2920, 2921, 2923,
+    2922, 2924, 2892,
+    2924, 2890, 2892,
+    2924, 2922, 2925,
+    2922, 2923, 2925,
+    2924, 2926, 2890,
+    2927, 2925, 2923,
+    2928, 2927, 2923,
+    2928, 2923, 2921,
+    2927, 2929, 2925,
+    2930, 2928, 2921,
+    2930, 2921, 2919,
+    2931, 2930, 2919,
+    2931, 2919, 2917,
+    2932, 2931, 2917,
+    2932, 2917, 2916,
+    2933, 2932, 2916,
+    2933, 2916, 2914,
+    2934, 2933, 2914,
+    2934, 2914, 2935,
+    2910, 2935, 2914,
+    2936, 2934, 2935,
+    2910, 2908, 2935,
+    2936, 2935, 2937,
+    2908, 2937, 2935,
+    2938, 2936, 2937,
+    2908, 2911, 2937,
+    2938, 2937, 2939,
+    2911, 2939, 2937,
+    2940, 2938, 2939,
+    2911, 2941, 2939,
+    2940, 2939, 2942,
+    2941, 2942, 2939,
+    2943, 2940, 2942,
+    2941, 2911, 2909,
+    2943, 2942, 2944,
+    2945, 2943, 2944,
+    2941, 2946, 2942,
+    2946, 2944, 2942,
+    2945, 2944, 2947,
+    2948, 2945, 2947,
+    2946, 2949, 2944,
+    2949, 2947, 2944,
+    2948, 2947, 2950,
+    2951, 2948, 2950,
+    2949, 2952, 2947,
+    2952, 2950, 2947,
+    2951, 2950, 2953,
+    2954, 2951, 2953,
+    2952, 2955, 2950,
+    2955, 2953, 2950,
+    2954, 2953, 2956,
+    2957, 2954, 2956,
+    2955, 2958, 2953,
+    2958, 2956, 2953,
+    2957, 2956, 2959,
+    2960, 2957, 2959,
+    2958, 2961, 2956,
+    2961, 2959, 2956,
+    2960, 2959, 2962,
+    2963, 2960, 2962,
+    2961, 2964, 2959,
+    2964, 2962, 2959,
+    2963, 2962, 2965,
+    2966, 2963, 2965,
+    2964, 2967, 2962,
+    2967, 2965, 2962,
+    2966, 2965, 2968,
+    2969, 2966, 2968,
+    2967, 2970, 2965,
+    2970, 2968, 2965,
+    2969, 2968, 2971,
+    2972, 2969, 2971,
+    2970, 2973, 2968,
+    2973, 2971, 2968,
+    2972, 2971, 2974,
+    2975, 2972, 2974,
+    2973, 2976, 2971,
+    2976, 2974, 2971,
+    2975, 2974, 2977,
+    2978, 2975, 2977,
+    2976, 2979, 2974,
+    2979, 2977, 2974,
+    2978, 2977, 2980,
+    2981, 2978, 2980,
+    2979, 2982, 2977,
+    2982, 2980, 2977,
+    2981, 2980, 2983,
+    2984, 2981, 2983,
+    2982, 2985, 2980,
+    2985, 2983, 2980,
+    2984, 2983, 2986,
+    2987, 2984, 2986,
+    2985, 2988, 2983,
+    2988, 2986, 2983,
+    2987, 2986, 2989,
+    2990, 2987, 2989,
+    2988, 2991, 2986,
+    2991, 2989, 2986,
+    2990, 2989, 2992,
+    2929, 2990, 2992,
+    2929, 2992, 2925,
+    2924, 2925, 2992,
+    2926, 2924, 2992,
+    2926, 2992, 2989,
+    2991, 2926, 2989,
+    2926, 2991, 2993,
+    2926, 2993, 2890,
+    2885, 2890, 2993,
+    2886, 2885, 2993,
+    2991, 2994, 2993,
+    2886, 2993, 2994,
+    2991, 2988, 2994,
+    2995, 2886, 2994,
+    2886, 2995, 2884,
+    2988, 2996, 2994,
+    2995, 2994, 2996,
+    2988, 2985, 2996,
+    2995, 2887, 2884,
+    2985, 2997, 2996,
+    2985, 2982, 2997,
+    2998, 2995, 2996,
+    2998, 2996, 2997,
+    2995, 2998, 2887,
+    2982, 2999, 2997,
+    2982, 2979, 2999,
+    3000, 2998, 2997,
+    3000, 2997, 2999,
+    2998, 3000, 3001,
+    2998, 3001, 2887,
+    3002, 3000, 2999,
+    3003, 2887, 3001,
+    3003, 244, 2887,
+    244, 3003, 243,
+    3000, 3004, 3001,
+    3000, 3002, 3004,
+    3005, 3003, 3001,
+    3005, 3001, 3004,
+    3003, 3006, 243,
+    3003, 3005, 3006,
+    242, 243, 3006,
+    3007, 242, 3006,
+    242, 3007, 245,
+    265, 245, 3007,
+    3007, 3006, 3008,
+    3005, 3008, 3006,
+    3009, 265, 3007,
+    3009, 3007, 3008,
+    265, 3009, 267,
+    3005, 3010, 3008,
+    3010, 3005, 3004,
+    3009, 3008, 3011,
+    3010, 3011, 3008,
+    3012, 3009, 3011,
+    3009, 3012, 267,
+    3010, 3013, 3011,
+    3014, 267, 3012,
+    3014, 268, 267,
+    3012, 3011, 3015,
+    3013, 3015, 3011,
+    3016, 3014, 3012,
+    3016, 3012, 3015,
+    268, 3014, 3017,
+    268, 3017, 270,
+    3014, 3016, 3018,
+    3014, 3018, 3017,
+    3016, 3019, 3018,
+    3020, 3017, 3018,
+    3019, 3016, 3021,
+    3016, 3015, 3021,
+    3022, 3018, 3019,
+    3022, 3020, 3018,
+    3023, 3022, 3019,
+    3020, 3022, 3024,
+    3023, 3019, 3025,
+    3019, 3021, 3025,
+    3022, 3023, 3026,
+    3022, 3026, 3024,
+    3023, 3027, 3026,
+    3027, 3023, 3028,
+    3023, 3025, 3028,
+    3029, 3026, 3027,
+    3030, 3028, 3025,
+    3029, 3031, 3026,
+    3031, 3024, 3026,
+    3032, 3030, 3025,
+    3032, 3025, 3021,
+    3033, 3032, 3021,
+    3033, 3021, 3015,
+    3013, 3033, 3015,
+    3032, 3033, 3034,
+    3033, 3013, 3035,
+    3033, 3035, 3034,
+    3013, 3036, 3035,
+    3013, 3010, 3036,
+    3010, 3004, 3036,
+    3002, 3036, 3004,
+    3037, 3035, 3036,
+    3002, 3037, 3036,
+    3037, 3038, 3035,
+    3038, 3034, 3035,
+    3037, 3002, 3039,
+    3002, 2999, 3039,
+    2979, 3039, 2999,
+    2979, 2976, 3039,
+    3037, 3039, 3040,
+    2976, 3040, 3039,
+    3038, 3037, 3040,
+    2976, 2973, 3040,
+    2973, 3041, 3040,
+    3038, 3040, 3041,
+    2973, 2970, 3041,
+    3042, 3038, 3041,
+    3038, 3042, 3034,
+    2970, 3043, 3041,
+    3042, 3041, 3043,
+    2970, 2967, 3043,
+    3042, 3044, 3034,
+    3032, 3034, 3044,
+    3030, 3032, 3044,
+    3042, 3045, 3044,
+    3045, 3042, 3043,
+    3030, 3044, 3046,
+    3045, 3046, 3044,
+    3047, 3030, 3046,
+    3030, 3047, 3028,
+    3045, 3048, 3046,
+    3047, 3049, 3028,
+    3027, 3028, 3049,
+    3047, 3046, 3050,
+    3048, 3050, 3046,
+    3051, 3047, 3050,
+    3047, 3051, 3049,
+    3048, 3052, 3050,
+    3051, 3050, 3053,
+    3052, 3053, 3050,
+    3051, 3054, 3049,
+    3055, 3051, 3053,
+    3051, 3055, 3054,
+    3056, 3049, 3054,
+    3056, 3027, 3049,
+    3056, 3029, 3027,
+    3057, 3056, 3054,
+    3029, 3056, 3058,
+    3056, 3057, 3058,
+    3029, 3058, 3059,
+    3031, 3029, 3059,
+    3060, 3059, 3058,
+    3031, 3059, 3061,
+    3062, 3060, 3058,
+    3062, 3058, 3057,
+    3060, 3063, 3059,
+    3063, 3061, 3059,
+    3060, 3062, 3064,
+    3060, 3064, 3063,
+    3062, 3065, 3064,
+    3064, 3066, 3063,
+    3062, 3067, 3065,
+    3067, 3062, 3057,
+    3068, 3064, 3065,
+    3064, 3068, 3066,
+    3067, 3069, 3065,
+    3070, 3068, 3065,
+    3070, 3065, 3069,
+    3068, 3070, 2854,
+    3070, 2856, 2854,
+    3068, 2854, 3071,
+    3068, 3071, 3066,
+    2854, 2852, 3071,
+    3070, 3072, 2856,
+    3072, 3070, 3069,
+    3072, 2857, 2856,
+    2857, 3072, 3073,
+    2857, 3073, 2859,
+    3072, 3069, 3074,
+    3072, 3074, 3073,
+    3069, 3075, 3074,
+    3069, 3067, 3075,
+    3076, 3073, 3074,
+    3067, 3077, 3075,
+    3067, 3057, 3077,
+    3057, 3054, 3077,
+    3055, 3077, 3054,
+    3078, 3075, 3077,
+    3055, 3078, 3077,
+    3079, 3074, 3075,
+    3078, 3079, 3075,
+    3079, 3076, 3074,
+    3078, 3055, 3080,
+    3055, 3053, 3080,
+    3079, 3078, 3081,
+    3078, 3080, 3081,
+    3079, 3081, 3082,
+    3076, 3079, 3082,
+    3083, 3081, 3080,
+    3084, 3080, 3053,
+    3084, 3083, 3080,
+    3052, 3084, 3053,
+    3083, 3085, 3081,
+    3085, 3082, 3081,
+    3083, 3084, 3086,
+    3085, 3083, 3087,
+    3083, 3086, 3087,
+    3085, 3088, 3082,
+    2955, 3087, 3086,
+    2958, 2955, 3086,
+    2955, 2952, 3087,
+    2958, 3086, 3089,
+    3084, 3089, 3086,
+    2961, 2958, 3089,
+    3084, 3052, 3089,
+    2961, 3089, 3090,
+    3052, 3090, 3089,
+    2964, 2961, 3090,
+    3052, 3048, 3090,
+    2964, 3090, 3091,
+    3048, 3091, 3090,
+    2967, 2964, 3091,
+    3048, 3045, 3091,
+    2967, 3091, 3043,
+    3045, 3043, 3091,
+    2952, 3092, 3087,
+    3085, 3087, 3092,
+    2952, 2949, 3092,
+    3088, 3085, 3092,
+    2949, 3093, 3092,
+    3088, 3092, 3093,
+    2949, 2946, 3093,
+    2946, 3094, 3093,
+    2946, 2941, 3094,
+    2941, 2909, 3094,
+    3095, 3093, 3094,
+    3095, 3088, 3093,
+    3096, 3094, 2909,
+    3096, 3095, 3094,
+    2906, 3096, 2909,
+    3096, 2906, 2863,
+    3096, 2863, 3097,
+    3095, 3096, 3097,
+    2861, 3097, 2863,
+    3095, 3097, 3098,
+    3088, 3095, 3098,
+    3088, 3098, 3082,
+    3076, 3082, 3098,
+    3099, 3098, 3097,
+    3099, 3076, 3098,
+    2861, 3099, 3097,
+    3076, 3099, 3073,
+    3099, 2861, 2859,
+    3099, 2859, 3073,
+    3100, 3101, 3102,
+    3101, 3100, 3103,
+    3100, 3102, 3104,
+    3101, 3103, 3105,
+    3100, 3106, 3103,
+    3107, 3101, 3105,
+    3100, 3108, 3106,
+    3108, 3100, 3104,
+    3101, 3107, 3109,
+    3101, 3109, 3102,
+    3110, 3102, 3109,
+    3110, 3111, 3102,
+    3111, 3104, 3102,
+    3112, 3110, 3109,
+    3111, 3113, 3104,
+    3112, 3109, 3114,
+    3115, 3112, 3114,
+    3107, 3114, 3109,
+    3115, 3114, 3116,
+    3114, 3117, 3116,
+    3114, 3107, 3117,
+    3118, 3116, 3117,
+    3107, 3119, 3117,
+    3107, 3105, 3119,
+    3120, 3118, 3117,
+    3120, 3117, 3119,
+    3105, 3121, 3119,
+    3122, 3120, 3119,
+    3122, 3119, 3121,
+    3105, 3123, 3121,
+    3123, 3105, 3103,
+    2559, 3122, 3121,
+    2559, 3121, 2561,
+    3123, 2561, 3121,
+    3122, 2559, 2557,
+    3123, 2598, 2561,
+    3122, 2557, 3124,
+    3120, 3122, 3124,
+    3123, 3125, 2598,
+    3125, 3123, 3103,
+    3125, 2599, 2598,
+    3125, 3103, 3106,
+    3125, 3126, 2599,
+    3126, 3125, 3106,
+    3126, 2601, 2599,
+    3126, 3106, 3127,
+    3126, 3128, 2601,
+    3128, 3126, 3127,
+    3128, 2603, 2601,
+    3108, 3127, 3106,
+    3128, 3129, 2603,
+    3108, 3130, 3127,
+    3128, 3127, 3131,
+    3130, 3131, 3127,
+    3129, 3128, 3131,
+    3130, 3108, 3132,
+    3108, 3104, 3132,
+    3113, 3132, 3104,
+    3130, 3132, 3133,
+    3130, 3133, 3131,
+    3132, 3113, 3134,
+    3132, 3134, 3133,
+    3113, 3135, 3134,
+    3133, 3136, 3131,
+    3129, 3131, 3136,
+    3137, 3133, 3134,
+    3133, 3137, 3136,
+    3138, 3134, 3135,
+    3138, 3137, 3134,
+    3139, 3138, 3135,
+    3139, 3140, 3138,
+    3140, 3141, 3138,
+    3137, 3138, 3141,
+    3140, 3142, 3141,
+    3142, 3143, 3141,
+    3142, 3144, 3143,
+    3145, 3137, 3141,
+    3145, 3141, 3143,
+    3144, 3146, 3143,
+    3144, 3147, 3146,
+    3148, 3145, 3143,
+    3148, 3143, 3146,
+    3147, 3149, 3146,
+    3147, 3150, 3149,
+    3151, 3148, 3146,
+    3151, 3146, 3149,
+    3148, 3151, 3152,
+    3148, 3152, 3145,
+    3153, 3151, 3149,
+    3152, 3154, 3145,
+    3137, 3145, 3154,
+    3151, 3155, 3152,
+    3151, 3153, 3155,
+    3156, 3152, 3155,
+    3152, 3156, 3154,
+    3157, 3137, 3154,
+    3137, 3157, 3136,
+    3157, 3154, 3158,
+    3156, 3158, 3154,
+    3159, 3136, 3157,
+    3159, 3129, 3136,
+    3160, 3157, 3158,
+    3160, 3159, 3157,
+    3129, 3159, 3161,
+    3129, 3161, 2603,
+    2605, 2603, 3161,
+    3159, 3162, 3161,
+    3159, 3160, 3162,
+    3163, 2605, 3161,
+    2605, 3163, 2606,
+    3161, 3162, 3164,
+    3163, 3161, 3164,
+    3160, 3164, 3162,
+    3163, 3165, 2606,
+    3163, 3164, 3165,
+    2608, 2606, 3165,
+    3164, 3160, 3166,
+    3164, 3166, 3165,
+    3167, 2608, 3165,
+    3167, 3165, 3166,
+    2608, 3167, 2610,
+    3160, 3168, 3166,
+    3160, 3158, 3168,
+    3169, 3167, 3166,
+    3169, 3166, 3168,
+    3167, 3170, 2610,
+    3167, 3169, 3170,
+    2612, 2610, 3170,
+    3169, 3171, 3170,
+    3172, 2612, 3170,
+    3172, 3170, 3171,
+    2612, 3172, 3173,
+    2612, 3173, 2614,
+    2617, 2614, 3173,
+    3174, 2617, 3173,
+    2617, 3174, 2634,
+    3172, 3175, 3173,
+    3174, 3173, 3175,
+    3172, 3176, 3175,
+    3176, 3172, 3171,
+    3177, 3174, 3175,
+    3176, 3178, 3175,
+    3177, 3175, 3178,
+    3174, 3177, 3179,
+    3174, 3179, 2634,
+    2634, 3179, 3180,
+    3177, 3180, 3179,
+    2635, 2634, 3180,
+    2635, 3180, 3181,
+    2635, 3181, 2639,
+    3180, 3182, 3181,
+    3183, 3182, 3180,
+    3177, 3183, 3180,
+    3184, 3181, 3182,
+    3183, 3184, 3182,
+    3177, 3185, 3183,
+    3185, 3177, 3178,
+    3184, 3183, 3186,
+    3185, 3186, 3183,
+    3184, 3187, 3181,
+    3187, 2639, 3181,
+    3188, 3184, 3186,
+    3184, 3188, 3187,
+    3187, 3189, 2639,
+    3189, 2641, 2639,
+    3189, 2653, 2641,
+    3189, 2686, 2653,
+    3189, 3187, 3190,
+    2686, 3189, 3190,
+    3188, 3190, 3187,
+    2686, 3190, 2687,
+    3191, 2687, 3190,
+    3188, 3191, 3190,
+    3191, 2689, 2687,
+    3191, 3188, 3192,
+    3188, 3186, 3192,
+    3191, 3193, 2689,
+    3194, 3192, 3186,
+    3185, 3194, 3186,
+    3191, 3192, 3195,
+    3193, 3191, 3195,
+    3194, 3196, 3192,
+    3196, 3195, 3192,
+    3194, 3185, 3197,
+    3185, 3178, 3197,
+    3196, 3194, 3198,
+    3194, 3197, 3198,
+    3199, 3197, 3178,
+    3176, 3199, 3178,
+    3200, 3198, 3197,
+    3199, 3200, 3197,
+    3199, 3176, 3201,
+    3176, 3171, 3201,
+    3200, 3199, 3202,
+    3199, 3201, 3202,
+    3203, 3201, 3171,
+    3169, 3203, 3171,
+    3203, 3169, 3168,
+    3203, 3204, 3201,
+    3204, 3202, 3201,
+    3203, 3168, 3205,
+    3204, 3203, 3205,
+    3158, 3205, 3168,
+    3158, 3156, 3205,
+    3204, 3205, 3206,
+    3156, 3206, 3205,
+    3207, 3204, 3206,
+    3204, 3207, 3202,
+    3156, 3208, 3206,
+    3208, 3156, 3155,
+    3207, 3206, 3209,
+    3208, 3209, 3206,
+    3207, 3210, 3202,
+    3200, 3202, 3210,
+    3211, 3207, 3209,
+    3207, 3211, 3210,
+    3212, 3200, 3210,
+    3200, 3212, 3198,
+    3211, 3213, 3210,
+    3212, 3210, 3213,
+    3212, 3214, 3198,
+    3196, 3198, 3214,
+    3215, 3212, 3213,
+    3212, 3215, 3214,
+    3216, 3196, 3214,
+    3196, 3216, 3195,
+    3215, 3217, 3214,
+    3216, 3214, 3217,
+    3216, 3218, 3195,
+    3193, 3195, 3218,
+    3219, 3216, 3217,
+    3218, 3216, 3220,
+    3216, 3219, 3220,
+    3221, 3193, 3218,
+    3193, 3221, 3222,
+    3193, 3222, 2689,
+    2689, 3222, 2691,
+    3221, 2691, 3222,
+    2691, 3221, 2693,
+    3221, 3218, 3223,
+    3221, 3223, 2693,
+    3218, 3220, 3223,
+    3224, 2693, 3223,
+    3224, 2694, 2693,
+    3225, 3223, 3220,
+    3225, 3224, 3223,
+    3226, 3225, 3220,
+    3226, 3220, 3219,
+    3225, 3227, 3224,
+    3225, 3226, 3227,
+    3227, 3228, 3224,
+    2694, 3224, 3228,
+    3226, 3229, 3227,
+    3230, 2694, 3228,
+    2694, 3230, 2696,
+    3227, 3231, 3228,
+    3231, 3227, 3229,
+    3231, 3232, 3228,
+    3230, 3228, 3232,
+    3233, 3231, 3229,
+    3231, 3233, 3232,
+    3234, 3230, 3232,
+    3233, 3235, 3232,
+    3234, 3232, 3235,
+    3234, 3236, 3230,
+    3236, 2696, 3230,
+    3236, 2698, 2696,
+    3234, 3237, 3236,
+    3237, 3234, 3235,
+    2698, 3236, 3238,
+    3237, 3238, 3236,
+    3239, 2698, 3238,
+    2698, 3239, 2699,
+    3237, 3240, 3238,
+    3239, 3241, 2699,
+    2701, 2699, 3241,
+    3239, 3238, 3242,
+    3240, 3242, 3238,
+    3243, 3239, 3242,
+    3239, 3243, 3241,
+    3242, 3240, 3244,
+    3243, 3242, 3245,
+    3242, 3244, 3245,
+    3243, 3246, 3241,
+    3247, 2701, 3241,
+    3247, 3241, 3246,
+    2701, 3247, 2703,
+    3246, 3243, 3248,
+    3243, 3245, 3248,
+    3249, 3247, 3246,
+    3246, 3248, 3250,
+    3249, 3246, 3250,
+    3247, 3249, 3251,
+    3247, 3251, 2703,
+    3249, 3250, 3252,
+    3249, 3253, 3251,
+    3253, 3249, 3252,
+    3254, 2703, 3251,
+    2703, 3254, 2705,
+    3255, 3251, 3253,
+    3255, 3254, 3251,
+    3254, 3256, 2705,
+    2706, 2705, 3256,
+    2709, 2706, 3256,
+    3254, 3257, 3256,
+    2709, 3256, 3258,
+    3257, 3258, 3256,
+    3259, 2709, 3258,
+    2709, 3259, 2708,
+    3259, 2711, 2708,
+    3259, 2719, 2711,
+    2719, 3259, 3260,
+    3259, 3258, 3260,
+    2719, 3260, 2725,
+    3261, 3260, 3258,
+    3257, 3261, 3258,
+    3260, 3262, 2725,
+    3260, 3261, 3262,
+    2726, 2725, 3262,
+    3261, 3257, 3263,
+    3261, 3263, 3262,
+    3264, 2726, 3262,
+    3264, 3262, 3263,
+    2726, 3264, 3265,
+    2727, 2726, 3265,
+    2727, 3265, 2730,
+    2733, 2730, 3265,
+    3266, 2733, 3265,
+    3266, 3265, 3264,
+    2733, 3266, 2737,
+    3267, 3266, 3264,
+    3267, 3264, 3263,
+    3268, 2737, 3266,
+    3267, 3268, 3266,
+    3267, 3263, 3269,
+    3257, 3269, 3263,
+    3257, 3254, 3269,
+    3254, 3255, 3269,
+    3270, 3267, 3269,
+    3270, 3269, 3255,
+    3267, 3270, 3268,
+    3271, 3270, 3255,
+    3271, 3255, 3253,
+    3270, 3272, 3268,
+    3270, 3271, 3272,
+    3271, 3253, 3273,
+    3253, 3252, 3273,
+    3271, 3274, 3272,
+    3271, 3273, 3274,
+    3275, 3268, 3272,
+    3268, 3275, 2737,
+    3275, 2738, 2737,
+    3275, 2842, 2738,
+    3276, 3275, 3272,
+    3276, 3272, 3274,
+    3275, 3277, 2842,
+    3277, 2844, 2842,
+    3275, 3276, 3278,
+    3277, 3275, 3278,
+    3277, 3279, 2844,
+    3277, 3278, 3280,
+    3279, 3277, 3280,
+    3279, 3281, 2844,
+    2845, 2844, 3281,
+    3279, 3280, 3282,
+    3279, 3282, 3281,
+    3283, 2845, 3281,
+    2845, 3283, 2847,
+    3282, 3284, 3281,
+    3283, 3281, 3284,
+    3283, 3285, 2847,
+    2849, 2847, 3285,
+    3286, 3283, 3284,
+    3283, 3286, 3285,
+    3287, 2849, 3285,
+    2849, 3287, 2852,
+    3287, 3071, 2852,
+    3287, 3285, 3288,
+    3286, 3288, 3285,
+    3287, 3289, 3071,
+    3289, 3066, 3071,
+    3290, 3287, 3288,
+    3287, 3290, 3289,
+    3289, 3291, 3066,
+    3291, 3063, 3066,
+    3063, 3291, 3061,
+    3290, 3292, 3289,
+    3291, 3289, 3292,
+    3290, 3293, 3292,
+    3294, 3291, 3292,
+    3293, 3290, 3295,
+    3290, 3288, 3295,
+    3293, 3296, 3292,
+    3294, 3292, 3296,
+    3293, 3297, 3296,
+    3298, 3294, 3296,
+    3297, 3293, 3299,
+    3293, 3295, 3299,
+    3297, 3300, 3296,
+    3298, 3296, 3300,
+    3297, 3301, 3300,
+    3301, 3302, 3300,
+    3303, 3300, 3302,
+    3303, 3298, 3300,
+    3304, 3303, 3302,
+    3303, 3304, 3305,
+    3304, 3306, 3305,
+    3298, 3303, 3307,
+    3303, 3305, 3307,
+    3308, 3305, 3306,
+    3309, 3308, 3306,
+    3309, 3310, 3308,
+    3308, 3311, 3305,
+    3311, 3307, 3305,
+    3310, 3312, 3308,
+    3311, 3308, 3312,
+    3310, 3313, 3312,
+    3311, 3314, 3307,
+    3315, 3311, 3312,
+    3311, 3315, 3314,
+    3313, 3316, 3312,
+    3315, 3312, 3316,
+    3316, 3313, 3317,
+    3313, 3318, 3317,
+    3319, 3315, 3316,
+    3320, 3317, 3318,
+    3321, 3320, 3318,
+    3321, 3322, 3320,
+    3322, 3323, 3320,
+    3322, 3324, 3323,
+    3320, 3325, 3317,
+    3325, 3320, 3323,
+    3325, 3326, 3317,
+    3316, 3317, 3326,
+    3319, 3316, 3326,
+    3325, 3327, 3326,
+    3319, 3326, 3328,
+    3327, 3328, 3326,
+    3325, 3329, 3327,
+    3329, 3325, 3323,
+    3327, 3330, 3328,
+    3329, 3323, 3331,
+    3324, 3331, 3323,
+    3324, 3332, 3331,
+    3329, 3333, 3327,
+    3330, 3327, 3333,
+    3334, 3329, 3331,
+    3329, 3334, 3333,
+    3332, 3335, 3331,
+    3334, 3331, 3335,
+    3332, 3336, 3335,
+    3337, 3334, 3335,
+    3336, 3338, 3335,
+    3337, 3335, 3338,
+    3338, 3336, 3339,
+    3336, 3340, 3339,
+    3341, 3337, 3338,
+    3342, 3339, 3340,
+    3343, 3342, 3340,
+    3343, 3344, 3342,
+    3344, 3345, 3342,
+    3344, 3346, 3345,
+    3342, 3347, 3339,
+    3347, 3342, 3345,
+    3338, 3339, 3348,
+    3347, 3348, 3339,
+    3341, 3338, 3348,
+    3341, 3348, 3349,
+    3348, 3347, 3350,
+    3348, 3350, 3349,
+    3341, 3349, 3351,
+    3337, 3341, 3351,
+    3352, 3349, 3350,
+    3337, 3351, 3353,
+    3334, 3337, 3353,
+    3334, 3353, 3333,
+    3354, 3351, 3349,
+    3352, 3354, 3349,
+    3355, 3353, 3351,
+    3354, 3355, 3351,
+    3356, 3333, 3353,
+    3355, 3356, 3353,
+    3356, 3330, 3333,
+    3355, 3354, 3357,
+    3356, 3355, 3358,
+    3355, 3357, 3358,
+    3330, 3356, 3359,
+    3356, 3358, 3359,
+    3330, 3359, 3360,
+    3330, 3360, 3328,
+    3361, 3359, 3358,
+    3362, 3328, 3360,
+    3362, 3319, 3328,
+    3359, 3363, 3360,
+    3359, 3361, 3363,
+    3364, 3362, 3360,
+    3364, 3360, 3363,
+    3319, 3362, 3365,
+    3315, 3319, 3365,
+    3315, 3365, 3314,
+    3364, 3366, 3362,
+    3366, 3365, 3362,
+    3364, 3367, 3366,
+    3367, 3364, 3363,
+    3366, 3368, 3365,
+    3368, 3314, 3365,
+    3367, 3369, 3366,
+    3368, 3366, 3369,
+    3367, 3363, 3370,
+    3361, 3370, 3363,
+    3371, 3367, 3370,
+    3367, 3371, 3369,
+    3361, 3372, 3370,
+    3371, 3370, 3373,
+    3372, 3373, 3370,
+    3361, 3374, 3372,
+    3374, 3361, 3358,
+    3374, 3358, 3357,
+    3374, 3375, 3372,
+    3376, 3374, 3357,
+    3374, 3376, 3375,
+    3376, 3357, 3377,
+    3354, 3377, 3357,
+    3354, 3352, 3377,
+    3378, 3376, 3377,
+    3352, 3379, 3377,
+    3378, 3377, 3379,
+    3352, 3380, 3379,
+    3380, 3352, 3350,
+    3381, 3378, 3379,
+    3380, 3350, 3382,
+    3347, 3382, 3350,
+    3380, 3383, 3379,
+    3381, 3379, 3383,
+    3384, 3380, 3382,
+    3380, 3384, 3383,
+    3384, 3382, 3385,
+    3384, 3386, 3383,
+    3384, 3385, 3386,
+    3387, 3383, 3386,
+    3387, 3381, 3383,
+    3385, 3388, 3386,
+    3389, 3387, 3386,
+    3389, 3386, 3388,
+    3381, 3387, 3390,
+    3387, 3389, 3391,
+    3387, 3391, 3390,
+    3381, 3390, 3392,
+    3378, 3381, 3392,
+    3393, 3390, 3391,
+    3378, 3392, 3394,
+    3376, 3378, 3394,
+    3376, 3394, 3375,
+    3395, 3392, 3390,
+    3393, 3395, 3390,
+    3396, 3394, 3392,
+    3395, 3396, 3392,
+    3397, 3375, 3394,
+    3396, 3397, 3394,
+    3397, 3398, 3375,
+    3398, 3372, 3375,
+    3372, 3398, 3373,
+    3398, 3397, 3399,
+    3398, 3400, 3373,
+    3398, 3399, 3400,
+    3401, 3373, 3400,
+    3401, 3371, 3373,
+    3399, 3402, 3400,
+    3403, 3401, 3400,
+    3403, 3400, 3402,
+    3371, 3401, 3404,
+    3401, 3403, 3405,
+    3401, 3405, 3404,
+    3371, 3404, 3406,
+    3371, 3406, 3369,
+    3407, 3404, 3405,
+    3408, 3369, 3406,
+    3408, 3368, 3369,
+    3404, 3409, 3406,
+    3404, 3407, 3409,
+    3410, 3408, 3406,
+    3410, 3406, 3409,
+    3368, 3408, 3411,
+    3408, 3410, 3412,
+    3408, 3412, 3411,
+    3368, 3411, 3413,
+    3314, 3368, 3413,
+    3314, 3413, 3307,
+    3298, 3307, 3413,
+    3414, 3298, 3413,
+    3414, 3413, 3411,
+    3298, 3414, 3294,
+    3415, 3414, 3411,
+    3415, 3411, 3412,
+    3414, 3416, 3294,
+    3414, 3415, 3416,
+    3291, 3294, 3416,
+    3417, 3291, 3416,
+    3291, 3417, 3061,
+    3415, 3418, 3416,
+    3417, 3416, 3418,
+    3415, 3419, 3418,
+    3419, 3415, 3412,
+    3420, 3417, 3418,
+    3419, 3412, 3421,
+    3410, 3421, 3412,
+    3419, 3422, 3418,
+    3420, 3418, 3422,
+    3423, 3419, 3421,
+    3419, 3423, 3422,
+    3410, 3424, 3421,
+    3424, 3410, 3409,
+    3423, 3421, 3425,
+    3424, 3425, 3421,
+    3424, 3409, 3426,
+    3407, 3426, 3409,
+    3424, 3427, 3425,
+    3427, 3424, 3426,
+    3407, 3428, 3426,
+    3427, 3426, 3429,
+    3428, 3429, 3426,
+    3407, 3430, 3428,
+    3430, 3407, 3405,
+    3428, 3431, 3429,
+    3430, 3405, 3432,
+    3403, 3432, 3405,
+    3430, 3433, 3428,
+    3431, 3428, 3433,
+    3434, 3430, 3432,
+    3430, 3434, 3433,
+    3403, 3435, 3432,
+    3435, 3403, 3402,
+    3434, 3432, 3436,
+    3435, 3436, 3432,
+    3437, 3434, 3436,
+    3435, 3402, 3438,
+    3434, 3437, 3439,
+    3434, 3439, 3433,
+    3435, 3440, 3436,
+    3440, 3435, 3438,
+    3437, 3436, 3441,
+    3440, 3441, 3436,
+    3442, 3437, 3441,
+    3437, 3442, 3443,
+    3437, 3443, 3439,
+    3442, 3441, 3444,
+    3442, 3445, 3443,
+    3442, 3444, 3445,
+    3441, 3446, 3444,
+    3441, 3440, 3446,
+    3444, 3447, 3445,
+    3448, 3444, 3446,
+    3444, 3448, 3447,
+    3449, 3448, 3446,
+    3450, 3445, 3447,
+    3449, 3446, 3451,
+    3440, 3451, 3446,
+    3450, 3452, 3445,
+    3452, 3443, 3445,
+    3452, 3453, 3443,
+    3453, 3439, 3443,
+    3452, 3450, 3454,
+    3453, 3455, 3439,
+    3455, 3433, 3439,
+    3455, 3431, 3433,
+    3453, 3452, 3456,
+    3452, 3454, 3456,
+    3455, 3453, 3457,
+    3453, 3456, 3457,
+    3455, 3457, 3458,
+    3431, 3455, 3458,
+    3459, 3457, 3456,
+    3460, 3458, 3457,
+    3459, 3460, 3457,
+    3431, 3458, 3461,
+    3460, 3459, 298,
+    3460, 298, 294,
+    3459, 300, 298,
+    3462, 3460, 294,
+    3460, 3462, 3458,
+    3462, 294, 287,
+    3462, 3461, 3458,
+    285, 3462, 287,
+    3462, 285, 3461,
+    285, 283, 3461,
+    3463, 3461, 283,
+    3463, 3431, 3461,
+    281, 3463, 283,
+    3431, 3463, 3429,
+    281, 3464, 3463,
+    3464, 3429, 3463,
+    3464, 281, 280,
+    3464, 3427, 3429,
+    3464, 280, 3465,
+    3427, 3464, 3465,
+    278, 3465, 280,
+    3427, 3465, 3425,
+    3466, 3425, 3465,
+    278, 3466, 3465,
+    3466, 3423, 3425,
+    3466, 278, 3467,
+    278, 275, 3467,
+    273, 3467, 275,
+    3423, 3466, 3468,
+    3466, 3467, 3468,
+    3423, 3468, 3422,
+    273, 3469, 3467,
+    3469, 3468, 3467,
+    3469, 273, 269,
+    3469, 269, 270,
+    3470, 3422, 3468,
+    3469, 3470, 3468,
+    3470, 3420, 3422,
+    3471, 3469, 270,
+    3469, 3471, 3470,
+    3471, 270, 3017,
+    3020, 3471, 3017,
+    3471, 3472, 3470,
+    3471, 3020, 3472,
+    3420, 3470, 3472,
+    3020, 3024, 3472,
+    3473, 3420, 3472,
+    3473, 3472, 3024,
+    3420, 3473, 3417,
+    3031, 3473, 3024,
+    3473, 3061, 3417,
+    3473, 3031, 3061,
+    3474, 3475, 3476,
+    2554, 3475, 2557,
+    3475, 2554, 2528,
+    3475, 3124, 2557,
+    3475, 2528, 3476,
+    3475, 3474, 3124,
+    2522, 3476, 2528,
+    3474, 3477, 3124,
+    3120, 3124, 3477,
+    3118, 3120, 3477,
+    3477, 3474, 3478,
+    3118, 3477, 3479,
+    3477, 3478, 3479,
+    3118, 3479, 3480,
+    3481, 3118, 3480,
+    3482, 3479, 3478,
+    3481, 3480, 3483,
+    3484, 3481, 3483,
+    3484, 3483, 3485,
+    3486, 3480, 3479,
+    3482, 3486, 3479,
+    3487, 3483, 3480,
+    3486, 3487, 3480,
+    3483, 3488, 3485,
+    3483, 3487, 3488,
+    3489, 3485, 3488,
+    3490, 3489, 3488,
+    3489, 3490, 3491,
+    3487, 3492, 3488,
+    3490, 3488, 3492,
+    3487, 3493, 3492,
+    3487, 3486, 3493,
+    3494, 3490, 3492,
+    3486, 3495, 3493,
+    3486, 3482, 3495,
+    3493, 3496, 3492,
+    3494, 3492, 3496,
+    3493, 3497, 3496,
+    3497, 3493, 3495,
+    3498, 3494, 3496,
+    3497, 3499, 3496,
+    3498, 3496, 3499,
+    3500, 3497, 3495,
+    3497, 3501, 3499,
+    3497, 3500, 3501,
+    3500, 3495, 3502,
+    3482, 3502, 3495,
+    3500, 3503, 3501,
+    3482, 3504, 3502,
+    3504, 3482, 3478,
+    3505, 3500, 3502,
+    3500, 3505, 3503,
+    3504, 3506, 3502,
+    3505, 3502, 3506,
+    3504, 3478, 3507,
+    3474, 3507, 3478,
+    3474, 3476, 3507,
+    3508, 3504, 3507,
+    3504, 3508, 3506,
+    3476, 3509, 3507,
+    3508, 3507, 3509,
+    3476, 2522, 3509,
+    2522, 3510, 3509,
+    2522, 3511, 3510,
+    3512, 3508, 3509,
+    3512, 3509, 3510,
+    3508, 3512, 3513,
+    3508, 3513, 3506,
+    3514, 3512, 3510,
+    3515, 3506, 3513,
+    3515, 3505, 3506,
+    3512, 3516, 3513,
+    3512, 3514, 3516,
+    3517, 3515, 3513,
+    3517, 3513, 3516,
+    3505, 3515, 3518,
+    3505, 3518, 3503,
+    3515, 3517, 3519,
+    3515, 3519, 3518,
+    3517, 794, 3519,
+    3517, 793, 794,
+    793, 3517, 3516,
+    796, 3519, 794,
+    793, 3516, 3520,
+    789, 793, 3520,
+    3514, 3520, 3516,
+    789, 3520, 3521,
+    785, 789, 3521,
+    785, 3521, 786,
+    3522, 786, 3521,
+    3523, 3521, 3520,
+    3523, 3522, 3521,
+    3514, 3523, 3520,
+    3522, 3523, 3524,
+    3523, 3514, 3525,
+    3523, 3525, 3524,
+    3514, 3510, 3525,
+    3526, 3524, 3525,
+    3511, 3525, 3510,
+    3511, 3526, 3525,
+    796, 3527, 3519,
+    3527, 3518, 3519,
+    3527, 796, 798,
+    3527, 3528, 3518,
+    3528, 3503, 3518,
+    3529, 3527, 798,
+    3528, 3530, 3503,
+    3530, 3501, 3503,
+    3528, 3527, 3531,
+    3527, 3529, 3531,
+    3530, 3528, 3532,
+    3528, 3531, 3532,
+    3501, 3530, 3533,
+    3501, 3533, 3499,
+    3530, 3534, 3533,
+    3530, 3532, 3534,
+    3535, 3499, 3533,
+    3535, 3498, 3499,
+    3536, 3535, 3533,
+    3536, 3533, 3534,
+    3498, 3535, 3537,
+    3535, 3536, 3538,
+    3535, 3538, 3537,
+    3498, 3537, 3539,
+    3494, 3498, 3539,
+    3540, 3539, 3537,
+    3494, 3539, 3541,
+    3490, 3494, 3541,
+    3490, 3541, 3491,
+    3542, 3491, 3541,
+    3543, 3541, 3539,
+    3543, 3542, 3541,
+    3540, 3543, 3539,
+    3542, 3543, 3544,
+    3545, 3542, 3544,
+    3540, 3546, 3543,
+    3546, 3544, 3543,
+    3545, 3544, 3547,
+    3548, 3545, 3547,
+    3548, 3547, 3549,
+    3550, 3547, 3544,
+    3546, 3550, 3544,
+    3547, 3551, 3549,
+    3547, 3550, 3551,
+    3552, 3549, 3551,
+    3553, 3552, 3551,
+    3552, 3553, 3554,
+    3553, 3551, 3555,
+    3550, 3555, 3551,
+    3553, 3556, 3554,
+    3557, 3554, 3556,
+    3558, 3553, 3555,
+    3553, 3558, 3556,
+    3559, 3557, 3556,
+    3557, 3559, 3560,
+    3558, 3561, 3556,
+    3559, 3556, 3561,
+    3558, 3562, 3561,
+    3558, 3555, 3562,
+    3563, 3559, 3561,
+    3555, 3564, 3562,
+    3555, 3550, 3564,
+    3562, 3565, 3561,
+    3563, 3561, 3565,
+    3562, 3566, 3565,
+    3566, 3562, 3564,
+    3567, 3563, 3565,
+    3566, 3568, 3565,
+    3567, 3565, 3568,
+    3569, 3566, 3564,
+    3563, 3567, 3570,
+    3569, 3564, 3571,
+    3550, 3571, 3564,
+    3571, 3550, 3572,
+    3550, 3546, 3572,
+    3573, 3569, 3571,
+    3574, 3572, 3546,
+    3540, 3574, 3546,
+    3574, 3540, 3537,
+    3574, 3537, 3538,
+    3574, 3575, 3572,
+    3575, 3574, 3538,
+    3571, 3572, 3576,
+    3575, 3576, 3572,
+    3573, 3571, 3576,
+    3575, 3538, 3577,
+    3536, 3577, 3538,
+    3578, 3575, 3577,
+    3575, 3578, 3576,
+    3536, 3579, 3577,
+    3579, 3536, 3534,
+    3578, 3577, 3580,
+    3579, 3580, 3577,
+    3579, 3534, 3581,
+    3532, 3581, 3534,
+    3579, 3582, 3580,
+    3582, 3579, 3581,
+    3532, 3583, 3581,
+    3583, 3532, 3531,
+    3582, 3581, 3584,
+    3583, 3584, 3581,
+    3585, 3582, 3584,
+    3586, 3583, 3531,
+    3586, 3531, 3529,
+    3582, 3585, 3587,
+    3582, 3587, 3580,
+    3588, 3580, 3587,
+    3588, 3578, 3580,
+    3578, 3588, 3589,
+    3578, 3589, 3576,
+    3576, 3589, 3590,
+    3588, 3590, 3589,
+    3573, 3576, 3590,
+    3588, 3591, 3590,
+    3591, 3588, 3587,
+    3573, 3590, 3592,
+    3591, 3592, 3590,
+    3593, 3573, 3592,
+    3573, 3593, 3569,
+    3591, 3594, 3592,
+    3593, 3595, 3569,
+    3566, 3569, 3595,
+    3593, 3592, 3596,
+    3594, 3596, 3592,
+    3597, 3593, 3596,
+    3593, 3597, 3595,
+    3594, 3598, 3596,
+    3597, 3596, 3599,
+    3598, 3599, 3596,
+    3597, 3600, 3595,
+    3601, 3597, 3599,
+    3597, 3601, 3600,
+    3602, 3595, 3600,
+    3602, 3566, 3595,
+    3566, 3602, 3568,
+    3603, 3602, 3600,
+    3602, 3604, 3568,
+    3602, 3603, 3604,
+    3605, 3568, 3604,
+    3605, 3567, 3568,
+    3603, 3606, 3604,
+    3567, 3605, 3607,
+    3567, 3607, 3570,
+    3608, 3605, 3604,
+    3608, 3604, 3606,
+    3605, 3609, 3607,
+    3605, 3608, 3609,
+    3610, 3607, 3609,
+    3608, 3611, 3609,
+    3610, 3612, 3607,
+    3612, 3570, 3607,
+    3613, 3610, 3609,
+    3613, 3609, 3611,
+    3612, 3610, 3614,
+    3613, 3615, 3610,
+    3615, 3614, 3610,
+    3615, 3613, 3616,
+    3617, 3612, 3614,
+    3615, 3618, 3614,
+    3612, 3617, 3619,
+    3612, 3619, 3570,
+    3617, 3614, 3620,
+    3618, 3620, 3614,
+    3617, 3621, 3619,
+    3622, 3617, 3620,
+    3617, 3622, 3621,
+    3623, 3619, 3621,
+    3624, 3623, 3621,
+    3619, 3623, 3625,
+    3619, 3625, 3570,
+    3623, 3560, 3625,
+    3563, 3570, 3625,
+    3559, 3625, 3560,
+    3559, 3563, 3625,
+    3624, 3621, 3626,
+    3622, 3626, 3621,
+    3627, 3624, 3626,
+    3627, 3626, 3628,
+    3629, 3627, 3628,
+    3622, 3630, 3626,
+    3630, 3628, 3626,
+    3629, 3628, 3631,
+    3632, 3629, 3631,
+    3630, 3633, 3628,
+    3633, 3631, 3628,
+    3632, 3631, 3634,
+    3635, 3632, 3634,
+    3633, 3636, 3631,
+    3636, 3634, 3631,
+    3635, 3634, 3637,
+    3638, 3635, 3637,
+    3636, 3639, 3634,
+    3639, 3637, 3634,
+    3639, 3636, 3640,
+    3639, 3640, 3637,
+    3638, 3637, 3641,
+    3640, 3641, 3637,
+    3642, 3638, 3641,
+    3636, 3643, 3640,
+    3636, 3633, 3643,
+    3640, 3644, 3641,
+    3644, 3640, 3643,
+    3642, 3641, 3645,
+    3644, 3645, 3641,
+    3646, 3642, 3645,
+    3646, 3645, 3647,
+    3648, 3646, 3647,
+    3644, 3649, 3645,
+    3649, 3647, 3645,
+    3648, 3647, 3650,
+    3651, 3648, 3650,
+    3649, 3652, 3647,
+    3652, 3650, 3647,
+    3651, 3650, 3653,
+    3654, 3651, 3653,
+    3652, 3655, 3650,
+    3655, 3653, 3650,
+    3654, 3653, 3656,
+    3657, 3654, 3656,
+    3655, 3658, 3653,
+    3658, 3656, 3653,
+    3657, 3656, 3659,
+    3660, 3657, 3659,
+    3658, 3661, 3656,
+    3661, 3659, 3656,
+    3660, 3659, 3662,
+    3663, 3660, 3662,
+    3661, 3664, 3659,
+    3664, 3662, 3659,
+    3663, 3662, 3665,
+    3666, 3663, 3665,
+    3664, 3667, 3662,
+    3667, 3665, 3662,
+    3666, 3665, 3668,
+    3669, 3666, 3668,
+    3667, 3670, 3665,
+    3670, 3668, 3665,
+    3669, 3668, 3671,
+    3672, 3669, 3671,
+    3670, 3673, 3668,
+    3673, 3671, 3668,
+    3672, 3671, 3674,
+    3675, 3672, 3674,
+    3673, 3676, 3671,
+    3676, 3674, 3671,
+    3675, 3674, 3677,
+    3678, 3675, 3677,
+    3676, 3679, 3674,
+    3679, 3677, 3674,
+    3678, 3677, 3680,
+    3681, 3678, 3680,
+    3679, 3682, 3677,
+    3682, 3680, 3677,
+    3681, 3680, 3683,
+    3684, 3681, 3683,
+    3682, 3685, 3680,
+    3685, 3683, 3680,
+    3684, 3683, 3686,
+    3687, 3684, 3686,
+    3687, 3686, 3688,
+    3689, 3686, 3683,
+    3685, 3689, 3683,
+    3686, 3690, 3688,
+    3686, 3689, 3690,
+    3691, 3688, 3690,
+    3689, 3685, 3692,
+    3693, 3691, 3690,
+    3689, 3694, 3690,
+    3693, 3690, 3694,
+    3689, 3695, 3694,
+    3695, 3689, 3692,
+    3696, 3693, 3694,
+    3695, 3697, 3694,
+    3696, 3694, 3697,
+    3691, 3693, 3698,
+    3699, 3691, 3698,
+    3696, 3700, 3693,
+    3700, 3698, 3693,
+    3699, 3698, 3701,
+    3702, 3699, 3701,
+    3700, 3703, 3698,
+    3703, 3701, 3698,
+    3702, 3701, 3704,
+    3705, 3702, 3704,
+    3706, 3705, 3707,
+    3705, 3704, 3707,
+    904, 3707, 3704,
+    3708, 904, 3704,
+    3708, 3704, 3701,
+    3703, 3708, 3701,
+    904, 3708, 903,
+    3703, 3709, 3708,
+    3709, 903, 3708,
+    3703, 3700, 3709,
+    3709, 900, 903,
+    3700, 3710, 3709,
+    900, 3709, 3710,
+    3700, 3696, 3710,
+    3711, 900, 3710,
+    900, 3711, 898,
+    3696, 3712, 3710,
+    3711, 3710, 3712,
+    3712, 3696, 3697,
+    3711, 3713, 898,
+    897, 898, 3713,
+    3714, 3711, 3712,
+    3711, 3714, 3713,
+    3714, 3712, 3715,
+    3714, 3715, 3713,
+    3712, 3697, 3715,
+    3716, 3713, 3715,
+    3716, 897, 3713,
+    3717, 3715, 3697,
+    3717, 3716, 3715,
+    3695, 3717, 3697,
+    897, 3716, 3718,
+    897, 3718, 895,
+    3716, 3717, 3719,
+    3716, 3719, 3718,
+    3717, 3695, 3720,
+    3717, 3720, 3719,
+    3695, 3692, 3720,
+    3721, 3719, 3720,
+    3722, 3720, 3692,
+    3722, 3721, 3720,
+    3723, 3722, 3692,
+    3723, 3692, 3685,
+    3682, 3723, 3685,
+    3723, 3682, 3724,
+    3682, 3679, 3724,
+    3722, 3723, 3725,
+    3723, 3724, 3725,
+    3722, 3725, 3726,
+    3721, 3722, 3726,
+    3727, 3725, 3724,
+    3728, 3724, 3679,
+    3728, 3727, 3724,
+    3676, 3728, 3679,
+    3727, 3729, 3725,
+    3729, 3726, 3725,
+    3728, 3676, 3730,
+    3676, 3673, 3730,
+    3728, 3730, 3731,
+    3727, 3728, 3731,
+    3732, 3730, 3673,
+    3670, 3732, 3673,
+    3732, 3733, 3730,
+    3733, 3731, 3730,
+    3732, 3670, 3734,
+    3670, 3667, 3734,
+    3733, 3732, 3735,
+    3732, 3734, 3735,
+    3736, 3734, 3667,
+    3664, 3736, 3667,
+    3737, 3735, 3734,
+    3736, 3737, 3734,
+    3736, 3664, 3738,
+    3664, 3661, 3738,
+    3737, 3736, 3739,
+    3736, 3738, 3739,
+    3740, 3738, 3661,
+    3658, 3740, 3661,
+    3741, 3739, 3738,
+    3740, 3741, 3738,
+    3740, 3658, 3742,
+    3658, 3655, 3742,
+    3741, 3740, 3743,
+    3740, 3742, 3743,
+    3744, 3742, 3655,
+    3652, 3744, 3655,
+    3745, 3743, 3742,
+    3744, 3745, 3742,
+    3744, 3652, 3746,
+    3652, 3649, 3746,
+    3745, 3744, 3747,
+    3744, 3746, 3747,
+    3748, 3746, 3649,
+    3644, 3748, 3649,
+    3748, 3644, 3643,
+    3748, 3749, 3746,
+    3749, 3747, 3746,
+    3748, 3643, 3750,
+    3749, 3748, 3750,
+    3633, 3750, 3643,
+    3633, 3630, 3750,
+    3630, 3751, 3750,
+    3749, 3750, 3751,
+    3630, 3622, 3751,
+    3622, 3620, 3751,
+    3752, 3749, 3751,
+    3752, 3751, 3620,
+    3749, 3752, 3747,
+    3618, 3752, 3620,
+    3752, 3753, 3747,
+    3752, 3618, 3753,
+    3745, 3747, 3753,
+    3618, 3754, 3753,
+    3618, 3615, 3754,
+    3755, 3745, 3753,
+    3755, 3753, 3754,
+    3745, 3755, 3743,
+    3615, 3616, 3754,
+    3755, 3756, 3743,
+    3741, 3743, 3756,
+    3757, 3755, 3754,
+    3755, 3757, 3756,
+    3757, 3754, 3616,
+    3758, 3741, 3756,
+    3741, 3758, 3739,
+    3757, 3759, 3756,
+    3758, 3756, 3759,
+    3757, 3760, 3759,
+    3760, 3757, 3616,
+    3761, 3758, 3759,
+    3760, 3616, 3762,
+    3613, 3762, 3616,
+    3762, 3613, 3611,
+    3760, 3763, 3759,
+    3761, 3759, 3763,
+    3764, 3760, 3762,
+    3760, 3764, 3763,
+    3764, 3762, 3765,
+    3762, 3611, 3765,
+    3764, 3766, 3763,
+    3767, 3765, 3611,
+    3608, 3767, 3611,
+    3767, 3608, 3606,
+    3764, 3765, 3768,
+    3766, 3764, 3768,
+    3767, 3769, 3765,
+    3769, 3768, 3765,
+    3769, 3767, 3770,
+    3767, 3606, 3770,
+    3769, 3771, 3768,
+    3772, 3770, 3606,
+    3603, 3772, 3606,
+    3769, 3770, 3773,
+    3771, 3769, 3773,
+    3772, 3774, 3770,
+    3774, 3773, 3770,
+    3772, 3603, 3775,
+    3603, 3600, 3775,
+    3601, 3775, 3600,
+    3772, 3775, 3776,
+    3774, 3772, 3776,
+    3601, 3777, 3775,
+    3777, 3776, 3775,
+    3777, 3601, 3778,
+    3601, 3599, 3778,
+    3777, 3779, 3776,
+    3780, 3778, 3599,
+    3598, 3780, 3599,
+    3777, 3778, 3781,
+    3779, 3777, 3781,
+    3780, 3782, 3778,
+    3782, 3781, 3778,
+    3780, 3598, 3783,
+    3782, 3780, 3784,
+    3780, 3783, 3784,
+    3598, 3785, 3783,
+    3598, 3594, 3785,
+    3786, 3784, 3783,
+    3594, 3787, 3785,
+    3594, 3591, 3787,
+    3591, 3587, 3787,
+    3585, 3787, 3587,
+    3585, 3788, 3787,
+    3788, 3785, 3787,
+    3585, 3584, 3788,
+    3788, 3789, 3785,
+    3789, 3783, 3785,
+    3789, 3786, 3783,
+    3584, 3790, 3788,
+    3789, 3788, 3790,
+    3584, 3583, 3790,
+    3583, 3791, 3790,
+    3583, 3586, 3791,
+    3792, 3789, 3790,
+    3792, 3790, 3791,
+    3789, 3792, 3793,
+    3786, 3789, 3793,
+    3794, 3792, 3791,
+    3795, 3793, 3792,
+    3794, 3795, 3792,
+    3794, 3791, 3796,
+    3586, 3796, 3791,
+    3794, 3797, 3795,
+    3797, 3794, 3796,
+    3586, 3798, 3796,
+    3798, 3586, 3529,
+    3798, 3799, 3796,
+    3797, 3796, 3799,
+    3798, 3529, 3800,
+    3798, 3800, 3799,
+    3529, 798, 3800,
+    800, 3800, 798,
+    3800, 800, 803,
+    3800, 803, 3799,
+    808, 3799, 803,
+    808, 3797, 3799,
+    3797, 808, 811,
+    3797, 811, 3795,
+    3801, 3795, 811,
+    809, 3801, 811,
+    3795, 3801, 3793,
+    3801, 809, 812,
+    3801, 3802, 3793,
+    3801, 812, 3802,
+    3786, 3793, 3802,
+    812, 815, 3802,
+    3803, 3786, 3802,
+    3803, 3802, 815,
+    3786, 3803, 3784,
+    3804, 3803, 815,
+    3804, 815, 816,
+    3803, 3805, 3784,
+    3803, 3804, 3805,
+    3782, 3784, 3805,
+    3806, 3804, 816,
+    3806, 816, 818,
+    3804, 3807, 3805,
+    3804, 3806, 3807,
+    3805, 3807, 3808,
+    3806, 3808, 3807,
+    3809, 3782, 3805,
+    3809, 3805, 3808,
+    3782, 3809, 3781,
+    3809, 3808, 3810,
+    3811, 3810, 3808,
+    3806, 3811, 3808,
+    3812, 3809, 3810,
+    3812, 3810, 3811,
+    3809, 3813, 3781,
+    3779, 3781, 3813,
+    3809, 3812, 3814,
+    3809, 3814, 3813,
+    3812, 3815, 3814,
+    3814, 3816, 3813,
+    3817, 3815, 3812,
+    3818, 3814, 3815,
+    3814, 3818, 3816,
+    3817, 3818, 3815,
+    3813, 3816, 3819,
+    3818, 3819, 3816,
+    3820, 3813, 3819,
+    3820, 3779, 3813,
+    3779, 3820, 3821,
+    3779, 3821, 3776,
+    3774, 3776, 3821,
+    3820, 3822, 3821,
+    3820, 3819, 3822,
+    3823, 3774, 3821,
+    3823, 3821, 3822,
+    3774, 3823, 3773,
+    3819, 3824, 3822,
+    3819, 3818, 3824,
+    3825, 3823, 3822,
+    3825, 3822, 3824,
+    3823, 3826, 3773,
+    3823, 3825, 3826,
+    3771, 3773, 3826,
+    3827, 3771, 3826,
+    3825, 3828, 3826,
+    3827, 3826, 3828,
+    3771, 3827, 3829,
+    3771, 3829, 3768,
+    3766, 3768, 3829,
+    3827, 3830, 3829,
+    3831, 3766, 3829,
+    3831, 3829, 3830,
+    3831, 3832, 3766,
+    3832, 3763, 3766,
+    3832, 3761, 3763,
+    3832, 3831, 3833,
+    3761, 3832, 3834,
+    3832, 3833, 3834,
+    3761, 3834, 3835,
+    3758, 3761, 3835,
+    3758, 3835, 3739,
+    3737, 3739, 3835,
+    3836, 3737, 3835,
+    3836, 3835, 3834,
+    3737, 3836, 3735,
+    3837, 3836, 3834,
+    3837, 3834, 3833,
+    3836, 3838, 3735,
+    3836, 3837, 3838,
+    3733, 3735, 3838,
+    3839, 3733, 3838,
+    3733, 3839, 3731,
+    3837, 3840, 3838,
+    3839, 3838, 3840,
+    3837, 3841, 3840,
+    3841, 3837, 3833,
+    3842, 3839, 3840,
+    3841, 3833, 3843,
+    3831, 3843, 3833,
+    3843, 3831, 3830,
+    3841, 3844, 3840,
+    3842, 3840, 3844,
+    3845, 3841, 3843,
+    3841, 3845, 3844,
+    3843, 3830, 3846,
+    3845, 3843, 3846,
+    3847, 3846, 3830,
+    3827, 3847, 3830,
+    3847, 3827, 3828,
+    3846, 3847, 3848,
+    3847, 3828, 3849,
+    3847, 3849, 3848,
+    3828, 3850, 3849,
+    3828, 3825, 3850,
+    3851, 3849, 3850,
+    3825, 3852, 3850,
+    3852, 3825, 3824,
+    3853, 3851, 3850,
+    3853, 3850, 3852,
+    3851, 3854, 3849,
+    3854, 3848, 3849,
+    3851, 3853, 3855,
+    3851, 3855, 3854,
+    3854, 3856, 3848,
+    3855, 3857, 3854,
+    3856, 3854, 3857,
+    3856, 3858, 3848,
+    3846, 3848, 3858,
+    3845, 3846, 3858,
+    3856, 3859, 3858,
+    3859, 3856, 3857,
+    3845, 3858, 3860,
+    3859, 3860, 3858,
+    3861, 3845, 3860,
+    3845, 3861, 3844,
+    3859, 3862, 3860,
+    3863, 3844, 3861,
+    3863, 3842, 3844,
+    3861, 3860, 3864,
+    3862, 3864, 3860,
+    3865, 3863, 3861,
+    3865, 3861, 3864,
+    3842, 3863, 3866,
+    3863, 3865, 3867,
+    3863, 3867, 3866,
+    3842, 3866, 3868,
+    3839, 3842, 3868,
+    3839, 3868, 3731,
+    3727, 3731, 3868,
+    3729, 3727, 3868,
+    3729, 3868, 3866,
+    3869, 3729, 3866,
+    3869, 3866, 3867,
+    3729, 3869, 3726,
+    3869, 3870, 3726,
+    3721, 3726, 3870,
+    3871, 3869, 3867,
+    3869, 3871, 3870,
+    3872, 3721, 3870,
+    3721, 3872, 3719,
+    3872, 3718, 3719,
+    3872, 3870, 3873,
+    3871, 3873, 3870,
+    3872, 3874, 3718,
+    3874, 3872, 3873,
+    3874, 895, 3718,
+    3874, 3875, 895,
+    3875, 893, 895,
+    3874, 3873, 3876,
+    3875, 3874, 3876,
+    893, 3875, 3877,
+    893, 3877, 891,
+    3875, 3876, 3878,
+    3875, 3878, 3877,
+    3879, 3876, 3873,
+    3871, 3879, 3873,
+    3876, 3880, 3878,
+    3876, 3879, 3880,
+    3879, 3871, 3881,
+    3871, 3867, 3881,
+    3865, 3881, 3867,
+    3879, 3881, 3882,
+    3879, 3882, 3880,
+    3881, 3865, 3883,
+    3881, 3883, 3882,
+    3865, 3864, 3883,
+    3884, 3883, 3864,
+    3862, 3884, 3864,
+    3885, 3882, 3883,
+    3884, 3885, 3883,
+    3862, 3886, 3884,
+    3862, 3859, 3886,
+    3859, 3857, 3886,
+    3886, 3887, 3884,
+    3885, 3884, 3887,
+    3888, 3886, 3857,
+    3886, 3888, 3887,
+    3855, 3888, 3857,
+    3889, 3885, 3887,
+    3888, 3855, 3890,
+    3853, 3890, 3855,
+    3888, 3891, 3887,
+    3889, 3887, 3891,
+    3892, 3888, 3890,
+    3888, 3892, 3891,
+    3853, 3893, 3890,
+    3893, 3853, 3852,
+    3893, 3894, 3890,
+    3892, 3890, 3894,
+    3893, 3852, 3895,
+    3893, 3895, 3894,
+    3852, 3824, 3895,
+    3818, 3895, 3824,
+    3895, 3896, 3894,
+    3818, 3897, 3895,
+    3897, 3896, 3895,
+    3898, 3894, 3896,
+    3897, 3898, 3896,
+    3898, 3892, 3894,
+    3818, 3899, 3897,
+    3892, 3898, 3900,
+    3892, 3900, 3891,
+    3898, 3897, 3901,
+    3899, 3901, 3897,
+    3898, 3902, 3900,
+    3902, 3898, 3901,
+    3903, 3891, 3900,
+    3903, 3889, 3891,
+    3904, 3900, 3902,
+    3904, 3903, 3900,
+    3902, 3901, 3905,
+    3906, 3904, 3902,
+    3906, 3902, 3905,
+    3907, 3905, 3901,
+    3899, 3907, 3901,
+    3906, 3905, 3908,
+    3907, 3899, 3909,
+    3910, 3908, 3905,
+    3907, 3910, 3905,
+    3911, 3906, 3908,
+    3911, 3908, 3910,
+    3910, 3907, 3912,
+    3907, 3909, 3912,
+    3913, 3911, 3910,
+    3910, 3912, 3914,
+    3913, 3910, 3914,
+    3913, 864, 3911,
+    864, 3913, 862,
+    3913, 3914, 862,
+    860, 862, 3914,
+    864, 3915, 3911,
+    3906, 3911, 3915,
+    864, 865, 3915,
+    3916, 3906, 3915,
+    3906, 3916, 3904,
+    865, 3917, 3915,
+    3916, 3915, 3917,
+    3917, 865, 3918,
+    865, 867, 3918,
+    3919, 3916, 3917,
+    3920, 3918, 867,
+    869, 3920, 867,
+    3917, 3918, 3921,
+    3919, 3917, 3921,
+    3920, 3922, 3918,
+    3922, 3921, 3918,
+    3920, 869, 3923,
+    869, 873, 3923,
+    3922, 3920, 3924,
+    3920, 3923, 3924,
+    3925, 3923, 873,
+    876, 3925, 873,
+    3926, 3924, 3923,
+    3925, 3926, 3923,
+    3926, 3927, 3924,
+    3926, 3925, 3927,
+    3925, 876, 3928,
+    3925, 3928, 3927,
+    876, 874, 3928,
+    3927, 3929, 3924,
+    3922, 3924, 3929,
+    3930, 3927, 3928,
+    3927, 3930, 3929,
+    3931, 3928, 874,
+    3931, 3930, 3928,
+    872, 3931, 874,
+    3931, 872, 3932,
+    872, 875, 3932,
+    882, 3932, 875,
+    3931, 3932, 3933,
+    3930, 3931, 3933,
+    882, 3934, 3932,
+    3934, 3933, 3932,
+    3934, 882, 3935,
+    882, 884, 3935,
+    3933, 3934, 3936,
+    3934, 3935, 3936,
+    3930, 3933, 3937,
+    3933, 3936, 3937,
+    3930, 3937, 3929,
+    3938, 3929, 3937,
+    3938, 3922, 3929,
+    3939, 3937, 3936,
+    3939, 3938, 3937,
+    3940, 3939, 3936,
+    3940, 3936, 3935,
+    3939, 3941, 3938,
+    3939, 3940, 3941,
+    3922, 3938, 3942,
+    3941, 3942, 3938,
+    3921, 3922, 3942,
+    3921, 3942, 3943,
+    3919, 3921, 3943,
+    3941, 3944, 3942,
+    3944, 3943, 3942,
+    3919, 3943, 3945,
+    3916, 3919, 3945,
+    3916, 3945, 3904,
+    3903, 3904, 3945,
+    3946, 3945, 3943,
+    3946, 3903, 3945,
+    3944, 3946, 3943,
+    3903, 3946, 3947,
+    3889, 3903, 3947,
+    3944, 3948, 3946,
+    3948, 3947, 3946,
+    3889, 3947, 3949,
+    3885, 3889, 3949,
+    3885, 3949, 3882,
+    3949, 3880, 3882,
+    3950, 3949, 3947,
+    3949, 3950, 3880,
+    3948, 3950, 3947,
+    3950, 3878, 3880,
+    3950, 3951, 3878,
+    3950, 3948, 3951,
+    3951, 3877, 3878,
+    3948, 3952, 3951,
+    3948, 3944, 3952,
+    3944, 3941, 3952,
+    3940, 3952, 3941,
+    3953, 3951, 3952,
+    3940, 3953, 3952,
+    3951, 3953, 3877,
+    3953, 3940, 3935,
+    3953, 891, 3877,
+    3953, 3935, 884,
+    891, 3953, 884,
+    3954, 3955, 3276,
+    3954, 3276, 3274,
+    3955, 3278, 3276,
+    3954, 3274, 3956,
+    3273, 3956, 3274,
+    3955, 3957, 3278,
+    3957, 3280, 3278,
+    3273, 3958, 3956,
+    3958, 3273, 3252,
+    3280, 3957, 3959,
+    3280, 3959, 3282,
+    3957, 3960, 3959,
+    3961, 3282, 3959,
+    3282, 3961, 3284,
+    3962, 3959, 3960,
+    3962, 3961, 3959,
+    3957, 3963, 3960,
+    3957, 3955, 3963,
+    3964, 3962, 3960,
+    3955, 3965, 3963,
+    3955, 3954, 3965,
+    3963, 3966, 3960,
+    3964, 3960, 3966,
+    3963, 3967, 3966,
+    3967, 3963, 3965,
+    3967, 3968, 3966,
+    3969, 3966, 3968,
+    3969, 3964, 3966,
+    3970, 3969, 3968,
+    3964, 3969, 3971,
+    3964, 3971, 3962,
+    3969, 3970, 3972,
+    3969, 3972, 3971,
+    3970, 3973, 3972,
+    3974, 3975, 3973,
+    3975, 3972, 3973,
+    3975, 3976, 3972,
+    3976, 3971, 3972,
+    3971, 3976, 3977,
+    3971, 3977, 3962,
+    3976, 3978, 3977,
+    3961, 3962, 3977,
+    3979, 3977, 3978,
+    3979, 3961, 3977,
+    3980, 3979, 3978,
+    3961, 3979, 3981,
+    3961, 3981, 3284,
+    3286, 3284, 3981,
+    3979, 3980, 3982,
+    3979, 3982, 3981,
+    3983, 3286, 3981,
+    3983, 3981, 3982,
+    3286, 3983, 3288,
+    3983, 3295, 3288,
+    3983, 3984, 3295,
+    3984, 3983, 3982,
+    3984, 3299, 3295,
+    3984, 3982, 3985,
+    3980, 3985, 3982,
+    3980, 3986, 3985,
+    3984, 3987, 3299,
+    3987, 3984, 3985,
+    3986, 3988, 3985,
+    3987, 3985, 3988,
+    3986, 3989, 3988,
+    3989, 3990, 3988,
+    3991, 3988, 3990,
+    3991, 3987, 3988,
+    3992, 3991, 3990,
+    3987, 3991, 3993,
+    3987, 3993, 3299,
+    3297, 3299, 3993,
+    3301, 3297, 3993,
+    3991, 3994, 3993,
+    3301, 3993, 3994,
+    3991, 3992, 3994,
+    3995, 3301, 3994,
+    3992, 3996, 3994,
+    3995, 3994, 3996,
+    3997, 3995, 3996,
+    3998, 3999, 4000,
+    3998, 4000, 4001,
+    3999, 3998, 4002,
+    3998, 4001, 4003,
+    3998, 4003, 4002,
+    3999, 4002, 4004,
+    4005, 3999, 4004,
+    4006, 4004, 4002,
+    3999, 4005, 4007,
+    3999, 4007, 4000,
+    4005, 4008, 4007,
+    4009, 4010, 4008,
+    4010, 4007, 4008,
+    4010, 4011, 4007,
+    4011, 4000, 4007,
+    4000, 4011, 4012,
+    4011, 4013, 4012,
+    4000, 4012, 4001,
+    4014, 4012, 4013,
+    3967, 4014, 4013,
+    4014, 3967, 3965,
+    4014, 4015, 4012,
+    4015, 4001, 4012,
+    4014, 3965, 4016,
+    4015, 4014, 4016,
+    3954, 4016, 3965,
+    4016, 3954, 3956,
+    4016, 3956, 4017,
+    4015, 4016, 4017,
+    3958, 4017, 3956,
+    4015, 4017, 4018,
+    4017, 3958, 4019,
+    4017, 4019, 4018,
+    4015, 4018, 4020,
+    4001, 4015, 4020,
+    4001, 4020, 4003,
+    4021, 4020, 4018,
+    4022, 4003, 4020,
+    4021, 4022, 4020,
+    4023, 4021, 4018,
+    4023, 4018, 4019,
+    4023, 4024, 4021,
+    4024, 4023, 4019,
+    4022, 4021, 4025,
+    4024, 4025, 4021,
+    4024, 4019, 4026,
+    3958, 4026, 4019,
+    4024, 4027, 4025,
+    4027, 4024, 4026,
+    3958, 4028, 4026,
+    4028, 3958, 3252,
+    4028, 3252, 3250,
+    4028, 4029, 4026,
+    4027, 4026, 4029,
+    4030, 4028, 3250,
+    4028, 4030, 4029,
+    4030, 3250, 3248,
+    4031, 4030, 3248,
+    4031, 3248, 3245,
+    4030, 4032, 4029,
+    4030, 4031, 4032,
+    4033, 4029, 4032,
+    4033, 4027, 4029,
+    4031, 4034, 4032,
+    4027, 4033, 4035,
+    4027, 4035, 4025,
+    4036, 4033, 4032,
+    4036, 4032, 4034,
+    4033, 4037, 4035,
+    4033, 4036, 4037,
+    4038, 4025, 4035,
+    4038, 4022, 4025,
+    4039, 4038, 4035,
+    4039, 4035, 4037,
+    4022, 4038, 4040,
+    4022, 4040, 4003,
+    4040, 4002, 4003,
+    4040, 4006, 4002,
+    4038, 4041, 4040,
+    4006, 4040, 4041,
+    4038, 4039, 4041,
+    4042, 4006, 4041,
+    4042, 4041, 4043,
+    4039, 4043, 4041,
+    4044, 4042, 4043,
+    4044, 4043, 4045,
+    4043, 4046, 4045,
+    4043, 4039, 4046,
+    4047, 4045, 4046,
+    4039, 4048, 4046,
+    4048, 4039, 4037,
+    4049, 4047, 4046,
+    4049, 4046, 4048,
+    4047, 4049, 4050,
+    4048, 4037, 4051,
+    4036, 4051, 4037,
+    4052, 4049, 4048,
+    4052, 4048, 4051,
+    4049, 4053, 4050,
+    4049, 4052, 4053,
+    4054, 4050, 4053,
+    4055, 4054, 4053,
+    4054, 4055, 4056,
+    4052, 4057, 4053,
+    4055, 4053, 4057,
+    4057, 4052, 4058,
+    4052, 4051, 4058,
+    4059, 4055, 4057,
+    4060, 4058, 4051,
+    4036, 4060, 4051,
+    4060, 4036, 4034,
+    4057, 4058, 4061,
+    4059, 4057, 4061,
+    4060, 4062, 4058,
+    4062, 4061, 4058,
+    4062, 4060, 4063,
+    4060, 4034, 4063,
+    4062, 4064, 4061,
+    4065, 4063, 4034,
+    4031, 4065, 4034,
+    4065, 4031, 3245,
+    4065, 3245, 3244,
+    4065, 4066, 4063,
+    4066, 4065, 3244,
+    4062, 4063, 4067,
+    4066, 4067, 4063,
+    4064, 4062, 4067,
+    4066, 3244, 4068,
+    3240, 4068, 3244,
+    4066, 4069, 4067,
+    4069, 4066, 4068,
+    3240, 4070, 4068,
+    3240, 3237, 4070,
+    3237, 3235, 4070,
+    4070, 4071, 4068,
+    4069, 4068, 4071,
+    4072, 4070, 3235,
+    4070, 4072, 4071,
+    3233, 4072, 3235,
+    4073, 4069, 4071,
+    4072, 3233, 4074,
+    3233, 3229, 4074,
+    4072, 4075, 4071,
+    4073, 4071, 4075,
+    4072, 4076, 4075,
+    4072, 4074, 4076,
+    4077, 4073, 4075,
+    4076, 4078, 4075,
+    4077, 4075, 4078,
+    4074, 4079, 4076,
+    4076, 4080, 4078,
+    4080, 4076, 4079,
+    4074, 4081, 4079,
+    4081, 4074, 3229,
+    3226, 4081, 3229,
+    4081, 3226, 3219,
+    4081, 3219, 4082,
+    4081, 4082, 4079,
+    3219, 3217, 4082,
+    4083, 4079, 4082,
+    4083, 4080, 4079,
+    4084, 4082, 3217,
+    4084, 4083, 4082,
+    3215, 4084, 3217,
+    4080, 4083, 4085,
+    4084, 3215, 4086,
+    3215, 3213, 4086,
+    4083, 4084, 4087,
+    4084, 4086, 4087,
+    4083, 4087, 4085,
+    4088, 4086, 3213,
+    3211, 4088, 3213,
+    4089, 4087, 4086,
+    4088, 4089, 4086,
+    4088, 3211, 4090,
+    3211, 3209, 4090,
+    4089, 4088, 4091,
+    4088, 4090, 4091,
+    4089, 4092, 4087,
+    4092, 4085, 4087,
+    4092, 4089, 4093,
+    4089, 4091, 4093,
+    4085, 4092, 4094,
+    4092, 4093, 4095,
+    4092, 4095, 4094,
+    4085, 4094, 4096,
+    4080, 4085, 4096,
+    4080, 4096, 4078,
+    4097, 4078, 4096,
+    4097, 4077, 4078,
+    4098, 4096, 4094,
+    4098, 4097, 4096,
+    4099, 4098, 4094,
+    4099, 4094, 4095,
+    4097, 4098, 4100,
+    4098, 4099, 4101,
+    4098, 4101, 4100,
+    4097, 4100, 4102,
+    4077, 4097, 4102,
+    4103, 4100, 4101,
+    4077, 4102, 4104,
+    4073, 4077, 4104,
+    4105, 4102, 4100,
+    4103, 4105, 4100,
+    4105, 4106, 4102,
+    4106, 4104, 4102,
+    4105, 4103, 4107,
+    4106, 4105, 4108,
+    4105, 4107, 4108,
+    4106, 4109, 4104,
+    4073, 4104, 4110,
+    4109, 4110, 4104,
+    4069, 4073, 4110,
+    4069, 4110, 4067,
+    4064, 4067, 4110,
+    4109, 4064, 4110,
+    4064, 4109, 4111,
+    4064, 4111, 4061,
+    4059, 4061, 4111,
+    4109, 4112, 4111,
+    4109, 4106, 4112,
+    4106, 4108, 4112,
+    4113, 4059, 4111,
+    4113, 4111, 4112,
+    4059, 4113, 4114,
+    4055, 4059, 4114,
+    4055, 4114, 4056,
+    4115, 4056, 4114,
+    4116, 4115, 4114,
+    4116, 4114, 4113,
+    4115, 4116, 4117,
+    4118, 4116, 4113,
+    4118, 4113, 4112,
+    4118, 4112, 4108,
+    4116, 4119, 4117,
+    4116, 4118, 4119,
+    4120, 4117, 4119,
+    4121, 4118, 4108,
+    4118, 4121, 4119,
+    4121, 4108, 4107,
+    4122, 4120, 4119,
+    4122, 4119, 4121,
+    4120, 4122, 4123,
+    4124, 4122, 4121,
+    4124, 4121, 4107,
+    4122, 4125, 4123,
+    4122, 4124, 4125,
+    4126, 4123, 4125,
+    4124, 4107, 4127,
+    4103, 4127, 4107,
+    4124, 4128, 4125,
+    4128, 4124, 4127,
+    4129, 4126, 4125,
+    4129, 4125, 4128,
+    4126, 4129, 4130,
+    4129, 4131, 4130,
+    4132, 4130, 4131,
+    4133, 4129, 4128,
+    4129, 4133, 4131,
+    4134, 4132, 4131,
+    4132, 4134, 4135,
+    4133, 4136, 4131,
+    4134, 4131, 4136,
+    4133, 4128, 4137,
+    4128, 4127, 4137,
+    4133, 4137, 4138,
+    4136, 4133, 4138,
+    4139, 4137, 4127,
+    4103, 4139, 4127,
+    4139, 4103, 4101,
+    4139, 4140, 4137,
+    4140, 4138, 4137,
+    4139, 4101, 4141,
+    4140, 4139, 4141,
+    4099, 4141, 4101,
+    4140, 4142, 4138,
+    4099, 4143, 4141,
+    4143, 4099, 4095,
+    4140, 4141, 4144,
+    4143, 4144, 4141,
+    4142, 4140, 4144,
+    4143, 4095, 4145,
+    4093, 4145, 4095,
+    4143, 4146, 4144,
+    4146, 4143, 4145,
+    4093, 4147, 4145,
+    4147, 4093, 4091,
+    4146, 4145, 4148,
+    4147, 4148, 4145,
+    4146, 4149, 4144,
+    4142, 4144, 4149,
+    4150, 4146, 4148,
+    4146, 4150, 4149,
+    4147, 4151, 4148,
+    4150, 4148, 4152,
+    4151, 4152, 4148,
+    4147, 4153, 4151,
+    4153, 4147, 4091,
+    4153, 4091, 4090,
+    4154, 4153, 4090,
+    4154, 4090, 3209,
+    3208, 4154, 3209,
+    4153, 4154, 4155,
+    4153, 4155, 4151,
+    4154, 3208, 4156,
+    4154, 4156, 4155,
+    3208, 3155, 4156,
+    3153, 4156, 3155,
+    4157, 4155, 4156,
+    3153, 4157, 4156,
+    4158, 4151, 4155,
+    4157, 4158, 4155,
+    4151, 4158, 4152,
+    4157, 3153, 4159,
+    3153, 3149, 4159,
+    3150, 4159, 3149,
+    3150, 4160, 4159,
+    4157, 4159, 4161,
+    4160, 4161, 4159,
+    4158, 4157, 4161,
+    4161, 4160, 4162,
+    4160, 4163, 4162,
+    4158, 4161, 4164,
+    4161, 4162, 4164,
+    4158, 4164, 4152,
+    4165, 4162, 4163,
+    4166, 4165, 4163,
+    4167, 4164, 4162,
+    4165, 4167, 4162,
+    4168, 4152, 4164,
+    4167, 4168, 4164,
+    4168, 4150, 4152,
+    4167, 4165, 4169,
+    4150, 4168, 4170,
+    4150, 4170, 4149,
+    4168, 4167, 4171,
+    4168, 4171, 4170,
+    4167, 4169, 4171,
+    4172, 4149, 4170,
+    4172, 4142, 4149,
+    4173, 4170, 4171,
+    4173, 4172, 4170,
+    4142, 4172, 4174,
+    4142, 4174, 4138,
+    4136, 4138, 4174,
+    4172, 4175, 4174,
+    4172, 4173, 4175,
+    4176, 4136, 4174,
+    4176, 4174, 4175,
+    4176, 4134, 4136,
+    4134, 4176, 4177,
+    4134, 4177, 4135,
+    4178, 4135, 4177,
+    4176, 4179, 4177,
+    4179, 4176, 4175,
+    4180, 4178, 4177,
+    4180, 4177, 4179,
+    4178, 4180, 4181,
+    4179, 4175, 4182,
+    4173, 4182, 4175,
+    4183, 4180, 4179,
+    4183, 4179, 4182,
+    4180, 4184, 4181,
+    4180, 4183, 4184,
+    4185, 4181, 4184,
+    4186, 4185, 4184,
+    4185, 4186, 4187,
+    4183, 4188, 4184,
+    4186, 4184, 4188,
+    4188, 4183, 4189,
+    4183, 4182, 4189,
+    4190, 4186, 4188,
+    4191, 4189, 4182,
+    4173, 4191, 4182,
+    4191, 4173, 4171,
+    4191, 4171, 4169,
+    4191, 4192, 4189,
+    4192, 4191, 4169,
+    4188, 4189, 4193,
+    4192, 4193, 4189,
+    4190, 4188, 4193,
+    4192, 4169, 4194,
+    4165, 4194, 4169,
+    4165, 4166, 4194,
+    4166, 4195, 4194,
+    4196, 4192, 4194,
+    4196, 4194, 4195,
+    4192, 4196, 4193,
+    4197, 4196, 4195,
+    4196, 4198, 4193,
+    4196, 4197, 4198,
+    4190, 4193, 4198,
+    4197, 4187, 4198,
+    4186, 4190, 4198,
+    4186, 4198, 4187,
+    4199, 4200, 4201,
+    4200, 4202, 4201,
+    4203, 4201, 4202,
+    4199, 4204, 4200,
+    4205, 4203, 4202,
+    4203, 4205, 4206,
+    4200, 4207, 4202,
+    4205, 4208, 4206,
+    4209, 4206, 4208,
+    4210, 4209, 4208,
+    4210, 4208, 4211,
+    4212, 4210, 4211,
+    4205, 4213, 4208,
+    4213, 4211, 4208,
+    4213, 4205, 4214,
+    4205, 4202, 4214,
+    4207, 4214, 4202,
+    4213, 4215, 4211,
+    4213, 4214, 4216,
+    4215, 4213, 4216,
+    4207, 4217, 4214,
+    4217, 4216, 4214,
+    4215, 4218, 4211,
+    4212, 4211, 4218,
+    4215, 4216, 4219,
+    4220, 4212, 4218,
+    4212, 4220, 4221,
+    4215, 4222, 4218,
+    4222, 4215, 4219,
+    4220, 4218, 4223,
+    4222, 4223, 4218,
+    4220, 4224, 4221,
+    4225, 4221, 4224,
+    4226, 4225, 4224,
+    4220, 4227, 4224,
+    4227, 4220, 4223,
+    4226, 4224, 4228,
+    4227, 4228, 4224,
+    4229, 4226, 4228,
+    4227, 4230, 4228,
+    4229, 4228, 4231,
+    4230, 4231, 4228,
+    4232, 4229, 4231,
+    4229, 4232, 4233,
+    4230, 4234, 4231,
+    4232, 4235, 4233,
+    4236, 4233, 4235,
+    4237, 4236, 4235,
+    4237, 4235, 4238,
+    4239, 4237, 4238,
+    4239, 4238, 4240,
+    4241, 4238, 4235,
+    4232, 4241, 4235,
+    4238, 4242, 4240,
+    4238, 4241, 4242,
+    4243, 4240, 4242,
+    4241, 4232, 4244,
+    4232, 4231, 4244,
+    4234, 4244, 4231,
+    4241, 4244, 4245,
+    4241, 4245, 4242,
+    4244, 4234, 4246,
+    4244, 4246, 4245,
+    4247, 4242, 4245,
+    4247, 4243, 4242,
+    4248, 4245, 4246,
+    4248, 4247, 4245,
+    4243, 4247, 4249,
+    4250, 4243, 4249,
+    4248, 4251, 4247,
+    4251, 4249, 4247,
+    4250, 4249, 4252,
+    4253, 4250, 4252,
+    4253, 4252, 4254,
+    4255, 4252, 4249,
+    4251, 4255, 4249,
+    4252, 4256, 4254,
+    4252, 4255, 4256,
+    4257, 4254, 4256,
+    4255, 4251, 4258,
+    4255, 4259, 4256,
+    4255, 4258, 4259,
+    4260, 4257, 4256,
+    4260, 4256, 4259,
+    4257, 4260, 4261,
+    4262, 4257, 4261,
+    4263, 4260, 4259,
+    4262, 4261, 4264,
+    4265, 4262, 4264,
+    4265, 4264, 4266,
+    4267, 4261, 4260,
+    4263, 4267, 4260,
+    4268, 4264, 4261,
+    4267, 4268, 4261,
+    4264, 4269, 4266,
+    4264, 4268, 4269,
+    4270, 4266, 4269,
+    4271, 4270, 4269,
+    4270, 4271, 4272,
+    4271, 4269, 4273,
+    4268, 4273, 4269,
+    4271, 4274, 4272,
+    4275, 4272, 4274,
+    4276, 4271, 4273,
+    4271, 4276, 4274,
+    4276, 4273, 4277,
+    4276, 4278, 4274,
+    4276, 4277, 4278,
+    4279, 4275, 4274,
+    4279, 4274, 4278,
+    4275, 4279, 4280,
+    4281, 4275, 4280,
+    4282, 4279, 4278,
+    4281, 4280, 4283,
+    4284, 4281, 4283,
+    4285, 4280, 4279,
+    4282, 4285, 4279,
+    4285, 4286, 4280,
+    4286, 4283, 4280,
+    4282, 4287, 4285,
+    4286, 4285, 4288,
+    4287, 4288, 4285,
+    4289, 4286, 4288,
+    4289, 4288, 4287,
+    4286, 4290, 4283,
+    4286, 4289, 4291,
+    4290, 4286, 4291,
+    4290, 4292, 4283,
+    4284, 4283, 4292,
+    4293, 4284, 4292,
+    4293, 4292, 4294,
+    4295, 4293, 4294,
+    4290, 4296, 4292,
+    4296, 4294, 4292,
+    4296, 4290, 4297,
+    4290, 4291, 4297,
+    4296, 4298, 4294,
+    4296, 4297, 4299,
+    4298, 4296, 4299,
+    4298, 4300, 4294,
+    4295, 4294, 4300,
+    4298, 4299, 4301,
+    4302, 4295, 4300,
+    4295, 4302, 4303,
+    4298, 4304, 4300,
+    4304, 4298, 4301,
+    4302, 4300, 4305,
+    4304, 4305, 4300,
+    4302, 3388, 4303,
+    4306, 4303, 3388,
+    4302, 3389, 3388,
+    3389, 4302, 4305,
+    3385, 4306, 3388,
+    3389, 4305, 4307,
+    3389, 4307, 3391,
+    4306, 3385, 4308,
+    3382, 4308, 3385,
+    3382, 3347, 4308,
+    4309, 4306, 4308,
+    4306, 4309, 4310,
+    3347, 4311, 4308,
+    4309, 4308, 4311,
+    4311, 3347, 3345,
+    4309, 4312, 4310,
+    4313, 4310, 4312,
+    4314, 4313, 4312,
+    4315, 4309, 4311,
+    4309, 4315, 4312,
+    4315, 4311, 4316,
+    4315, 4316, 4312,
+    4314, 4312, 4316,
+    4311, 3345, 4316,
+    3346, 4314, 4316,
+    3346, 4316, 3345,
+    4217, 4317, 4216,
+    4317, 4219, 4216,
+    4317, 4217, 4318,
+    4317, 4319, 4219,
+    4320, 4318, 4217,
+    4207, 4320, 4217,
+    4321, 4317, 4318,
+    4317, 4321, 4319,
+    4320, 4207, 4322,
+    4207, 4200, 4322,
+    4204, 4322, 4200,
+    4320, 4322, 4323,
+    4204, 4324, 4322,
+    4324, 4323, 4322,
+    4325, 4320, 4323,
+    4320, 4325, 4318,
+    4323, 4324, 4326,
+    4325, 4327, 4318,
+    4321, 4318, 4327,
+    4325, 4323, 4328,
+    4323, 4326, 4328,
+    4325, 4328, 4329,
+    4327, 4325, 4329,
+    4330, 4328, 4326,
+    4331, 4329, 4328,
+    4330, 4331, 4328,
+    4327, 4329, 4332,
+    4331, 4333, 4329,
+    4333, 4332, 4329,
+    4334, 4327, 4332,
+    4334, 4321, 4327,
+    4333, 4335, 4332,
+    4321, 4334, 4336,
+    4321, 4336, 4319,
+    4334, 4332, 4337,
+    4335, 4337, 4332,
+    4334, 4338, 4336,
+    4338, 4334, 4337,
+    4339, 4336, 4338,
+    4338, 4337, 4340,
+    4339, 4341, 4336,
+    4341, 4319, 4336,
+    4342, 4339, 4338,
+    4342, 4338, 4340,
+    4339, 4342, 4343,
+    4344, 4340, 4337,
+    4335, 4344, 4337,
+    4342, 4340, 4345,
+    4344, 4346, 4340,
+    4346, 4345, 4340,
+    4344, 4335, 4347,
+    4346, 4344, 4347,
+    4348, 4347, 4335,
+    4333, 4348, 4335,
+    4346, 4347, 4349,
+    4333, 4350, 4348,
+    4348, 4351, 4347,
+    4351, 4349, 4347,
+    4350, 4352, 4348,
+    4351, 4348, 4352,
+    4350, 4333, 4353,
+    4333, 4331, 4353,
+    4354, 4353, 4331,
+    4330, 4354, 4331,
+    4350, 4353, 4355,
+    4354, 4356, 4353,
+    4356, 4355, 4353,
+    4354, 4330, 4357,
+    4356, 4354, 4358,
+    4354, 4357, 4358,
+    4356, 4359, 4355,
+    4356, 4358, 4359,
+    4360, 4350, 4355,
+    4350, 4360, 4352,
+    4360, 4355, 4361,
+    4359, 4361, 4355,
+    4360, 4362, 4352,
+    4363, 4360, 4361,
+    4360, 4363, 4362,
+    4364, 4352, 4362,
+    4364, 4351, 4352,
+    4363, 4365, 4362,
+    4366, 4364, 4362,
+    4366, 4362, 4365,
+    4351, 4364, 4367,
+    4366, 4368, 4364,
+    4368, 4367, 4364,
+    4369, 4351, 4367,
+    4351, 4369, 4349,
+    4368, 4370, 4367,
+    4369, 4367, 4371,
+    4370, 4371, 4367,
+    4369, 4372, 4349,
+    4373, 4369, 4371,
+    4369, 4373, 4372,
+    4374, 4349, 4372,
+    4374, 4346, 4349,
+    4346, 4374, 4345,
+    4375, 4374, 4372,
+    4374, 4376, 4345,
+    4374, 4375, 4376,
+    4377, 4345, 4376,
+    4377, 4342, 4345,
+    4342, 4377, 4343,
+    4378, 4377, 4376,
+    4379, 4343, 4377,
+    4378, 4379, 4377,
+    4378, 4376, 4380,
+    4375, 4380, 4376,
+    4379, 4378, 4381,
+    4382, 4378, 4380,
+    4378, 4382, 4381,
+    4375, 4383, 4380,
+    4382, 4380, 4384,
+    4383, 4384, 4380,
+    4383, 4375, 4385,
+    4375, 4372, 4385,
+    4373, 4385, 4372,
+    4383, 4385, 1322,
+    4383, 1322, 1320,
+    4384, 4383, 1320,
+    4385, 1324, 1322,
+    4385, 4373, 1324,
+    4384, 1320, 1317,
+    4373, 4386, 1324,
+    4373, 4371, 4386,
+    1326, 1324, 4386,
+    4387, 4384, 1317,
+    4387, 4382, 4384,
+    4387, 1317, 1316,
+    4387, 4388, 4382,
+    4388, 4387, 1316,
+    4388, 4381, 4382,
+    4388, 1316, 4389,
+    1312, 4389, 1316,
+    4388, 4390, 4381,
+    4390, 4388, 4389,
+    1312, 4391, 4389,
+    1312, 1309, 4391,
+    1309, 1275, 4391,
+    1273, 4391, 1275,
+    4391, 4392, 4389,
+    4391, 1273, 4392,
+    4390, 4389, 4392,
+    1273, 1272, 4392,
+    4393, 4392, 1272,
+    4393, 4390, 4392,
+    1270, 4393, 1272,
+    4390, 4393, 4394,
+    4390, 4394, 4381,
+    4379, 4381, 4394,
+    4393, 1270, 4395,
+    4393, 4395, 4394,
+    4396, 4379, 4394,
+    4396, 4394, 4395,
+    4379, 4396, 4343,
+    1270, 4397, 4395,
+    1270, 1267, 4397,
+    1267, 1263, 4397,
+    4398, 4395, 4397,
+    4398, 4396, 4395,
+    4399, 4397, 1263,
+    4399, 4398, 4397,
+    1260, 4399, 1263,
+    4396, 4398, 4400,
+    4396, 4400, 4343,
+    4339, 4343, 4400,
+    4341, 4339, 4400,
+    4398, 4401, 4400,
+    4341, 4400, 4401,
+    4398, 4399, 4401,
+    4399, 4402, 4401,
+    4399, 1260, 4402,
+    1260, 1261, 4402,
+    4403, 4401, 4402,
+    4403, 4341, 4401,
+    4404, 4402, 1261,
+    4404, 4403, 4402,
+    1262, 4404, 1261,
+    4341, 4403, 4405,
+    4403, 4404, 4406,
+    4403, 4406, 4405,
+    4404, 1262, 4407,
+    4404, 4407, 4406,
+    1262, 4408, 4407,
+    1262, 1264, 4408,
+    4409, 4406, 4407,
+    4410, 4407, 4408,
+    4410, 4409, 4407,
+    4409, 4411, 4406,
+    4411, 4405, 4406,
+    4410, 4412, 4409,
+    4411, 4409, 4413,
+    4412, 4413, 4409,
+    4411, 4414, 4405,
+    4412, 4415, 4413,
+    4416, 4411, 4413,
+    4415, 4417, 4413,
+    4416, 4413, 4417,
+    4411, 4416, 4418,
+    4414, 4411, 4418,
+    4234, 4416, 4417,
+    4234, 4230, 4416,
+    4230, 4418, 4416,
+    4234, 4417, 4246,
+    4230, 4227, 4418,
+    4227, 4223, 4418,
+    4414, 4418, 4223,
+    4222, 4414, 4223,
+    4414, 4222, 4419,
+    4414, 4419, 4405,
+    4222, 4219, 4419,
+    4341, 4405, 4419,
+    4319, 4419, 4219,
+    4319, 4341, 4419,
+    4420, 4246, 4417,
+    4420, 4248, 4246,
+    4415, 4420, 4417,
+    4248, 4420, 4421,
+    4251, 4248, 4421,
+    4251, 4421, 4258,
+    4415, 4422, 4420,
+    4422, 4421, 4420,
+    4422, 4415, 4423,
+    4415, 4412, 4423,
+    4422, 4424, 4421,
+    4424, 4258, 4421,
+    4424, 4422, 4425,
+    4422, 4423, 4425,
+    4258, 4424, 4426,
+    4258, 4426, 4259,
+    4263, 4259, 4426,
+    4424, 4427, 4426,
+    4424, 4425, 4427,
+    4428, 4263, 4426,
+    4428, 4426, 4427,
+    4263, 4428, 4429,
+    4267, 4263, 4429,
+    4430, 4428, 4427,
+    4267, 4429, 4431,
+    4268, 4267, 4431,
+    4432, 4429, 4428,
+    4430, 4432, 4428,
+    4432, 4433, 4429,
+    4433, 4431, 4429,
+    4433, 4432, 4434,
+    4433, 4435, 4431,
+    4433, 4434, 4435,
+    4268, 4431, 4436,
+    4435, 4436, 4431,
+    4273, 4268, 4436,
+    4273, 4436, 4277,
+    4435, 4437, 4436,
+    4437, 4277, 4436,
+    4437, 4435, 4438,
+    4434, 4438, 4435,
+    4277, 4437, 4439,
+    4277, 4439, 4278,
+    4282, 4278, 4439,
+    4287, 4282, 4439,
+    4287, 4439, 4440,
+    4437, 4440, 4439,
+    4441, 4287, 4440,
+    4441, 4289, 4287,
+    4441, 4442, 4289,
+    4441, 4440, 4442,
+    4442, 4291, 4289,
+    4440, 4443, 4442,
+    4440, 4437, 4443,
+    4442, 4444, 4291,
+    4444, 4442, 4443,
+    4444, 4297, 4291,
+    4437, 4445, 4443,
+    4445, 4437, 4438,
+    4446, 4444, 4443,
+    4446, 4443, 4445,
+    4444, 4447, 4297,
+    4447, 4299, 4297,
+    4444, 4446, 4448,
+    4447, 4444, 4448,
+    4447, 4449, 4299,
+    4449, 4301, 4299,
+    4447, 4448, 4450,
+    4449, 4447, 4450,
+    4449, 4451, 4301,
+    4449, 4450, 4452,
+    4451, 4449, 4452,
+    4451, 4453, 4301,
+    4304, 4301, 4453,
+    4451, 4454, 4453,
+    4454, 4451, 4455,
+    4451, 4452, 4455,
+    4454, 4456, 4453,
+    4454, 4455, 4456,
+    4457, 4304, 4453,
+    4457, 4453, 4456,
+    4304, 4457, 4458,
+    4305, 4304, 4458,
+    4305, 4458, 4307,
+    4459, 4307, 4458,
+    4460, 4458, 4457,
+    4460, 4459, 4458,
+    4459, 4461, 4307,
+    4459, 4460, 4461,
+    4461, 3391, 4307,
+    4461, 3393, 3391,
+    4460, 4462, 4461,
+    3393, 4461, 4462,
+    4463, 4460, 4457,
+    4460, 4463, 4462,
+    4463, 4457, 4456,
+    4464, 3393, 4462,
+    3393, 4464, 3395,
+    4463, 4465, 4462,
+    4464, 4462, 4465,
+    4463, 4456, 4466,
+    4465, 4463, 4466,
+    4455, 4466, 4456,
+    4467, 4464, 4465,
+    4455, 4468, 4466,
+    4468, 4455, 4452,
+    4465, 4466, 4469,
+    4468, 4469, 4466,
+    4467, 4465, 4469,
+    4470, 4468, 4452,
+    4470, 4452, 4450,
+    4468, 4471, 4469,
+    4468, 4470, 4471,
+    4471, 4472, 4469,
+    4467, 4469, 4472,
+    4470, 4473, 4471,
+    4474, 4470, 4450,
+    4470, 4474, 4473,
+    4474, 4450, 4448,
+    4475, 4474, 4448,
+    4475, 4448, 4446,
+    4474, 4475, 4476,
+    4474, 4476, 4473,
+    4477, 4475, 4446,
+    4477, 4446, 4445,
+    4475, 4477, 4478,
+    4475, 4478, 4476,
+    4477, 4445, 4479,
+    4477, 4479, 4478,
+    4445, 4438, 4479,
+    4480, 4479, 4438,
+    4434, 4480, 4438,
+    4481, 4478, 4479,
+    4480, 4481, 4479,
+    4480, 4434, 4482,
+    4432, 4482, 4434,
+    4432, 4430, 4482,
+    4483, 4480, 4482,
+    4480, 4483, 4481,
+    4430, 4484, 4482,
+    4483, 4482, 4484,
+    4484, 4430, 4485,
+    4430, 4427, 4485,
+    4425, 4485, 4427,
+    4425, 4486, 4485,
+    4486, 4425, 4423,
+    4484, 4485, 4487,
+    4486, 4487, 4485,
+    4488, 4484, 4487,
+    4488, 4483, 4484,
+    4486, 4489, 4487,
+    4483, 4488, 4490,
+    4483, 4490, 4481,
+    4488, 4487, 4491,
+    4489, 4491, 4487,
+    4488, 4492, 4490,
+    4492, 4488, 4491,
+    4493, 4481, 4490,
+    4481, 4493, 4478,
+    4493, 4476, 4478,
+    4494, 4490, 4492,
+    4494, 4493, 4490,
+    4493, 4495, 4476,
+    4495, 4473, 4476,
+    4493, 4494, 4496,
+    4495, 4497, 4473,
+    4497, 4471, 4473,
+    4471, 4497, 4472,
+    4495, 4493, 4498,
+    4493, 4496, 4498,
+    4497, 4495, 4499,
+    4495, 4498, 4499,
+    4497, 4499, 4500,
+    4501, 4499, 4498,
+    4502, 4497, 4500,
+    4497, 4502, 4472,
+    4503, 4500, 4499,
+    4501, 4503, 4499,
+    4503, 4504, 4500,
+    4504, 4505, 4500,
+    4502, 4500, 4505,
+    4504, 4503, 4506,
+    4507, 4472, 4502,
+    4507, 4467, 4472,
+    4508, 4507, 4502,
+    4508, 4502, 4505,
+    4467, 4507, 4509,
+    4464, 4467, 4509,
+    4464, 4509, 3395,
+    3396, 3395, 4509,
+    4510, 4509, 4507,
+    4510, 3396, 4509,
+    4508, 4510, 4507,
+    3396, 4510, 4511,
+    3397, 3396, 4511,
+    3397, 4511, 3399,
+    4508, 4512, 4510,
+    4512, 4511, 4510,
+    4513, 3399, 4511,
+    4512, 4513, 4511,
+    3399, 4513, 3402,
+    4513, 3438, 3402,
+    4512, 4508, 4514,
+    4508, 4505, 4514,
+    4513, 4512, 4515,
+    4512, 4514, 4515,
+    3438, 4513, 4516,
+    4513, 4515, 4516,
+    3438, 4516, 4517,
+    3440, 3438, 4517,
+    4518, 4516, 4515,
+    3440, 4517, 4519,
+    3451, 3440, 4519,
+    4520, 4517, 4516,
+    4518, 4520, 4516,
+    4520, 4521, 4517,
+    4521, 4519, 4517,
+    4520, 4518, 4522,
+    4521, 4520, 4522,
+    4523, 4518, 4515,
+    4523, 4515, 4514,
+    4523, 4524, 4518,
+    4524, 4522, 4518,
+    4525, 4523, 4514,
+    4523, 4525, 4524,
+    4525, 4514, 4505,
+    4504, 4525, 4505,
+    4525, 4504, 4506,
+    4525, 4506, 4524,
+    4526, 4524, 4506,
+    4524, 4526, 4522,
+    4527, 4526, 4506,
+    4527, 4506, 4503,
+    4501, 4527, 4503,
+    4526, 4528, 4522,
+    4521, 4522, 4528,
+    4526, 4527, 4529,
+    4526, 4529, 4528,
+    4527, 4501, 4530,
+    4527, 4530, 4529,
+    4501, 4531, 4530,
+    4531, 4501, 4498,
+    4531, 4498, 4496,
+    4532, 4531, 4496,
+    4533, 4530, 4531,
+    4532, 4533, 4531,
+    4532, 4496, 4534,
+    4533, 4532, 4534,
+    4494, 4534, 4496,
+    4533, 4535, 4530,
+    4535, 4529, 4530,
+    4533, 4534, 4536,
+    4535, 4533, 4536,
+    4494, 4537, 4534,
+    4537, 4536, 4534,
+    4537, 4494, 4492,
+    4537, 4492, 4538,
+    4537, 4538, 4536,
+    4492, 4491, 4538,
+    4538, 4539, 4536,
+    4535, 4536, 4539,
+    4540, 4538, 4491,
+    4538, 4540, 4539,
+    4489, 4540, 4491,
+    4541, 4535, 4539,
+    4540, 4542, 4539,
+    4541, 4539, 4542,
+    4535, 4541, 4543,
+    4529, 4535, 4543,
+    4529, 4543, 4528,
+    4544, 4528, 4543,
+    4544, 4521, 4528,
+    4521, 4544, 4519,
+    4545, 4544, 4543,
+    4545, 4543, 4541,
+    4544, 4546, 4519,
+    4544, 4545, 4546,
+    3451, 4519, 4546,
+    4547, 4545, 4541,
+    4547, 4541, 4542,
+    4545, 4547, 4548,
+    4547, 4542, 4548,
+    4545, 4548, 4546,
+    4549, 3451, 4546,
+    4549, 4546, 4548,
+    4549, 3449, 3451,
+    4550, 4548, 4542,
+    4550, 4549, 4548,
+    4540, 4550, 4542,
+    3449, 4549, 4551,
+    4549, 4550, 4551,
+    4540, 4552, 4550,
+    4552, 4551, 4550,
+    4552, 4540, 4553,
+    4540, 4489, 4553,
+    4552, 4554, 4551,
+    4555, 4553, 4489,
+    4486, 4555, 4489,
+    4555, 4486, 4423,
+    4555, 4423, 4412,
+    4410, 4555, 4412,
+    4555, 4410, 4553,
+    4410, 4556, 4553,
+    4552, 4553, 4556,
+    4556, 4410, 4408,
+    4554, 4552, 4556,
+    4556, 4408, 4557,
+    4554, 4556, 4557,
+    1264, 4557, 4408,
+    1264, 4558, 4557,
+    4558, 1264, 1258,
+    4554, 4557, 4559,
+    4558, 4559, 4557,
+    4560, 4554, 4559,
+    4554, 4560, 4551,
+    3449, 4551, 4560,
+    3448, 3449, 4560,
+    3448, 4560, 4561,
+    4560, 4559, 4561,
+    3448, 4561, 3447,
+    4562, 4561, 4559,
+    4558, 4562, 4559,
+    4563, 3447, 4561,
+    4562, 4563, 4561,
+    4563, 3450, 3447,
+    4562, 4558, 4564,
+    4558, 1258, 4564,
+    1256, 4564, 1258,
+    4563, 4562, 4565,
+    4562, 4564, 4565,
+    1256, 4566, 4564,
+    4566, 4565, 4564,
+    4566, 1256, 1252,
+    4563, 4565, 4567,
+    3450, 4563, 4567,
+    3450, 4567, 3454,
+    4566, 4568, 4565,
+    4568, 4567, 4565,
+    4566, 1252, 4569,
+    4568, 4566, 4569,
+    1246, 4569, 1252,
+    4568, 4570, 4567,
+    4570, 3454, 4567,
+    4568, 4569, 308,
+    4570, 4568, 308,
+    306, 308, 4569,
+    1246, 306, 4569,
+    4570, 308, 302,
+    306, 1246, 1244,
+    306, 1244, 305,
+    4571, 4570, 302,
+    4570, 4571, 3454,
+    4571, 302, 300,
+    4571, 3456, 3454,
+    3459, 4571, 300,
+    4571, 3459, 3456,
+    4572, 305, 1244,
+    1241, 4572, 1244,
+    4572, 304, 305,
+    4572, 1241, 1240,
+    4572, 4573, 304,
+    4573, 4572, 1240,
+    4573, 307, 304,
+    4573, 1240, 1238,
+    4573, 4574, 307,
+    4574, 4573, 1238,
+    4574, 310, 307,
+    4574, 1238, 4575,
+    1236, 4575, 1238,
+    4574, 4576, 310,
+    4576, 4574, 4575,
+    1236, 4577, 4575,
+    4577, 1236, 1203,
+    4577, 1203, 1204,
+    4577, 4578, 4575,
+    4576, 4575, 4578,
+    4579, 4577, 1204,
+    4577, 4579, 4578,
+    4579, 1204, 1205,
+    4580, 4576, 4578,
+    4579, 4581, 4578,
+    4580, 4578, 4581,
+    4582, 4579, 1205,
+    4579, 4582, 4581,
+    4582, 1205, 4583,
+    1207, 4583, 1205,
+    4582, 4584, 4581,
+    4585, 4582, 4583,
+    4582, 4585, 4584,
+    1207, 4586, 4583,
+    4585, 4583, 4587,
+    4586, 4587, 4583,
+    4586, 1207, 4588,
+    1207, 1200, 4588,
+    4587, 4586, 4589,
+    4590, 4588, 1200,
+    1192, 4590, 1200,
+    4590, 1192, 1194,
+    4586, 4588, 4591,
+    4586, 4591, 4589,
+    4588, 4590, 4592,
+    4588, 4592, 4591,
+    4590, 1194, 4593,
+    4590, 4593, 4592,
+    1194, 1196, 4593,
+    4594, 4592, 4593,
+    4595, 4593, 1196,
+    4595, 4594, 4593,
+    4594, 4596, 4592,
+    4596, 4591, 4592,
+    4596, 4597, 4591,
+    4597, 4589, 4591,
+    4596, 4594, 4598,
+    4596, 4599, 4597,
+    4599, 4596, 4598,
+    4600, 4598, 4594,
+    4595, 4600, 4594,
+    4600, 4601, 4598,
+    4601, 4602, 4598,
+    4599, 4598, 4602,
+    4601, 4600, 4603,
+    4601, 4603, 4602,
+    4600, 4604, 4603,
+    4600, 4595, 4604,
+    4603, 4605, 4602,
+    4606, 4599, 4602,
+    4606, 4602, 4605,
+    4599, 4606, 4607,
+    4599, 4607, 4597,
+    4608, 4606, 4605,
+    4606, 4609, 4607,
+    4606, 4608, 4609,
+    4610, 4597, 4607,
+    4597, 4610, 4589,
+    4611, 4607, 4609,
+    4611, 4610, 4607,
+    4612, 4611, 4609,
+    4610, 4613, 4589,
+    4587, 4589, 4613,
+    4614, 4587, 4613,
+    4614, 4585, 4587,
+    4585, 4614, 4615,
+    4585, 4615, 4584,
+    4614, 4613, 4616,
+    4614, 4616, 4615,
+    4613, 4617, 4616,
+    4613, 4610, 4617,
+    4618, 4615, 4616,
+    4619, 4616, 4617,
+    4619, 4618, 4616,
+    4618, 4620, 4615,
+    4620, 4584, 4615,
+    4618, 4619, 4621,
+    4620, 4622, 4584,
+    4622, 4581, 4584,
+    4622, 4580, 4581,
+    4620, 4618, 4623,
+    4618, 4621, 4623,
+    4622, 4620, 4624,
+    4620, 4623, 4624,
+    4580, 4622, 4625,
+    4622, 4624, 4625,
+    4580, 4625, 4626,
+    4576, 4580, 4626,
+    4576, 4626, 310,
+    312, 310, 4626,
+    4627, 312, 4626,
+    4627, 4626, 4625,
+    312, 4627, 311,
+    4627, 315, 311,
+    4628, 4627, 4625,
+    4627, 4628, 315,
+    4628, 4625, 4624,
+    4628, 317, 315,
+    4629, 4628, 4624,
+    4628, 4629, 317,
+    4629, 4624, 4623,
+    4629, 319, 317,
+    4630, 4629, 4623,
+    4629, 4630, 319,
+    4630, 4623, 4621,
+    4630, 321, 319,
+    321, 4630, 4631,
+    321, 4631, 323,
+    4632, 4630, 4621,
+    4630, 4632, 4631,
+    4632, 4621, 4633,
+    4619, 4633, 4621,
+    4634, 4631, 4632,
+    4619, 4635, 4633,
+    4635, 4619, 4617,
+    4636, 4632, 4633,
+    4636, 4634, 4632,
+    4635, 4637, 4633,
+    4636, 4633, 4637,
+    4635, 4617, 4638,
+    4610, 4638, 4617,
+    4639, 4635, 4638,
+    4635, 4639, 4637,
+    4610, 4640, 4638,
+    4610, 4611, 4640,
+    4639, 4638, 4641,
+    4640, 4641, 4638,
+    4611, 4642, 4640,
+    4611, 4612, 4642,
+    4640, 4643, 4641,
+    4643, 4640, 4642,
+    4644, 4639, 4641,
+    4643, 4645, 4641,
+    4644, 4641, 4645,
+    4639, 4644, 4646,
+    4639, 4646, 4637,
+    1004, 4637, 4646,
+    1004, 4636, 4637,
+    1002, 1004, 4646,
+    4636, 1004, 1003,
+    4634, 4636, 1003,
+    1002, 4646, 4647,
+    4644, 4647, 4646,
+    1005, 1002, 4647,
+    1005, 4647, 1009,
+    4644, 4648, 4647,
+    4648, 1009, 4647,
+    4648, 4644, 4645,
+    1009, 4648, 4649,
+    1009, 4649, 1011,
+    4648, 4645, 4650,
+    4648, 4650, 4649,
+    4645, 4651, 4650,
+    4645, 4643, 4651,
+    4652, 4649, 4650,
+    4653, 1011, 4649,
+    4652, 4653, 4649,
+    4653, 1012, 1011,
+    1012, 4653, 1046,
+    4653, 4654, 1046,
+    4653, 4652, 4654,
+    1047, 1046, 4654,
+    1050, 1047, 4654,
+    1050, 4654, 4655,
+    4652, 4655, 4654,
+    1058, 1050, 4655,
+    4652, 4656, 4655,
+    4656, 4652, 4650,
+    1058, 4655, 4657,
+    4656, 4657, 4655,
+    1061, 1058, 4657,
+    4656, 4650, 4651,
+    1061, 4657, 4658,
+    1061, 4658, 1066,
+    4657, 4656, 4659,
+    4657, 4659, 4658,
+    4656, 4660, 4659,
+    4660, 4656, 4651,
+    4661, 4658, 4659,
+    4660, 4651, 4662,
+    4643, 4662, 4651,
+    4663, 4659, 4660,
+    4663, 4661, 4659,
+    4664, 4660, 4662,
+    4664, 4663, 4660,
+    4643, 4665, 4662,
+    4665, 4643, 4642,
+    4664, 4662, 4666,
+    4665, 4666, 4662,
+    4665, 4642, 4667,
+    4612, 4667, 4642,
+    4665, 4668, 4666,
+    4668, 4665, 4667,
+    4667, 4612, 4669,
+    4612, 4609, 4669,
+    4608, 4669, 4609,
+    4668, 4667, 4670,
+    4667, 4669, 4670,
+    4608, 4671, 4669,
+    4671, 4670, 4669,
+    4671, 4608, 4672,
+    4608, 4605, 4672,
+    4670, 4671, 4673,
+    4668, 4670, 4674,
+    4670, 4673, 4674,
+    4668, 4674, 4666,
+    4671, 4675, 4673,
+    4671, 4672, 4675,
+    4676, 4674, 4673,
+    4677, 4666, 4674,
+    4676, 4677, 4674,
+    4677, 4664, 4666,
+    4678, 4676, 4673,
+    4678, 4673, 4675,
+    4677, 4676, 4679,
+    4676, 4678, 4679,
+    4664, 4677, 4680,
+    4677, 4679, 4680,
+    4664, 4680, 4663,
+    4680, 4681, 4663,
+    4661, 4663, 4681,
+    4682, 4680, 4679,
+    4680, 4682, 4681,
+    4683, 4682, 4679,
+    4683, 4679, 4678,
+    4682, 4684, 4681,
+    4685, 4683, 4678,
+    4685, 4678, 4675,
+    4682, 4683, 4686,
+    4685, 4675, 4687,
+    4672, 4687, 4675,
+    4683, 4685, 4688,
+    4683, 4688, 4686,
+    4689, 4685, 4687,
+    4685, 4689, 4688,
+    4672, 4690, 4687,
+    4690, 4672, 4605,
+    4603, 4690, 4605,
+    4690, 4603, 4604,
+    4690, 4691, 4687,
+    4689, 4687, 4691,
+    4692, 4690, 4604,
+    4690, 4692, 4691,
+    4692, 4604, 4693,
+    4595, 4693, 4604,
+    4692, 4694, 4691,
+    4695, 4692, 4693,
+    4692, 4695, 4694,
+    4696, 4691, 4694,
+    4696, 4689, 4691,
+    4696, 4697, 4689,
+    4697, 4696, 4694,
+    4697, 4688, 4689,
+    4697, 4694, 4698,
+    4695, 4698, 4694,
+    4697, 4699, 4688,
+    4699, 4697, 4698,
+    4699, 4686, 4688,
+    4695, 4700, 4698,
+    4695, 4693, 4700,
+    4699, 4698, 4701,
+    4700, 4701, 4698,
+    4693, 4702, 4700,
+    4693, 4595, 4702,
+    4700, 4703, 4701,
+    4703, 4700, 4702,
+    4595, 4704, 4702,
+    4704, 4595, 1196,
+    4705, 4703, 4702,
+    4705, 4702, 4704,
+    4704, 1196, 4706,
+    1183, 4706, 1196,
+    1183, 1185, 4706,
+    4707, 4704, 4706,
+    4707, 4705, 4704,
+    1185, 4708, 4706,
+    4707, 4706, 4708,
+    1185, 1187, 4708,
+    4705, 4707, 4709,
+    4710, 4707, 4708,
+    4707, 4710, 4709,
+    4710, 4708, 4711,
+    1187, 4711, 4708,
+    4712, 4709, 4710,
+    4713, 4710, 4711,
+    4713, 4712, 4710,
+    1187, 4714, 4711,
+    4713, 4711, 4715,
+    4714, 4715, 4711,
+    1118, 4713, 4715,
+    1118, 4715, 1119,
+    1123, 1119, 4715,
+    4714, 1123, 4715,
+    4713, 1118, 4716,
+    1111, 4716, 1118,
+    4712, 4713, 4716,
+    1111, 1110, 4716,
+    1110, 4717, 4716,
+    4712, 4716, 4717,
+    4717, 1110, 1107,
+    4718, 4712, 4717,
+    4712, 4718, 4709,
+    4717, 1107, 4719,
+    4718, 4717, 4719,
+    4720, 4719, 1107,
+    1105, 4720, 1107,
+    4718, 4719, 4721,
+    4720, 1105, 4722,
+    1105, 1103, 4722,
+    4720, 4723, 4719,
+    4720, 4722, 4723,
+    4723, 4721, 4719,
+    4724, 4722, 1103,
+    1093, 4724, 1103,
+    4722, 4725, 4723,
+    4722, 4724, 4725,
+    4726, 4723, 4725,
+    4723, 4726, 4721,
+    4727, 4726, 4725,
+    4726, 4728, 4721,
+    4727, 4725, 4729,
+    4724, 4729, 4725,
+    4726, 4727, 4730,
+    4726, 4730, 4728,
+    4731, 4727, 4729,
+    4727, 4732, 4730,
+    4727, 4731, 4732,
+    4730, 4701, 4728,
+    4730, 4699, 4701,
+    4699, 4730, 4732,
+    4703, 4728, 4701,
+    4733, 4699, 4732,
+    4699, 4733, 4686,
+    4703, 4734, 4728,
+    4734, 4721, 4728,
+    4703, 4705, 4734,
+    4734, 4718, 4721,
+    4705, 4709, 4734,
+    4718, 4734, 4709,
+    4733, 4735, 4686,
+    4682, 4686, 4735,
+    4684, 4682, 4735,
+    4733, 4736, 4735,
+    4684, 4735, 4737,
+    4736, 4737, 4735,
+    4736, 4733, 4738,
+    4733, 4732, 4738,
+    4731, 4738, 4732,
+    4731, 4739, 4738,
+    4731, 4729, 4739,
+    4736, 4738, 4740,
+    4739, 4740, 4738,
+    4741, 4736, 4740,
+    4736, 4741, 4737,
+    4739, 4742, 4740,
+    4729, 4743, 4739,
+    4742, 4739, 4743,
+    4729, 4724, 4743,
+    4742, 4744, 4740,
+    4741, 4740, 4744,
+    4745, 4742, 4743,
+    4746, 4741, 4744,
+    4745, 4743, 4747,
+    4724, 4747, 4743,
+    4741, 4746, 4748,
+    4741, 4748, 4737,
+    4747, 4724, 4749,
+    4724, 1093, 4749,
+    1091, 4749, 1093,
+    1091, 1088, 4749,
+    4747, 4749, 4750,
+    1088, 4750, 4749,
+    4751, 4747, 4750,
+    4751, 4745, 4747,
+    4750, 1088, 4752,
+    1088, 1085, 4752,
+    4751, 4750, 4753,
+    4750, 4752, 4753,
+    4753, 4752, 1085,
+    4751, 4753, 4745,
+    1083, 4753, 1085,
+    4753, 4754, 4745,
+    4753, 1083, 4754,
+    4742, 4745, 4754,
+    1083, 1080, 4754,
+    4755, 4742, 4754,
+    4755, 4754, 1080,
+    4742, 4755, 4744,
+    1077, 4755, 1080,
+    4755, 4756, 4744,
+    4755, 1077, 4756,
+    4746, 4744, 4756,
+    1077, 1074, 4756,
+    4757, 4756, 1074,
+    4757, 4746, 4756,
+    1069, 4757, 1074,
+    4746, 4757, 4758,
+    4757, 1069, 4759,
+    4757, 4759, 4758,
+    1069, 1067, 4759,
+    4746, 4758, 4748,
+    1070, 4759, 1067,
+    4760, 4758, 4759,
+    1070, 4760, 4759,
+    4760, 4761, 4758,
+    4760, 1070, 4761,
+    4761, 4748, 4758,
+    1070, 4762, 4761,
+    1070, 1068, 4762,
+    4761, 4763, 4748,
+    4763, 4761, 4762,
+    4763, 4737, 4748,
+    4763, 4684, 4737,
+    4763, 4764, 4684,
+    4764, 4763, 4762,
+    4764, 4681, 4684,
+    4764, 4661, 4681,
+    4764, 4762, 4765,
+    4661, 4764, 4765,
+    1068, 4765, 4762,
+    4661, 4765, 4658,
+    4765, 1068, 1066,
+    4765, 1066, 4658,
+    4766, 4767, 4768,
+    4767, 4769, 4768,
+    4767, 4770, 4769,
+    4770, 4767, 4771,
+    4770, 4772, 4769,
+    4767, 4773, 4771,
+    4767, 4766, 4773,
+    4774, 4771, 4773,
+    4775, 4776, 4772,
+    4776, 4769, 4772,
+    4776, 4777, 4769,
+    4777, 4768, 4769,
+    4777, 4778, 4768,
+    4778, 4779, 4768,
+    4778, 4780, 4779,
+    4766, 4768, 4779,
+    4780, 4781, 4779,
+    4780, 4782, 4781,
+    4783, 4766, 4779,
+    4783, 4779, 4781,
+    4782, 4784, 4781,
+    4782, 4785, 4784,
+    4786, 4783, 4781,
+    4786, 4781, 4784,
+    4785, 4787, 4784,
+    4785, 4788, 4787,
+    4789, 4786, 4784,
+    4789, 4784, 4787,
+    4788, 4790, 4787,
+    4788, 4791, 4790,
+    4792, 4789, 4787,
+    4792, 4787, 4790,
+    4792, 4793, 4789,
+    4794, 4792, 4790,
+    4793, 4795, 4789,
+    4786, 4789, 4795,
+    4793, 4792, 4796,
+    4792, 4794, 4796,
+    4797, 4786, 4795,
+    4786, 4797, 4783,
+    4797, 4798, 4783,
+    4766, 4783, 4798,
+    4797, 4795, 4799,
+    4800, 4766, 4798,
+    4766, 4800, 4773,
+    4797, 4801, 4798,
+    4801, 4797, 4799,
+    4800, 4798, 4802,
+    4801, 4802, 4798,
+    4803, 4773, 4800,
+    4803, 4774, 4773,
+    4774, 4803, 4804,
+    4805, 4803, 4800,
+    4805, 4800, 4802,
+    4803, 4806, 4804,
+    4803, 4805, 4806,
+    4807, 4804, 4806,
+    4805, 4808, 4806,
+    4805, 4802, 4808,
+    4809, 4807, 4806,
+    4809, 4806, 4808,
+    4807, 4809, 4810,
+    4802, 4811, 4808,
+    4802, 4801, 4811,
+    4812, 4809, 4808,
+    4812, 4808, 4811,
+    4809, 4813, 4810,
+    4809, 4812, 4813,
+    4199, 4810, 4813,
+    4204, 4199, 4813,
+    4204, 4813, 4814,
+    4812, 4814, 4813,
+    4324, 4204, 4814,
+    4812, 4815, 4814,
+    4815, 4812, 4811,
+    4324, 4814, 4816,
+    4815, 4816, 4814,
+    4817, 4324, 4816,
+    4324, 4817, 4326,
+    4815, 4818, 4816,
+    4819, 4326, 4817,
+    4819, 4330, 4326,
+    4330, 4819, 4357,
+    4817, 4816, 4820,
+    4818, 4820, 4816,
+    4821, 4819, 4817,
+    4821, 4817, 4820,
+    4821, 4822, 4819,
+    4822, 4357, 4819,
+    4821, 4820, 4823,
+    4822, 4821, 4823,
+    4822, 4824, 4357,
+    4824, 4358, 4357,
+    4822, 4823, 4825,
+    4824, 4822, 4825,
+    4358, 4824, 4826,
+    4358, 4826, 4359,
+    4824, 4825, 4827,
+    4824, 4827, 4826,
+    4828, 4359, 4826,
+    4359, 4828, 4361,
+    4829, 4826, 4827,
+    4829, 4828, 4826,
+    4830, 4829, 4827,
+    4828, 4831, 4361,
+    4363, 4361, 4831,
+    4828, 4829, 4832,
+    4833, 4363, 4831,
+    4363, 4833, 4365,
+    4828, 4834, 4831,
+    4833, 4831, 4835,
+    4834, 4835, 4831,
+    4834, 4828, 4836,
+    4828, 4832, 4836,
+    4834, 4837, 4835,
+    4834, 4836, 4838,
+    4837, 4834, 4838,
+    4839, 4838, 4836,
+    4837, 4840, 4835,
+    4841, 4839, 4836,
+    4841, 4836, 4832,
+    4842, 4835, 4840,
+    4842, 4833, 4835,
+    4843, 4842, 4840,
+    4833, 4842, 4844,
+    4843, 4845, 4842,
+    4845, 4844, 4842,
+    4843, 4840, 4846,
+    4845, 4843, 4847,
+    4843, 4846, 4847,
+    4840, 4848, 4846,
+    4840, 4837, 4848,
+    4849, 4846, 4848,
+    4837, 4850, 4848,
+    4849, 4851, 4846,
+    4851, 4847, 4846,
+    4852, 4849, 4848,
+    4852, 4848, 4850,
+    4849, 4853, 4851,
+    4849, 4852, 4853,
+    4851, 4854, 4847,
+    4853, 4855, 4851,
+    4854, 4851, 4855,
+    4854, 4856, 4847,
+    4845, 4847, 4856,
+    4857, 4854, 4855,
+    4858, 4845, 4856,
+    4845, 4858, 4844,
+    4854, 4859, 4856,
+    4854, 4857, 4859,
+    4858, 4856, 4860,
+    4859, 4860, 4856,
+    4861, 4858, 4860,
+    4859, 4862, 4860,
+    4858, 4861, 4863,
+    4858, 4863, 4844,
+    4861, 4860, 4864,
+    4862, 4864, 4860,
+    4861, 4865, 4863,
+    4866, 4861, 4864,
+    4861, 4866, 4865,
+    4867, 4844, 4863,
+    4867, 4833, 4844,
+    4833, 4867, 4365,
+    4868, 4867, 4863,
+    4868, 4863, 4865,
+    4869, 4365, 4867,
+    4868, 4869, 4867,
+    4869, 4366, 4365,
+    4868, 4870, 4869,
+    4870, 4868, 4865,
+    4366, 4869, 4871,
+    4870, 4871, 4869,
+    4368, 4366, 4871,
+    4870, 4865, 4872,
+    4866, 4872, 4865,
+    4870, 4873, 4871,
+    4873, 4870, 4872,
+    4368, 4871, 4874,
+    4873, 4874, 4871,
+    4370, 4368, 4874,
+    4874, 4873, 4875,
+    4370, 4874, 4876,
+    4874, 4875, 4876,
+    4370, 4876, 4877,
+    4371, 4370, 4877,
+    4371, 4877, 4386,
+    4878, 4386, 4877,
+    4878, 1326, 4386,
+    4878, 1327, 1326,
+    4879, 4878, 4877,
+    4879, 4877, 4876,
+    1327, 4878, 4880,
+    4878, 4879, 4880,
+    1327, 4880, 1329,
+    4881, 4879, 4876,
+    4881, 4876, 4875,
+    4882, 4880, 4879,
+    4881, 4882, 4879,
+    4883, 1329, 4880,
+    4882, 4883, 4880,
+    1329, 4883, 1331,
+    4882, 4881, 4884,
+    4883, 4885, 1331,
+    1333, 1331, 4885,
+    4883, 4882, 4886,
+    4883, 4886, 4885,
+    4882, 4884, 4886,
+    4887, 1333, 4885,
+    4887, 1356, 1333,
+    1356, 4887, 1359,
+    4887, 4885, 4888,
+    4886, 4888, 4885,
+    4887, 4889, 1359,
+    4889, 4887, 4888,
+    4886, 4890, 4888,
+    4890, 4886, 4884,
+    4889, 4888, 4891,
+    4890, 4891, 4888,
+    4892, 1359, 4889,
+    4892, 1361, 1359,
+    1361, 4892, 1406,
+    4893, 4892, 4889,
+    4893, 4889, 4891,
+    4894, 1406, 4892,
+    4893, 4894, 4892,
+    4894, 4895, 1406,
+    4895, 1409, 1406,
+    4894, 4893, 4896,
+    4893, 4891, 4896,
+    4895, 4894, 4897,
+    4894, 4896, 4897,
+    4895, 4898, 1409,
+    4898, 1411, 1409,
+    4898, 4895, 4899,
+    4895, 4897, 4899,
+    4898, 4900, 1411,
+    4900, 1413, 1411,
+    4900, 4898, 4901,
+    4898, 4899, 4901,
+    1413, 4900, 4902,
+    1413, 4902, 1415,
+    4900, 4903, 4902,
+    4900, 4901, 4903,
+    4904, 1415, 4902,
+    1415, 4904, 1417,
+    4905, 4902, 4903,
+    4905, 4904, 4902,
+    4906, 4905, 4903,
+    4904, 4907, 1417,
+    1419, 1417, 4907,
+    4904, 4905, 4908,
+    4909, 1419, 4907,
+    1419, 4909, 1423,
+    4904, 4910, 4907,
+    4910, 4904, 4908,
+    4910, 4911, 4907,
+    4909, 4907, 4911,
+    4910, 4908, 4912,
+    4910, 4913, 4911,
+    4913, 4910, 4912,
+    4914, 4909, 4911,
+    4913, 4915, 4911,
+    4914, 4911, 4915,
+    4909, 4914, 4916,
+    4917, 4914, 4915,
+    4918, 4909, 4916,
+    4909, 4918, 1423,
+    4919, 4916, 4914,
+    4917, 4919, 4914,
+    4918, 4916, 4920,
+    4919, 4921, 4916,
+    4921, 4920, 4916,
+    4919, 4917, 4922,
+    4921, 4919, 4923,
+    4919, 4922, 4923,
+    4917, 4924, 4922,
+    4917, 4915, 4924,
+    4925, 4923, 4922,
+    4915, 4926, 4924,
+    4915, 4913, 4926,
+    4927, 4922, 4924,
+    4927, 4925, 4922,
+    4928, 4927, 4924,
+    4928, 4924, 4926,
+    4925, 4927, 4929,
+    4927, 4928, 4930,
+    4927, 4930, 4929,
+    4925, 4929, 4931,
+    4925, 4931, 4923,
+    4932, 4929, 4930,
+    4931, 4933, 4923,
+    4921, 4923, 4933,
+    4929, 4934, 4931,
+    4929, 4932, 4934,
+    4935, 4931, 4934,
+    4931, 4935, 4933,
+    4936, 4921, 4933,
+    4921, 4936, 4920,
+    4936, 4933, 4937,
+    4935, 4937, 4933,
+    4936, 4938, 4920,
+    4939, 4936, 4937,
+    4936, 4939, 4938,
+    4940, 4920, 4938,
+    4940, 4918, 4920,
+    4940, 4941, 4918,
+    4941, 1423, 4918,
+    4942, 4940, 4938,
+    4940, 4942, 4941,
+    4942, 4938, 4943,
+    4939, 4943, 4938,
+    4942, 4944, 4941,
+    4945, 4942, 4943,
+    4942, 4945, 4944,
+    4941, 4946, 1423,
+    4946, 4941, 4944,
+    4946, 1421, 1423,
+    1421, 4946, 1422,
+    4946, 4947, 1422,
+    1434, 1422, 4947,
+    4946, 4948, 4947,
+    4948, 4946, 4944,
+    4949, 1434, 4947,
+    4949, 1435, 1434,
+    4949, 4947, 4950,
+    4948, 4950, 4947,
+    4949, 4951, 1435,
+    4951, 4949, 4950,
+    4951, 1437, 1435,
+    4951, 4952, 1437,
+    4952, 1486, 1437,
+    4952, 4951, 4953,
+    4951, 4950, 4953,
+    4952, 4954, 1486,
+    4952, 4953, 4954,
+    4954, 1487, 1486,
+    4955, 4953, 4950,
+    4948, 4955, 4950,
+    4953, 4956, 4954,
+    4953, 4955, 4956,
+    4954, 4957, 1487,
+    4957, 4954, 4956,
+    4957, 1489, 1487,
+    1489, 4957, 1986,
+    4957, 1987, 1986,
+    4957, 4958, 1987,
+    4958, 4957, 4956,
+    4958, 4959, 1987,
+    1985, 1987, 4959,
+    4958, 4956, 4960,
+    4955, 4960, 4956,
+    4961, 4958, 4960,
+    4958, 4961, 4959,
+    4960, 4955, 4962,
+    4961, 4960, 4963,
+    4960, 4962, 4963,
+    4961, 4964, 4959,
+    4961, 4963, 4964,
+    4965, 4959, 4964,
+    4965, 1985, 4959,
+    4963, 4966, 4964,
+    1985, 4965, 4967,
+    1985, 4967, 1982,
+    4968, 4965, 4964,
+    4968, 4964, 4966,
+    4965, 4969, 4967,
+    4965, 4968, 4969,
+    4967, 4970, 1982,
+    1983, 1982, 4970,
+    4971, 1983, 4970,
+    4972, 4971, 4973,
+    4971, 4970, 4973,
+    4974, 4973, 4970,
+    4967, 4974, 4970,
+    4974, 4967, 4969,
+    4975, 4974, 4969,
+    4975, 4969, 4976,
+    4968, 4976, 4969,
+    4977, 4975, 4976,
+    4968, 4978, 4976,
+    4977, 4976, 4979,
+    4978, 4979, 4976,
+    4980, 4977, 4979,
+    4978, 4968, 4966,
+    4980, 4979, 4981,
+    4982, 4980, 4981,
+    4982, 4981, 4983,
+    4978, 4984, 4979,
+    4984, 4981, 4979,
+    4981, 4985, 4983,
+    4981, 4984, 4985,
+    4986, 4983, 4985,
+    4987, 4986, 4985,
+    4986, 4987, 4988,
+    4987, 4985, 4989,
+    4984, 4989, 4985,
+    4987, 4990, 4988,
+    4991, 4988, 4990,
+    4992, 4987, 4989,
+    4987, 4992, 4990,
+    4993, 4991, 4990,
+    4991, 4993, 4994,
+    4993, 4990, 4995,
+    4992, 4995, 4990,
+    4993, 4996, 4994,
+    4997, 4994, 4996,
+    4993, 4998, 4996,
+    4998, 4993, 4995,
+    4998, 4999, 4996,
+    4998, 4995, 5000,
+    4998, 5000, 4999,
+    4995, 5001, 5000,
+    5002, 4996, 4999,
+    5002, 4997, 4996,
+    5003, 5001, 4995,
+    4992, 5003, 4995,
+    5003, 5004, 5001,
+    5004, 5000, 5001,
+    5003, 4992, 5005,
+    5000, 5004, 5006,
+    5000, 5006, 4999,
+    5004, 5003, 5007,
+    5003, 5005, 5007,
+    5008, 4999, 5006,
+    5008, 5002, 4999,
+    5009, 5008, 5006,
+    5008, 5010, 5002,
+    5008, 5009, 5010,
+    5010, 5011, 5002,
+    4997, 5002, 5011,
+    5009, 5012, 5010,
+    5013, 4997, 5011,
+    5009, 5006, 5014,
+    5004, 5014, 5006,
+    5015, 5009, 5014,
+    5009, 5015, 5012,
+    5014, 5004, 5016,
+    5004, 5007, 5016,
+    5015, 5014, 5017,
+    5014, 5016, 5017,
+    5015, 5017, 5018,
+    5015, 5018, 5012,
+    5019, 5017, 5016,
+    5017, 5020, 5018,
+    5017, 5019, 5020,
+    5021, 5012, 5018,
+    5022, 5018, 5020,
+    5022, 5021, 5018,
+    5021, 5023, 5012,
+    5023, 5010, 5012,
+    5010, 5023, 5011,
+    5021, 5022, 5024,
+    5023, 5025, 5011,
+    5013, 5011, 5025,
+    5023, 5021, 5026,
+    5021, 5024, 5026,
+    5023, 5026, 5027,
+    5028, 5026, 5024,
+    5029, 5023, 5027,
+    5023, 5029, 5025,
+    5030, 5027, 5026,
+    5028, 5030, 5026,
+    5029, 5027, 5031,
+    5028, 5032, 5030,
+    5030, 5033, 5027,
+    5033, 5031, 5027,
+    5032, 5034, 5030,
+    5033, 5030, 5034,
+    5028, 5035, 5032,
+    5035, 5028, 5024,
+    5035, 5024, 5036,
+    5022, 5036, 5024,
+    5035, 5037, 5032,
+    5022, 5038, 5036,
+    5038, 5022, 5020,
+    5039, 5035, 5036,
+    5035, 5039, 5037,
+    5038, 5040, 5036,
+    5039, 5036, 5040,
+    5038, 5020, 5041,
+    5019, 5041, 5020,
+    5042, 5038, 5041,
+    5038, 5042, 5040,
+    5042, 5041, 5043,
+    5042, 5044, 5040,
+    5042, 5043, 5044,
+    5045, 5040, 5044,
+    5045, 5039, 5040,
+    5043, 5046, 5044,
+    5039, 5045, 5047,
+    5039, 5047, 5037,
+    5048, 5045, 5044,
+    5048, 5044, 5046,
+    5045, 5049, 5047,
+    5045, 5048, 5049,
+    5050, 5037, 5047,
+    5051, 5047, 5049,
+    5051, 5050, 5047,
+    5050, 5052, 5037,
+    5052, 5032, 5037,
+    5032, 5052, 5034,
+    5050, 5051, 5053,
+    5050, 5053, 5054,
+    5052, 5050, 5054,
+    5051, 5055, 5053,
+    5054, 5053, 5055,
+    5055, 5051, 5056,
+    5052, 5054, 5057,
+    5058, 5054, 5055,
+    5059, 5052, 5057,
+    5052, 5059, 5034,
+    5060, 5057, 5054,
+    5058, 5060, 5054,
+    5059, 5057, 5061,
+    5060, 5062, 5057,
+    5062, 5061, 5057,
+    5063, 5034, 5059,
+    5063, 5033, 5034,
+    5064, 5059, 5061,
+    5064, 5063, 5059,
+    5064, 5061, 5065,
+    5064, 5066, 5063,
+    5066, 5064, 5065,
+    5066, 5067, 5063,
+    5033, 5063, 5067,
+    5066, 5065, 5068,
+    5069, 5066, 5068,
+    5066, 5069, 5067,
+    5070, 5068, 5065,
+    5069, 5071, 5067,
+    5072, 5070, 5065,
+    5072, 5065, 5061,
+    5070, 5072, 5073,
+    5062, 5072, 5061,
+    5072, 5074, 5073,
+    5072, 5062, 5074,
+    5075, 5073, 5074,
+    5062, 5076, 5074,
+    5062, 5060, 5076,
+    5077, 5075, 5074,
+    5077, 5074, 5076,
+    5075, 5077, 5078,
+    5060, 5079, 5076,
+    5060, 5058, 5079,
+    5080, 5077, 5076,
+    5080, 5076, 5079,
+    5077, 5081, 5078,
+    5077, 5080, 5081,
+    5082, 5078, 5081,
+    5083, 5082, 5081,
+    5080, 5084, 5081,
+    5083, 5081, 5084,
+    5082, 5083, 5085,
+    5086, 5082, 5085,
+    5087, 5083, 5084,
+    5086, 5085, 5088,
+    5089, 5086, 5088,
+    5090, 5085, 5083,
+    5087, 5090, 5083,
+    5090, 5091, 5085,
+    5091, 5088, 5085,
+    5090, 5087, 5092,
+    5091, 5090, 5093,
+    5090, 5092, 5093,
+    5091, 5094, 5088,
+    5087, 5095, 5092,
+    5087, 5084, 5095,
+    5094, 5091, 5096,
+    5091, 5093, 5096,
+    5094, 5097, 5088,
+    5089, 5088, 5097,
+    5098, 5089, 5097,
+    5098, 5097, 5099,
+    5100, 5098, 5099,
+    5094, 5101, 5097,
+    5101, 5099, 5097,
+    5100, 5099, 5102,
+    5103, 5100, 5102,
+    5101, 5104, 5099,
+    5104, 5102, 5099,
+    5103, 5102, 5105,
+    5106, 5103, 5105,
+    5106, 5105, 5107,
+    5108, 5105, 5102,
+    5104, 5108, 5102,
+    5105, 5109, 5107,
+    5105, 5108, 5109,
+    5110, 5107, 5109,
+    5111, 5110, 5109,
+    5110, 5111, 5112,
+    5111, 5109, 5113,
+    5108, 5113, 5109,
+    5111, 5114, 5112,
+    5115, 5112, 5114,
+    5116, 5111, 5113,
+    5111, 5116, 5114,
+    5116, 5113, 5117,
+    5116, 5118, 5114,
+    5116, 5117, 5118,
+    5119, 5115, 5114,
+    5119, 5114, 5118,
+    5115, 5119, 5120,
+    5121, 5115, 5120,
+    5122, 5119, 5118,
+    5121, 5120, 5123,
+    5124, 5121, 5123,
+    5124, 5123, 5125,
+    5126, 5120, 5119,
+    5122, 5126, 5119,
+    5127, 5123, 5120,
+    5126, 5127, 5120,
+    5123, 5128, 5125,
+    5123, 5127, 5128,
+    5129, 5125, 5128,
+    5130, 5129, 5128,
+    5130, 5128, 5131,
+    5127, 5131, 5128,
+    5129, 5130, 5132,
+    5133, 5129, 5132,
+    5134, 5130, 5131,
+    5134, 5135, 5130,
+    5134, 5131, 5135,
+    5135, 5132, 5130,
+    5131, 5136, 5135,
+    5131, 5127, 5136,
+    5135, 5137, 5132,
+    5137, 5135, 5136,
+    5133, 5132, 5138,
+    5137, 5138, 5132,
+    5139, 5133, 5138,
+    5139, 5138, 5140,
+    5138, 5141, 5140,
+    5138, 5137, 5141,
+    5142, 5140, 5141,
+    5143, 5142, 5141,
+    5137, 5144, 5141,
+    5143, 5141, 5144,
+    5142, 5143, 5145,
+    5146, 5142, 5145,
+    5147, 5143, 5144,
+    5146, 5145, 5148,
+    5149, 5146, 5148,
+    5150, 5145, 5143,
+    5147, 5150, 5143,
+    5150, 5151, 5145,
+    5151, 5148, 5145,
+    5150, 5147, 5152,
+    5151, 5150, 5153,
+    5150, 5152, 5153,
+    5151, 5154, 5148,
+    5147, 5155, 5152,
+    5147, 5144, 5155,
+    5154, 5151, 5156,
+    5151, 5153, 5156,
+    5154, 5157, 5148,
+    5149, 5148, 5157,
+    5158, 5149, 5157,
+    5149, 5158, 5159,
+    5154, 5160, 5157,
+    5158, 5161, 5159,
+    5162, 5159, 5161,
+    5158, 5157, 5163,
+    5160, 5163, 5157,
+    5164, 5158, 5163,
+    5158, 5164, 5161,
+    5164, 5163, 5165,
+    5164, 5165, 5161,
+    5163, 5166, 5165,
+    5163, 5160, 5166,
+    5167, 5161, 5165,
+    5167, 5162, 5161,
+    5162, 5167, 5168,
+    5169, 5167, 5165,
+    5169, 5165, 5166,
+    5167, 5170, 5168,
+    5167, 5169, 5170,
+    5171, 5168, 5170,
+    5169, 5172, 5170,
+    5172, 5169, 5166,
+    5173, 5171, 5170,
+    5173, 5170, 5172,
+    5172, 5166, 5174,
+    5160, 5174, 5166,
+    5175, 5173, 5172,
+    5175, 5172, 5174,
+    5174, 5160, 5176,
+    5175, 5174, 5177,
+    5174, 5176, 5177,
+    5160, 5178, 5176,
+    5160, 5154, 5178,
+    5154, 5156, 5178,
+    5179, 5178, 5156,
+    5180, 5176, 5178,
+    5179, 5180, 5178,
+    5181, 5179, 5156,
+    5179, 5181, 5180,
+    5181, 5156, 5153,
+    5180, 5182, 5176,
+    5182, 5177, 5176,
+    5181, 5183, 5180,
+    5182, 5180, 5183,
+    5184, 5181, 5153,
+    5181, 5184, 5183,
+    5184, 5153, 5152,
+    5185, 5184, 5152,
+    5185, 5152, 5155,
+    5184, 5186, 5183,
+    5184, 5185, 5186,
+    5187, 5183, 5186,
+    5187, 5182, 5183,
+    5185, 5188, 5186,
+    5182, 5187, 5189,
+    5182, 5189, 5177,
+    5190, 5187, 5186,
+    5190, 5186, 5188,
+    5187, 5191, 5189,
+    5187, 5190, 5191,
+    5189, 5192, 5177,
+    5175, 5177, 5192,
+    5189, 5193, 5192,
+    5193, 5189, 5191,
+    5194, 5175, 5192,
+    5193, 5195, 5192,
+    5194, 5192, 5195,
+    5196, 5193, 5191,
+    5193, 5196, 5195,
+    5196, 5191, 5197,
+    5190, 5197, 5191,
+    5196, 5198, 5195,
+    5190, 5199, 5197,
+    5199, 5190, 5188,
+    5200, 5196, 5197,
+    5196, 5200, 5198,
+    5199, 5201, 5197,
+    5200, 5197, 5201,
+    5199, 5188, 5202,
+    5203, 5200, 5201,
+    5199, 5204, 5201,
+    5204, 5199, 5202,
+    5203, 5201, 5205,
+    5204, 5205, 5201,
+    5200, 5203, 5206,
+    5200, 5206, 5198,
+    5207, 5203, 5205,
+    5203, 5208, 5206,
+    5203, 5207, 5208,
+    5209, 5198, 5206,
+    5209, 5210, 5198,
+    5210, 5195, 5198,
+    5210, 5194, 5195,
+    5210, 5209, 5194,
+    5209, 5211, 5194,
+    5175, 5194, 5211,
+    5173, 5175, 5211,
+    5173, 5211, 5212,
+    5171, 5173, 5212,
+    5209, 5213, 5211,
+    5213, 5212, 5211,
+    5213, 5209, 5206,
+    5213, 5206, 5208,
+    5171, 5212, 5214,
+    5213, 5215, 5212,
+    5215, 5214, 5212,
+    5216, 5171, 5214,
+    5171, 5216, 5217,
+    5215, 5218, 5214,
+    5216, 5219, 5217,
+    5220, 5217, 5219,
+    5216, 5214, 5221,
+    5218, 5221, 5214,
+    5222, 5216, 5221,
+    5216, 5222, 5219,
+    5222, 5221, 5223,
+    5222, 5224, 5219,
+    5224, 5222, 5223,
+    5225, 5219, 5224,
+    5225, 5220, 5219,
+    5226, 5225, 5224,
+    5226, 5224, 5227,
+    5224, 5223, 5227,
+    5225, 5226, 5228,
+    5226, 5227, 5228,
+    5220, 5225, 5229,
+    5225, 5228, 5229,
+    5220, 5229, 5230,
+    5231, 5220, 5230,
+    5232, 5229, 5228,
+    5231, 5230, 5233,
+    5234, 5231, 5233,
+    5235, 5230, 5229,
+    5232, 5235, 5229,
+    5235, 5236, 5230,
+    5236, 5233, 5230,
+    5235, 5232, 5237,
+    5236, 5235, 5238,
+    5235, 5237, 5238,
+    5236, 5239, 5233,
+    5236, 5238, 5240,
+    5239, 5236, 5240,
+    5239, 5241, 5233,
+    5234, 5233, 5241,
+    5239, 5242, 5241,
+    5243, 5234, 5241,
+    5234, 5243, 5244,
+    5242, 5245, 5241,
+    5243, 5241, 5245,
+    5242, 5239, 5246,
+    5239, 5240, 5246,
+    5242, 5246, 5247,
+    5242, 5247, 5245,
+    5248, 5246, 5240,
+    5246, 5249, 5247,
+    5246, 5248, 5249,
+    5247, 5250, 5245,
+    5251, 5245, 5250,
+    5251, 5243, 5245,
+    5247, 5252, 5250,
+    5252, 5247, 5249,
+    5243, 5251, 5253,
+    5243, 5253, 5244,
+    5254, 5244, 5253,
+    5251, 5255, 5253,
+    5255, 5251, 5250,
+    5256, 5254, 5253,
+    5256, 5253, 5255,
+    5255, 5250, 5257,
+    5252, 5257, 5250,
+    5258, 5256, 5255,
+    5258, 5255, 5257,
+    5256, 5258, 5259,
+    5258, 5257, 5259,
+    5256, 5259, 5260,
+    5254, 5256, 5260,
+    5261, 5259, 5257,
+    5252, 5261, 5257,
+    5261, 5262, 5259,
+    5262, 5260, 5259,
+    5261, 5252, 5263,
+    5254, 5260, 5264,
+    5265, 5254, 5264,
+    5266, 5265, 5267,
+    5265, 5264, 5267,
+    5268, 5267, 5264,
+    5269, 5268, 5264,
+    5269, 5264, 5260,
+    5268, 5269, 5270,
+    5262, 5269, 5260,
+    5269, 5271, 5270,
+    5269, 5262, 5271,
+    5272, 5270, 5271,
+    5262, 5273, 5271,
+    5274, 5272, 5271,
+    5274, 5271, 5273,
+    5272, 5274, 5275,
+    5272, 5275, 5276,
+    5277, 5272, 5276,
+    5278, 5277, 5279,
+    5277, 5276, 5279,
+    5280, 5279, 5276,
+    5281, 5276, 5275,
+    5281, 5280, 5276,
+    5282, 5281, 5275,
+    5282, 5275, 5283,
+    5274, 5283, 5275,
+    5282, 5284, 5281,
+    5274, 5285, 5283,
+    5285, 5274, 5273,
+    5286, 5282, 5283,
+    5282, 5286, 5284,
+    5285, 5287, 5283,
+    5286, 5283, 5287,
+    5285, 5288, 5287,
+    5289, 5286, 5287,
+    5288, 5285, 5290,
+    5285, 5273, 5290,
+    5288, 5291, 5287,
+    5289, 5287, 5291,
+    5288, 5292, 5291,
+    5293, 5289, 5291,
+    5292, 5288, 5294,
+    5288, 5290, 5294,
+    5292, 5295, 5291,
+    5293, 5291, 5295,
+    5295, 5292, 5296,
+    5297, 5293, 5295,
+    5292, 5298, 5296,
+    5292, 5294, 5298,
+    5295, 5296, 5299,
+    5297, 5295, 5299,
+    5300, 5299, 5296,
+    5297, 5299, 5301,
+    5302, 5300, 5296,
+    5302, 5296, 5298,
+    5299, 5300, 5303,
+    5299, 5303, 5301,
+    5300, 5302, 5304,
+    5300, 5305, 5303,
+    5300, 5304, 5305,
+    5306, 5303, 5305,
+    5302, 5307, 5304,
+    5306, 5308, 5303,
+    5308, 5301, 5303,
+    5302, 5309, 5307,
+    5309, 5302, 5298,
+    5308, 5310, 5301,
+    5309, 5298, 5311,
+    5294, 5311, 5298,
+    5294, 5312, 5311,
+    5312, 5294, 5290,
+    5313, 5312, 5290,
+    5313, 5290, 5273,
+    5262, 5313, 5273,
+    5313, 5262, 5314,
+    5312, 5313, 5315,
+    5313, 5314, 5315,
+    5262, 5316, 5314,
+    5262, 5261, 5316,
+    5261, 5263, 5316,
+    5317, 5314, 5316,
+    5318, 5316, 5263,
+    5318, 5317, 5316,
+    5317, 5319, 5314,
+    5319, 5315, 5314,
+    5317, 5318, 5320,
+    5319, 5317, 5321,
+    5317, 5320, 5321,
+    5319, 5322, 5315,
+    5319, 5321, 5323,
+    5322, 5319, 5323,
+    5322, 5324, 5315,
+    5312, 5315, 5324,
+    5322, 5323, 5325,
+    5326, 5312, 5324,
+    5312, 5326, 5311,
+    5322, 5327, 5324,
+    5327, 5322, 5325,
+    5326, 5324, 5328,
+    5327, 5328, 5324,
+    5329, 5326, 5328,
+    5329, 5330, 5326,
+    5329, 5328, 5330,
+    5330, 5311, 5326,
+    5330, 5309, 5311,
+    5328, 5331, 5330,
+    5309, 5330, 5331,
+    5328, 5327, 5331,
+    5332, 5309, 5331,
+    5327, 5333, 5331,
+    5332, 5331, 5333,
+    5309, 5332, 5334,
+    5335, 5332, 5333,
+    5336, 5309, 5334,
+    5309, 5336, 5307,
+    5337, 5334, 5332,
+    5335, 5337, 5332,
+    5336, 5334, 5338,
+    5337, 5339, 5334,
+    5339, 5338, 5334,
+    5337, 5335, 5340,
+    5339, 5337, 5341,
+    5337, 5340, 5341,
+    5335, 5342, 5340,
+    5335, 5333, 5342,
+    5333, 5343, 5342,
+    5333, 5327, 5343,
+    5344, 5340, 5342,
+    5345, 5342, 5343,
+    5345, 5344, 5342,
+    5327, 5346, 5343,
+    5347, 5345, 5343,
+    5347, 5343, 5346,
+    5346, 5327, 5348,
+    5327, 5325, 5348,
+    5349, 5347, 5346,
+    5346, 5348, 5350,
+    5349, 5346, 5350,
+    5351, 5348, 5325,
+    5347, 5349, 5352,
+    5351, 5353, 5348,
+    5353, 5350, 5348,
+    5347, 5352, 5354,
+    5345, 5347, 5354,
+    5354, 5352, 5355,
+    5349, 5355, 5352,
+    5345, 5354, 5356,
+    5345, 5356, 5344,
+    5349, 5357, 5355,
+    5349, 5350, 5357,
+    5350, 5358, 5357,
+    5350, 5353, 5358,
+    5357, 5358, 5359,
+    5353, 5359, 5358,
+    5357, 5360, 5355,
+    5361, 5357, 5359,
+    5357, 5361, 5360,
+    5353, 5362, 5359,
+    5361, 5359, 5363,
+    5362, 5363, 5359,
+    5362, 5353, 5364,
+    5353, 5351, 5364,
+    5362, 5365, 5363,
+    5362, 5364, 5366,
+    5365, 5362, 5366,
+    5367, 5364, 5351,
+    5368, 5366, 5364,
+    5367, 5368, 5364,
+    5369, 5367, 5351,
+    5369, 5351, 5325,
+    5369, 5325, 5323,
+    5370, 5369, 5323,
+    5370, 5323, 5321,
+    5367, 5369, 5371,
+    5369, 5370, 5371,
+    5372, 5370, 5321,
+    5372, 5321, 5320,
+    5372, 5373, 5370,
+    5373, 5372, 5320,
+    5373, 5371, 5370,
+    5373, 5320, 5374,
+    5318, 5374, 5320,
+    5373, 5375, 5371,
+    5375, 5373, 5374,
+    5318, 5376, 5374,
+    5376, 5318, 5263,
+    5375, 5374, 5377,
+    5376, 5377, 5374,
+    5375, 5378, 5371,
+    5367, 5371, 5378,
+    5368, 5367, 5378,
+    5375, 5379, 5378,
+    5379, 5375, 5377,
+    5368, 5378, 5380,
+    5379, 5380, 5378,
+    5381, 5368, 5380,
+    5379, 5382, 5380,
+    5368, 5381, 5383,
+    5368, 5383, 5366,
+    5381, 5380, 5384,
+    5382, 5384, 5380,
+    5385, 5381, 5384,
+    5381, 5385, 5386,
+    5381, 5386, 5383,
+    5385, 5384, 5387,
+    5385, 5387, 5386,
+    5384, 5382, 5388,
+    5384, 5388, 5387,
+    5382, 5389, 5388,
+    5382, 5379, 5389,
+    5379, 5377, 5389,
+    5390, 5389, 5377,
+    5376, 5390, 5377,
+    5390, 5391, 5389,
+    5391, 5388, 5389,
+    5390, 5376, 5392,
+    5390, 5392, 5391,
+    5376, 5263, 5392,
+    5252, 5392, 5263,
+    5392, 5252, 5249,
+    5392, 5249, 5391,
+    5248, 5391, 5249,
+    5391, 5248, 5388,
+    5248, 5387, 5388,
+    5248, 5393, 5387,
+    5393, 5248, 5240,
+    5393, 5386, 5387,
+    5393, 5240, 5238,
+    5393, 5394, 5386,
+    5394, 5393, 5238,
+    5394, 5383, 5386,
+    5394, 5238, 5237,
+    5394, 5395, 5383,
+    5396, 5394, 5237,
+    5394, 5396, 5395,
+    5395, 5397, 5383,
+    5383, 5397, 5366,
+    5365, 5366, 5397,
+    5395, 5365, 5397,
+    5365, 5395, 5398,
+    5396, 5398, 5395,
+    5399, 5365, 5398,
+    5365, 5399, 5363,
+    5396, 5400, 5398,
+    5401, 5363, 5399,
+    5401, 5361, 5363,
+    5399, 5398, 5402,
+    5400, 5402, 5398,
+    5403, 5401, 5399,
+    5403, 5399, 5402,
+    5361, 5401, 5404,
+    5361, 5404, 5360,
+    5401, 5403, 5405,
+    5401, 5405, 5404,
+    5403, 5406, 5405,
+    5403, 5402, 5406,
+    5407, 5404, 5405,
+    5402, 5408, 5406,
+    5402, 5400, 5408,
+    5406, 5408, 5409,
+    5400, 5409, 5408,
+    5410, 5405, 5406,
+    5410, 5407, 5405,
+    5411, 5406, 5409,
+    5411, 5410, 5406,
+    5400, 5412, 5409,
+    5411, 5409, 5413,
+    5412, 5413, 5409,
+    5410, 5411, 5414,
+    5412, 5415, 5413,
+    5410, 5414, 5416,
+    5407, 5410, 5416,
+    5407, 5416, 5417,
+    5418, 5407, 5417,
+    5407, 5418, 5404,
+    5418, 5360, 5404,
+    5419, 5417, 5416,
+    5418, 5417, 5419,
+    5418, 5420, 5360,
+    5420, 5418, 5419,
+    5420, 5355, 5360,
+    5420, 5354, 5355,
+    5354, 5420, 5421,
+    5354, 5421, 5356,
+    5420, 5422, 5421,
+    5420, 5419, 5422,
+    5423, 5356, 5421,
+    5356, 5423, 5424,
+    5356, 5424, 5344,
+    5425, 5423, 5421,
+    5425, 5421, 5422,
+    5423, 5426, 5424,
+    5344, 5424, 5426,
+    5423, 5425, 5427,
+    5423, 5427, 5426,
+    5428, 5344, 5426,
+    5344, 5428, 5340,
+    5428, 5341, 5340,
+    5427, 5429, 5426,
+    5428, 5426, 5429,
+    5425, 5430, 5427,
+    5428, 5431, 5341,
+    5425, 5432, 5430,
+    5432, 5425, 5422,
+    5432, 5422, 5433,
+    5419, 5433, 5422,
+    5432, 5434, 5430,
+    5419, 5435, 5433,
+    5435, 5419, 5416,
+    5435, 5416, 5414,
+    5436, 5432, 5433,
+    5432, 5436, 5434,
+    5435, 5437, 5433,
+    5436, 5433, 5437,
+    5435, 5438, 5437,
+    5438, 5435, 5414,
+    5439, 5436, 5437,
+    5438, 5414, 5440,
+    5411, 5440, 5414,
+    5438, 5441, 5437,
+    5439, 5437, 5441,
+    5442, 5438, 5440,
+    5438, 5442, 5441,
+    5411, 5443, 5440,
+    5443, 5411, 5413,
+    5442, 5440, 5444,
+    5443, 5444, 5440,
+    5443, 5413, 5445,
+    5415, 5445, 5413,
+    5443, 5446, 5444,
+    5446, 5443, 5445,
+    5446, 5447, 5444,
+    5446, 5445, 5448,
+    5447, 5446, 5448,
+    5449, 5448, 5445,
+    5415, 5449, 5445,
+    5447, 5448, 5450,
+    5449, 5451, 5448,
+    5451, 5450, 5448,
+    5449, 5415, 5452,
+    5451, 5449, 5453,
+    5449, 5452, 5453,
+    5415, 5454, 5452,
+    5415, 5412, 5454,
+    5218, 5453, 5452,
+    5218, 5215, 5453,
+    5455, 5218, 5452,
+    5455, 5452, 5454,
+    5218, 5455, 5221,
+    5455, 5223, 5221,
+    5455, 5456, 5223,
+    5456, 5455, 5454,
+    5456, 5227, 5223,
+    5456, 5454, 5457,
+    5412, 5457, 5454,
+    5412, 5400, 5457,
+    5456, 5458, 5227,
+    5458, 5456, 5457,
+    5458, 5228, 5227,
+    5458, 5232, 5228,
+    5458, 5457, 5459,
+    5232, 5458, 5459,
+    5400, 5459, 5457,
+    5232, 5459, 5237,
+    5400, 5396, 5459,
+    5396, 5237, 5459,
+    5460, 5461, 5462,
+    5460, 5462, 5463,
+    5461, 5460, 5464,
+    5460, 5463, 5465,
+    5460, 5465, 5464,
+    5462, 5466, 5463,
+    5463, 5467, 5465,
+    5468, 5463, 5466,
+    5463, 5468, 5467,
+    5469, 5465, 5467,
+    5469, 5470, 5465,
+    5470, 5464, 5465,
+    5471, 5469, 5467,
+    5470, 5469, 5472,
+    5471, 5467, 5473,
+    5468, 5473, 5467,
+    5469, 5471, 5474,
+    5469, 5474, 5472,
+    5475, 5471, 5473,
+    5471, 5476, 5474,
+    5471, 5475, 5476,
+    5477, 5474, 5476,
+    5477, 5478, 5474,
+    5478, 5472, 5474,
+    5479, 5477, 5476,
+    5478, 5480, 5472,
+    5478, 5477, 5481,
+    5477, 5479, 5481,
+    5480, 5478, 5482,
+    5478, 5481, 5482,
+    5480, 5483, 5472,
+    5480, 5482, 5483,
+    5470, 5472, 5483,
+    5482, 5484, 5483,
+    5485, 5470, 5483,
+    5485, 5483, 5484,
+    5470, 5485, 5464,
+    5482, 5486, 5484,
+    5486, 5482, 5481,
+    5487, 5486, 5481,
+    5487, 5481, 5479,
+    5486, 5488, 5484,
+    5489, 5487, 5479,
+    5486, 5487, 5490,
+    5489, 5479, 5491,
+    5479, 5476, 5491,
+    5475, 5491, 5476,
+    5487, 5489, 5492,
+    5487, 5492, 5490,
+    5489, 5491, 5493,
+    5489, 5494, 5492,
+    5494, 5489, 5493,
+    5495, 5493, 5491,
+    5475, 5495, 5491,
+    5494, 5493, 5496,
+    5495, 5475, 5497,
+    5475, 5473, 5497,
+    5495, 5498, 5493,
+    5498, 5496, 5493,
+    5498, 5495, 5499,
+    5495, 5497, 5499,
+    5498, 5500, 5496,
+    5498, 5499, 5501,
+    5500, 5498, 5501,
+    5502, 5499, 5497,
+    5503, 5501, 5499,
+    5502, 5503, 5499,
+    5504, 5502, 5497,
+    5504, 5497, 5473,
+    5468, 5504, 5473,
+    5502, 5504, 5505,
+    5504, 5468, 5506,
+    5504, 5506, 5505,
+    5468, 5507, 5506,
+    5507, 5468, 5466,
+    5508, 5505, 5506,
+    5509, 5506, 5507,
+    5509, 5508, 5506,
+    5510, 5509, 5507,
+    5508, 5511, 5505,
+    5510, 5507, 5512,
+    5507, 5466, 5512,
+    5510, 5512, 5513,
+    5509, 5510, 5513,
+    5508, 5509, 5514,
+    5509, 5513, 5514,
+    5508, 5514, 5511,
+    5515, 5513, 5512,
+    5516, 5514, 5513,
+    5515, 5516, 5513,
+    5514, 5517, 5511,
+    5514, 5516, 5517,
+    5518, 5515, 5512,
+    5518, 5512, 5466,
+    5462, 5518, 5466,
+    5518, 5462, 5519,
+    5461, 5519, 5462,
+    5515, 5518, 5520,
+    5461, 5521, 5519,
+    5515, 5520, 5522,
+    5516, 5515, 5522,
+    5521, 5461, 5523,
+    5461, 5464, 5523,
+    5485, 5523, 5464,
+    5521, 5523, 5524,
+    5485, 5525, 5523,
+    5525, 5524, 5523,
+    5526, 5521, 5524,
+    5525, 5527, 5524,
+    5521, 5526, 5528,
+    5521, 5528, 5519,
+    5526, 5524, 5529,
+    5527, 5529, 5524,
+    5526, 5530, 5528,
+    5531, 5526, 5529,
+    5526, 5531, 5530,
+    5532, 5528, 5530,
+    5532, 5533, 5528,
+    5533, 5519, 5528,
+    5533, 5518, 5519,
+    5534, 5532, 5530,
+    5532, 5534, 5533,
+    5518, 5533, 5535,
+    5534, 5535, 5533,
+    5536, 5518, 5535,
+    5518, 5536, 5520,
+    5534, 5537, 5535,
+    5534, 5530, 5538,
+    5537, 5534, 5538,
+    5531, 5538, 5530,
+    5537, 5539, 5535,
+    5536, 5535, 5539,
+    5537, 5538, 5540,
+    5541, 5536, 5539,
+    5537, 5542, 5539,
+    5542, 5537, 5540,
+    5541, 5539, 5543,
+    5542, 5543, 5539,
+    5541, 5544, 5536,
+    5544, 5520, 5536,
+    5545, 5541, 5543,
+    5541, 5545, 5544,
+    5544, 5546, 5520,
+    5546, 5522, 5520,
+    5545, 5547, 5544,
+    5546, 5544, 5547,
+    5548, 5547, 5545,
+    5548, 5546, 5547,
+    5549, 5548, 5545,
+    5549, 5545, 5550,
+    5545, 5543, 5550,
+    5549, 5551, 5548,
+    5552, 5550, 5543,
+    5542, 5552, 5543,
+    5549, 5550, 5553,
+    5552, 5542, 5554,
+    5542, 5540, 5554,
+    5550, 5552, 5555,
+    5550, 5555, 5553,
+    5552, 5556, 5555,
+    5553, 5555, 5556,
+    5556, 5552, 5557,
+    5558, 5553, 5556,
+    5552, 5559, 5557,
+    5552, 5554, 5559,
+    5556, 5557, 5560,
+    5558, 5556, 5560,
+    5561, 5560, 5557,
+    5558, 5560, 5562,
+    5560, 5561, 5563,
+    5560, 5563, 5562,
+    5564, 5561, 5557,
+    5564, 5557, 5559,
+    5561, 5565, 5563,
+    5562, 5563, 5565,
+    5561, 5564, 5566,
+    5565, 5561, 5567,
+    5561, 5566, 5567,
+    5568, 5562, 5565,
+    5565, 5567, 5569,
+    5568, 5565, 5569,
+    5570, 5569, 5567,
+    5562, 5568, 5571,
+    5572, 5570, 5567,
+    5572, 5567, 5566,
+    5562, 5571, 5573,
+    5558, 5562, 5573,
+    5558, 5573, 5553,
+    5573, 5574, 5553,
+    5549, 5553, 5574,
+    5551, 5549, 5574,
+    5573, 5575, 5574,
+    5575, 5573, 5571,
+    5551, 5574, 5576,
+    5575, 5576, 5574,
+    5577, 5551, 5576,
+    5551, 5577, 5578,
+    5551, 5578, 5548,
+    5546, 5548, 5578,
+    5577, 5576, 5579,
+    5577, 5580, 5578,
+    5577, 5579, 5580,
+    5581, 5546, 5578,
+    5581, 5578, 5580,
+    5546, 5581, 5582,
+    5583, 5581, 5580,
+    5546, 5582, 5584,
+    5522, 5546, 5584,
+    5581, 5585, 5582,
+    5581, 5583, 5585,
+    5586, 5582, 5585,
+    5586, 5587, 5582,
+    5587, 5584, 5582,
+    5588, 5586, 5585,
+    5586, 5589, 5587,
+    5586, 5588, 5589,
+    5587, 5590, 5584,
+    5588, 5585, 5591,
+    5583, 5591, 5585,
+    5590, 5587, 5592,
+    5589, 5592, 5587,
+    5590, 5593, 5584,
+    5522, 5584, 5593,
+    5516, 5522, 5593,
+    5590, 5594, 5593,
+    5516, 5593, 5595,
+    5594, 5595, 5593,
+    5590, 5596, 5594,
+    5596, 5590, 5592,
+    5594, 5597, 5595,
+    5596, 5598, 5594,
+    5597, 5594, 5598,
+    5597, 5599, 5595,
+    5600, 5597, 5598,
+    5601, 5595, 5599,
+    5602, 5601, 5599,
+    5601, 5516, 5595,
+    5602, 5603, 5601,
+    5603, 5604, 5601,
+    5516, 5601, 5604,
+    5603, 5605, 5604,
+    5606, 5516, 5604,
+    5516, 5606, 5517,
+    5605, 5607, 5604,
+    5606, 5604, 5607,
+    5607, 5605, 5608,
+    5605, 5609, 5608,
+    5610, 5606, 5607,
+    5610, 5607, 5611,
+    5610, 5611, 5606,
+    5607, 5608, 5611,
+    5611, 5517, 5606,
+    5611, 5612, 5517,
+    5612, 5611, 5608,
+    5612, 5511, 5517,
+    5613, 5608, 5609,
+    5613, 5612, 5608,
+    5614, 5613, 5609,
+    5614, 5615, 5613,
+    5615, 5616, 5613,
+    5612, 5613, 5616,
+    5615, 5617, 5616,
+    5618, 5612, 5616,
+    5617, 5619, 5616,
+    5618, 5616, 5619,
+    5619, 5617, 5620,
+    5617, 5621, 5620,
+    5622, 5618, 5619,
+    5623, 5620, 5621,
+    5624, 5623, 5621,
+    5619, 5620, 5625,
+    5622, 5619, 5625,
+    5623, 5626, 5620,
+    5626, 5625, 5620,
+    5622, 5625, 5501,
+    5503, 5622, 5501,
+    5500, 5501, 5625,
+    5622, 5503, 5618,
+    5626, 5500, 5625,
+    5503, 5627, 5618,
+    5612, 5618, 5627,
+    5503, 5502, 5627,
+    5511, 5612, 5627,
+    5502, 5505, 5627,
+    5511, 5627, 5505,
+    5500, 5626, 5628,
+    5500, 5628, 5496,
+    5626, 5629, 5628,
+    5626, 5623, 5629,
+    5630, 5496, 5628,
+    5630, 5494, 5496,
+    5631, 5630, 5628,
+    5630, 5631, 5494,
+    5631, 5628, 5629,
+    5631, 5492, 5494,
+    5631, 5632, 5492,
+    5632, 5631, 5629,
+    5632, 5490, 5492,
+    5632, 5629, 5633,
+    5623, 5633, 5629,
+    5623, 5624, 5633,
+    5624, 5634, 5633,
+    5624, 5635, 5634,
+    5636, 5632, 5633,
+    5636, 5633, 5634,
+    5632, 5636, 5637,
+    5490, 5632, 5637,
+    5638, 5636, 5634,
+    5490, 5637, 5639,
+    5486, 5490, 5639,
+    5486, 5639, 5488,
+    5640, 5637, 5636,
+    5638, 5640, 5636,
+    5641, 5639, 5637,
+    5640, 5641, 5637,
+    5639, 5641, 5642,
+    5639, 5642, 5488,
+    5641, 5640, 5643,
+    5641, 5643, 5642,
+    5640, 5638, 5644,
+    5640, 5644, 5643,
+    5638, 5634, 5644,
+    5635, 5644, 5634,
+    5635, 5645, 5644,
+    5645, 5643, 5644,
+    5645, 5646, 5643,
+    5646, 5642, 5643,
+    5646, 5647, 5642,
+    5647, 5488, 5642,
+    5647, 5648, 5488,
+    5648, 5484, 5488,
+    5648, 5485, 5484,
+    5648, 5647, 5649,
+    5485, 5648, 5650,
+    5648, 5649, 5650,
+    5485, 5650, 5651,
+    5525, 5485, 5651,
+    5652, 5650, 5649,
+    5525, 5651, 5653,
+    5527, 5525, 5653,
+    5654, 5651, 5650,
+    5652, 5654, 5650,
+    5654, 5655, 5651,
+    5655, 5653, 5651,
+    5654, 5652, 5656,
+    5655, 5654, 5657,
+    5654, 5656, 5657,
+    5655, 5658, 5653,
+    5655, 5657, 5659,
+    5658, 5655, 5659,
+    5658, 5660, 5653,
+    5527, 5653, 5660,
+    5658, 5661, 5660,
+    5662, 5527, 5660,
+    5527, 5662, 5529,
+    5661, 5663, 5660,
+    5662, 5660, 5663,
+    5661, 5658, 5664,
+    5661, 5664, 5663,
+    5658, 5659, 5664,
+    5665, 5662, 5663,
+    5664, 5666, 5663,
+    5665, 5663, 5666,
+    5667, 5664, 5659,
+    5664, 5667, 5666,
+    5668, 5667, 5659,
+    5668, 5659, 5657,
+    5667, 5669, 5666,
+    5667, 5668, 5669,
+    5670, 5666, 5669,
+    5670, 5665, 5666,
+    5668, 5671, 5669,
+    5672, 5668, 5657,
+    5668, 5672, 5671,
+    5672, 5657, 5656,
+    5673, 5669, 5671,
+    5673, 5670, 5669,
+    5672, 5674, 5671,
+    5675, 5673, 5671,
+    5675, 5671, 5674,
+    5672, 5676, 5674,
+    5676, 5672, 5656,
+    5677, 5675, 5674,
+    5676, 5656, 5678,
+    5652, 5678, 5656,
+    5676, 5679, 5674,
+    5677, 5674, 5679,
+    5680, 5676, 5678,
+    5676, 5680, 5679,
+    5652, 5681, 5678,
+    5681, 5652, 5649,
+    5680, 5678, 5682,
+    5681, 5682, 5678,
+    5681, 5649, 5683,
+    5647, 5683, 5649,
+    5647, 5684, 5683,
+    5685, 5681, 5683,
+    5681, 5685, 5682,
+    5684, 5686, 5683,
+    5685, 5683, 5686,
+    5684, 5687, 5686,
+    5688, 5685, 5686,
+    5685, 5688, 5682,
+    5687, 5689, 5686,
+    5688, 5686, 5689,
+    5690, 5682, 5688,
+    5690, 5680, 5682,
+    5691, 5688, 5689,
+    5691, 5690, 5688,
+    5691, 5689, 5692,
+    5690, 5691, 5692,
+    5680, 5690, 5693,
+    5690, 5692, 5693,
+    5680, 5693, 5679,
+    5694, 5692, 5689,
+    5687, 5694, 5689,
+    5695, 5693, 5692,
+    5694, 5695, 5692,
+    5696, 5679, 5693,
+    5695, 5696, 5693,
+    5696, 5677, 5679,
+    5695, 5694, 5697,
+    5696, 5695, 5698,
+    5695, 5697, 5698,
+    5677, 5696, 5699,
+    5696, 5698, 5699,
+    5677, 5699, 5700,
+    5701, 5699, 5698,
+    5702, 5677, 5700,
+    5677, 5702, 5675,
+    5703, 5700, 5699,
+    5701, 5703, 5699,
+    5702, 5700, 5572,
+    5570, 5572, 5700,
+    5703, 5570, 5700,
+    5704, 5702, 5572,
+    5704, 5572, 5566,
+    5570, 5703, 5705,
+    5570, 5705, 5569,
+    5704, 5566, 5706,
+    5564, 5706, 5566,
+    5707, 5704, 5706,
+    5704, 5707, 5702,
+    5564, 5708, 5706,
+    5708, 5564, 5559,
+    5708, 5709, 5706,
+    5707, 5706, 5709,
+    5708, 5559, 5710,
+    5708, 5710, 5709,
+    5559, 5711, 5710,
+    5554, 5711, 5559,
+    5554, 5712, 5711,
+    5712, 5710, 5711,
+    5712, 5554, 5540,
+    5710, 5712, 5713,
+    5710, 5713, 5709,
+    5714, 5712, 5540,
+    5714, 5540, 5538,
+    5531, 5714, 5538,
+    5712, 5714, 5715,
+    5712, 5715, 5713,
+    5714, 5531, 5716,
+    5714, 5716, 5715,
+    5531, 5529, 5716,
+    5662, 5716, 5529,
+    5662, 5665, 5716,
+    5665, 5715, 5716,
+    5665, 5670, 5715,
+    5670, 5713, 5715,
+    5670, 5673, 5713,
+    5673, 5709, 5713,
+    5673, 5707, 5709,
+    5707, 5673, 5717,
+    5673, 5675, 5717,
+    5707, 5717, 5702,
+    5702, 5717, 5675,
+    5576, 5718, 5579,
+    5576, 5575, 5718,
+    5719, 5579, 5718,
+    5575, 5720, 5718,
+    5579, 5719, 5721,
+    5579, 5721, 5580,
+    5583, 5580, 5721,
+    5722, 5583, 5721,
+    5583, 5722, 5591,
+    5722, 5721, 5723,
+    5719, 5723, 5721,
+    5722, 5724, 5591,
+    5725, 5722, 5723,
+    5722, 5725, 5724,
+    5726, 5591, 5724,
+    5726, 5588, 5591,
+    5725, 5727, 5724,
+    5588, 5726, 5728,
+    5588, 5728, 5589,
+    5729, 5726, 5724,
+    5729, 5724, 5727,
+    5726, 5730, 5728,
+    5726, 5729, 5730,
+    5731, 5589, 5728,
+    5589, 5731, 5592,
+    5732, 5728, 5730,
+    5732, 5731, 5728,
+    5731, 5733, 5592,
+    5596, 5592, 5733,
+    5731, 5732, 5734,
+    5735, 5596, 5733,
+    5596, 5735, 5598,
+    5733, 5731, 5736,
+    5731, 5734, 5736,
+    5735, 5733, 5737,
+    5733, 5736, 5737,
+    5735, 5738, 5598,
+    5735, 5737, 5738,
+    5600, 5598, 5738,
+    5739, 5600, 5738,
+    5739, 5738, 5740,
+    5737, 5740, 5738,
+    5741, 5739, 5740,
+    5737, 5742, 5740,
+    5742, 5737, 5736,
+    5741, 5740, 5743,
+    5742, 5743, 5740,
+    5744, 5741, 5743,
+    5744, 5743, 5745,
+    5743, 5746, 5745,
+    5743, 5742, 5746,
+    5747, 5745, 5746,
+    5748, 5747, 5746,
+    5747, 5748, 5749,
+    5742, 5750, 5746,
+    5748, 5746, 5750,
+    5742, 5751, 5750,
+    5751, 5742, 5736,
+    5751, 5736, 5734,
+    5752, 5748, 5750,
+    5751, 5753, 5750,
+    5752, 5750, 5753,
+    5754, 5751, 5734,
+    5751, 5754, 5753,
+    5754, 5734, 5755,
+    5732, 5755, 5734,
+    5754, 5756, 5753,
+    5732, 5757, 5755,
+    5757, 5732, 5730,
+    5758, 5754, 5755,
+    5754, 5758, 5756,
+    5757, 5759, 5755,
+    5758, 5755, 5759,
+    5757, 5730, 5760,
+    5729, 5760, 5730,
+    5761, 5757, 5760,
+    5757, 5761, 5759,
+    5729, 5762, 5760,
+    5762, 5729, 5727,
+    5762, 5763, 5760,
+    5761, 5760, 5763,
+    5762, 5727, 5764,
+    5762, 5764, 5763,
+    5727, 5765, 5764,
+    5727, 5725, 5765,
+    5764, 5766, 5763,
+    5725, 5767, 5765,
+    5725, 5723, 5767,
+    5768, 5764, 5765,
+    5764, 5768, 5766,
+    5769, 5765, 5767,
+    5769, 5768, 5765,
+    5723, 5770, 5767,
+    5723, 5719, 5770,
+    5771, 5769, 5767,
+    5771, 5767, 5770,
+    5769, 5771, 5772,
+    5769, 5772, 5773,
+    5768, 5769, 5773,
+    5771, 5774, 5772,
+    5768, 5773, 5775,
+    5774, 5771, 5776,
+    5777, 5773, 5772,
+    5778, 5772, 5774,
+    5778, 5777, 5772,
+    5779, 5778, 5774,
+    5777, 5780, 5773,
+    5780, 5775, 5773,
+    5779, 5774, 5781,
+    5774, 5776, 5781,
+    5779, 5781, 5782,
+    5778, 5779, 5782,
+    5783, 5781, 5776,
+    5778, 5782, 5784,
+    5777, 5778, 5784,
+    5785, 5782, 5781,
+    5783, 5785, 5781,
+    5785, 5786, 5782,
+    5786, 5784, 5782,
+    5785, 5783, 5787,
+    5786, 5785, 5788,
+    5785, 5787, 5788,
+    5786, 5788, 5789,
+    5790, 5786, 5789,
+    5786, 5790, 5784,
+    5791, 5789, 5788,
+    5790, 5789, 5791,
+    5792, 5791, 5788,
+    5792, 5788, 5787,
+    5790, 5793, 5784,
+    5777, 5784, 5793,
+    5780, 5777, 5793,
+    5790, 5794, 5793,
+    5794, 5790, 5791,
+    5780, 5793, 5795,
+    5794, 5795, 5793,
+    5796, 5780, 5795,
+    5780, 5796, 5775,
+    5795, 5794, 5797,
+    5796, 5795, 5798,
+    5795, 5797, 5798,
+    5796, 5799, 5775,
+    5796, 5798, 5800,
+    5799, 5796, 5800,
+    5801, 5775, 5799,
+    5801, 5768, 5775,
+    5799, 5800, 5802,
+    5768, 5801, 5803,
+    5768, 5803, 5766,
+    5804, 5801, 5799,
+    5804, 5799, 5802,
+    5801, 5805, 5803,
+    5801, 5804, 5805,
+    5806, 5803, 5805,
+    5804, 5807, 5805,
+    5806, 5808, 5803,
+    5808, 5766, 5803,
+    5809, 5806, 5805,
+    5809, 5805, 5807,
+    5806, 5810, 5808,
+    5806, 5809, 5810,
+    5808, 5811, 5766,
+    5811, 5763, 5766,
+    5811, 5761, 5763,
+    5811, 5808, 5812,
+    5810, 5812, 5808,
+    5761, 5811, 5813,
+    5761, 5813, 5759,
+    5814, 5811, 5812,
+    5811, 5814, 5813,
+    5815, 5759, 5813,
+    5815, 5758, 5759,
+    5816, 5813, 5814,
+    5816, 5815, 5813,
+    5758, 5815, 5817,
+    5758, 5817, 5756,
+    5815, 5816, 5818,
+    5815, 5818, 5817,
+    5816, 5819, 5818,
+    5820, 5817, 5818,
+    5816, 5821, 5819,
+    5821, 5816, 5814,
+    5822, 5818, 5819,
+    5822, 5820, 5818,
+    5821, 5823, 5819,
+    5824, 5822, 5819,
+    5824, 5819, 5823,
+    5821, 5814, 5825,
+    5814, 5812, 5825,
+    5821, 5825, 5826,
+    5823, 5821, 5826,
+    5827, 5825, 5812,
+    5810, 5827, 5812,
+    5827, 5828, 5825,
+    5828, 5826, 5825,
+    5827, 5810, 5829,
+    5809, 5829, 5810,
+    5827, 5830, 5828,
+    5830, 5827, 5829,
+    5809, 5831, 5829,
+    5831, 5809, 5807,
+    5830, 5829, 5832,
+    5831, 5832, 5829,
+    5833, 5830, 5832,
+    5832, 5831, 5834,
+    5830, 5833, 5835,
+    5830, 5835, 5828,
+    5833, 5832, 5836,
+    5832, 5834, 5836,
+    5833, 5837, 5835,
+    5833, 5836, 5838,
+    5837, 5833, 5838,
+    5839, 5836, 5834,
+    5840, 5838, 5836,
+    5839, 5840, 5836,
+    5841, 5839, 5834,
+    5839, 5842, 5840,
+    5839, 5841, 5842,
+    5841, 5834, 5843,
+    5831, 5843, 5834,
+    5831, 5807, 5843,
+    5807, 5844, 5843,
+    5807, 5804, 5844,
+    5804, 5802, 5844,
+    5845, 5843, 5844,
+    5845, 5841, 5843,
+    5846, 5844, 5802,
+    5846, 5845, 5844,
+    5841, 5845, 5847,
+    5841, 5847, 5842,
+    5845, 5846, 5848,
+    5845, 5848, 5847,
+    5849, 5846, 5802,
+    5849, 5802, 5800,
+    5846, 5850, 5848,
+    5846, 5849, 5850,
+    5851, 5849, 5800,
+    5851, 5800, 5798,
+    5852, 5851, 5798,
+    5852, 5798, 5797,
+    5849, 5851, 5853,
+    5852, 5854, 5851,
+    5854, 5853, 5851,
+    5855, 5852, 5797,
+    5852, 5855, 5854,
+    5855, 5797, 5856,
+    5794, 5856, 5797,
+    5855, 5857, 5854,
+    5794, 5858, 5856,
+    5859, 5855, 5856,
+    5855, 5859, 5857,
+    5858, 5860, 5856,
+    5859, 5856, 5860,
+    5858, 5794, 5861,
+    5794, 5791, 5861,
+    5862, 5861, 5791,
+    5792, 5862, 5791,
+    5858, 5861, 5863,
+    5792, 5864, 5862,
+    5864, 5792, 5787,
+    5862, 5865, 5861,
+    5865, 5863, 5861,
+    5864, 5866, 5862,
+    5865, 5862, 5866,
+    5864, 5787, 5867,
+    5783, 5867, 5787,
+    5868, 5864, 5867,
+    5864, 5868, 5866,
+    5783, 5869, 5867,
+    5869, 5783, 5776,
+    5868, 5867, 5870,
+    5869, 5870, 5867,
+    5869, 5776, 5871,
+    5771, 5871, 5776,
+    5871, 5771, 5770,
+    5872, 5869, 5871,
+    5869, 5872, 5870,
+    5871, 5770, 5873,
+    5872, 5871, 5873,
+    5719, 5873, 5770,
+    5872, 5873, 5874,
+    5719, 5875, 5873,
+    5875, 5874, 5873,
+    5876, 5872, 5874,
+    5872, 5876, 5870,
+    5875, 5877, 5874,
+    5878, 5870, 5876,
+    5878, 5868, 5870,
+    5876, 5874, 5879,
+    5877, 5879, 5874,
+    5880, 5878, 5876,
+    5880, 5876, 5879,
+    5868, 5878, 5881,
+    5868, 5881, 5866,
+    5878, 5880, 5882,
+    5878, 5882, 5881,
+    5880, 5883, 5882,
+    5880, 5879, 5883,
+    5884, 5881, 5882,
+    5879, 5885, 5883,
+    5879, 5877, 5885,
+    5886, 5882, 5883,
+    5886, 5884, 5882,
+    5887, 5886, 5883,
+    5887, 5883, 5885,
+    5884, 5886, 5888,
+    5886, 5887, 5889,
+    5886, 5889, 5888,
+    5890, 5887, 5885,
+    5887, 5891, 5889,
+    5887, 5890, 5891,
+    5890, 5885, 5892,
+    5877, 5892, 5885,
+    5890, 5893, 5891,
+    5877, 5894, 5892,
+    5877, 5875, 5894,
+    5895, 5890, 5892,
+    5890, 5895, 5893,
+    5895, 5892, 5896,
+    5894, 5896, 5892,
+    5895, 5897, 5893,
+    5875, 5898, 5894,
+    5875, 5719, 5898,
+    5899, 5894, 5898,
+    5894, 5899, 5896,
+    5719, 5900, 5898,
+    5900, 5719, 5718,
+    5900, 5718, 5720,
+    5901, 5898, 5900,
+    5901, 5899, 5898,
+    5902, 5900, 5720,
+    5902, 5901, 5900,
+    5902, 5720, 5901,
+    5720, 5903, 5901,
+    5899, 5901, 5903,
+    5720, 5575, 5903,
+    5904, 5899, 5903,
+    5575, 5905, 5903,
+    5904, 5903, 5905,
+    5575, 5906, 5905,
+    5906, 5575, 5571,
+    5907, 5904, 5905,
+    5906, 5571, 5908,
+    5568, 5908, 5571,
+    5906, 5909, 5905,
+    5907, 5905, 5909,
+    5910, 5906, 5908,
+    5906, 5910, 5909,
+    5908, 5568, 5911,
+    5568, 5569, 5911,
+    5705, 5911, 5569,
+    5908, 5911, 5912,
+    5910, 5908, 5912,
+    5705, 5913, 5911,
+    5913, 5912, 5911,
+    5913, 5705, 5914,
+    5703, 5914, 5705,
+    5915, 5914, 5703,
+    5915, 5913, 5914,
+    5701, 5915, 5703,
+    5913, 5915, 5916,
+    5915, 5701, 5917,
+    5915, 5917, 5916,
+    5701, 5918, 5917,
+    5919, 5916, 5917,
+    5701, 5920, 5918,
+    5920, 5701, 5698,
+    5920, 5698, 5697,
+    5921, 5919, 5917,
+    5921, 5917, 5918,
+    5919, 5921, 5922,
+    5919, 5922, 5916,
+    5923, 5921, 5918,
+    5922, 5924, 5916,
+    5913, 5916, 5924,
+    5921, 5925, 5922,
+    5921, 5923, 5925,
+    5926, 5922, 5925,
+    5922, 5926, 5924,
+    5927, 5926, 5925,
+    5926, 5928, 5924,
+    5926, 5927, 5928,
+    5929, 5913, 5924,
+    5929, 5924, 5928,
+    5913, 5929, 5912,
+    5929, 5930, 5912,
+    5910, 5912, 5930,
+    5931, 5929, 5928,
+    5929, 5931, 5930,
+    5932, 5910, 5930,
+    5910, 5932, 5909,
+    5931, 5933, 5930,
+    5932, 5930, 5933,
+    5931, 5928, 5934,
+    5927, 5934, 5928,
+    5935, 5931, 5934,
+    5931, 5935, 5933,
+    5927, 5936, 5934,
+    5935, 5934, 5937,
+    5936, 5937, 5934,
+    5936, 5927, 5938,
+    5927, 5925, 5938,
+    5923, 5938, 5925,
+    5936, 5938, 5939,
+    5936, 5939, 5937,
+    5938, 5923, 5940,
+    5938, 5940, 5939,
+    5923, 5941, 5940,
+    5942, 5939, 5940,
+    5941, 5923, 5943,
+    5923, 5918, 5943,
+    5920, 5943, 5918,
+    5920, 5944, 5943,
+    5944, 5920, 5697,
+    5944, 5945, 5943,
+    5941, 5943, 5945,
+    5944, 5697, 5946,
+    5694, 5946, 5697,
+    5694, 5687, 5946,
+    5687, 5947, 5946,
+    5948, 5944, 5946,
+    5948, 5946, 5947,
+    5944, 5948, 5945,
+    5949, 5948, 5947,
+    5948, 5950, 5945,
+    5948, 5949, 5950,
+    5951, 5945, 5950,
+    5951, 5941, 5945,
+    5949, 5952, 5950,
+    5949, 5953, 5952,
+    5954, 5951, 5950,
+    5954, 5950, 5952,
+    5951, 5955, 5941,
+    5951, 5954, 5955,
+    5955, 5940, 5941,
+    5955, 5942, 5940,
+    5954, 5956, 5955,
+    5942, 5955, 5956,
+    5954, 5957, 5956,
+    5957, 5954, 5952,
+    5957, 5952, 5958,
+    5953, 5958, 5952,
+    5953, 5959, 5958,
+    5960, 5957, 5958,
+    5957, 5960, 5956,
+    5959, 5961, 5958,
+    5960, 5958, 5961,
+    5962, 5956, 5960,
+    5962, 5942, 5956,
+    5963, 5960, 5961,
+    5963, 5962, 5960,
+    5963, 5961, 5964,
+    5962, 5963, 5964,
+    5965, 5964, 5961,
+    5959, 5965, 5961,
+    5962, 5964, 5966,
+    5942, 5962, 5966,
+    5965, 5959, 5967,
+    5959, 5968, 5967,
+    5969, 5970, 5968,
+    5970, 5967, 5968,
+    5970, 5971, 5967,
+    5971, 5972, 5967,
+    5965, 5967, 5972,
+    5971, 5973, 5972,
+    5974, 5965, 5972,
+    5965, 5974, 5964,
+    5973, 5975, 5972,
+    5974, 5972, 5975,
+    5973, 5976, 5975,
+    5974, 5966, 5964,
+    5976, 5897, 5975,
+    5977, 5974, 5975,
+    5977, 5975, 5897,
+    5895, 5977, 5897,
+    5977, 5895, 5896,
+    5977, 5896, 5978,
+    5974, 5977, 5978,
+    5899, 5978, 5896,
+    5899, 5904, 5978,
+    5904, 5979, 5978,
+    5974, 5978, 5979,
+    5904, 5907, 5979,
+    5980, 5974, 5979,
+    5974, 5980, 5966,
+    5907, 5981, 5979,
+    5980, 5979, 5981,
+    5907, 5982, 5981,
+    5982, 5907, 5909,
+    5982, 5909, 5932,
+    5983, 5982, 5932,
+    5983, 5932, 5933,
+    5982, 5983, 5984,
+    5983, 5933, 5984,
+    5982, 5984, 5981,
+    5935, 5984, 5933,
+    5985, 5981, 5984,
+    5935, 5985, 5984,
+    5985, 5980, 5981,
+    5985, 5935, 5937,
+    5980, 5985, 5986,
+    5985, 5937, 5986,
+    5980, 5986, 5966,
+    5939, 5986, 5937,
+    5942, 5966, 5986,
+    5939, 5942, 5986,
+    5987, 5988, 5989,
+    5987, 5989, 5990,
+    5987, 5991, 5988,
+    5992, 5987, 5990,
+    5987, 5992, 5991,
+    5993, 5990, 5989,
+    5992, 5990, 5994,
+    5995, 5993, 5989,
+    5993, 5996, 5990,
+    5996, 5994, 5990,
+    5995, 5989, 5997,
+    5988, 5997, 5989,
+    5998, 5995, 5997,
+    5988, 5999, 5997,
+    5995, 5998, 6000,
+    5995, 6000, 5993,
+    5998, 5997, 6001,
+    5999, 6001, 5997,
+    5998, 6002, 6000,
+    6003, 5998, 6001,
+    5998, 6003, 6002,
+    6000, 6004, 5993,
+    5996, 5993, 6004,
+    6000, 6005, 6004,
+    6005, 6000, 6002,
+    6006, 5996, 6004,
+    6005, 6007, 6004,
+    6006, 6004, 6007,
+    6008, 6005, 6002,
+    5996, 6006, 6009,
+    6008, 6002, 6010,
+    6003, 6010, 6002,
+    5996, 6009, 6011,
+    5994, 5996, 6011,
+    6012, 6011, 6009,
+    5994, 6011, 6013,
+    6012, 6014, 6011,
+    6014, 6013, 6011,
+    6015, 5994, 6013,
+    6015, 5992, 5994,
+    6014, 6016, 6013,
+    5992, 6015, 6017,
+    5992, 6017, 5991,
+    6015, 6013, 6018,
+    6016, 6018, 6013,
+    6015, 6019, 6017,
+    6020, 6015, 6018,
+    6015, 6020, 6019,
+    6016, 6021, 6018,
+    6020, 6018, 6022,
+    6021, 6022, 6018,
+    6023, 6020, 6022,
+    6021, 6016, 6024,
+    6020, 6023, 6025,
+    6020, 6025, 6019,
+    6021, 6026, 6022,
+    6026, 6021, 6027,
+    6021, 6024, 6027,
+    6026, 6028, 6022,
+    6023, 6022, 6028,
+    6026, 6029, 6028,
+    6030, 6023, 6028,
+    6029, 6026, 6031,
+    6026, 6027, 6031,
+    6029, 6032, 6028,
+    6030, 6028, 6032,
+    6029, 6033, 6032,
+    6034, 6030, 6032,
+    6033, 6029, 6035,
+    6029, 6031, 6035,
+    6033, 6036, 6032,
+    6034, 6032, 6036,
+    6033, 6037, 6036,
+    6038, 6034, 6036,
+    6037, 6033, 6039,
+    6033, 6035, 6039,
+    6037, 6040, 6036,
+    6038, 6036, 6040,
+    6040, 6037, 6041,
+    6042, 6038, 6040,
+    6042, 6040, 6043,
+    6040, 6041, 6043,
+    6042, 6044, 6038,
+    6042, 6043, 6044,
+    6044, 6045, 6038,
+    6034, 6038, 6045,
+    6046, 6034, 6045,
+    6046, 6045, 6044,
+    6034, 6046, 6030,
+    6046, 6047, 6030,
+    6023, 6030, 6047,
+    6048, 6046, 6044,
+    6046, 6048, 6047,
+    6049, 6023, 6047,
+    6023, 6049, 6025,
+    6049, 6047, 6050,
+    6048, 6050, 6047,
+    6051, 6049, 6050,
+    6051, 6052, 6049,
+    6052, 6025, 6049,
+    6051, 6050, 6053,
+    6051, 6053, 6052,
+    6050, 6054, 6053,
+    6050, 6048, 6054,
+    6053, 6055, 6052,
+    6052, 6056, 6025,
+    6056, 6052, 6055,
+    6056, 6019, 6025,
+    6053, 6057, 6055,
+    6057, 6053, 6054,
+    6056, 6058, 6019,
+    6058, 6017, 6019,
+    6058, 6056, 6059,
+    6058, 6060, 6017,
+    6060, 5991, 6017,
+    6058, 6059, 6061,
+    6060, 6058, 6061,
+    6056, 6062, 6059,
+    6062, 6056, 6055,
+    6062, 6055, 6063,
+    6057, 6063, 6055,
+    6064, 6059, 6062,
+    6065, 6062, 6063,
+    6065, 6064, 6062,
+    6064, 6066, 6059,
+    6066, 6061, 6059,
+    6064, 6065, 6067,
+    6066, 6064, 6068,
+    6064, 6067, 6068,
+    6066, 6069, 6061,
+    6066, 6068, 6070,
+    6069, 6066, 6070,
+    6069, 6071, 6061,
+    6060, 6061, 6071,
+    6069, 6070, 6072,
+    6073, 6060, 6071,
+    6069, 6074, 6071,
+    6074, 6069, 6072,
+    6073, 6071, 6075,
+    6074, 6075, 6071,
+    6060, 6073, 6076,
+    5991, 6060, 6076,
+    5991, 6076, 5988,
+    5999, 5988, 6076,
+    6077, 6076, 6073,
+    6077, 5999, 6076,
+    6078, 6077, 6073,
+    6078, 6073, 6075,
+    5999, 6077, 6079,
+    6078, 6080, 6077,
+    6080, 6079, 6077,
+    6081, 5999, 6079,
+    5999, 6081, 6001,
+    6080, 6082, 6079,
+    6081, 6083, 6001,
+    6003, 6001, 6083,
+    6081, 6079, 6084,
+    6082, 6084, 6079,
+    6085, 6081, 6084,
+    6081, 6085, 6083,
+    6085, 6084, 6086,
+    6085, 6086, 6083,
+    6084, 6087, 6086,
+    6084, 6082, 6087,
+    6088, 6083, 6086,
+    6088, 6003, 6083,
+    6089, 6088, 6086,
+    6089, 6086, 6087,
+    6003, 6088, 6090,
+    6003, 6090, 6010,
+    6088, 6089, 6091,
+    6088, 6091, 6090,
+    6090, 6092, 6010,
+    6090, 6093, 6092,
+    6093, 6090, 6091,
+    6010, 6092, 6094,
+    6093, 6094, 6092,
+    6095, 6010, 6094,
+    6095, 6008, 6010,
+    6095, 6094, 6096,
+    6008, 6095, 6097,
+    6095, 6096, 6097,
+    6008, 6097, 6098,
+    6005, 6008, 6098,
+    6099, 6098, 6097,
+    6005, 6098, 6100,
+    6007, 6005, 6100,
+    6099, 6101, 6098,
+    6101, 6100, 6098,
+    6102, 6099, 6097,
+    6099, 6102, 6101,
+    6102, 6097, 6096,
+    6101, 6103, 6100,
+    6102, 6104, 6101,
+    6103, 6101, 6104,
+    6103, 6105, 6100,
+    6007, 6100, 6105,
+    6106, 6103, 6104,
+    6103, 6106, 6105,
+    6107, 6007, 6105,
+    6107, 6006, 6007,
+    6106, 6108, 6105,
+    6107, 6105, 6108,
+    6006, 6107, 6109,
+    6006, 6109, 6009,
+    6110, 6107, 6108,
+    6107, 6110, 6109,
+    6111, 6009, 6109,
+    6111, 6012, 6009,
+    6112, 6109, 6110,
+    6112, 6111, 6109,
+    6113, 6112, 6110,
+    6012, 6111, 6114,
+    6113, 6110, 6115,
+    6110, 6108, 6115,
+    6113, 6115, 6116,
+    6112, 6113, 6116,
+    6117, 6115, 6108,
+    6106, 6117, 6108,
+    6111, 6112, 6118,
+    6112, 6116, 6118,
+    6111, 6118, 6114,
+    6119, 6116, 6115,
+    6117, 6119, 6115,
+    6120, 6118, 6116,
+    6119, 6120, 6116,
+    6121, 6114, 6118,
+    6120, 6121, 6118,
+    6121, 6122, 6114,
+    6122, 6123, 6114,
+    6012, 6114, 6123,
+    6014, 6012, 6123,
+    6014, 6123, 6124,
+    6016, 6014, 6124,
+    6016, 6124, 6024,
+    6125, 6124, 6123,
+    6122, 6125, 6123,
+    6126, 6024, 6124,
+    6125, 6126, 6124,
+    6126, 6127, 6024,
+    6127, 6027, 6024,
+    6126, 6125, 6128,
+    6127, 6129, 6027,
+    6129, 6031, 6027,
+    6127, 6126, 6130,
+    6126, 6128, 6130,
+    6129, 6127, 6131,
+    6127, 6130, 6131,
+    6129, 6132, 6031,
+    6132, 6035, 6031,
+    6132, 6129, 6133,
+    6129, 6131, 6133,
+    6132, 6134, 6035,
+    6134, 6039, 6035,
+    6134, 6132, 6135,
+    6132, 6133, 6135,
+    6134, 6136, 6039,
+    6137, 6135, 6133,
+    6138, 6137, 6133,
+    6138, 6133, 6131,
+    6139, 6138, 6131,
+    6139, 6131, 6130,
+    6140, 6139, 6130,
+    6140, 6130, 6128,
+    6141, 6140, 6128,
+    6137, 6142, 6135,
+    6141, 6128, 6143,
+    6125, 6143, 6128,
+    6125, 6122, 6143,
+    6144, 6141, 6143,
+    6141, 6144, 6145,
+    6122, 6146, 6143,
+    6144, 6143, 6146,
+    6122, 6121, 6146,
+    6144, 6147, 6145,
+    6148, 6145, 6147,
+    6149, 6148, 6147,
+    6144, 6150, 6147,
+    6150, 6144, 6146,
+    6149, 6147, 6151,
+    6150, 6151, 6147,
+    6152, 6149, 6151,
+    6150, 6146, 6153,
+    6121, 6153, 6146,
+    6121, 6120, 6153,
+    6151, 6150, 6154,
+    6155, 6150, 6153,
+    6150, 6155, 6154,
+    6151, 6154, 6156,
+    6156, 6154, 6155,
+    6152, 6151, 6156,
+    6152, 6156, 6157,
+    6156, 6158, 6157,
+    6159, 6157, 6158,
+    6156, 6160, 6158,
+    6160, 6156, 6155,
+    6160, 6155, 6161,
+    6160, 6161, 6158,
+    6155, 6153, 6161,
+    6120, 6161, 6153,
+    6162, 6158, 6161,
+    6120, 6162, 6161,
+    6162, 6159, 6158,
+    6162, 6120, 6163,
+    6162, 6163, 6164,
+    6159, 6162, 6164,
+    6120, 6165, 6163,
+    6164, 6163, 6165,
+    6165, 6120, 6166,
+    6120, 6167, 6166,
+    6120, 6119, 6167,
+    6165, 6166, 6168,
+    6119, 6169, 6167,
+    6119, 6117, 6169,
+    6170, 6167, 6169,
+    6170, 6171, 6167,
+    6171, 6166, 6167,
+    6172, 6170, 6169,
+    6170, 6172, 6171,
+    6171, 6173, 6166,
+    6173, 6168, 6166,
+    6173, 6171, 6174,
+    6172, 6174, 6171,
+    6173, 6175, 6168,
+    6175, 6173, 6174,
+    6172, 6176, 6174,
+    6175, 6174, 6177,
+    6176, 6177, 6174,
+    6176, 6172, 6178,
+    6172, 6169, 6178,
+    6117, 6178, 6169,
+    6176, 6178, 6179,
+    6177, 6176, 6179,
+    6117, 6180, 6178,
+    6180, 6179, 6178,
+    6117, 6106, 6180,
+    6106, 6104, 6180,
+    6181, 6180, 6104,
+    6180, 6181, 6179,
+    6102, 6181, 6104,
+    6181, 6102, 6096,
+    6181, 6182, 6179,
+    6177, 6179, 6182,
+    6183, 6177, 6182,
+    6183, 6175, 6177,
+    6175, 6183, 6184,
+    6183, 6182, 6184,
+    6175, 6184, 6168,
+    6185, 6184, 6182,
+    6181, 6185, 6182,
+    6186, 6168, 6184,
+    6185, 6186, 6184,
+    6186, 6165, 6168,
+    6186, 6164, 6165,
+    6186, 6185, 6187,
+    6164, 6186, 6188,
+    6185, 6189, 6187,
+    6185, 6181, 6189,
+    6186, 6187, 6190,
+    6186, 6190, 6188,
+    6187, 6191, 6190,
+    6192, 6188, 6190,
+    6187, 6193, 6191,
+    6193, 6187, 6189,
+    6194, 6190, 6191,
+    6194, 6192, 6190,
+    6195, 6194, 6191,
+    6192, 6194, 6196,
+    6194, 6195, 6196,
+    6195, 6191, 6197,
+    6193, 6197, 6191,
+    6198, 6195, 6197,
+    6198, 6199, 6195,
+    6199, 6196, 6195,
+    6198, 6197, 6200,
+    6199, 6198, 6200,
+    6201, 6200, 6197,
+    6193, 6201, 6197,
+    6199, 6200, 6202,
+    6199, 6203, 6196,
+    6203, 6199, 6202,
+    6203, 6204, 6196,
+    6192, 6196, 6204,
+    6203, 6202, 6205,
+    6204, 6203, 6205,
+    6206, 6192, 6204,
+    6192, 6206, 6188,
+    6206, 6204, 6207,
+    6206, 6207, 6188,
+    6204, 6205, 6207,
+    6164, 6188, 6207,
+    6159, 6164, 6207,
+    6159, 6207, 6205,
+    6208, 6159, 6205,
+    6208, 6205, 6202,
+    6159, 6208, 6209,
+    6208, 6210, 6209,
+    6211, 6209, 6210,
+    6212, 6211, 6210,
+    6213, 6208, 6202,
+    6208, 6213, 6210,
+    6213, 6202, 6200,
+    6212, 6210, 6214,
+    6213, 6214, 6210,
+    6215, 6212, 6214,
+    6201, 6213, 6200,
+    6215, 6214, 6216,
+    6217, 6215, 6216,
+    6218, 6216, 6214,
+    6213, 6218, 6214,
+    6217, 6216, 6219,
+    6220, 6217, 6219,
+    6218, 6221, 6216,
+    6221, 6219, 6216,
+    6218, 6213, 6222,
+    6221, 6218, 6223,
+    6218, 6222, 6223,
+    6213, 6224, 6222,
+    6223, 6222, 6224,
+    6213, 6225, 6224,
+    6213, 6201, 6225,
+    6226, 6223, 6224,
+    6201, 6227, 6225,
+    6225, 6228, 6224,
+    6226, 6224, 6228,
+    6229, 6227, 6201,
+    6193, 6229, 6201,
+    6230, 6225, 6227,
+    6229, 6230, 6227,
+    6225, 6230, 6228,
+    6229, 6193, 6231,
+    6229, 6231, 6232,
+    6230, 6229, 6232,
+    6193, 6233, 6231,
+    6234, 6232, 6231,
+    6193, 6235, 6233,
+    6235, 6193, 6189,
+    6236, 6234, 6231,
+    6236, 6231, 6233,
+    6234, 6236, 6237,
+    6234, 6237, 6232,
+    6238, 6236, 6233,
+    6237, 6239, 6232,
+    6230, 6232, 6239,
+    6236, 6240, 6237,
+    6236, 6238, 6240,
+    6241, 6237, 6240,
+    6237, 6241, 6239,
+    6238, 6242, 6240,
+    6243, 6241, 6240,
+    6243, 6240, 6242,
+    6241, 6244, 6239,
+    6241, 6243, 6244,
+    6245, 6239, 6244,
+    6245, 6230, 6239,
+    6243, 6246, 6244,
+    6247, 6245, 6244,
+    6247, 6244, 6246,
+    6243, 6248, 6246,
+    6248, 6243, 6242,
+    6248, 6249, 6246,
+    6248, 6242, 6249,
+    6250, 6246, 6249,
+    6250, 6247, 6246,
+    6242, 6251, 6249,
+    6242, 6238, 6251,
+    6238, 6233, 6251,
+    6235, 6251, 6233,
+    6252, 6249, 6251,
+    6235, 6252, 6251,
+    6252, 6250, 6249,
+    6252, 6235, 6253,
+    6235, 6189, 6253,
+    6181, 6253, 6189,
+    6253, 6181, 6254,
+    6181, 6096, 6254,
+    6094, 6254, 6096,
+    6094, 6093, 6254,
+    6253, 6254, 6255,
+    6093, 6255, 6254,
+    6252, 6253, 6255,
+    6093, 6256, 6255,
+    6256, 6093, 6091,
+    6252, 6255, 6257,
+    6256, 6257, 6255,
+    6258, 6252, 6257,
+    6252, 6258, 6250,
+    6256, 6259, 6257,
+    6258, 6260, 6250,
+    6247, 6250, 6260,
+    6258, 6257, 6261,
+    6259, 6261, 6257,
+    6262, 6258, 6261,
+    6258, 6262, 6260,
+    6259, 6263, 6261,
+    6262, 6261, 6264,
+    6263, 6264, 6261,
+    6262, 6265, 6260,
+    6265, 6262, 6264,
+    6266, 6260, 6265,
+    6266, 6247, 6260,
+    6267, 6266, 6265,
+    6267, 6265, 6268,
+    6265, 6264, 6268,
+    6266, 6267, 6269,
+    6267, 6268, 6269,
+    6247, 6266, 6270,
+    6266, 6269, 6270,
+    6247, 6270, 6271,
+    6245, 6247, 6271,
+    6272, 6270, 6269,
+    6245, 6271, 6273,
+    6230, 6245, 6273,
+    6274, 6271, 6270,
+    6272, 6274, 6270,
+    6274, 6275, 6271,
+    6275, 6273, 6271,
+    6274, 6272, 6276,
+    6275, 6274, 6277,
+    6274, 6276, 6277,
+    6275, 6278, 6273,
+    6275, 6277, 6279,
+    6278, 6275, 6279,
+    6278, 6280, 6273,
+    6230, 6273, 6280,
+    6278, 6281, 6280,
+    6282, 6230, 6280,
+    6281, 6278, 6283,
+    6278, 6279, 6283,
+    6281, 6284, 6280,
+    6282, 6280, 6284,
+    6281, 6285, 6284,
+    6281, 6283, 6285,
+    6286, 6282, 6284,
+    6285, 6287, 6284,
+    6286, 6284, 6287,
+    6283, 6288, 6285,
+    6289, 6285, 6288,
+    6285, 6289, 6287,
+    6290, 6288, 6283,
+    6290, 6289, 6288,
+    6291, 6290, 6283,
+    6291, 6283, 6279,
+    6289, 6290, 6292,
+    6293, 6291, 6279,
+    6293, 6279, 6277,
+    6291, 6294, 6290,
+    6294, 6292, 6290,
+    6291, 6293, 6295,
+    6294, 6291, 6296,
+    6297, 6291, 6295,
+    6291, 6297, 6296,
+    6298, 6295, 6293,
+    6297, 6295, 6298,
+    6299, 6293, 6277,
+    6299, 6298, 6293,
+    6299, 6277, 6276,
+    6298, 6299, 6300,
+    6301, 6299, 6276,
+    6299, 6301, 6300,
+    6301, 6276, 6302,
+    6272, 6302, 6276,
+    6303, 6301, 6302,
+    6272, 6304, 6302,
+    6304, 6272, 6269,
+    6304, 6269, 6268,
+    6304, 6305, 6302,
+    6303, 6302, 6305,
+    6306, 6304, 6268,
+    6304, 6306, 6305,
+    6306, 6268, 6264,
+    6263, 6306, 6264,
+    6306, 6263, 6307,
+    6308, 6306, 6307,
+    6306, 6308, 6305,
+    6309, 6307, 6263,
+    6308, 6307, 6309,
+    6259, 6309, 6263,
+    6259, 6256, 6309,
+    6256, 6091, 6309,
+    6089, 6309, 6091,
+    6089, 6308, 6309,
+    6089, 6310, 6308,
+    6310, 6305, 6308,
+    6310, 6089, 6087,
+    6310, 6303, 6305,
+    6310, 6087, 6311,
+    6303, 6310, 6311,
+    6303, 6311, 6301,
+    6082, 6311, 6087,
+    6311, 6300, 6301,
+    6311, 6082, 6300,
+    6082, 6312, 6300,
+    6082, 6080, 6312,
+    6298, 6300, 6312,
+    6080, 6313, 6312,
+    6080, 6078, 6313,
+    6314, 6298, 6312,
+    6314, 6312, 6313,
+    6314, 6297, 6298,
+    6078, 6315, 6313,
+    6078, 6075, 6315,
+    6316, 6314, 6313,
+    6316, 6313, 6315,
+    6314, 6317, 6297,
+    6317, 6296, 6297,
+    6314, 6316, 6318,
+    6317, 6314, 6318,
+    6317, 6319, 6296,
+    6317, 6318, 6320,
+    6319, 6317, 6320,
+    6319, 6321, 6296,
+    6294, 6296, 6321,
+    6319, 6320, 6322,
+    6323, 6294, 6321,
+    6294, 6323, 6292,
+    6319, 6324, 6321,
+    6324, 6319, 6322,
+    6323, 6321, 6325,
+    6324, 6325, 6321,
+    6326, 6323, 6325,
+    6326, 6325, 6324,
+    6323, 6326, 6327,
+    6323, 6327, 6292,
+    6328, 6326, 6324,
+    6328, 6324, 6329,
+    6324, 6322, 6329,
+    6330, 6329, 6322,
+    6326, 6328, 6331,
+    6326, 6331, 6327,
+    6328, 6332, 6331,
+    6333, 6331, 6332,
+    6220, 6333, 6332,
+    6334, 6327, 6331,
+    6333, 6334, 6331,
+    6333, 6220, 6335,
+    6220, 6219, 6335,
+    6334, 6333, 6336,
+    6333, 6335, 6336,
+    6334, 6337, 6327,
+    6337, 6292, 6327,
+    6337, 6289, 6292,
+    6337, 6334, 6338,
+    6334, 6336, 6338,
+    6289, 6337, 6339,
+    6337, 6338, 6339,
+    6289, 6339, 6287,
+    6340, 6287, 6339,
+    6340, 6286, 6287,
+    6341, 6339, 6338,
+    6341, 6340, 6339,
+    6342, 6341, 6338,
+    6342, 6338, 6336,
+    6340, 6341, 6343,
+    6344, 6342, 6336,
+    6344, 6336, 6335,
+    6341, 6342, 6345,
+    6341, 6345, 6343,
+    6342, 6344, 6346,
+    6342, 6346, 6345,
+    6347, 6344, 6335,
+    6347, 6335, 6219,
+    6221, 6347, 6219,
+    6344, 6347, 6348,
+    6344, 6348, 6346,
+    6347, 6221, 6349,
+    6347, 6349, 6348,
+    6221, 6223, 6349,
+    6350, 6348, 6349,
+    6351, 6349, 6223,
+    6351, 6350, 6349,
+    6226, 6351, 6223,
+    6350, 6352, 6348,
+    6350, 6351, 6352,
+    6352, 6346, 6348,
+    6351, 6353, 6352,
+    6351, 6226, 6353,
+    6352, 6354, 6346,
+    6354, 6352, 6353,
+    6354, 6345, 6346,
+    6354, 6355, 6345,
+    6355, 6354, 6353,
+    6355, 6343, 6345,
+    6355, 6353, 6356,
+    6226, 6356, 6353,
+    6355, 6357, 6343,
+    6357, 6355, 6356,
+    6357, 6358, 6343,
+    6340, 6343, 6358,
+    6286, 6340, 6358,
+    6286, 6358, 6359,
+    6282, 6286, 6359,
+    6357, 6360, 6358,
+    6360, 6359, 6358,
+    6360, 6357, 6361,
+    6357, 6356, 6361,
+    6360, 6362, 6359,
+    6363, 6361, 6356,
+    6360, 6361, 6363,
+    6362, 6360, 6363,
+    6226, 6363, 6356,
+    6363, 6226, 6228,
+    6362, 6363, 6364,
+    6363, 6228, 6364,
+    6362, 6364, 6359,
+    6282, 6359, 6364,
+    6230, 6364, 6228,
+    6230, 6282, 6364,
+    6365, 6366, 6367,
+    6365, 6367, 6368,
+    6365, 6369, 6366,
+    6365, 6368, 6369,
+    6366, 6370, 6367,
+    6367, 6371, 6368,
+    6074, 6367, 6370,
+    6367, 6074, 6371,
+    6075, 6074, 6370,
+    6075, 6370, 6315,
+    6074, 6072, 6371,
+    6372, 6315, 6370,
+    6366, 6372, 6370,
+    6372, 6316, 6315,
+    6372, 6366, 6373,
+    6369, 6373, 6366,
+    6372, 6374, 6316,
+    6374, 6372, 6373,
+    6374, 6318, 6316,
+    6374, 6375, 6318,
+    6375, 6320, 6318,
+    6375, 6374, 6376,
+    6374, 6373, 6376,
+    6375, 6377, 6320,
+    6375, 6376, 6377,
+    6377, 6322, 6320,
+    6377, 6330, 6322,
+    6330, 6377, 6378,
+    6376, 6378, 6377,
+    6379, 6330, 6378,
+    6376, 6380, 6378,
+    6380, 6376, 6373,
+    6369, 6380, 6373,
+    6379, 6378, 6381,
+    6380, 6381, 6378,
+    6382, 6379, 6381,
+    6380, 6369, 6383,
+    6368, 6383, 6369,
+    6380, 6384, 6381,
+    6384, 6380, 6383,
+    6382, 6381, 6385,
+    6384, 6385, 6381,
+    6386, 6382, 6385,
+    6386, 6385, 6387,
+    6388, 6386, 6387,
+    6388, 6387, 6389,
+    6390, 6387, 6385,
+    6384, 6390, 6385,
+    6387, 6391, 6389,
+    6387, 6390, 6391,
+    6392, 6389, 6391,
+    6390, 6384, 6393,
+    6384, 6383, 6393,
+    6390, 6394, 6391,
+    6395, 6393, 6383,
+    6368, 6395, 6383,
+    6395, 6368, 6371,
+    6390, 6393, 6396,
+    6394, 6390, 6396,
+    6395, 6397, 6393,
+    6397, 6396, 6393,
+    6398, 6395, 6371,
+    6398, 6371, 6072,
+    6397, 6395, 6399,
+    6395, 6398, 6399,
+    6400, 6398, 6072,
+    6400, 6072, 6070,
+    6400, 6401, 6398,
+    6401, 6399, 6398,
+    6402, 6400, 6070,
+    6400, 6402, 6401,
+    6402, 6070, 6068,
+    6403, 6402, 6068,
+    6403, 6068, 6067,
+    6402, 6404, 6401,
+    6402, 6403, 6404,
+    6405, 6401, 6404,
+    6401, 6405, 6399,
+    6403, 6406, 6404,
+    6405, 6407, 6399,
+    6397, 6399, 6407,
+    6408, 6405, 6404,
+    6408, 6404, 6406,
+    6405, 6408, 6409,
+    6405, 6409, 6407,
+    6410, 6397, 6407,
+    6397, 6410, 6396,
+    6409, 6411, 6407,
+    6410, 6407, 6411,
+    6410, 6412, 6396,
+    6394, 6396, 6412,
+    6413, 6410, 6411,
+    6410, 6413, 6412,
+    6414, 6394, 6412,
+    6413, 6415, 6412,
+    6414, 6412, 6415,
+    6414, 6416, 6394,
+    6416, 6391, 6394,
+    6416, 6392, 6391,
+    6414, 6417, 6416,
+    6417, 6414, 6415,
+    6392, 6416, 6418,
+    6417, 6418, 6416,
+    6419, 6392, 6418,
+    6419, 6418, 6420,
+    6421, 6419, 6420,
+    6417, 6422, 6418,
+    6422, 6420, 6418,
+    6421, 6420, 6423,
+    6424, 6421, 6423,
+    6422, 6425, 6420,
+    6425, 6423, 6420,
+    6424, 6423, 6426,
+    6427, 6424, 6426,
+    6425, 6428, 6423,
+    6428, 6426, 6423,
+    6427, 6426, 6429,
+    6430, 6427, 6429,
+    6428, 6431, 6426,
+    6431, 6429, 6426,
+    6430, 6429, 6432,
+    6433, 6430, 6432,
+    6431, 6434, 6429,
+    6434, 6432, 6429,
+    6433, 6432, 6435,
+    6436, 6433, 6435,
+    6434, 6437, 6432,
+    6437, 6435, 6432,
+    6436, 6435, 6438,
+    6439, 6436, 6438,
+    6437, 6440, 6435,
+    6440, 6438, 6435,
+    6439, 6438, 6441,
+    6442, 6439, 6441,
+    6440, 6443, 6438,
+    6443, 6441, 6438,
+    6442, 6441, 6444,
+    6445, 6442, 6444,
+    6443, 6446, 6441,
+    6446, 6444, 6441,
+    6445, 6444, 6447,
+    6448, 6445, 6447,
+    6446, 6449, 6444,
+    6449, 6447, 6444,
+    6448, 6447, 6450,
+    6451, 6448, 6450,
+    6449, 6452, 6447,
+    6452, 6450, 6447,
+    6451, 6450, 6453,
+    6454, 6451, 6453,
+    6452, 6455, 6450,
+    6455, 6453, 6450,
+    6454, 6453, 6456,
+    6457, 6454, 6456,
+    6457, 6456, 6458,
+    6459, 6456, 6453,
+    6455, 6459, 6453,
+    6456, 6460, 6458,
+    6456, 6459, 6460,
+    6461, 6458, 6460,
+    6462, 6461, 6460,
+    6462, 6460, 6463,
+    6459, 6463, 6460,
+    6464, 6462, 6463,
+    6459, 6465, 6463,
+    6459, 6455, 6465,
+    6464, 6463, 6466,
+    6465, 6466, 6463,
+    6467, 6464, 6466,
+    6455, 6468, 6465,
+    6455, 6452, 6468,
+    6465, 6469, 6466,
+    6469, 6465, 6468,
+    6467, 6466, 6470,
+    6469, 6470, 6466,
+    6471, 6467, 6470,
+    6470, 6469, 6472,
+    6471, 6470, 6473,
+    6470, 6472, 6473,
+    6471, 6473, 6474,
+    6475, 6471, 6474,
+    6476, 6473, 6472,
+    6475, 6474, 6477,
+    6478, 6475, 6477,
+    6479, 6474, 6473,
+    6476, 6479, 6473,
+    6479, 6480, 6474,
+    6480, 6477, 6474,
+    6480, 6479, 6481,
+    6480, 6482, 6477,
+    6482, 6480, 6481,
+    6478, 6477, 6483,
+    6482, 6483, 6477,
+    6484, 6478, 6483,
+    6484, 6483, 6485,
+    6486, 6484, 6485,
+    6486, 6485, 6487,
+    6488, 6485, 6483,
+    6482, 6488, 6483,
+    6485, 6489, 6487,
+    6485, 6488, 6489,
+    6490, 6487, 6489,
+    6488, 6482, 6491,
+    6482, 6481, 6491,
+    6492, 6490, 6489,
+    6490, 6492, 6493,
+    6492, 6489, 6494,
+    6488, 6494, 6489,
+    6492, 6495, 6493,
+    4791, 6493, 6495,
+    6496, 6492, 6494,
+    6492, 6496, 6495,
+    6494, 6488, 6497,
+    6488, 6491, 6497,
+    6496, 6494, 6498,
+    6494, 6497, 6498,
+    6496, 6498, 6499,
+    6496, 6499, 6495,
+    6500, 6498, 6497,
+    6501, 6495, 6499,
+    6501, 4791, 6495,
+    4791, 6501, 4790,
+    4794, 4790, 6501,
+    6502, 6501, 6499,
+    6502, 4794, 6501,
+    6502, 6499, 6503,
+    6498, 6503, 6499,
+    6498, 6500, 6503,
+    6502, 6504, 4794,
+    6504, 6502, 6503,
+    6504, 4796, 4794,
+    6504, 6503, 6505,
+    6500, 6505, 6503,
+    6504, 6506, 4796,
+    6506, 6504, 6505,
+    6506, 6507, 4796,
+    4793, 4796, 6507,
+    6506, 6505, 6508,
+    6509, 4793, 6507,
+    4793, 6509, 4795,
+    6509, 4799, 4795,
+    6506, 6510, 6507,
+    6510, 6506, 6508,
+    6509, 6507, 6511,
+    6510, 6511, 6507,
+    4799, 6509, 6512,
+    6513, 6509, 6511,
+    6509, 6513, 6512,
+    6510, 6514, 6511,
+    6513, 6511, 6515,
+    6514, 6515, 6511,
+    6514, 6510, 6516,
+    6510, 6508, 6516,
+    6514, 6517, 6515,
+    6514, 6516, 6518,
+    6517, 6514, 6518,
+    6519, 6518, 6516,
+    6517, 6520, 6515,
+    6521, 6519, 6516,
+    6521, 6516, 6508,
+    6517, 4830, 6520,
+    4830, 4827, 6520,
+    4825, 6520, 4827,
+    4830, 6517, 6522,
+    6517, 6518, 6522,
+    4825, 6523, 6520,
+    6523, 6515, 6520,
+    6523, 4825, 4823,
+    6523, 6513, 6515,
+    6524, 6523, 4823,
+    6523, 6524, 6513,
+    6524, 4823, 4820,
+    6524, 6512, 6513,
+    4818, 6524, 4820,
+    6524, 4818, 6512,
+    4818, 6525, 6512,
+    4818, 4815, 6525,
+    4799, 6512, 6525,
+    4815, 4811, 6525,
+    4801, 4799, 6525,
+    4801, 6525, 4811,
+    6526, 6527, 6528,
+    6526, 6528, 6529,
+    6526, 6530, 6527,
+    6531, 6526, 6529,
+    6526, 6531, 6530,
+    6532, 6529, 6528,
+    6531, 6529, 6533,
+    6532, 6534, 6529,
+    6534, 6533, 6529,
+    6535, 6532, 6528,
+    6534, 6532, 6536,
+    6535, 6528, 6537,
+    6527, 6537, 6528,
+    6532, 6535, 6538,
+    6532, 6538, 6536,
+    6539, 6535, 6537,
+    6535, 6540, 6538,
+    6535, 6539, 6541,
+    6540, 6535, 6541,
+    6539, 6537, 6542,
+    6543, 6538, 6540,
+    6544, 6539, 6542,
+    6543, 6545, 6538,
+    6545, 6536, 6538,
+    6544, 6546, 6539,
+    6546, 6541, 6539,
+    6544, 6547, 6546,
+    6544, 6542, 6547,
+    6546, 6048, 6541,
+    6547, 6054, 6546,
+    6048, 6546, 6054,
+    6547, 6057, 6054,
+    6048, 6548, 6541,
+    6540, 6541, 6548,
+    6057, 6547, 6549,
+    6542, 6549, 6547,
+    6550, 6057, 6549,
+    6057, 6550, 6063,
+    6542, 6551, 6549,
+    6551, 6542, 6537,
+    6527, 6551, 6537,
+    6550, 6549, 6552,
+    6551, 6552, 6549,
+    6550, 6553, 6063,
+    6065, 6063, 6553,
+    6554, 6550, 6552,
+    6550, 6554, 6553,
+    6555, 6065, 6553,
+    6065, 6555, 6067,
+    6554, 6556, 6553,
+    6555, 6553, 6556,
+    6557, 6067, 6555,
+    6557, 6403, 6067,
+    6403, 6557, 6406,
+    6558, 6557, 6555,
+    6558, 6555, 6556,
+    6557, 6559, 6406,
+    6557, 6558, 6559,
+    6560, 6406, 6559,
+    6560, 6408, 6406,
+    6558, 6561, 6559,
+    6408, 6560, 6562,
+    6408, 6562, 6409,
+    6563, 6560, 6559,
+    6563, 6559, 6561,
+    6560, 6564, 6562,
+    6560, 6563, 6564,
+    6565, 6409, 6562,
+    6409, 6565, 6411,
+    6566, 6565, 6562,
+    6566, 6562, 6564,
+    6565, 6567, 6411,
+    6413, 6411, 6567,
+    6565, 6566, 6568,
+    6565, 6568, 6567,
+    6569, 6413, 6567,
+    6413, 6569, 6415,
+    6568, 6570, 6567,
+    6569, 6567, 6570,
+    6569, 6571, 6415,
+    6417, 6415, 6571,
+    6422, 6417, 6571,
+    6569, 6572, 6571,
+    6572, 6569, 6570,
+    6422, 6571, 6573,
+    6572, 6573, 6571,
+    6425, 6422, 6573,
+    6425, 6573, 6574,
+    6428, 6425, 6574,
+    6572, 6575, 6573,
+    6575, 6574, 6573,
+    6428, 6574, 6576,
+    6431, 6428, 6576,
+    6575, 6577, 6574,
+    6577, 6576, 6574,
+    6431, 6576, 6578,
+    6434, 6431, 6578,
+    6577, 6579, 6576,
+    6579, 6578, 6576,
+    6434, 6578, 6580,
+    6437, 6434, 6580,
+    6579, 6581, 6578,
+    6581, 6580, 6578,
+    6437, 6580, 6582,
+    6440, 6437, 6582,
+    6581, 6583, 6580,
+    6583, 6582, 6580,
+    6440, 6582, 6584,
+    6443, 6440, 6584,
+    6583, 6585, 6582,
+    6585, 6584, 6582,
+    6443, 6584, 6586,
+    6446, 6443, 6586,
+    6585, 6587, 6584,
+    6587, 6586, 6584,
+    6446, 6586, 6588,
+    6449, 6446, 6588,
+    6587, 6589, 6586,
+    6589, 6588, 6586,
+    6449, 6588, 6590,
+    6452, 6449, 6590,
+    6452, 6590, 6468,
+    6591, 6590, 6588,
+    6589, 6591, 6588,
+    6592, 6468, 6590,
+    6591, 6592, 6590,
+    6592, 6469, 6468,
+    6469, 6592, 6593,
+    6469, 6593, 6472,
+    6592, 6591, 6594,
+    6592, 6594, 6593,
+    6595, 6472, 6593,
+    6595, 6476, 6472,
+    6596, 6593, 6594,
+    6596, 6595, 6593,
+    6476, 6595, 6597,
+    6596, 6598, 6595,
+    6598, 6597, 6595,
+    6599, 6476, 6597,
+    6476, 6599, 6479,
+    6599, 6481, 6479,
+    6599, 6600, 6481,
+    6600, 6491, 6481,
+    6599, 6597, 6601,
+    6600, 6599, 6601,
+    6600, 6602, 6491,
+    6602, 6497, 6491,
+    6602, 6500, 6497,
+    6602, 6600, 6603,
+    6600, 6601, 6603,
+    6500, 6602, 6604,
+    6602, 6603, 6604,
+    6500, 6604, 6505,
+    6604, 6508, 6505,
+    6604, 6521, 6508,
+    6521, 6604, 6603,
+    6605, 6521, 6603,
+    6605, 6603, 6601,
+    6606, 6605, 6601,
+    6606, 6601, 6597,
+    6598, 6606, 6597,
+    6605, 6606, 6607,
+    6606, 6598, 6608,
+    6606, 6608, 6607,
+    6598, 6609, 6608,
+    6598, 6596, 6609,
+    6610, 6607, 6608,
+    6611, 6608, 6609,
+    6611, 6610, 6608,
+    6605, 6607, 6612,
+    6521, 6605, 6612,
+    6610, 6613, 6607,
+    6613, 6612, 6607,
+    6521, 6612, 6614,
+    6519, 6521, 6614,
+    6613, 6615, 6612,
+    6615, 6614, 6612,
+    6615, 6613, 6616,
+    6613, 6610, 6616,
+    6615, 6617, 6614,
+    6618, 6616, 6610,
+    6611, 6618, 6610,
+    6615, 6616, 6619,
+    6617, 6615, 6619,
+    6618, 6620, 6616,
+    6620, 6619, 6616,
+    6618, 6611, 6621,
+    6620, 6618, 6622,
+    6618, 6621, 6622,
+    6620, 6623, 6619,
+    6611, 6624, 6621,
+    6624, 6611, 6609,
+    6623, 6620, 6625,
+    6620, 6622, 6625,
+    6624, 6609, 6626,
+    6596, 6626, 6609,
+    6627, 6624, 6626,
+    6626, 6596, 6628,
+    6627, 6629, 6624,
+    6629, 6621, 6624,
+    6627, 6626, 6630,
+    6626, 6628, 6630,
+    6629, 6627, 6631,
+    6627, 6630, 6631,
+    6629, 6632, 6621,
+    6632, 6622, 6621,
+    6632, 6629, 6633,
+    6629, 6631, 6633,
+    6632, 6634, 6622,
+    6634, 6625, 6622,
+    6634, 6632, 6635,
+    6632, 6633, 6635,
+    6634, 6636, 6625,
+    6634, 6635, 6637,
+    6636, 6634, 6637,
+    6636, 6638, 6625,
+    6623, 6625, 6638,
+    6636, 6637, 6639,
+    6636, 6640, 6638,
+    6640, 6636, 6639,
+    6641, 6623, 6638,
+    6640, 6642, 6638,
+    6641, 6638, 6642,
+    6623, 6641, 6643,
+    6623, 6643, 6619,
+    6617, 6619, 6643,
+    6641, 6644, 6643,
+    6645, 6617, 6643,
+    6645, 6643, 6644,
+    6617, 6645, 6646,
+    6617, 6646, 6614,
+    6519, 6614, 6646,
+    6647, 6519, 6646,
+    6519, 6647, 6518,
+    6647, 6522, 6518,
+    6647, 6646, 6648,
+    6645, 6648, 6646,
+    6647, 6649, 6522,
+    6649, 6647, 6648,
+    6649, 6650, 6522,
+    4830, 6522, 6650,
+    4829, 4830, 6650,
+    4829, 6650, 4832,
+    6651, 4832, 6650,
+    6649, 6651, 6650,
+    6651, 4841, 4832,
+    6651, 6649, 6652,
+    6651, 6652, 4841,
+    6649, 6648, 6652,
+    6652, 6653, 4841,
+    4839, 4841, 6653,
+    6654, 6652, 6648,
+    6652, 6654, 6653,
+    6645, 6654, 6648,
+    6654, 6645, 6644,
+    6654, 6655, 6653,
+    6654, 6644, 6656,
+    6655, 6654, 6656,
+    6657, 6656, 6644,
+    6641, 6657, 6644,
+    6657, 6641, 6642,
+    6657, 6658, 6656,
+    6657, 6642, 6659,
+    6658, 6657, 6659,
+    6660, 6659, 6642,
+    6640, 6660, 6642,
+    6658, 6659, 6661,
+    6660, 6640, 6662,
+    6640, 6639, 6662,
+    6660, 6663, 6659,
+    6663, 6661, 6659,
+    6663, 6660, 6664,
+    6660, 6662, 6664,
+    6663, 6665, 6661,
+    6663, 6664, 6666,
+    6665, 6663, 6666,
+    6667, 6664, 6662,
+    6668, 6666, 6664,
+    6667, 6668, 6664,
+    6669, 6667, 6662,
+    6669, 6662, 6639,
+    6668, 6667, 6670,
+    6671, 6669, 6639,
+    6671, 6639, 6637,
+    6667, 6669, 6672,
+    6667, 6672, 6670,
+    6669, 6671, 6673,
+    6669, 6673, 6672,
+    6674, 6671, 6637,
+    6674, 6637, 6635,
+    6671, 6675, 6673,
+    6671, 6674, 6675,
+    6676, 6674, 6635,
+    6676, 6635, 6633,
+    6674, 6677, 6675,
+    6674, 6676, 6677,
+    6678, 6676, 6633,
+    6678, 6633, 6631,
+    6676, 6679, 6677,
+    6676, 6678, 6679,
+    6680, 6678, 6631,
+    6680, 6631, 6630,
+    6678, 6681, 6679,
+    6682, 6680, 6630,
+    6682, 6630, 6628,
+    6678, 6680, 6683,
+    6681, 6678, 6683,
+    6682, 6684, 6680,
+    6684, 6683, 6680,
+    6684, 6682, 6685,
+    6684, 6686, 6683,
+    6682, 6687, 6685,
+    6687, 6682, 6628,
+    6684, 6685, 6688,
+    6686, 6684, 6688,
+    6689, 6685, 6687,
+    6686, 6690, 6683,
+    6681, 6683, 6690,
+    6686, 6691, 6690,
+    6686, 6688, 6691,
+    6692, 6681, 6690,
+    6691, 6693, 6690,
+    6692, 6690, 6693,
+    6692, 6694, 6681,
+    6694, 6679, 6681,
+    6695, 6692, 6693,
+    6692, 6695, 6694,
+    6694, 6696, 6679,
+    6696, 6677, 6679,
+    6695, 6697, 6694,
+    6696, 6694, 6697,
+    6696, 6698, 6677,
+    6698, 6675, 6677,
+    6699, 6696, 6697,
+    6696, 6699, 6698,
+    6698, 6700, 6675,
+    6700, 6673, 6675,
+    6699, 6701, 6698,
+    6700, 6698, 6701,
+    6700, 6702, 6673,
+    6702, 6672, 6673,
+    6702, 6703, 6672,
+    6703, 6670, 6672,
+    6702, 6700, 6704,
+    6703, 6702, 6705,
+    6702, 6704, 6705,
+    6670, 6703, 6706,
+    6670, 6706, 6707,
+    6668, 6670, 6707,
+    6703, 6708, 6706,
+    6668, 6707, 6709,
+    6668, 6709, 6666,
+    6710, 6707, 6706,
+    6709, 6711, 6666,
+    6665, 6666, 6711,
+    6707, 6712, 6709,
+    6707, 6710, 6712,
+    6713, 6709, 6712,
+    6709, 6713, 6711,
+    6710, 6714, 6712,
+    6715, 6713, 6712,
+    6715, 6712, 6714,
+    6713, 6716, 6711,
+    6713, 6715, 6717,
+    6718, 6711, 6716,
+    6718, 6665, 6711,
+    6716, 6713, 6719,
+    6713, 6717, 6719,
+    6720, 6718, 6716,
+    6665, 6718, 6721,
+    6665, 6721, 6661,
+    6718, 6720, 6722,
+    6718, 6722, 6721,
+    6720, 6716, 6723,
+    6716, 6719, 6723,
+    6720, 6724, 6722,
+    6720, 6723, 6724,
+    6725, 6722, 6724,
+    6723, 6726, 6724,
+    6727, 6725, 6724,
+    6727, 6724, 6726,
+    6725, 6728, 6722,
+    6728, 6721, 6722,
+    6727, 6729, 6725,
+    6728, 6730, 6721,
+    6730, 6661, 6721,
+    6730, 6658, 6661,
+    6658, 6730, 6731,
+    6658, 6731, 6656,
+    6655, 6656, 6731,
+    6730, 6732, 6731,
+    6730, 6728, 6732,
+    6733, 6655, 6731,
+    6733, 6731, 6732,
+    6733, 6734, 6655,
+    6734, 6653, 6655,
+    6734, 4839, 6653,
+    4839, 6734, 6735,
+    4839, 6735, 4838,
+    6734, 6733, 6736,
+    6734, 6736, 6735,
+    6733, 6737, 6736,
+    6737, 6733, 6732,
+    6738, 6735, 6736,
+    6737, 6732, 6739,
+    6728, 6739, 6732,
+    6740, 6736, 6737,
+    6740, 6738, 6736,
+    6741, 6737, 6739,
+    6741, 6740, 6737,
+    6741, 6739, 6740,
+    6739, 6742, 6740,
+    6739, 6728, 6742,
+    6738, 6740, 6742,
+    6728, 6725, 6742,
+    6729, 6742, 6725,
+    6729, 6738, 6742,
+    6738, 6729, 6743,
+    6744, 6743, 6729,
+    6727, 6744, 6729,
+    6744, 6727, 6726,
+    6745, 6738, 6743,
+    6744, 6726, 6746,
+    6738, 6745, 6747,
+    6735, 6738, 6747,
+    6735, 6747, 4838,
+    4837, 4838, 6747,
+    4850, 4837, 6747,
+    4850, 6747, 6745,
+    6748, 4850, 6745,
+    6748, 4852, 4850,
+    6748, 6745, 6749,
+    6745, 6743, 6749,
+    4852, 6748, 6750,
+    4852, 6750, 4853,
+    6748, 6751, 6750,
+    6748, 6749, 6751,
+    6752, 4853, 6750,
+    4853, 6752, 4855,
+    6753, 6750, 6751,
+    6753, 6752, 6750,
+    6752, 6754, 4855,
+    4857, 4855, 6754,
+    6752, 6753, 6755,
+    6756, 4857, 6754,
+    6754, 6752, 6757,
+    6752, 6755, 6757,
+    6756, 6754, 6758,
+    6754, 6757, 6758,
+    4857, 6756, 6759,
+    4857, 6759, 4859,
+    4862, 4859, 6759,
+    6756, 6760, 6759,
+    6756, 6758, 6760,
+    6761, 4862, 6759,
+    6761, 6759, 6760,
+    4862, 6761, 6762,
+    6763, 6761, 6760,
+    4862, 6762, 6764,
+    4864, 4862, 6764,
+    6761, 6765, 6762,
+    6761, 6763, 6765,
+    4864, 6764, 6766,
+    4866, 4864, 6766,
+    4866, 6766, 6767,
+    4872, 4866, 6767,
+    6768, 6766, 6764,
+    4872, 6767, 6769,
+    4873, 4872, 6769,
+    4873, 6769, 4875,
+    6770, 6767, 6766,
+    6768, 6770, 6766,
+    6771, 6769, 6767,
+    6770, 6771, 6767,
+    6772, 4875, 6769,
+    6771, 6772, 6769,
+    6772, 4881, 4875,
+    4881, 6772, 4884,
+    6773, 4884, 6772,
+    6771, 6773, 6772,
+    6773, 4890, 4884,
+    6773, 6771, 6774,
+    6771, 6770, 6774,
+    4890, 6773, 6775,
+    6773, 6774, 6775,
+    4890, 6775, 4891,
+    6775, 4896, 4891,
+    6775, 6776, 4896,
+    6776, 6775, 6774,
+    6776, 4897, 4896,
+    6777, 6776, 6774,
+    6777, 6774, 6770,
+    6776, 6778, 4897,
+    6776, 6777, 6778,
+    6778, 4899, 4897,
+    6768, 6777, 6770,
+    6778, 6779, 4899,
+    6779, 4901, 4899,
+    6777, 6780, 6778,
+    6779, 6778, 6780,
+    6777, 6768, 6780,
+    4901, 6779, 6781,
+    4901, 6781, 4903,
+    4906, 4903, 6781,
+    6779, 6782, 6781,
+    6783, 4906, 6781,
+    6783, 6781, 6782,
+    4906, 6783, 6784,
+    4906, 6784, 4905,
+    6784, 4908, 4905,
+    6784, 6785, 4908,
+    6785, 4912, 4908,
+    6783, 6786, 6784,
+    6785, 6784, 6786,
+    6783, 6787, 6786,
+    6787, 6783, 6782,
+    6788, 6785, 6786,
+    6787, 6789, 6786,
+    6788, 6786, 6789,
+    6785, 6788, 6790,
+    6785, 6790, 4912,
+    6791, 6788, 6789,
+    6790, 6792, 4912,
+    4913, 4912, 6792,
+    6788, 6793, 6790,
+    6788, 6791, 6793,
+    6794, 6790, 6793,
+    6790, 6794, 6792,
+    6795, 4913, 6792,
+    4913, 6795, 4926,
+    6795, 6792, 6796,
+    6794, 6796, 6792,
+    6797, 4926, 6795,
+    6797, 4928, 4926,
+    6798, 6795, 6796,
+    6798, 6797, 6795,
+    4928, 6797, 6799,
+    4928, 6799, 4930,
+    6797, 6798, 6800,
+    6797, 6800, 6799,
+    6798, 6801, 6800,
+    6798, 6796, 6801,
+    6802, 6799, 6800,
+    6796, 6803, 6801,
+    6796, 6794, 6803,
+    6804, 6800, 6801,
+    6804, 6802, 6800,
+    6805, 6804, 6801,
+    6805, 6801, 6803,
+    6802, 6804, 6806,
+    6804, 6805, 6807,
+    6804, 6807, 6806,
+    6808, 6805, 6803,
+    6805, 6809, 6807,
+    6805, 6808, 6809,
+    6808, 6803, 6810,
+    6794, 6810, 6803,
+    6808, 6811, 6809,
+    6812, 6808, 6810,
+    6808, 6812, 6811,
+    6810, 6794, 6813,
+    6812, 6810, 6814,
+    6810, 6813, 6814,
+    6794, 6815, 6813,
+    6815, 6794, 6793,
+    6816, 6814, 6813,
+    6815, 6793, 6817,
+    6791, 6817, 6793,
+    6818, 6813, 6815,
+    6818, 6816, 6813,
+    6819, 6815, 6817,
+    6819, 6818, 6815,
+    6819, 6817, 6820,
+    6819, 6820, 6818,
+    6817, 6821, 6820,
+    6817, 6791, 6821,
+    6820, 6822, 6818,
+    6816, 6818, 6822,
+    6820, 6823, 6822,
+    6823, 6820, 6821,
+    6824, 6816, 6822,
+    6823, 6825, 6822,
+    6824, 6822, 6825,
+    6816, 6824, 6826,
+    6816, 6826, 6814,
+    6827, 6824, 6825,
+    6826, 6828, 6814,
+    6812, 6814, 6828,
+    6824, 6829, 6826,
+    6824, 6827, 6829,
+    6830, 6826, 6829,
+    6826, 6830, 6828,
+    6831, 6812, 6828,
+    6812, 6831, 6811,
+    6830, 6832, 6828,
+    6831, 6828, 6832,
+    6830, 6833, 6832,
+    6834, 6831, 6832,
+    6830, 6835, 6833,
+    6835, 6830, 6829,
+    6833, 6836, 6832,
+    6834, 6832, 6836,
+    6835, 6837, 6833,
+    6834, 6838, 6831,
+    6838, 6811, 6831,
+    6838, 6839, 6811,
+    6839, 6809, 6811,
+    6838, 6834, 6840,
+    6839, 6841, 6809,
+    6841, 6807, 6809,
+    6839, 6838, 6842,
+    6838, 6840, 6842,
+    6841, 6839, 6843,
+    6839, 6842, 6843,
+    6841, 6844, 6807,
+    6844, 6806, 6807,
+    6844, 6841, 6845,
+    6841, 6843, 6845,
+    6844, 6846, 6806,
+    6844, 6845, 6847,
+    6846, 6844, 6847,
+    6846, 6848, 6806,
+    6802, 6806, 6848,
+    6846, 6847, 6849,
+    6850, 6802, 6848,
+    6802, 6850, 6799,
+    6850, 4930, 6799,
+    6850, 4932, 4930,
+    6850, 6848, 6851,
+    4932, 6850, 6851,
+    6846, 6852, 6848,
+    6852, 6851, 6848,
+    6852, 6846, 6849,
+    4932, 6851, 6853,
+    4932, 6853, 4934,
+    6851, 6852, 6854,
+    6851, 6854, 6853,
+    6855, 4934, 6853,
+    6855, 4935, 4934,
+    6856, 6853, 6854,
+    6856, 6855, 6853,
+    4935, 6855, 6857,
+    6855, 6856, 6858,
+    6855, 6858, 6857,
+    4935, 6857, 6859,
+    4937, 4935, 6859,
+    6860, 6857, 6858,
+    4937, 6859, 6861,
+    4939, 4937, 6861,
+    6862, 6859, 6857,
+    6860, 6862, 6857,
+    6862, 6863, 6859,
+    6863, 6861, 6859,
+    6862, 6860, 5005,
+    6863, 6862, 6864,
+    6862, 5005, 6864,
+    6860, 5007, 5005,
+    4992, 6864, 5005,
+    4992, 4989, 6864,
+    6860, 6865, 5007,
+    6865, 5016, 5007,
+    6865, 6860, 6858,
+    6865, 5019, 5016,
+    6865, 6858, 6866,
+    5019, 6865, 6866,
+    6856, 6866, 6858,
+    5019, 6866, 6867,
+    5041, 5019, 6867,
+    5041, 6867, 5043,
+    6856, 6868, 6866,
+    6868, 6867, 6866,
+    6868, 6856, 6854,
+    6869, 5043, 6867,
+    6868, 6869, 6867,
+    5043, 6869, 5046,
+    6868, 6854, 6870,
+    6869, 6868, 6870,
+    6852, 6870, 6854,
+    6869, 6870, 6871,
+    6869, 6871, 5046,
+    6870, 6852, 6872,
+    6870, 6872, 6871,
+    6852, 6849, 6872,
+    6873, 5046, 6871,
+    6873, 5048, 5046,
+    6874, 6871, 6872,
+    6874, 6873, 6871,
+    5048, 6873, 6875,
+    5048, 6875, 5049,
+    6873, 6876, 6875,
+    6873, 6874, 6876,
+    6877, 5049, 6875,
+    6877, 5051, 5049,
+    5051, 6877, 5056,
+    6878, 6877, 6875,
+    6878, 6875, 6876,
+    6878, 6879, 6877,
+    6879, 5056, 6877,
+    6880, 6878, 6876,
+    6878, 6880, 6879,
+    6880, 6876, 6881,
+    6874, 6881, 6876,
+    6880, 6882, 6879,
+    6883, 6880, 6881,
+    6880, 6883, 6882,
+    6884, 6879, 6882,
+    6879, 6884, 5056,
+    6883, 6885, 6882,
+    6884, 6886, 5056,
+    5055, 5056, 6886,
+    5058, 5055, 6886,
+    5058, 6886, 6887,
+    5058, 6887, 5079,
+    6886, 6888, 6887,
+    6886, 6884, 6888,
+    6889, 5079, 6887,
+    6889, 5080, 5079,
+    6890, 6889, 6887,
+    6890, 6887, 6888,
+    5080, 6889, 6891,
+    5084, 5080, 6891,
+    5084, 6891, 5095,
+    6890, 6892, 6889,
+    6892, 6891, 6889,
+    6890, 6893, 6892,
+    6893, 6890, 6888,
+    6892, 6894, 6891,
+    6894, 5095, 6891,
+    6893, 6895, 6892,
+    6894, 6892, 6895,
+    6893, 6888, 6896,
+    6884, 6896, 6888,
+    6897, 6893, 6896,
+    6893, 6897, 6895,
+    6884, 6898, 6896,
+    6898, 6884, 6882,
+    6898, 6882, 6885,
+    6898, 6899, 6896,
+    6897, 6896, 6899,
+    6900, 6898, 6885,
+    6898, 6900, 6899,
+    6901, 6897, 6899,
+    6900, 6902, 6899,
+    6901, 6899, 6902,
+    6897, 6901, 6903,
+    6897, 6903, 6895,
+    6904, 6901, 6902,
+    6905, 6895, 6903,
+    6905, 6894, 6895,
+    6901, 6906, 6903,
+    6901, 6904, 6906,
+    6907, 6905, 6903,
+    6907, 6903, 6906,
+    6894, 6905, 6908,
+    6907, 6909, 6905,
+    6909, 6908, 6905,
+    6910, 6894, 6908,
+    6894, 6910, 5095,
+    6910, 5092, 5095,
+    6910, 6911, 5092,
+    6911, 5093, 5092,
+    6911, 6910, 6912,
+    6910, 6908, 6912,
+    6911, 6913, 5093,
+    6911, 6912, 6913,
+    6913, 5096, 5093,
+    6914, 6912, 6908,
+    6909, 6914, 6908,
+    6912, 6915, 6913,
+    6912, 6914, 6915,
+    6913, 6916, 5096,
+    6916, 6913, 6915,
+    6916, 6917, 5096,
+    5094, 5096, 6917,
+    5101, 5094, 6917,
+    5101, 6917, 6918,
+    5104, 5101, 6918,
+    6919, 6918, 6917,
+    6916, 6919, 6917,
+    5104, 6918, 6920,
+    5108, 5104, 6920,
+    6919, 6921, 6918,
+    6921, 6920, 6918,
+    5108, 6920, 6922,
+    5113, 5108, 6922,
+    5113, 6922, 5117,
+    6923, 6922, 6920,
+    6921, 6923, 6920,
+    6924, 5117, 6922,
+    6923, 6924, 6922,
+    5117, 6924, 6925,
+    5117, 6925, 5118,
+    5122, 5118, 6925,
+    6924, 6923, 6926,
+    6927, 5122, 6925,
+    6924, 6928, 6925,
+    6927, 6925, 6928,
+    6928, 6924, 6929,
+    6924, 6926, 6929,
+    6930, 6927, 6928,
+    6928, 6929, 6931,
+    6930, 6928, 6931,
+    6930, 5431, 6927,
+    6930, 6931, 6932,
+    5431, 6930, 6932,
+    5431, 6932, 5341,
+    5339, 5341, 6932,
+    5431, 6933, 6927,
+    5122, 6927, 6933,
+    5431, 5428, 6933,
+    5126, 5122, 6933,
+    5428, 6934, 6933,
+    5126, 6933, 6934,
+    6934, 5428, 5429,
+    5127, 5126, 6934,
+    6934, 5429, 6935,
+    5127, 6934, 6935,
+    6936, 6935, 5429,
+    5427, 6936, 5429,
+    6936, 5427, 5430,
+    5127, 6935, 6937,
+    6938, 6936, 5430,
+    6938, 5430, 5434,
+    6936, 6939, 6935,
+    6939, 6937, 6935,
+    6940, 6938, 5434,
+    6939, 6941, 6937,
+    6940, 5434, 6942,
+    5436, 6942, 5434,
+    5436, 5439, 6942,
+    6943, 6940, 6942,
+    6940, 6943, 6938,
+    5439, 6944, 6942,
+    6943, 6942, 6944,
+    5439, 6945, 6944,
+    6945, 5439, 5441,
+    6946, 6943, 6944,
+    6945, 5441, 6947,
+    5442, 6947, 5441,
+    6945, 6948, 6944,
+    6946, 6944, 6948,
+    6949, 6945, 6947,
+    6945, 6949, 6948,
+    5442, 6950, 6947,
+    6950, 5442, 5444,
+    6950, 5444, 5447,
+    6951, 6950, 5447,
+    6951, 5447, 5450,
+    6950, 6951, 6952,
+    6951, 5450, 6952,
+    6950, 6952, 6947,
+    6949, 6947, 6952,
+    6953, 6952, 5450,
+    6953, 6949, 6952,
+    5451, 6953, 5450,
+    6949, 6953, 6954,
+    6949, 6954, 6948,
+    6953, 5451, 6955,
+    6953, 6955, 6954,
+    5451, 5453, 6955,
+    5215, 6955, 5453,
+    5215, 5213, 6955,
+    5213, 6954, 6955,
+    5213, 6956, 6954,
+    6956, 6948, 6954,
+    6956, 5213, 5208,
+    6956, 6946, 6948,
+    6956, 5208, 6957,
+    6946, 6956, 6957,
+    5207, 6957, 5208,
+    6946, 6957, 6958,
+    6943, 6946, 6958,
+    6943, 6958, 6938,
+    6936, 6938, 6958,
+    6959, 6958, 6957,
+    6959, 6936, 6958,
+    5207, 6959, 6957,
+    5207, 5205, 6959,
+    6936, 6959, 6960,
+    5205, 6960, 6959,
+    6939, 6936, 6960,
+    5205, 5204, 6960,
+    6939, 6960, 6961,
+    5204, 6961, 6960,
+    6941, 6939, 6961,
+    6961, 5204, 6962,
+    6941, 6961, 6963,
+    6961, 6962, 6963,
+    6941, 6963, 6937,
+    5204, 5202, 6962,
+    6964, 6937, 6963,
+    6964, 5127, 6937,
+    5127, 6964, 5136,
+    6965, 6964, 6963,
+    6965, 6963, 6962,
+    6966, 5136, 6964,
+    6965, 6966, 6964,
+    6966, 5137, 5136,
+    6967, 6965, 6962,
+    6965, 6967, 6966,
+    6967, 6962, 5202,
+    5137, 6966, 6968,
+    6967, 6968, 6966,
+    5144, 5137, 6968,
+    5144, 6968, 5155,
+    6967, 6969, 6968,
+    6969, 5155, 6968,
+    6969, 6967, 5202,
+    6969, 5185, 5155,
+    6969, 5202, 5188,
+    5185, 6969, 5188,
+    6970, 6689, 6687,
+    6970, 6687, 6971,
+    6687, 6628, 6971,
+    6596, 6971, 6628,
+    6971, 6596, 6594,
+    6970, 6971, 6972,
+    6971, 6594, 6972,
+    6970, 6972, 6689,
+    6591, 6972, 6594,
+    6972, 6591, 6973,
+    6972, 6973, 6689,
+    6591, 6589, 6973,
+    6974, 6689, 6973,
+    6689, 6974, 6685,
+    6974, 6688, 6685,
+    6975, 6973, 6589,
+    6975, 6974, 6973,
+    6587, 6975, 6589,
+    6587, 6585, 6975,
+    6585, 6976, 6975,
+    6974, 6975, 6976,
+    6585, 6583, 6976,
+    6583, 6977, 6976,
+    6583, 6581, 6977,
+    6978, 6974, 6976,
+    6978, 6976, 6977,
+    6974, 6978, 6979,
+    6688, 6974, 6979,
+    6688, 6979, 6691,
+    6980, 6691, 6979,
+    6691, 6980, 6693,
+    6981, 6979, 6978,
+    6981, 6980, 6979,
+    6982, 6981, 6978,
+    6982, 6978, 6977,
+    6982, 6977, 6983,
+    6581, 6983, 6977,
+    6581, 6579, 6983,
+    6984, 6982, 6983,
+    6982, 6984, 6981,
+    6579, 6985, 6983,
+    6984, 6983, 6985,
+    6579, 6577, 6985,
+    6984, 6986, 6981,
+    6980, 6981, 6986,
+    6987, 6984, 6985,
+    6984, 6987, 6986,
+    6577, 6988, 6985,
+    6987, 6985, 6988,
+    6577, 6575, 6988,
+    6575, 6989, 6988,
+    6575, 6572, 6989,
+    6572, 6570, 6989,
+    6990, 6988, 6989,
+    6990, 6987, 6988,
+    6991, 6989, 6570,
+    6991, 6990, 6989,
+    6568, 6991, 6570,
+    6987, 6990, 6992,
+    6987, 6992, 6986,
+    6990, 6991, 6993,
+    6990, 6993, 6992,
+    6991, 6568, 6994,
+    6566, 6994, 6568,
+    6991, 6995, 6993,
+    6995, 6991, 6994,
+    6566, 6996, 6994,
+    6996, 6566, 6564,
+    6995, 6994, 6997,
+    6996, 6997, 6994,
+    6996, 6564, 6998,
+    6563, 6998, 6564,
+    6996, 6999, 6997,
+    6999, 6996, 6998,
+    6563, 7000, 6998,
+    7000, 6563, 6561,
+    7000, 7001, 6998,
+    6999, 6998, 7001,
+    7000, 6561, 7002,
+    7000, 7002, 7001,
+    6561, 7003, 7002,
+    6561, 6558, 7003,
+    6558, 6556, 7003,
+    7004, 7003, 6556,
+    6554, 7004, 6556,
+    7005, 7002, 7003,
+    7004, 7005, 7003,
+    7004, 6554, 7006,
+    6554, 6552, 7006,
+    7005, 7004, 7007,
+    7004, 7006, 7007,
+    7002, 7005, 7008,
+    7002, 7008, 7001,
+    7005, 7009, 7008,
+    7005, 7007, 7009,
+    7010, 7001, 7008,
+    7010, 6999, 7001,
+    7011, 7010, 7008,
+    7011, 7008, 7009,
+    6999, 7010, 7012,
+    6999, 7012, 6997,
+    7010, 7011, 7013,
+    7010, 7013, 7012,
+    7014, 6997, 7012,
+    7014, 6995, 6997,
+    7015, 7012, 7013,
+    7015, 7014, 7012,
+    7014, 7016, 6995,
+    7016, 6993, 6995,
+    7014, 7015, 7017,
+    7016, 7014, 7017,
+    7016, 7018, 6993,
+    7018, 6992, 6993,
+    7016, 7017, 7019,
+    7018, 7016, 7019,
+    7018, 7020, 6992,
+    7020, 6986, 6992,
+    7020, 6980, 6986,
+    7020, 7018, 7021,
+    7018, 7019, 7021,
+    6980, 7020, 7022,
+    7020, 7021, 7022,
+    6980, 7022, 6693,
+    6695, 6693, 7022,
+    7023, 6695, 7022,
+    7023, 7022, 7021,
+    6695, 7023, 6697,
+    7024, 7023, 7021,
+    7024, 7021, 7019,
+    7023, 7025, 6697,
+    7023, 7024, 7025,
+    6699, 6697, 7025,
+    7026, 7024, 7019,
+    7026, 7019, 7017,
+    7024, 7027, 7025,
+    7024, 7026, 7027,
+    7028, 6699, 7025,
+    7028, 7025, 7027,
+    6699, 7028, 6701,
+    7029, 7028, 7027,
+    7028, 7030, 6701,
+    7028, 7029, 7030,
+    7031, 6701, 7030,
+    7031, 6700, 6701,
+    7029, 7032, 7030,
+    6700, 7031, 7033,
+    6700, 7033, 6704,
+    7034, 7031, 7030,
+    7034, 7030, 7032,
+    7031, 7035, 7033,
+    7031, 7034, 7035,
+    7036, 7033, 7035,
+    7034, 7037, 7035,
+    7036, 7038, 7033,
+    7038, 6704, 7033,
+    7039, 7036, 7035,
+    7039, 7035, 7037,
+    7038, 7036, 7040,
+    7036, 7039, 7040,
+    7038, 7041, 6704,
+    7041, 6705, 6704,
+    7041, 7038, 7042,
+    7038, 7040, 7042,
+    7041, 7043, 6705,
+    7041, 7042, 7043,
+    7043, 7044, 6705,
+    6703, 6705, 7044,
+    6708, 6703, 7044,
+    7043, 7045, 7044,
+    6708, 7044, 7046,
+    7045, 7046, 7044,
+    7045, 7043, 7047,
+    7042, 7047, 7043,
+    7045, 7048, 7046,
+    7048, 7045, 7047,
+    7042, 7049, 7047,
+    7049, 7042, 7040,
+    7048, 7047, 7050,
+    7049, 7050, 7047,
+    7051, 7048, 7050,
+    7052, 7049, 7040,
+    7052, 7040, 7039,
+    7048, 7051, 7053,
+    7048, 7053, 7046,
+    7054, 7052, 7039,
+    7054, 7039, 7037,
+    7054, 7055, 7052,
+    7054, 7037, 7056,
+    7055, 7054, 7056,
+    7057, 7056, 7037,
+    7034, 7057, 7037,
+    7057, 7034, 7032,
+    7057, 7058, 7056,
+    7057, 7032, 7059,
+    7058, 7057, 7059,
+    7060, 7059, 7032,
+    7029, 7060, 7032,
+    7058, 7059, 7061,
+    7060, 7029, 7062,
+    7029, 7027, 7062,
+    7026, 7062, 7027,
+    7059, 7060, 7063,
+    7059, 7063, 7061,
+    7060, 7062, 7064,
+    7060, 7064, 7063,
+    7062, 7026, 7065,
+    7062, 7065, 7064,
+    7026, 7066, 7065,
+    7066, 7026, 7017,
+    7066, 7017, 7015,
+    7067, 7066, 7015,
+    7067, 7015, 7013,
+    7067, 7068, 7066,
+    7068, 7065, 7066,
+    7067, 7013, 7069,
+    7068, 7067, 7069,
+    7011, 7069, 7013,
+    7068, 7070, 7065,
+    7070, 7064, 7065,
+    7068, 7069, 7071,
+    7070, 7068, 7071,
+    7011, 7072, 7069,
+    7072, 7071, 7069,
+    7072, 7011, 7009,
+    7070, 7071, 7073,
+    7072, 7009, 7074,
+    7007, 7074, 7009,
+    7072, 7075, 7071,
+    7075, 7072, 7074,
+    7075, 7073, 7071,
+    7007, 7076, 7074,
+    7076, 7007, 7006,
+    7075, 7074, 7077,
+    7076, 7077, 7074,
+    7078, 7076, 7006,
+    7078, 7006, 6552,
+    6551, 7078, 6552,
+    7076, 7078, 7079,
+    7076, 7079, 7077,
+    7078, 6551, 7080,
+    7078, 7080, 7079,
+    6551, 7081, 7080,
+    7079, 7082, 7077,
+    7081, 6551, 7083,
+    6551, 6527, 7083,
+    6530, 7083, 6527,
+    7081, 7083, 7084,
+    6530, 7085, 7083,
+    7085, 7084, 7083,
+    7086, 7081, 7084,
+    7086, 7087, 7081,
+    7086, 7084, 7087,
+    7087, 7080, 7081,
+    7084, 7088, 7087,
+    7084, 7085, 7088,
+    7087, 7089, 7080,
+    7089, 7087, 7088,
+    7089, 7079, 7080,
+    7079, 7089, 7082,
+    7090, 7089, 7088,
+    7090, 7088, 7091,
+    7085, 7091, 7088,
+    7089, 7090, 7092,
+    7093, 7090, 7091,
+    7094, 7089, 7092,
+    7089, 7094, 7082,
+    7093, 7095, 7090,
+    7095, 7092, 7090,
+    7093, 7096, 7095,
+    7093, 7091, 7096,
+    7095, 7097, 7092,
+    7091, 7098, 7096,
+    7091, 7085, 7098,
+    7096, 7099, 7095,
+    7097, 7095, 7099,
+    7096, 7100, 7099,
+    7100, 7096, 7098,
+    7101, 7097, 7099,
+    7100, 7102, 7099,
+    7101, 7099, 7102,
+    7103, 7101, 7102,
+    7103, 7102, 7104,
+    7103, 7104, 7101,
+    7102, 7105, 7104,
+    7102, 7100, 7105,
+    7104, 7106, 7101,
+    7097, 7101, 7106,
+    7104, 7107, 7106,
+    7107, 7104, 7105,
+    7108, 7097, 7106,
+    7107, 7109, 7106,
+    7108, 7106, 7109,
+    7097, 7108, 7110,
+    7111, 7108, 7109,
+    7112, 7097, 7110,
+    7097, 7112, 7092,
+    7094, 7092, 7112,
+    7113, 7094, 7112,
+    7113, 7112, 7114,
+    7113, 7114, 7094,
+    7112, 7110, 7114,
+    7114, 7082, 7094,
+    7114, 7115, 7082,
+    7115, 7114, 7110,
+    7115, 7077, 7082,
+    7115, 7075, 7077,
+    7075, 7115, 7073,
+    7116, 7115, 7110,
+    7116, 7110, 7108,
+    7111, 7116, 7108,
+    7115, 7116, 7117,
+    7115, 7117, 7073,
+    7116, 7111, 7118,
+    7116, 7118, 7117,
+    7111, 7119, 7118,
+    7111, 7109, 7119,
+    7120, 7117, 7118,
+    7109, 7121, 7119,
+    7109, 7107, 7121,
+    7122, 7118, 7119,
+    7122, 7120, 7118,
+    7123, 7122, 7119,
+    7123, 7119, 7121,
+    7120, 7122, 7061,
+    7120, 7061, 7063,
+    7122, 7124, 7061,
+    7122, 7123, 7124,
+    7058, 7061, 7124,
+    7125, 7120, 7063,
+    7120, 7125, 7117,
+    7125, 7063, 7064,
+    7125, 7073, 7117,
+    7070, 7125, 7064,
+    7125, 7070, 7073,
+    7126, 7058, 7124,
+    7126, 7124, 7127,
+    7123, 7127, 7124,
+    7058, 7126, 7128,
+    7058, 7128, 7056,
+    7055, 7056, 7128,
+    7126, 7129, 7128,
+    7130, 7055, 7128,
+    7130, 7128, 7129,
+    7055, 7130, 7131,
+    7055, 7131, 7052,
+    7049, 7052, 7131,
+    7130, 7132, 7131,
+    7132, 7130, 7129,
+    7133, 7049, 7131,
+    7133, 7131, 7132,
+    7049, 7133, 7134,
+    7050, 7049, 7134,
+    7135, 7133, 7132,
+    7050, 7134, 7136,
+    7051, 7050, 7136,
+    7137, 7134, 7133,
+    7135, 7137, 7133,
+    7137, 7138, 7134,
+    7138, 7136, 7134,
+    7135, 7139, 7137,
+    7135, 7132, 7139,
+    7132, 7129, 7139,
+    7139, 7140, 7137,
+    7138, 7137, 7140,
+    7141, 7139, 7129,
+    7139, 7141, 7140,
+    7126, 7141, 7129,
+    7141, 7126, 7127,
+    7141, 7142, 7140,
+    7141, 7127, 7142,
+    7143, 7140, 7142,
+    7143, 7138, 7140,
+    7127, 7144, 7142,
+    7127, 7123, 7144,
+    7145, 7143, 7142,
+    7145, 7142, 7144,
+    7138, 7143, 7146,
+    7136, 7138, 7146,
+    7145, 7147, 7143,
+    7147, 7146, 7143,
+    7136, 7146, 7148,
+    7051, 7136, 7148,
+    7051, 7148, 7053,
+    7149, 7148, 7146,
+    7147, 7149, 7146,
+    7150, 7053, 7148,
+    7149, 7150, 7148,
+    7149, 7147, 7151,
+    7149, 7151, 7150,
+    7147, 7152, 7151,
+    7147, 7145, 7152,
+    7153, 7151, 7152,
+    7154, 7153, 7152,
+    7151, 7153, 7155,
+    7151, 7155, 7150,
+    7153, 7156, 7155,
+    7154, 7152, 7157,
+    7145, 7157, 7152,
+    7158, 7154, 7157,
+    7145, 7159, 7157,
+    7159, 7145, 7144,
+    7158, 7157, 7160,
+    7159, 7160, 7157,
+    7161, 7158, 7160,
+    7159, 7144, 7162,
+    7123, 7162, 7144,
+    7162, 7123, 7121,
+    7163, 7159, 7162,
+    7159, 7163, 7160,
+    7162, 7121, 7164,
+    7163, 7162, 7164,
+    7107, 7164, 7121,
+    7163, 7165, 7160,
+    7163, 7164, 7165,
+    7161, 7160, 7165,
+    7166, 7161, 7165,
+    7164, 7167, 7165,
+    7166, 7165, 7167,
+    7164, 7107, 7167,
+    7168, 7166, 7167,
+    7168, 7167, 7169,
+    7107, 7169, 7167,
+    7170, 7168, 7169,
+    7170, 7169, 7171,
+    7169, 7172, 7171,
+    7169, 7107, 7172,
+    7173, 7171, 7172,
+    7107, 7174, 7172,
+    7174, 7107, 7105,
+    7175, 7173, 7172,
+    7175, 7172, 7174,
+    7173, 7175, 7176,
+    7177, 7173, 7176,
+    7178, 7175, 7174,
+    7177, 7176, 7179,
+    7180, 7177, 7179,
+    7180, 7179, 7181,
+    7182, 7176, 7175,
+    7178, 7182, 7175,
+    7183, 7179, 7176,
+    7182, 7183, 7176,
+    7179, 7184, 7181,
+    7179, 7183, 7184,
+    7185, 7181, 7184,
+    7186, 7185, 7184,
+    7185, 7186, 7187,
+    7186, 7184, 6533,
+    7183, 6533, 7184,
+    6534, 7186, 6533,
+    7183, 6531, 6533,
+    7186, 6534, 7188,
+    7186, 7188, 7187,
+    6534, 6536, 7188,
+    7189, 7187, 7188,
+    7190, 7188, 6536,
+    7190, 7189, 7188,
+    6545, 7190, 6536,
+    7189, 7190, 7191,
+    7190, 7192, 7191,
+    7190, 6545, 7192,
+    7193, 7191, 7192,
+    6545, 7194, 7192,
+    7195, 7193, 7192,
+    7195, 7192, 7194,
+    7193, 7195, 7196,
+    6545, 6543, 7194,
+    7195, 7197, 7196,
+    7198, 7196, 7197,
+    7199, 7198, 7197,
+    7195, 7200, 7197,
+    7200, 7195, 7194,
+    7199, 7197, 7201,
+    7200, 7201, 7197,
+    7202, 7199, 7201,
+    7200, 7194, 7203,
+    6543, 7203, 7194,
+    7200, 7204, 7201,
+    7204, 7200, 7203,
+    7202, 7201, 7205,
+    7204, 7205, 7201,
+    7206, 7202, 7205,
+    7206, 7205, 7207,
+    7208, 7206, 7207,
+    7204, 7209, 7205,
+    7209, 7207, 7205,
+    7208, 7207, 7210,
+    7208, 7210, 7211,
+    7207, 7209, 6041,
+    7207, 6041, 7210,
+    7209, 6043, 6041,
+    6037, 7210, 6041,
+    6043, 7209, 7212,
+    6043, 7212, 6044,
+    6048, 6044, 7212,
+    6548, 6048, 7212,
+    7209, 7213, 7212,
+    6548, 7212, 7213,
+    7209, 7204, 7213,
+    7204, 7203, 7213,
+    7214, 6548, 7213,
+    7214, 7213, 7203,
+    7214, 6540, 6548,
+    6543, 7214, 7203,
+    7214, 6543, 6540,
+    7210, 6037, 7215,
+    7210, 7215, 7211,
+    6037, 6039, 7215,
+    7216, 7211, 7215,
+    6136, 7215, 6039,
+    6136, 7216, 7215,
+    7216, 6136, 6142,
+    6136, 7217, 6142,
+    6136, 6134, 7217,
+    6142, 7217, 6135,
+    6134, 6135, 7217,
+    7218, 7219, 7220,
+    7218, 7220, 7221,
+    7219, 7218, 7222,
+    7218, 7221, 7223,
+    7218, 7223, 7222,
+    7220, 7224, 7221,
+    7221, 7225, 7223,
+    7226, 7221, 7224,
+    7221, 7226, 7225,
+    7220, 7227, 7224,
+    7228, 7226, 7224,
+    7227, 7220, 7229,
+    7219, 7229, 7220,
+    7227, 7230, 7224,
+    7228, 7224, 7230,
+    7219, 7231, 7229,
+    7231, 7219, 7232,
+    7219, 7222, 7232,
+    7231, 7233, 7229,
+    7234, 7232, 7222,
+    7231, 7232, 7235,
+    7236, 7234, 7222,
+    7236, 7222, 7223,
+    7234, 7237, 7232,
+    7237, 7235, 7232,
+    7234, 7236, 7238,
+    7237, 7234, 7239,
+    7234, 7238, 7239,
+    7240, 7236, 7223,
+    7240, 7223, 7225,
+    7236, 7241, 7238,
+    7236, 7240, 7241,
+    7242, 7238, 7241,
+    7240, 7243, 7241,
+    7242, 7244, 7238,
+    7244, 7239, 7238,
+    7245, 7242, 7241,
+    7245, 7241, 7243,
+    7242, 7246, 7244,
+    7242, 7245, 7247,
+    7246, 7242, 7247,
+    7248, 7245, 7243,
+    7249, 7247, 7245,
+    7248, 7249, 7245,
+    7248, 7243, 7250,
+    7248, 7251, 7249,
+    7251, 7248, 7250,
+    7252, 7250, 7243,
+    7240, 7252, 7243,
+    7252, 7240, 7225,
+    7252, 7225, 7253,
+    7226, 7253, 7225,
+    7252, 7254, 7250,
+    7254, 7252, 7253,
+    7254, 7255, 7250,
+    7251, 7250, 7255,
+    7254, 7253, 7256,
+    7254, 7256, 7255,
+    7253, 7257, 7256,
+    7253, 7226, 7257,
+    7226, 6755, 7257,
+    7226, 7228, 6755,
+    6753, 7257, 6755,
+    7228, 6757, 6755,
+    6753, 7258, 7257,
+    7258, 7256, 7257,
+    7258, 6753, 6751,
+    7228, 7259, 6757,
+    7259, 6758, 6757,
+    7259, 7228, 7230,
+    6758, 7259, 7260,
+    6758, 7260, 6760,
+    6763, 6760, 7260,
+    7259, 7261, 7260,
+    7259, 7230, 7261,
+    7262, 6763, 7260,
+    7262, 7260, 7261,
+    7230, 7263, 7261,
+    7230, 7227, 7263,
+    7264, 7262, 7261,
+    7264, 7261, 7263,
+    7264, 7265, 7262,
+    7266, 7264, 7263,
+    7265, 7267, 7262,
+    6763, 7262, 7267,
+    7265, 7264, 7268,
+    7264, 7266, 7268,
+    7269, 6763, 7267,
+    6763, 7269, 6765,
+    7269, 7267, 7270,
+    7271, 6765, 7269,
+    7272, 7270, 7267,
+    7265, 7272, 7267,
+    7273, 7269, 7270,
+    7273, 7271, 7269,
+    7273, 7270, 7274,
+    7273, 7274, 7271,
+    7270, 7275, 7274,
+    7270, 7272, 7275,
+    6787, 7274, 7275,
+    6789, 6787, 7275,
+    7274, 6787, 7276,
+    7274, 7276, 7271,
+    6787, 6782, 7276,
+    6789, 7275, 7277,
+    7272, 7277, 7275,
+    6791, 6789, 7277,
+    6791, 7277, 6821,
+    7272, 7278, 7277,
+    7278, 6821, 7277,
+    7272, 7265, 7278,
+    7278, 6823, 6821,
+    7265, 7268, 7278,
+    6823, 7278, 7268,
+    7279, 6823, 7268,
+    7279, 7268, 7266,
+    6823, 7279, 7280,
+    6825, 6823, 7280,
+    7281, 7279, 7266,
+    6825, 7280, 7282,
+    6827, 6825, 7282,
+    7283, 7280, 7279,
+    7281, 7283, 7279,
+    7283, 7284, 7280,
+    7284, 7282, 7280,
+    7281, 7285, 7283,
+    7281, 7266, 7285,
+    7266, 7263, 7285,
+    7227, 7285, 7263,
+    7285, 7286, 7283,
+    7285, 7227, 7286,
+    7284, 7283, 7286,
+    7227, 7287, 7286,
+    7287, 7227, 7229,
+    7287, 7229, 7233,
+    7288, 7284, 7286,
+    7288, 7286, 7287,
+    7284, 7288, 7289,
+    7284, 7289, 7282,
+    7290, 7288, 7287,
+    7290, 7287, 7233,
+    7288, 7291, 7289,
+    7288, 7290, 7291,
+    7289, 7292, 7282,
+    6827, 7282, 7292,
+    7289, 7293, 7292,
+    7293, 7289, 7291,
+    7294, 6827, 7292,
+    6827, 7294, 6829,
+    6835, 6829, 7294,
+    7294, 7292, 7295,
+    7293, 7295, 7292,
+    7296, 6835, 7294,
+    7296, 7294, 7295,
+    6835, 7296, 6837,
+    7293, 7297, 7295,
+    7296, 7295, 7298,
+    7297, 7298, 7295,
+    7299, 7296, 7298,
+    7296, 7299, 6837,
+    7297, 7300, 7298,
+    7299, 7298, 7301,
+    7300, 7301, 7298,
+    7302, 7299, 7301,
+    7302, 7303, 7299,
+    7303, 6837, 7299,
+    7302, 7301, 7304,
+    7302, 7304, 7303,
+    7301, 7305, 7304,
+    7301, 7300, 7305,
+    7304, 7306, 7303,
+    7303, 7307, 6837,
+    7307, 7303, 7306,
+    7307, 6833, 6837,
+    6833, 7307, 6836,
+    7304, 7308, 7306,
+    7308, 7304, 7305,
+    7309, 7307, 7306,
+    7308, 7310, 7306,
+    7309, 7306, 7310,
+    7307, 7309, 7311,
+    7307, 7311, 6836,
+    7312, 7309, 7310,
+    7313, 6836, 7311,
+    7313, 6834, 6836,
+    6834, 7313, 6840,
+    7309, 7314, 7311,
+    7309, 7312, 7314,
+    7315, 7313, 7311,
+    7315, 7311, 7314,
+    7315, 7316, 7313,
+    7316, 6840, 7313,
+    7317, 7315, 7314,
+    7315, 7317, 7316,
+    7317, 7314, 7318,
+    7312, 7318, 7314,
+    7317, 7319, 7316,
+    7316, 7320, 6840,
+    7320, 7316, 7319,
+    7320, 6842, 6840,
+    7317, 7321, 7319,
+    7321, 7317, 7318,
+    7320, 7322, 6842,
+    7322, 6843, 6842,
+    7322, 7323, 6843,
+    7323, 6845, 6843,
+    7322, 7320, 7324,
+    7323, 7325, 6845,
+    7325, 6847, 6845,
+    7323, 7322, 7326,
+    7322, 7324, 7326,
+    7325, 7323, 7327,
+    7323, 7326, 7327,
+    7325, 7328, 6847,
+    7328, 6849, 6847,
+    7328, 7325, 7329,
+    7325, 7327, 7329,
+    7328, 7330, 6849,
+    7330, 6872, 6849,
+    7330, 6874, 6872,
+    7330, 7328, 7331,
+    7328, 7329, 7331,
+    6874, 7330, 7332,
+    7330, 7331, 7332,
+    6874, 7332, 7333,
+    6881, 6874, 7333,
+    7334, 7332, 7331,
+    6881, 7333, 7335,
+    6883, 6881, 7335,
+    7336, 7333, 7332,
+    7334, 7336, 7332,
+    7336, 7337, 7333,
+    7337, 7335, 7333,
+    6883, 7335, 7338,
+    6885, 6883, 7338,
+    7337, 7339, 7335,
+    7339, 7338, 7335,
+    6885, 7338, 7340,
+    6900, 6885, 7340,
+    7339, 7341, 7338,
+    7341, 7340, 7338,
+    6900, 7340, 7342,
+    6902, 6900, 7342,
+    7341, 7343, 7340,
+    7343, 7342, 7340,
+    6902, 7342, 7344,
+    6904, 6902, 7344,
+    7343, 7345, 7342,
+    7345, 7344, 7342,
+    7341, 7346, 7343,
+    7341, 7339, 7346,
+    7346, 7347, 7343,
+    7345, 7343, 7347,
+    7339, 7348, 7346,
+    7339, 7337, 7348,
+    7349, 7346, 7348,
+    7346, 7349, 7347,
+    7337, 7350, 7348,
+    7337, 7336, 7350,
+    7351, 7348, 7350,
+    7351, 7349, 7348,
+    7336, 7352, 7350,
+    7336, 7334, 7352,
+    7353, 7351, 7350,
+    7353, 7350, 7352,
+    7353, 7354, 7351,
+    7355, 7353, 7352,
+    7354, 7356, 7351,
+    7349, 7351, 7356,
+    7354, 7353, 7357,
+    7353, 7355, 7357,
+    7354, 7357, 7358,
+    7359, 7354, 7358,
+    7354, 7359, 7356,
+    7360, 7358, 7357,
+    7359, 7361, 7356,
+    7362, 7360, 7357,
+    7362, 7357, 7355,
+    7359, 7358, 7363,
+    7364, 7362, 7355,
+    7365, 7359, 7363,
+    7359, 7365, 7361,
+    7366, 7363, 7358,
+    7360, 7366, 7358,
+    7365, 7363, 7367,
+    7366, 7368, 7363,
+    7368, 7367, 7363,
+    7368, 7366, 7369,
+    7370, 7365, 7367,
+    7368, 7371, 7367,
+    7365, 7370, 7372,
+    7365, 7372, 7361,
+    7370, 7367, 7373,
+    7371, 7373, 7367,
+    7370, 7374, 7372,
+    7371, 7375, 7373,
+    7375, 7371, 7376,
+    7375, 7377, 7373,
+    7371, 7378, 7376,
+    7371, 7368, 7378,
+    7379, 7376, 7378,
+    7368, 7369, 7378,
+    7380, 7379, 7378,
+    7380, 7378, 7369,
+    7379, 7380, 7381,
+    7382, 7379, 7381,
+    7383, 7380, 7369,
+    7382, 7381, 7384,
+    7385, 7382, 7384,
+    7386, 7381, 7380,
+    7383, 7386, 7380,
+    7386, 7387, 7381,
+    7387, 7384, 7381,
+    7387, 7386, 7388,
+    7387, 7389, 7384,
+    7387, 7388, 7389,
+    7389, 7390, 7384,
+    7385, 7384, 7390,
+    7389, 7391, 7390,
+    7392, 7385, 7390,
+    7391, 7389, 7393,
+    7388, 7393, 7389,
+    7391, 7394, 7390,
+    7392, 7390, 7394,
+    7395, 7391, 7393,
+    7391, 7395, 7394,
+    7395, 7393, 7396,
+    7397, 7396, 7393,
+    7388, 7397, 7393,
+    7398, 7395, 7396,
+    7397, 7388, 7399,
+    7386, 7399, 7388,
+    7400, 7397, 7399,
+    7386, 7383, 7399,
+    7400, 7399, 7401,
+    7383, 7401, 7399,
+    7402, 7400, 7401,
+    7402, 7401, 7403,
+    7401, 7404, 7403,
+    7401, 7383, 7404,
+    7405, 7403, 7404,
+    7383, 7406, 7404,
+    7407, 7405, 7404,
+    7407, 7404, 7406,
+    7405, 7407, 7408,
+    7409, 7405, 7408,
+    7410, 7407, 7406,
+    7409, 7408, 7411,
+    7412, 7409, 7411,
+    7412, 7411, 7413,
+    7414, 7408, 7407,
+    7410, 7414, 7407,
+    7415, 7411, 7408,
+    7414, 7415, 7408,
+    7411, 7416, 7413,
+    7411, 7415, 7416,
+    7417, 7413, 7416,
+    7418, 7417, 7416,
+    7417, 7418, 7419,
+    7418, 7416, 7420,
+    7415, 7420, 7416,
+    7418, 7421, 7419,
+    7422, 7419, 7421,
+    7423, 7418, 7420,
+    7418, 7423, 7421,
+    7424, 7422, 7421,
+    7422, 7424, 7425,
+    7423, 7426, 7421,
+    7424, 7421, 7426,
+    7424, 7427, 7425,
+    7428, 7425, 7427,
+    7429, 7424, 7426,
+    7424, 7429, 7427,
+    7430, 7428, 7427,
+    7428, 7430, 7431,
+    7430, 7427, 7432,
+    7429, 7432, 7427,
+    7430, 7433, 7431,
+    7434, 7431, 7433,
+    7435, 7430, 7432,
+    7430, 7435, 7433,
+    7435, 7432, 7436,
+    7435, 7436, 7433,
+    7437, 7434, 7433,
+    7437, 7433, 7436,
+    7434, 7437, 7438,
+    7432, 7439, 7436,
+    7432, 7429, 7439,
+    7440, 7437, 7436,
+    7440, 7436, 7439,
+    7437, 7441, 7438,
+    7437, 7440, 7441,
+    7442, 7438, 7441,
+    7443, 7442, 7441,
+    7440, 7444, 7441,
+    7443, 7441, 7444,
+    7442, 7443, 7445,
+    7446, 7442, 7445,
+    7447, 7443, 7444,
+    7446, 7445, 7448,
+    7449, 7446, 7448,
+    7449, 7448, 7450,
+    7451, 7445, 7443,
+    7447, 7451, 7443,
+    7452, 7448, 7445,
+    7451, 7452, 7445,
+    7448, 7453, 7450,
+    7448, 7452, 7453,
+    7454, 7450, 7453,
+    7452, 7451, 7455,
+    7452, 7456, 7453,
+    7452, 7455, 7456,
+    7457, 7454, 7453,
+    7457, 7453, 7456,
+    7454, 7457, 7458,
+    7459, 7454, 7458,
+    7460, 7457, 7456,
+    7459, 7458, 7461,
+    7462, 7459, 7461,
+    7462, 7461, 7463,
+    7464, 7458, 7457,
+    7460, 7464, 7457,
+    7465, 7461, 7458,
+    7464, 7465, 7458,
+    7461, 7466, 7463,
+    7461, 7465, 7466,
+    7467, 7463, 7466,
+    7465, 7464, 7468,
+    7465, 7469, 7466,
+    7465, 7468, 7469,
+    7470, 7467, 7466,
+    7470, 7466, 7469,
+    7467, 7470, 7471,
+    7472, 7467, 7471,
+    7473, 7470, 7469,
+    7472, 7471, 7474,
+    7475, 7472, 7474,
+    7476, 7471, 7470,
+    7473, 7476, 7470,
+    7476, 7477, 7471,
+    7477, 7474, 7471,
+    7476, 7473, 7478,
+    7477, 7476, 7479,
+    7476, 7478, 7479,
+    7477, 7480, 7474,
+    7475, 7474, 7481,
+    7480, 7481, 7474,
+    7482, 7475, 7481,
+    7480, 7477, 7483,
+    7477, 7479, 7483,
+    7482, 7481, 7484,
+    7485, 7482, 7484,
+    7485, 7484, 7486,
+    7487, 7484, 7481,
+    7480, 7487, 7481,
+    7484, 7488, 7486,
+    7484, 7487, 7488,
+    7489, 7486, 7488,
+    7487, 7480, 7490,
+    7487, 7490, 7488,
+    7480, 7483, 7490,
+    7491, 7488, 7490,
+    7491, 7489, 7488,
+    7492, 7490, 7483,
+    7492, 7491, 7490,
+    7493, 7492, 7483,
+    7493, 7483, 7479,
+    7491, 7492, 7494,
+    7495, 7493, 7479,
+    7495, 7479, 7478,
+    7492, 7493, 7496,
+    7492, 7496, 7494,
+    7493, 7495, 7497,
+    7493, 7497, 7496,
+    7495, 7498, 7497,
+    7499, 7496, 7497,
+    7495, 7500, 7498,
+    7500, 7495, 7478,
+    7499, 7501, 7496,
+    7501, 7494, 7496,
+    7502, 7499, 7497,
+    7499, 7502, 7501,
+    7502, 7497, 7498,
+    7502, 7503, 7501,
+    7504, 7502, 7498,
+    7502, 7504, 7503,
+    7504, 7498, 7505,
+    7500, 7505, 7498,
+    7504, 7506, 7503,
+    7500, 7507, 7505,
+    7508, 7504, 7505,
+    7507, 7500, 7509,
+    7500, 7478, 7509,
+    7473, 7509, 7478,
+    7509, 7473, 7510,
+    7473, 7469, 7510,
+    7468, 7510, 7469,
+    7509, 7510, 7511,
+    7507, 7509, 7511,
+    7468, 7512, 7510,
+    7512, 7511, 7510,
+    7512, 7468, 7513,
+    7464, 7513, 7468,
+    7464, 7460, 7513,
+    7512, 7514, 7511,
+    7460, 7515, 7513,
+    7516, 7512, 7513,
+    7516, 7513, 7515,
+    7512, 7516, 7517,
+    7514, 7512, 7517,
+    7518, 7516, 7515,
+    7519, 7517, 7516,
+    7518, 7519, 7516,
+    7518, 7515, 7520,
+    7519, 7518, 7521,
+    7518, 7520, 7521,
+    7515, 7522, 7520,
+    7515, 7460, 7522,
+    7460, 7456, 7522,
+    7455, 7522, 7456,
+    7523, 7520, 7522,
+    7455, 7523, 7522,
+    7523, 7524, 7520,
+    7524, 7521, 7520,
+    7523, 7455, 7525,
+    7451, 7525, 7455,
+    7451, 7447, 7525,
+    7526, 7523, 7525,
+    7523, 7526, 7524,
+    7447, 7527, 7525,
+    7526, 7525, 7527,
+    7527, 7447, 7528,
+    7447, 7444, 7528,
+    7529, 7526, 7527,
+    7530, 7528, 7444,
+    7440, 7530, 7444,
+    7527, 7528, 7531,
+    7529, 7527, 7531,
+    7530, 7532, 7528,
+    7532, 7531, 7528,
+    7530, 7440, 7533,
+    7532, 7530, 7534,
+    7530, 7533, 7534,
+    7532, 7535, 7531,
+    7440, 7536, 7533,
+    7536, 7440, 7439,
+    7535, 7532, 7537,
+    7532, 7534, 7537,
+    7536, 7439, 7538,
+    7429, 7538, 7439,
+    7539, 7536, 7538,
+    7429, 7540, 7538,
+    7539, 7541, 7536,
+    7541, 7533, 7536,
+    7539, 7538, 7542,
+    7540, 7542, 7538,
+    7541, 7543, 7533,
+    7543, 7534, 7533,
+    7543, 7544, 7534,
+    7544, 7537, 7534,
+    7543, 7541, 7545,
+    7543, 7545, 7544,
+    7541, 7546, 7545,
+    7541, 7539, 7546,
+    7545, 7547, 7544,
+    7539, 7548, 7546,
+    7548, 7539, 7542,
+    7549, 7545, 7546,
+    7545, 7549, 7547,
+    7550, 7546, 7548,
+    7550, 7549, 7546,
+    7551, 7550, 7548,
+    7551, 7548, 7552,
+    7548, 7542, 7552,
+    7551, 7553, 7550,
+    7551, 7552, 7553,
+    7554, 7552, 7542,
+    7540, 7554, 7542,
+    7552, 7554, 7555,
+    7552, 7555, 7553,
+    7554, 7540, 7556,
+    7554, 7556, 7555,
+    7540, 7557, 7556,
+    7540, 7429, 7557,
+    7429, 7426, 7557,
+    7558, 7557, 7426,
+    7423, 7558, 7426,
+    7559, 7556, 7557,
+    7558, 7559, 7557,
+    7558, 7423, 7560,
+    7423, 7420, 7560,
+    7559, 7558, 7561,
+    7558, 7560, 7561,
+    7559, 7562, 7556,
+    7562, 7555, 7556,
+    7562, 7559, 7563,
+    7559, 7561, 7563,
+    7562, 7564, 7555,
+    7564, 7553, 7555,
+    7562, 7563, 7565,
+    7564, 7562, 7565,
+    7553, 7564, 7566,
+    7553, 7566, 7550,
+    7549, 7550, 7566,
+    7567, 7549, 7566,
+    7564, 7568, 7566,
+    7567, 7566, 7568,
+    7549, 7567, 7569,
+    7549, 7569, 7547,
+    7570, 7567, 7568,
+    7567, 7571, 7569,
+    7567, 7570, 7571,
+    7572, 7547, 7569,
+    7573, 7569, 7571,
+    7573, 7572, 7569,
+    7570, 7574, 7571,
+    7575, 7573, 7571,
+    7575, 7571, 7574,
+    7570, 7576, 7574,
+    7570, 7568, 7576,
+    7577, 7575, 7574,
+    7568, 7578, 7576,
+    7568, 7564, 7578,
+    7576, 7579, 7574,
+    7577, 7574, 7579,
+    7576, 7580, 7579,
+    7580, 7576, 7578,
+    7581, 7577, 7579,
+    7577, 7581, 7575,
+    7580, 7582, 7579,
+    7581, 7579, 7582,
+    7581, 7583, 7575,
+    7573, 7575, 7583,
+    7321, 7581, 7582,
+    7581, 7321, 7583,
+    7321, 7582, 7319,
+    7321, 7318, 7583,
+    7584, 7319, 7582,
+    7580, 7584, 7582,
+    7584, 7320, 7319,
+    7320, 7584, 7324,
+    7580, 7585, 7584,
+    7585, 7324, 7584,
+    7585, 7580, 7578,
+    7585, 7586, 7324,
+    7586, 7326, 7324,
+    7585, 7578, 7587,
+    7586, 7585, 7587,
+    7564, 7587, 7578,
+    7564, 7565, 7587,
+    7586, 7587, 7588,
+    7565, 7588, 7587,
+    7586, 7589, 7326,
+    7589, 7586, 7588,
+    7589, 7327, 7326,
+    7565, 7590, 7588,
+    7590, 7565, 7563,
+    7589, 7588, 7591,
+    7590, 7591, 7588,
+    7589, 7592, 7327,
+    7592, 7589, 7591,
+    7592, 7329, 7327,
+    7592, 7593, 7329,
+    7592, 7591, 7593,
+    7593, 7331, 7329,
+    7593, 7334, 7331,
+    7591, 7594, 7593,
+    7334, 7593, 7594,
+    7591, 7590, 7594,
+    7595, 7334, 7594,
+    7334, 7595, 7352,
+    7355, 7352, 7595,
+    7364, 7355, 7595,
+    7595, 7594, 7596,
+    7364, 7595, 7596,
+    7590, 7596, 7594,
+    7364, 7596, 7597,
+    7362, 7364, 7597,
+    7590, 7598, 7596,
+    7598, 7597, 7596,
+    7598, 7590, 7563,
+    7598, 7563, 7561,
+    7599, 7598, 7561,
+    7598, 7599, 7597,
+    7599, 7561, 7560,
+    7599, 7600, 7597,
+    7362, 7597, 7600,
+    7601, 7599, 7560,
+    7599, 7601, 7600,
+    7601, 7560, 7420,
+    7415, 7601, 7420,
+    7360, 7362, 7600,
+    7601, 7415, 7602,
+    7601, 7602, 7600,
+    7360, 7600, 7602,
+    7415, 7414, 7602,
+    7603, 7602, 7414,
+    7603, 7360, 7602,
+    7410, 7603, 7414,
+    7410, 7406, 7603,
+    7360, 7603, 7604,
+    7406, 7604, 7603,
+    7366, 7360, 7604,
+    7406, 7383, 7604,
+    7366, 7604, 7369,
+    7383, 7369, 7604,
+    7605, 7606, 7607,
+    7605, 7607, 7608,
+    7605, 7609, 7606,
+    7605, 7608, 7610,
+    7609, 7605, 7610,
+    7607, 7611, 7608,
+    7609, 7610, 7612,
+    7607, 7613, 7611,
+    7614, 7610, 7608,
+    7613, 7607, 7615,
+    7606, 7615, 7607,
+    6749, 7613, 7615,
+    6749, 7615, 6751,
+    7613, 6749, 6743,
+    7258, 6751, 7615,
+    7606, 7258, 7615,
+    6744, 7613, 6743,
+    7613, 6744, 6746,
+    7613, 6746, 7611,
+    7258, 7606, 7616,
+    7256, 7258, 7616,
+    7609, 7616, 7606,
+    7256, 7616, 7255,
+    7609, 7617, 7616,
+    7617, 7255, 7616,
+    7617, 7251, 7255,
+    7617, 7609, 7612,
+    7251, 7617, 7618,
+    7617, 7612, 7618,
+    7251, 7618, 7249,
+    7619, 7249, 7618,
+    7249, 7619, 7247,
+    7620, 7618, 7612,
+    7620, 7619, 7618,
+    7621, 7620, 7612,
+    7621, 7612, 7610,
+    7614, 7621, 7610,
+    7621, 7622, 7620,
+    7621, 7614, 7623,
+    7622, 7621, 7623,
+    7622, 7624, 7620,
+    7619, 7620, 7624,
+    7622, 7623, 7625,
+    7622, 7626, 7624,
+    7626, 7622, 7625,
+    7627, 7619, 7624,
+    7626, 7628, 7624,
+    7627, 7624, 7628,
+    7619, 7627, 7629,
+    7619, 7629, 7247,
+    7246, 7247, 7629,
+    7627, 7630, 7629,
+    7631, 7246, 7629,
+    7631, 7629, 7630,
+    7246, 7631, 7632,
+    7246, 7632, 7244,
+    7633, 7631, 7630,
+    7631, 7634, 7632,
+    7631, 7633, 7634,
+    7635, 7244, 7632,
+    7244, 7635, 7239,
+    7636, 7632, 7634,
+    7636, 7635, 7632,
+    7635, 7637, 7239,
+    7237, 7239, 7637,
+    7635, 7636, 7638,
+    7639, 7237, 7637,
+    7237, 7639, 7235,
+    7635, 7640, 7637,
+    7640, 7635, 7638,
+    7639, 7637, 7641,
+    7640, 7641, 7637,
+    7642, 7639, 7641,
+    7640, 7643, 7641,
+    7639, 7642, 7644,
+    7639, 7644, 7235,
+    7642, 7641, 7645,
+    7643, 7645, 7641,
+    7642, 7646, 7644,
+    7647, 7642, 7645,
+    7642, 7647, 7646,
+    7648, 7235, 7644,
+    7648, 7231, 7235,
+    7231, 7648, 7233,
+    7649, 7648, 7644,
+    7649, 7644, 7646,
+    7648, 7650, 7233,
+    7648, 7649, 7650,
+    7290, 7233, 7650,
+    7651, 7290, 7650,
+    7290, 7651, 7291,
+    7649, 7652, 7650,
+    7651, 7650, 7652,
+    7649, 7653, 7652,
+    7653, 7649, 7646,
+    7654, 7651, 7652,
+    7653, 7646, 7655,
+    7647, 7655, 7646,
+    7653, 7656, 7652,
+    7654, 7652, 7656,
+    7657, 7653, 7655,
+    7653, 7657, 7656,
+    7647, 7658, 7655,
+    7657, 7655, 7659,
+    7658, 7659, 7655,
+    7658, 7647, 7660,
+    7647, 7645, 7660,
+    7658, 7661, 7659,
+    7662, 7660, 7645,
+    7643, 7662, 7645,
+    7658, 7660, 7663,
+    7661, 7658, 7663,
+    7662, 7664, 7660,
+    7664, 7663, 7660,
+    7664, 7662, 7665,
+    7664, 7666, 7663,
+    7664, 7665, 7666,
+    7666, 7667, 7663,
+    7661, 7663, 7667,
+    7665, 7668, 7666,
+    7669, 7661, 7667,
+    7662, 7670, 7665,
+    7662, 7643, 7670,
+    7671, 7665, 7670,
+    7665, 7671, 7668,
+    7643, 7672, 7670,
+    7643, 7640, 7672,
+    7640, 7638, 7672,
+    7673, 7670, 7672,
+    7673, 7671, 7670,
+    7674, 7672, 7638,
+    7674, 7673, 7672,
+    7675, 7674, 7638,
+    7675, 7638, 7636,
+    7673, 7674, 7676,
+    7677, 7675, 7636,
+    7677, 7636, 7634,
+    7674, 7675, 7678,
+    7677, 7634, 7679,
+    7633, 7679, 7634,
+    7675, 7677, 7680,
+    7675, 7680, 7678,
+    7681, 7677, 7679,
+    7677, 7681, 7680,
+    7633, 7682, 7679,
+    7681, 7679, 7683,
+    7682, 7683, 7679,
+    7684, 7680, 7681,
+    7685, 7681, 7683,
+    7685, 7684, 7681,
+    7685, 7683, 7686,
+    7684, 7687, 7680,
+    7687, 7678, 7680,
+    7684, 7685, 7688,
+    7685, 7686, 7688,
+    7687, 7684, 7689,
+    7684, 7688, 7689,
+    7687, 7690, 7678,
+    7687, 7689, 7691,
+    7690, 7687, 7691,
+    7690, 7692, 7678,
+    7674, 7678, 7692,
+    7690, 7693, 7692,
+    7694, 7674, 7692,
+    7674, 7694, 7676,
+    7693, 7695, 7692,
+    7694, 7692, 7695,
+    7693, 7690, 7696,
+    7690, 7691, 7696,
+    7693, 7696, 7697,
+    7693, 7697, 7695,
+    7698, 7696, 7691,
+    7696, 7699, 7697,
+    7696, 7698, 7699,
+    7700, 7698, 7691,
+    7700, 7691, 7689,
+    7698, 7701, 7699,
+    7702, 7700, 7689,
+    7702, 7689, 7688,
+    7698, 7700, 7703,
+    7698, 7703, 7701,
+    7700, 7702, 7704,
+    7700, 7704, 7703,
+    7705, 7702, 7688,
+    7705, 7688, 7686,
+    7702, 7706, 7704,
+    7702, 7705, 7706,
+    7707, 7704, 7706,
+    7705, 7708, 7706,
+    7709, 7707, 7706,
+    7709, 7706, 7708,
+    7707, 7710, 7704,
+    7710, 7703, 7704,
+    7709, 7711, 7707,
+    7710, 7707, 7712,
+    7711, 7712, 7707,
+    7709, 7713, 7711,
+    7713, 7709, 7708,
+    7713, 7714, 7711,
+    7713, 7708, 7715,
+    7716, 7711, 7714,
+    7711, 7716, 7712,
+    7713, 7717, 7714,
+    7717, 7713, 7715,
+    7718, 7715, 7708,
+    7705, 7718, 7708,
+    7718, 7705, 7686,
+    7718, 7686, 7719,
+    7683, 7719, 7686,
+    7683, 7682, 7719,
+    7720, 7718, 7719,
+    7718, 7720, 7715,
+    7682, 7721, 7719,
+    7720, 7719, 7721,
+    7720, 7722, 7715,
+    7717, 7715, 7722,
+    7723, 7720, 7721,
+    7720, 7723, 7722,
+    7723, 7721, 7724,
+    7723, 7725, 7722,
+    7723, 7724, 7725,
+    7726, 7722, 7725,
+    7726, 7717, 7722,
+    7727, 7726, 7725,
+    7727, 7725, 7728,
+    7724, 7728, 7725,
+    7727, 7729, 7726,
+    7730, 7727, 7728,
+    7727, 7730, 7729,
+    7724, 7731, 7728,
+    7730, 7728, 7732,
+    7731, 7732, 7728,
+    7731, 7724, 7733,
+    7721, 7733, 7724,
+    7721, 7682, 7733,
+    7682, 7734, 7733,
+    7682, 7633, 7734,
+    7633, 7630, 7734,
+    7735, 7733, 7734,
+    7735, 7731, 7733,
+    7736, 7734, 7630,
+    7736, 7735, 7734,
+    7627, 7736, 7630,
+    7736, 7627, 7628,
+    7735, 7736, 7737,
+    7736, 7628, 7737,
+    7731, 7735, 7738,
+    7735, 7737, 7738,
+    7731, 7738, 7732,
+    7739, 7737, 7628,
+    7626, 7739, 7628,
+    7740, 7738, 7737,
+    7739, 7740, 7737,
+    7739, 7626, 7741,
+    7626, 7625, 7741,
+    7740, 7739, 7742,
+    7739, 7741, 7742,
+    7743, 7741, 7625,
+    7744, 7742, 7741,
+    7743, 7744, 7741,
+    7745, 7743, 7625,
+    7745, 7625, 7623,
+    7744, 7743, 7746,
+    7747, 7745, 7623,
+    7747, 7623, 7614,
+    7743, 7745, 7748,
+    7743, 7748, 7746,
+    7749, 7747, 7614,
+    7749, 7614, 7608,
+    7749, 7608, 7611,
+    7750, 7749, 7611,
+    7749, 7750, 7747,
+    7750, 7611, 6746,
+    7750, 7751, 7747,
+    7745, 7747, 7751,
+    7752, 7750, 6746,
+    7750, 7752, 7751,
+    7752, 6746, 6726,
+    6723, 7752, 6726,
+    7752, 6723, 6719,
+    7753, 7752, 6719,
+    7752, 7753, 7751,
+    7753, 6719, 6717,
+    7754, 7751, 7753,
+    7754, 7745, 7751,
+    7745, 7754, 7748,
+    7755, 7754, 7753,
+    7755, 7753, 6717,
+    7756, 7748, 7754,
+    7755, 7756, 7754,
+    7755, 6717, 7757,
+    7756, 7755, 7757,
+    6715, 7757, 6717,
+    7756, 7758, 7748,
+    7758, 7746, 7748,
+    7756, 7757, 7759,
+    7758, 7756, 7759,
+    6715, 7760, 7757,
+    7760, 7759, 7757,
+    7760, 6715, 6714,
+    7758, 7759, 7761,
+    7760, 7762, 7759,
+    7762, 7761, 7759,
+    7763, 7758, 7761,
+    7758, 7763, 7746,
+    7763, 7761, 7764,
+    7765, 7764, 7761,
+    7762, 7765, 7761,
+    7766, 7763, 7764,
+    7765, 7762, 7767,
+    7768, 7765, 7767,
+    7769, 7768, 7770,
+    7768, 7767, 7770,
+    7771, 7770, 7767,
+    7772, 7771, 7767,
+    7772, 7767, 7762,
+    7771, 7772, 7773,
+    7760, 7772, 7762,
+    7772, 7774, 7773,
+    7772, 7760, 7774,
+    7775, 7773, 7774,
+    7760, 6714, 7774,
+    7776, 7774, 6714,
+    7776, 7775, 7774,
+    6710, 7776, 6714,
+    7775, 7776, 7777,
+    7778, 7775, 7777,
+    6710, 7779, 7776,
+    7779, 7777, 7776,
+    7779, 6710, 6706,
+    7779, 6706, 6708,
+    7780, 7779, 6708,
+    7779, 7780, 7777,
+    7780, 6708, 7046,
+    7780, 7046, 7053,
+    7150, 7780, 7053,
+    7780, 7150, 7155,
+    7781, 7780, 7155,
+    7780, 7781, 7777,
+    7781, 7155, 7156,
+    7778, 7777, 7781,
+    7782, 7781, 7156,
+    7782, 7778, 7781,
+    7783, 7784, 6762,
+    7783, 6762, 6765,
+    7784, 6764, 6762,
+    7271, 7783, 6765,
+    7784, 6768, 6764,
+    7783, 7271, 7276,
+    6768, 7784, 6780,
+    7785, 7783, 7276,
+    7783, 7785, 7784,
+    7785, 6780, 7784,
+    7785, 7276, 6782,
+    7785, 6779, 6780,
+    6779, 7785, 6782,
+    7763, 7786, 7746,
+    7763, 7766, 7786,
+    7744, 7746, 7786,
+    7766, 7787, 7786,
+    7788, 7786, 7787,
+    7788, 7744, 7786,
+    7789, 7788, 7787,
+    7789, 7790, 7788,
+    7744, 7788, 7791,
+    7790, 7791, 7788,
+    7742, 7744, 7791,
+    7790, 7792, 7791,
+    7742, 7791, 7793,
+    7792, 7793, 7791,
+    7740, 7742, 7793,
+    7792, 7794, 7793,
+    7794, 7795, 7793,
+    7740, 7793, 7795,
+    7794, 7796, 7795,
+    7797, 7740, 7795,
+    7740, 7797, 7738,
+    7796, 7798, 7795,
+    7797, 7795, 7798,
+    7796, 7799, 7798,
+    7797, 7800, 7738,
+    7738, 7800, 7732,
+    7797, 7801, 7800,
+    7801, 7732, 7800,
+    7801, 7797, 7798,
+    7801, 7730, 7732,
+    7801, 7798, 7802,
+    7730, 7801, 7802,
+    7799, 7802, 7798,
+    7730, 7802, 7729,
+    7799, 7803, 7802,
+    7803, 7729, 7802,
+    7729, 7803, 7804,
+    7729, 7804, 7726,
+    7717, 7726, 7804,
+    7803, 7805, 7804,
+    7806, 7717, 7804,
+    7806, 7804, 7805,
+    7717, 7806, 7807,
+    7717, 7807, 7714,
+    7808, 7806, 7805,
+    7809, 7714, 7807,
+    7806, 7808, 7810,
+    7806, 7810, 7807,
+    7809, 7716, 7714,
+    7811, 7807, 7810,
+    7811, 7809, 7807,
+    7808, 7812, 7810,
+    7808, 7805, 7812,
+    7813, 7811, 7810,
+    7813, 7810, 7812,
+    7811, 7814, 7809,
+    7811, 7813, 7814,
+    7814, 7815, 7809,
+    7716, 7809, 7815,
+    7813, 7816, 7814,
+    7814, 7817, 7815,
+    7817, 7814, 7816,
+    7813, 7818, 7816,
+    7818, 7813, 7812,
+    7819, 7817, 7816,
+    7818, 7812, 7820,
+    7805, 7820, 7812,
+    7805, 7803, 7820,
+    7803, 7821, 7820,
+    7822, 7820, 7821,
+    7822, 7818, 7820,
+    7823, 7822, 7821,
+    7818, 7822, 7824,
+    7818, 7824, 7816,
+    7819, 7816, 7824,
+    7822, 7823, 7825,
+    7822, 7825, 7824,
+    7823, 7826, 7825,
+    7827, 7824, 7825,
+    7827, 7819, 7824,
+    7828, 7825, 7826,
+    7828, 7827, 7825,
+    7829, 7828, 7826,
+    7829, 7830, 7828,
+    7827, 7828, 7831,
+    7830, 7831, 7828,
+    7832, 7827, 7831,
+    7832, 7831, 7830,
+    7827, 7832, 7819,
+    7833, 7832, 7830,
+    7832, 7834, 7819,
+    7832, 7833, 7834,
+    7817, 7819, 7834,
+    7833, 7835, 7834,
+    7836, 7834, 7835,
+    7836, 7817, 7834,
+    7837, 7836, 7835,
+    7817, 7836, 7838,
+    7817, 7838, 7815,
+    7836, 7837, 7839,
+    7836, 7839, 7838,
+    7837, 7840, 7839,
+    7841, 7815, 7838,
+    7841, 7716, 7815,
+    7842, 7838, 7839,
+    7842, 7841, 7838,
+    7843, 7839, 7840,
+    7843, 7842, 7839,
+    7844, 7843, 7840,
+    7844, 7845, 7843,
+    7845, 7846, 7843,
+    7842, 7843, 7846,
+    7845, 7847, 7846,
+    7848, 7842, 7846,
+    7847, 7849, 7846,
+    7848, 7846, 7849,
+    7849, 7847, 7850,
+    7847, 7851, 7850,
+    7852, 7853, 7851,
+    7853, 7850, 7851,
+    7853, 7854, 7850,
+    7854, 7855, 7850,
+    7849, 7850, 7855,
+    7856, 7849, 7855,
+    7856, 7848, 7849,
+    7856, 7857, 7848,
+    7857, 7858, 7848,
+    7842, 7848, 7858,
+    7857, 7859, 7858,
+    7841, 7842, 7858,
+    7859, 7860, 7858,
+    7841, 7858, 7860,
+    7859, 7861, 7860,
+    7716, 7841, 7860,
+    7861, 7862, 7860,
+    7716, 7860, 7862,
+    7861, 7863, 7862,
+    7864, 7716, 7862,
+    7716, 7864, 7712,
+    7863, 7865, 7862,
+    7864, 7862, 7865,
+    7863, 7866, 7865,
+    7867, 7712, 7864,
+    7867, 7710, 7712,
+    7868, 7864, 7865,
+    7868, 7867, 7864,
+    7866, 7869, 7865,
+    7868, 7865, 7869,
+    7866, 7870, 7869,
+    7868, 7871, 7867,
+    7871, 7868, 7869,
+    7870, 7872, 7869,
+    7871, 7869, 7872,
+    7870, 7873, 7872,
+    7871, 7874, 7867,
+    7710, 7867, 7874,
+    7875, 7871, 7872,
+    7871, 7875, 7874,
+    7873, 7876, 7872,
+    7875, 7872, 7876,
+    7873, 7877, 7876,
+    7877, 7878, 7876,
+    7877, 7879, 7878,
+    7880, 7875, 7876,
+    7880, 7876, 7878,
+    7875, 7880, 7881,
+    7875, 7881, 7874,
+    7882, 7880, 7878,
+    7883, 7874, 7881,
+    7883, 7710, 7874,
+    7710, 7883, 7703,
+    7883, 7884, 7703,
+    7703, 7884, 7701,
+    7883, 7885, 7884,
+    7885, 7701, 7884,
+    7885, 7883, 7881,
+    7885, 7886, 7701,
+    7886, 7699, 7701,
+    7885, 7881, 7887,
+    7880, 7887, 7881,
+    7880, 7882, 7887,
+    7888, 7885, 7887,
+    7885, 7888, 7886,
+    7888, 7887, 7889,
+    7882, 7889, 7887,
+    7888, 7890, 7886,
+    7891, 7888, 7889,
+    7888, 7891, 7890,
+    7891, 7889, 7892,
+    7891, 7893, 7890,
+    7891, 7892, 7893,
+    7894, 7886, 7890,
+    7886, 7894, 7699,
+    7894, 7697, 7699,
+    7895, 7894, 7890,
+    7895, 7890, 7893,
+    7697, 7894, 7896,
+    7697, 7896, 7695,
+    7894, 7895, 7897,
+    7894, 7897, 7896,
+    7898, 7695, 7896,
+    7898, 7694, 7695,
+    7899, 7896, 7897,
+    7899, 7898, 7896,
+    7898, 7900, 7694,
+    7900, 7676, 7694,
+    7898, 7899, 7901,
+    7900, 7898, 7901,
+    7900, 7902, 7676,
+    7900, 7901, 7903,
+    7902, 7900, 7903,
+    7902, 7904, 7676,
+    7673, 7676, 7904,
+    7671, 7673, 7904,
+    7902, 7905, 7904,
+    7671, 7904, 7906,
+    7905, 7906, 7904,
+    7907, 7671, 7906,
+    7671, 7907, 7668,
+    7905, 7908, 7906,
+    7907, 7906, 7909,
+    7908, 7909, 7906,
+    7910, 7668, 7907,
+    7911, 7907, 7909,
+    7911, 7910, 7907,
+    7911, 7909, 7912,
+    7910, 7911, 7913,
+    7911, 7912, 7913,
+    7910, 7914, 7668,
+    7914, 7666, 7668,
+    7666, 7914, 7667,
+    7914, 7910, 7915,
+    7910, 7913, 7915,
+    7914, 7916, 7667,
+    7669, 7667, 7916,
+    7916, 7914, 7917,
+    7914, 7915, 7917,
+    7918, 7669, 7916,
+    7916, 7917, 7919,
+    7918, 7916, 7919,
+    7920, 7917, 7915,
+    7921, 7919, 7917,
+    7920, 7921, 7917,
+    7922, 7920, 7915,
+    7922, 7915, 7913,
+    7921, 7920, 7923,
+    7924, 7922, 7913,
+    7924, 7913, 7912,
+    7920, 7922, 7925,
+    7920, 7925, 7923,
+    7922, 7924, 7926,
+    7922, 7926, 7925,
+    7924, 7927, 7926,
+    7928, 7925, 7926,
+    7924, 7929, 7927,
+    7929, 7924, 7912,
+    7930, 7926, 7927,
+    7930, 7928, 7926,
+    7929, 7931, 7927,
+    7932, 7930, 7927,
+    7932, 7927, 7931,
+    7928, 7930, 7933,
+    7934, 7932, 7931,
+    7930, 7932, 7935,
+    7934, 7936, 7932,
+    7936, 7935, 7932,
+    7934, 7931, 7937,
+    7934, 7937, 7936,
+    7931, 7938, 7937,
+    7931, 7929, 7938,
+    7937, 7939, 7936,
+    7940, 7936, 7939,
+    7936, 7940, 7935,
+    7941, 7940, 7939,
+    7940, 7942, 7935,
+    7941, 7939, 7943,
+    7944, 7941, 7943,
+    7944, 7943, 7945,
+    7946, 7943, 7939,
+    7937, 7946, 7939,
+    7946, 7937, 7938,
+    7943, 7947, 7945,
+    7943, 7946, 7947,
+    7948, 7945, 7947,
+    7949, 7948, 7947,
+    7946, 7950, 7947,
+    7949, 7947, 7950,
+    7948, 7949, 7951,
+    7952, 7948, 7951,
+    7953, 7949, 7950,
+    7952, 7951, 7954,
+    7955, 7952, 7954,
+    7956, 7951, 7949,
+    7953, 7956, 7949,
+    7956, 7957, 7951,
+    7957, 7954, 7951,
+    7953, 7958, 7956,
+    7957, 7956, 7959,
+    7958, 7959, 7956,
+    7957, 7960, 7954,
+    7960, 7957, 7959,
+    7955, 7954, 7961,
+    7960, 7961, 7954,
+    7962, 7955, 7961,
+    7960, 7963, 7961,
+    7962, 7961, 7964,
+    7963, 7964, 7961,
+    7965, 7962, 7964,
+    7963, 7960, 7966,
+    7963, 7966, 7964,
+    7960, 7959, 7966,
+    7965, 7964, 7967,
+    7966, 7967, 7964,
+    7968, 7965, 7967,
+    7969, 7966, 7959,
+    7966, 7969, 7967,
+    7958, 7969, 7959,
+    7968, 7967, 7970,
+    7969, 7970, 7967,
+    7971, 7968, 7970,
+    7969, 7958, 7972,
+    7958, 7973, 7972,
+    7958, 7953, 7973,
+    7974, 7972, 7973,
+    7953, 7950, 7973,
+    7975, 7973, 7950,
+    7975, 7974, 7973,
+    7946, 7975, 7950,
+    7974, 7975, 7976,
+    7977, 7974, 7976,
+    7946, 7978, 7975,
+    7978, 7976, 7975,
+    7978, 7946, 7938,
+    7977, 7976, 7979,
+    7980, 7977, 7979,
+    7978, 7981, 7976,
+    7981, 7979, 7976,
+    7978, 7938, 7982,
+    7981, 7978, 7982,
+    7929, 7982, 7938,
+    7981, 7983, 7979,
+    7981, 7982, 7984,
+    7983, 7981, 7984,
+    7929, 7985, 7982,
+    7985, 7984, 7982,
+    7985, 7929, 7986,
+    7929, 7912, 7986,
+    7909, 7986, 7912,
+    7909, 7908, 7986,
+    7985, 7986, 7987,
+    7908, 7987, 7986,
+    7988, 7985, 7987,
+    7985, 7988, 7984,
+    7908, 7989, 7987,
+    7908, 7905, 7989,
+    7988, 7987, 7990,
+    7989, 7990, 7987,
+    7988, 7991, 7984,
+    7983, 7984, 7991,
+    7992, 7988, 7990,
+    7988, 7992, 7991,
+    7993, 7983, 7991,
+    7992, 7994, 7991,
+    7993, 7991, 7994,
+    7983, 7993, 7995,
+    7983, 7995, 7979,
+    7980, 7979, 7995,
+    7996, 7980, 7995,
+    7996, 7995, 7997,
+    7993, 7997, 7995,
+    7998, 7996, 7997,
+    7993, 7999, 7997,
+    7999, 7993, 7994,
+    7998, 7997, 8000,
+    7999, 8000, 7997,
+    8001, 7998, 8000,
+    8001, 8000, 8002,
+    8003, 8001, 8002,
+    8003, 8002, 8004,
+    8005, 8002, 8000,
+    7999, 8005, 8000,
+    8002, 8006, 8004,
+    8002, 8005, 8006,
+    8007, 8004, 8006,
+    8005, 7999, 8008,
+    7999, 7994, 8008,
+    8005, 8009, 8006,
+    8005, 8008, 8009,
+    8010, 8007, 8006,
+    8010, 8006, 8009,
+    8007, 8010, 8011,
+    8012, 8007, 8011,
+    8013, 8010, 8009,
+    8012, 8011, 8014,
+    8015, 8012, 8014,
+    8015, 8014, 8016,
+    8017, 8011, 8010,
+    8013, 8017, 8010,
+    8018, 8014, 8011,
+    8017, 8018, 8011,
+    8014, 8019, 8016,
+    8014, 8018, 8019,
+    8020, 8016, 8019,
+    8018, 8017, 8021,
+    8022, 8020, 8019,
+    8018, 8023, 8019,
+    8022, 8019, 8023,
+    8023, 8018, 8024,
+    8018, 8021, 8024,
+    8025, 8022, 8023,
+    8023, 8024, 8026,
+    8025, 8023, 8026,
+    8027, 8026, 8024,
+    8025, 8028, 8022,
+    8029, 8027, 8024,
+    8029, 8024, 8021,
+    8027, 8029, 8030,
+    8031, 8029, 8021,
+    8027, 8030, 8032,
+    8026, 8027, 8032,
+    8029, 8033, 8030,
+    8029, 8031, 8033,
+    8026, 8032, 8034,
+    8025, 8026, 8034,
+    8025, 8034, 8035,
+    8028, 8025, 8035,
+    8036, 8034, 8032,
+    8037, 8035, 8034,
+    8036, 8037, 8034,
+    8038, 8036, 8032,
+    8038, 8032, 8030,
+    8037, 8036, 8039,
+    8040, 8038, 8030,
+    8040, 8030, 8033,
+    8036, 8038, 8041,
+    8036, 8041, 8039,
+    8038, 8040, 8042,
+    8038, 8042, 8041,
+    8040, 8043, 8042,
+    8044, 8041, 8042,
+    8040, 8045, 8043,
+    8045, 8040, 8033,
+    8046, 8042, 8043,
+    8046, 8044, 8042,
+    8045, 8047, 8043,
+    8048, 8046, 8043,
+    8048, 8043, 8047,
+    8045, 8033, 8049,
+    8031, 8049, 8033,
+    8050, 8045, 8049,
+    8045, 8050, 8047,
+    8049, 8031, 8051,
+    8050, 8049, 8052,
+    8049, 8051, 8052,
+    8050, 8053, 8047,
+    8050, 8052, 8054,
+    8053, 8050, 8054,
+    8055, 8047, 8053,
+    8055, 8048, 8047,
+    8056, 8055, 8053,
+    8056, 8053, 8057,
+    8053, 8054, 8057,
+    8056, 8058, 8055,
+    8056, 8057, 8058,
+    8058, 8059, 8055,
+    8048, 8055, 8059,
+    8057, 8060, 8058,
+    8061, 8048, 8059,
+    8057, 8062, 8060,
+    8062, 8057, 8054,
+    8048, 8061, 8063,
+    8046, 8048, 8063,
+    8046, 8063, 8064,
+    8044, 8046, 8064,
+    8065, 8063, 8061,
+    8044, 8064, 8066,
+    8067, 8065, 8061,
+    8067, 8061, 8068,
+    8067, 8068, 8065,
+    8061, 8059, 8068,
+    8069, 8068, 8059,
+    8058, 8069, 8059,
+    8069, 8058, 8060,
+    8068, 8070, 8065,
+    8068, 8069, 8070,
+    8071, 8065, 8070,
+    8065, 8071, 8063,
+    8071, 8064, 8063,
+    8071, 8072, 8064,
+    8072, 8066, 8064,
+    8073, 8071, 8070,
+    8072, 8074, 8066,
+    8073, 8070, 8075,
+    8069, 8075, 8070,
+    8076, 8073, 8075,
+    8075, 8069, 8077,
+    8076, 8075, 8078,
+    8075, 8077, 8078,
+    8076, 8079, 8073,
+    8069, 8080, 8077,
+    8080, 8069, 8060,
+    8079, 8076, 8081,
+    8076, 8078, 8081,
+    8080, 8060, 8082,
+    8062, 8082, 8060,
+    8083, 8080, 8082,
+    8083, 8084, 8080,
+    8083, 8082, 8084,
+    8084, 8077, 8080,
+    8082, 8085, 8084,
+    8082, 8062, 8085,
+    8084, 8086, 8077,
+    8086, 8084, 8085,
+    8086, 8078, 8077,
+    8062, 8087, 8085,
+    8086, 8088, 8078,
+    8088, 8081, 8078,
+    8089, 8086, 8085,
+    8089, 8085, 8087,
+    8088, 8086, 8090,
+    8086, 8089, 8091,
+    8086, 8092, 8090,
+    8092, 8086, 8091,
+    8088, 8090, 8093,
+    8094, 8090, 8092,
+    8095, 8088, 8093,
+    8088, 8095, 8081,
+    8096, 8093, 8090,
+    8094, 8096, 8090,
+    8095, 8093, 8097,
+    8096, 8094, 7899,
+    8096, 7899, 7897,
+    8094, 7901, 7899,
+    8096, 7897, 8098,
+    8093, 8096, 8098,
+    7895, 8098, 7897,
+    8093, 8098, 8097,
+    7895, 8099, 8098,
+    8099, 8097, 8098,
+    8099, 7895, 7893,
+    8099, 7893, 8100,
+    7892, 8100, 7893,
+    8099, 8101, 8097,
+    8101, 8099, 8100,
+    8101, 8102, 8097,
+    8095, 8097, 8102,
+    8101, 8100, 8103,
+    8104, 8095, 8102,
+    8095, 8104, 8081,
+    8079, 8081, 8104,
+    8101, 8105, 8102,
+    8105, 8101, 8103,
+    8104, 8102, 8106,
+    8105, 8106, 8102,
+    8107, 8079, 8104,
+    8107, 8104, 8106,
+    8079, 8107, 8108,
+    8079, 8108, 8073,
+    8071, 8073, 8108,
+    8107, 8109, 8108,
+    8107, 8106, 8109,
+    8110, 8071, 8108,
+    8110, 8108, 8109,
+    8071, 8110, 8111,
+    8072, 8071, 8111,
+    8112, 8110, 8109,
+    8072, 8111, 8113,
+    8074, 8072, 8113,
+    8114, 8111, 8110,
+    8112, 8114, 8110,
+    8114, 8115, 8111,
+    8115, 8113, 8111,
+    8115, 8114, 5824,
+    8115, 5823, 8113,
+    8115, 5824, 5823,
+    5823, 5826, 8113,
+    8074, 8113, 5826,
+    5828, 8074, 5826,
+    8074, 5828, 5835,
+    8116, 8074, 5835,
+    8074, 8116, 8066,
+    8116, 5835, 5837,
+    8117, 8066, 8116,
+    8117, 8044, 8066,
+    8044, 8117, 8041,
+    8117, 8039, 8041,
+    8118, 8117, 8116,
+    8117, 8118, 8039,
+    8118, 8116, 5837,
+    8118, 8119, 8039,
+    8118, 5837, 8119,
+    8037, 8039, 8119,
+    5837, 5838, 8119,
+    8120, 8037, 8119,
+    8120, 8119, 5838,
+    8037, 8120, 8035,
+    5840, 8120, 5838,
+    8120, 8121, 8035,
+    8120, 5840, 8122,
+    8121, 8120, 8122,
+    5842, 8122, 5840,
+    8028, 8035, 8121,
+    5842, 8123, 8122,
+    8123, 5842, 5847,
+    8121, 8122, 8124,
+    8123, 8124, 8122,
+    8125, 8028, 8121,
+    8125, 8121, 8124,
+    8028, 8125, 8126,
+    8028, 8126, 8022,
+    8020, 8022, 8126,
+    8127, 8020, 8126,
+    8127, 8126, 8128,
+    8125, 8128, 8126,
+    8129, 8127, 8128,
+    8129, 8128, 8130,
+    8128, 8125, 8131,
+    8128, 8131, 8130,
+    8125, 8124, 8131,
+    8132, 8130, 8131,
+    8133, 8131, 8124,
+    8133, 8132, 8131,
+    8123, 8133, 8124,
+    8132, 8133, 8134,
+    8133, 8135, 8134,
+    8133, 8123, 8135,
+    8136, 8134, 8135,
+    8123, 8137, 8135,
+    8137, 8123, 5847,
+    8137, 5847, 5848,
+    8138, 8136, 8135,
+    8138, 8135, 8137,
+    8136, 8138, 8139,
+    8140, 8137, 5848,
+    8140, 8138, 8137,
+    8140, 5848, 5850,
+    8138, 8141, 8139,
+    8138, 8140, 8141,
+    8142, 8139, 8141,
+    8140, 8143, 8141,
+    8143, 8140, 5850,
+    8144, 8142, 8141,
+    8144, 8141, 8143,
+    8142, 8144, 8145,
+    8146, 8142, 8145,
+    8147, 8144, 8143,
+    8146, 8145, 8148,
+    8149, 8146, 8148,
+    8149, 8148, 8150,
+    8151, 8145, 8144,
+    8147, 8151, 8144,
+    8152, 8148, 8145,
+    8151, 8152, 8145,
+    8148, 8153, 8150,
+    8148, 8152, 8153,
+    8154, 8150, 8153,
+    8147, 8155, 8151,
+    8147, 8143, 8155,
+    8143, 5850, 8155,
+    5849, 8155, 5850,
+    8155, 5849, 5853,
+    8155, 5853, 8151,
+    8152, 8151, 5853,
+    5854, 8152, 5853,
+    8152, 5854, 5857,
+    8156, 8152, 5857,
+    8152, 8156, 8153,
+    8156, 5857, 8157,
+    5859, 8157, 5857,
+    8158, 8153, 8156,
+    8158, 8154, 8153,
+    8159, 8156, 8157,
+    8159, 8158, 8156,
+    8154, 8158, 8160,
+    8161, 8154, 8160,
+    8162, 8161, 8163,
+    8161, 8160, 8163,
+    8164, 8163, 8160,
+    8165, 8164, 8160,
+    8165, 8160, 8158,
+    8159, 8165, 8158,
+    8164, 8165, 8166,
+    8165, 8167, 8166,
+    8165, 8159, 8167,
+    8168, 8166, 8167,
+    8169, 8168, 8167,
+    8159, 8170, 8167,
+    8169, 8167, 8170,
+    8159, 8157, 8170,
+    8171, 8169, 8170,
+    8157, 8172, 8170,
+    8171, 8170, 8172,
+    8157, 5859, 8172,
+    5859, 8173, 8172,
+    8173, 5859, 5860,
+    8174, 8171, 8172,
+    8174, 8172, 8173,
+    8171, 8174, 8175,
+    8176, 8174, 8173,
+    8171, 8175, 8177,
+    8178, 8171, 8177,
+    8174, 8179, 8175,
+    8174, 8176, 8179,
+    8180, 8175, 8179,
+    8180, 8181, 8175,
+    8181, 8177, 8175,
+    8182, 8180, 8179,
+    8180, 8182, 8181,
+    8182, 8179, 8183,
+    8176, 8183, 8179,
+    8182, 8184, 8181,
+    8176, 8185, 8183,
+    8176, 8173, 8185,
+    8173, 5860, 8185,
+    8186, 8182, 8183,
+    8182, 8186, 8184,
+    8185, 8187, 8183,
+    8186, 8183, 8187,
+    8188, 8185, 5860,
+    8185, 8188, 8187,
+    5858, 8188, 5860,
+    8188, 5858, 5863,
+    8188, 8189, 8187,
+    8190, 8187, 8189,
+    8190, 8186, 8187,
+    8191, 8190, 8189,
+    8186, 8190, 8192,
+    8191, 8193, 8190,
+    8193, 8192, 8190,
+    8191, 8189, 8194,
+    8193, 8191, 8194,
+    8195, 8194, 8189,
+    8188, 8195, 8189,
+    8193, 8194, 8196,
+    8195, 8197, 8194,
+    8197, 8196, 8194,
+    8197, 8195, 8198,
+    8197, 8199, 8196,
+    8195, 8200, 8198,
+    8195, 8188, 8200,
+    8201, 8198, 8200,
+    8188, 8202, 8200,
+    8188, 5863, 8202,
+    8203, 8200, 8202,
+    8203, 8201, 8200,
+    5863, 8204, 8202,
+    5863, 5865, 8204,
+    8205, 8203, 8202,
+    8205, 8202, 8204,
+    8205, 8206, 8203,
+    8206, 8205, 8204,
+    8206, 8207, 8203,
+    8201, 8203, 8207,
+    8206, 8204, 8208,
+    5865, 8208, 8204,
+    8209, 8206, 8208,
+    8206, 8209, 8207,
+    5865, 8210, 8208,
+    8210, 5865, 5866,
+    8210, 5866, 5881,
+    5884, 8210, 5881,
+    8210, 8211, 8208,
+    8210, 5884, 8211,
+    8209, 8208, 8211,
+    5884, 5888, 8211,
+    8212, 8209, 8211,
+    8212, 8211, 5888,
+    8209, 8212, 8207,
+    8213, 8212, 5888,
+    8213, 5888, 5889,
+    8214, 8207, 8212,
+    8213, 8214, 8212,
+    8214, 8201, 8207,
+    8215, 8213, 5889,
+    8213, 8215, 8214,
+    8215, 5889, 5891,
+    8201, 8214, 8216,
+    8215, 8216, 8214,
+    8217, 8201, 8216,
+    8217, 8216, 8215,
+    8218, 8215, 5891,
+    8218, 8217, 8215,
+    8218, 5891, 5893,
+    8219, 8218, 5893,
+    8218, 8219, 8217,
+    8219, 5893, 5897,
+    5976, 8219, 5897,
+    8219, 8220, 8217,
+    8219, 5976, 8220,
+    8201, 8217, 8220,
+    5976, 8221, 8220,
+    8222, 8201, 8220,
+    8222, 8220, 8221,
+    8223, 8222, 8221,
+    6531, 8224, 6530,
+    7085, 6530, 8224,
+    6531, 7183, 8224,
+    8225, 7085, 8224,
+    7085, 8225, 7098,
+    7183, 8226, 8224,
+    8225, 8224, 8226,
+    8226, 7183, 8227,
+    7183, 7182, 8227,
+    8228, 8225, 8226,
+    8228, 8226, 8229,
+    8228, 8229, 8225,
+    8226, 8227, 8229,
+    8229, 7098, 8225,
+    8229, 7100, 7098,
+    7100, 8229, 8227,
+    8230, 7100, 8227,
+    8230, 8227, 7182,
+    7100, 8230, 7105,
+    7178, 8230, 7182,
+    7174, 7105, 8230,
+    7178, 7174, 8230,
+    8231, 8232, 8233,
+    8231, 8233, 8234,
+    8231, 8235, 8232,
+    8231, 8234, 8235,
+    8232, 8236, 8233,
+    8233, 8237, 8234,
+    8232, 8238, 8236,
+    8233, 8239, 8237,
+    8239, 8233, 8236,
+    8238, 8232, 8240,
+    8235, 8240, 8232,
+    8238, 8241, 8236,
+    8235, 8242, 8240,
+    8243, 8238, 8240,
+    8242, 8235, 8244,
+    8234, 8244, 8235,
+    8242, 8245, 8240,
+    8243, 8240, 8245,
+    8246, 8242, 8244,
+    8242, 8246, 8245,
+    8234, 7918, 8244,
+    7918, 8234, 8237,
+    8246, 8244, 7919,
+    7918, 7919, 8244,
+    7921, 8246, 7919,
+    8246, 7921, 8247,
+    8246, 8247, 8245,
+    7921, 7923, 8247,
+    8248, 8245, 8247,
+    8248, 8243, 8245,
+    8249, 8247, 7923,
+    8249, 8248, 8247,
+    8250, 8249, 7923,
+    8250, 7923, 7925,
+    7928, 8250, 7925,
+    8250, 7928, 8251,
+    7928, 7933, 8251,
+    8249, 8250, 8252,
+    8250, 8251, 8252,
+    8249, 8252, 8253,
+    8248, 8249, 8253,
+    8254, 8252, 8251,
+    8255, 8254, 8251,
+    8254, 8256, 8252,
+    8255, 8251, 7933,
+    8256, 8253, 8252,
+    8257, 8255, 7933,
+    8256, 8258, 8253,
+    8257, 7933, 8259,
+    8260, 8257, 8259,
+    7930, 8259, 7933,
+    8260, 8259, 7942,
+    8259, 7930, 7935,
+    8259, 7935, 7942,
+    8258, 8261, 8253,
+    8258, 8262, 8261,
+    8248, 8253, 8261,
+    8262, 8263, 8261,
+    8262, 8264, 8263,
+    8265, 8248, 8261,
+    8265, 8261, 8263,
+    8248, 8265, 8266,
+    8243, 8248, 8266,
+    8267, 8265, 8263,
+    8243, 8266, 8268,
+    8238, 8243, 8268,
+    8238, 8268, 8241,
+    8269, 8266, 8265,
+    8267, 8269, 8265,
+    8270, 8268, 8266,
+    8269, 8270, 8266,
+    8269, 8267, 8271,
+    8267, 8263, 8271,
+    8264, 8271, 8263,
+    8264, 8272, 8271,
+    8269, 8271, 8273,
+    8272, 8273, 8271,
+    8270, 8269, 8273,
+    8272, 8274, 8273,
+    8274, 8275, 8273,
+    8270, 8273, 8275,
+    8274, 8276, 8275,
+    8277, 8270, 8275,
+    8276, 8278, 8275,
+    8277, 8275, 8278,
+    8278, 8276, 8279,
+    8276, 8280, 8279,
+    8281, 8277, 8278,
+    8282, 8279, 8280,
+    8283, 8282, 8280,
+    8283, 8284, 8282,
+    8284, 8285, 8282,
+    8284, 8286, 8285,
+    8282, 8287, 8279,
+    8287, 8282, 8285,
+    8287, 8288, 8279,
+    8278, 8279, 8288,
+    8281, 8278, 8288,
+    8287, 8289, 8288,
+    8281, 8288, 8290,
+    8289, 8290, 8288,
+    8287, 8291, 8289,
+    8291, 8287, 8285,
+    8289, 8292, 8290,
+    8291, 8285, 8293,
+    8286, 8293, 8285,
+    8291, 8294, 8289,
+    8292, 8289, 8294,
+    8295, 8291, 8293,
+    8291, 8295, 8294,
+    8293, 8286, 8296,
+    8286, 8297, 8296,
+    8295, 8293, 8298,
+    8293, 8296, 8298,
+    8299, 8296, 8297,
+    8300, 8299, 8297,
+    8300, 8301, 8299,
+    8299, 8302, 8296,
+    8302, 8298, 8296,
+    8301, 8303, 8299,
+    8302, 8299, 8303,
+    8301, 8304, 8303,
+    8302, 8305, 8298,
+    8306, 8302, 8303,
+    8302, 8306, 8305,
+    8304, 8307, 8303,
+    8306, 8303, 8307,
+    8307, 8304, 8308,
+    8304, 8309, 8308,
+    8310, 8306, 8307,
+    8311, 8308, 8309,
+    8312, 8311, 8309,
+    8307, 8308, 8313,
+    8310, 8307, 8313,
+    8311, 8314, 8308,
+    8314, 8313, 8308,
+    8311, 8312, 8315,
+    8312, 8316, 8315,
+    8314, 8311, 8317,
+    8311, 8315, 8317,
+    8318, 8315, 8316,
+    8319, 8318, 8316,
+    8319, 8320, 8318,
+    8318, 8321, 8315,
+    8321, 8317, 8315,
+    8320, 8322, 8318,
+    8321, 8318, 8322,
+    8320, 7489, 8322,
+    8321, 8323, 8317,
+    8323, 8321, 8322,
+    8323, 8324, 8317,
+    8314, 8317, 8324,
+    8323, 8322, 8325,
+    7489, 8325, 8322,
+    8326, 8323, 8325,
+    8323, 8326, 8324,
+    7489, 8327, 8325,
+    7489, 7491, 8327,
+    7491, 7494, 8327,
+    8327, 8328, 8325,
+    8326, 8325, 8328,
+    8329, 8327, 7494,
+    8327, 8329, 8328,
+    7501, 8329, 7494,
+    8329, 7501, 7503,
+    8330, 8329, 7503,
+    8330, 7503, 7506,
+    8329, 8330, 8331,
+    8332, 8330, 7506,
+    8333, 8329, 8331,
+    8329, 8333, 8328,
+    8332, 8334, 8330,
+    8334, 8331, 8330,
+    8332, 8335, 8334,
+    8332, 7506, 8335,
+    8334, 8336, 8331,
+    7506, 8337, 8335,
+    7506, 7504, 8337,
+    7504, 7508, 8337,
+    8335, 8338, 8334,
+    8336, 8334, 8338,
+    8339, 8335, 8337,
+    8335, 8339, 8338,
+    8340, 8339, 8337,
+    8340, 8337, 7508,
+    8339, 8341, 8338,
+    8339, 8340, 8342,
+    8339, 8342, 8341,
+    8343, 8340, 7508,
+    8340, 8344, 8342,
+    8340, 8343, 8344,
+    8343, 7508, 8345,
+    7508, 7505, 8345,
+    7507, 8345, 7505,
+    8343, 8345, 8346,
+    8343, 8346, 8344,
+    8345, 7507, 8347,
+    8345, 8347, 8346,
+    7507, 7511, 8347,
+    7514, 8347, 7511,
+    8348, 8346, 8347,
+    7514, 8348, 8347,
+    8348, 8349, 8346,
+    8349, 8344, 8346,
+    8348, 7514, 8350,
+    8348, 8350, 8349,
+    7514, 7517, 8350,
+    8349, 8351, 8344,
+    8351, 8342, 8344,
+    8350, 8352, 8349,
+    8351, 8349, 8352,
+    8353, 8350, 7517,
+    8350, 8353, 8352,
+    7519, 8353, 7517,
+    8353, 7519, 8354,
+    7519, 7521, 8354,
+    8353, 8355, 8352,
+    8356, 8354, 7521,
+    7524, 8356, 7521,
+    8353, 8354, 8357,
+    8355, 8353, 8357,
+    8358, 8357, 8354,
+    8356, 8358, 8354,
+    8355, 8357, 8359,
+    8358, 8360, 8357,
+    8360, 8359, 8357,
+    8361, 8355, 8359,
+    8361, 8362, 8355,
+    8362, 8352, 8355,
+    8362, 8351, 8352,
+    8361, 8359, 8363,
+    8361, 8363, 8362,
+    8359, 8364, 8363,
+    8359, 8360, 8364,
+    8363, 8365, 8362,
+    8351, 8362, 8365,
+    8363, 8366, 8365,
+    8366, 8363, 8364,
+    8367, 8351, 8365,
+    8366, 8368, 8365,
+    8367, 8365, 8368,
+    8351, 8367, 8369,
+    8342, 8351, 8369,
+    8342, 8369, 8341,
+    8370, 8369, 8367,
+    8371, 8341, 8369,
+    8370, 8371, 8369,
+    8371, 8372, 8341,
+    8372, 8338, 8341,
+    8372, 8336, 8338,
+    8371, 8373, 8372,
+    8371, 8370, 8373,
+    8336, 8372, 8374,
+    8373, 8374, 8372,
+    8375, 8336, 8374,
+    8373, 8376, 8374,
+    8336, 8375, 8377,
+    8336, 8377, 8331,
+    8333, 8331, 8377,
+    8378, 8333, 8377,
+    8378, 8377, 8379,
+    8375, 8379, 8377,
+    8378, 8380, 8333,
+    8380, 8378, 8379,
+    8380, 8328, 8333,
+    8380, 8326, 8328,
+    8326, 8380, 8381,
+    8380, 8379, 8381,
+    8326, 8381, 8324,
+    8382, 8381, 8379,
+    8375, 8382, 8379,
+    8383, 8324, 8381,
+    8382, 8383, 8381,
+    8383, 8314, 8324,
+    8314, 8383, 8313,
+    8383, 8384, 8313,
+    8383, 8382, 8384,
+    8310, 8313, 8384,
+    8382, 8385, 8384,
+    8382, 8375, 8385,
+    8375, 8374, 8385,
+    8376, 8385, 8374,
+    8386, 8384, 8385,
+    8376, 8386, 8385,
+    8386, 8310, 8384,
+    8310, 8386, 8387,
+    8306, 8310, 8387,
+    8306, 8387, 8305,
+    8388, 8387, 8386,
+    8376, 8388, 8386,
+    8389, 8305, 8387,
+    8388, 8389, 8387,
+    8388, 8376, 8390,
+    8376, 8373, 8390,
+    8370, 8390, 8373,
+    8388, 8390, 8391,
+    8389, 8388, 8391,
+    8370, 8392, 8390,
+    8392, 8391, 8390,
+    8392, 8370, 8367,
+    8392, 8367, 8368,
+    8392, 8368, 8391,
+    8368, 8393, 8391,
+    8389, 8391, 8393,
+    8368, 8366, 8393,
+    8394, 8389, 8393,
+    8366, 8395, 8393,
+    8394, 8393, 8395,
+    8366, 8396, 8395,
+    8396, 8366, 8364,
+    8397, 8394, 8395,
+    8396, 8364, 8398,
+    8360, 8398, 8364,
+    8396, 8399, 8395,
+    8397, 8395, 8399,
+    8400, 8396, 8398,
+    8396, 8400, 8399,
+    8360, 8401, 8398,
+    8360, 8358, 8401,
+    8401, 8402, 8398,
+    8400, 8398, 8402,
+    8358, 8403, 8401,
+    8358, 8356, 8403,
+    8404, 8401, 8403,
+    8401, 8404, 8402,
+    8356, 8405, 8403,
+    8406, 8404, 8403,
+    8406, 8403, 8405,
+    8405, 8356, 8407,
+    8356, 7524, 8407,
+    7526, 8407, 7524,
+    7526, 7529, 8407,
+    8405, 8407, 8408,
+    7529, 8408, 8407,
+    8409, 8405, 8408,
+    8409, 8406, 8405,
+    8408, 7529, 8410,
+    7529, 7531, 8410,
+    7535, 8410, 7531,
+    8409, 8408, 8411,
+    8408, 8410, 8411,
+    7535, 8412, 8410,
+    8412, 8411, 8410,
+    8412, 7535, 8413,
+    7535, 7537, 8413,
+    8412, 8414, 8411,
+    8412, 8413, 8414,
+    8409, 8411, 8415,
+    8414, 8415, 8411,
+    8406, 8409, 8415,
+    8406, 8415, 8416,
+    8404, 8406, 8416,
+    8414, 8417, 8415,
+    8417, 8416, 8415,
+    8404, 8416, 8418,
+    8404, 8418, 8402,
+    8416, 8419, 8418,
+    8416, 8417, 8419,
+    8420, 8402, 8418,
+    8420, 8400, 8402,
+    8421, 8420, 8418,
+    8421, 8418, 8419,
+    8400, 8420, 8422,
+    8421, 8423, 8420,
+    8423, 8422, 8420,
+    8424, 8421, 8419,
+    8421, 8424, 8423,
+    8424, 8419, 8425,
+    8417, 8425, 8419,
+    8424, 8426, 8423,
+    8427, 8424, 8425,
+    8424, 8427, 8426,
+    8427, 8425, 8428,
+    8429, 8423, 8426,
+    8423, 8429, 8422,
+    8427, 8430, 8426,
+    8427, 8428, 8430,
+    8431, 8429, 8426,
+    8431, 8426, 8430,
+    8429, 8431, 8432,
+    8433, 8431, 8430,
+    8429, 8432, 8434,
+    8429, 8434, 8422,
+    8431, 8435, 8432,
+    8431, 8433, 8435,
+    8432, 8290, 8434,
+    8432, 8281, 8290,
+    8281, 8432, 8435,
+    8292, 8434, 8290,
+    8277, 8281, 8435,
+    8292, 8436, 8434,
+    8436, 8422, 8434,
+    8436, 8400, 8422,
+    8400, 8436, 8399,
+    8292, 8437, 8436,
+    8437, 8399, 8436,
+    8437, 8292, 8294,
+    8437, 8397, 8399,
+    8437, 8294, 8438,
+    8397, 8437, 8438,
+    8295, 8438, 8294,
+    8397, 8438, 8394,
+    8438, 8295, 8439,
+    8438, 8439, 8394,
+    8295, 8298, 8439,
+    8389, 8394, 8439,
+    8305, 8439, 8298,
+    8305, 8389, 8439,
+    8440, 8441, 8241,
+    8441, 8236, 8241,
+    8441, 8239, 8236,
+    8440, 8241, 8442,
+    8268, 8442, 8241,
+    8268, 8270, 8442,
+    8270, 8443, 8442,
+    8270, 8277, 8443,
+    8277, 8435, 8443,
+    8433, 8443, 8435,
+    8444, 8442, 8443,
+    8433, 8444, 8443,
+    8444, 8440, 8442,
+    8444, 8433, 8445,
+    8433, 8430, 8445,
+    8440, 8444, 8446,
+    8444, 8445, 8446,
+    8440, 8446, 8441,
+    8428, 8445, 8430,
+    8446, 8447, 8441,
+    8239, 8441, 8447,
+    8448, 8446, 8445,
+    8428, 8448, 8445,
+    8446, 8448, 8447,
+    8448, 8428, 8449,
+    8425, 8449, 8428,
+    8425, 8417, 8449,
+    8417, 8450, 8449,
+    8451, 8448, 8449,
+    8451, 8449, 8450,
+    8450, 8417, 8452,
+    8417, 8414, 8452,
+    8413, 8452, 8414,
+    8453, 8451, 8450,
+    8413, 8454, 8452,
+    8454, 8413, 7537,
+    7544, 8454, 7537,
+    8454, 7544, 7547,
+    7572, 8454, 7547,
+    8454, 8455, 8452,
+    8450, 8452, 8455,
+    8453, 8450, 8455,
+    8454, 7572, 8456,
+    8455, 8454, 8456,
+    8453, 8455, 8457,
+    8455, 8456, 8457,
+    8453, 8457, 8451,
+    8458, 8456, 7572,
+    7573, 8458, 7572,
+    8459, 8457, 8456,
+    8458, 8459, 8456,
+    8457, 8460, 8451,
+    8457, 8459, 8460,
+    8448, 8451, 8460,
+    8461, 8448, 8460,
+    8448, 8461, 8447,
+    8461, 8460, 8462,
+    8459, 8462, 8460,
+    8463, 8447, 8461,
+    8463, 8239, 8447,
+    8464, 8461, 8462,
+    8464, 8463, 8461,
+    8239, 8463, 8465,
+    8239, 8465, 8237,
+    8463, 8464, 8466,
+    8463, 8466, 8465,
+    8467, 8237, 8465,
+    8467, 7918, 8237,
+    8468, 8465, 8466,
+    8468, 8467, 8465,
+    7918, 8467, 8469,
+    7669, 7918, 8469,
+    8468, 8470, 8467,
+    8470, 8469, 8467,
+    7669, 8469, 8471,
+    7661, 7669, 8471,
+    7661, 8471, 7659,
+    8472, 8471, 8469,
+    8470, 8472, 8469,
+    8473, 7659, 8471,
+    8472, 8473, 8471,
+    8473, 7657, 7659,
+    8472, 8470, 8474,
+    8472, 8475, 8473,
+    8475, 8472, 8474,
+    7657, 8473, 8476,
+    8475, 8476, 8473,
+    8477, 7657, 8476,
+    7657, 8477, 7656,
+    8475, 8478, 8476,
+    8479, 7656, 8477,
+    8479, 7654, 7656,
+    8477, 8476, 8480,
+    8478, 8480, 8476,
+    8481, 8479, 8477,
+    8481, 8477, 8480,
+    8481, 8482, 8479,
+    8481, 8480, 8483,
+    8482, 8481, 8483,
+    8484, 8483, 8480,
+    8478, 8484, 8480,
+    8482, 8483, 8485,
+    8484, 8486, 8483,
+    8486, 8485, 8483,
+    8484, 8478, 8487,
+    8486, 8484, 8488,
+    8484, 8487, 8488,
+    8478, 8489, 8487,
+    8478, 8475, 8489,
+    8475, 8474, 8489,
+    8490, 8489, 8474,
+    8491, 8487, 8489,
+    8490, 8491, 8489,
+    8492, 8490, 8474,
+    8490, 8492, 8491,
+    8492, 8474, 8470,
+    8468, 8492, 8470,
+    8492, 8468, 8466,
+    8492, 8466, 8491,
+    8464, 8491, 8466,
+    8491, 8464, 8487,
+    8464, 8488, 8487,
+    8464, 8462, 8488,
+    8462, 8493, 8488,
+    8486, 8488, 8493,
+    8462, 8459, 8493,
+    8494, 8486, 8493,
+    8486, 8494, 8485,
+    8459, 8495, 8493,
+    8494, 8493, 8495,
+    8494, 7305, 8485,
+    8494, 7308, 7305,
+    7308, 8494, 8495,
+    7300, 8485, 7305,
+    7308, 8495, 7310,
+    7300, 8482, 8485,
+    8495, 8496, 7310,
+    8495, 8459, 8496,
+    7312, 7310, 8496,
+    8459, 8458, 8496,
+    8497, 7312, 8496,
+    8497, 8496, 8458,
+    7312, 8497, 7318,
+    7573, 8497, 8458,
+    8497, 7583, 7318,
+    8497, 7573, 7583,
+    8482, 7300, 8498,
+    8482, 8498, 8479,
+    7300, 7297, 8498,
+    7654, 8479, 8498,
+    8499, 8498, 7297,
+    8499, 7654, 8498,
+    7293, 8499, 7297,
+    7654, 8499, 7651,
+    8499, 7293, 7291,
+    8499, 7291, 7651,
+    8500, 8501, 5756,
+    8501, 5753, 5756,
+    8500, 5756, 5817,
+    8501, 5752, 5753,
+    5820, 8500, 5817,
+    5752, 8501, 8502,
+    8501, 8500, 8503,
+    8501, 8503, 8502,
+    8500, 5820, 8504,
+    8500, 8505, 8503,
+    8505, 8500, 8504,
+    8506, 8504, 5820,
+    5822, 8506, 5820,
+    8505, 8504, 8507,
+    8506, 5822, 8508,
+    5822, 5824, 8508,
+    8114, 8508, 5824,
+    8114, 8112, 8508,
+    8506, 8508, 8509,
+    8112, 8509, 8508,
+    8506, 8510, 8504,
+    8510, 8506, 8509,
+    8510, 8507, 8504,
+    8509, 8112, 8511,
+    8112, 8109, 8511,
+    8106, 8511, 8109,
+    8106, 8105, 8511,
+    8509, 8511, 8512,
+    8105, 8512, 8511,
+    8510, 8509, 8512,
+    8105, 8103, 8512,
+    8510, 8512, 8513,
+    8103, 8513, 8512,
+    8507, 8510, 8513,
+    8103, 8514, 8513,
+    8514, 8103, 8100,
+    7892, 8514, 8100,
+    8507, 8513, 8515,
+    8514, 8515, 8513,
+    8516, 8507, 8515,
+    8516, 8505, 8507,
+    8514, 8517, 8515,
+    8516, 8518, 8505,
+    8518, 8503, 8505,
+    8516, 8515, 8519,
+    8518, 8516, 8519,
+    8517, 8519, 8515,
+    8518, 8520, 8503,
+    8520, 8502, 8503,
+    8518, 8519, 8521,
+    8520, 8518, 8521,
+    8522, 8521, 8519,
+    8517, 8522, 8519,
+    8520, 8521, 8523,
+    8522, 8524, 8521,
+    8524, 8523, 8521,
+    8522, 8517, 8525,
+    8522, 8525, 8524,
+    8517, 8526, 8525,
+    8517, 8514, 8526,
+    8514, 7892, 8526,
+    7889, 8526, 7892,
+    7889, 7882, 8526,
+    7882, 8525, 8526,
+    8525, 7882, 8527,
+    8525, 8527, 8524,
+    7882, 7878, 8527,
+    7879, 8527, 7878,
+    7879, 8528, 8527,
+    8528, 8524, 8527,
+    8524, 8528, 8523,
+    8528, 8529, 8523,
+    8530, 8523, 8529,
+    8530, 8520, 8523,
+    8531, 8530, 8529,
+    8520, 8530, 8502,
+    8530, 8531, 8532,
+    8530, 8532, 8502,
+    8531, 5749, 8532,
+    5752, 8502, 8532,
+    5748, 8532, 5749,
+    5748, 5752, 8532,
+    8533, 8534, 8535,
+    8533, 8535, 8536,
+    8533, 8537, 8534,
+    8538, 8533, 8536,
+    8533, 8538, 8537,
+    8539, 8536, 8535,
+    8538, 8536, 8540,
+    8539, 8541, 8536,
+    8541, 8540, 8536,
+    8542, 8539, 8535,
+    8541, 8539, 7990,
+    7992, 7990, 8539,
+    8542, 7992, 8539,
+    7989, 8541, 7990,
+    7992, 8542, 7994,
+    8542, 8008, 7994,
+    8008, 8542, 8543,
+    8542, 8535, 8543,
+    8008, 8543, 8009,
+    8534, 8543, 8535,
+    8013, 8009, 8543,
+    8534, 8013, 8543,
+    8013, 8534, 8544,
+    8537, 8544, 8534,
+    8545, 8013, 8544,
+    8537, 8546, 8544,
+    8013, 8545, 8547,
+    8017, 8013, 8547,
+    8017, 8547, 8021,
+    8031, 8021, 8547,
+    8548, 8031, 8547,
+    8548, 8547, 8545,
+    8031, 8548, 8051,
+    8549, 8548, 8545,
+    8549, 8545, 8550,
+    8549, 8550, 8548,
+    8550, 8051, 8548,
+    8545, 8544, 8550,
+    8546, 8550, 8544,
+    8550, 8546, 8051,
+    8546, 8052, 8051,
+    8546, 8551, 8052,
+    8551, 8054, 8052,
+    8551, 8062, 8054,
+    8062, 8551, 8087,
+    8551, 8546, 8552,
+    8551, 8552, 8087,
+    8546, 8537, 8552,
+    8538, 8552, 8537,
+    8553, 8087, 8552,
+    8538, 8553, 8552,
+    8553, 8089, 8087,
+    8553, 8538, 8540,
+    8553, 8540, 8089,
+    8540, 8091, 8089,
+    8540, 8541, 8091,
+    8541, 8554, 8091,
+    8092, 8091, 8554,
+    8554, 8541, 8555,
+    8541, 7989, 8555,
+    7905, 8555, 7989,
+    7905, 7902, 8555,
+    7902, 7903, 8555,
+    8554, 8555, 7903,
+    8556, 8554, 7903,
+    8556, 8092, 8554,
+    8556, 7903, 7901,
+    8556, 8094, 8092,
+    8094, 8556, 7901,
+    8557, 8558, 8559,
+    8557, 8559, 8560,
+    8558, 8184, 8559,
+    8186, 8559, 8184,
+    8186, 8561, 8559,
+    8561, 8560, 8559,
+    8561, 8186, 8192,
+    8562, 8560, 8561,
+    8562, 8557, 8560,
+    8561, 8192, 8563,
+    8564, 8562, 8561,
+    8564, 8561, 8563,
+    8565, 8563, 8192,
+    8193, 8565, 8192,
+    8565, 8193, 8196,
+    8565, 8196, 8566,
+    8563, 8565, 8566,
+    8199, 8566, 8196,
+    8199, 8567, 8566,
+    8563, 8566, 8568,
+    8567, 8568, 8566,
+    8564, 8563, 8568,
+    8567, 8569, 8568,
+    8564, 8568, 8570,
+    8569, 8570, 8568,
+    8562, 8564, 8570,
+    8569, 8571, 8570,
+    8562, 8570, 8572,
+    8571, 8572, 8570,
+    8557, 8562, 8572,
+    8571, 8573, 8572,
+    8557, 8572, 8574,
+    8573, 8574, 8572,
+    8558, 8557, 8574,
+    8573, 8575, 8574,
+    8575, 8576, 8574,
+    8558, 8574, 8576,
+    8575, 8178, 8576,
+    8178, 8177, 8576,
+    8577, 8558, 8576,
+    8577, 8576, 8177,
+    8558, 8577, 8184,
+    8181, 8577, 8177,
+    8577, 8181, 8184,
+    8578, 8579, 8580,
+    8578, 8580, 8581,
+    8579, 8578, 8582,
+    8583, 8581, 8580,
+    8579, 8584, 8580,
+    8585, 8583, 8580,
+    8585, 8580, 8584,
+    8583, 8586, 8581,
+    8583, 8585, 8587,
+    8586, 8583, 8588,
+    8583, 8587, 8588,
+    8586, 8589, 8581,
+    8586, 8588, 8590,
+    8586, 8590, 8589,
+    8591, 8581, 8589,
+    8591, 8578, 8581,
+    8590, 8592, 8589,
+    8578, 8591, 8593,
+    8578, 8593, 8582,
+    8594, 8591, 8589,
+    8594, 8589, 8592,
+    8591, 8595, 8593,
+    8591, 8594, 8595,
+    8596, 8593, 8595,
+    8596, 8597, 8593,
+    8597, 8582, 8593,
+    8598, 8596, 8595,
+    8597, 8599, 8582,
+    8598, 8595, 8600,
+    8594, 8600, 8595,
+    8601, 8598, 8600,
+    8594, 8602, 8600,
+    8602, 8594, 8592,
+    8601, 8600, 8603,
+    8602, 8603, 8600,
+    8604, 8601, 8603,
+    8604, 8603, 8605,
+    8606, 8604, 8605,
+    8602, 8607, 8603,
+    8607, 8605, 8603,
+    8606, 8605, 8608,
+    8609, 8606, 8608,
+    8607, 8610, 8605,
+    8610, 8608, 8605,
+    8609, 8608, 8611,
+    8612, 8609, 8611,
+    8610, 8613, 8608,
+    8613, 8611, 8608,
+    8612, 8611, 8614,
+    8615, 8612, 8614,
+    8616, 8615, 8617,
+    8615, 8614, 8617,
+    8618, 8617, 8614,
+    8619, 8614, 8611,
+    8619, 8618, 8614,
+    8613, 8619, 8611,
+    8618, 8619, 8620,
+    8621, 8618, 8620,
+    8613, 8622, 8619,
+    8622, 8620, 8619,
+    8613, 8610, 8622,
+    8621, 8620, 8623,
+    8624, 8621, 8623,
+    8622, 8625, 8620,
+    8625, 8623, 8620,
+    8610, 8626, 8622,
+    8625, 8622, 8626,
+    8610, 8607, 8626,
+    8625, 8627, 8623,
+    8607, 8628, 8626,
+    8607, 8602, 8628,
+    8602, 8592, 8628,
+    8629, 8625, 8626,
+    8629, 8626, 8628,
+    8625, 8629, 8627,
+    8630, 8628, 8592,
+    8630, 8629, 8628,
+    8590, 8630, 8592,
+    8629, 8630, 8631,
+    8630, 8590, 8631,
+    8629, 8631, 8627,
+    8588, 8631, 8590,
+    8588, 8632, 8631,
+    8632, 8627, 8631,
+    8632, 8588, 8587,
+    8627, 8632, 8633,
+    8627, 8633, 8623,
+    8624, 8623, 8633,
+    8634, 8624, 8633,
+    8634, 8633, 8635,
+    8632, 8635, 8633,
+    8636, 8634, 8635,
+    8632, 8637, 8635,
+    8637, 8632, 8587,
+    8636, 8635, 8638,
+    8637, 8638, 8635,
+    8639, 8636, 8638,
+    8637, 8587, 8640,
+    8585, 8640, 8587,
+    8637, 8641, 8638,
+    8641, 8637, 8640,
+    8639, 8638, 8642,
+    8641, 8642, 8638,
+    8643, 8639, 8642,
+    8641, 8644, 8642,
+    8641, 8640, 8644,
+    8643, 8642, 8645,
+    8644, 8645, 8642,
+    8646, 8643, 8645,
+    8640, 8647, 8644,
+    8640, 8585, 8647,
+    8644, 8648, 8645,
+    8648, 8644, 8647,
+    8646, 8645, 8649,
+    8648, 8649, 8645,
+    8650, 8646, 8649,
+    8648, 8651, 8649,
+    8651, 8648, 8647,
+    8650, 8649, 8652,
+    8651, 8652, 8649,
+    8653, 8650, 8652,
+    8651, 8647, 8654,
+    8585, 8654, 8647,
+    8654, 8585, 8584,
+    8655, 8651, 8654,
+    8651, 8655, 8652,
+    8654, 8584, 8656,
+    8655, 8654, 8656,
+    8655, 8657, 8652,
+    8655, 8656, 8657,
+    8653, 8652, 8657,
+    8658, 8653, 8657,
+    8658, 8657, 8659,
+    8656, 8659, 8657,
+    8660, 8658, 8659,
+    8656, 8661, 8659,
+    8661, 8656, 8584,
+    8579, 8661, 8584,
+    8660, 8659, 8662,
+    8661, 8662, 8659,
+    8663, 8660, 8662,
+    8661, 8579, 8664,
+    8661, 8664, 8662,
+    8579, 8582, 8664,
+    8599, 8664, 8582,
+    8664, 8665, 8662,
+    8664, 8599, 8665,
+    8663, 8662, 8665,
+    8599, 8666, 8665,
+    8667, 8663, 8665,
+    8667, 8665, 8666,
+    8668, 8667, 8666,
+    8669, 2282, 2188,
+    2282, 8669, 2285,
+    8669, 2188, 8670,
+    2172, 8670, 2188,
+    2172, 2170, 8670,
+    8671, 8669, 8670,
+    2170, 8672, 8670,
+    8671, 8670, 8672,
+    8669, 8671, 8673,
+    8669, 8673, 2285,
+    8674, 8671, 8672,
+    8675, 2285, 8673,
+    8675, 2287, 2285,
+    8671, 8676, 8673,
+    8671, 8674, 8676,
+    8677, 8675, 8673,
+    8677, 8673, 8676,
+    8674, 8678, 8676,
+    8674, 8672, 8678,
+    8679, 8677, 8676,
+    8679, 8676, 8678,
+    8672, 8680, 8678,
+    8672, 2170, 8680,
+    8681, 8679, 8678,
+    8681, 8678, 8680,
+    2170, 8682, 8680,
+    2170, 2167, 8682,
+    2167, 2168, 8682,
+    8683, 8680, 8682,
+    8683, 8681, 8680,
+    8684, 8682, 2168,
+    8684, 8683, 8682,
+    8681, 8683, 8685,
+    8683, 8684, 8686,
+    8683, 8686, 8685,
+    8681, 8685, 8687,
+    8679, 8681, 8687,
+    8688, 8685, 8686,
+    8679, 8687, 8689,
+    8677, 8679, 8689,
+    8690, 8687, 8685,
+    8688, 8690, 8685,
+    8690, 8691, 8687,
+    8691, 8689, 8687,
+    8688, 8692, 8690,
+    8691, 8690, 8693,
+    8692, 8693, 8690,
+    8691, 8694, 8689,
+    8695, 8691, 8693,
+    8691, 8695, 8694,
+    8694, 8696, 8689,
+    8677, 8689, 8696,
+    8675, 8677, 8696,
+    8675, 8696, 8697,
+    2287, 8675, 8697,
+    8694, 8698, 8696,
+    8698, 8697, 8696,
+    2287, 8697, 8699,
+    2284, 2287, 8699,
+    8698, 8700, 8697,
+    8700, 8699, 8697,
+    2284, 8699, 8701,
+    2286, 2284, 8701,
+    2286, 8701, 2290,
+    8702, 8701, 8699,
+    8700, 8702, 8699,
+    8703, 2290, 8701,
+    8702, 8703, 8701,
+    8703, 8704, 2290,
+    8704, 2292, 2290,
+    8702, 8705, 8703,
+    8704, 8706, 2292,
+    8706, 2293, 2292,
+    8704, 8703, 8707,
+    8705, 8707, 8703,
+    8704, 8708, 8706,
+    8708, 8704, 8707,
+    8706, 8709, 2293,
+    8709, 2295, 2293,
+    8708, 8710, 8706,
+    8709, 8706, 8710,
+    8709, 8711, 2295,
+    8711, 2297, 2295,
+    8712, 8709, 8710,
+    8709, 8712, 8711,
+    8708, 8713, 8710,
+    8712, 8710, 8714,
+    8713, 8714, 8710,
+    8713, 8708, 8715,
+    8708, 8707, 8715,
+    8713, 8716, 8714,
+    8713, 8715, 8716,
+    8717, 8715, 8707,
+    8705, 8717, 8707,
+    8715, 8718, 8716,
+    8717, 8719, 8715,
+    8719, 8718, 8715,
+    8717, 8705, 8720,
+    8717, 8720, 8719,
+    8705, 8721, 8720,
+    8705, 8702, 8721,
+    8702, 8700, 8721,
+    8722, 8721, 8700,
+    8698, 8722, 8700,
+    8722, 8723, 8721,
+    8723, 8720, 8721,
+    8722, 8698, 8724,
+    8698, 8694, 8724,
+    8695, 8724, 8694,
+    8723, 8722, 8725,
+    8722, 8724, 8725,
+    8695, 8726, 8724,
+    8726, 8725, 8724,
+    8726, 8695, 8727,
+    8695, 8693, 8727,
+    8726, 8728, 8725,
+    8726, 8727, 8728,
+    8728, 8729, 8725,
+    8725, 8729, 8730,
+    8723, 8725, 8730,
+    8723, 8730, 8720,
+    8730, 8731, 8720,
+    8720, 8731, 8719,
+    8730, 8732, 8731,
+    8732, 8719, 8731,
+    8732, 8730, 8729,
+    8719, 8732, 8718,
+    8728, 8732, 8729,
+    8732, 8716, 8718,
+    8732, 8728, 8733,
+    8727, 8733, 8728,
+    8734, 8733, 8727,
+    8734, 8732, 8733,
+    8735, 8734, 8727,
+    8735, 8727, 8693,
+    8692, 8735, 8693,
+    8735, 8736, 8734,
+    8735, 8692, 8736,
+    8736, 8737, 8734,
+    8732, 8734, 8737,
+    8692, 8738, 8736,
+    8692, 8688, 8738,
+    8739, 8737, 8736,
+    8739, 8732, 8737,
+    8740, 8739, 8736,
+    8740, 8736, 8738,
+    8740, 8741, 8739,
+    8742, 8740, 8738,
+    8740, 8742, 8741,
+    8688, 8743, 8738,
+    8742, 8738, 8743,
+    8743, 8688, 8686,
+    8743, 8686, 8744,
+    8684, 8744, 8686,
+    8745, 8742, 8743,
+    8745, 8743, 8744,
+    8684, 8746, 8744,
+    8746, 8684, 2168,
+    8745, 8744, 8747,
+    8746, 8747, 8744,
+    8742, 8745, 8748,
+    8742, 8748, 8741,
+    8749, 8745, 8747,
+    8745, 8749, 8748,
+    8746, 8750, 8747,
+    8749, 8747, 8751,
+    8750, 8751, 8747,
+    8750, 8746, 8752,
+    8746, 2168, 8752,
+    2165, 8752, 2168,
+    2165, 8753, 8752,
+    8753, 8754, 8752,
+    8750, 8752, 8754,
+    8753, 8755, 8754,
+    8756, 8750, 8754,
+    8750, 8756, 8751,
+    8755, 8757, 8754,
+    8756, 8754, 8757,
+    8755, 8758, 8757,
+    8758, 8759, 8757,
+    8758, 2319, 8759,
+    8760, 8756, 8757,
+    8760, 8757, 8759,
+    8756, 8760, 8761,
+    8756, 8761, 8751,
+    8762, 8760, 8759,
+    8763, 8751, 8761,
+    8763, 8749, 8751,
+    8760, 8764, 8761,
+    8760, 8762, 8764,
+    8765, 8763, 8761,
+    8765, 8761, 8764,
+    8763, 8766, 8749,
+    8766, 8748, 8749,
+    8763, 8765, 8767,
+    8766, 8763, 8767,
+    8766, 8768, 8748,
+    8768, 8741, 8748,
+    8768, 8766, 8769,
+    8766, 8767, 8769,
+    8768, 8770, 8741,
+    8768, 8769, 8770,
+    8770, 8771, 8741,
+    8741, 8771, 8739,
+    8732, 8739, 8771,
+    8770, 8732, 8771,
+    8769, 8772, 8770,
+    8732, 8770, 8772,
+    8773, 8772, 8769,
+    8773, 8732, 8772,
+    8774, 8773, 8769,
+    8774, 8769, 8767,
+    8775, 8774, 8767,
+    8775, 8767, 8765,
+    8774, 8776, 8773,
+    8774, 8775, 8776,
+    8776, 8777, 8773,
+    8732, 8773, 8777,
+    8778, 8777, 8776,
+    8778, 8732, 8777,
+    8775, 8779, 8776,
+    8780, 8778, 8776,
+    8780, 8776, 8779,
+    8775, 8781, 8779,
+    8781, 8775, 8765,
+    8781, 8765, 8764,
+    8781, 8764, 8782,
+    8762, 8782, 8764,
+    8781, 8783, 8779,
+    8783, 8781, 8782,
+    8784, 8779, 8783,
+    8784, 8780, 8779,
+    8783, 8782, 8785,
+    8780, 8784, 8786,
+    8780, 8786, 8778,
+    8787, 8784, 8783,
+    8787, 8783, 8785,
+    8784, 8787, 8788,
+    8784, 8788, 8786,
+    8787, 8785, 8789,
+    8787, 8790, 8788,
+    8790, 8787, 8789,
+    8791, 8786, 8788,
+    8792, 8788, 8790,
+    8792, 8791, 8788,
+    8791, 8793, 8786,
+    8791, 8792, 8794,
+    8791, 8794, 8793,
+    8793, 8795, 8786,
+    8786, 8795, 8778,
+    8732, 8778, 8795,
+    8793, 8732, 8795,
+    8732, 8793, 8796,
+    8794, 8796, 8793,
+    8797, 8732, 8796,
+    8797, 8796, 8794,
+    8732, 8797, 8798,
+    8716, 8732, 8798,
+    8716, 8798, 8714,
+    8714, 8798, 8797,
+    8799, 8714, 8797,
+    8799, 8797, 8794,
+    8799, 8712, 8714,
+    8799, 8794, 8800,
+    8712, 8799, 8800,
+    8792, 8800, 8794,
+    8712, 8800, 8711,
+    8792, 8801, 8800,
+    8801, 8711, 8800,
+    8801, 8792, 8790,
+    8711, 8801, 2297,
+    8801, 8790, 8802,
+    8801, 8802, 2297,
+    8790, 8789, 8802,
+    2299, 2297, 8802,
+    8803, 2299, 8802,
+    8803, 8802, 8789,
+    2299, 8803, 2300,
+    8804, 8803, 8789,
+    8804, 8789, 8785,
+    8803, 8805, 2300,
+    8803, 8804, 8805,
+    2302, 2300, 8805,
+    2305, 2302, 8805,
+    2305, 8805, 8806,
+    8804, 8806, 8805,
+    2318, 2305, 8806,
+    8804, 8807, 8806,
+    8807, 8804, 8785,
+    8807, 8785, 8782,
+    8762, 8807, 8782,
+    8807, 8808, 8806,
+    8807, 8762, 8808,
+    2318, 8806, 8808,
+    8762, 8759, 8808,
+    2319, 2318, 8808,
+    2319, 8808, 8759,
+    8809, 8810, 8811,
+    8810, 347, 8811,
+    8810, 364, 347,
+    364, 8810, 367,
+    349, 8811, 347,
+    8812, 367, 8810,
+    8809, 8812, 8810,
+    8812, 441, 367,
+    441, 8812, 444,
+    8812, 472, 444,
+    8812, 8809, 472,
+    8809, 476, 472,
+    476, 8809, 8813,
+    8809, 8811, 8813,
+    476, 8813, 480,
+    8814, 8813, 8811,
+    349, 8814, 8811,
+    8815, 480, 8813,
+    8814, 8815, 8813,
+    8815, 483, 480,
+    8814, 349, 8816,
+    349, 343, 8816,
+    8815, 8814, 8817,
+    8814, 8816, 8817,
+    483, 8815, 8818,
+    8815, 8817, 8818,
+    483, 8818, 485,
+    8819, 485, 8818,
+    485, 8819, 487,
+    8820, 8818, 8817,
+    8820, 8819, 8818,
+    8821, 8820, 8817,
+    8821, 8817, 8816,
+    8819, 8820, 994,
+    951, 8819, 994,
+    8819, 951, 950,
+    8822, 994, 8820,
+    8821, 8822, 8820,
+    8822, 995, 994,
+    995, 8822, 8823,
+    995, 8823, 997,
+    8822, 8821, 8824,
+    8822, 8824, 8823,
+    8821, 8825, 8824,
+    8825, 8821, 8816,
+    8825, 8816, 343,
+    341, 8825, 343,
+    341, 8826, 8825,
+    8826, 8824, 8825,
+    8826, 341, 330,
+    8826, 8827, 8824,
+    8827, 8823, 8824,
+    8826, 330, 8828,
+    8827, 8826, 8828,
+    327, 8828, 330,
+    327, 325, 8828,
+    8827, 8828, 8829,
+    325, 8829, 8828,
+    8827, 8830, 8823,
+    8830, 8827, 8829,
+    8830, 997, 8823,
+    8830, 999, 997,
+    999, 8830, 8831,
+    8830, 8829, 8831,
+    999, 8831, 1003,
+    4634, 1003, 8831,
+    8832, 8831, 8829,
+    8832, 4634, 8831,
+    325, 8832, 8829,
+    4634, 8832, 4631,
+    8832, 325, 323,
+    8832, 323, 4631,
+    8833, 8834, 820,
+    8834, 818, 820,
+    8834, 3806, 818,
+    3806, 8834, 8835,
+    3811, 3806, 8835,
+    8836, 8835, 8834,
+    8833, 8836, 8834,
+    3811, 8835, 8837,
+    8836, 8838, 8835,
+    8838, 8837, 8835,
+    8839, 3811, 8837,
+    8839, 3812, 3811,
+    8839, 3817, 3812,
+    8839, 8837, 3817,
+    8837, 8840, 3817,
+    8837, 8838, 8840,
+    3818, 3817, 8840,
+    3899, 3818, 8840,
+    3899, 8840, 3909,
+    8838, 3909, 8840,
+    8838, 8841, 3909,
+    8838, 8836, 8841,
+    8841, 3912, 3909,
+    8836, 8842, 8841,
+    8836, 8833, 8842,
+    8841, 8843, 3912,
+    8843, 8841, 8842,
+    8843, 3914, 3912,
+    8843, 860, 3914,
+    860, 8843, 858,
+    8843, 8844, 858,
+    8844, 8843, 8842,
+    854, 858, 8844,
+    8844, 8842, 8845,
+    8833, 8845, 8842,
+    8833, 820, 8845,
+    8846, 854, 8844,
+    8846, 8844, 8845,
+    854, 8846, 8847,
+    8846, 8845, 8847,
+    820, 8847, 8845,
+    854, 8847, 822,
+    820, 817, 8847,
+    817, 822, 8847,
+    8848, 833, 830,
+    8848, 830, 608,
+    607, 8848, 608,
+    833, 8848, 8849,
+    833, 8849, 837,
+    927, 837, 8849,
+    8848, 607, 8850,
+    607, 487, 8850,
+    8819, 8850, 487,
+    8850, 8819, 950,
+    8848, 8850, 8851,
+    8850, 950, 8851,
+    8848, 8851, 8849,
+    945, 8851, 950,
+    8852, 8849, 8851,
+    945, 8852, 8851,
+    8852, 927, 8849,
+    8852, 945, 941,
+    927, 8852, 928,
+    8852, 941, 928,
+    1127, 8853, 1134,
+    1127, 1123, 8853,
+    1138, 1134, 8853,
+    1123, 4714, 8853,
+    8854, 1138, 8853,
+    8854, 8853, 4714,
+    1138, 8854, 1148,
+    1187, 8854, 4714,
+    8854, 1178, 1148,
+    8854, 1187, 1178,
+    1165, 1164, 8855,
+    1165, 8855, 8856,
+    8857, 1165, 8856,
+    1164, 8858, 8855,
+    1164, 1166, 8858,
+    1350, 8855, 8858,
+    1166, 8859, 8858,
+    1166, 1168, 8859,
+    1343, 1350, 8858,
+    1343, 8858, 8859,
+    1339, 1343, 8859,
+    1339, 8859, 8860,
+    1168, 8860, 8859,
+    1292, 1339, 8860,
+    1168, 1170, 8860,
+    1292, 8860, 1173,
+    1170, 1173, 8860,
+    1350, 8861, 8855,
+    8861, 1350, 1370,
+    8861, 8856, 8855,
+    8861, 1370, 8862,
+    1372, 8862, 1370,
+    8861, 8863, 8856,
+    8863, 8861, 8862,
+    1372, 8864, 8862,
+    8864, 1372, 1374,
+    8863, 8862, 8865,
+    8864, 8865, 8862,
+    8863, 8866, 8856,
+    8857, 8856, 8866,
+    8867, 8857, 8866,
+    8863, 8868, 8866,
+    8868, 8863, 8865,
+    8867, 8866, 8869,
+    8868, 8869, 8866,
+    8870, 8867, 8869,
+    8868, 8871, 8869,
+    8870, 8869, 8872,
+    8871, 8872, 8869,
+    8873, 8870, 8872,
+    8871, 8868, 8874,
+    8868, 8865, 8874,
+    8871, 8875, 8872,
+    8871, 8874, 8875,
+    8873, 8872, 8876,
+    8875, 8876, 8872,
+    8877, 8873, 8876,
+    8877, 8876, 8878,
+    8879, 8877, 8878,
+    8875, 8880, 8876,
+    8880, 8878, 8876,
+    8879, 8878, 8881,
+    8882, 8879, 8881,
+    8883, 8882, 8884,
+    8882, 8881, 8884,
+    8885, 8884, 8881,
+    8886, 8885, 8881,
+    8886, 8881, 8878,
+    8885, 8886, 8887,
+    8880, 8886, 8878,
+    8886, 8888, 8887,
+    8886, 8880, 8888,
+    8889, 8887, 8888,
+    8890, 8889, 8888,
+    8889, 8890, 8891,
+    8880, 8892, 8888,
+    8890, 8888, 8892,
+    8892, 8880, 8893,
+    8880, 8875, 8893,
+    8874, 8893, 8875,
+    8874, 8894, 8893,
+    8894, 8874, 8865,
+    8864, 8894, 8865,
+    8894, 8895, 8893,
+    8892, 8893, 8895,
+    8894, 8864, 8896,
+    8894, 8896, 8895,
+    8864, 1374, 8896,
+    1457, 8896, 1374,
+    8896, 1457, 8897,
+    8896, 8897, 8895,
+    1457, 1460, 8897,
+    8898, 8895, 8897,
+    8898, 8892, 8895,
+    8898, 8890, 8892,
+    8899, 8898, 8897,
+    8899, 8897, 1460,
+    8890, 8898, 8900,
+    8898, 8899, 8900,
+    8890, 8900, 8891,
+    8901, 8891, 8900,
+    8902, 8901, 8900,
+    8902, 8900, 8899,
+    8901, 8902, 8903,
+    8904, 8902, 8899,
+    8904, 8899, 1460,
+    8904, 1460, 1462,
+    8902, 8905, 8903,
+    8902, 8904, 8905,
+    8906, 8903, 8905,
+    8904, 8907, 8905,
+    8907, 8904, 1462,
+    8908, 8906, 8905,
+    8908, 8905, 8907,
+    8906, 8908, 8909,
+    8910, 8906, 8909,
+    8911, 8908, 8907,
+    8910, 8909, 8912,
+    8913, 8910, 8912,
+    8914, 8909, 8908,
+    8911, 8914, 8908,
+    8914, 8915, 8909,
+    8915, 8912, 8909,
+    8914, 8911, 8916,
+    8915, 8914, 8917,
+    8914, 8916, 8917,
+    8915, 8918, 8912,
+    8915, 8917, 8918,
+    8913, 8912, 8919,
+    8918, 8919, 8912,
+    8920, 8913, 8919,
+    8920, 8919, 8921,
+    8922, 8920, 8921,
+    8922, 8921, 8923,
+    8924, 8921, 8919,
+    8918, 8924, 8919,
+    8921, 8925, 8923,
+    8921, 8924, 8925,
+    8926, 8923, 8925,
+    8924, 8918, 8927,
+    8917, 8927, 8918,
+    8928, 8926, 8925,
+    8926, 8928, 8929,
+    8928, 8925, 8930,
+    8924, 8930, 8925,
+    8928, 8931, 8929,
+    8932, 8929, 8931,
+    8933, 8928, 8930,
+    8928, 8933, 8931,
+    8924, 1518, 8930,
+    1518, 8924, 8927,
+    1518, 1519, 8930,
+    8933, 8930, 1519,
+    1518, 8927, 1516,
+    1521, 8933, 1519,
+    8933, 1521, 8931,
+    1523, 8931, 1521,
+    1523, 8932, 8931,
+    8932, 1523, 8934,
+    1523, 1524, 8934,
+    8932, 8934, 8935,
+    1527, 8934, 1524,
+    8934, 8936, 8935,
+    8934, 1527, 8936,
+    8937, 8935, 8936,
+    1527, 8938, 8936,
+    8938, 1527, 1570,
+    8939, 8937, 8936,
+    8939, 8936, 8938,
+    8937, 8939, 8940,
+    8938, 1570, 8941,
+    1572, 8941, 1570,
+    8942, 8939, 8938,
+    8942, 8938, 8941,
+    8939, 8943, 8940,
+    8939, 8942, 8943,
+    8944, 8940, 8943,
+    8945, 8944, 8943,
+    8945, 8943, 8946,
+    8942, 8946, 8943,
+    8947, 8945, 8946,
+    8947, 8946, 8948,
+    8946, 8942, 8949,
+    8946, 8949, 8948,
+    8942, 8941, 8949,
+    8950, 8948, 8949,
+    8951, 8949, 8941,
+    8951, 8950, 8949,
+    1572, 8951, 8941,
+    8950, 8951, 8952,
+    8951, 1572, 8953,
+    8951, 8953, 8952,
+    1572, 1574, 8953,
+    1597, 8952, 8953,
+    1593, 8953, 1574,
+    1593, 1597, 8953,
+    1766, 8954, 1763,
+    1762, 1763, 8954,
+    1766, 8955, 8954,
+    8955, 1766, 1770,
+    8956, 1762, 8954,
+    8955, 8957, 8954,
+    8956, 8954, 8957,
+    8955, 1770, 8958,
+    8955, 8958, 8957,
+    1770, 8959, 8958,
+    1770, 1771, 8959,
+    8958, 8960, 8957,
+    8961, 8958, 8959,
+    8958, 8961, 8960,
+    8962, 8957, 8960,
+    8962, 8956, 8957,
+    8961, 8963, 8960,
+    8964, 8962, 8960,
+    8964, 8960, 8963,
+    8956, 8962, 8965,
+    8962, 8964, 8966,
+    8956, 8965, 8967,
+    1762, 8956, 8967,
+    1762, 8967, 1760,
+    8962, 8968, 8965,
+    8962, 8966, 8968,
+    8969, 8967, 8965,
+    8970, 8969, 8965,
+    8970, 8965, 8968,
+    8969, 8971, 8967,
+    8969, 8970, 8971,
+    8971, 1760, 8967,
+    8971, 8972, 1760,
+    8972, 1757, 1760,
+    8970, 8973, 8971,
+    8972, 8971, 8973,
+    8970, 8974, 8973,
+    8974, 8970, 8968,
+    8975, 8972, 8973,
+    8974, 8968, 8976,
+    8966, 8976, 8968,
+    8974, 8977, 8973,
+    8975, 8973, 8977,
+    8978, 8974, 8976,
+    8974, 8979, 8977,
+    8974, 8978, 8979,
+    8980, 8975, 8977,
+    8980, 8977, 8981,
+    8979, 8981, 8977,
+    8980, 8982, 8975,
+    8983, 8980, 8981,
+    8980, 8983, 8982,
+    8982, 8984, 8975,
+    8972, 8975, 8984,
+    8983, 8985, 8982,
+    8986, 8972, 8984,
+    8972, 8986, 1757,
+    8986, 1755, 1757,
+    8986, 1753, 1755,
+    8986, 8984, 8987,
+    1753, 8986, 8987,
+    8982, 8988, 8984,
+    8988, 8987, 8984,
+    8988, 8982, 8985,
+    1753, 8987, 8989,
+    1753, 8989, 1751,
+    8987, 8988, 8990,
+    8987, 8990, 8989,
+    8988, 8991, 8990,
+    8989, 8990, 8991,
+    8988, 8992, 8991,
+    8992, 8988, 8985,
+    8993, 8989, 8991,
+    8992, 8994, 8991,
+    8993, 8991, 8994,
+    8989, 8995, 1751,
+    8989, 8993, 8995,
+    1749, 1751, 8995,
+    8996, 1749, 8995,
+    1749, 8996, 8997,
+    1747, 1749, 8997,
+    8996, 8995, 8998,
+    8993, 8998, 8995,
+    1747, 8997, 8999,
+    8999, 8997, 8996,
+    1748, 1747, 8999,
+    9000, 8999, 8996,
+    9000, 8996, 8998,
+    1748, 8999, 9001,
+    9002, 1748, 9001,
+    9000, 9003, 8999,
+    9003, 9001, 8999,
+    9002, 9001, 9004,
+    9005, 9002, 9004,
+    9003, 9006, 9001,
+    9006, 9004, 9001,
+    9003, 9000, 9007,
+    9000, 8998, 9007,
+    9006, 9003, 9008,
+    9003, 9007, 9008,
+    9009, 9007, 8998,
+    8993, 9009, 8998,
+    9010, 9008, 9007,
+    9009, 9010, 9007,
+    8993, 9011, 9009,
+    9011, 8993, 8994,
+    9011, 9012, 9009,
+    9009, 9012, 9013,
+    9010, 9009, 9013,
+    9011, 9014, 9012,
+    9014, 9013, 9012,
+    9014, 9011, 9015,
+    9011, 8994, 9015,
+    9014, 9016, 9013,
+    9017, 9015, 8994,
+    8992, 9017, 8994,
+    9014, 9015, 9018,
+    9016, 9014, 9018,
+    9017, 9019, 9015,
+    9019, 9018, 9015,
+    9017, 8992, 9020,
+    8992, 8985, 9020,
+    9019, 9017, 9021,
+    9017, 9020, 9021,
+    9022, 9020, 8985,
+    8983, 9022, 8985,
+    9023, 9021, 9020,
+    9022, 9023, 9020,
+    9022, 8983, 9024,
+    8983, 8981, 9024,
+    9023, 9022, 9025,
+    9022, 9024, 9025,
+    9026, 9024, 8981,
+    8979, 9026, 8981,
+    9027, 9025, 9024,
+    9026, 9027, 9024,
+    9027, 9028, 9025,
+    9026, 8979, 9029,
+    9027, 9026, 9030,
+    9026, 9029, 9030,
+    9028, 9027, 9031,
+    9027, 9030, 9031,
+    9028, 9032, 9025,
+    9028, 9031, 9032,
+    9023, 9025, 9032,
+    9033, 9023, 9032,
+    9023, 9033, 9021,
+    9031, 9034, 9032,
+    9033, 9032, 9034,
+    9031, 9035, 9034,
+    9035, 9031, 9030,
+    9036, 9035, 9030,
+    9036, 9030, 9029,
+    9035, 9037, 9034,
+    9035, 9036, 9037,
+    9038, 9034, 9037,
+    9038, 9033, 9034,
+    9036, 9039, 9037,
+    9040, 9038, 9037,
+    9040, 9037, 9039,
+    9036, 9041, 9039,
+    9041, 9036, 9029,
+    9041, 9029, 9042,
+    8979, 9042, 9029,
+    8978, 9042, 8979,
+    8978, 9041, 9042,
+    9041, 8978, 9043,
+    9041, 9043, 9039,
+    8978, 8976, 9043,
+    9044, 9039, 9043,
+    9044, 9040, 9039,
+    9045, 9043, 8976,
+    9045, 9044, 9043,
+    8966, 9045, 8976,
+    9044, 9045, 9046,
+    9045, 8966, 9047,
+    9045, 9047, 9046,
+    8966, 9048, 9047,
+    8964, 9048, 8966,
+    8964, 9049, 9048,
+    9049, 9047, 9048,
+    9049, 8964, 8963,
+    9049, 9050, 9047,
+    9050, 9046, 9047,
+    9049, 8963, 9051,
+    9050, 9049, 9051,
+    9052, 9051, 8963,
+    8961, 9052, 8963,
+    9050, 9051, 9053,
+    9052, 9054, 9051,
+    9054, 9053, 9051,
+    9054, 9052, 9055,
+    9054, 9055, 9053,
+    9052, 8961, 9056,
+    9052, 9056, 9055,
+    8961, 9057, 9056,
+    9057, 8961, 8959,
+    9058, 9055, 9056,
+    9057, 8959, 9059,
+    1771, 9059, 8959,
+    9060, 9056, 9057,
+    9060, 9058, 9056,
+    9061, 9057, 9059,
+    9061, 9060, 9057,
+    1771, 9062, 9059,
+    9062, 1771, 1773,
+    9061, 9059, 9063,
+    9062, 9063, 9059,
+    9062, 1773, 9064,
+    1775, 9064, 1773,
+    9062, 9065, 9063,
+    9065, 9062, 9064,
+    1775, 9066, 9064,
+    9066, 1775, 1802,
+    9066, 1802, 1807,
+    9066, 9067, 9064,
+    9065, 9064, 9067,
+    9068, 9066, 1807,
+    9066, 9068, 9067,
+    9069, 9065, 9067,
+    9068, 9070, 9067,
+    9069, 9067, 9070,
+    9065, 9069, 9071,
+    9065, 9071, 9063,
+    9072, 9063, 9071,
+    9072, 9061, 9063,
+    9073, 9072, 9071,
+    9061, 9072, 9074,
+    9060, 9061, 9074,
+    9073, 9075, 9072,
+    9075, 9074, 9072,
+    9073, 9071, 9076,
+    9075, 9073, 9076,
+    9069, 9076, 9071,
+    9075, 9076, 9077,
+    9069, 9078, 9076,
+    9078, 9077, 9076,
+    9078, 9069, 9070,
+    9079, 9075, 9077,
+    9075, 9079, 9074,
+    9060, 9074, 9080,
+    9079, 9080, 9074,
+    9058, 9060, 9080,
+    9058, 9080, 9081,
+    9055, 9058, 9081,
+    9055, 9081, 9053,
+    9082, 9081, 9080,
+    9079, 9082, 9080,
+    9083, 9053, 9081,
+    9082, 9083, 9081,
+    9083, 9050, 9053,
+    9050, 9083, 9046,
+    9079, 9084, 9082,
+    9083, 9085, 9046,
+    9044, 9046, 9085,
+    9040, 9044, 9085,
+    9083, 9082, 9086,
+    9084, 9086, 9082,
+    9085, 9083, 9087,
+    9084, 9088, 9086,
+    9085, 9087, 9089,
+    9040, 9085, 9089,
+    9088, 9084, 9090,
+    9040, 9089, 9091,
+    9084, 9092, 9090,
+    9084, 9079, 9092,
+    9079, 9077, 9092,
+    9093, 9092, 9077,
+    9078, 9093, 9077,
+    9093, 9094, 9092,
+    9094, 9090, 9092,
+    9094, 9093, 9095,
+    9094, 9095, 9090,
+    9093, 9096, 9095,
+    9093, 9078, 9096,
+    9095, 9097, 9090,
+    9088, 9090, 9097,
+    9095, 9098, 9097,
+    9098, 9095, 9096,
+    9099, 9088, 9097,
+    9088, 9099, 9086,
+    9098, 9100, 9097,
+    9099, 9097, 9100,
+    9098, 9101, 9100,
+    9101, 9098, 9096,
+    9102, 9099, 9100,
+    9101, 9096, 9103,
+    9078, 9103, 9096,
+    9101, 9104, 9100,
+    9102, 9100, 9104,
+    9102, 9105, 9099,
+    9105, 9102, 9104,
+    9105, 9086, 9099,
+    9105, 9083, 9086,
+    9083, 9105, 9106,
+    9105, 9104, 9106,
+    9083, 9106, 9087,
+    9107, 9106, 9104,
+    9101, 9107, 9104,
+    9107, 9101, 9103,
+    9108, 9087, 9106,
+    9107, 9108, 9106,
+    9108, 9109, 9087,
+    9109, 9089, 9087,
+    9107, 9110, 9108,
+    9109, 9111, 9089,
+    9111, 9091, 9089,
+    9109, 9108, 9112,
+    9110, 9112, 9108,
+    9111, 9109, 9113,
+    9110, 9114, 9112,
+    9111, 9113, 9115,
+    9114, 9110, 9116,
+    9117, 9111, 9115,
+    9111, 9117, 9091,
+    9117, 9115, 9118,
+    9117, 9119, 9091,
+    9119, 9117, 9118,
+    9120, 9091, 9119,
+    9120, 9040, 9091,
+    9040, 9120, 9038,
+    9121, 9120, 9119,
+    9120, 9122, 9038,
+    9120, 9121, 9122,
+    9033, 9038, 9122,
+    9121, 9119, 9123,
+    9121, 9123, 9122,
+    9119, 9118, 9123,
+    9124, 9033, 9122,
+    9124, 9122, 9123,
+    9125, 9123, 9118,
+    9125, 9124, 9123,
+    9126, 9125, 9118,
+    9126, 9118, 9115,
+    9124, 9125, 9127,
+    9125, 9126, 9127,
+    9033, 9124, 9128,
+    9124, 9127, 9128,
+    9033, 9128, 9021,
+    9019, 9021, 9128,
+    9129, 9019, 9128,
+    9129, 9128, 9127,
+    9019, 9129, 9018,
+    9130, 9127, 9126,
+    9130, 9129, 9127,
+    9131, 9130, 9126,
+    9131, 9126, 9115,
+    9131, 9115, 9113,
+    9130, 9131, 9113,
+    9130, 9113, 9132,
+    9129, 9130, 9132,
+    9109, 9132, 9113,
+    9109, 9133, 9132,
+    9109, 9134, 9133,
+    9134, 9109, 9112,
+    9133, 9135, 9132,
+    9134, 9112, 9136,
+    9114, 9136, 9112,
+    9134, 9137, 9133,
+    9136, 9114, 9138,
+    9139, 9134, 9136,
+    9134, 9139, 9137,
+    9114, 9116, 9138,
+    9139, 9136, 9140,
+    9136, 9138, 9140,
+    9139, 9140, 9137,
+    9141, 9140, 9138,
+    9142, 9137, 9140,
+    9141, 9142, 9140,
+    9143, 9141, 9138,
+    9143, 9138, 9116,
+    9142, 9141, 9144,
+    9141, 9143, 9144,
+    9145, 9143, 9116,
+    9145, 9116, 9146,
+    9110, 9146, 9116,
+    9145, 9147, 9143,
+    9147, 9145, 9146,
+    9147, 9144, 9143,
+    9110, 9107, 9146,
+    9147, 9146, 9148,
+    9107, 9148, 9146,
+    9147, 9149, 9144,
+    9149, 9147, 9148,
+    9148, 9107, 9150,
+    9107, 9103, 9150,
+    9148, 9150, 9151,
+    9151, 9150, 9103,
+    9149, 9148, 9151,
+    9078, 9151, 9103,
+    9149, 9151, 9152,
+    9078, 9153, 9151,
+    9153, 9152, 9151,
+    9153, 9078, 9154,
+    9078, 9070, 9154,
+    9153, 9155, 9152,
+    9156, 9154, 9070,
+    9068, 9156, 9070,
+    9153, 9154, 9157,
+    9155, 9153, 9157,
+    9156, 9158, 9154,
+    9158, 9157, 9154,
+    9156, 9068, 9159,
+    9068, 1807, 9159,
+    9158, 9156, 9160,
+    9156, 9159, 9160,
+    9161, 9159, 1807,
+    1804, 9161, 1807,
+    9161, 1804, 1806,
+    9161, 1806, 1810,
+    9162, 9161, 1810,
+    9161, 9162, 9159,
+    9162, 9160, 9159,
+    9162, 9163, 9160,
+    9163, 9164, 9160,
+    9163, 9165, 9164,
+    9158, 9160, 9164,
+    9165, 9166, 9164,
+    9167, 9158, 9164,
+    9167, 9164, 9166,
+    9158, 9167, 9157,
+    9168, 9167, 9166,
+    9167, 9169, 9157,
+    9155, 9157, 9169,
+    9168, 9170, 9167,
+    9170, 9169, 9167,
+    9170, 9155, 9169,
+    9168, 9171, 9170,
+    9155, 9170, 9152,
+    9171, 9152, 9170,
+    9171, 9149, 9152,
+    9149, 9172, 9144,
+    9149, 9173, 9172,
+    9142, 9144, 9172,
+    9173, 9174, 9172,
+    9173, 9175, 9174,
+    9175, 9176, 9174,
+    9177, 9142, 9172,
+    9177, 9172, 9174,
+    9142, 9177, 9137,
+    9177, 9133, 9137,
+    9133, 9177, 9135,
+    9178, 9174, 9176,
+    9178, 9177, 9174,
+    9179, 9178, 9176,
+    9177, 9180, 9135,
+    9132, 9135, 9180,
+    9129, 9132, 9180,
+    9178, 9179, 9181,
+    9179, 9182, 9181,
+    9178, 9181, 9183,
+    9177, 9178, 9183,
+    9184, 9181, 9182,
+    9005, 9184, 9182,
+    9184, 9185, 9181,
+    9185, 9183, 9181,
+    9184, 9005, 9186,
+    9005, 9004, 9186,
+    9185, 9184, 9187,
+    9184, 9186, 9187,
+    9188, 9186, 9004,
+    9006, 9188, 9004,
+    9189, 9187, 9186,
+    9188, 9189, 9186,
+    9188, 9006, 9190,
+    9006, 9008, 9190,
+    9189, 9188, 9191,
+    9188, 9190, 9191,
+    9192, 9190, 9008,
+    9010, 9192, 9008,
+    9193, 9191, 9190,
+    9192, 9193, 9190,
+    9192, 9010, 9194,
+    9010, 9013, 9194,
+    9016, 9194, 9013,
+    9192, 9194, 9195,
+    9193, 9192, 9195,
+    9016, 9196, 9194,
+    9196, 9195, 9194,
+    9196, 9016, 9197,
+    9016, 9018, 9197,
+    9129, 9197, 9018,
+    9196, 9198, 9195,
+    9196, 9197, 9199,
+    9198, 9196, 9199,
+    9129, 9200, 9197,
+    9200, 9199, 9197,
+    9200, 9129, 9201,
+    9129, 9180, 9201,
+    9200, 9202, 9199,
+    9203, 9201, 9180,
+    9177, 9203, 9180,
+    9177, 9183, 9203,
+    9200, 9201, 9204,
+    9202, 9200, 9204,
+    9203, 9205, 9201,
+    9205, 9204, 9201,
+    9183, 9206, 9203,
+    9205, 9203, 9206,
+    9207, 9206, 9183,
+    9207, 9205, 9206,
+    9185, 9207, 9183,
+    9207, 9185, 9208,
+    9185, 9187, 9208,
+    9207, 9208, 9209,
+    9205, 9207, 9209,
+    9210, 9208, 9187,
+    9189, 9210, 9187,
+    9210, 9211, 9208,
+    9211, 9209, 9208,
+    9210, 9189, 9212,
+    9189, 9191, 9212,
+    9211, 9210, 9213,
+    9211, 9213, 9209,
+    9210, 9212, 9213,
+    9213, 9214, 9209,
+    9205, 9209, 9214,
+    9215, 9213, 9212,
+    9213, 9215, 9214,
+    9216, 9215, 9212,
+    9216, 9212, 9191,
+    9193, 9216, 9191,
+    9215, 9216, 9217,
+    9215, 9217, 9214,
+    9216, 9193, 9218,
+    9216, 9218, 9217,
+    9193, 9195, 9218,
+    9198, 9218, 9195,
+    9219, 9217, 9218,
+    9198, 9219, 9218,
+    9219, 9220, 9217,
+    9220, 9214, 9217,
+    9220, 9205, 9214,
+    9219, 9198, 9221,
+    9219, 9221, 9220,
+    9198, 9199, 9221,
+    9202, 9221, 9199,
+    9202, 9204, 9221,
+    9204, 9222, 9221,
+    9221, 9222, 9220,
+    9204, 9205, 9222,
+    9205, 9220, 9222,
+    4955, 4948, 9223,
+    4948, 4944, 9223,
+    4955, 9223, 4962,
+    4945, 9223, 4944,
+    4945, 9224, 9223,
+    9224, 4962, 9223,
+    4945, 4943, 9224,
+    9224, 9225, 4962,
+    9225, 4963, 4962,
+    4963, 9225, 4966,
+    4943, 9226, 9224,
+    9225, 9224, 9226,
+    4943, 4939, 9226,
+    4939, 6861, 9226,
+    9227, 9226, 6861,
+    9227, 9225, 9226,
+    6863, 9227, 6861,
+    9225, 9227, 9228,
+    9225, 9228, 4966,
+    4978, 4966, 9228,
+    4984, 4978, 9228,
+    9227, 9229, 9228,
+    4984, 9228, 9229,
+    9227, 6863, 9229,
+    4989, 4984, 9229,
+    6863, 6864, 9229,
+    4989, 9229, 6864,
+    9230, 5013, 5025,
+    9230, 5025, 9231,
+    5029, 9231, 5025,
+    9230, 9232, 5013,
+    9232, 9230, 9231,
+    5029, 9233, 9231,
+    9233, 5029, 5031,
+    9233, 9234, 9231,
+    9232, 9231, 9234,
+    9233, 5031, 9235,
+    9233, 9235, 9234,
+    5031, 9236, 9235,
+    5031, 5033, 9236,
+    9235, 9237, 9234,
+    9238, 9232, 9234,
+    9238, 9234, 9237,
+    9232, 9238, 9239,
+    9232, 9239, 5013,
+    4997, 5013, 9239,
+    9240, 4997, 9239,
+    9240, 9239, 9241,
+    9238, 9241, 9239,
+    9242, 9240, 9241,
+    9238, 9243, 9241,
+    9243, 9238, 9237,
+    9242, 9241, 9244,
+    9243, 9244, 9241,
+    9245, 9242, 9244,
+    9243, 9246, 9244,
+    9245, 9244, 9247,
+    9246, 9247, 9244,
+    9248, 9245, 9247,
+    9246, 9243, 9249,
+    9243, 9237, 9249,
+    9248, 9247, 9250,
+    9251, 9248, 9250,
+    9252, 9250, 9247,
+    9251, 9250, 9252,
+    9246, 9252, 9247,
+    9246, 9249, 9252,
+    9253, 9251, 9252,
+    9253, 9252, 9254,
+    9249, 9254, 9252,
+    9255, 9253, 9254,
+    9249, 9256, 9254,
+    9256, 9249, 9237,
+    9235, 9256, 9237,
+    9256, 9235, 9236,
+    9255, 9254, 9257,
+    9256, 9257, 9254,
+    9258, 9255, 9257,
+    9256, 9259, 9257,
+    9259, 9256, 9236,
+    9258, 9257, 9260,
+    9259, 9260, 9257,
+    9261, 9258, 9260,
+    9259, 9236, 9262,
+    5033, 9262, 9236,
+    9259, 9263, 9260,
+    9263, 9259, 9262,
+    9261, 9260, 9264,
+    9263, 9264, 9260,
+    9265, 9261, 9264,
+    9265, 9264, 9266,
+    9264, 9267, 9266,
+    9264, 9263, 9267,
+    9268, 9266, 9267,
+    9263, 9269, 9267,
+    9270, 9268, 9267,
+    9270, 9267, 9269,
+    9268, 9270, 9271,
+    9272, 9268, 9271,
+    9273, 9272, 9274,
+    9272, 9271, 9274,
+    9275, 9274, 9271,
+    9276, 9275, 9271,
+    9276, 9271, 9270,
+    9277, 9276, 9270,
+    9277, 9270, 9269,
+    9277, 9269, 9278,
+    9269, 9279, 9278,
+    9269, 9263, 9279,
+    9280, 9278, 9279,
+    9263, 9262, 9279,
+    9281, 9280, 9279,
+    9281, 9279, 9262,
+    9280, 9281, 5071,
+    5033, 9281, 9262,
+    9281, 5067, 5071,
+    9281, 5033, 5067,
+    2072, 9282, 2075,
+    2072, 2070, 9282,
+    1862, 2075, 9282,
+    2070, 9283, 9282,
+    9283, 2070, 2062,
+    9284, 1862, 9282,
+    9284, 9282, 9283,
+    1862, 9284, 9285,
+    1864, 1862, 9285,
+    9286, 9284, 9283,
+    9286, 9287, 9284,
+    9286, 9283, 9287,
+    9287, 9285, 9284,
+    9283, 2062, 9287,
+    2064, 9287, 2062,
+    9287, 2064, 9285,
+    1864, 9285, 9288,
+    2064, 9288, 9285,
+    1867, 1864, 9288,
+    1867, 9288, 1871,
+    9288, 9289, 1871,
+    9288, 2064, 9289,
+    1872, 1871, 9289,
+    2064, 9290, 9289,
+    9290, 2064, 2057,
+    9291, 1872, 9289,
+    9291, 9289, 9290,
+    1872, 9291, 1894,
+    9290, 2057, 2055,
+    2055, 1894, 9291,
+    9292, 9290, 2055,
+    9292, 9291, 9290,
+    9292, 2055, 9291,
+    9293, 9294, 9295,
+    9293, 9295, 9296,
+    9294, 9297, 9295,
+    9294, 9298, 9297,
+    9295, 9299, 9296,
+    9300, 9296, 9299,
+    9295, 9301, 9299,
+    9301, 9295, 9297,
+    9302, 9300, 9299,
+    9301, 9303, 9299,
+    9302, 9299, 9303,
+    9300, 9302, 9304,
+    9305, 9300, 9304,
+    9306, 9302, 9303,
+    9305, 9304, 9307,
+    9308, 9305, 9307,
+    9308, 9307, 9309,
+    9310, 9304, 9302,
+    9306, 9310, 9302,
+    9311, 9307, 9304,
+    9310, 9311, 9304,
+    9307, 9312, 9309,
+    9307, 9311, 9312,
+    9313, 9309, 9312,
+    9311, 9310, 9314,
+    9315, 9313, 9312,
+    9311, 9316, 9312,
+    9315, 9312, 9316,
+    9311, 9317, 9316,
+    9317, 9311, 9314,
+    9313, 9315, 9318,
+    9319, 9313, 9318,
+    9319, 9318, 9320,
+    9321, 9319, 9320,
+    9321, 9320, 9322,
+    9320, 9323, 9322,
+    9324, 9322, 9323,
+    9325, 9320, 9318,
+    9320, 9325, 9323,
+    9326, 9324, 9323,
+    9324, 9326, 7377,
+    9326, 7373, 7377,
+    9326, 7370, 7373,
+    7370, 9326, 7374,
+    9326, 9323, 7374,
+    9325, 7374, 9323,
+    9325, 9327, 7374,
+    9327, 7372, 7374,
+    9325, 9328, 9327,
+    9328, 9325, 9318,
+    9328, 9318, 9315,
+    9327, 9329, 7372,
+    9329, 7361, 7372,
+    9328, 9330, 9327,
+    9329, 9327, 9330,
+    9331, 9328, 9315,
+    9328, 9331, 9330,
+    9331, 9315, 9316,
+    9332, 9329, 9330,
+    9331, 9316, 9333,
+    9317, 9333, 9316,
+    9331, 9334, 9330,
+    9332, 9330, 9334,
+    9335, 9331, 9333,
+    9334, 9331, 9336,
+    9331, 9335, 9336,
+    9337, 9332, 9334,
+    9334, 9336, 9338,
+    9337, 9334, 9338,
+    9332, 9337, 9339,
+    9337, 9338, 9340,
+    9337, 9340, 9339,
+    9332, 9339, 9341,
+    9329, 9332, 9341,
+    9329, 9341, 7361,
+    9341, 7356, 7361,
+    9341, 7349, 7356,
+    7349, 9341, 9339,
+    9342, 7349, 9339,
+    9342, 9339, 9340,
+    7349, 9342, 7347,
+    9343, 7347, 9342,
+    9343, 7345, 7347,
+    9344, 9342, 9340,
+    9344, 9343, 9342,
+    9344, 9340, 9345,
+    9338, 9345, 9340,
+    9344, 9346, 9343,
+    9346, 9344, 9345,
+    9346, 9347, 9343,
+    7345, 9343, 9347,
+    9346, 9345, 9348,
+    9338, 9349, 9345,
+    9349, 9348, 9345,
+    9349, 9338, 9336,
+    9350, 9346, 9348,
+    9346, 9350, 9347,
+    9349, 9351, 9348,
+    9350, 9348, 9352,
+    9351, 9352, 9348,
+    9353, 9349, 9336,
+    9353, 9336, 9335,
+    9351, 9349, 9354,
+    9349, 9353, 9354,
+    9355, 9353, 9335,
+    9355, 9335, 9356,
+    9355, 9356, 9353,
+    9356, 9354, 9353,
+    9335, 9333, 9356,
+    9357, 9356, 9333,
+    9356, 9357, 9354,
+    9317, 9357, 9333,
+    9357, 9358, 9354,
+    9351, 9354, 9358,
+    9357, 9317, 9359,
+    9317, 9314, 9359,
+    9357, 9359, 9360,
+    9358, 9357, 9360,
+    9361, 9359, 9314,
+    9362, 9351, 9358,
+    9351, 9362, 9352,
+    9362, 9358, 9363,
+    9358, 9360, 9363,
+    9362, 9364, 9352,
+    9362, 9363, 9365,
+    9364, 9362, 9365,
+    9366, 9352, 9364,
+    9366, 9350, 9352,
+    9367, 9366, 9364,
+    9367, 9364, 9368,
+    9364, 9365, 9368,
+    9367, 9369, 9366,
+    9367, 9368, 9369,
+    9350, 9366, 9370,
+    9369, 9370, 9366,
+    9371, 9350, 9370,
+    9350, 9371, 9347,
+    9369, 9372, 9370,
+    9373, 9347, 9371,
+    9373, 7345, 9347,
+    9371, 9370, 9374,
+    9372, 9374, 9370,
+    9375, 9373, 9371,
+    9375, 9371, 9374,
+    9375, 9374, 9373,
+    9374, 9376, 9373,
+    7345, 9373, 9376,
+    9374, 9372, 9376,
+    9377, 7345, 9376,
+    7345, 9377, 7344,
+    9377, 9376, 9378,
+    9372, 9378, 9376,
+    9377, 9379, 7344,
+    6904, 7344, 9379,
+    9380, 9377, 9378,
+    9377, 9380, 9379,
+    9381, 6904, 9379,
+    6904, 9381, 6906,
+    9380, 9382, 9379,
+    9381, 9379, 9382,
+    9380, 9383, 9382,
+    9380, 9378, 9383,
+    9384, 9381, 9382,
+    9378, 9385, 9383,
+    9378, 9372, 9385,
+    9383, 9386, 9382,
+    9384, 9382, 9386,
+    9383, 9387, 9386,
+    9387, 9383, 9385,
+    9388, 9384, 9386,
+    9384, 9389, 9381,
+    9384, 9388, 9389,
+    9389, 6906, 9381,
+    9389, 6907, 6906,
+    6907, 9389, 9390,
+    9388, 9390, 9389,
+    6909, 6907, 9390,
+    6909, 9390, 9391,
+    6914, 6909, 9391,
+    9388, 9392, 9390,
+    9392, 9391, 9390,
+    6914, 9391, 9393,
+    6914, 9393, 6915,
+    9391, 9392, 9394,
+    9391, 9394, 9393,
+    9392, 9388, 9395,
+    9388, 9386, 9395,
+    9387, 9395, 9386,
+    9392, 9395, 9396,
+    9392, 9396, 9394,
+    9395, 9397, 9396,
+    9395, 9387, 9397,
+    9398, 9394, 9396,
+    9399, 9396, 9397,
+    9399, 9398, 9396,
+    9400, 9399, 9397,
+    9398, 9401, 9394,
+    9401, 9393, 9394,
+    9399, 9402, 9398,
+    9399, 9400, 9402,
+    9401, 9398, 9403,
+    9402, 9403, 9398,
+    9401, 9404, 9393,
+    9404, 6915, 9393,
+    9404, 6916, 6915,
+    9401, 9405, 9404,
+    9405, 9401, 9403,
+    6916, 9404, 9406,
+    9405, 9406, 9404,
+    6919, 6916, 9406,
+    6919, 9406, 9407,
+    6921, 6919, 9407,
+    9405, 9408, 9406,
+    9408, 9407, 9406,
+    6921, 9407, 9409,
+    6923, 6921, 9409,
+    6923, 9409, 6926,
+    9410, 9409, 9407,
+    9408, 9410, 9407,
+    9411, 6926, 9409,
+    9410, 9411, 9409,
+    9411, 9412, 6926,
+    9412, 6929, 6926,
+    9411, 9410, 9413,
+    9412, 9414, 6929,
+    9414, 6931, 6929,
+    9412, 9411, 9415,
+    9411, 9413, 9415,
+    9414, 9412, 9416,
+    9412, 9415, 9416,
+    9414, 9417, 6931,
+    9417, 6932, 6931,
+    9417, 5339, 6932,
+    5339, 9417, 5338,
+    9417, 9414, 9418,
+    9417, 9418, 5338,
+    9414, 9416, 9418,
+    9419, 5338, 9418,
+    9419, 5336, 5338,
+    9420, 9418, 9416,
+    9420, 9419, 9418,
+    9421, 9420, 9416,
+    9421, 9416, 9415,
+    9419, 9420, 9422,
+    9423, 9421, 9415,
+    9423, 9415, 9413,
+    9421, 9424, 9420,
+    9421, 9423, 9424,
+    9424, 9422, 9420,
+    9423, 9425, 9424,
+    9424, 9426, 9422,
+    9426, 9424, 9425,
+    9423, 9427, 9425,
+    9427, 9423, 9413,
+    9428, 9426, 9425,
+    9427, 9413, 9429,
+    9410, 9429, 9413,
+    9410, 9408, 9429,
+    9408, 9430, 9429,
+    9408, 9405, 9430,
+    9405, 9403, 9430,
+    9431, 9429, 9430,
+    9431, 9427, 9429,
+    9432, 9430, 9403,
+    9432, 9431, 9430,
+    9402, 9432, 9403,
+    9427, 9431, 9433,
+    9432, 9402, 9434,
+    9400, 9434, 9402,
+    9432, 9435, 9431,
+    9435, 9432, 9434,
+    9435, 9433, 9431,
+    9435, 9434, 9436,
+    9435, 9437, 9433,
+    9437, 9435, 9436,
+    9438, 9436, 9434,
+    9400, 9438, 9434,
+    9437, 9436, 9439,
+    9438, 9400, 9440,
+    9400, 9397, 9440,
+    9387, 9440, 9397,
+    9436, 9438, 9441,
+    9436, 9441, 9439,
+    9438, 9440, 9442,
+    9438, 9443, 9441,
+    9443, 9438, 9442,
+    9444, 9442, 9440,
+    9387, 9444, 9440,
+    9443, 9442, 9445,
+    9444, 9446, 9442,
+    9446, 9445, 9442,
+    9444, 9387, 9447,
+    9446, 9444, 9448,
+    9444, 9447, 9448,
+    9387, 9449, 9447,
+    9449, 9387, 9385,
+    9449, 9385, 9450,
+    9372, 9450, 9385,
+    9451, 9449, 9450,
+    9451, 9452, 9449,
+    9451, 9450, 9452,
+    9452, 9447, 9449,
+    9450, 9372, 9453,
+    9450, 9453, 9452,
+    9372, 9369, 9453,
+    9368, 9453, 9369,
+    9454, 9452, 9453,
+    9368, 9454, 9453,
+    9452, 9454, 9447,
+    9454, 9368, 9365,
+    9454, 9448, 9447,
+    9455, 9454, 9365,
+    9454, 9455, 9448,
+    9455, 9365, 9363,
+    9455, 9456, 9448,
+    9446, 9448, 9456,
+    9457, 9455, 9363,
+    9455, 9457, 9456,
+    9457, 9363, 9360,
+    9458, 9446, 9456,
+    9446, 9458, 9445,
+    9457, 9459, 9456,
+    9458, 9456, 9459,
+    9460, 9457, 9360,
+    9457, 9460, 9459,
+    9460, 9360, 9359,
+    9361, 9460, 9359,
+    9460, 9461, 9459,
+    9460, 9361, 9461,
+    9462, 9459, 9461,
+    9462, 9458, 9459,
+    9361, 9463, 9461,
+    9463, 9361, 9314,
+    9463, 9314, 9310,
+    9306, 9463, 9310,
+    9464, 9461, 9463,
+    9306, 9464, 9463,
+    9464, 9462, 9461,
+    9464, 9306, 9465,
+    9306, 9303, 9465,
+    9462, 9464, 9466,
+    9464, 9465, 9466,
+    9462, 9466, 9467,
+    9458, 9462, 9467,
+    9458, 9467, 9445,
+    9468, 9445, 9467,
+    9468, 9443, 9445,
+    9469, 9468, 9467,
+    9469, 9467, 9466,
+    9468, 9470, 9443,
+    9468, 9469, 9470,
+    9470, 9441, 9443,
+    9471, 9469, 9466,
+    9471, 9466, 9465,
+    9469, 9472, 9470,
+    9469, 9471, 9472,
+    9470, 9473, 9441,
+    9473, 9470, 9472,
+    9473, 9439, 9441,
+    9474, 9473, 9472,
+    9473, 9475, 9439,
+    9473, 9474, 9475,
+    9475, 9476, 9439,
+    9437, 9439, 9476,
+    9474, 9477, 9475,
+    9478, 9437, 9476,
+    9437, 9478, 9433,
+    9475, 9479, 9476,
+    9479, 9475, 9477,
+    9478, 9476, 9480,
+    9479, 9480, 9476,
+    9481, 9433, 9478,
+    9481, 9427, 9433,
+    9427, 9481, 9425,
+    9428, 9425, 9481,
+    9482, 9481, 9478,
+    9482, 9428, 9481,
+    9482, 9478, 9480,
+    9428, 9482, 9483,
+    9482, 9480, 9483,
+    9428, 9483, 9484,
+    9426, 9428, 9484,
+    9485, 9483, 9480,
+    9479, 9485, 9480,
+    9485, 9486, 9483,
+    9486, 9484, 9483,
+    9479, 9487, 9485,
+    9487, 9479, 9477,
+    9486, 9485, 9488,
+    9487, 9488, 9485,
+    9486, 9489, 9484,
+    9490, 9486, 9488,
+    9486, 9490, 9489,
+    9487, 9491, 9488,
+    9490, 9488, 9492,
+    9491, 9492, 9488,
+    9491, 9487, 9493,
+    9487, 9477, 9493,
+    9491, 9494, 9492,
+    9495, 9493, 9477,
+    9474, 9495, 9477,
+    9491, 9493, 9496,
+    9494, 9491, 9496,
+    9495, 9497, 9493,
+    9497, 9496, 9493,
+    9495, 9474, 9498,
+    9495, 9498, 9497,
+    9474, 9472, 9498,
+    9471, 9498, 9472,
+    9498, 9499, 9497,
+    9498, 9471, 9499,
+    9500, 9497, 9499,
+    9497, 9500, 9496,
+    9471, 9501, 9499,
+    9501, 9471, 9465,
+    9501, 9465, 9303,
+    9301, 9501, 9303,
+    9502, 9499, 9501,
+    9301, 9502, 9501,
+    9502, 9500, 9499,
+    9502, 9301, 9297,
+    9502, 9297, 9503,
+    9500, 9502, 9503,
+    9298, 9503, 9297,
+    9298, 9504, 9503,
+    9504, 9505, 9503,
+    9500, 9503, 9505,
+    9504, 9506, 9505,
+    9507, 9500, 9505,
+    9500, 9507, 9496,
+    9494, 9496, 9507,
+    9506, 9508, 9505,
+    9507, 9505, 9508,
+    9506, 9509, 9508,
+    9510, 9494, 9507,
+    9510, 9507, 9508,
+    9509, 9511, 9508,
+    9510, 9508, 9511,
+    9509, 9512, 9511,
+    9494, 9510, 9513,
+    9494, 9513, 9492,
+    9514, 9510, 9511,
+    9510, 9514, 9513,
+    9514, 9511, 9515,
+    9512, 9515, 9511,
+    9516, 9514, 9515,
+    9515, 9512, 9517,
+    9512, 9518, 9517,
+    9516, 9515, 9519,
+    9515, 9517, 9519,
+    9516, 9520, 9514,
+    9516, 9519, 9520,
+    9520, 9513, 9514,
+    9520, 9521, 9513,
+    9521, 9492, 9513,
+    9521, 9490, 9492,
+    9521, 9520, 9522,
+    9519, 9522, 9520,
+    9490, 9521, 9523,
+    9490, 9523, 9489,
+    9524, 9521, 9522,
+    9521, 9524, 9523,
+    9519, 9525, 9522,
+    9525, 9519, 9517,
+    9524, 9522, 9526,
+    9525, 9526, 9522,
+    9527, 9524, 9526,
+    9528, 9525, 9517,
+    9528, 9517, 9518,
+    9529, 9528, 9518,
+    9529, 9530, 9528,
+    9530, 9531, 9528,
+    9525, 9528, 9531,
+    9530, 9532, 9531,
+    9533, 9525, 9531,
+    9532, 9534, 9531,
+    9533, 9531, 9534,
+    9534, 9532, 9535,
+    9532, 9536, 9535,
+    9537, 9538, 9536,
+    9538, 9535, 9536,
+    9538, 9539, 9535,
+    9539, 9540, 9535,
+    9534, 9535, 9540,
+    9539, 9541, 9540,
+    9542, 9534, 9540,
+    9542, 9533, 9534,
+    9541, 9543, 9540,
+    9542, 9540, 9543,
+    9541, 9544, 9543,
+    9544, 9545, 9543,
+    9546, 9543, 9545,
+    9546, 9542, 9543,
+    9547, 9546, 9545,
+    9542, 9546, 9548,
+    9542, 9548, 9533,
+    9546, 9547, 9549,
+    9546, 9549, 9548,
+    9548, 9550, 9533,
+    9525, 9533, 9550,
+    9526, 9525, 9550,
+    9548, 9551, 9550,
+    9551, 9548, 9549,
+    9526, 9550, 9552,
+    9551, 9552, 9550,
+    9527, 9526, 9552,
+    9551, 9553, 9552,
+    9527, 9552, 9554,
+    9553, 9554, 9552,
+    9555, 9527, 9554,
+    9527, 9555, 9524,
+    9555, 9523, 9524,
+    9555, 9556, 9523,
+    9556, 9489, 9523,
+    9555, 9554, 9557,
+    9556, 9555, 9557,
+    9489, 9556, 9558,
+    9489, 9558, 9484,
+    9426, 9484, 9558,
+    9556, 9559, 9558,
+    9556, 9557, 9559,
+    9560, 9426, 9558,
+    9560, 9558, 9559,
+    9426, 9560, 9561,
+    9426, 9561, 9422,
+    9562, 9560, 9559,
+    9563, 9422, 9561,
+    9563, 9419, 9422,
+    9419, 9563, 5336,
+    9563, 5307, 5336,
+    9563, 9564, 5307,
+    9564, 9563, 9561,
+    9564, 5304, 5307,
+    9560, 9565, 9561,
+    9564, 9561, 9565,
+    9560, 9562, 9565,
+    5304, 9564, 9566,
+    5304, 9566, 5305,
+    9567, 9564, 9565,
+    9564, 9567, 9566,
+    9567, 9565, 9568,
+    9562, 9568, 9565,
+    9569, 9567, 9568,
+    9569, 9570, 9567,
+    9570, 9566, 9567,
+    9569, 9568, 9571,
+    9570, 9569, 9571,
+    9562, 9572, 9568,
+    9572, 9571, 9568,
+    9572, 9562, 9573,
+    9562, 9559, 9573,
+    9557, 9573, 9559,
+    9572, 9574, 9571,
+    9557, 9575, 9573,
+    9575, 9557, 9554,
+    9572, 9573, 9576,
+    9575, 9576, 9573,
+    9574, 9572, 9576,
+    9553, 9575, 9554,
+    9574, 9577, 9571,
+    9570, 9571, 9577,
+    9574, 9578, 9577,
+    9574, 9576, 9578,
+    9579, 9570, 9577,
+    9570, 9579, 9566,
+    9579, 5305, 9566,
+    9579, 5306, 5305,
+    9579, 9577, 9580,
+    5306, 9579, 9580,
+    9578, 9580, 9577,
+    5306, 9580, 9581,
+    5308, 5306, 9581,
+    9578, 9582, 9580,
+    9582, 9581, 9580,
+    9582, 9578, 9583,
+    9576, 9583, 9578,
+    9584, 9583, 9576,
+    9584, 9582, 9583,
+    9575, 9584, 9576,
+    9582, 9584, 9585,
+    9582, 9585, 9581,
+    9584, 9575, 9586,
+    9584, 9586, 9585,
+    9575, 9587, 9586,
+    9575, 9553, 9587,
+    9588, 9585, 9586,
+    9553, 9589, 9587,
+    9553, 9551, 9589,
+    9590, 9586, 9587,
+    9590, 9588, 9586,
+    9591, 9590, 9587,
+    9591, 9587, 9589,
+    9588, 9590, 9592,
+    9591, 9593, 9590,
+    9593, 9592, 9590,
+    9593, 9594, 9592,
+    9594, 9593, 9595,
+    9594, 9596, 9592,
+    9594, 9595, 9596,
+    9597, 9592, 9596,
+    9597, 9588, 9592,
+    9598, 9597, 9596,
+    9588, 9597, 9599,
+    9598, 9596, 9600,
+    9595, 9600, 9596,
+    9597, 9598, 9601,
+    9597, 9601, 9599,
+    9602, 9598, 9600,
+    9598, 9602, 9601,
+    9595, 5280, 9600,
+    9602, 9600, 9603,
+    5280, 9603, 9600,
+    5280, 9595, 9604,
+    9593, 9604, 9595,
+    5280, 5281, 9603,
+    9605, 5280, 9604,
+    9593, 9591, 9604,
+    9605, 9604, 9606,
+    9591, 9606, 9604,
+    9607, 9605, 9606,
+    9591, 9608, 9606,
+    9607, 9606, 9609,
+    9608, 9609, 9606,
+    9610, 9607, 9609,
+    9607, 9610, 9611,
+    9608, 9612, 9609,
+    9610, 9613, 9611,
+    9614, 9611, 9613,
+    9610, 9609, 9615,
+    9612, 9615, 9609,
+    9616, 9610, 9615,
+    9610, 9616, 9613,
+    9612, 9617, 9615,
+    9612, 9608, 9617,
+    9616, 9615, 9618,
+    9617, 9618, 9615,
+    9619, 9616, 9618,
+    9616, 9619, 9613,
+    9617, 9620, 9618,
+    9621, 9613, 9619,
+    9621, 9614, 9613,
+    9614, 9621, 9622,
+    9621, 9623, 9622,
+    9624, 9622, 9623,
+    9625, 9621, 9619,
+    9621, 9625, 9623,
+    9625, 9619, 9626,
+    9619, 9618, 9626,
+    9620, 9626, 9618,
+    9625, 9626, 9627,
+    9625, 9627, 9623,
+    9626, 9628, 9627,
+    9626, 9620, 9628,
+    9629, 9623, 9627,
+    9629, 9624, 9623,
+    9624, 9629, 9630,
+    9629, 9631, 9630,
+    9632, 9630, 9631,
+    9633, 9629, 9627,
+    9629, 9633, 9631,
+    9633, 9627, 9634,
+    9627, 9628, 9634,
+    9620, 9634, 9628,
+    9633, 9634, 9635,
+    9633, 9635, 9631,
+    9634, 9620, 9636,
+    9634, 9636, 9635,
+    9637, 9631, 9635,
+    9637, 9632, 9631,
+    9632, 9637, 9638,
+    9639, 9637, 9635,
+    9639, 9635, 9636,
+    9637, 9640, 9638,
+    9637, 9639, 9640,
+    9547, 9638, 9640,
+    9639, 9641, 9640,
+    9641, 9639, 9636,
+    9642, 9547, 9640,
+    9642, 9640, 9641,
+    9547, 9642, 9643,
+    9547, 9643, 9549,
+    9644, 9642, 9641,
+    9645, 9549, 9643,
+    9645, 9551, 9549,
+    9551, 9645, 9589,
+    9642, 9646, 9643,
+    9642, 9644, 9646,
+    9647, 9645, 9643,
+    9647, 9643, 9646,
+    9648, 9589, 9645,
+    9647, 9648, 9645,
+    9648, 9591, 9589,
+    9647, 9649, 9648,
+    9649, 9647, 9646,
+    9591, 9648, 9650,
+    9649, 9650, 9648,
+    9608, 9591, 9650,
+    9608, 9650, 9617,
+    9620, 9617, 9650,
+    9649, 9620, 9650,
+    9620, 9649, 9651,
+    9649, 9646, 9651,
+    9620, 9651, 9636,
+    9644, 9651, 9646,
+    9641, 9636, 9651,
+    9644, 9641, 9651,
+    9585, 9652, 9581,
+    9585, 9588, 9652,
+    5308, 9581, 9652,
+    9588, 9599, 9652,
+    5310, 5308, 9652,
+    5310, 9652, 9599,
+    9653, 5310, 9599,
+    9653, 9599, 9601,
+    5310, 9653, 9654,
+    5310, 9654, 5301,
+    5297, 5301, 9654,
+    5293, 5297, 9654,
+    5293, 9654, 9655,
+    9653, 9655, 9654,
+    5289, 5293, 9655,
+    9653, 9656, 9655,
+    9656, 9653, 9601,
+    9656, 9601, 9602,
+    5289, 9655, 9657,
+    9656, 9657, 9655,
+    5286, 5289, 9657,
+    5286, 9657, 5284,
+    9656, 9658, 9657,
+    9658, 5284, 9657,
+    9658, 9656, 9602,
+    9658, 9602, 9603,
+    5284, 9658, 9659,
+    9658, 9603, 9659,
+    5284, 9659, 5281,
+    5281, 9659, 9603,
+    9660, 9661, 9662,
+    9661, 9660, 9663,
+    9660, 9664, 9663,
+    9665, 9666, 9664,
+    9666, 9663, 9664,
+    9666, 7385, 9663,
+    7385, 7392, 9663,
+    9661, 9663, 7392,
+    9667, 9661, 7392,
+    9667, 7392, 7394,
+    9661, 9667, 9668,
+    9667, 7394, 9668,
+    9661, 9668, 9662,
+    7395, 9668, 7394,
+    7398, 9662, 9668,
+    7395, 7398, 9668,
+    8917, 9669, 8927,
+    9669, 1516, 8927,
+    9669, 8917, 8916,
+    9669, 1465, 1516,
+    9669, 9670, 1465,
+    9670, 9669, 8916,
+    9670, 1461, 1465,
+    9670, 1459, 1461,
+    9670, 8916, 9671,
+    1459, 9670, 9671,
+    8911, 9671, 8916,
+    1459, 9671, 1462,
+    8911, 8907, 9671,
+    8907, 1462, 9671,
+    9672, 9673, 9674,
+    9672, 9674, 9675,
+    9673, 9672, 9676,
+    9677, 9675, 9674,
+    9673, 9678, 9674,
+    9679, 9677, 9674,
+    9679, 9674, 9678,
+    9677, 9680, 9675,
+    9680, 9681, 9675,
+    9682, 9675, 9681,
+    9682, 9672, 9675,
+    9683, 9682, 9681,
+    9672, 9682, 9684,
+    9672, 9684, 9676,
+    9682, 9683, 9685,
+    9682, 9685, 9684,
+    9683, 9686, 9685,
+    9687, 9685, 9686,
+    9688, 9687, 9686,
+    9689, 9684, 9685,
+    9687, 9689, 9685,
+    9687, 9688, 9690,
+    9688, 9691, 9690,
+    9689, 9687, 9692,
+    9687, 9690, 9692,
+    9689, 9693, 9684,
+    9693, 9676, 9684,
+    9693, 9689, 9694,
+    9689, 9692, 9694,
+    9693, 9695, 9676,
+    9693, 9694, 9696,
+    9695, 9693, 9696,
+    9695, 9697, 9676,
+    9673, 9676, 9697,
+    9695, 9696, 9698,
+    9695, 9698, 9697,
+    9699, 9673, 9697,
+    9673, 9699, 9678,
+    9698, 9700, 9697,
+    9699, 9697, 9700,
+    9696, 9701, 9698,
+    9696, 9702, 9701,
+    9702, 9696, 9694,
+    9703, 9698, 9701,
+    9698, 9703, 9700,
+    9702, 9704, 9701,
+    9705, 9702, 9694,
+    9702, 9705, 9704,
+    9705, 9694, 9692,
+    9706, 9701, 9704,
+    9706, 9703, 9701,
+    9705, 9707, 9704,
+    9708, 9706, 9704,
+    9708, 9704, 9707,
+    9709, 9705, 9692,
+    9705, 9709, 9707,
+    9709, 9692, 9690,
+    9710, 9709, 9690,
+    9710, 9690, 9691,
+    9711, 9710, 9691,
+    9709, 9710, 9712,
+    9709, 9712, 9707,
+    9710, 9711, 9713,
+    9710, 9713, 9712,
+    9711, 9714, 9713,
+    9715, 9707, 9712,
+    9715, 9708, 9707,
+    9716, 9712, 9713,
+    9716, 9715, 9712,
+    9717, 9713, 9714,
+    9717, 9716, 9713,
+    9718, 9717, 9714,
+    9716, 9719, 9715,
+    9716, 9717, 9719,
+    9717, 9718, 9720,
+    9717, 9720, 9719,
+    9718, 9721, 9720,
+    9722, 9723, 9721,
+    9723, 9720, 9721,
+    9723, 9724, 9720,
+    9724, 9719, 9720,
+    9719, 9724, 9725,
+    9719, 9725, 9715,
+    9724, 9726, 9725,
+    9708, 9715, 9725,
+    9727, 9725, 9726,
+    9727, 9708, 9725,
+    9728, 9727, 9726,
+    9708, 9727, 9706,
+    9727, 9728, 9729,
+    9727, 9729, 9706,
+    9728, 9730, 9729,
+    9703, 9706, 9729,
+    9731, 9729, 9730,
+    9731, 9703, 9729,
+    9732, 9731, 9730,
+    9703, 9731, 9733,
+    9703, 9733, 9700,
+    9731, 9732, 9734,
+    9731, 9734, 9733,
+    9732, 9735, 9734,
+    9736, 9700, 9733,
+    9736, 9699, 9700,
+    9737, 9733, 9734,
+    9737, 9736, 9733,
+    9738, 9734, 9735,
+    9738, 9737, 9734,
+    9739, 9738, 9735,
+    9737, 9740, 9736,
+    9737, 9738, 9740,
+    9738, 9739, 9741,
+    9738, 9741, 9740,
+    9739, 9742, 9741,
+    9740, 9743, 9736,
+    9699, 9736, 9743,
+    9744, 9740, 9741,
+    9740, 9744, 9743,
+    9745, 9741, 9742,
+    9745, 9744, 9741,
+    9746, 9745, 9742,
+    9744, 9745, 9747,
+    9744, 9747, 9743,
+    9745, 9746, 9748,
+    9745, 9748, 9747,
+    9746, 9749, 9748,
+    9750, 9743, 9747,
+    9750, 9699, 9743,
+    9699, 9750, 9678,
+    9751, 9750, 9747,
+    9751, 9747, 9748,
+    9752, 9678, 9750,
+    9751, 9752, 9750,
+    9752, 9679, 9678,
+    9753, 9751, 9748,
+    9751, 9753, 9752,
+    9753, 9748, 9749,
+    9754, 9753, 9749,
+    9753, 9755, 9752,
+    9753, 9754, 9755,
+    9679, 9752, 9755,
+    9754, 9756, 9755,
+    9757, 9679, 9755,
+    9757, 9755, 9756,
+    9679, 9757, 9677,
+    9758, 9757, 9756,
+    9757, 9759, 9677,
+    9757, 9758, 9759,
+    9680, 9677, 9759,
+    9758, 9760, 9759,
+    9761, 9680, 9759,
+    9761, 9759, 9760,
+    9762, 9761, 9760,
+};
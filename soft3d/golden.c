@@ -0,0 +1,318 @@
+// soft3d by Andrej Suvorau, 2019
+
+#include "soft3d.h"
+#include "image.h"
+#include "potato.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PATH_LENGTH 1024
+
+typedef struct {
+    const char* name;
+    unsigned int width;
+    unsigned int height;
+    float angle;
+    float distance;
+} GoldenFrame;
+
+static const GoldenFrame golden_frames[] = {
+    { "front",     800, 600, 0.f, 2.f },
+    { "side",      800, 600, 1.5707963f, 2.f },
+    { "back",      800, 600, 3.1415926f, 2.f },
+    { "oblique",   800, 600, 3.9f, 2.5f },
+    { "far",       800, 600, 0.7f, 10.f },
+    { "small",     320, 240, 2.2f, 3.f },
+};
+
+typedef struct {
+    int channel_tolerance;  // Largest per-channel difference of a pixel that still counts as equal.
+    double max_bad_pixels;  // Fraction of pixels allowed to exceed `channel_tolerance` or `depth_tolerance`.
+    double min_psnr;        // In decibels, over the color channels.
+    double depth_tolerance;
+} Tolerances;
+
+DepthColorBuffer backbuffer;
+
+// Triangles whose coverage is known without golden images, drawn on every compare. The transform maps
+// z to w = -z and to a depth of 1 / z, so vertices with z < 0 are behind the camera and a near plane at
+// `near_depth` 1 is at z = 1.
+typedef struct {
+    const char* name;
+    Vertex vertices[3];
+    float near_depth;
+    unsigned int expected_pixels;
+} CoverageCase;
+
+#define COVERAGE_TARGET_SIZE 64
+
+static const CoverageCase coverage_cases[] = {
+    // Crosses the camera plane and, once clipped, covers the whole target. Outcodes taken after the
+    // divide mirror the vertex behind the camera and used to reject it as outside the left and right edges.
+    { "camera plane", { { -10.f, -1.f, 1.f, 0.f, 0.f }, { -10.f, 1.f, 1.f, 0.f, 0.f }, { 30.f, 0.f, -1.f, 0.f, 0.f } },
+      INFINITY, COVERAGE_TARGET_SIZE * COVERAGE_TARGET_SIZE },
+    // Same, with the vertices in front of the camera outside and inside the guard band to the right.
+    // The one behind must be classified against the guard planes in clip space for the triangle to
+    // reach the guard band clipper.
+    { "camera plane, outside guard band", { { -3.f, -1.f, 1.f, 0.f, 0.f }, { -3.f, 1.f, 1.f, 0.f, 0.f }, { 30.f, 0.f, -1.f, 0.f, 0.f } },
+      INFINITY, COVERAGE_TARGET_SIZE * COVERAGE_TARGET_SIZE },
+    { "camera plane, inside guard band", { { -1.f, -1.f, 1.f, 0.f, 0.f }, { -1.f, 1.f, 1.f, 0.f, 0.f }, { 30.f, 0.f, -1.f, 0.f, 0.f } },
+      INFINITY, COVERAGE_TARGET_SIZE * COVERAGE_TARGET_SIZE },
+    // Covers the target at z = 2, behind the near plane, and is clipped away entirely at z = 0.5,
+    // between the camera and the near plane.
+    { "behind near plane", { { -20.f, -20.f, 2.f, 0.f, 0.f }, { 60.f, -20.f, 2.f, 0.f, 0.f }, { -20.f, 60.f, 2.f, 0.f, 0.f } },
+      1.f, COVERAGE_TARGET_SIZE * COVERAGE_TARGET_SIZE },
+    { "in front of near plane", { { -5.f, -5.f, 0.5f, 0.f, 0.f }, { 15.f, -5.f, 0.5f, 0.f, 0.f }, { -5.f, 15.f, 0.5f, 0.f, 0.f } },
+      1.f, 0 },
+};
+
+static void build_path(char* path, const char* directory, const char* name, const char* suffix) {
+    snprintf(path, PATH_LENGTH, "%s/%s%s", directory, name, suffix);
+}
+
+static int record(const char* directory) {
+    const size_t frame_count = sizeof(golden_frames) / sizeof(golden_frames[0]);
+
+    for (size_t i = 0; i < frame_count; i++) {
+        const GoldenFrame* frame = &golden_frames[i];
+        potato_resize(frame->width, frame->height);
+        potato_render(frame->angle, frame->distance);
+
+        char color_path[PATH_LENGTH], depth_path[PATH_LENGTH];
+        build_path(color_path, directory, frame->name, ".tga");
+        build_path(depth_path, directory, frame->name, "_depth.bin");
+
+        if (!save_image(color_path, backbuffer.width, backbuffer.height, backbuffer.data) ||
+            !save_depth(depth_path, backbuffer.width, backbuffer.height, backbuffer.depth)) {
+            fprintf(stderr, "failed to write %s\n", color_path);
+            return EXIT_FAILURE;
+        }
+
+        printf("recorded %s\n", frame->name);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+// Returns 1 when the backbuffer matches the golden frame. On mismatch, the rendered frame and an
+// image of the differing pixels are written next to the golden images.
+static int compare_frame(const GoldenFrame* frame, const char* directory, const Tolerances* tolerances) {
+    char color_path[PATH_LENGTH], depth_path[PATH_LENGTH];
+    build_path(color_path, directory, frame->name, ".tga");
+    build_path(depth_path, directory, frame->name, "_depth.bin");
+
+    ColorBuffer golden_color = { 0 };
+    DepthColorBuffer golden_depth = { 0 };
+    if (!load_image(color_path, &golden_color) || !load_depth(depth_path, &golden_depth)) {
+        printf("%-8s FAIL  missing or unreadable golden image in %s\n", frame->name, directory);
+        free(golden_color.data);
+        free(golden_depth.depth);
+        return 0;
+    }
+
+    if (golden_color.width != backbuffer.width || golden_color.height != backbuffer.height ||
+        golden_depth.width != backbuffer.width || golden_depth.height != backbuffer.height) {
+        printf("%-8s FAIL  golden image is %ux%u, rendered %ux%u\n", frame->name, golden_color.width, golden_color.height, backbuffer.width, backbuffer.height);
+        free(golden_color.data);
+        free(golden_depth.depth);
+        return 0;
+    }
+
+    const size_t size = (size_t)backbuffer.width * backbuffer.height;
+    Color* difference = (Color*)calloc(size, sizeof(Color));
+
+    size_t bad_pixels = 0;
+    size_t bad_depths = 0;
+    int max_channel_difference = 0;
+    double max_depth_difference = 0.0;
+    double squared_error = 0.0;
+
+    for (size_t i = 0; i < size; i++) {
+        const Color expected = golden_color.data[i];
+        const Color actual = backbuffer.data[i];
+
+        const int db = abs(expected.b - actual.b);
+        const int dg = abs(expected.g - actual.g);
+        const int dr = abs(expected.r - actual.r);
+        squared_error += db * db + dg * dg + dr * dr;
+
+        int channel_difference = db > dg ? db : dg;
+        channel_difference = dr > channel_difference ? dr : channel_difference;
+        max_channel_difference = channel_difference > max_channel_difference ? channel_difference : max_channel_difference;
+
+        const double depth_difference = fabs((double)golden_depth.depth[i] - backbuffer.depth[i]);
+        max_depth_difference = depth_difference > max_depth_difference ? depth_difference : max_depth_difference;
+
+        const int bad_color = channel_difference > tolerances->channel_tolerance;
+        const int bad_depth = depth_difference > tolerances->depth_tolerance;
+        bad_pixels += bad_color;
+        bad_depths += bad_depth;
+
+        if (difference != NULL) {
+            difference[i].r = bad_color ? 0xFF : actual.r / 4;
+            difference[i].g = bad_depth ? 0xFF : actual.g / 4;
+            difference[i].b = actual.b / 4;
+            difference[i].a = 0xFF;
+        }
+    }
+
+    const double mean_squared_error = squared_error / (3.0 * size);
+    const double psnr = mean_squared_error > 0.0 ? 10.0 * log10(255.0 * 255.0 / mean_squared_error) : INFINITY;
+    const size_t max_bad_pixels = (size_t)(tolerances->max_bad_pixels * size);
+
+    const int passed = bad_pixels <= max_bad_pixels && bad_depths <= max_bad_pixels && psnr >= tolerances->min_psnr;
+    printf("%-8s %s  psnr %.2f dB, max channel difference %d, %zu bad pixels, max depth difference %g, %zu bad depths\n",
+           frame->name, passed ? "ok  " : "FAIL", psnr, max_channel_difference, bad_pixels, max_depth_difference, bad_depths);
+
+    if (!passed) {
+        char actual_path[PATH_LENGTH], difference_path[PATH_LENGTH];
+        build_path(actual_path, directory, frame->name, "_actual.tga");
+        build_path(difference_path, directory, frame->name, "_difference.tga");
+
+        save_image(actual_path, backbuffer.width, backbuffer.height, backbuffer.data);
+        if (difference != NULL) {
+            save_image(difference_path, backbuffer.width, backbuffer.height, difference);
+        }
+    }
+
+    free(difference);
+    free(golden_color.data);
+    free(golden_depth.depth);
+    return passed;
+}
+
+// Draws every coverage case as a plain triangle list, which goes through the scalar transform, and
+// indexed out of a buffer of 8 vertices, which goes through the batched one. Returns the number of failed draws.
+static size_t check_coverage_cases() {
+    const size_t case_count = sizeof(coverage_cases) / sizeof(coverage_cases[0]);
+    const Matrix transform = { { 1.f, 0.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 0.f, -1.f, 0.f, 0.f, -1.f, 0.f } };
+    Color texel = { 0xFF, 0xFF, 0xFF, 0xFF };
+    const ColorBuffer texture = { 1, 1, &texel };
+    static const unsigned short indices[3] = { 0, 1, 2 };
+    const IndexBuffer index_buffer = { 3, INDEX_FORMAT_UINT16, (void*)indices };
+
+    DepthColorBuffer target = { COVERAGE_TARGET_SIZE, COVERAGE_TARGET_SIZE, NULL, NULL };
+    target.data = (Color*)malloc(COVERAGE_TARGET_SIZE * COVERAGE_TARGET_SIZE * sizeof(Color));
+    target.depth = (float*)malloc(COVERAGE_TARGET_SIZE * COVERAGE_TARGET_SIZE * sizeof(float));
+    if (target.data == NULL || target.depth == NULL) {
+        free(target.data);
+        free(target.depth);
+        printf("coverage FAIL  out of memory\n");
+        return case_count;
+    }
+
+    size_t failed_draws = 0;
+    for (size_t i = 0; i < case_count; i++) {
+        const CoverageCase* coverage_case = &coverage_cases[i];
+        Vertex vertices[8];
+        for (size_t j = 0; j < 8; j++) {
+            vertices[j] = coverage_case->vertices[j % 3];
+        }
+
+        for (int indexed = 0; indexed < 2; indexed++) {
+            for (size_t j = 0; j < COVERAGE_TARGET_SIZE * COVERAGE_TARGET_SIZE; j++) {
+                target.depth[j] = -1000.f;
+            }
+
+            PipelineStatistics statistics;
+            reset_pipeline_statistics();
+            set_near_plane(coverage_case->near_depth);
+            if (indexed) {
+                const VertexBuffer vertex_buffer = { 8, vertices, NULL };
+                rasterize_indexed(&vertex_buffer, &index_buffer, &transform, &texture, &target);
+            } else {
+                const VertexBuffer vertex_buffer = { 3, vertices, NULL };
+                rasterize_vertices(&vertex_buffer, &transform, &texture, &target);
+            }
+            get_pipeline_statistics(&statistics);
+            set_near_plane(INFINITY);
+
+            const int passed = statistics.pixels_passed == coverage_case->expected_pixels;
+            printf("%-8s %s  %s, %s: %llu of %u pixels covered\n", "coverage", passed ? "ok  " : "FAIL", coverage_case->name,
+                   indexed ? "indexed" : "list", statistics.pixels_passed, coverage_case->expected_pixels);
+            failed_draws += !passed;
+        }
+    }
+
+    free(target.data);
+    free(target.depth);
+    return failed_draws;
+}
+
+static int compare(const char* directory, const Tolerances* tolerances) {
+    const size_t frame_count = sizeof(golden_frames) / sizeof(golden_frames[0]);
+
+    size_t failed_frames = 0;
+    for (size_t i = 0; i < frame_count; i++) {
+        const GoldenFrame* frame = &golden_frames[i];
+        potato_resize(frame->width, frame->height);
+        potato_render(frame->angle, frame->distance);
+
+        failed_frames += !compare_frame(frame, directory, tolerances);
+    }
+
+    printf("%zu of %zu frames match\n", frame_count - failed_frames, frame_count);
+
+    const size_t failed_draws = check_coverage_cases();
+    return failed_frames == 0 && failed_draws == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+static int print_usage(const char* program) {
+    fprintf(stderr, "usage: %s record <directory> [--packed | --soa | --meshlets | --lod]\n"
+                    "       %s compare <directory> [--channel-tolerance N] [--max-bad-pixels FRACTION]\n"
+                    "                              [--min-psnr DB] [--depth-tolerance D] [--packed | --soa | --meshlets | --lod]\n", program, program);
+    return EXIT_FAILURE;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        return print_usage(argv[0]);
+    }
+
+    const int recording = strcmp(argv[1], "record") == 0;
+    if (!recording && strcmp(argv[1], "compare") != 0) {
+        return print_usage(argv[0]);
+    }
+
+    Tolerances tolerances = { 0, 0.0005, 40.0, 0.0001 };
+    PotatoVertexLayout vertex_layout = POTATO_VERTEX_LAYOUT_FLOAT;
+    for (int i = 3; i < argc; i++) {
+        if (strcmp(argv[i], "--packed") == 0) {
+            vertex_layout = POTATO_VERTEX_LAYOUT_PACKED;
+        } else if (strcmp(argv[i], "--soa") == 0) {
+            vertex_layout = POTATO_VERTEX_LAYOUT_SOA;
+        } else if (strcmp(argv[i], "--meshlets") == 0) {
+            vertex_layout = POTATO_VERTEX_LAYOUT_MESHLETS;
+        } else if (strcmp(argv[i], "--lod") == 0) {
+            vertex_layout = POTATO_VERTEX_LAYOUT_LOD;
+        } else if (i + 1 >= argc) {
+            return print_usage(argv[0]);
+        } else if (strcmp(argv[i], "--channel-tolerance") == 0) {
+            tolerances.channel_tolerance = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--max-bad-pixels") == 0) {
+            tolerances.max_bad_pixels = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--min-psnr") == 0) {
+            tolerances.min_psnr = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--depth-tolerance") == 0) {
+            tolerances.depth_tolerance = atof(argv[++i]);
+        } else {
+            return print_usage(argv[0]);
+        }
+    }
+
+    potato_init();
+    if (!potato_set_vertex_layout(vertex_layout)) {
+        fprintf(stderr, "failed to convert the vertex buffer\n");
+        potato_destroy();
+        return EXIT_FAILURE;
+    }
+
+    const int result = recording ? record(argv[2]) : compare(argv[2], &tolerances);
+
+    potato_destroy();
+
+    return result;
+}
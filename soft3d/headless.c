@@ -0,0 +1,562 @@
+// soft3d by Andrej Suvorau, 2019
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "soft3d.h"
+#include "image.h"
+#include "perf.h"
+#include "potato.h"
+#include "stress.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define DEFAULT_FRAME_COUNT 100
+#define DEFAULT_BENCHMARK_REPEATS 8
+#define BENCHMARK_WARMUP_FRAMES 4
+#define BENCHMARK_ANGLE_COUNT 16
+#define PATH_LENGTH 1024
+#define STRESS_FRAME_COUNT 16
+#define STRESS_SEED 1234
+#define TRACE_EVENTS_PER_FRAME 64
+
+typedef struct {
+    const char* name;
+    unsigned int width;
+    unsigned int height;
+    float distance;
+} BenchmarkCase;
+
+// Every case renders the dog from BENCHMARK_ANGLE_COUNT evenly spaced angles, so the results only
+// depend on the number of repeats and not on the speed of the machine.
+static const BenchmarkCase benchmark_cases[] = {
+    { "320x240_near",   320,  240,  2.f },
+    { "800x600_near",   800,  600,  2.f },
+    { "800x600_mid",    800,  600,  4.f },
+    { "800x600_far",    800,  600,  10.f },
+    { "1920x1080_near", 1920, 1080, 2.f },
+};
+
+typedef enum {
+    FRAME_STAGE_CLEAR,
+    FRAME_STAGE_DRAW,
+    FRAME_STAGE_COUNT
+} FrameStage;
+
+DepthColorBuffer backbuffer;
+
+static int perf_enabled = 0;
+static PotatoVertexLayout vertex_layout = POTATO_VERTEX_LAYOUT_FLOAT;
+
+static double get_time_ms() {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec * 1000.0 + time.tv_nsec / 1000000.0;
+}
+
+static int compare_doubles(const void* a, const void* b) {
+    const double lhs = *(const double*)a;
+    const double rhs = *(const double*)b;
+    return (lhs > rhs) - (lhs < rhs);
+}
+
+// Nearest-rank percentile of a sorted array.
+static double get_percentile(const double* sorted_values, size_t count, double percentile) {
+    size_t rank = (size_t)ceil(percentile / 100.0 * count);
+    return sorted_values[rank > 0 ? rank - 1 : 0];
+}
+
+#ifdef SOFT3D_PROFILE
+static void add_profile_report(ProfileReport* total_report) {
+    ProfileReport report;
+    profile_end_frame(&report);
+
+    for (size_t i = 0; i < PROFILE_STAGE_COUNT; i++) {
+        total_report->milliseconds[i] += report.milliseconds[i];
+    }
+}
+#endif
+
+static int run_frames(long frame_count) {
+    double total_time = 0.0;
+    double min_time = 0.0;
+    double max_time = 0.0;
+
+    ProfileReport total_report = { { 0.0 } };
+    reset_pipeline_statistics();
+
+    for (long i = 0; i < frame_count; i++) {
+#ifdef SOFT3D_PROFILE
+        profile_begin_frame();
+#endif
+
+        const double start_time = get_time_ms();
+        potato_update();
+        const double frame_time = get_time_ms() - start_time;
+
+#ifdef SOFT3D_PROFILE
+        add_profile_report(&total_report);
+#endif
+
+        total_time += frame_time;
+        if (i == 0 || frame_time < min_time) {
+            min_time = frame_time;
+        }
+        if (i == 0 || frame_time > max_time) {
+            max_time = frame_time;
+        }
+    }
+
+    const double average_time = total_time / frame_count;
+    printf("soft3d %ux%u, %ld frames\n", backbuffer.width, backbuffer.height, frame_count);
+    printf("average %.3f ms (%.1f fps), min %.3f ms, max %.3f ms\n", average_time, 1000.0 / average_time, min_time, max_time);
+
+    PipelineStatistics statistics;
+    get_pipeline_statistics(&statistics);
+
+    printf("per frame: %llu draws culled, %llu meshlets culled, %llu vertices transformed, %llu triangles submitted, %llu culled, %llu clipped, %llu rejected, %llu rasterized, %llu pixels tested, %llu passed depth, %llu texels fetched\n",
+           statistics.draws_culled / frame_count, statistics.meshlets_culled / frame_count, statistics.vertices_transformed / frame_count, statistics.triangles_submitted / frame_count, statistics.triangles_culled / frame_count, statistics.triangles_clipped / frame_count, statistics.triangles_rejected / frame_count, statistics.triangles_rasterized / frame_count,
+           statistics.pixels_tested / frame_count, statistics.pixels_passed / frame_count, statistics.texels_fetched / frame_count);
+
+#ifdef SOFT3D_PROFILE
+    for (size_t i = 0; i < PROFILE_STAGE_COUNT; i++) {
+        printf("%-8s %.3f ms\n", profile_stage_name((ProfileStage)i), total_report.milliseconds[i] / frame_count);
+    }
+#else
+    (void)total_report;
+#endif
+
+    return EXIT_SUCCESS;
+}
+
+// Draws a frame into the cleared backbuffer.
+typedef void (*DrawFrame)(size_t frame, const void* context);
+
+typedef struct {
+    double* frame_times;
+    size_t frame_count;
+    double total_time;
+    PipelineStatistics statistics;
+    ProfileReport total_report;
+    PerfSample perf_totals[FRAME_STAGE_COUNT];
+} Measurement;
+
+static void add_perf_sample(PerfSample* total, const PerfSample* begin, const PerfSample* end) {
+    for (size_t i = 0; i < PERF_EVENT_COUNT; i++) {
+        total->values[i] += end->values[i] - begin->values[i];
+    }
+}
+
+// Renders `frame_count` frames after a few warmup frames. The frame times are sorted afterwards.
+static void measure_frames(DrawFrame draw_frame, const void* context, Measurement* measurement) {
+    for (size_t i = 0; i < BENCHMARK_WARMUP_FRAMES; i++) {
+        potato_clear();
+        draw_frame(i, context);
+    }
+
+    const ProfileReport empty_report = { { 0.0 } };
+    const PerfSample empty_sample = { { 0 } };
+    measurement->total_time = 0.0;
+    measurement->total_report = empty_report;
+    for (size_t i = 0; i < FRAME_STAGE_COUNT; i++) {
+        measurement->perf_totals[i] = empty_sample;
+    }
+    reset_pipeline_statistics();
+
+    for (size_t i = 0; i < measurement->frame_count; i++) {
+#ifdef SOFT3D_PROFILE
+        profile_begin_frame();
+#endif
+
+        PerfSample samples[FRAME_STAGE_COUNT + 1];
+
+        const double start_time = get_time_ms();
+        if (perf_enabled) {
+            perf_read(&samples[0]);
+            potato_clear();
+            perf_read(&samples[1]);
+            draw_frame(i, context);
+            perf_read(&samples[2]);
+        } else {
+            potato_clear();
+            draw_frame(i, context);
+        }
+        measurement->frame_times[i] = get_time_ms() - start_time;
+
+        if (perf_enabled) {
+            for (size_t j = 0; j < FRAME_STAGE_COUNT; j++) {
+                add_perf_sample(&measurement->perf_totals[j], &samples[j], &samples[j + 1]);
+            }
+        }
+
+#ifdef SOFT3D_PROFILE
+        add_profile_report(&measurement->total_report);
+#endif
+
+        measurement->total_time += measurement->frame_times[i];
+    }
+
+    get_pipeline_statistics(&measurement->statistics);
+    qsort(measurement->frame_times, measurement->frame_count, sizeof(double), compare_doubles);
+}
+
+// Prints the remaining fields of a JSON case object and closes it.
+static void print_measurement(const Measurement* measurement, int last) {
+    const double* frame_times = measurement->frame_times;
+    const size_t frame_count = measurement->frame_count;
+    const PipelineStatistics* statistics = &measurement->statistics;
+
+    const double total_seconds = measurement->total_time / 1000.0;
+    const double pixel_count = (double)backbuffer.width * backbuffer.height;
+
+    printf("      \"min_ms\": %.4f,\n", frame_times[0]);
+    printf("      \"p50_ms\": %.4f,\n", get_percentile(frame_times, frame_count, 50.0));
+    printf("      \"p95_ms\": %.4f,\n", get_percentile(frame_times, frame_count, 95.0));
+    printf("      \"p99_ms\": %.4f,\n", get_percentile(frame_times, frame_count, 99.0));
+    printf("      \"max_ms\": %.4f,\n", frame_times[frame_count - 1]);
+    printf("      \"mean_ms\": %.4f,\n", measurement->total_time / frame_count);
+    printf("      \"triangles_per_sec\": %.0f,\n", statistics->triangles_submitted / total_seconds);
+    printf("      \"pixels_per_sec\": %.0f,\n", pixel_count * frame_count / total_seconds);
+    printf("      \"shaded_pixels_per_sec\": %.0f,\n", statistics->pixels_passed / total_seconds);
+    printf("      \"statistics_per_frame\": { \"draws_culled\": %llu, \"meshlets_culled\": %llu, \"vertices_transformed\": %llu, \"triangles_submitted\": %llu, \"triangles_culled\": %llu, "
+           "\"triangles_clipped\": %llu, \"triangles_rejected\": %llu, \"triangles_rasterized\": %llu, \"pixels_tested\": %llu, \"pixels_passed\": %llu, \"texels_fetched\": %llu }",
+           statistics->draws_culled / frame_count, statistics->meshlets_culled / frame_count, statistics->vertices_transformed / frame_count, statistics->triangles_submitted / frame_count, statistics->triangles_culled / frame_count, statistics->triangles_clipped / frame_count, statistics->triangles_rejected / frame_count, statistics->triangles_rasterized / frame_count,
+           statistics->pixels_tested / frame_count, statistics->pixels_passed / frame_count, statistics->texels_fetched / frame_count);
+#ifdef SOFT3D_PROFILE
+    printf(",\n      \"stages_ms\": {");
+    for (size_t i = 0; i < PROFILE_STAGE_COUNT; i++) {
+        printf(" \"%s\": %.4f%s", profile_stage_name((ProfileStage)i), measurement->total_report.milliseconds[i] / frame_count, i + 1 < PROFILE_STAGE_COUNT ? "," : " }");
+    }
+#endif
+    if (perf_enabled) {
+        static const char* stage_names[FRAME_STAGE_COUNT] = { "clear", "draw" };
+
+        printf(",\n      \"perf_per_frame\": {");
+        for (size_t i = 0; i < FRAME_STAGE_COUNT; i++) {
+            printf(" \"%s\": {", stage_names[i]);
+            for (size_t j = 0; j < PERF_EVENT_COUNT; j++) {
+                printf(" \"%s\": ", perf_event_name((PerfEvent)j));
+                if (perf_available((PerfEvent)j)) {
+                    printf("%llu", measurement->perf_totals[i].values[j] / frame_count);
+                } else {
+                    printf("null");
+                }
+                printf("%s", j + 1 < PERF_EVENT_COUNT ? "," : " }");
+            }
+            printf("%s", i + 1 < FRAME_STAGE_COUNT ? "," : " }");
+        }
+    }
+    printf("\n    }%s\n", last ? "" : ",");
+}
+
+static void draw_benchmark_frame(size_t frame, const void* context) {
+    const BenchmarkCase* benchmark_case = (const BenchmarkCase*)context;
+    potato_draw(6.283185307f * (frame % BENCHMARK_ANGLE_COUNT) / BENCHMARK_ANGLE_COUNT, benchmark_case->distance);
+}
+
+static int run_benchmark(long repeats) {
+    Measurement measurement;
+    measurement.frame_count = (size_t)repeats * BENCHMARK_ANGLE_COUNT;
+    measurement.frame_times = (double*)malloc(measurement.frame_count * sizeof(double));
+    if (measurement.frame_times == NULL) {
+        return EXIT_FAILURE;
+    }
+
+    const size_t case_count = sizeof(benchmark_cases) / sizeof(benchmark_cases[0]);
+
+    printf("{\n  \"triangles\": %u,\n  \"frames_per_case\": %zu,\n  \"cases\": [\n", potato_triangle_count(), measurement.frame_count);
+
+    for (size_t i = 0; i < case_count; i++) {
+        const BenchmarkCase* benchmark_case = &benchmark_cases[i];
+        potato_resize(benchmark_case->width, benchmark_case->height);
+
+        measure_frames(draw_benchmark_frame, benchmark_case, &measurement);
+
+        printf("    {\n");
+        printf("      \"name\": \"%s\",\n", benchmark_case->name);
+        printf("      \"width\": %u,\n", benchmark_case->width);
+        printf("      \"height\": %u,\n", benchmark_case->height);
+        printf("      \"distance\": %.3f,\n", benchmark_case->distance);
+        print_measurement(&measurement, i + 1 == case_count);
+    }
+
+    printf("  ]\n}\n");
+
+    free(measurement.frame_times);
+    return EXIT_SUCCESS;
+}
+
+static void draw_stress_frame(size_t frame, const void* context) {
+    (void)frame;
+    render_stress_scene((const StressScene*)context, &backbuffer);
+}
+
+// Runs every stress scene, or only the one called `scene_name`, with `count` elements or the scene's default.
+static int run_stress(const char* scene_name, long count) {
+    Measurement measurement;
+    measurement.frame_count = STRESS_FRAME_COUNT;
+    measurement.frame_times = (double*)malloc(measurement.frame_count * sizeof(double));
+    if (measurement.frame_times == NULL) {
+        return EXIT_FAILURE;
+    }
+
+    StressSceneType first = 0;
+    StressSceneType last = STRESS_SCENE_COUNT - 1;
+    if (scene_name != NULL && strcmp(scene_name, "all") != 0) {
+        while (first < STRESS_SCENE_COUNT && strcmp(stress_scene_name(first), scene_name) != 0) {
+            first++;
+        }
+        if (first == STRESS_SCENE_COUNT) {
+            fprintf(stderr, "unknown stress scene %s\n", scene_name);
+            free(measurement.frame_times);
+            return EXIT_FAILURE;
+        }
+        last = first;
+    }
+
+    printf("{\n  \"width\": %u,\n  \"height\": %u,\n  \"frames_per_case\": %zu,\n  \"cases\": [\n",
+           backbuffer.width, backbuffer.height, measurement.frame_count);
+
+    int result = EXIT_SUCCESS;
+    for (StressSceneType type = first; type <= last; type++) {
+        const unsigned int scene_count = count > 0 ? (unsigned int)count : stress_scene_default_count(type);
+
+        StressScene scene;
+        if (!generate_stress_scene(&scene, type, scene_count, backbuffer.width, backbuffer.height, STRESS_SEED)) {
+            fprintf(stderr, "failed to generate stress scene %s\n", stress_scene_name(type));
+            result = EXIT_FAILURE;
+            break;
+        }
+
+        measure_frames(draw_stress_frame, &scene, &measurement);
+
+        printf("    {\n");
+        printf("      \"name\": \"%s\",\n", stress_scene_name(type));
+        printf("      \"count\": %u,\n", scene_count);
+        printf("      \"vertices\": %u,\n", scene.vertex_buffer.length);
+        printf("      \"instances\": %u,\n", scene.instance_count);
+        print_measurement(&measurement, type == last);
+
+        destroy_stress_scene(&scene);
+    }
+
+    printf("  ]\n}\n");
+
+    free(measurement.frame_times);
+    return result;
+}
+
+// Black for untouched pixels, then blue, cyan, green, yellow, orange, red and white for 7+ touches.
+static Color get_heat_color(unsigned int count) {
+    static const Color palette[] = {
+        { 0x00, 0x00, 0x00, 0xFF },
+        { 0xA0, 0x20, 0x00, 0xFF },
+        { 0xE0, 0xC0, 0x00, 0xFF },
+        { 0x20, 0xD0, 0x20, 0xFF },
+        { 0x00, 0xE0, 0xE0, 0xFF },
+        { 0x00, 0x90, 0xFF, 0xFF },
+        { 0x00, 0x00, 0xE0, 0xFF },
+        { 0xFF, 0xFF, 0xFF, 0xFF },
+    };
+    const unsigned int palette_size = sizeof(palette) / sizeof(palette[0]);
+    return palette[count < palette_size ? count : palette_size - 1];
+}
+
+static int save_heatmap(const char* prefix, const char* suffix, const unsigned int* counts, unsigned int width, unsigned int height) {
+    const size_t size = (size_t)width * height;
+    Color* heatmap = (Color*)malloc(size * sizeof(Color));
+    if (heatmap == NULL) {
+        return 0;
+    }
+
+    for (size_t i = 0; i < size; i++) {
+        heatmap[i] = get_heat_color(counts[i]);
+    }
+
+    char path[PATH_LENGTH];
+    snprintf(path, PATH_LENGTH, "%s%s", prefix, suffix);
+
+    const int result = save_image(path, width, height, heatmap);
+    if (result) {
+        printf("wrote %s\n", path);
+    }
+
+    free(heatmap);
+    return result;
+}
+
+static int run_overdraw(const char* prefix, float angle, float distance) {
+    const size_t size = (size_t)backbuffer.width * backbuffer.height;
+
+    OverdrawBuffer overdraw_buffer;
+    overdraw_buffer.width = backbuffer.width;
+    overdraw_buffer.height = backbuffer.height;
+    overdraw_buffer.touches = (unsigned int*)calloc(size, sizeof(unsigned int));
+    overdraw_buffer.depth_failures = (unsigned int*)calloc(size, sizeof(unsigned int));
+    if (overdraw_buffer.touches == NULL || overdraw_buffer.depth_failures == NULL) {
+        free(overdraw_buffer.touches);
+        free(overdraw_buffer.depth_failures);
+        return EXIT_FAILURE;
+    }
+
+    set_overdraw_buffer(&overdraw_buffer);
+    potato_render(angle, distance);
+    set_overdraw_buffer(NULL);
+
+    unsigned long long touches = 0;
+    unsigned long long depth_failures = 0;
+    size_t covered_pixels = 0;
+    unsigned int max_touches = 0;
+
+    for (size_t i = 0; i < size; i++) {
+        touches += overdraw_buffer.touches[i];
+        depth_failures += overdraw_buffer.depth_failures[i];
+        covered_pixels += overdraw_buffer.touches[i] > 0;
+        max_touches = overdraw_buffer.touches[i] > max_touches ? overdraw_buffer.touches[i] : max_touches;
+    }
+
+    printf("%zu pixels covered, %llu touches, %llu depth failures\n", covered_pixels, touches, depth_failures);
+    printf("average depth complexity %.3f, max %u, %.1f%% of tested pixels failed the depth test\n",
+           covered_pixels > 0 ? (double)touches / covered_pixels : 0.0, max_touches, touches > 0 ? 100.0 * depth_failures / touches : 0.0);
+
+    const int result = save_heatmap(prefix, "_touches.tga", overdraw_buffer.touches, backbuffer.width, backbuffer.height) &&
+                       save_heatmap(prefix, "_depth_failures.tga", overdraw_buffer.depth_failures, backbuffer.width, backbuffer.height);
+
+    free(overdraw_buffer.touches);
+    free(overdraw_buffer.depth_failures);
+    return result ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+static int run_trace(const char* path, long frame_count) {
+#ifdef SOFT3D_TRACE
+    if (!trace_start_capture((unsigned int)frame_count * TRACE_EVENTS_PER_FRAME)) {
+        return EXIT_FAILURE;
+    }
+
+    for (long i = 0; i < frame_count; i++) {
+        potato_update();
+    }
+
+    if (!trace_stop_capture(path)) {
+        fprintf(stderr, "failed to write %s\n", path);
+        return EXIT_FAILURE;
+    }
+
+    printf("wrote %ld frames to %s\n", frame_count, path);
+    return EXIT_SUCCESS;
+#else
+    (void)path;
+    (void)frame_count;
+    fprintf(stderr, "tracing requires a build with SOFT3D_TRACE\n");
+    return EXIT_FAILURE;
+#endif
+}
+
+static int print_usage(const char* program) {
+    fprintf(stderr, "usage: %s [frame_count] [--packed | --soa | --meshlets | --lod]\n"
+                    "       %s --benchmark [repeats] [--perf] [--packed | --soa | --meshlets | --lod]\n"
+                    "       %s --overdraw <output_prefix> [angle] [distance] [--packed | --soa | --meshlets | --lod]\n"
+                    "       %s --stress [scene] [count] [--perf]\n"
+                    "       %s --trace <output.json> [frame_count] [--packed | --soa | --meshlets | --lod]\n", program, program, program, program, program);
+    return EXIT_FAILURE;
+}
+
+static void init_scene() {
+    potato_init();
+    if (!potato_set_vertex_layout(vertex_layout)) {
+        fprintf(stderr, "failed to convert the vertex buffer, drawing float vertices\n");
+    }
+}
+
+// Removes `flag` from the arguments. Returns 1 if it was present.
+static int take_flag(int* argc, char** argv, const char* flag) {
+    for (int i = 1; i < *argc; i++) {
+        if (strcmp(argv[i], flag) == 0) {
+            for (int j = i; j + 1 < *argc; j++) {
+                argv[j] = argv[j + 1];
+            }
+            (*argc)--;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    // --perf may appear anywhere and enables hardware counters in the benchmark and stress modes.
+    if (take_flag(&argc, argv, "--perf")) {
+        perf_enabled = perf_open() > 0;
+        if (!perf_enabled) {
+            fprintf(stderr, "hardware performance counters are not available\n");
+        }
+    }
+
+    // --packed, --soa, --meshlets and --lod may appear anywhere and select the vertex layout the dog is drawn from.
+    if (take_flag(&argc, argv, "--packed")) {
+        vertex_layout = POTATO_VERTEX_LAYOUT_PACKED;
+    }
+    if (take_flag(&argc, argv, "--soa")) {
+        vertex_layout = POTATO_VERTEX_LAYOUT_SOA;
+    }
+    if (take_flag(&argc, argv, "--meshlets")) {
+        vertex_layout = POTATO_VERTEX_LAYOUT_MESHLETS;
+    }
+    if (take_flag(&argc, argv, "--lod")) {
+        vertex_layout = POTATO_VERTEX_LAYOUT_LOD;
+    }
+
+    if (argc > 1 && strcmp(argv[1], "--overdraw") == 0) {
+        if (argc < 3) {
+            return print_usage(argv[0]);
+        }
+
+        const float angle = argc > 3 ? (float)atof(argv[3]) : 0.f;
+        const float distance = argc > 4 ? (float)atof(argv[4]) : 2.f;
+
+        init_scene();
+        const int result = run_overdraw(argv[2], angle, distance);
+        potato_destroy();
+
+        return result;
+    }
+
+    if (argc > 1 && strcmp(argv[1], "--stress") == 0) {
+        init_scene();
+        const int result = run_stress(argc > 2 ? argv[2] : NULL, argc > 3 ? strtol(argv[3], NULL, 10) : 0);
+        potato_destroy();
+
+        return result;
+    }
+
+    if (argc > 1 && strcmp(argv[1], "--trace") == 0) {
+        const long frame_count = argc > 3 ? strtol(argv[3], NULL, 10) : DEFAULT_FRAME_COUNT;
+        if (argc < 3 || frame_count <= 0) {
+            return print_usage(argv[0]);
+        }
+
+        init_scene();
+        const int result = run_trace(argv[2], frame_count);
+        potato_destroy();
+
+        return result;
+    }
+
+    const int benchmark = argc > 1 && strcmp(argv[1], "--benchmark") == 0;
+    const char* count_argument = argc > 1 + benchmark ? argv[1 + benchmark] : NULL;
+
+    const long count = count_argument != NULL ? strtol(count_argument, NULL, 10) : benchmark ? DEFAULT_BENCHMARK_REPEATS : DEFAULT_FRAME_COUNT;
+    if (count <= 0) {
+        return print_usage(argv[0]);
+    }
+
+    init_scene();
+
+    const int result = benchmark ? run_benchmark(count) : run_frames(count);
+
+    potato_destroy();
+
+    return result;
+}
@@ -0,0 +1,117 @@
+// soft3d by Andrej Suvorau, 2019
+
+#include "soft3d.h"
+#include "image.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TGA_HEADER_SIZE 18
+#define TGA_TRUECOLOR 2
+#define TGA_TOP_LEFT 0x20
+#define TGA_ALPHA_BITS 8
+
+static const char depth_magic[4] = { 'S', '3', 'D', 'Z' };
+
+int save_image(const char* path, unsigned int width, unsigned int height, const Color* data) {
+    FILE* file = fopen(path, "wb");
+    if (file == NULL) {
+        return 0;
+    }
+
+    unsigned char header[TGA_HEADER_SIZE] = { 0 };
+    header[2] = TGA_TRUECOLOR;
+    header[12] = width & 0xFF;
+    header[13] = (width >> 8) & 0xFF;
+    header[14] = height & 0xFF;
+    header[15] = (height >> 8) & 0xFF;
+    header[16] = 32;
+    header[17] = TGA_TOP_LEFT | TGA_ALPHA_BITS;
+
+    const size_t size = (size_t)width * height;
+    const int result = fwrite(header, 1, TGA_HEADER_SIZE, file) == TGA_HEADER_SIZE && fwrite(data, sizeof(Color), size, file) == size;
+    return fclose(file) == 0 && result;
+}
+
+int load_image(const char* path, ColorBuffer* result) {
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) {
+        return 0;
+    }
+
+    unsigned char header[TGA_HEADER_SIZE];
+    if (fread(header, 1, TGA_HEADER_SIZE, file) != TGA_HEADER_SIZE || header[2] != TGA_TRUECOLOR || header[16] != 32 ||
+        fseek(file, header[0], SEEK_CUR) != 0) {
+        fclose(file);
+        return 0;
+    }
+
+    result->width = header[12] | (header[13] << 8);
+    result->height = header[14] | (header[15] << 8);
+
+    const size_t size = (size_t)result->width * result->height;
+    result->data = (Color*)malloc(size * sizeof(Color));
+    if (result->data == NULL || fread(result->data, sizeof(Color), size, file) != size) {
+        free(result->data);
+        result->data = NULL;
+        fclose(file);
+        return 0;
+    }
+
+    fclose(file);
+
+    // Bottom-left origin, flip the rows.
+    if ((header[17] & TGA_TOP_LEFT) == 0) {
+        for (size_t i = 0; i < result->height / 2; i++) {
+            Color* top = result->data + i * result->width;
+            Color* bottom = result->data + (result->height - 1 - i) * result->width;
+            for (size_t j = 0; j < result->width; j++) {
+                const Color temp = top[j];
+                top[j] = bottom[j];
+                bottom[j] = temp;
+            }
+        }
+    }
+
+    return 1;
+}
+
+int save_depth(const char* path, unsigned int width, unsigned int height, const float* depth) {
+    FILE* file = fopen(path, "wb");
+    if (file == NULL) {
+        return 0;
+    }
+
+    const size_t size = (size_t)width * height;
+    const int result = fwrite(depth_magic, 1, sizeof(depth_magic), file) == sizeof(depth_magic) &&
+                       fwrite(&width, sizeof(width), 1, file) == 1 && fwrite(&height, sizeof(height), 1, file) == 1 &&
+                       fwrite(depth, sizeof(float), size, file) == size;
+    return fclose(file) == 0 && result;
+}
+
+int load_depth(const char* path, DepthColorBuffer* result) {
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) {
+        return 0;
+    }
+
+    char magic[sizeof(depth_magic)];
+    if (fread(magic, 1, sizeof(magic), file) != sizeof(magic) || memcmp(magic, depth_magic, sizeof(magic)) != 0 ||
+        fread(&result->width, sizeof(result->width), 1, file) != 1 || fread(&result->height, sizeof(result->height), 1, file) != 1) {
+        fclose(file);
+        return 0;
+    }
+
+    const size_t size = (size_t)result->width * result->height;
+    result->depth = (float*)malloc(size * sizeof(float));
+    if (result->depth == NULL || fread(result->depth, sizeof(float), size, file) != size) {
+        free(result->depth);
+        result->depth = NULL;
+        fclose(file);
+        return 0;
+    }
+
+    fclose(file);
+    return 1;
+}
@@ -0,0 +1,11 @@
+// soft3d by Andrej Suvorau, 2019
+
+// Image files used by the headless tools. Colors are stored as uncompressed 32-bit TGA, which has
+// the same BGRA layout as `Color`. Depth is stored as a small header followed by raw floats.
+// Every function returns 1 on success and 0 on failure. Loaded buffers are allocated with malloc.
+
+extern int save_image(const char* path, unsigned int width, unsigned int height, const Color* data);
+extern int load_image(const char* path, ColorBuffer* result);
+
+extern int save_depth(const char* path, unsigned int width, unsigned int height, const float* depth);
+extern int load_depth(const char* path, DepthColorBuffer* result);
@@ -1,6 +1,7 @@
 // soft3d by Andrej Suvorau, 2019
 
 #include "soft3d.h"
+#include "potato.h"
 
 #include <stdio.h>
 #include <Windows.h>
@@ -9,10 +10,6 @@
 #define BACKBUFFER_HEIGHT 600
 #define PERFORMANCE_BUFFER_SIZE 16
 
-extern void potato_init();
-extern void potato_update();
-extern void potato_destroy();
-
 DepthColorBuffer backbuffer;
 
 static HWND hwnd;
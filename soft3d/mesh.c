@@ -0,0 +1,1169 @@
+// soft3d by Andrej Suvorau, 2019
+
+#include "soft3d.h"
+#include "mesh.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SOA_ALIGNMENT 32
+#define EMPTY_SLOT 0xFFFFFFFFu
+#define NO_TRIANGLE 0xFFFFFFFFu
+
+// Scoring constants from "Linear-Speed Vertex Cache Optimisation" by Tom Forsyth.
+#define CACHE_DECAY_POWER 1.5f
+#define LAST_TRIANGLE_SCORE 0.75f
+#define VALENCE_BOOST_SCALE 2.f
+#define VALENCE_BOOST_POWER 0.5f
+
+static unsigned int hash_bytes(const void* data, size_t size) {
+    // FNV-1a.
+    const unsigned char* bytes = (const unsigned char*)data;
+    unsigned int hash = 2166136261u;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+static void get_vertex_cell(const Vertex* vertex, float epsilon, long long cell[5]) {
+    const float components[5] = { vertex->x, vertex->y, vertex->z, vertex->u, vertex->v };
+    for (size_t i = 0; i < 5; i++) {
+        cell[i] = (long long)floor(components[i] / epsilon);
+    }
+}
+
+static unsigned int hash_vertex(const Vertex* vertex, float epsilon) {
+    if (epsilon <= 0.f) {
+        return hash_bytes(vertex, sizeof(Vertex));
+    }
+
+    long long cell[5];
+    get_vertex_cell(vertex, epsilon, cell);
+    return hash_bytes(cell, sizeof(cell));
+}
+
+static int are_vertices_equal(const Vertex* a, const Vertex* b, float epsilon) {
+    if (epsilon <= 0.f) {
+        return memcmp(a, b, sizeof(Vertex)) == 0;
+    }
+
+    long long cell_a[5], cell_b[5];
+    get_vertex_cell(a, epsilon, cell_a);
+    get_vertex_cell(b, epsilon, cell_b);
+    return memcmp(cell_a, cell_b, sizeof(cell_a)) == 0;
+}
+
+static unsigned int read_index(const IndexBuffer* indices, unsigned int i) {
+    return indices->format == INDEX_FORMAT_UINT16 ? ((const unsigned short*)indices->data)[i] : ((const unsigned int*)indices->data)[i];
+}
+
+static void write_index(IndexBuffer* indices, unsigned int i, unsigned int index) {
+    if (indices->format == INDEX_FORMAT_UINT16) {
+        ((unsigned short*)indices->data)[i] = (unsigned short)index;
+    } else {
+        ((unsigned int*)indices->data)[i] = index;
+    }
+}
+
+unsigned int get_index_buffer_element_size(const IndexBuffer* indices) {
+    return indices->format == INDEX_FORMAT_UINT16 ? sizeof(unsigned short) : sizeof(unsigned int);
+}
+
+int weld_vertices(const VertexBuffer* vertices, float epsilon, int allow_16bit_indices,
+                  VertexBuffer* unique_vertices, IndexBuffer* indices) {
+    unsigned int table_size = 1;
+    while (table_size < vertices->length * 2) {
+        table_size *= 2;
+    }
+
+    unsigned int* table = (unsigned int*)malloc(table_size * sizeof(unsigned int));
+    unsigned int* remap = (unsigned int*)malloc(vertices->length * sizeof(unsigned int));
+    Vertex* unique = (Vertex*)malloc(vertices->length * sizeof(Vertex));
+    if (table == NULL || remap == NULL || unique == NULL) {
+        free(table);
+        free(remap);
+        free(unique);
+        return 0;
+    }
+
+    for (unsigned int i = 0; i < table_size; i++) {
+        table[i] = EMPTY_SLOT;
+    }
+
+    unsigned int unique_count = 0;
+    for (unsigned int i = 0; i < vertices->length; i++) {
+        const Vertex* vertex = &vertices->data[i];
+
+        unsigned int slot = hash_vertex(vertex, epsilon) & (table_size - 1);
+        while (table[slot] != EMPTY_SLOT && !are_vertices_equal(&unique[table[slot]], vertex, epsilon)) {
+            slot = (slot + 1) & (table_size - 1);
+        }
+
+        if (table[slot] == EMPTY_SLOT) {
+            table[slot] = unique_count;
+            unique[unique_count++] = *vertex;
+        }
+        remap[i] = table[slot];
+    }
+
+    free(table);
+
+    const IndexFormat format = allow_16bit_indices && unique_count <= 0x10000 ? INDEX_FORMAT_UINT16 : INDEX_FORMAT_UINT32;
+    const unsigned int element_size = format == INDEX_FORMAT_UINT16 ? sizeof(unsigned short) : sizeof(unsigned int);
+    void* index_data = malloc((size_t)vertices->length * element_size);
+    Vertex* shrunk = (Vertex*)realloc(unique, (unique_count > 0 ? unique_count : 1) * sizeof(Vertex));
+    if (index_data == NULL || shrunk == NULL) {
+        free(index_data);
+        free(shrunk != NULL ? shrunk : unique);
+        free(remap);
+        return 0;
+    }
+
+    indices->length = vertices->length;
+    indices->format = format;
+    indices->data = index_data;
+    for (unsigned int i = 0; i < vertices->length; i++) {
+        write_index(indices, i, remap[i]);
+    }
+
+    free(remap);
+
+    unique_vertices->length = unique_count;
+    unique_vertices->data = shrunk;
+    return 1;
+}
+
+static float score_vertex(int cache_position, unsigned int remaining_triangles, unsigned int cache_size) {
+    if (remaining_triangles == 0) {
+        return -1.f;
+    }
+
+    float score = 0.f;
+    if (cache_position < 0) {
+        // Not in the cache.
+    } else if (cache_position < 3) {
+        // The triangle just emitted: any order of these three vertices costs the same.
+        score = LAST_TRIANGLE_SCORE;
+    } else {
+        const float scaler = 1.f / (cache_size - 3);
+        score = powf(1.f - (cache_position - 3) * scaler, CACHE_DECAY_POWER);
+    }
+
+    // Favour vertices with few triangles left, so lone triangles don't get stranded.
+    return score + VALENCE_BOOST_SCALE * powf((float)remaining_triangles, -VALENCE_BOOST_POWER);
+}
+
+typedef struct {
+    unsigned int* offsets;
+    unsigned int* remaining;
+    int* cache_positions;
+    float* vertex_scores;
+    unsigned int* adjacency;
+    float* triangle_scores;
+    unsigned char* emitted;
+    unsigned int* triangles;
+    unsigned int* cache;
+} VertexCacheState;
+
+static void reorder_triangles(IndexBuffer* indices, unsigned int vertex_count, unsigned int cache_size, const VertexCacheState* state) {
+    const unsigned int triangle_count = indices->length / 3;
+
+    unsigned int* offsets = state->offsets;
+    unsigned int* remaining = state->remaining;
+    int* cache_positions = state->cache_positions;
+    float* vertex_scores = state->vertex_scores;
+    unsigned int* adjacency = state->adjacency;
+    float* triangle_scores = state->triangle_scores;
+    unsigned char* emitted = state->emitted;
+    unsigned int* triangles = state->triangles;
+    unsigned int* cache = state->cache;
+
+    // Triangles referencing every vertex, with the live ones first.
+    for (unsigned int i = 0; i < indices->length; i++) {
+        triangles[i] = read_index(indices, i);
+        assert(triangles[i] < vertex_count);
+        remaining[triangles[i]]++;
+    }
+    for (unsigned int i = 0; i < vertex_count; i++) {
+        offsets[i + 1] = offsets[i] + remaining[i];
+        remaining[i] = 0;
+    }
+    for (unsigned int i = 0; i < indices->length; i++) {
+        const unsigned int vertex = triangles[i];
+        adjacency[offsets[vertex] + remaining[vertex]++] = i / 3;
+    }
+
+    for (unsigned int i = 0; i < vertex_count; i++) {
+        cache_positions[i] = -1;
+        vertex_scores[i] = score_vertex(-1, remaining[i], cache_size);
+    }
+
+    unsigned int best_triangle = NO_TRIANGLE;
+    float best_score = -1.f;
+    for (unsigned int i = 0; i < triangle_count; i++) {
+        triangle_scores[i] = vertex_scores[triangles[i * 3]] + vertex_scores[triangles[i * 3 + 1]] + vertex_scores[triangles[i * 3 + 2]];
+        if (triangle_scores[i] > best_score) {
+            best_score = triangle_scores[i];
+            best_triangle = i;
+        }
+    }
+
+    unsigned int* current_cache = cache;
+    unsigned int* next_cache = cache + cache_size + 3;
+    unsigned int cache_count = 0;
+    unsigned int fallback_cursor = 0;
+
+    for (unsigned int output = 0; output < triangle_count; output++) {
+        if (best_triangle == NO_TRIANGLE) {
+            // Nothing in the cache has triangles left, so start over anywhere.
+            while (emitted[fallback_cursor]) {
+                fallback_cursor++;
+            }
+            best_triangle = fallback_cursor;
+        }
+
+        const unsigned int* corners = &triangles[best_triangle * 3];
+        write_index(indices, output * 3, corners[0]);
+        write_index(indices, output * 3 + 1, corners[1]);
+        write_index(indices, output * 3 + 2, corners[2]);
+        emitted[best_triangle] = 1;
+
+        unsigned int next_count = 0;
+        for (size_t i = 0; i < 3; i++) {
+            const unsigned int vertex = corners[i];
+
+            // Swap the triangle out of the vertex's live range.
+            unsigned int* live = &adjacency[offsets[vertex]];
+            for (unsigned int j = 0; j < remaining[vertex]; j++) {
+                if (live[j] == best_triangle) {
+                    live[j] = live[remaining[vertex] - 1];
+                    live[remaining[vertex] - 1] = best_triangle;
+                    break;
+                }
+            }
+            remaining[vertex]--;
+
+            if (next_count == 0 || (next_cache[0] != vertex && (next_count == 1 || next_cache[1] != vertex))) {
+                next_cache[next_count++] = vertex;
+            }
+        }
+
+        for (unsigned int i = 0; i < cache_count; i++) {
+            const unsigned int vertex = current_cache[i];
+            if (vertex != corners[0] && vertex != corners[1] && vertex != corners[2]) {
+                next_cache[next_count++] = vertex;
+            }
+        }
+
+        for (unsigned int i = 0; i < next_count; i++) {
+            const unsigned int vertex = next_cache[i];
+            cache_positions[vertex] = i < cache_size ? (int)i : -1;
+            vertex_scores[vertex] = score_vertex(cache_positions[vertex], remaining[vertex], cache_size);
+        }
+
+        // Only triangles around cached vertices changed score, so the next one is picked among them.
+        best_triangle = NO_TRIANGLE;
+        best_score = -1.f;
+        for (unsigned int i = 0; i < next_count; i++) {
+            const unsigned int vertex = next_cache[i];
+            for (unsigned int j = offsets[vertex]; j < offsets[vertex] + remaining[vertex]; j++) {
+                const unsigned int triangle = adjacency[j];
+                const unsigned int* triangle_corners = &triangles[triangle * 3];
+                triangle_scores[triangle] = vertex_scores[triangle_corners[0]] + vertex_scores[triangle_corners[1]] + vertex_scores[triangle_corners[2]];
+                if (triangle_scores[triangle] > best_score) {
+                    best_score = triangle_scores[triangle];
+                    best_triangle = triangle;
+                }
+            }
+        }
+
+        unsigned int* swap = current_cache;
+        current_cache = next_cache;
+        next_cache = swap;
+        cache_count = next_count < cache_size ? next_count : cache_size;
+    }
+}
+
+int optimize_vertex_cache(IndexBuffer* indices, unsigned int vertex_count, unsigned int cache_size) {
+    assert(indices->length % 3 == 0);
+    assert(cache_size > 3);
+
+    if (indices->length == 0) {
+        return 1;
+    }
+
+    VertexCacheState state;
+    state.offsets = (unsigned int*)calloc(vertex_count + 1, sizeof(unsigned int));
+    state.remaining = (unsigned int*)calloc(vertex_count, sizeof(unsigned int));
+    state.cache_positions = (int*)malloc(vertex_count * sizeof(int));
+    state.vertex_scores = (float*)malloc(vertex_count * sizeof(float));
+    state.adjacency = (unsigned int*)malloc(indices->length * sizeof(unsigned int));
+    state.triangle_scores = (float*)malloc((indices->length / 3) * sizeof(float));
+    state.emitted = (unsigned char*)calloc(indices->length / 3, 1);
+    state.triangles = (unsigned int*)malloc(indices->length * sizeof(unsigned int));
+    state.cache = (unsigned int*)malloc((cache_size + 3) * 2 * sizeof(unsigned int));
+
+    const int allocated = state.offsets != NULL && state.remaining != NULL && state.cache_positions != NULL &&
+                          state.vertex_scores != NULL && state.adjacency != NULL && state.triangle_scores != NULL &&
+                          state.emitted != NULL && state.triangles != NULL && state.cache != NULL;
+    if (allocated) {
+        reorder_triangles(indices, vertex_count, cache_size, &state);
+    }
+
+    free(state.offsets);
+    free(state.remaining);
+    free(state.cache_positions);
+    free(state.vertex_scores);
+    free(state.adjacency);
+    free(state.triangle_scores);
+    free(state.emitted);
+    free(state.triangles);
+    free(state.cache);
+    return allocated;
+}
+
+int optimize_vertex_fetch(VertexBuffer* vertices, IndexBuffer* indices) {
+    unsigned int* remap = (unsigned int*)malloc(vertices->length * sizeof(unsigned int));
+    Vertex* reordered = (Vertex*)malloc(vertices->length * sizeof(Vertex));
+    if (remap == NULL || reordered == NULL) {
+        free(remap);
+        free(reordered);
+        return 0;
+    }
+
+    for (unsigned int i = 0; i < vertices->length; i++) {
+        remap[i] = EMPTY_SLOT;
+    }
+
+    unsigned int vertex_count = 0;
+    for (unsigned int i = 0; i < indices->length; i++) {
+        const unsigned int index = read_index(indices, i);
+        if (remap[index] == EMPTY_SLOT) {
+            remap[index] = vertex_count;
+            reordered[vertex_count++] = vertices->data[index];
+        }
+        write_index(indices, i, remap[index]);
+    }
+
+    for (unsigned int i = 0; i < vertices->length; i++) {
+        if (remap[i] == EMPTY_SLOT) {
+            reordered[vertex_count++] = vertices->data[i];
+        }
+    }
+
+    memcpy(vertices->data, reordered, vertices->length * sizeof(Vertex));
+    free(reordered);
+    free(remap);
+    return 1;
+}
+
+float compute_acmr(const IndexBuffer* indices, unsigned int vertex_count, unsigned int cache_size) {
+    // A vertex is cached when fewer than `cache_size` misses happened since it was loaded.
+    unsigned int* timestamps = (unsigned int*)malloc(vertex_count * sizeof(unsigned int));
+    if (timestamps == NULL || indices->length == 0) {
+        free(timestamps);
+        return 0.f;
+    }
+
+    for (unsigned int i = 0; i < vertex_count; i++) {
+        timestamps[i] = 0;
+    }
+
+    unsigned int misses = 0;
+    for (unsigned int i = 0; i < indices->length; i++) {
+        const unsigned int index = read_index(indices, i);
+        if (timestamps[index] == 0 || misses + 1 - timestamps[index] > cache_size) {
+            timestamps[index] = ++misses;
+        }
+    }
+
+    free(timestamps);
+    return (float)misses / (indices->length / 3);
+}
+
+void compute_bounding_box(const VertexBuffer* vertices, BoundingBox* bounds) {
+    for (size_t j = 0; j < 3; j++) {
+        bounds->min[j] = vertices->length > 0 ? INFINITY : 0.f;
+        bounds->max[j] = vertices->length > 0 ? -INFINITY : 0.f;
+    }
+
+    for (unsigned int i = 0; i < vertices->length; i++) {
+        const float position[3] = { vertices->data[i].x, vertices->data[i].y, vertices->data[i].z };
+        for (size_t j = 0; j < 3; j++) {
+            bounds->min[j] = position[j] < bounds->min[j] ? position[j] : bounds->min[j];
+            bounds->max[j] = position[j] > bounds->max[j] ? position[j] : bounds->max[j];
+        }
+    }
+}
+
+static unsigned short quantize(float value, float scale, float bias) {
+    if (scale == 0.f) {
+        return 0;
+    }
+
+    const float q = floorf((value - bias) / scale + 0.5f);
+    return (unsigned short)(q < 0.f ? 0.f : q > 65535.f ? 65535.f : q);
+}
+
+int quantize_vertex_buffer(const VertexBuffer* vertices, PackedVertexBuffer* packed_vertices) {
+    PackedVertex* data = (PackedVertex*)malloc((vertices->length > 0 ? vertices->length : 1) * sizeof(PackedVertex));
+    if (data == NULL) {
+        return 0;
+    }
+
+    float minimum[5] = { 0.f, 0.f, 0.f, 0.f, 0.f };
+    float maximum[5] = { 0.f, 0.f, 0.f, 0.f, 0.f };
+    for (unsigned int i = 0; i < vertices->length; i++) {
+        const Vertex* vertex = &vertices->data[i];
+        const float components[5] = { vertex->x, vertex->y, vertex->z, vertex->u, vertex->v };
+        for (size_t j = 0; j < 5; j++) {
+            minimum[j] = i == 0 || components[j] < minimum[j] ? components[j] : minimum[j];
+            maximum[j] = i == 0 || components[j] > maximum[j] ? components[j] : maximum[j];
+        }
+    }
+
+    float scale[5];
+    for (size_t j = 0; j < 5; j++) {
+        scale[j] = (maximum[j] - minimum[j]) / 65535.f;
+    }
+
+    for (unsigned int i = 0; i < vertices->length; i++) {
+        const Vertex* vertex = &vertices->data[i];
+        data[i].x = quantize(vertex->x, scale[0], minimum[0]);
+        data[i].y = quantize(vertex->y, scale[1], minimum[1]);
+        data[i].z = quantize(vertex->z, scale[2], minimum[2]);
+        data[i].u = quantize(vertex->u, scale[3], minimum[3]);
+        data[i].v = quantize(vertex->v, scale[4], minimum[4]);
+    }
+
+    packed_vertices->length = vertices->length;
+    packed_vertices->data = data;
+    packed_vertices->bounds = vertices->bounds;
+    for (size_t j = 0; j < 3; j++) {
+        packed_vertices->position_scale[j] = scale[j];
+        packed_vertices->position_bias[j] = minimum[j];
+    }
+    for (size_t j = 0; j < 2; j++) {
+        packed_vertices->uv_scale[j] = scale[3 + j];
+        packed_vertices->uv_bias[j] = minimum[3 + j];
+    }
+    return 1;
+}
+
+int convert_to_soa_vertex_buffer(const VertexBuffer* vertices, SoaVertexBuffer* soa_vertices) {
+    // All five arrays live in one allocation, each padded to the alignment. The unaligned pointer
+    // returned by malloc is stored right before the aligned block for `free_soa_vertex_buffer`.
+    const size_t stride = ((size_t)vertices->length * sizeof(float) + SOA_ALIGNMENT - 1) / SOA_ALIGNMENT * SOA_ALIGNMENT;
+    unsigned char* memory = (unsigned char*)malloc(stride * 5 + SOA_ALIGNMENT + sizeof(void*));
+    if (memory == NULL) {
+        return 0;
+    }
+
+    const size_t address = (size_t)(memory + sizeof(void*));
+    unsigned char* aligned = (unsigned char*)((address + SOA_ALIGNMENT - 1) / SOA_ALIGNMENT * SOA_ALIGNMENT);
+    memcpy(aligned - sizeof(void*), &memory, sizeof(void*));
+
+    soa_vertices->length = vertices->length;
+    soa_vertices->bounds = vertices->bounds;
+    soa_vertices->x = (float*)aligned;
+    soa_vertices->y = (float*)(aligned + stride);
+    soa_vertices->z = (float*)(aligned + stride * 2);
+    soa_vertices->u = (float*)(aligned + stride * 3);
+    soa_vertices->v = (float*)(aligned + stride * 4);
+
+    for (unsigned int i = 0; i < vertices->length; i++) {
+        soa_vertices->x[i] = vertices->data[i].x;
+        soa_vertices->y[i] = vertices->data[i].y;
+        soa_vertices->z[i] = vertices->data[i].z;
+        soa_vertices->u[i] = vertices->data[i].u;
+        soa_vertices->v[i] = vertices->data[i].v;
+    }
+    return 1;
+}
+
+void free_soa_vertex_buffer(SoaVertexBuffer* soa_vertices) {
+    if (soa_vertices->x != NULL) {
+        void* memory;
+        memcpy(&memory, (unsigned char*)soa_vertices->x - sizeof(void*), sizeof(void*));
+        free(memory);
+    }
+
+    soa_vertices->length = 0;
+    soa_vertices->bounds = NULL;
+    soa_vertices->x = NULL;
+    soa_vertices->y = NULL;
+    soa_vertices->z = NULL;
+    soa_vertices->u = NULL;
+    soa_vertices->v = NULL;
+}
+
+typedef struct {
+    unsigned int* offsets;           // Triangles referencing every vertex are `adjacency[offsets[v]..offsets[v + 1]]`.
+    unsigned int* adjacency;
+    float* normals;                  // Unit normal of every triangle, zero for degenerate ones.
+    unsigned char* assigned;
+    int* local_indices;              // Position of every vertex in the current meshlet, or -1.
+    unsigned int* meshlet_vertices;  // Vertices and triangles of the current meshlet.
+    unsigned int* meshlet_triangles;
+} MeshletState;
+
+static void compute_triangle_normals(const VertexBuffer* vertices, const IndexBuffer* indices, float* normals) {
+    for (unsigned int i = 0; i < indices->length / 3; i++) {
+        const Vertex* a = &vertices->data[read_index(indices, i * 3)];
+        const Vertex* b = &vertices->data[read_index(indices, i * 3 + 1)];
+        const Vertex* c = &vertices->data[read_index(indices, i * 3 + 2)];
+
+        const float ab[3] = { b->x - a->x, b->y - a->y, b->z - a->z };
+        const float ac[3] = { c->x - a->x, c->y - a->y, c->z - a->z };
+        float* normal = &normals[i * 3];
+        normal[0] = ab[1] * ac[2] - ab[2] * ac[1];
+        normal[1] = ab[2] * ac[0] - ab[0] * ac[2];
+        normal[2] = ab[0] * ac[1] - ab[1] * ac[0];
+
+        const float length = sqrtf(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+        for (size_t j = 0; j < 3; j++) {
+            normal[j] = length > 0.f ? normal[j] / length : 0.f;
+        }
+    }
+}
+
+// Picks the unassigned triangle adjacent to the current meshlet that adds the fewest new vertices, and
+// of those the one whose normal is closest to `axis`, so meshlets stay compact and their cones narrow.
+static unsigned int find_meshlet_triangle(const IndexBuffer* indices, const MeshletState* state, unsigned int vertex_count,
+                                          unsigned int max_vertices, const float axis[3]) {
+    unsigned int best_triangle = NO_TRIANGLE;
+    unsigned int best_new_vertices = 4;
+    float best_dot = -INFINITY;
+
+    for (unsigned int i = 0; i < vertex_count; i++) {
+        const unsigned int vertex = state->meshlet_vertices[i];
+        for (unsigned int j = state->offsets[vertex]; j < state->offsets[vertex + 1]; j++) {
+            const unsigned int triangle = state->adjacency[j];
+            if (state->assigned[triangle]) {
+                continue;
+            }
+
+            unsigned int new_vertices = 0;
+            for (unsigned int k = 0; k < 3; k++) {
+                new_vertices += state->local_indices[read_index(indices, triangle * 3 + k)] < 0;
+            }
+
+            const float* normal = &state->normals[triangle * 3];
+            const float dot = normal[0] * axis[0] + normal[1] * axis[1] + normal[2] * axis[2];
+            if (vertex_count + new_vertices <= max_vertices &&
+                (new_vertices < best_new_vertices || (new_vertices == best_new_vertices && dot > best_dot))) {
+                best_triangle = triangle;
+                best_new_vertices = new_vertices;
+                best_dot = dot;
+            }
+        }
+    }
+    return best_triangle;
+}
+
+// Computes the bounding sphere and normal cone of the current meshlet.
+static void compute_meshlet_bounds(const VertexBuffer* vertices, const IndexBuffer* indices, const MeshletState* state,
+                                   unsigned int vertex_count, unsigned int triangle_count, Meshlet* meshlet) {
+    float min[3] = { INFINITY, INFINITY, INFINITY };
+    float max[3] = { -INFINITY, -INFINITY, -INFINITY };
+    for (unsigned int i = 0; i < vertex_count; i++) {
+        const Vertex* vertex = &vertices->data[state->meshlet_vertices[i]];
+        const float position[3] = { vertex->x, vertex->y, vertex->z };
+        for (size_t j = 0; j < 3; j++) {
+            min[j] = position[j] < min[j] ? position[j] : min[j];
+            max[j] = position[j] > max[j] ? position[j] : max[j];
+        }
+    }
+
+    meshlet->radius = 0.f;
+    for (size_t j = 0; j < 3; j++) {
+        meshlet->center[j] = (min[j] + max[j]) * 0.5f;
+    }
+    for (unsigned int i = 0; i < vertex_count; i++) {
+        const Vertex* vertex = &vertices->data[state->meshlet_vertices[i]];
+        const float dx = vertex->x - meshlet->center[0];
+        const float dy = vertex->y - meshlet->center[1];
+        const float dz = vertex->z - meshlet->center[2];
+        const float distance = sqrtf(dx * dx + dy * dy + dz * dz);
+        meshlet->radius = distance > meshlet->radius ? distance : meshlet->radius;
+    }
+
+    float axis[3] = { 0.f, 0.f, 0.f };
+    for (unsigned int i = 0; i < triangle_count; i++) {
+        const float* normal = &state->normals[state->meshlet_triangles[i] * 3];
+        for (size_t j = 0; j < 3; j++) {
+            axis[j] += normal[j];
+        }
+    }
+
+    const float length = sqrtf(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+    float min_dot = length > 0.f ? 1.f : -1.f;
+    for (size_t j = 0; j < 3; j++) {
+        meshlet->cone_axis[j] = length > 0.f ? axis[j] / length : 0.f;
+    }
+    for (unsigned int i = 0; i < triangle_count; i++) {
+        const float* normal = &state->normals[state->meshlet_triangles[i] * 3];
+        if (normal[0] != 0.f || normal[1] != 0.f || normal[2] != 0.f) {
+            const float dot = normal[0] * meshlet->cone_axis[0] + normal[1] * meshlet->cone_axis[1] + normal[2] * meshlet->cone_axis[2];
+            min_dot = dot < min_dot ? dot : min_dot;
+        }
+    }
+
+    // A cone of 90 degrees or more contains normals facing every direction.
+    meshlet->cone_cutoff = min_dot > 0.f ? sqrtf(1.f - min_dot * min_dot) : 1.f;
+
+    // The apex is moved along the axis until it's behind the plane of every triangle.
+    float apex_distance = INFINITY;
+    for (unsigned int i = 0; i < triangle_count && min_dot > 0.f; i++) {
+        const unsigned int triangle = state->meshlet_triangles[i];
+        const float* normal = &state->normals[triangle * 3];
+        const Vertex* vertex = &vertices->data[read_index(indices, triangle * 3)];
+        const float dot = normal[0] * meshlet->cone_axis[0] + normal[1] * meshlet->cone_axis[1] + normal[2] * meshlet->cone_axis[2];
+        if (dot > 0.f) {
+            const float offset = (vertex->x - meshlet->center[0]) * normal[0] + (vertex->y - meshlet->center[1]) * normal[1] + (vertex->z - meshlet->center[2]) * normal[2];
+            const float distance = offset / dot;
+            apex_distance = distance < apex_distance ? distance : apex_distance;
+        }
+    }
+    for (size_t j = 0; j < 3; j++) {
+        meshlet->cone_apex[j] = meshlet->center[j] + meshlet->cone_axis[j] * (apex_distance < INFINITY ? apex_distance : 0.f);
+    }
+}
+
+static unsigned int partition_meshlets(const VertexBuffer* vertices, const IndexBuffer* indices, unsigned int max_vertices,
+                                       unsigned int max_triangles, const MeshletState* state,
+                                       Vertex* meshlet_vertices, unsigned int* meshlet_indices, Meshlet* meshlets) {
+    const unsigned int triangle_count = indices->length / 3;
+
+    for (unsigned int i = 0; i < indices->length; i++) {
+        const unsigned int vertex = read_index(indices, i);
+        assert(vertex < vertices->length);
+        state->offsets[vertex + 1]++;
+    }
+    for (unsigned int i = 0; i < vertices->length; i++) {
+        state->offsets[i + 1] += state->offsets[i];
+        state->local_indices[i] = -1;
+    }
+
+    // Every offset is advanced to the next one while filling, then shifted back.
+    for (unsigned int i = 0; i < indices->length; i++) {
+        state->adjacency[state->offsets[read_index(indices, i)]++] = i / 3;
+    }
+    for (unsigned int i = vertices->length; i > 0; i--) {
+        state->offsets[i] = state->offsets[i - 1];
+    }
+    state->offsets[0] = 0;
+
+    compute_triangle_normals(vertices, indices, state->normals);
+
+    unsigned int meshlet_count = 0;
+    unsigned int total_vertices = 0;
+    unsigned int total_indices = 0;
+
+    // Meshlets are seeded in triangle order, which keeps them in roughly the order the mesh was optimized for.
+    for (unsigned int seed = 0; seed < triangle_count; seed++) {
+        if (state->assigned[seed]) {
+            continue;
+        }
+
+        unsigned int vertex_count = 0;
+        unsigned int meshlet_triangle_count = 0;
+        float axis[3] = { 0.f, 0.f, 0.f };
+
+        for (unsigned int triangle = seed; triangle != NO_TRIANGLE && meshlet_triangle_count < max_triangles;
+             triangle = find_meshlet_triangle(indices, state, vertex_count, max_vertices, axis)) {
+            state->assigned[triangle] = 1;
+            state->meshlet_triangles[meshlet_triangle_count++] = triangle;
+            for (unsigned int k = 0; k < 3; k++) {
+                const unsigned int vertex = read_index(indices, triangle * 3 + k);
+                if (state->local_indices[vertex] < 0) {
+                    state->local_indices[vertex] = (int)vertex_count;
+                    state->meshlet_vertices[vertex_count++] = vertex;
+                }
+            }
+            for (size_t j = 0; j < 3; j++) {
+                axis[j] += state->normals[triangle * 3 + j];
+            }
+        }
+
+        Meshlet* meshlet = &meshlets[meshlet_count++];
+        meshlet->vertex_offset = total_vertices;
+        meshlet->vertex_count = vertex_count;
+        meshlet->index_offset = total_indices;
+        meshlet->index_count = meshlet_triangle_count * 3;
+        compute_meshlet_bounds(vertices, indices, state, vertex_count, meshlet_triangle_count, meshlet);
+
+        for (unsigned int i = 0; i < meshlet_triangle_count; i++) {
+            for (unsigned int k = 0; k < 3; k++) {
+                const unsigned int vertex = read_index(indices, state->meshlet_triangles[i] * 3 + k);
+                meshlet_indices[total_indices++] = total_vertices + (unsigned int)state->local_indices[vertex];
+            }
+        }
+        for (unsigned int i = 0; i < vertex_count; i++) {
+            meshlet_vertices[total_vertices++] = vertices->data[state->meshlet_vertices[i]];
+            state->local_indices[state->meshlet_vertices[i]] = -1;
+        }
+    }
+    return meshlet_count;
+}
+
+int build_meshlets(const VertexBuffer* vertices, const IndexBuffer* indices, unsigned int max_vertices, unsigned int max_triangles,
+                   VertexBuffer* meshlet_vertices, IndexBuffer* meshlet_indices, MeshletBuffer* meshlets) {
+    assert(indices->length % 3 == 0);
+    assert(max_vertices >= 3 && max_triangles >= 1);
+
+    const unsigned int triangle_count = indices->length / 3;
+
+    MeshletState state;
+    state.offsets = (unsigned int*)calloc(vertices->length + 1, sizeof(unsigned int));
+    state.adjacency = (unsigned int*)malloc((indices->length > 0 ? indices->length : 1) * sizeof(unsigned int));
+    state.normals = (float*)malloc((triangle_count > 0 ? triangle_count : 1) * 3 * sizeof(float));
+    state.assigned = (unsigned char*)calloc(triangle_count > 0 ? triangle_count : 1, 1);
+    state.local_indices = (int*)malloc((vertices->length > 0 ? vertices->length : 1) * sizeof(int));
+    state.meshlet_vertices = (unsigned int*)malloc(max_vertices * sizeof(unsigned int));
+    state.meshlet_triangles = (unsigned int*)malloc(max_triangles * sizeof(unsigned int));
+
+    // Every triangle may end up in a meshlet of its own with three vertices of its own.
+    Vertex* output_vertices = (Vertex*)malloc((indices->length > 0 ? indices->length : 1) * sizeof(Vertex));
+    unsigned int* output_indices = (unsigned int*)malloc((indices->length > 0 ? indices->length : 1) * sizeof(unsigned int));
+    Meshlet* output_meshlets = (Meshlet*)malloc((triangle_count > 0 ? triangle_count : 1) * sizeof(Meshlet));
+
+    const int allocated = state.offsets != NULL && state.adjacency != NULL && state.normals != NULL && state.assigned != NULL &&
+                          state.local_indices != NULL && state.meshlet_vertices != NULL && state.meshlet_triangles != NULL &&
+                          output_vertices != NULL && output_indices != NULL && output_meshlets != NULL;
+    const unsigned int meshlet_count = allocated ? partition_meshlets(vertices, indices, max_vertices, max_triangles, &state,
+                                                                      output_vertices, output_indices, output_meshlets) : 0;
+
+    free(state.offsets);
+    free(state.adjacency);
+    free(state.normals);
+    free(state.assigned);
+    free(state.local_indices);
+    free(state.meshlet_vertices);
+    free(state.meshlet_triangles);
+
+    if (!allocated) {
+        free(output_vertices);
+        free(output_indices);
+        free(output_meshlets);
+        return 0;
+    }
+
+    unsigned int vertex_count = 0;
+    for (unsigned int i = 0; i < meshlet_count; i++) {
+        vertex_count += output_meshlets[i].vertex_count;
+    }
+
+    // Indices are narrowed in place, 16-bit ones never overtake the 32-bit ones they're read from.
+    meshlet_indices->length = indices->length;
+    meshlet_indices->format = vertex_count <= 0x10000 ? INDEX_FORMAT_UINT16 : INDEX_FORMAT_UINT32;
+    meshlet_indices->data = output_indices;
+    for (unsigned int i = 0; i < indices->length; i++) {
+        write_index(meshlet_indices, i, output_indices[i]);
+    }
+
+    Vertex* shrunk_vertices = (Vertex*)realloc(output_vertices, (vertex_count > 0 ? vertex_count : 1) * sizeof(Vertex));
+    Meshlet* shrunk_meshlets = (Meshlet*)realloc(output_meshlets, (meshlet_count > 0 ? meshlet_count : 1) * sizeof(Meshlet));
+    void* shrunk_indices = realloc(output_indices, (indices->length > 0 ? indices->length : 1) * get_index_buffer_element_size(meshlet_indices));
+
+    meshlet_vertices->length = vertex_count;
+    meshlet_vertices->data = shrunk_vertices != NULL ? shrunk_vertices : output_vertices;
+    meshlet_vertices->bounds = vertices->bounds;
+    meshlet_indices->data = shrunk_indices != NULL ? shrunk_indices : output_indices;
+    meshlets->length = meshlet_count;
+    meshlets->data = shrunk_meshlets != NULL ? shrunk_meshlets : output_meshlets;
+    return 1;
+}
+
+// Quadric error metric from "Surface Simplification Using Quadric Error Metrics" by Michael Garland
+// and Paul S. Heckbert: the sum of squared distances to a set of planes (a, b, c, d), stored as the
+// upper triangle of a symmetric 4x4 matrix, aa ab ac ad bb bc bd cc cd dd.
+typedef struct {
+    double m[10];
+    double weight;  // Number of planes summed up.
+} Quadric;
+
+typedef struct {
+    unsigned int from;
+    unsigned int to;
+    float cost;
+} Collapse;
+
+typedef struct {
+    Quadric* quadrics;
+    unsigned char* locked;       // Border and seam vertices, which never move.
+    unsigned int* remap;         // Vertex every vertex was collapsed into, itself while it's still there.
+    unsigned char* touched;      // Vertices collapsed or collapsed into during the current pass.
+    unsigned int* offsets;       // Triangles referencing every vertex are `adjacency[offsets[v]..offsets[v + 1]]`.
+    unsigned int* adjacency;
+    Collapse* collapses;
+    unsigned int* triangles;     // Indices of the triangles left.
+    unsigned int triangle_count;
+    float error;                 // Largest quadric error of a collapse so far, squared model units. An estimate, not a bound.
+} SimplifyState;
+
+static void add_plane_quadric(Quadric* quadric, double a, double b, double c, double d) {
+    const double plane[4] = { a, b, c, d };
+    size_t k = 0;
+    for (size_t i = 0; i < 4; i++) {
+        for (size_t j = i; j < 4; j++) {
+            quadric->m[k++] += plane[i] * plane[j];
+        }
+    }
+    quadric->weight += 1.;
+}
+
+// Mean squared distance of `vertex` to the planes of `a` and `b`, which keeps the error in model units
+// no matter how many triangles were collapsed into a vertex.
+static double evaluate_quadric(const Quadric* a, const Quadric* b, const Vertex* vertex) {
+    const double point[4] = { vertex->x, vertex->y, vertex->z, 1. };
+    double result = 0.;
+    size_t k = 0;
+    for (size_t i = 0; i < 4; i++) {
+        for (size_t j = i; j < 4; j++, k++) {
+            result += (a->m[k] + b->m[k]) * point[i] * point[j] * (i == j ? 1. : 2.);
+        }
+    }
+    return result > 0. ? result / (a->weight + b->weight) : 0.;
+}
+
+static void compute_vertex_quadrics(const VertexBuffer* vertices, SimplifyState* state) {
+    for (unsigned int i = 0; i < state->triangle_count; i++) {
+        const Vertex* a = &vertices->data[state->triangles[i * 3]];
+        const Vertex* b = &vertices->data[state->triangles[i * 3 + 1]];
+        const Vertex* c = &vertices->data[state->triangles[i * 3 + 2]];
+
+        const double ab[3] = { b->x - a->x, b->y - a->y, b->z - a->z };
+        const double ac[3] = { c->x - a->x, c->y - a->y, c->z - a->z };
+        double normal[3] = { ab[1] * ac[2] - ab[2] * ac[1], ab[2] * ac[0] - ab[0] * ac[2], ab[0] * ac[1] - ab[1] * ac[0] };
+        const double length = sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+        if (length == 0.) {
+            continue;
+        }
+        for (size_t j = 0; j < 3; j++) {
+            normal[j] /= length;
+        }
+
+        const double d = -(normal[0] * a->x + normal[1] * a->y + normal[2] * a->z);
+        for (unsigned int k = 0; k < 3; k++) {
+            add_plane_quadric(&state->quadrics[state->triangles[i * 3 + k]], normal[0], normal[1], normal[2], d);
+        }
+    }
+}
+
+static void build_triangle_adjacency(unsigned int vertex_count, SimplifyState* state) {
+    const unsigned int index_count = state->triangle_count * 3;
+    memset(state->offsets, 0, (vertex_count + 1) * sizeof(unsigned int));
+    for (unsigned int i = 0; i < index_count; i++) {
+        state->offsets[state->triangles[i] + 1]++;
+    }
+    for (unsigned int i = 0; i < vertex_count; i++) {
+        state->offsets[i + 1] += state->offsets[i];
+    }
+
+    // Every offset is advanced to the next one while filling, then shifted back.
+    for (unsigned int i = 0; i < index_count; i++) {
+        state->adjacency[state->offsets[state->triangles[i]]++] = i / 3;
+    }
+    for (unsigned int i = vertex_count; i > 0; i--) {
+        state->offsets[i] = state->offsets[i - 1];
+    }
+    state->offsets[0] = 0;
+}
+
+// Locks vertices on an edge only one triangle uses, which would open holes, and vertices sharing their
+// position with another one, usually at texture seams, which would tear the seam open.
+static void lock_vertices(const VertexBuffer* vertices, SimplifyState* state, unsigned int* table, unsigned int table_size) {
+    for (unsigned int i = 0; i < table_size; i++) {
+        table[i] = EMPTY_SLOT;
+    }
+
+    for (unsigned int i = 0; i < vertices->length; i++) {
+        const float position[3] = { vertices->data[i].x, vertices->data[i].y, vertices->data[i].z };
+        unsigned int slot = hash_bytes(position, sizeof(position)) & (table_size - 1);
+        while (table[slot] != EMPTY_SLOT) {
+            const Vertex* other = &vertices->data[table[slot]];
+            if (other->x == position[0] && other->y == position[1] && other->z == position[2]) {
+                state->locked[i] = 1;
+                state->locked[table[slot]] = 1;
+                break;
+            }
+            slot = (slot + 1) & (table_size - 1);
+        }
+        if (table[slot] == EMPTY_SLOT) {
+            table[slot] = i;
+        }
+    }
+
+    for (unsigned int vertex = 0; vertex < vertices->length; vertex++) {
+        for (unsigned int i = state->offsets[vertex]; i < state->offsets[vertex + 1] && !state->locked[vertex]; i++) {
+            for (unsigned int k = 0; k < 3; k++) {
+                const unsigned int neighbor = state->triangles[state->adjacency[i] * 3 + k];
+                unsigned int edge_count = 0;
+                for (unsigned int j = state->offsets[vertex]; j < state->offsets[vertex + 1]; j++) {
+                    const unsigned int* triangle = &state->triangles[state->adjacency[j] * 3];
+                    edge_count += triangle[0] == neighbor || triangle[1] == neighbor || triangle[2] == neighbor;
+                }
+                state->locked[vertex] |= neighbor != vertex && edge_count == 1;
+            }
+        }
+    }
+}
+
+// Checks that moving `from` onto `to` doesn't fold any triangle around `from` over, and counts the
+// triangles the collapse removes.
+static int is_collapse_valid(const VertexBuffer* vertices, const SimplifyState* state, unsigned int from, unsigned int to,
+                             unsigned int* removed_triangles) {
+    *removed_triangles = 0;
+    for (unsigned int i = state->offsets[from]; i < state->offsets[from + 1]; i++) {
+        const unsigned int* triangle = &state->triangles[state->adjacency[i] * 3];
+        const unsigned int a = state->remap[triangle[0]];
+        const unsigned int b = state->remap[triangle[1]];
+        const unsigned int c = state->remap[triangle[2]];
+        if (a == b || b == c || c == a) {
+            continue;
+        }
+        if (a == to || b == to || c == to) {
+            (*removed_triangles)++;
+            continue;
+        }
+
+        const Vertex* corners[3] = { &vertices->data[a], &vertices->data[b], &vertices->data[c] };
+        float normals[2][3];
+        for (size_t j = 0; j < 2; j++) {
+            const Vertex* p0 = j == 1 && a == from ? &vertices->data[to] : corners[0];
+            const Vertex* p1 = j == 1 && b == from ? &vertices->data[to] : corners[1];
+            const Vertex* p2 = j == 1 && c == from ? &vertices->data[to] : corners[2];
+            const float ab[3] = { p1->x - p0->x, p1->y - p0->y, p1->z - p0->z };
+            const float ac[3] = { p2->x - p0->x, p2->y - p0->y, p2->z - p0->z };
+            normals[j][0] = ab[1] * ac[2] - ab[2] * ac[1];
+            normals[j][1] = ab[2] * ac[0] - ab[0] * ac[2];
+            normals[j][2] = ab[0] * ac[1] - ab[1] * ac[0];
+        }
+
+        // Normals may turn by up to about 75 degrees.
+        const float dot = normals[0][0] * normals[1][0] + normals[0][1] * normals[1][1] + normals[0][2] * normals[1][2];
+        const float length_0 = sqrtf(normals[0][0] * normals[0][0] + normals[0][1] * normals[0][1] + normals[0][2] * normals[0][2]);
+        const float length_1 = sqrtf(normals[1][0] * normals[1][0] + normals[1][1] * normals[1][1] + normals[1][2] * normals[1][2]);
+        if (length_0 > 0.f && !(dot > 0.25f * length_0 * length_1)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int compare_collapses(const void* a, const void* b) {
+    const float cost_a = ((const Collapse*)a)->cost;
+    const float cost_b = ((const Collapse*)b)->cost;
+    return cost_a < cost_b ? -1 : cost_a > cost_b;
+}
+
+// Collapses the cheapest edges first until `target_triangle_count` is reached. A vertex takes part in
+// at most one collapse per pass, so the adjacency built at the start of the pass stays usable.
+// Returns 0 if no edge could be collapsed.
+static int simplify_pass(const VertexBuffer* vertices, SimplifyState* state, unsigned int target_triangle_count) {
+    const unsigned int pass_index_count = state->triangle_count * 3;
+    build_triangle_adjacency(vertices->length, state);
+
+    unsigned int collapse_count = 0;
+    for (unsigned int i = 0; i < pass_index_count; i++) {
+        const unsigned int a = state->triangles[i];
+        const unsigned int b = state->triangles[i % 3 == 2 ? i - 2 : i + 1];
+        // Edges inside the mesh show up once in every direction, border edges are locked.
+        if (a > b || (state->locked[a] && state->locked[b])) {
+            continue;
+        }
+
+        const double cost_ab = state->locked[a] ? INFINITY : evaluate_quadric(&state->quadrics[a], &state->quadrics[b], &vertices->data[b]);
+        const double cost_ba = state->locked[b] ? INFINITY : evaluate_quadric(&state->quadrics[a], &state->quadrics[b], &vertices->data[a]);
+        Collapse* collapse = &state->collapses[collapse_count++];
+        collapse->from = cost_ab <= cost_ba ? a : b;
+        collapse->to = cost_ab <= cost_ba ? b : a;
+        collapse->cost = (float)(cost_ab <= cost_ba ? cost_ab : cost_ba);
+    }
+    qsort(state->collapses, collapse_count, sizeof(Collapse), compare_collapses);
+
+    memset(state->touched, 0, vertices->length);
+    unsigned int collapsed = 0;
+    for (unsigned int i = 0; i < collapse_count && state->triangle_count > target_triangle_count; i++) {
+        const Collapse* collapse = &state->collapses[i];
+        unsigned int removed_triangles = 0;
+        if (state->touched[collapse->from] || state->touched[collapse->to] ||
+            !is_collapse_valid(vertices, state, collapse->from, collapse->to, &removed_triangles)) {
+            continue;
+        }
+
+        state->remap[collapse->from] = collapse->to;
+        for (size_t k = 0; k < 10; k++) {
+            state->quadrics[collapse->to].m[k] += state->quadrics[collapse->from].m[k];
+        }
+        state->quadrics[collapse->to].weight += state->quadrics[collapse->from].weight;
+        state->touched[collapse->from] = 1;
+        state->touched[collapse->to] = 1;
+        state->triangle_count -= removed_triangles < state->triangle_count ? removed_triangles : state->triangle_count;
+        state->error = collapse->cost > state->error ? collapse->cost : state->error;
+        collapsed++;
+    }
+
+    unsigned int index_count = 0;
+    for (unsigned int i = 0; i < pass_index_count; i += 3) {
+        const unsigned int a = state->remap[state->triangles[i]];
+        const unsigned int b = state->remap[state->triangles[i + 1]];
+        const unsigned int c = state->remap[state->triangles[i + 2]];
+        if (a != b && b != c && c != a) {
+            state->triangles[index_count++] = a;
+            state->triangles[index_count++] = b;
+            state->triangles[index_count++] = c;
+        }
+    }
+    state->triangle_count = index_count / 3;
+    return collapsed > 0;
+}
+
+// Simplifies the mesh level by level into `levels`, with vertex indices of `vertices`. Returns the
+// number of levels, 0 if an index buffer couldn't be allocated.
+static unsigned int simplify_lod_levels(const VertexBuffer* vertices, const IndexBuffer* indices, unsigned int max_levels,
+                                        SimplifyState* state, unsigned int* table, unsigned int table_size, MeshLod* levels) {
+    for (unsigned int i = 0; i < indices->length; i++) {
+        state->triangles[i] = read_index(indices, i);
+        assert(state->triangles[i] < vertices->length);
+    }
+    for (unsigned int i = 0; i < vertices->length; i++) {
+        state->remap[i] = i;
+    }
+
+    compute_vertex_quadrics(vertices, state);
+    build_triangle_adjacency(vertices->length, state);
+    lock_vertices(vertices, state, table, table_size);
+
+    unsigned int level_count = 0;
+    while (level_count < max_levels) {
+        // Every following level aims for half the triangles. Levels that save less than a quarter aren't worth keeping.
+        if (level_count > 0) {
+            const unsigned int previous_count = levels[level_count - 1].indices.length / 3;
+            while (state->triangle_count > previous_count / 2 && simplify_pass(vertices, state, previous_count / 2)) {
+            }
+            if (state->triangle_count > previous_count - previous_count / 4) {
+                break;
+            }
+        }
+
+        MeshLod* level = &levels[level_count];
+        level->indices.length = state->triangle_count * 3;
+        level->indices.format = indices->format;
+        level->indices.data = malloc((level->indices.length > 0 ? level->indices.length : 1) * get_index_buffer_element_size(indices));
+        level->error = sqrtf(state->error);
+        if (level->indices.data == NULL) {
+            for (unsigned int i = 0; i < level_count; i++) {
+                free(levels[i].indices.data);
+            }
+            return 0;
+        }
+
+        for (unsigned int i = 0; i < level->indices.length; i++) {
+            write_index(&level->indices, i, state->triangles[i]);
+        }
+        level_count++;
+    }
+    return level_count;
+}
+
+int build_lod_chain(const VertexBuffer* vertices, const IndexBuffer* indices, unsigned int max_levels,
+                    VertexBuffer* lod_vertices, MeshLodChain* lods) {
+    assert(indices->length % 3 == 0);
+    assert(max_levels >= 1);
+
+    unsigned int table_size = 1;
+    while (table_size < vertices->length * 2) {
+        table_size *= 2;
+    }
+
+    const unsigned int vertex_count = vertices->length > 0 ? vertices->length : 1;
+    const unsigned int index_count = indices->length > 0 ? indices->length : 1;
+
+    SimplifyState state;
+    state.quadrics = (Quadric*)calloc(vertex_count, sizeof(Quadric));
+    state.locked = (unsigned char*)calloc(vertex_count, 1);
+    state.remap = (unsigned int*)malloc(vertex_count * sizeof(unsigned int));
+    state.touched = (unsigned char*)malloc(vertex_count);
+    state.offsets = (unsigned int*)malloc((vertex_count + 1) * sizeof(unsigned int));
+    state.adjacency = (unsigned int*)malloc(index_count * sizeof(unsigned int));
+    state.collapses = (Collapse*)malloc(index_count * sizeof(Collapse));
+    state.triangles = (unsigned int*)malloc(index_count * sizeof(unsigned int));
+    state.triangle_count = indices->length / 3;
+    state.error = 0.f;
+    unsigned int* table = (unsigned int*)malloc(table_size * sizeof(unsigned int));
+
+    Vertex* reordered = (Vertex*)malloc(vertex_count * sizeof(Vertex));
+    MeshLod* levels = (MeshLod*)malloc(max_levels * sizeof(MeshLod));
+
+    const int allocated = state.quadrics != NULL && state.locked != NULL && state.remap != NULL && state.touched != NULL &&
+                          state.offsets != NULL && state.adjacency != NULL && state.collapses != NULL && state.triangles != NULL &&
+                          table != NULL && reordered != NULL && levels != NULL;
+    const unsigned int level_count = allocated ? simplify_lod_levels(vertices, indices, max_levels, &state, table, table_size, levels) : 0;
+
+    free(state.quadrics);
+    free(state.locked);
+    free(state.touched);
+    free(state.offsets);
+    free(state.adjacency);
+    free(state.collapses);
+    free(state.triangles);
+    free(table);
+
+    if (level_count == 0) {
+        free(state.remap);
+        free(reordered);
+        free(levels);
+        return 0;
+    }
+
+    // Vertices are ordered coarsest level first, so every level references a prefix of the vertices of
+    // the next finer one and only that prefix needs transforming.
+    unsigned int* order = state.remap;
+    for (unsigned int i = 0; i < vertices->length; i++) {
+        order[i] = EMPTY_SLOT;
+    }
+
+    unsigned int ordered_count = 0;
+    for (unsigned int level = level_count; level > 0; level--) {
+        IndexBuffer* level_indices = &levels[level - 1].indices;
+        for (unsigned int i = 0; i < level_indices->length; i++) {
+            const unsigned int index = read_index(level_indices, i);
+            if (order[index] == EMPTY_SLOT) {
+                order[index] = ordered_count;
+                reordered[ordered_count++] = vertices->data[index];
+            }
+            write_index(level_indices, i, order[index]);
+        }
+        levels[level - 1].vertex_count = ordered_count;
+    }
+    for (unsigned int i = 0; i < vertices->length; i++) {
+        if (order[i] == EMPTY_SLOT) {
+            reordered[ordered_count++] = vertices->data[i];
+        }
+    }
+    free(order);
+
+    MeshLod* shrunk_levels = (MeshLod*)realloc(levels, level_count * sizeof(MeshLod));
+
+    lod_vertices->length = vertices->length;
+    lod_vertices->data = reordered;
+    lod_vertices->bounds = vertices->bounds;
+    lods->length = level_count;
+    lods->data = shrunk_levels != NULL ? shrunk_levels : levels;
+    return 1;
+}
+
+void free_lod_chain(MeshLodChain* lods) {
+    for (unsigned int i = 0; i < lods->length; i++) {
+        free(lods->data[i].indices.data);
+    }
+    free(lods->data);
+
+    lods->length = 0;
+    lods->data = NULL;
+}
@@ -0,0 +1,51 @@
+// soft3d by Andrej Suvorau, 2019
+
+// Mesh processing. Functions that produce buffers allocate them with malloc and return 1 on success.
+
+// Merges vertices of the flat triangle list `vertices` whose components all differ by at most
+// `epsilon`. With an epsilon of zero, only bit-identical vertices are merged. Epsilon-equal
+// vertices are found through a grid of `epsilon` sized cells, so a pair straddling a cell border
+// may stay separate. The first occurrence of a vertex is kept, so triangle order and winding are
+// preserved. 16-bit indices are produced when `allow_16bit_indices` is set and they suffice.
+extern int weld_vertices(const VertexBuffer* vertices, float epsilon, int allow_16bit_indices,
+                         VertexBuffer* unique_vertices, IndexBuffer* indices);
+
+// Reorders the triangles of `indices` in place for a post-transform vertex cache holding
+// `cache_size` vertices, with Tom Forsyth's linear-speed vertex cache optimization.
+extern int optimize_vertex_cache(IndexBuffer* indices, unsigned int vertex_count, unsigned int cache_size);
+
+// Reorders `vertices` in the order the triangles first reference them and remaps `indices`, so
+// vertex fetches walk memory forward. Unreferenced vertices are moved to the end.
+extern int optimize_vertex_fetch(VertexBuffer* vertices, IndexBuffer* indices);
+
+// Average cache miss ratio: transformed vertices per triangle with a FIFO cache of `cache_size`.
+extern float compute_acmr(const IndexBuffer* indices, unsigned int vertex_count, unsigned int cache_size);
+
+extern void compute_bounding_box(const VertexBuffer* vertices, BoundingBox* bounds);
+
+// Splits the triangles of `indices` into meshlets of at most `max_vertices` vertices and `max_triangles`
+// triangles, grown greedily over shared vertices. Every meshlet gets its own copy of its vertices in
+// `meshlet_vertices`, which shares `bounds` with `vertices`, and its triangles in `meshlet_indices`.
+extern int build_meshlets(const VertexBuffer* vertices, const IndexBuffer* indices, unsigned int max_vertices, unsigned int max_triangles,
+                          VertexBuffer* meshlet_vertices, IndexBuffer* meshlet_indices, MeshletBuffer* meshlets);
+
+// Simplifies `indices` into up to `max_levels` levels of detail by quadric edge collapse, each with at
+// most half the triangles of the previous one. Level 0 is the full mesh. Vertices are only ever
+// collapsed onto other vertices, never moved, and vertices on borders or sharing their position with
+// another one at a texture seam stay put. All levels index `lod_vertices`, which holds `vertices`
+// reordered and shares `bounds` with them. Every level's `error` is the root of the largest mean
+// squared plane distance of its collapses, an estimate of its deviation rather than a bound. Free the
+// levels with `free_lod_chain`.
+extern int build_lod_chain(const VertexBuffer* vertices, const IndexBuffer* indices, unsigned int max_levels,
+                           VertexBuffer* lod_vertices, MeshLodChain* lods);
+extern void free_lod_chain(MeshLodChain* lods);
+
+// Quantizes positions and texture coordinates to 16 bits over their bounding ranges, which become
+// the scale and bias of `packed_vertices`. `bounds` is shared with `vertices`.
+extern int quantize_vertex_buffer(const VertexBuffer* vertices, PackedVertexBuffer* packed_vertices);
+
+// Copies `vertices` into separate 32-byte aligned component arrays. `bounds` is shared with `vertices`. Free them with `free_soa_vertex_buffer`.
+extern int convert_to_soa_vertex_buffer(const VertexBuffer* vertices, SoaVertexBuffer* soa_vertices);
+extern void free_soa_vertex_buffer(SoaVertexBuffer* soa_vertices);
+
+extern unsigned int get_index_buffer_element_size(const IndexBuffer* indices);
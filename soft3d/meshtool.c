@@ -0,0 +1,333 @@
+// soft3d by Andrej Suvorau, 2019
+
+#include "soft3d.h"
+#include "mesh.h"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Mesh headers are C sources in the format of dog_vertex.h: a `Vertex` array initializer, optionally
+// followed by an index array initializer as written by this tool.
+typedef struct {
+    VertexBuffer vertices;
+    IndexBuffer indices;
+} Mesh;
+
+static char* read_file(const char* path) {
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) {
+        return NULL;
+    }
+
+    fseek(file, 0, SEEK_END);
+    const long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    char* text = size >= 0 ? (char*)malloc((size_t)size + 1) : NULL;
+    if (text == NULL || fread(text, 1, (size_t)size, file) != (size_t)size) {
+        free(text);
+        fclose(file);
+        return NULL;
+    }
+
+    text[size] = '\0';
+    fclose(file);
+    return text;
+}
+
+static const char* get_file_name(const char* path) {
+    const char* slash = strrchr(path, '/');
+    const char* backslash = strrchr(path, '\\');
+    slash = backslash > slash ? backslash : slash;
+    return slash != NULL ? slash + 1 : path;
+}
+
+// Returns a pointer past the opening brace of the next array initializer, or NULL.
+static const char* find_array(const char* text) {
+    const char* assignment = strchr(text, '=');
+    if (assignment == NULL) {
+        return NULL;
+    }
+    const char* brace = strchr(assignment, '{');
+    return brace != NULL ? brace + 1 : NULL;
+}
+
+static const char* skip_separators(const char* text) {
+    while (*text != '\0' && (isspace((unsigned char)*text) || *text == ',' || *text == 'f' || *text == 'u')) {
+        text++;
+    }
+    return text;
+}
+
+static int parse_mesh(const char* text, Mesh* mesh) {
+    unsigned int vertex_capacity = 1024;
+    mesh->vertices.length = 0;
+    mesh->vertices.data = (Vertex*)malloc(vertex_capacity * sizeof(Vertex));
+    mesh->indices.length = 0;
+    mesh->indices.format = INDEX_FORMAT_UINT32;
+    mesh->indices.data = NULL;
+
+    const char* cursor = find_array(text);
+    if (cursor == NULL || mesh->vertices.data == NULL) {
+        return 0;
+    }
+
+    for (cursor = skip_separators(cursor); *cursor == '{'; cursor = skip_separators(cursor)) {
+        float components[5];
+        cursor++;
+        for (size_t i = 0; i < 5; i++) {
+            char* end;
+            components[i] = strtof(skip_separators(cursor), &end);
+            if (end == skip_separators(cursor)) {
+                return 0;
+            }
+            cursor = end;
+        }
+
+        cursor = skip_separators(cursor);
+        if (*cursor++ != '}') {
+            return 0;
+        }
+
+        if (mesh->vertices.length == vertex_capacity) {
+            vertex_capacity *= 2;
+            Vertex* data = (Vertex*)realloc(mesh->vertices.data, vertex_capacity * sizeof(Vertex));
+            if (data == NULL) {
+                return 0;
+            }
+            mesh->vertices.data = data;
+        }
+
+        Vertex* vertex = &mesh->vertices.data[mesh->vertices.length++];
+        vertex->x = components[0];
+        vertex->y = components[1];
+        vertex->z = components[2];
+        vertex->u = components[3];
+        vertex->v = components[4];
+    }
+
+    cursor = find_array(cursor);
+    if (cursor == NULL) {
+        return mesh->vertices.length > 0;
+    }
+
+    unsigned int index_capacity = 1024;
+    unsigned int* indices = (unsigned int*)malloc(index_capacity * sizeof(unsigned int));
+    mesh->indices.data = indices;
+
+    for (cursor = skip_separators(cursor); indices != NULL && isdigit((unsigned char)*cursor); cursor = skip_separators(cursor)) {
+        char* end;
+        const unsigned long index = strtoul(cursor, &end, 10);
+        if (index >= mesh->vertices.length) {
+            return 0;
+        }
+        cursor = end;
+
+        if (mesh->indices.length == index_capacity) {
+            index_capacity *= 2;
+            indices = (unsigned int*)realloc(mesh->indices.data, index_capacity * sizeof(unsigned int));
+            if (indices == NULL) {
+                return 0;
+            }
+            mesh->indices.data = indices;
+        }
+        indices[mesh->indices.length++] = (unsigned int)index;
+    }
+
+    return indices != NULL && mesh->indices.length % 3 == 0;
+}
+
+static void destroy_mesh(Mesh* mesh) {
+    free(mesh->vertices.data);
+    free(mesh->indices.data);
+}
+
+// Prints the shortest decimal representation that reads back as the same float.
+static void print_float(FILE* file, float value) {
+    char text[32];
+    for (int precision = 1; precision <= 9; precision++) {
+        snprintf(text, sizeof(text), "%.*g", precision, value);
+        if (strtof(text, NULL) == value) {
+            break;
+        }
+    }
+
+    const int integral = strpbrk(text, ".en") == NULL;
+    fprintf(file, integral ? "%s.f" : "%sf", text);
+}
+
+static int write_mesh(const char* path, const char* name, const char* comment, const Mesh* mesh) {
+    FILE* file = fopen(path, "w");
+    if (file == NULL) {
+        return 0;
+    }
+
+    fprintf(file, "// %s\n\n", comment);
+
+    fprintf(file, "static Vertex %s_vertices[] = {\n", name);
+    for (unsigned int i = 0; i < mesh->vertices.length; i++) {
+        const Vertex* vertex = &mesh->vertices.data[i];
+        fprintf(file, "    { ");
+        print_float(file, vertex->x);
+        fprintf(file, ", ");
+        print_float(file, vertex->y);
+        fprintf(file, ", ");
+        print_float(file, vertex->z);
+        fprintf(file, ", ");
+        print_float(file, vertex->u);
+        fprintf(file, ", ");
+        print_float(file, vertex->v);
+        fprintf(file, " },\n");
+    }
+    fprintf(file, "};\n\n");
+
+    const int short_indices = mesh->indices.format == INDEX_FORMAT_UINT16;
+    fprintf(file, "static unsigned %s %s_indices[] = {\n", short_indices ? "short" : "int", name);
+    for (unsigned int i = 0; i < mesh->indices.length; i += 3) {
+        fprintf(file, "    ");
+        for (unsigned int j = i; j < i + 3; j++) {
+            const unsigned int index = short_indices ? ((const unsigned short*)mesh->indices.data)[j] : ((const unsigned int*)mesh->indices.data)[j];
+            fprintf(file, j + 1 < i + 3 ? "%u, " : "%u,\n", index);
+        }
+    }
+    fprintf(file, "};\n");
+
+    const int failed = ferror(file);
+    return fclose(file) == 0 && !failed;
+}
+
+static int weld(const char* input_path, const char* output_path, const char* name, float epsilon, int allow_16bit_indices) {
+    char* text = read_file(input_path);
+    if (text == NULL) {
+        fprintf(stderr, "failed to read %s\n", input_path);
+        return EXIT_FAILURE;
+    }
+
+    Mesh source = { 0 };
+    const int parsed = parse_mesh(text, &source);
+    free(text);
+    if (!parsed || source.indices.length > 0 || source.vertices.length % 3 != 0) {
+        fprintf(stderr, "%s is not a flat triangle list of vertices\n", input_path);
+        destroy_mesh(&source);
+        return EXIT_FAILURE;
+    }
+
+    Mesh welded = { 0 };
+    if (!weld_vertices(&source.vertices, epsilon, allow_16bit_indices, &welded.vertices, &welded.indices)) {
+        fprintf(stderr, "out of memory\n");
+        destroy_mesh(&source);
+        return EXIT_FAILURE;
+    }
+
+    const size_t source_size = source.vertices.length * sizeof(Vertex);
+    const size_t welded_size = welded.vertices.length * sizeof(Vertex) + welded.indices.length * get_index_buffer_element_size(&welded.indices);
+
+    char comment[256];
+    snprintf(comment, sizeof(comment), "Generated by meshtool weld from %s (%u vertices, epsilon %g).", get_file_name(input_path), source.vertices.length, epsilon);
+
+    const int written = write_mesh(output_path, name, comment, &welded);
+    if (written) {
+        printf("{\"vertices\":%u,\"unique_vertices\":%u,\"indices\":%u,\"index_bits\":%u,\"source_bytes\":%zu,\"welded_bytes\":%zu}\n",
+               source.vertices.length, welded.vertices.length, welded.indices.length, get_index_buffer_element_size(&welded.indices) * 8,
+               source_size, welded_size);
+    } else {
+        fprintf(stderr, "failed to write %s\n", output_path);
+    }
+
+    destroy_mesh(&welded);
+    destroy_mesh(&source);
+    return written ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+static int optimize(const char* input_path, const char* output_path, const char* name, unsigned int cache_size) {
+    char* text = read_file(input_path);
+    if (text == NULL) {
+        fprintf(stderr, "failed to read %s\n", input_path);
+        return EXIT_FAILURE;
+    }
+
+    Mesh mesh = { 0 };
+    const int parsed = parse_mesh(text, &mesh);
+    free(text);
+    if (!parsed || mesh.indices.length == 0) {
+        fprintf(stderr, "%s is not an indexed mesh, weld it first\n", input_path);
+        destroy_mesh(&mesh);
+        return EXIT_FAILURE;
+    }
+
+    // Indices are parsed as 32-bit; narrow them back when the vertex count allows.
+    if (mesh.vertices.length <= 0x10000) {
+        unsigned short* narrow = (unsigned short*)mesh.indices.data;
+        for (unsigned int i = 0; i < mesh.indices.length; i++) {
+            narrow[i] = (unsigned short)((const unsigned int*)mesh.indices.data)[i];
+        }
+        mesh.indices.format = INDEX_FORMAT_UINT16;
+    }
+
+    const float acmr_before = compute_acmr(&mesh.indices, mesh.vertices.length, cache_size);
+    if (!optimize_vertex_cache(&mesh.indices, mesh.vertices.length, cache_size) || !optimize_vertex_fetch(&mesh.vertices, &mesh.indices)) {
+        fprintf(stderr, "out of memory\n");
+        destroy_mesh(&mesh);
+        return EXIT_FAILURE;
+    }
+    const float acmr_after = compute_acmr(&mesh.indices, mesh.vertices.length, cache_size);
+
+    char comment[256];
+    snprintf(comment, sizeof(comment), "Generated by meshtool optimize from %s (cache size %u).", get_file_name(input_path), cache_size);
+
+    const int written = write_mesh(output_path, name, comment, &mesh);
+    if (written) {
+        printf("{\"triangles\":%u,\"vertices\":%u,\"cache_size\":%u,\"acmr_before\":%.4f,\"acmr_after\":%.4f,\"atvr_before\":%.4f,\"atvr_after\":%.4f}\n",
+               mesh.indices.length / 3, mesh.vertices.length, cache_size, acmr_before, acmr_after,
+               acmr_before * (mesh.indices.length / 3) / mesh.vertices.length, acmr_after * (mesh.indices.length / 3) / mesh.vertices.length);
+    } else {
+        fprintf(stderr, "failed to write %s\n", output_path);
+    }
+
+    destroy_mesh(&mesh);
+    return written ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+static int print_usage(const char* program) {
+    fprintf(stderr, "usage: %s weld <input.h> <output.h> [--name NAME] [--epsilon E] [--index-bits 16|32]\n"
+                    "       %s optimize <input.h> <output.h> [--name NAME] [--cache-size N]\n", program, program);
+    return EXIT_FAILURE;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 4) {
+        return print_usage(argv[0]);
+    }
+
+    const int welding = strcmp(argv[1], "weld") == 0;
+    if (!welding && strcmp(argv[1], "optimize") != 0) {
+        return print_usage(argv[0]);
+    }
+
+    const char* name = "mesh";
+    float epsilon = 0.f;
+    int allow_16bit_indices = 1;
+    unsigned int cache_size = 16;
+    for (int i = 4; i < argc; i++) {
+        if (i + 1 >= argc) {
+            return print_usage(argv[0]);
+        } else if (strcmp(argv[i], "--name") == 0) {
+            name = argv[++i];
+        } else if (welding && strcmp(argv[i], "--epsilon") == 0) {
+            epsilon = (float)atof(argv[++i]);
+        } else if (welding && strcmp(argv[i], "--index-bits") == 0) {
+            allow_16bit_indices = atoi(argv[++i]) == 16;
+        } else if (!welding && strcmp(argv[i], "--cache-size") == 0) {
+            cache_size = (unsigned int)atoi(argv[++i]);
+            if (cache_size <= 3) {
+                return print_usage(argv[0]);
+            }
+        } else {
+            return print_usage(argv[0]);
+        }
+    }
+
+    return welding ? weld(argv[2], argv[3], name, epsilon, allow_16bit_indices) : optimize(argv[2], argv[3], name, cache_size);
+}
@@ -0,0 +1,274 @@
+// soft3d by Andrej Suvorau, 2019
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "soft3d.h"
+#include "mesh.h"
+#include "potato.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define TARGET_WIDTH 800
+#define TARGET_HEIGHT 600
+#define TEXTURE_SIZE 256
+#define VERTEX_COUNT 65536
+#define TRIANGLE_COUNT 4096
+#define DEFAULT_PASSES 32
+
+typedef struct {
+    const char* name;
+    float min_area;
+    float max_area;
+} SizeClass;
+
+static const SizeClass size_classes[] = {
+    { "lt1px",      0.05f,  1.f },
+    { "1to16px",    1.f,    16.f },
+    { "16to256px",  16.f,   256.f },
+    { "gt256px",    256.f,  4096.f },
+};
+
+DepthColorBuffer backbuffer;
+
+static unsigned int random_state = 1234;
+
+static double get_time_ns() {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec * 1000000000.0 + time.tv_nsec;
+}
+
+static float random_float(float min, float max) {
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return min + (max - min) * (random_state & 0xFFFFFF) / (float)0x1000000;
+}
+
+static void clear_target(DepthColorBuffer* target) {
+    for (size_t i = 0; i < (size_t)target->width * target->height; i++) {
+        *(unsigned int*)(target->data + i) = 0xFF303030;
+        target->depth[i] = -1000.f;
+    }
+}
+
+// A random, reasonably shaped triangle with an area log-uniformly distributed within the size class.
+static RasterizedTriangle generate_triangle(const SizeClass* size_class) {
+    const float area = (float)exp(random_float((float)log(size_class->min_area), (float)log(size_class->max_area)));
+    const float radius = (float)sqrt(area / 1.299f);
+    const float x = random_float(radius + 1.f, TARGET_WIDTH - radius - 1.f);
+    const float y = random_float(radius + 1.f, TARGET_HEIGHT - radius - 1.f);
+    const float z = random_float(0.f, 1.f);
+
+    float angle = random_float(0.f, 6.283185307f);
+
+    RasterizedVertex* vertices[3];
+    RasterizedTriangle triangle;
+    vertices[0] = &triangle.a;
+    vertices[1] = &triangle.b;
+    vertices[2] = &triangle.c;
+
+    for (size_t i = 0; i < 3; i++) {
+        vertices[i]->x = x + radius * (float)cos(angle);
+        vertices[i]->y = y + radius * (float)sin(angle);
+        vertices[i]->z = z;
+        vertices[i]->u = random_float(0.f, 1.f);
+        vertices[i]->v = random_float(0.f, 1.f);
+        angle += random_float(1.6f, 2.6f);
+    }
+
+    kernel_sort_vertices(&triangle);
+    return triangle;
+}
+
+static void run_convert_vertex(long passes) {
+    Vertex* vertices = (Vertex*)malloc(VERTEX_COUNT * sizeof(Vertex));
+    if (vertices == NULL) {
+        return;
+    }
+
+    for (size_t i = 0; i < VERTEX_COUNT; i++) {
+        Vertex vertex = { random_float(-0.5f, 0.5f), random_float(-0.5f, 0.5f), random_float(-0.5f, 0.5f), random_float(0.f, 1.f), random_float(0.f, 1.f) };
+        vertices[i] = vertex;
+    }
+
+    Matrix view, projection, transform;
+    build_translation_matrix(&view, 0.f, 0.f, 2.f);
+    build_projection_matrix(&projection, 0.942478f, (float)TARGET_WIDTH / TARGET_HEIGHT, 0.01f, 100.f);
+    mul(&view, &projection, &transform);
+
+    float checksum = 0.f;
+    const double start_time = get_time_ns();
+    for (long pass = 0; pass < passes; pass++) {
+        for (size_t i = 0; i < VERTEX_COUNT; i++) {
+            checksum += kernel_convert_vertex(vertices + i, &transform, (float)TARGET_WIDTH, (float)TARGET_HEIGHT).x;
+        }
+    }
+    const double elapsed_time = get_time_ns() - start_time;
+
+    printf("    { \"kernel\": \"convert_vertex\", \"ns_per_vertex\": %.3f, \"checksum\": %g },\n", elapsed_time / ((double)passes * VERTEX_COUNT), checksum);
+
+    float* transformed = (float*)malloc(VERTEX_COUNT * 5 * sizeof(float) + VERTEX_COUNT * sizeof(unsigned int));
+    if (transformed != NULL) {
+        unsigned int* outcodes = (unsigned int*)(transformed + VERTEX_COUNT * 5);
+
+        const double batch_start_time = get_time_ns();
+        for (long pass = 0; pass < passes; pass++) {
+            kernel_transform_vertices(vertices, VERTEX_COUNT, &transform, (float)TARGET_WIDTH, (float)TARGET_HEIGHT,
+                                      transformed, transformed + VERTEX_COUNT, transformed + VERTEX_COUNT * 2, outcodes);
+        }
+        const double batch_elapsed_time = get_time_ns() - batch_start_time;
+
+        printf("    { \"kernel\": \"transform_vertices\", \"ns_per_vertex\": %.3f, \"bytes_per_vertex\": %zu },\n",
+               batch_elapsed_time / ((double)passes * VERTEX_COUNT), sizeof(Vertex));
+
+        const VertexBuffer vertex_buffer = { VERTEX_COUNT, vertices, NULL };
+        SoaVertexBuffer soa_buffer;
+        if (convert_to_soa_vertex_buffer(&vertex_buffer, &soa_buffer)) {
+            const double soa_start_time = get_time_ns();
+            for (long pass = 0; pass < passes; pass++) {
+                kernel_transform_soa_vertices(&soa_buffer, &transform, (float)TARGET_WIDTH, (float)TARGET_HEIGHT,
+                                              transformed, transformed + VERTEX_COUNT, transformed + VERTEX_COUNT * 2, outcodes);
+            }
+            const double soa_elapsed_time = get_time_ns() - soa_start_time;
+
+            printf("    { \"kernel\": \"transform_soa_vertices\", \"ns_per_vertex\": %.3f, \"bytes_per_vertex\": %zu },\n",
+                   soa_elapsed_time / ((double)passes * VERTEX_COUNT), 3 * sizeof(float));
+            free_soa_vertex_buffer(&soa_buffer);
+        }
+
+        PackedVertexBuffer packed_buffer;
+        if (quantize_vertex_buffer(&vertex_buffer, &packed_buffer)) {
+            const double packed_start_time = get_time_ns();
+            for (long pass = 0; pass < passes; pass++) {
+                kernel_transform_packed_vertices(&packed_buffer, &transform, (float)TARGET_WIDTH, (float)TARGET_HEIGHT,
+                                                 transformed, transformed + VERTEX_COUNT, transformed + VERTEX_COUNT * 2,
+                                                 transformed + VERTEX_COUNT * 3, transformed + VERTEX_COUNT * 4, outcodes);
+            }
+            const double packed_elapsed_time = get_time_ns() - packed_start_time;
+
+            printf("    { \"kernel\": \"transform_packed_vertices\", \"ns_per_vertex\": %.3f, \"bytes_per_vertex\": %zu },\n",
+                   packed_elapsed_time / ((double)passes * VERTEX_COUNT), sizeof(PackedVertex));
+            free(packed_buffer.data);
+        }
+
+        free(transformed);
+    }
+
+    free(vertices);
+}
+
+static void run_sort_vertices(long passes) {
+    RasterizedTriangle* triangles = (RasterizedTriangle*)malloc(TRIANGLE_COUNT * sizeof(RasterizedTriangle));
+    RasterizedTriangle* sorted = (RasterizedTriangle*)malloc(TRIANGLE_COUNT * sizeof(RasterizedTriangle));
+    if (triangles == NULL || sorted == NULL) {
+        free(triangles);
+        free(sorted);
+        return;
+    }
+
+    for (size_t i = 0; i < TRIANGLE_COUNT; i++) {
+        RasterizedVertex* vertices[3] = { &triangles[i].a, &triangles[i].b, &triangles[i].c };
+        for (size_t j = 0; j < 3; j++) {
+            vertices[j]->x = random_float(0.f, TARGET_WIDTH);
+            vertices[j]->y = random_float(0.f, TARGET_HEIGHT);
+            vertices[j]->z = vertices[j]->u = vertices[j]->v = 0.f;
+        }
+    }
+
+    double elapsed_time = 0.0;
+    for (long pass = 0; pass < passes; pass++) {
+        for (size_t i = 0; i < TRIANGLE_COUNT; i++) {
+            sorted[i] = triangles[i];
+        }
+
+        const double start_time = get_time_ns();
+        for (size_t i = 0; i < TRIANGLE_COUNT; i++) {
+            kernel_sort_vertices(sorted + i);
+        }
+        elapsed_time += get_time_ns() - start_time;
+    }
+
+    printf("    { \"kernel\": \"sort_vertices\", \"ns_per_triangle\": %.3f },\n", elapsed_time / ((double)passes * TRIANGLE_COUNT));
+    free(triangles);
+    free(sorted);
+}
+
+static void run_rasterize_triangle(long passes, const ColorBuffer* texture, DepthColorBuffer* target) {
+    RasterizedTriangle* triangles = (RasterizedTriangle*)malloc(TRIANGLE_COUNT * sizeof(RasterizedTriangle));
+    if (triangles == NULL) {
+        return;
+    }
+
+    const size_t class_count = sizeof(size_classes) / sizeof(size_classes[0]);
+    for (size_t i = 0; i < class_count; i++) {
+        for (size_t j = 0; j < TRIANGLE_COUNT; j++) {
+            triangles[j] = generate_triangle(&size_classes[i]);
+        }
+
+        double elapsed_time = 0.0;
+        reset_pipeline_statistics();
+
+        for (long pass = 0; pass < passes; pass++) {
+            clear_target(target);
+
+            const double start_time = get_time_ns();
+            for (size_t j = 0; j < TRIANGLE_COUNT; j++) {
+                rasterize_triangle(triangles + j, texture, target);
+            }
+            elapsed_time += get_time_ns() - start_time;
+        }
+
+        PipelineStatistics statistics;
+        get_pipeline_statistics(&statistics);
+
+        const double triangle_count = (double)passes * TRIANGLE_COUNT;
+        printf("    { \"kernel\": \"rasterize_triangle\", \"size_class\": \"%s\", \"ns_per_triangle\": %.3f, \"ns_per_pixel\": %.3f, "
+               "\"pixels_per_triangle\": %.3f, \"rejected_ratio\": %.4f }%s\n",
+               size_classes[i].name, elapsed_time / triangle_count,
+               statistics.pixels_tested > 0 ? elapsed_time / statistics.pixels_tested : 0.0,
+               statistics.pixels_tested / triangle_count, statistics.triangles_rejected / triangle_count,
+               i + 1 < class_count ? "," : "");
+    }
+
+    free(triangles);
+}
+
+int main(int argc, char** argv) {
+    const long passes = argc > 1 ? strtol(argv[1], NULL, 10) : DEFAULT_PASSES;
+    if (passes <= 0) {
+        fprintf(stderr, "usage: %s [passes]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    ColorBuffer texture = { TEXTURE_SIZE, TEXTURE_SIZE, (Color*)malloc(TEXTURE_SIZE * TEXTURE_SIZE * sizeof(Color)) };
+    DepthColorBuffer target = { TARGET_WIDTH, TARGET_HEIGHT,
+                                (Color*)malloc(TARGET_WIDTH * TARGET_HEIGHT * sizeof(Color)),
+                                (float*)malloc(TARGET_WIDTH * TARGET_HEIGHT * sizeof(float)) };
+
+    if (texture.data == NULL || target.data == NULL || target.depth == NULL) {
+        free(texture.data);
+        free(target.data);
+        free(target.depth);
+        return EXIT_FAILURE;
+    }
+
+    for (size_t i = 0; i < TEXTURE_SIZE * TEXTURE_SIZE; i++) {
+        Color color = { (unsigned char)i, (unsigned char)(i >> 8), 0x80, 0xFF };
+        texture.data[i] = color;
+    }
+
+    printf("{\n  \"passes\": %ld,\n  \"kernels\": [\n", passes);
+    run_convert_vertex(passes);
+    run_sort_vertices(passes);
+    run_rasterize_triangle(passes, &texture, &target);
+    printf("  ]\n}\n");
+
+    free(texture.data);
+    free(target.data);
+    free(target.depth);
+    return EXIT_SUCCESS;
+}
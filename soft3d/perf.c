@@ -0,0 +1,103 @@
+// soft3d by Andrej Suvorau, 2019
+
+#ifdef __linux__
+#define _GNU_SOURCE
+#endif
+
+#include "perf.h"
+
+#include <stddef.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+static int perf_descriptors[PERF_EVENT_COUNT] = { -1, -1, -1, -1, -1 };
+
+const char* perf_event_name(PerfEvent event) {
+    static const char* names[PERF_EVENT_COUNT] = { "cycles", "instructions", "l1d_misses", "llc_misses", "dtlb_misses" };
+    return event < PERF_EVENT_COUNT ? names[event] : "unknown";
+}
+
+int perf_available(PerfEvent event) {
+    return event < PERF_EVENT_COUNT && perf_descriptors[event] >= 0;
+}
+
+#ifdef __linux__
+
+static int open_event(unsigned int type, unsigned long long config) {
+    struct perf_event_attr attributes;
+    memset(&attributes, 0, sizeof(attributes));
+    attributes.size = sizeof(attributes);
+    attributes.type = type;
+    attributes.config = config;
+    attributes.disabled = 1;
+    attributes.exclude_kernel = 1;
+    attributes.exclude_hv = 1;
+
+    const int descriptor = (int)syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0);
+    if (descriptor >= 0) {
+        ioctl(descriptor, PERF_EVENT_IOC_RESET, 0);
+        ioctl(descriptor, PERF_EVENT_IOC_ENABLE, 0);
+    }
+    return descriptor;
+}
+
+static unsigned long long cache_config(unsigned long long cache, unsigned long long operation, unsigned long long result) {
+    return cache | (operation << 8) | (result << 16);
+}
+
+unsigned int perf_open() {
+    perf_close();
+
+    perf_descriptors[PERF_EVENT_CYCLES] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    perf_descriptors[PERF_EVENT_INSTRUCTIONS] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+    perf_descriptors[PERF_EVENT_L1D_MISSES] = open_event(PERF_TYPE_HW_CACHE, cache_config(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS));
+    perf_descriptors[PERF_EVENT_LLC_MISSES] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+    perf_descriptors[PERF_EVENT_DTLB_MISSES] = open_event(PERF_TYPE_HW_CACHE, cache_config(PERF_COUNT_HW_CACHE_DTLB, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS));
+
+    unsigned int count = 0;
+    for (size_t i = 0; i < PERF_EVENT_COUNT; i++) {
+        count += perf_descriptors[i] >= 0;
+    }
+    return count;
+}
+
+void perf_close() {
+    for (size_t i = 0; i < PERF_EVENT_COUNT; i++) {
+        if (perf_descriptors[i] >= 0) {
+            close(perf_descriptors[i]);
+            perf_descriptors[i] = -1;
+        }
+    }
+}
+
+void perf_read(PerfSample* sample) {
+    for (size_t i = 0; i < PERF_EVENT_COUNT; i++) {
+        sample->values[i] = 0;
+        if (perf_descriptors[i] >= 0 && read(perf_descriptors[i], &sample->values[i], sizeof(sample->values[i])) != sizeof(sample->values[i])) {
+            sample->values[i] = 0;
+        }
+    }
+}
+
+#else
+
+unsigned int perf_open() {
+    return 0;
+}
+
+void perf_close() {
+}
+
+void perf_read(PerfSample* sample) {
+    for (size_t i = 0; i < PERF_EVENT_COUNT; i++) {
+        sample->values[i] = 0;
+    }
+}
+
+#endif
@@ -0,0 +1,27 @@
+// soft3d by Andrej Suvorau, 2019
+
+// Hardware performance counters of the calling thread, read through perf_event_open on Linux.
+// Elsewhere, or when the kernel doesn't allow it, no counter is available.
+
+typedef enum {
+    PERF_EVENT_CYCLES,
+    PERF_EVENT_INSTRUCTIONS,
+    PERF_EVENT_L1D_MISSES,
+    PERF_EVENT_LLC_MISSES,
+    PERF_EVENT_DTLB_MISSES,
+    PERF_EVENT_COUNT
+} PerfEvent;
+
+typedef struct {
+    unsigned long long values[PERF_EVENT_COUNT];
+} PerfSample;
+
+// Returns the number of counters that could be opened.
+extern unsigned int perf_open();
+extern void perf_close();
+
+extern int perf_available(PerfEvent event);
+extern const char* perf_event_name(PerfEvent event);
+
+// Reads the running totals of all counters. Unavailable counters read as zero.
+extern void perf_read(PerfSample* sample);
@@ -0,0 +1,21 @@
+// soft3d by Andrej Suvorau, 2019
+
+// The original dog texture is not distributed with the sources. When it's missing, this header
+// provides a procedural 1024x1024 RGBA checkerboard of the same size and layout instead, which
+// potato_init generates through generate_texture_data before using it.
+
+#define DOG_TEXTURE_PLACEHOLDER
+
+static unsigned char texture_data[1024 * 1024 * 4];
+
+static void generate_texture_data() {
+    for (size_t i = 0; i < 1024; i++) {
+        for (size_t j = 0; j < 1024; j++) {
+            const unsigned char shade = ((i / 32) + (j / 32)) % 2 ? 0xE0 : 0x60;
+            texture_data[i * 1024 * 4 + j * 4]     = (unsigned char)(shade * j / 1024);
+            texture_data[i * 1024 * 4 + j * 4 + 1] = (unsigned char)(shade * i / 1024);
+            texture_data[i * 1024 * 4 + j * 4 + 2] = shade;
+            texture_data[i * 1024 * 4 + j * 4 + 3] = 0xFF;
+        }
+    }
+}
@@ -1,4 +1,6 @@
 #include "soft3d.h"
+#include "potato.h"
+#include "mesh.h"
 
 #include <math.h>
 #include <stdlib.h>
@@ -6,22 +8,54 @@
 #define BACKBUFFER_WIDTH 800
 #define BACKBUFFER_HEIGHT 600
 
-extern DepthColorBuffer backbuffer;
+#define MESHLET_MAX_VERTICES 64
+#define MESHLET_MAX_TRIANGLES 124
+
+#define CAMERA_NEAR 0.01f
+#define CAMERA_FAR 100.f
+
+#define LOD_MAX_LEVELS 8
+#define LOD_MAX_PIXEL_ERROR 0.5f
+
 static ColorBuffer texture;
 
-#include "dog_vertex.h"
+// Welded from dog_vertex.h with `meshtool weld dog_vertex.h dog_indexed.h --name dog`, then
+// reordered with `meshtool optimize dog_indexed.h dog_indexed.h --name dog --cache-size 16`.
+#include "dog_indexed.h"
 
-static VertexBuffer vertex_buffer = { 55668, vertex_data };
+static BoundingBox bounds;
+static VertexBuffer vertex_buffer = { sizeof(dog_vertices) / sizeof(dog_vertices[0]), dog_vertices, &bounds };
+static IndexBuffer index_buffer = { sizeof(dog_indices) / sizeof(dog_indices[0]), INDEX_FORMAT_UINT16, dog_indices };
+
+static PackedVertexBuffer packed_vertex_buffer;
+static SoaVertexBuffer soa_vertex_buffer;
+static VertexBuffer meshlet_vertex_buffer;
+static IndexBuffer meshlet_index_buffer;
+static MeshletBuffer meshlet_buffer;
+static VertexBuffer lod_vertex_buffer;
+static MeshLodChain lod_chain;
+static PotatoVertexLayout vertex_layout = POTATO_VERTEX_LAYOUT_FLOAT;
 
 #include "dog_texture.h"
 
 static ColorBuffer texture_buffer = { 1024, 1024, (Color*)texture_data };
 
+void potato_resize(unsigned int width, unsigned int height) {
+    free(backbuffer.data);
+    free(backbuffer.depth);
+
+    backbuffer.width = width;
+    backbuffer.height = height;
+    backbuffer.data = (Color*)calloc(width * height, sizeof(Color));
+    backbuffer.depth = (float*)calloc(width * height, sizeof(float));
+}
+
 void potato_init() {
-    backbuffer.width = BACKBUFFER_WIDTH;
-    backbuffer.height = BACKBUFFER_HEIGHT;
-    backbuffer.data = (Color*)calloc(BACKBUFFER_WIDTH * BACKBUFFER_HEIGHT, sizeof(Color));
-    backbuffer.depth = (float*)calloc(BACKBUFFER_WIDTH * BACKBUFFER_HEIGHT, sizeof(float));
+    potato_resize(BACKBUFFER_WIDTH, BACKBUFFER_HEIGHT);
+
+#ifdef DOG_TEXTURE_PLACEHOLDER
+    generate_texture_data();
+#endif
 
     // Convert RGBA to BGRA.
     for (size_t i = 0; i < texture_buffer.height; i++) {
@@ -36,6 +70,39 @@ void potato_init() {
     for (size_t i = 0; i < vertex_buffer.length; i++) {
         vertex_buffer.data[i].v = 1.f - vertex_buffer.data[i].v;
     }
+
+    compute_bounding_box(&vertex_buffer, &bounds);
+}
+
+int potato_set_vertex_layout(PotatoVertexLayout layout) {
+    // Other layouts are converted from the float vertices on first use.
+    if (layout == POTATO_VERTEX_LAYOUT_PACKED && packed_vertex_buffer.data == NULL &&
+        !quantize_vertex_buffer(&vertex_buffer, &packed_vertex_buffer)) {
+        packed_vertex_buffer.data = NULL;
+        return 0;
+    }
+
+    if (layout == POTATO_VERTEX_LAYOUT_SOA && soa_vertex_buffer.x == NULL &&
+        !convert_to_soa_vertex_buffer(&vertex_buffer, &soa_vertex_buffer)) {
+        soa_vertex_buffer.x = NULL;
+        return 0;
+    }
+
+    if (layout == POTATO_VERTEX_LAYOUT_MESHLETS && meshlet_buffer.data == NULL &&
+        !build_meshlets(&vertex_buffer, &index_buffer, MESHLET_MAX_VERTICES, MESHLET_MAX_TRIANGLES,
+                        &meshlet_vertex_buffer, &meshlet_index_buffer, &meshlet_buffer)) {
+        meshlet_buffer.data = NULL;
+        return 0;
+    }
+
+    if (layout == POTATO_VERTEX_LAYOUT_LOD && lod_chain.data == NULL &&
+        !build_lod_chain(&vertex_buffer, &index_buffer, LOD_MAX_LEVELS, &lod_vertex_buffer, &lod_chain)) {
+        lod_chain.data = NULL;
+        return 0;
+    }
+
+    vertex_layout = layout;
+    return 1;
 }
 
 void build_translation_matrix(Matrix* result, float x, float y, float z) {
@@ -150,7 +217,10 @@ void mul(const Matrix* a, const Matrix* b, Matrix* result) {
     result->data[15] = a->data[12] * b->data[3] + a->data[13] * b->data[7] + a->data[14] * b->data[11] + a->data[15] * b->data[15];
 }
 
-void potato_update() {
+void potato_clear() {
+    TRACE_BEGIN("clear");
+    PROFILE_BEGIN(PROFILE_STAGE_CLEAR);
+
     for (unsigned int i = 0; i < backbuffer.height; i++) {
         for (unsigned int j = 0; j < backbuffer.width; j++) {
             *(unsigned int*)(backbuffer.data + i * backbuffer.width + j) = 0xFF303030;
@@ -158,8 +228,12 @@ void potato_update() {
         }
     }
 
-    static float angle = 0.f;
-    angle += 0.02f;
+    PROFILE_END(PROFILE_STAGE_CLEAR);
+    TRACE_END("clear");
+}
+
+void potato_draw(float angle, float distance) {
+    TRACE_BEGIN("matrix setup");
 
     Matrix model_rotation = { 0 };
     build_rotation_matrix(&model_rotation, 0.f, 1.f, 0.f, 3.141592653f / 2.f);
@@ -183,21 +257,86 @@ void potato_update() {
     mul(&model_scale, &model_rotation_5, &model);
 
     Matrix view = { 0 };
-    build_translation_matrix(&view, 0.f, -0.25f, 2.f);
+    build_translation_matrix(&view, 0.f, -0.25f, distance);
 
     Matrix model_view = { 0 };
     mul(&model, &view, &model_view);
 
     Matrix projection = { 0 };
-    build_projection_matrix(&projection, 0.942478f, (float)BACKBUFFER_WIDTH / BACKBUFFER_HEIGHT, 0.01f, 100.f);
+    build_projection_matrix(&projection, 0.942478f, (float)backbuffer.width / backbuffer.height, CAMERA_NEAR, CAMERA_FAR);
 
     Matrix model_view_projection = { 0 };
     mul(&model_view, &projection, &model_view_projection);
 
-    rasterize_vertices(&vertex_buffer, &model_view_projection, &texture_buffer, &backbuffer);
+    // Depth of a point on the near plane, which is in front of the camera at view-space z = CAMERA_NEAR.
+    const float near_depth = (CAMERA_NEAR * projection.data[10] + projection.data[14]) / (CAMERA_NEAR * projection.data[11]);
+
+    TRACE_END("matrix setup");
+
+    // The dog's front faces are wound counter-clockwise; culling its back faces skips about half of the triangles before setup.
+    // It isn't pixel-identical: back faces used to fill a few silhouette pixels, so the goldens are recorded with culling on.
+    set_cull_mode(CULL_MODE_BACK, FRONT_FACE_COUNTER_CLOCKWISE);
+    set_near_plane(near_depth);
+
+    switch (vertex_layout) {
+        case POTATO_VERTEX_LAYOUT_PACKED:
+            rasterize_packed(&packed_vertex_buffer, &index_buffer, &model_view_projection, &texture_buffer, &backbuffer);
+            break;
+        case POTATO_VERTEX_LAYOUT_SOA:
+            rasterize_soa(&soa_vertex_buffer, &index_buffer, &model_view_projection, &texture_buffer, &backbuffer);
+            break;
+        case POTATO_VERTEX_LAYOUT_MESHLETS:
+            rasterize_meshlets(&meshlet_vertex_buffer, &meshlet_index_buffer, &meshlet_buffer, &model_view_projection, &texture_buffer, &backbuffer);
+            break;
+        case POTATO_VERTEX_LAYOUT_LOD:
+            rasterize_lod(&lod_vertex_buffer, &lod_chain, &model_view_projection, LOD_MAX_PIXEL_ERROR, &texture_buffer, &backbuffer);
+            break;
+        default:
+            rasterize_indexed(&vertex_buffer, &index_buffer, &model_view_projection, &texture_buffer, &backbuffer);
+            break;
+    }
+
+    set_cull_mode(CULL_MODE_NONE, FRONT_FACE_CLOCKWISE);
+    set_near_plane(INFINITY);
+}
+
+void potato_render(float angle, float distance) {
+    TRACE_BEGIN("frame");
+
+    potato_clear();
+    potato_draw(angle, distance);
+
+    TRACE_END("frame");
+}
+
+void potato_update() {
+    static float angle = 0.f;
+    angle += 0.02f;
+
+    potato_render(angle, 2.f);
+}
+
+unsigned int potato_triangle_count() {
+    return index_buffer.length / 3;
 }
 
 void potato_destroy() {
     free(backbuffer.data);
     free(backbuffer.depth);
+    free(packed_vertex_buffer.data);
+    free_soa_vertex_buffer(&soa_vertex_buffer);
+    free(meshlet_vertex_buffer.data);
+    free(meshlet_index_buffer.data);
+    free(meshlet_buffer.data);
+    free(lod_vertex_buffer.data);
+    free_lod_chain(&lod_chain);
+
+    packed_vertex_buffer.data = NULL;
+    meshlet_vertex_buffer.data = NULL;
+    meshlet_index_buffer.data = NULL;
+    meshlet_buffer.data = NULL;
+    lod_vertex_buffer.data = NULL;
+    vertex_layout = POTATO_VERTEX_LAYOUT_FLOAT;
+
+    release_rasterizer_memory();
 }
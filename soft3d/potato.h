@@ -0,0 +1,40 @@
+// soft3d by Andrej Suvorau, 2019
+
+extern DepthColorBuffer backbuffer;
+
+extern void potato_init();
+extern void potato_update();
+extern void potato_destroy();
+
+// Reallocates the backbuffer with the given dimensions.
+extern void potato_resize(unsigned int width, unsigned int height);
+
+// Fills the backbuffer with the background color and the farthest depth.
+extern void potato_clear();
+
+// Renders the dog rotated by `angle` radians at `distance` from the camera without clearing.
+extern void potato_draw(float angle, float distance);
+
+// `potato_clear` followed by `potato_draw`.
+// `potato_update` is `potato_render` with an angle advancing every frame and a distance of 2.
+extern void potato_render(float angle, float distance);
+
+extern unsigned int potato_triangle_count();
+
+typedef enum {
+    POTATO_VERTEX_LAYOUT_FLOAT,   // `VertexBuffer`, the default.
+    POTATO_VERTEX_LAYOUT_PACKED,  // `PackedVertexBuffer` with 16-bit quantized components.
+    POTATO_VERTEX_LAYOUT_SOA,     // `SoaVertexBuffer`.
+    POTATO_VERTEX_LAYOUT_MESHLETS, // `VertexBuffer` split into meshlets, drawn with `rasterize_meshlets`.
+    POTATO_VERTEX_LAYOUT_LOD       // `VertexBuffer` with a chain of simplified levels, drawn with `rasterize_lod`.
+} PotatoVertexLayout;
+
+// Selects the vertex buffer layout the dog is drawn from. Call after `potato_init`. Returns 0 if the
+// buffer in the new layout couldn't be allocated, in which case the layout is unchanged.
+extern int potato_set_vertex_layout(PotatoVertexLayout layout);
+
+extern void build_translation_matrix(Matrix* result, float x, float y, float z);
+extern void build_scale_matrix(Matrix* result, float scale_x, float scale_y, float scale_z);
+extern void build_rotation_matrix(Matrix* result, float x, float y, float z, float angle);
+extern void build_projection_matrix(Matrix* result, float fov, float aspect, float near, float far);
+extern void mul(const Matrix* a, const Matrix* b, Matrix* result);
@@ -0,0 +1,170 @@
+// soft3d by Andrej Suvorau, 2019
+
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include "soft3d.h"
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <time.h>
+#endif
+
+const char* profile_stage_name(ProfileStage stage) {
+    static const char* names[PROFILE_STAGE_COUNT] = { "clear", "vertex", "setup", "raster" };
+    return stage < PROFILE_STAGE_COUNT ? names[stage] : "unknown";
+}
+
+#if defined(SOFT3D_PROFILE) || defined(SOFT3D_TRACE)
+
+static double get_time_seconds() {
+#ifdef _WIN32
+    LARGE_INTEGER counter, frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return (double)counter.QuadPart / frequency.QuadPart;
+#else
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + time.tv_nsec / 1000000000.0;
+#endif
+}
+
+#endif
+
+#ifdef SOFT3D_PROFILE
+
+unsigned long long profile_accumulators[PROFILE_STAGE_COUNT];
+
+#if !defined(_MSC_VER) && !defined(__x86_64__) && !defined(__i386__)
+unsigned long long profile_ticks() {
+    return (unsigned long long)(get_time_seconds() * 1000000000.0);
+}
+#endif
+
+// Measures how many ticks PROFILE_TICKS makes in a millisecond by spinning for 10 ms.
+static double get_ticks_per_millisecond() {
+    static double ticks_per_millisecond = 0.0;
+    if (ticks_per_millisecond == 0.0) {
+        const double start_time = get_time_seconds();
+        const unsigned long long start_ticks = PROFILE_TICKS();
+
+        double time;
+        do {
+            time = get_time_seconds();
+        } while (time - start_time < 0.01);
+
+        ticks_per_millisecond = (PROFILE_TICKS() - start_ticks) / ((time - start_time) * 1000.0);
+    }
+    return ticks_per_millisecond;
+}
+
+void profile_begin_frame() {
+    for (size_t i = 0; i < PROFILE_STAGE_COUNT; i++) {
+        profile_accumulators[i] = 0;
+    }
+}
+
+void profile_end_frame(ProfileReport* report) {
+    const double ticks_per_millisecond = get_ticks_per_millisecond();
+    for (size_t i = 0; i < PROFILE_STAGE_COUNT; i++) {
+        report->milliseconds[i] = profile_accumulators[i] / ticks_per_millisecond;
+    }
+}
+
+#endif
+
+#ifdef SOFT3D_TRACE
+
+#ifdef _MSC_VER
+#define TRACE_THREAD_LOCAL __declspec(thread)
+#define TRACE_ATOMIC_INCREMENT(value) (InterlockedIncrement(value) - 1)
+#else
+#define TRACE_THREAD_LOCAL __thread
+#define TRACE_ATOMIC_INCREMENT(value) __sync_fetch_and_add((value), 1)
+#endif
+
+typedef struct {
+    const char* name;
+    char phase;
+    unsigned int thread_id;
+    double timestamp;
+} TraceEvent;
+
+static TraceEvent* trace_events = NULL;
+static long trace_capacity = 0;
+static volatile long trace_event_count = 0;
+static double trace_start_time = 0.0;
+static volatile long trace_thread_count = 0;
+static TRACE_THREAD_LOCAL unsigned int trace_thread_id = 0;
+
+static void add_trace_event(const char* name, char phase) {
+    if (trace_events == NULL) {
+        return;
+    }
+
+    if (trace_thread_id == 0) {
+        trace_thread_id = (unsigned int)TRACE_ATOMIC_INCREMENT(&trace_thread_count) + 1;
+    }
+
+    // Events past the capacity are dropped, but still counted to report the overflow.
+    const long index = TRACE_ATOMIC_INCREMENT(&trace_event_count);
+    if (index < trace_capacity) {
+        trace_events[index].name = name;
+        trace_events[index].phase = phase;
+        trace_events[index].thread_id = trace_thread_id;
+        trace_events[index].timestamp = (get_time_seconds() - trace_start_time) * 1000000.0;
+    }
+}
+
+void trace_begin(const char* name) {
+    add_trace_event(name, 'B');
+}
+
+void trace_end(const char* name) {
+    add_trace_event(name, 'E');
+}
+
+int trace_start_capture(unsigned int max_events) {
+    free(trace_events);
+
+    trace_events = (TraceEvent*)malloc(max_events * sizeof(TraceEvent));
+    trace_capacity = trace_events != NULL ? (long)max_events : 0;
+    trace_event_count = 0;
+    trace_start_time = get_time_seconds();
+    return trace_events != NULL;
+}
+
+int trace_stop_capture(const char* path) {
+    TraceEvent* events = trace_events;
+    const long event_count = trace_event_count < trace_capacity ? trace_event_count : trace_capacity;
+    trace_events = NULL;
+
+    if (events == NULL) {
+        return 0;
+    }
+
+    FILE* file = fopen(path, "w");
+    if (file == NULL) {
+        free(events);
+        return 0;
+    }
+
+    fprintf(file, "{\"displayTimeUnit\":\"ms\",\"otherData\":{\"dropped_events\":%ld},\"traceEvents\":[\n", trace_event_count - event_count);
+    for (long i = 0; i < event_count; i++) {
+        fprintf(file, "{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%u}%s\n",
+                events[i].name, events[i].phase, events[i].timestamp, events[i].thread_id, i + 1 < event_count ? "," : "");
+    }
+    fprintf(file, "]}\n");
+
+    free(events);
+    return fclose(file) == 0;
+}
+
+#endif
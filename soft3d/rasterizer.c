@@ -3,26 +3,356 @@
 #include "soft3d.h"
 
 #include <assert.h>
+#include <math.h>
 #include <stdlib.h>
 
-inline RasterizedVertex convert_vertex(const Vertex* vertex, const Matrix* transform, float screen_w, float screen_h) {
+#if defined(__AVX__)
+#include <immintrin.h>
+#define TRANSFORM_AVX
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define TRANSFORM_SSE
+#endif
+
+// Vertices in front of this plane (w > -CLIP_CAMERA_W) are clipped away. It keeps the division by w
+// finite even without a near plane set by `set_near_plane`. The far side of the frustum isn't clipped.
+#define CLIP_CAMERA_W 1e-5f
+
+// Size of the guard band relative to the target, centered on it. Triangles reaching out of the target
+// but not out of the guard band are rasterized with their rows and spans clamped instead of being clipped.
+#define GUARD_BAND_SCALE 4.f
+
+// Outcode bits: the frustum planes a transformed vertex is outside of, in clip space. The side planes
+// are tested twice, once at the edges of the target and once at the edges of the guard band.
+#define CLIP_LEFT 1u
+#define CLIP_RIGHT 2u
+#define CLIP_TOP 4u
+#define CLIP_BOTTOM 8u
+#define CLIP_CAMERA 16u
+#define GUARD_LEFT 32u
+#define GUARD_RIGHT 64u
+#define GUARD_TOP 128u
+#define GUARD_BOTTOM 256u
+#define CLIP_NEAR 512u
+
+// Planes triangles are actually clipped against.
+#define CLIP_PLANES (CLIP_CAMERA | CLIP_NEAR | GUARD_LEFT | GUARD_RIGHT | GUARD_TOP | GUARD_BOTTOM)
+#define CLIP_PLANE_COUNT 6
+
+// A triangle clipped by every plane has at most one more vertex per plane.
+#define MAX_CLIPPED_VERTICES (3 + CLIP_PLANE_COUNT)
+
+// Screen-space positions and outcodes of a whole vertex buffer, stored as separate arrays. Texture
+// coordinates are only stored for vertex formats that need decoding; others are read from the source.
+typedef struct {
+    unsigned int capacity;
+    float* x;
+    float* y;
+    float* z;
+    float* u;
+    float* v;
+    unsigned int* outcodes;
+} TransformedVertices;
+
+// Texture coordinates of vertex `i` are `u[i * stride]` and `v[i * stride]`.
+typedef struct {
+    const float* u;
+    const float* v;
+    unsigned int stride;
+} TextureCoordinates;
+
+// Model-space positions, reread for the few triangles that need clipping. Position of vertex `i` is
+// `x[i * stride]`, `y[i * stride]` and `z[i * stride]`, or the decoded one of `packed` when it's not NULL.
+typedef struct {
+    const float* x;
+    const float* y;
+    const float* z;
+    unsigned int stride;
+    const PackedVertexBuffer* packed;
+    const Matrix* transform;
+} ModelPositions;
+
+typedef struct {
+    float x;
+    float y;
+    float z;
+    float w;
+    float u;
+    float v;
+} ClipVertex;
+
+static PipelineStatistics statistics;
+static OverdrawBuffer* overdraw_buffer = NULL;
+static CullMode cull_mode = CULL_MODE_NONE;
+static FrontFace front_face = FRONT_FACE_CLOCKWISE;
+static ScissorRect scissor_rect = { 0, 0, 0, 0 };
+static int scissor_enabled = 0;
+static float near_plane_depth = INFINITY;
+static unsigned int near_plane_outcode = 0;  // CLIP_NEAR while a near plane is set, so vertices never get the bit otherwise.
+static TransformedVertices transformed_vertices = { 0, NULL, NULL, NULL, NULL, NULL, NULL };
+
+// Outcodes are tested in clip space, before the divide, against the same planes the clipper uses, so
+// vertices behind the camera aren't mirrored into the wrong side. With w < 0, x / w >= -0.5 becomes
+// x <= -0.5w and so on. The right edge is inclusive, the rasterizer treats x as an exclusive span end,
+// and the bottom edge exclusive, as the last row is inclusive. The near plane is z / w <= near_plane_depth,
+// z >= near_plane_depth * w. Comparisons are negated so that NaNs are outside.
+static inline unsigned int get_outcode(float x, float y, float z, float w) {
+    const float half_w = 0.5f * w;
+    const float guard_w = 0.5f * GUARD_BAND_SCALE * w;
+    return (!(x <= -half_w) ? CLIP_LEFT : 0u) | (!(x >= half_w) ? CLIP_RIGHT : 0u) |
+           (!(y <= -half_w) ? CLIP_TOP : 0u) | (!(y > half_w) ? CLIP_BOTTOM : 0u) |
+           (!(w <= -CLIP_CAMERA_W) ? CLIP_CAMERA : 0u) | (!(z >= near_plane_depth * w) ? near_plane_outcode : 0u) |
+           (!(x <= -guard_w) ? GUARD_LEFT : 0u) | (!(x >= guard_w) ? GUARD_RIGHT : 0u) |
+           (!(y <= -guard_w) ? GUARD_TOP : 0u) | (!(y >= guard_w) ? GUARD_BOTTOM : 0u);
+}
+
+static inline RasterizedVertex convert_vertex(const Vertex* vertex, const Matrix* transform, float screen_w, float screen_h, unsigned int* outcode) {
     const float x = vertex->x * transform->data[0] + vertex->y * transform->data[4] + vertex->z * transform->data[8]  + transform->data[12];
     const float y = vertex->x * transform->data[1] + vertex->y * transform->data[5] + vertex->z * transform->data[9]  + transform->data[13];
     const float z = vertex->x * transform->data[2] + vertex->y * transform->data[6] + vertex->z * transform->data[10] + transform->data[14];
     const float w = vertex->x * transform->data[3] + vertex->y * transform->data[7] + vertex->z * transform->data[11] + transform->data[15];
 
-    assert(w != 0.f);
-
     RasterizedVertex result;
     result.x = (x / w + 0.5f) * screen_w;
     result.y = (y / w + 0.5f) * screen_h;
     result.z = z / w;
     result.u = vertex->u;
     result.v = vertex->v;
+
+    *outcode = get_outcode(x, y, z, w);
+    return result;
+}
+
+// Same as `convert_vertex` for a packed vertex, with the position decode folded into `transform`.
+static inline RasterizedVertex convert_packed_vertex(const PackedVertex* vertex, const Matrix* transform, const float* uv_scale, const float* uv_bias,
+                                                     float screen_w, float screen_h, unsigned int* outcode) {
+    const Vertex decoded = { (float)vertex->x, (float)vertex->y, (float)vertex->z, vertex->u * uv_scale[0] + uv_bias[0], vertex->v * uv_scale[1] + uv_bias[1] };
+    return convert_vertex(&decoded, transform, screen_w, screen_h, outcode);
+}
+
+static int reserve_transformed_vertices(unsigned int count) {
+    if (count > transformed_vertices.capacity) {
+        float* data = (float*)realloc(transformed_vertices.x, (size_t)count * 5 * sizeof(float) + (size_t)count * sizeof(unsigned int));
+        if (data == NULL) {
+            return 0;
+        }
+
+        transformed_vertices.capacity = count;
+        transformed_vertices.x = data;
+        transformed_vertices.y = data + count;
+        transformed_vertices.z = data + (size_t)count * 2;
+        transformed_vertices.u = data + (size_t)count * 3;
+        transformed_vertices.v = data + (size_t)count * 4;
+        transformed_vertices.outcodes = (unsigned int*)(data + (size_t)count * 5);
+    }
+    return 1;
+}
+
+// The batched transforms below do the same math as `convert_vertex`, in the same order, so the
+// results are bit-identical. Batches of 8 (AVX) or 4 (SSE) vertices are transformed at once, the
+// rest goes through `convert_vertex`. They only differ in how the components are loaded.
+#if defined(TRANSFORM_AVX)
+#define TRANSFORM_BATCH 8
+
+static inline void transform_batch(__m256 vx, __m256 vy, __m256 vz, const float* m, float screen_w, float screen_h,
+                                   const TransformedVertices* result, unsigned int i) {
+    const __m256 x = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, _mm256_set1_ps(m[0])), _mm256_mul_ps(vy, _mm256_set1_ps(m[4]))), _mm256_mul_ps(vz, _mm256_set1_ps(m[8]))),  _mm256_set1_ps(m[12]));
+    const __m256 y = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, _mm256_set1_ps(m[1])), _mm256_mul_ps(vy, _mm256_set1_ps(m[5]))), _mm256_mul_ps(vz, _mm256_set1_ps(m[9]))),  _mm256_set1_ps(m[13]));
+    const __m256 z = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, _mm256_set1_ps(m[2])), _mm256_mul_ps(vy, _mm256_set1_ps(m[6]))), _mm256_mul_ps(vz, _mm256_set1_ps(m[10]))), _mm256_set1_ps(m[14]));
+    const __m256 w = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, _mm256_set1_ps(m[3])), _mm256_mul_ps(vy, _mm256_set1_ps(m[7]))), _mm256_mul_ps(vz, _mm256_set1_ps(m[11]))), _mm256_set1_ps(m[15]));
+
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 width = _mm256_set1_ps(screen_w);
+    const __m256 height = _mm256_set1_ps(screen_h);
+    const __m256 sx = _mm256_mul_ps(_mm256_add_ps(_mm256_div_ps(x, w), half), width);
+    const __m256 sy = _mm256_mul_ps(_mm256_add_ps(_mm256_div_ps(y, w), half), height);
+    _mm256_storeu_ps(result->x + i, sx);
+    _mm256_storeu_ps(result->y + i, sy);
+    _mm256_storeu_ps(result->z + i, _mm256_div_ps(z, w));
+
+    // Same tests as `get_outcode`, with the comparison masks turned into bits.
+    const __m256 half_w = _mm256_mul_ps(w, half);
+    const __m256 negative_half_w = _mm256_mul_ps(w, _mm256_set1_ps(-0.5f));
+    __m256 outcode = _mm256_and_ps(_mm256_cmp_ps(x, negative_half_w, _CMP_NLE_UQ), _mm256_castsi256_ps(_mm256_set1_epi32(CLIP_LEFT)));
+    outcode = _mm256_or_ps(outcode, _mm256_and_ps(_mm256_cmp_ps(x, half_w, _CMP_NGE_UQ), _mm256_castsi256_ps(_mm256_set1_epi32(CLIP_RIGHT))));
+    outcode = _mm256_or_ps(outcode, _mm256_and_ps(_mm256_cmp_ps(y, negative_half_w, _CMP_NLE_UQ), _mm256_castsi256_ps(_mm256_set1_epi32(CLIP_TOP))));
+    outcode = _mm256_or_ps(outcode, _mm256_and_ps(_mm256_cmp_ps(y, half_w, _CMP_NGT_UQ), _mm256_castsi256_ps(_mm256_set1_epi32(CLIP_BOTTOM))));
+    outcode = _mm256_or_ps(outcode, _mm256_and_ps(_mm256_cmp_ps(w, _mm256_set1_ps(-CLIP_CAMERA_W), _CMP_NLE_UQ), _mm256_castsi256_ps(_mm256_set1_epi32(CLIP_CAMERA))));
+    outcode = _mm256_or_ps(outcode, _mm256_and_ps(_mm256_cmp_ps(z, _mm256_mul_ps(_mm256_set1_ps(near_plane_depth), w), _CMP_NGE_UQ), _mm256_castsi256_ps(_mm256_set1_epi32((int)near_plane_outcode))));
+
+    const __m256 guard_w = _mm256_mul_ps(w, _mm256_set1_ps(0.5f * GUARD_BAND_SCALE));
+    const __m256 negative_guard_w = _mm256_mul_ps(w, _mm256_set1_ps(-0.5f * GUARD_BAND_SCALE));
+    outcode = _mm256_or_ps(outcode, _mm256_and_ps(_mm256_cmp_ps(x, negative_guard_w, _CMP_NLE_UQ), _mm256_castsi256_ps(_mm256_set1_epi32(GUARD_LEFT))));
+    outcode = _mm256_or_ps(outcode, _mm256_and_ps(_mm256_cmp_ps(x, guard_w, _CMP_NGE_UQ), _mm256_castsi256_ps(_mm256_set1_epi32(GUARD_RIGHT))));
+    outcode = _mm256_or_ps(outcode, _mm256_and_ps(_mm256_cmp_ps(y, negative_guard_w, _CMP_NLE_UQ), _mm256_castsi256_ps(_mm256_set1_epi32(GUARD_TOP))));
+    outcode = _mm256_or_ps(outcode, _mm256_and_ps(_mm256_cmp_ps(y, guard_w, _CMP_NGE_UQ), _mm256_castsi256_ps(_mm256_set1_epi32(GUARD_BOTTOM))));
+    _mm256_storeu_si256((__m256i*)(result->outcodes + i), _mm256_castps_si256(outcode));
+}
+
+#elif defined(TRANSFORM_SSE)
+#define TRANSFORM_BATCH 4
+
+static inline void transform_batch(__m128 vx, __m128 vy, __m128 vz, const float* m, float screen_w, float screen_h,
+                                   const TransformedVertices* result, unsigned int i) {
+    const __m128 x = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, _mm_set1_ps(m[0])), _mm_mul_ps(vy, _mm_set1_ps(m[4]))), _mm_mul_ps(vz, _mm_set1_ps(m[8]))),  _mm_set1_ps(m[12]));
+    const __m128 y = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, _mm_set1_ps(m[1])), _mm_mul_ps(vy, _mm_set1_ps(m[5]))), _mm_mul_ps(vz, _mm_set1_ps(m[9]))),  _mm_set1_ps(m[13]));
+    const __m128 z = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, _mm_set1_ps(m[2])), _mm_mul_ps(vy, _mm_set1_ps(m[6]))), _mm_mul_ps(vz, _mm_set1_ps(m[10]))), _mm_set1_ps(m[14]));
+    const __m128 w = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, _mm_set1_ps(m[3])), _mm_mul_ps(vy, _mm_set1_ps(m[7]))), _mm_mul_ps(vz, _mm_set1_ps(m[11]))), _mm_set1_ps(m[15]));
+
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 width = _mm_set1_ps(screen_w);
+    const __m128 height = _mm_set1_ps(screen_h);
+    const __m128 sx = _mm_mul_ps(_mm_add_ps(_mm_div_ps(x, w), half), width);
+    const __m128 sy = _mm_mul_ps(_mm_add_ps(_mm_div_ps(y, w), half), height);
+    _mm_storeu_ps(result->x + i, sx);
+    _mm_storeu_ps(result->y + i, sy);
+    _mm_storeu_ps(result->z + i, _mm_div_ps(z, w));
+
+    // Same tests as `get_outcode`, with the comparison masks turned into bits.
+    const __m128 half_w = _mm_mul_ps(w, half);
+    const __m128 negative_half_w = _mm_mul_ps(w, _mm_set1_ps(-0.5f));
+    __m128 outcode = _mm_and_ps(_mm_cmpnle_ps(x, negative_half_w), _mm_castsi128_ps(_mm_set1_epi32(CLIP_LEFT)));
+    outcode = _mm_or_ps(outcode, _mm_and_ps(_mm_cmpnge_ps(x, half_w), _mm_castsi128_ps(_mm_set1_epi32(CLIP_RIGHT))));
+    outcode = _mm_or_ps(outcode, _mm_and_ps(_mm_cmpnle_ps(y, negative_half_w), _mm_castsi128_ps(_mm_set1_epi32(CLIP_TOP))));
+    outcode = _mm_or_ps(outcode, _mm_and_ps(_mm_cmpngt_ps(y, half_w), _mm_castsi128_ps(_mm_set1_epi32(CLIP_BOTTOM))));
+    outcode = _mm_or_ps(outcode, _mm_and_ps(_mm_cmpnle_ps(w, _mm_set1_ps(-CLIP_CAMERA_W)), _mm_castsi128_ps(_mm_set1_epi32(CLIP_CAMERA))));
+    outcode = _mm_or_ps(outcode, _mm_and_ps(_mm_cmpnge_ps(z, _mm_mul_ps(_mm_set1_ps(near_plane_depth), w)), _mm_castsi128_ps(_mm_set1_epi32((int)near_plane_outcode))));
+
+    const __m128 guard_w = _mm_mul_ps(w, _mm_set1_ps(0.5f * GUARD_BAND_SCALE));
+    const __m128 negative_guard_w = _mm_mul_ps(w, _mm_set1_ps(-0.5f * GUARD_BAND_SCALE));
+    outcode = _mm_or_ps(outcode, _mm_and_ps(_mm_cmpnle_ps(x, negative_guard_w), _mm_castsi128_ps(_mm_set1_epi32(GUARD_LEFT))));
+    outcode = _mm_or_ps(outcode, _mm_and_ps(_mm_cmpnge_ps(x, guard_w), _mm_castsi128_ps(_mm_set1_epi32(GUARD_RIGHT))));
+    outcode = _mm_or_ps(outcode, _mm_and_ps(_mm_cmpnle_ps(y, negative_guard_w), _mm_castsi128_ps(_mm_set1_epi32(GUARD_TOP))));
+    outcode = _mm_or_ps(outcode, _mm_and_ps(_mm_cmpnge_ps(y, guard_w), _mm_castsi128_ps(_mm_set1_epi32(GUARD_BOTTOM))));
+    _mm_storeu_si128((__m128i*)(result->outcodes + i), _mm_castps_si128(outcode));
+}
+
+#endif
+
+static void transform_vertices(const Vertex* vertices, unsigned int count, const Matrix* transform, float screen_w, float screen_h,
+                               const TransformedVertices* result) {
+    unsigned int i = 0;
+
+#if defined(TRANSFORM_AVX)
+    for (; i + TRANSFORM_BATCH <= count; i += TRANSFORM_BATCH) {
+        const Vertex* v = vertices + i;
+        transform_batch(_mm256_setr_ps(v[0].x, v[1].x, v[2].x, v[3].x, v[4].x, v[5].x, v[6].x, v[7].x),
+                        _mm256_setr_ps(v[0].y, v[1].y, v[2].y, v[3].y, v[4].y, v[5].y, v[6].y, v[7].y),
+                        _mm256_setr_ps(v[0].z, v[1].z, v[2].z, v[3].z, v[4].z, v[5].z, v[6].z, v[7].z),
+                        transform->data, screen_w, screen_h, result, i);
+    }
+#elif defined(TRANSFORM_SSE)
+    for (; i + TRANSFORM_BATCH <= count; i += TRANSFORM_BATCH) {
+        const Vertex* v = vertices + i;
+        transform_batch(_mm_setr_ps(v[0].x, v[1].x, v[2].x, v[3].x),
+                        _mm_setr_ps(v[0].y, v[1].y, v[2].y, v[3].y),
+                        _mm_setr_ps(v[0].z, v[1].z, v[2].z, v[3].z),
+                        transform->data, screen_w, screen_h, result, i);
+    }
+#endif
+
+    for (; i < count; i++) {
+        const RasterizedVertex vertex = convert_vertex(vertices + i, transform, screen_w, screen_h, &result->outcodes[i]);
+        result->x[i] = vertex.x;
+        result->y[i] = vertex.y;
+        result->z[i] = vertex.z;
+    }
+}
+
+// Positions are already split by component, so batches are plain vector loads.
+static void transform_soa_vertices(const SoaVertexBuffer* buffer, const Matrix* transform, float screen_w, float screen_h,
+                                   const TransformedVertices* result) {
+    unsigned int i = 0;
+
+#if defined(TRANSFORM_AVX)
+    for (; i + TRANSFORM_BATCH <= buffer->length; i += TRANSFORM_BATCH) {
+        transform_batch(_mm256_loadu_ps(buffer->x + i), _mm256_loadu_ps(buffer->y + i), _mm256_loadu_ps(buffer->z + i),
+                        transform->data, screen_w, screen_h, result, i);
+    }
+#elif defined(TRANSFORM_SSE)
+    for (; i + TRANSFORM_BATCH <= buffer->length; i += TRANSFORM_BATCH) {
+        transform_batch(_mm_loadu_ps(buffer->x + i), _mm_loadu_ps(buffer->y + i), _mm_loadu_ps(buffer->z + i),
+                        transform->data, screen_w, screen_h, result, i);
+    }
+#endif
+
+    for (; i < buffer->length; i++) {
+        const Vertex vertex = { buffer->x[i], buffer->y[i], buffer->z[i], 0.f, 0.f };
+        const RasterizedVertex transformed = convert_vertex(&vertex, transform, screen_w, screen_h, &result->outcodes[i]);
+        result->x[i] = transformed.x;
+        result->y[i] = transformed.y;
+        result->z[i] = transformed.z;
+    }
+}
+
+// The 16-bit components are widened to float in registers and the position decode is folded into
+// `transform`, so only 10 bytes are read per vertex. Texture coordinates are decoded into `result`.
+static void transform_packed_vertices(const PackedVertex* vertices, unsigned int count, const Matrix* transform,
+                                      const float* uv_scale, const float* uv_bias, float screen_w, float screen_h,
+                                      const TransformedVertices* result) {
+    unsigned int i = 0;
+
+#if defined(TRANSFORM_AVX)
+    for (; i + TRANSFORM_BATCH <= count; i += TRANSFORM_BATCH) {
+        const PackedVertex* v = vertices + i;
+        const __m256 vu = _mm256_cvtepi32_ps(_mm256_setr_epi32(v[0].u, v[1].u, v[2].u, v[3].u, v[4].u, v[5].u, v[6].u, v[7].u));
+        const __m256 vv = _mm256_cvtepi32_ps(_mm256_setr_epi32(v[0].v, v[1].v, v[2].v, v[3].v, v[4].v, v[5].v, v[6].v, v[7].v));
+
+        transform_batch(_mm256_cvtepi32_ps(_mm256_setr_epi32(v[0].x, v[1].x, v[2].x, v[3].x, v[4].x, v[5].x, v[6].x, v[7].x)),
+                        _mm256_cvtepi32_ps(_mm256_setr_epi32(v[0].y, v[1].y, v[2].y, v[3].y, v[4].y, v[5].y, v[6].y, v[7].y)),
+                        _mm256_cvtepi32_ps(_mm256_setr_epi32(v[0].z, v[1].z, v[2].z, v[3].z, v[4].z, v[5].z, v[6].z, v[7].z)),
+                        transform->data, screen_w, screen_h, result, i);
+        _mm256_storeu_ps(result->u + i, _mm256_add_ps(_mm256_mul_ps(vu, _mm256_set1_ps(uv_scale[0])), _mm256_set1_ps(uv_bias[0])));
+        _mm256_storeu_ps(result->v + i, _mm256_add_ps(_mm256_mul_ps(vv, _mm256_set1_ps(uv_scale[1])), _mm256_set1_ps(uv_bias[1])));
+    }
+#elif defined(TRANSFORM_SSE)
+    for (; i + TRANSFORM_BATCH <= count; i += TRANSFORM_BATCH) {
+        const PackedVertex* v = vertices + i;
+        const __m128 vu = _mm_cvtepi32_ps(_mm_setr_epi32(v[0].u, v[1].u, v[2].u, v[3].u));
+        const __m128 vv = _mm_cvtepi32_ps(_mm_setr_epi32(v[0].v, v[1].v, v[2].v, v[3].v));
+
+        transform_batch(_mm_cvtepi32_ps(_mm_setr_epi32(v[0].x, v[1].x, v[2].x, v[3].x)),
+                        _mm_cvtepi32_ps(_mm_setr_epi32(v[0].y, v[1].y, v[2].y, v[3].y)),
+                        _mm_cvtepi32_ps(_mm_setr_epi32(v[0].z, v[1].z, v[2].z, v[3].z)),
+                        transform->data, screen_w, screen_h, result, i);
+        _mm_storeu_ps(result->u + i, _mm_add_ps(_mm_mul_ps(vu, _mm_set1_ps(uv_scale[0])), _mm_set1_ps(uv_bias[0])));
+        _mm_storeu_ps(result->v + i, _mm_add_ps(_mm_mul_ps(vv, _mm_set1_ps(uv_scale[1])), _mm_set1_ps(uv_bias[1])));
+    }
+#endif
+
+    for (; i < count; i++) {
+        const RasterizedVertex vertex = convert_packed_vertex(vertices + i, transform, uv_scale, uv_bias, screen_w, screen_h, &result->outcodes[i]);
+        result->x[i] = vertex.x;
+        result->y[i] = vertex.y;
+        result->z[i] = vertex.z;
+        result->u[i] = vertex.u;
+        result->v[i] = vertex.v;
+    }
+}
+
+// Folds the `position_bias + position_scale * q` decode of a packed vertex buffer into `transform`.
+static void fold_position_decode(const PackedVertexBuffer* buffer, const Matrix* transform, Matrix* result) {
+    const float* m = transform->data;
+    for (size_t j = 0; j < 4; j++) {
+        result->data[j] = m[j] * buffer->position_scale[0];
+        result->data[4 + j] = m[4 + j] * buffer->position_scale[1];
+        result->data[8 + j] = m[8 + j] * buffer->position_scale[2];
+        result->data[12 + j] = buffer->position_bias[0] * m[j] + buffer->position_bias[1] * m[4 + j] + buffer->position_bias[2] * m[8 + j] + m[12 + j];
+    }
+}
+
+static inline RasterizedVertex load_transformed_vertex(const TransformedVertices* transformed, const TextureCoordinates* texture_coordinates,
+                                                       unsigned int index) {
+    RasterizedVertex result;
+    result.x = transformed->x[index];
+    result.y = transformed->y[index];
+    result.z = transformed->z[index];
+    result.u = texture_coordinates->u[index * texture_coordinates->stride];
+    result.v = texture_coordinates->v[index * texture_coordinates->stride];
     return result;
 }
 
-inline void sort_vertices(RasterizedTriangle* triangle) {
+static inline void sort_vertices(RasterizedTriangle* triangle) {
     if (triangle->a.y > triangle->b.y) {
         const RasterizedVertex temp = triangle->a;
         triangle->a = triangle->b;
@@ -42,9 +372,9 @@ inline void sort_vertices(RasterizedTriangle* triangle) {
     }
 }
 
-inline void rasterize_pixel(unsigned int x, unsigned int y, const RasterizedTriangle* triangle,
-                            const ColorBuffer* source_buffer, DepthColorBuffer* target_buffer,
-                            const Barycentric* barycentric) {
+static inline unsigned int rasterize_pixel(unsigned int x, unsigned int y, const RasterizedTriangle* triangle,
+                                           const ColorBuffer* source_buffer, DepthColorBuffer* target_buffer,
+                                           const Barycentric* barycentric) {
     assert(x >= 0 && x < target_buffer->width && y >= 0 && y < target_buffer->height);
 
     const float ba = x * barycentric->ax + y * barycentric->ay - barycentric->ac;
@@ -61,93 +391,898 @@ inline void rasterize_pixel(unsigned int x, unsigned int y, const RasterizedTria
 
         target_buffer->data[y * target_buffer->width + x] = source_buffer->data[dv * source_buffer->width + du];
         target_buffer->depth[y * target_buffer->width + x] = z;
+        return 1;
+    }
+    return 0;
+}
+
+static inline unsigned int rasterize_span(unsigned int x_left, unsigned int x_right, unsigned int y, const RasterizedTriangle* triangle,
+                                          const ColorBuffer* source_buffer, DepthColorBuffer* target_buffer,
+                                          const Barycentric* barycentric) {
+    unsigned int pixels_passed = 0;
+    if (overdraw_buffer == NULL) {
+        for (unsigned int x = x_left; x < x_right; x++) {
+            pixels_passed += rasterize_pixel(x, y, triangle, source_buffer, target_buffer, barycentric);
+        }
+    } else {
+        assert(overdraw_buffer->width == target_buffer->width && overdraw_buffer->height == target_buffer->height);
+
+        for (unsigned int x = x_left; x < x_right; x++) {
+            const unsigned int passed = rasterize_pixel(x, y, triangle, source_buffer, target_buffer, barycentric);
+            overdraw_buffer->touches[y * overdraw_buffer->width + x]++;
+            overdraw_buffer->depth_failures[y * overdraw_buffer->width + x] += 1 - passed;
+            pixels_passed += passed;
+        }
+    }
+    return pixels_passed;
+}
+
+// Triangles whose rows and columns span at most this many pixels go through `rasterize_small_triangle`.
+#define SMALL_TRIANGLE_SIZE 2
+
+// Pixels `rasterize_triangle` may write: the target buffer, intersected with the scissor rectangle if it's enabled.
+typedef struct {
+    int x_min;
+    int y_min;
+    int x_max;  // Exclusive.
+    int y_max;  // Exclusive.
+} RasterBounds;
+
+static inline RasterBounds get_raster_bounds(const DepthColorBuffer* target_buffer) {
+    RasterBounds result = { 0, 0, (int)target_buffer->width, (int)target_buffer->height };
+    if (scissor_enabled) {
+        result.x_min = scissor_rect.x < (unsigned int)result.x_max ? (int)scissor_rect.x : result.x_max;
+        result.y_min = scissor_rect.y < (unsigned int)result.y_max ? (int)scissor_rect.y : result.y_max;
+        result.x_max = scissor_rect.width < (unsigned int)(result.x_max - result.x_min) ? result.x_min + (int)scissor_rect.width : result.x_max;
+        result.y_max = scissor_rect.height < (unsigned int)(result.y_max - result.y_min) ? result.y_min + (int)scissor_rect.height : result.y_max;
+    }
+    return result;
+}
+
+// Pixel range [`left`, `right`) of the span between `x0` and `x1`, clamped to [`x_min`, `x_max`). Returns 0 if it's empty.
+static inline int get_clamped_span(float x0, float x1, float x_min, float x_max, unsigned int* left, unsigned int* right) {
+    const float x_left = fmaxf(fminf(x0, x1), x_min);
+    const float x_right = fminf(fmaxf(x0, x1), x_max);
+    if (!(x_left < x_right)) {
+        return 0;
     }
+
+    *left = (unsigned int)x_left;
+    *right = (unsigned int)x_right;
+    return *left < *right;
+}
+
+// Rasterizes the span between `x0` and `x1` on row `y`, clamped to [`x_min`, `x_max`). Returns the
+// number of pixels that passed the depth test and adds the tested ones to `pixels_tested`.
+static inline unsigned int rasterize_clamped_span(float x0, float x1, float x_min, float x_max, unsigned int y, const RasterizedTriangle* triangle,
+                                                  const ColorBuffer* source_buffer, DepthColorBuffer* target_buffer,
+                                                  const Barycentric* barycentric, unsigned long long* pixels_tested) {
+    unsigned int span_left, span_right;
+    if (!get_clamped_span(x0, x1, x_min, x_max, &span_left, &span_right)) {
+        return 0;
+    }
+
+    *pixels_tested += span_right - span_left;
+    return rasterize_span(span_left, span_right, y, triangle, source_buffer, target_buffer, barycentric);
+}
+
+static inline void setup_barycentric(const RasterizedTriangle* triangle, Barycentric* barycentric) {
+    const float ax = triangle->a.x;
+    const float bx = triangle->b.x;
+    const float cx = triangle->c.x;
+
+    const float det = 1.f / ((triangle->b.y - triangle->c.y) * (ax - cx) + (cx - bx) * (triangle->a.y - triangle->c.y));
+    assert(det == det);
+
+    barycentric->ax = (triangle->b.y - triangle->c.y) * det;
+    barycentric->ay = (cx - bx) * det;
+    barycentric->ac = (triangle->c.y * (cx - bx) + cx * (triangle->b.y - triangle->c.y)) * det;
+    barycentric->bx = (triangle->c.y - triangle->a.y) * det;
+    barycentric->by = (ax - cx) * det;
+    barycentric->bc = (cx * (triangle->c.y - triangle->a.y) + triangle->c.y * (ax - cx)) * det;
+}
+
+// Rasterizes a triangle whose rows `ay` to `cy` and columns span at most SMALL_TRIANGLE_SIZE pixels. Its spans
+// are walked exactly like in `rasterize_triangle`, but before the setup, so triangles that turn out to cover
+// no pixel never pay for the reciprocal.
+static void rasterize_small_triangle(const RasterizedTriangle* triangle, int ay, int by, int cy, const RasterBounds* bounds,
+                                     const ColorBuffer* source_buffer, DepthColorBuffer* target_buffer) {
+    const float ax = triangle->a.x;
+    const float bx = triangle->b.x;
+    const float cx = triangle->c.x;
+    const float x_min = (float)bounds->x_min;
+    const float x_max = (float)bounds->x_max;
+
+    unsigned int rows[SMALL_TRIANGLE_SIZE + 1];
+    unsigned int lefts[SMALL_TRIANGLE_SIZE + 1];
+    unsigned int rights[SMALL_TRIANGLE_SIZE + 1];
+    unsigned int span_count = 0;
+
+    const int dy_ab = by - ay;
+    if (dy_ab > 0) {
+        const float dx_ab = (bx - ax) / dy_ab;
+        const float dx_ac = (cx - ax) / (cy - ay);
+
+        for (int i = 0; i < dy_ab; i++) {
+            const int y = ay + i;
+            if (y >= bounds->y_min && y < bounds->y_max &&
+                get_clamped_span(ax + dx_ab * i, ax + dx_ac * i, x_min, x_max, &lefts[span_count], &rights[span_count])) {
+                rows[span_count++] = (unsigned int)y;
+            }
+        }
+    }
+
+    const int dy_bc = cy - by;
+    if (dy_bc > 0) {
+        const float mx = ax + (float)(by - ay) / (cy - ay) * (cx - ax);
+
+        const float dx_bc = (cx - bx) / dy_bc;
+        const float dx_ec = (cx - mx) / dy_bc;
+
+        for (int i = 0; i <= dy_bc; i++) {
+            const int y = by + i;
+            if (y >= bounds->y_min && y < bounds->y_max &&
+                get_clamped_span(bx + dx_bc * i, mx + dx_ec * i, x_min, x_max, &lefts[span_count], &rights[span_count])) {
+                rows[span_count++] = (unsigned int)y;
+            }
+        }
+    }
+
+    if (span_count == 0) {
+        statistics.triangles_rejected++;
+        return;
+    }
+
+    Barycentric barycentric;
+    setup_barycentric(triangle, &barycentric);
+
+    unsigned long long pixels_tested = 0;
+    unsigned long long pixels_passed = 0;
+    for (unsigned int i = 0; i < span_count; i++) {
+        pixels_passed += rasterize_span(lefts[i], rights[i], rows[i], triangle, source_buffer, target_buffer, &barycentric);
+        pixels_tested += rights[i] - lefts[i];
+    }
+
+    statistics.triangles_rasterized++;
+    statistics.pixels_tested += pixels_tested;
+    statistics.pixels_passed += pixels_passed;
+    statistics.texels_fetched += pixels_passed;
 }
 
+// Vertices may lie anywhere in the guard band, rows and spans outside the target buffer and the
+// scissor rectangle are skipped.
 void rasterize_triangle(const RasterizedTriangle* triangle, const ColorBuffer* source_buffer, DepthColorBuffer* target_buffer) {
     assert(triangle->b.y >= triangle->a.y && triangle->c.y >= triangle->b.y);
 
     const float ax = triangle->a.x;
-    const unsigned int ay = (unsigned int)triangle->a.y;
+    const int ay = (int)floorf(triangle->a.y);
 
     const float bx = triangle->b.x;
-    const unsigned int by = (unsigned int)triangle->b.y;
+    const int by = (int)floorf(triangle->b.y);
 
     const float cx = triangle->c.x;
-    const unsigned int cy = (unsigned int)triangle->c.y;
+    const int cy = (int)floorf(triangle->c.y);
 
-    if (cy > ay) {
-        const float det = 1.f / ((triangle->b.y - triangle->c.y) * (ax - cx) + (cx - bx) * (triangle->a.y - triangle->c.y));
-        assert(det == det);
+    // Triangles whose rows or columns all miss the raster bounds are rejected before setup.
+    const RasterBounds bounds = get_raster_bounds(target_buffer);
+    const float x_min = (float)bounds.x_min;
+    const float x_max = (float)bounds.x_max;
+    const float triangle_x_min = fminf(fminf(ax, bx), cx);
+    const float triangle_x_max = fmaxf(fmaxf(ax, bx), cx);
+    const int visible = ay < bounds.y_max && cy >= bounds.y_min && triangle_x_min < x_max && triangle_x_max >= x_min;
+
+    if (cy > ay && visible && cy - ay <= SMALL_TRIANGLE_SIZE && floorf(triangle_x_max) - floorf(triangle_x_min) <= (float)SMALL_TRIANGLE_SIZE) {
+        PROFILE_BEGIN(PROFILE_STAGE_RASTER);
+        rasterize_small_triangle(triangle, ay, by, cy, &bounds, source_buffer, target_buffer);
+        PROFILE_END(PROFILE_STAGE_RASTER);
+    } else if (cy > ay && visible) {
+        PROFILE_BEGIN(PROFILE_STAGE_SETUP);
 
         Barycentric barycentric;
-        barycentric.ax = (triangle->b.y - triangle->c.y) * det;
-        barycentric.ay = (cx - bx) * det;
-        barycentric.ac = (triangle->c.y * (cx - bx) + cx * (triangle->b.y - triangle->c.y)) * det;
-        barycentric.bx = (triangle->c.y - triangle->a.y) * det;
-        barycentric.by = (ax - cx) * det;
-        barycentric.bc = (cx * (triangle->c.y - triangle->a.y) + triangle->c.y * (ax - cx)) * det;
-
-        const unsigned int dy_ab = by - ay;
+        setup_barycentric(triangle, &barycentric);
+
+        PROFILE_END(PROFILE_STAGE_SETUP);
+        PROFILE_BEGIN(PROFILE_STAGE_RASTER);
+
+        unsigned long long pixels_tested = 0;
+        unsigned long long pixels_passed = 0;
+
+        const int dy_ab = by - ay;
         if (dy_ab > 0) {
             const float dx_ab = (bx - ax) / dy_ab;
             const float dx_ac = (cx - ax) / (cy - ay);
 
-            unsigned int i = 0;
-            do {
-                unsigned int x_left = (unsigned int)(ax + dx_ab * i);
-                unsigned int x_right = (unsigned int)(ax + dx_ac * i);
-
-                if (x_right < x_left) {
-                    const float temp = x_left;
-                    x_left = x_right;
-                    x_right = temp;
-                }
-                
-                const float y = ay + i;
-                for (unsigned int x = x_left; x < x_right; x++) {
-                    rasterize_pixel(x, y, triangle, source_buffer, target_buffer, &barycentric);
-                }
-            } while (++i < dy_ab);
-        }
-
-        const unsigned int dy_bc = cy - by;
+            const int last = ay + dy_ab > bounds.y_max ? bounds.y_max - ay : dy_ab;
+            for (int i = ay < bounds.y_min ? bounds.y_min - ay : 0; i < last; i++) {
+                pixels_passed += rasterize_clamped_span(ax + dx_ab * i, ax + dx_ac * i, x_min, x_max, (unsigned int)(ay + i), triangle,
+                                                        source_buffer, target_buffer, &barycentric, &pixels_tested);
+            }
+        }
+
+        const int dy_bc = cy - by;
         if (dy_bc > 0) {
             const float mx = ax + (float)(by - ay) / (cy - ay) * (cx - ax);
 
             const float dx_bc = (cx - bx) / dy_bc;
             const float dx_ec = (cx - mx) / dy_bc;
 
-            unsigned int i = 0;
-            do {
-                unsigned int x_left = (unsigned int)(bx + dx_bc * i);
-                unsigned int x_right = (unsigned int)(mx + dx_ec * i);
+            const int last = by + dy_bc >= bounds.y_max ? bounds.y_max - 1 - by : dy_bc;
+            for (int i = by < bounds.y_min ? bounds.y_min - by : 0; i <= last; i++) {
+                pixels_passed += rasterize_clamped_span(bx + dx_bc * i, mx + dx_ec * i, x_min, x_max, (unsigned int)(by + i), triangle,
+                                                        source_buffer, target_buffer, &barycentric, &pixels_tested);
+            }
+        }
+
+        if (pixels_tested > 0) {
+            statistics.triangles_rasterized++;
+        } else {
+            statistics.triangles_rejected++;
+        }
+        statistics.pixels_tested += pixels_tested;
+        statistics.pixels_passed += pixels_passed;
+        statistics.texels_fetched += pixels_passed;
+
+        PROFILE_END(PROFILE_STAGE_RASTER);
+    } else {
+        statistics.triangles_rejected++;
+    }
+}
+
+// Transforms every vertex of the buffer into `transformed_vertices`. Returns 0 if the transient buffer can't be allocated.
+static int transform_vertex_buffer(const VertexBuffer* buffer, const Matrix* transform, const DepthColorBuffer* target_buffer) {
+    if (!reserve_transformed_vertices(buffer->length)) {
+        assert(!"Failed to allocate transformed vertices.");
+        return 0;
+    }
+
+    TRACE_BEGIN("vertex transform");
+    PROFILE_BEGIN(PROFILE_STAGE_VERTEX);
+
+    transform_vertices(buffer->data, buffer->length, transform, (float)target_buffer->width, (float)target_buffer->height, &transformed_vertices);
+    statistics.vertices_transformed += buffer->length;
+
+    PROFILE_END(PROFILE_STAGE_VERTEX);
+    TRACE_END("vertex transform");
+    return 1;
+}
+
+static int transform_packed_vertex_buffer(const PackedVertexBuffer* buffer, const Matrix* transform, const DepthColorBuffer* target_buffer) {
+    if (!reserve_transformed_vertices(buffer->length)) {
+        assert(!"Failed to allocate transformed vertices.");
+        return 0;
+    }
+
+    TRACE_BEGIN("vertex transform");
+    PROFILE_BEGIN(PROFILE_STAGE_VERTEX);
+
+    Matrix folded;
+    fold_position_decode(buffer, transform, &folded);
+    transform_packed_vertices(buffer->data, buffer->length, &folded, buffer->uv_scale, buffer->uv_bias,
+                              (float)target_buffer->width, (float)target_buffer->height, &transformed_vertices);
+    statistics.vertices_transformed += buffer->length;
+
+    PROFILE_END(PROFILE_STAGE_VERTEX);
+    TRACE_END("vertex transform");
+    return 1;
+}
+
+static int transform_soa_vertex_buffer(const SoaVertexBuffer* buffer, const Matrix* transform, const DepthColorBuffer* target_buffer) {
+    if (!reserve_transformed_vertices(buffer->length)) {
+        assert(!"Failed to allocate transformed vertices.");
+        return 0;
+    }
+
+    TRACE_BEGIN("vertex transform");
+    PROFILE_BEGIN(PROFILE_STAGE_VERTEX);
 
-                if (x_right < x_left) {
-                    const float temp = x_left;
-                    x_left = x_right;
-                    x_right = temp;
-                }
+    transform_soa_vertices(buffer, transform, (float)target_buffer->width, (float)target_buffer->height, &transformed_vertices);
+    statistics.vertices_transformed += buffer->length;
 
-                const float y = by + i;
-                for (unsigned int x = x_left; x < x_right; x++) {
-                    rasterize_pixel(x, y, triangle, source_buffer, target_buffer, &barycentric);
-                }
-            } while (++i <= dy_bc);
+    PROFILE_END(PROFILE_STAGE_VERTEX);
+    TRACE_END("vertex transform");
+    return 1;
+}
+
+static inline unsigned int get_index(const IndexBuffer* buffer, unsigned int i) {
+    return buffer->format == INDEX_FORMAT_UINT16 ? ((const unsigned short*)buffer->data)[i] : ((const unsigned int*)buffer->data)[i];
+}
+
+// The visible volume is -0.5 <= x / w <= 0.5 and -0.5 <= y / w <= 0.5 with w < 0, so the frustum
+// planes in clip space are x - 0.5w >= 0, -x - 0.5w >= 0, y - 0.5w >= 0, -y - 0.5w >= 0 and -w >= 0.
+// Moves them to model space through `transform`, as a, b, c and d of ax + by + cz + d >= 0.
+static void get_model_space_planes(const Matrix* transform, float result[5][4]) {
+    static const float planes[5][4] = {
+        {  1.f,  0.f, 0.f, -0.5f },
+        { -1.f,  0.f, 0.f, -0.5f },
+        {  0.f,  1.f, 0.f, -0.5f },
+        {  0.f, -1.f, 0.f, -0.5f },
+        {  0.f,  0.f, 0.f, -1.f  },
+    };
+
+    const float* m = transform->data;
+    for (size_t i = 0; i < 5; i++) {
+        const float* p = planes[i];
+        result[i][0] = m[0] * p[0] + m[1] * p[1] + m[2] * p[2] + m[3] * p[3];
+        result[i][1] = m[4] * p[0] + m[5] * p[1] + m[6] * p[2] + m[7] * p[3];
+        result[i][2] = m[8] * p[0] + m[9] * p[1] + m[10] * p[2] + m[11] * p[3];
+        result[i][3] = m[12] * p[0] + m[13] * p[1] + m[14] * p[2] + m[15] * p[3];
+    }
+}
+
+// Returns 0 when `bounds` is entirely outside one of the frustum planes, tested against the box
+// corner farthest along their normal.
+static int is_bounding_box_visible(const BoundingBox* bounds, const Matrix* transform) {
+    float planes[5][4];
+    get_model_space_planes(transform, planes);
+
+    for (size_t i = 0; i < 5; i++) {
+        const float a = planes[i][0];
+        const float b = planes[i][1];
+        const float c = planes[i][2];
+        const float d = planes[i][3];
+
+        const float x = a > 0.f ? bounds->max[0] : bounds->min[0];
+        const float y = b > 0.f ? bounds->max[1] : bounds->min[1];
+        const float z = c > 0.f ? bounds->max[2] : bounds->min[2];
+        if (a * x + b * y + c * z + d < 0.f) {
+            return 0;
         }
     }
+    return 1;
+}
+
+// Returns 0 and counts the draw as culled when `bounds` is set and outside the frustum.
+static int is_draw_visible(const BoundingBox* bounds, const Matrix* transform) {
+    if (bounds != NULL && !is_bounding_box_visible(bounds, transform)) {
+        statistics.draws_culled++;
+        return 0;
+    }
+    return 1;
+}
+
+// Upper bound of the pixels a model-space distance of 1 covers anywhere inside `bounds`, or INFINITY
+// if the box reaches the camera plane. The screen position x / w moves by (dx - x / w * dw) / w, and
+// |x / w| <= 0.5 on the target, so the bound holds at the corner where |w| is smallest.
+static float get_projected_scale(const BoundingBox* bounds, const Matrix* transform, float screen_w, float screen_h) {
+    const float* m = transform->data;
+
+    float w_max = m[15];
+    for (size_t i = 0; i < 3; i++) {
+        w_max += m[i * 4 + 3] > 0.f ? bounds->max[i] * m[i * 4 + 3] : bounds->min[i] * m[i * 4 + 3];
+    }
+    if (!(w_max < -CLIP_CAMERA_W)) {
+        return INFINITY;
+    }
+
+    const float x_length = sqrtf(m[0] * m[0] + m[4] * m[4] + m[8] * m[8]);
+    const float y_length = sqrtf(m[1] * m[1] + m[5] * m[5] + m[9] * m[9]);
+    const float w_length = sqrtf(m[3] * m[3] + m[7] * m[7] + m[11] * m[11]);
+    const float scale_x = screen_w * (x_length + 0.5f * w_length);
+    const float scale_y = screen_h * (y_length + 0.5f * w_length);
+    return fmaxf(scale_x, scale_y) / -w_max;
+}
+
+// Model-space view of a draw, for culling meshlets before their vertices are transformed.
+typedef struct {
+    float planes[5][4];
+    float camera[3];
+    float facing;  // Triangles are kept by the cull mode when dot(facing * normal, camera - vertex) > 0, 0 if none are culled.
+} MeshletCulling;
+
+static inline float get_determinant(const float a[3], const float b[3], const float c[3]) {
+    return a[0] * (b[1] * c[2] - b[2] * c[1]) - a[1] * (b[0] * c[2] - b[2] * c[0]) + a[2] * (b[0] * c[1] - b[1] * c[0]);
+}
+
+// The camera is the model-space point `e` with x = y = w = 0 in clip space, so with the rows `A` of
+// the x, y and w columns of `transform` and its translation `t`, e * A = -t. Clip space x, y and w of
+// a vertex `p` are then (p - e) * A, which makes twice the screen-space area of a triangle abc
+// det(A) * dot(cross(b - a, c - a), e - a) * width * height / (w_a * w_b * w_c). All w are negative
+// after clipping, which gives the sign `get_signed_area` culls by. Orthographic transforms have no
+// camera point, so their meshlets are only culled by the frustum.
+static void get_meshlet_culling(const Matrix* transform, MeshletCulling* result) {
+    const float* m = transform->data;
+    const float rows[3][3] = { { m[0], m[1], m[3] }, { m[4], m[5], m[7] }, { m[8], m[9], m[11] } };
+    const float translation[3] = { -m[12], -m[13], -m[15] };
+
+    get_model_space_planes(transform, result->planes);
+
+    const float determinant = get_determinant(rows[0], rows[1], rows[2]);
+    if (cull_mode == CULL_MODE_NONE || determinant == 0.f) {
+        result->camera[0] = result->camera[1] = result->camera[2] = 0.f;
+        result->facing = 0.f;
+        return;
+    }
+
+    // Cramer's rule, on the transposed system.
+    result->camera[0] = get_determinant(translation, rows[1], rows[2]) / determinant;
+    result->camera[1] = get_determinant(rows[0], translation, rows[2]) / determinant;
+    result->camera[2] = get_determinant(rows[0], rows[1], translation) / determinant;
+
+    const float kept_sign = (cull_mode == CULL_MODE_BACK) == (front_face == FRONT_FACE_CLOCKWISE) ? 1.f : -1.f;
+    result->facing = determinant > 0.f ? kept_sign : -kept_sign;
+}
+
+// Returns 0 when the bounding sphere of `meshlet` is outside one of the frustum planes, or when the
+// cull mode drops all of its triangles. That's the case when the camera is within the cone mirrored
+// at the apex, which is behind every triangle's plane. Culling the other side of the triangles needs
+// the mirrored apex, so the bounding sphere stands in for it.
+static int is_meshlet_visible(const Meshlet* meshlet, const MeshletCulling* culling) {
+    for (size_t i = 0; i < 5; i++) {
+        const float* p = culling->planes[i];
+        const float distance = p[0] * meshlet->center[0] + p[1] * meshlet->center[1] + p[2] * meshlet->center[2] + p[3];
+        if (distance < -meshlet->radius * sqrtf(p[0] * p[0] + p[1] * p[1] + p[2] * p[2])) {
+            return 0;
+        }
+    }
+
+    if (culling->facing == 0.f || meshlet->cone_cutoff >= 1.f) {
+        return 1;
+    }
+
+    const float* origin = culling->facing > 0.f ? meshlet->cone_apex : meshlet->center;
+    const float slack = culling->facing > 0.f ? 0.f : meshlet->radius;
+    const float dx = origin[0] - culling->camera[0];
+    const float dy = origin[1] - culling->camera[1];
+    const float dz = origin[2] - culling->camera[2];
+    const float dot = (dx * meshlet->cone_axis[0] + dy * meshlet->cone_axis[1] + dz * meshlet->cone_axis[2]) * culling->facing;
+    return dot < meshlet->cone_cutoff * sqrtf(dx * dx + dy * dy + dz * dz) + slack;
+}
+
+// Returns 0 if the bounding box of the triangle contains no pixel. Rows start at floor(y) and spans at floor(x), so
+// a triangle whose bounding box doesn't cross a pixel boundary in both directions can't be given a pixel.
+static inline int is_covering_pixels(const RasterizedTriangle* triangle) {
+    const float x_min = fminf(fminf(triangle->a.x, triangle->b.x), triangle->c.x);
+    const float x_max = fmaxf(fmaxf(triangle->a.x, triangle->b.x), triangle->c.x);
+    const float y_min = fminf(fminf(triangle->a.y, triangle->b.y), triangle->c.y);
+    const float y_max = fmaxf(fmaxf(triangle->a.y, triangle->b.y), triangle->c.y);
+    return floorf(x_min) != floorf(x_max) && floorf(y_min) != floorf(y_max);
+}
+
+// Twice the signed area of the triangle, positive when it's clockwise in the target buffer.
+static inline float get_signed_area(const RasterizedTriangle* triangle) {
+    return (triangle->b.x - triangle->a.x) * (triangle->c.y - triangle->a.y) - (triangle->c.x - triangle->a.x) * (triangle->b.y - triangle->a.y);
+}
+
+static ClipVertex load_clip_vertex(const ModelPositions* positions, const TextureCoordinates* texture_coordinates, unsigned int index) {
+    float p[3];
+    if (positions->packed != NULL) {
+        const PackedVertex* vertex = positions->packed->data + index;
+        p[0] = positions->packed->position_bias[0] + positions->packed->position_scale[0] * vertex->x;
+        p[1] = positions->packed->position_bias[1] + positions->packed->position_scale[1] * vertex->y;
+        p[2] = positions->packed->position_bias[2] + positions->packed->position_scale[2] * vertex->z;
+    } else {
+        p[0] = positions->x[index * positions->stride];
+        p[1] = positions->y[index * positions->stride];
+        p[2] = positions->z[index * positions->stride];
+    }
+
+    const float* m = positions->transform->data;
+    ClipVertex result;
+    result.x = p[0] * m[0] + p[1] * m[4] + p[2] * m[8] + m[12];
+    result.y = p[0] * m[1] + p[1] * m[5] + p[2] * m[9] + m[13];
+    result.z = p[0] * m[2] + p[1] * m[6] + p[2] * m[10] + m[14];
+    result.w = p[0] * m[3] + p[1] * m[7] + p[2] * m[11] + m[15];
+    result.u = texture_coordinates->u[index * texture_coordinates->stride];
+    result.v = texture_coordinates->v[index * texture_coordinates->stride];
+    return result;
+}
+
+// Signed distance of `vertex` to the clip plane `plane`, non-negative on the visible side. The side
+// planes are the ones of `is_bounding_box_visible`, moved out to the edges of the guard band.
+static inline float get_clip_distance(const ClipVertex* vertex, unsigned int plane) {
+    const float guard = 0.5f * GUARD_BAND_SCALE;
+    switch (plane) {
+        case GUARD_LEFT:   return -vertex->x - guard * vertex->w;
+        case GUARD_RIGHT:  return vertex->x - guard * vertex->w;
+        case GUARD_TOP:    return -vertex->y - guard * vertex->w;
+        case GUARD_BOTTOM: return vertex->y - guard * vertex->w;
+        case CLIP_NEAR:    return vertex->z - near_plane_depth * vertex->w;
+        default:           return -vertex->w - CLIP_CAMERA_W;
+    }
+}
+
+// Clips the convex polygon `vertices` against one plane (Sutherland-Hodgman) into `result`. Returns the new vertex count.
+static unsigned int clip_polygon(const ClipVertex* vertices, unsigned int count, unsigned int plane, ClipVertex* result) {
+    unsigned int result_count = 0;
+    for (unsigned int i = 0; i < count; i++) {
+        const ClipVertex* previous = &vertices[(i + count - 1) % count];
+        const ClipVertex* current = &vertices[i];
+        const float dp = get_clip_distance(previous, plane);
+        const float dc = get_clip_distance(current, plane);
+
+        if ((dp >= 0.f) != (dc >= 0.f)) {
+            const float t = dp / (dp - dc);
+            ClipVertex* vertex = &result[result_count++];
+            vertex->x = previous->x + (current->x - previous->x) * t;
+            vertex->y = previous->y + (current->y - previous->y) * t;
+            vertex->z = previous->z + (current->z - previous->z) * t;
+            vertex->w = previous->w + (current->w - previous->w) * t;
+            vertex->u = previous->u + (current->u - previous->u) * t;
+            vertex->v = previous->v + (current->v - previous->v) * t;
+        }
+        if (dc >= 0.f) {
+            result[result_count++] = *current;
+        }
+    }
+    assert(result_count <= MAX_CLIPPED_VERTICES);
+    return result_count;
+}
+
+// Clips the triangle `a`, `b`, `c` against the planes in `outcode`, which must include the camera plane if any vertex is in front
+// of it, and rasterizes the resulting polygon as a fan. Returns 0 if the whole polygon is culled.
+static int rasterize_clipped_triangle(const ClipVertex* a, const ClipVertex* b, const ClipVertex* c, unsigned int outcode, float kept_sign,
+                                      const ColorBuffer* source_buffer, DepthColorBuffer* target_buffer) {
+    static const unsigned int planes[CLIP_PLANE_COUNT] = { CLIP_CAMERA, CLIP_NEAR, GUARD_LEFT, GUARD_RIGHT, GUARD_TOP, GUARD_BOTTOM };
+
+    ClipVertex buffers[2][MAX_CLIPPED_VERTICES] = { { *a, *b, *c } };
+    unsigned int count = 3;
+    unsigned int current = 0;
+
+    // The camera plane goes first, so that w is negative for the other planes and the projection.
+    for (size_t i = 0; i < CLIP_PLANE_COUNT && count >= 3; i++) {
+        if (outcode & planes[i]) {
+            count = clip_polygon(buffers[current], count, planes[i], buffers[1 - current]);
+            current = 1 - current;
+        }
+    }
+    if (count < 3) {
+        return 1;
+    }
+
+    const float screen_w = (float)target_buffer->width;
+    const float screen_h = (float)target_buffer->height;
+
+    RasterizedVertex projected[MAX_CLIPPED_VERTICES];
+    for (unsigned int i = 0; i < count; i++) {
+        const ClipVertex* vertex = &buffers[current][i];
+        projected[i].x = (vertex->x / vertex->w + 0.5f) * screen_w;
+        projected[i].y = (vertex->y / vertex->w + 0.5f) * screen_h;
+        projected[i].z = vertex->z / vertex->w;
+        projected[i].u = vertex->u;
+        projected[i].v = vertex->v;
+    }
+
+    // Clipping keeps the winding, so the polygon is culled as a whole by its area.
+    if (cull_mode != CULL_MODE_NONE) {
+        float area = 0.f;
+        for (unsigned int i = 0; i < count; i++) {
+            const RasterizedVertex* p = &projected[i];
+            const RasterizedVertex* q = &projected[(i + 1) % count];
+            area += p->x * q->y - q->x * p->y;
+        }
+        if (!(area * kept_sign > 0.f)) {
+            return 0;
+        }
+    }
+
+    for (unsigned int i = 2; i < count; i++) {
+        RasterizedTriangle triangle = { projected[0], projected[i - 1], projected[i] };
+        sort_vertices(&triangle);
+        rasterize_triangle(&triangle, source_buffer, target_buffer);
+    }
+    return 1;
+}
+
+// Assembles `vertex_count` transformed vertices into triangles, through `index_buffer` when it's not NULL, and rasterizes them.
+// Triangles entirely outside a frustum plane are dropped, and ones crossing the camera plane, the near plane or the guard band are clipped
+// from `positions`. Has no trace scope of its own, so draws made of many pieces can open one around all of them.
+static void assemble_triangles(unsigned int vertex_count, const IndexBuffer* index_buffer, const ModelPositions* positions,
+                               const TextureCoordinates* texture_coordinates,
+                               const ColorBuffer* source_buffer, DepthColorBuffer* target_buffer) {
+    // Triangles whose area times this sign isn't positive are culled.
+    const float kept_sign = (cull_mode == CULL_MODE_BACK) == (front_face == FRONT_FACE_CLOCKWISE) ? 1.f : -1.f;
+    unsigned long long triangles_culled = 0;
+    unsigned long long triangles_clipped = 0;
+    unsigned long long triangles_rejected = 0;
+    const unsigned int* outcodes = transformed_vertices.outcodes;
+
+    const unsigned int count = index_buffer != NULL ? index_buffer->length : vertex_count;
+    for (unsigned int i = 0; i < count; i += 3) {
+        const unsigned int a = index_buffer != NULL ? get_index(index_buffer, i) : i;
+        const unsigned int b = index_buffer != NULL ? get_index(index_buffer, i + 1) : i + 1;
+        const unsigned int c = index_buffer != NULL ? get_index(index_buffer, i + 2) : i + 2;
+        assert(a < vertex_count && b < vertex_count && c < vertex_count);
+
+        if (outcodes[a] & outcodes[b] & outcodes[c]) {
+            triangles_clipped++;
+            continue;
+        }
+
+        const unsigned int outcode = (outcodes[a] | outcodes[b] | outcodes[c]) & CLIP_PLANES;
+        if (outcode != 0) {
+            const ClipVertex clip_a = load_clip_vertex(positions, texture_coordinates, a);
+            const ClipVertex clip_b = load_clip_vertex(positions, texture_coordinates, b);
+            const ClipVertex clip_c = load_clip_vertex(positions, texture_coordinates, c);
+            triangles_clipped++;
+            if (!rasterize_clipped_triangle(&clip_a, &clip_b, &clip_c, outcode, kept_sign, source_buffer, target_buffer)) {
+                triangles_culled++;
+            }
+            continue;
+        }
+
+        RasterizedTriangle triangle = { load_transformed_vertex(&transformed_vertices, texture_coordinates, a),
+                                        load_transformed_vertex(&transformed_vertices, texture_coordinates, b),
+                                        load_transformed_vertex(&transformed_vertices, texture_coordinates, c) };
+
+        if (cull_mode != CULL_MODE_NONE && !(get_signed_area(&triangle) * kept_sign > 0.f)) {
+            triangles_culled++;
+            continue;
+        }
+
+        if (!is_covering_pixels(&triangle)) {
+            triangles_rejected++;
+            continue;
+        }
+
+        sort_vertices(&triangle);
+        rasterize_triangle(&triangle, source_buffer, target_buffer);
+    }
+
+    statistics.triangles_culled += triangles_culled;
+    statistics.triangles_clipped += triangles_clipped;
+    statistics.triangles_rejected += triangles_rejected;
+}
+
+static void rasterize_transformed_vertices(unsigned int vertex_count, const IndexBuffer* index_buffer, const ModelPositions* positions,
+                                           const TextureCoordinates* texture_coordinates,
+                                           const ColorBuffer* source_buffer, DepthColorBuffer* target_buffer) {
+    TRACE_BEGIN("raster");
+    assemble_triangles(vertex_count, index_buffer, positions, texture_coordinates, source_buffer, target_buffer);
+    TRACE_END("raster");
 }
 
 void rasterize_vertices(const VertexBuffer* buffer, const Matrix* transform, const ColorBuffer* source_buffer, DepthColorBuffer* target_buffer) {
     assert(buffer != NULL && target_buffer != NULL && target_buffer->data != NULL && source_buffer != NULL && source_buffer->data != NULL);
     assert(buffer->length % 3 == 0);
 
-    for (size_t i = 0; i < buffer->length; i += 3) {
-        RasterizedTriangle triangle = { convert_vertex(buffer->data + i,     transform, (float)target_buffer->width, (float)target_buffer->height),
-                                        convert_vertex(buffer->data + i + 1, transform, (float)target_buffer->width, (float)target_buffer->height),
-                                        convert_vertex(buffer->data + i + 2, transform, (float)target_buffer->width, (float)target_buffer->height) };
+    TRACE_BEGIN("rasterize_vertices");
 
-        sort_vertices(&triangle);
-        rasterize_triangle(&triangle, source_buffer, target_buffer);
+    statistics.triangles_submitted += buffer->length / 3;
+
+    if (is_draw_visible(buffer->bounds, transform) && transform_vertex_buffer(buffer, transform, target_buffer)) {
+        const ModelPositions positions = { &buffer->data->x, &buffer->data->y, &buffer->data->z, sizeof(Vertex) / sizeof(float), NULL, transform };
+        const TextureCoordinates texture_coordinates = { &buffer->data->u, &buffer->data->v, sizeof(Vertex) / sizeof(float) };
+        rasterize_transformed_vertices(buffer->length, NULL, &positions, &texture_coordinates, source_buffer, target_buffer);
     }
+
+    TRACE_END("rasterize_vertices");
 }
+
+void rasterize_indexed(const VertexBuffer* vertex_buffer, const IndexBuffer* index_buffer, const Matrix* transform,
+                       const ColorBuffer* source_buffer, DepthColorBuffer* target_buffer) {
+    assert(vertex_buffer != NULL && index_buffer != NULL && target_buffer != NULL && target_buffer->data != NULL && source_buffer != NULL && source_buffer->data != NULL);
+    assert(index_buffer->length % 3 == 0);
+
+    TRACE_BEGIN("rasterize_indexed");
+
+    statistics.triangles_submitted += index_buffer->length / 3;
+
+    if (is_draw_visible(vertex_buffer->bounds, transform) && transform_vertex_buffer(vertex_buffer, transform, target_buffer)) {
+        const ModelPositions positions = { &vertex_buffer->data->x, &vertex_buffer->data->y, &vertex_buffer->data->z, sizeof(Vertex) / sizeof(float), NULL, transform };
+        const TextureCoordinates texture_coordinates = { &vertex_buffer->data->u, &vertex_buffer->data->v, sizeof(Vertex) / sizeof(float) };
+        rasterize_transformed_vertices(vertex_buffer->length, index_buffer, &positions, &texture_coordinates, source_buffer, target_buffer);
+    }
+
+    TRACE_END("rasterize_indexed");
+}
+
+void rasterize_vertices_instanced(const VertexBuffer* vertex_buffer, const IndexBuffer* index_buffer, const Matrix* transforms,
+                                  const InstanceData* instance_data, unsigned int instance_count,
+                                  const ColorBuffer* source_buffer, DepthColorBuffer* target_buffer) {
+    assert(vertex_buffer != NULL && (transforms != NULL || instance_count == 0) && target_buffer != NULL && target_buffer->data != NULL && source_buffer != NULL && source_buffer->data != NULL);
+    assert(index_buffer != NULL ? index_buffer->length % 3 == 0 : vertex_buffer->length % 3 == 0);
+
+    TRACE_BEGIN("rasterize_vertices_instanced");
+
+    const unsigned int triangle_count = (index_buffer != NULL ? index_buffer->length : vertex_buffer->length) / 3;
+    statistics.triangles_submitted += (unsigned long long)triangle_count * instance_count;
+
+    const TextureCoordinates texture_coordinates = { &vertex_buffer->data->u, &vertex_buffer->data->v, sizeof(Vertex) / sizeof(float) };
+    for (unsigned int i = 0; i < instance_count; i++) {
+        const Matrix* transform = &transforms[i];
+        if (!is_draw_visible(vertex_buffer->bounds, transform) || !transform_vertex_buffer(vertex_buffer, transform, target_buffer)) {
+            continue;
+        }
+
+        const ModelPositions positions = { &vertex_buffer->data->x, &vertex_buffer->data->y, &vertex_buffer->data->z, sizeof(Vertex) / sizeof(float), NULL, transform };
+        const ColorBuffer* instance_source_buffer = instance_data != NULL && instance_data[i].source_buffer != NULL ? instance_data[i].source_buffer : source_buffer;
+        assert(instance_source_buffer->data != NULL);
+        rasterize_transformed_vertices(vertex_buffer->length, index_buffer, &positions, &texture_coordinates, instance_source_buffer, target_buffer);
+    }
+
+    TRACE_END("rasterize_vertices_instanced");
+}
+
+void rasterize_packed(const PackedVertexBuffer* vertex_buffer, const IndexBuffer* index_buffer, const Matrix* transform,
+                      const ColorBuffer* source_buffer, DepthColorBuffer* target_buffer) {
+    assert(vertex_buffer != NULL && target_buffer != NULL && target_buffer->data != NULL && source_buffer != NULL && source_buffer->data != NULL);
+    assert(index_buffer != NULL ? index_buffer->length % 3 == 0 : vertex_buffer->length % 3 == 0);
+
+    TRACE_BEGIN("rasterize_packed");
+
+    statistics.triangles_submitted += (index_buffer != NULL ? index_buffer->length : vertex_buffer->length) / 3;
+
+    if (is_draw_visible(vertex_buffer->bounds, transform) && transform_packed_vertex_buffer(vertex_buffer, transform, target_buffer)) {
+        const ModelPositions positions = { NULL, NULL, NULL, 0, vertex_buffer, transform };
+        const TextureCoordinates texture_coordinates = { transformed_vertices.u, transformed_vertices.v, 1 };
+        rasterize_transformed_vertices(vertex_buffer->length, index_buffer, &positions, &texture_coordinates, source_buffer, target_buffer);
+    }
+
+    TRACE_END("rasterize_packed");
+}
+
+void rasterize_soa(const SoaVertexBuffer* vertex_buffer, const IndexBuffer* index_buffer, const Matrix* transform,
+                   const ColorBuffer* source_buffer, DepthColorBuffer* target_buffer) {
+    assert(vertex_buffer != NULL && target_buffer != NULL && target_buffer->data != NULL && source_buffer != NULL && source_buffer->data != NULL);
+    assert(index_buffer != NULL ? index_buffer->length % 3 == 0 : vertex_buffer->length % 3 == 0);
+
+    TRACE_BEGIN("rasterize_soa");
+
+    statistics.triangles_submitted += (index_buffer != NULL ? index_buffer->length : vertex_buffer->length) / 3;
+
+    if (is_draw_visible(vertex_buffer->bounds, transform) && transform_soa_vertex_buffer(vertex_buffer, transform, target_buffer)) {
+        const ModelPositions positions = { vertex_buffer->x, vertex_buffer->y, vertex_buffer->z, 1, NULL, transform };
+        const TextureCoordinates texture_coordinates = { vertex_buffer->u, vertex_buffer->v, 1 };
+        rasterize_transformed_vertices(vertex_buffer->length, index_buffer, &positions, &texture_coordinates, source_buffer, target_buffer);
+    }
+
+    TRACE_END("rasterize_soa");
+}
+
+void rasterize_meshlets(const VertexBuffer* vertex_buffer, const IndexBuffer* index_buffer, const MeshletBuffer* meshlets,
+                        const Matrix* transform, const ColorBuffer* source_buffer, DepthColorBuffer* target_buffer) {
+    assert(vertex_buffer != NULL && index_buffer != NULL && meshlets != NULL && target_buffer != NULL && target_buffer->data != NULL && source_buffer != NULL && source_buffer->data != NULL);
+    assert(index_buffer->length % 3 == 0);
+
+    TRACE_BEGIN("rasterize_meshlets");
+
+    statistics.triangles_submitted += index_buffer->length / 3;
+
+    if (is_draw_visible(vertex_buffer->bounds, transform) && reserve_transformed_vertices(vertex_buffer->length)) {
+        MeshletCulling culling;
+        get_meshlet_culling(transform, &culling);
+
+        const ModelPositions positions = { &vertex_buffer->data->x, &vertex_buffer->data->y, &vertex_buffer->data->z, sizeof(Vertex) / sizeof(float), NULL, transform };
+        const TextureCoordinates texture_coordinates = { &vertex_buffer->data->u, &vertex_buffer->data->v, sizeof(Vertex) / sizeof(float) };
+        const size_t index_size = index_buffer->format == INDEX_FORMAT_UINT16 ? sizeof(unsigned short) : sizeof(unsigned int);
+        unsigned long long meshlets_culled = 0;
+        unsigned long long vertices_transformed = 0;
+
+        // Only the vertices of visible meshlets are transformed, into their place in the transient buffer.
+        TRACE_BEGIN("vertex transform");
+        PROFILE_BEGIN(PROFILE_STAGE_VERTEX);
+
+        for (unsigned int i = 0; i < meshlets->length; i++) {
+            const Meshlet* meshlet = &meshlets->data[i];
+            assert(meshlet->vertex_offset + meshlet->vertex_count <= vertex_buffer->length);
+            assert(meshlet->index_offset + meshlet->index_count <= index_buffer->length);
+
+            if (!is_meshlet_visible(meshlet, &culling)) {
+                meshlets_culled++;
+                continue;
+            }
+
+            const unsigned int offset = meshlet->vertex_offset;
+            const TransformedVertices transformed = { meshlet->vertex_count, transformed_vertices.x + offset, transformed_vertices.y + offset,
+                                                      transformed_vertices.z + offset, transformed_vertices.u + offset, transformed_vertices.v + offset,
+                                                      transformed_vertices.outcodes + offset };
+            transform_vertices(vertex_buffer->data + offset, meshlet->vertex_count, transform, (float)target_buffer->width, (float)target_buffer->height, &transformed);
+            vertices_transformed += meshlet->vertex_count;
+        }
+
+        PROFILE_END(PROFILE_STAGE_VERTEX);
+        TRACE_END("vertex transform");
+
+        // Visibility is tested again rather than stored, it's a handful of dot products per meshlet.
+        TRACE_BEGIN("raster");
+
+        for (unsigned int i = 0; i < meshlets->length; i++) {
+            const Meshlet* meshlet = &meshlets->data[i];
+            if (is_meshlet_visible(meshlet, &culling)) {
+                const IndexBuffer meshlet_indices = { meshlet->index_count, index_buffer->format, (unsigned char*)index_buffer->data + meshlet->index_offset * index_size };
+                assemble_triangles(vertex_buffer->length, &meshlet_indices, &positions, &texture_coordinates, source_buffer, target_buffer);
+            }
+        }
+
+        TRACE_END("raster");
+
+        statistics.vertices_transformed += vertices_transformed;
+        statistics.meshlets_culled += meshlets_culled;
+    }
+
+    TRACE_END("rasterize_meshlets");
+}
+
+void rasterize_lod(const VertexBuffer* vertex_buffer, const MeshLodChain* lods, const Matrix* transform, float max_pixel_error,
+                   const ColorBuffer* source_buffer, DepthColorBuffer* target_buffer) {
+    assert(vertex_buffer != NULL && lods != NULL && lods->length > 0 && target_buffer != NULL);
+
+    unsigned int level = 0;
+    if (vertex_buffer->bounds != NULL) {
+        const float scale = get_projected_scale(vertex_buffer->bounds, transform, (float)target_buffer->width, (float)target_buffer->height);
+        while (level + 1 < lods->length && lods->data[level + 1].error * scale <= max_pixel_error) {
+            level++;
+        }
+    }
+
+    const MeshLod* lod = &lods->data[level];
+    assert(lod->vertex_count <= vertex_buffer->length);
+
+    const VertexBuffer lod_vertices = { lod->vertex_count, vertex_buffer->data, vertex_buffer->bounds };
+    rasterize_indexed(&lod_vertices, &lod->indices, transform, source_buffer, target_buffer);
+}
+
+void release_rasterizer_memory() {
+    free(transformed_vertices.x);
+
+    transformed_vertices.capacity = 0;
+    transformed_vertices.x = NULL;
+    transformed_vertices.y = NULL;
+    transformed_vertices.z = NULL;
+    transformed_vertices.u = NULL;
+    transformed_vertices.v = NULL;
+    transformed_vertices.outcodes = NULL;
+}
+
+void reset_pipeline_statistics() {
+    const PipelineStatistics empty = { 0 };
+    statistics = empty;
+}
+
+void get_pipeline_statistics(PipelineStatistics* result) {
+    *result = statistics;
+}
+
+void set_cull_mode(CullMode mode, FrontFace face) {
+    cull_mode = mode;
+    front_face = face;
+}
+
+void set_near_plane(float depth) {
+    near_plane_depth = depth;
+    near_plane_outcode = depth < INFINITY ? CLIP_NEAR : 0u;
+}
+
+void set_scissor_rect(const ScissorRect* rect) {
+    if (rect != NULL) {
+        scissor_rect = *rect;
+    }
+    scissor_enabled = rect != NULL;
+}
+
+void set_overdraw_buffer(OverdrawBuffer* buffer) {
+    overdraw_buffer = buffer;
+}
+
+#ifdef SOFT3D_EXPOSE_KERNELS
+
+RasterizedVertex kernel_convert_vertex(const Vertex* vertex, const Matrix* transform, float screen_w, float screen_h) {
+    unsigned int outcode;
+    return convert_vertex(vertex, transform, screen_w, screen_h, &outcode);
+}
+
+void kernel_sort_vertices(RasterizedTriangle* triangle) {
+    sort_vertices(triangle);
+}
+
+void kernel_transform_vertices(const Vertex* vertices, unsigned int count, const Matrix* transform, float screen_w, float screen_h,
+                               float* x, float* y, float* z, unsigned int* outcodes) {
+    const TransformedVertices result = { count, x, y, z, NULL, NULL, outcodes };
+    transform_vertices(vertices, count, transform, screen_w, screen_h, &result);
+}
+
+void kernel_transform_soa_vertices(const SoaVertexBuffer* buffer, const Matrix* transform, float screen_w, float screen_h,
+                                   float* x, float* y, float* z, unsigned int* outcodes) {
+    const TransformedVertices result = { buffer->length, x, y, z, NULL, NULL, outcodes };
+    transform_soa_vertices(buffer, transform, screen_w, screen_h, &result);
+}
+
+void kernel_transform_packed_vertices(const PackedVertexBuffer* buffer, const Matrix* transform, float screen_w, float screen_h,
+                                      float* x, float* y, float* z, float* u, float* v, unsigned int* outcodes) {
+    const TransformedVertices result = { buffer->length, x, y, z, u, v, outcodes };
+    Matrix folded;
+    fold_position_decode(buffer, transform, &folded);
+    transform_packed_vertices(buffer->data, buffer->length, &folded, buffer->uv_scale, buffer->uv_bias, screen_w, screen_h, &result);
+}
+
+#endif
@@ -8,11 +8,96 @@ typedef struct {
     float v;
 } Vertex;
 
+// Axis-aligned box around the positions of a vertex buffer, in model space.
+typedef struct {
+    float min[3];
+    float max[3];
+} BoundingBox;
+
+// `bounds` is optional. When it's set, draws whose bounds are entirely outside the view frustum
+// return before transforming a single vertex.
 typedef struct {
     unsigned int length;
     Vertex* data;
+    const BoundingBox* bounds;
 } VertexBuffer;
 
+// Vertex with positions and texture coordinates quantized to 16-bit unsigned integers. A component
+// `q` decodes to `bias + scale * q` with the scale and bias of its `PackedVertexBuffer`.
+typedef struct {
+    unsigned short x;
+    unsigned short y;
+    unsigned short z;
+    unsigned short u;
+    unsigned short v;
+} PackedVertex;
+
+typedef struct {
+    unsigned int length;
+    PackedVertex* data;
+    float position_scale[3];
+    float position_bias[3];
+    float uv_scale[2];
+    float uv_bias[2];
+    const BoundingBox* bounds;  // Of the decoded positions.
+} PackedVertexBuffer;
+
+// Structure-of-arrays vertex buffer: component `c` of vertex `i` is `c[i]`. Transforms load
+// positions of consecutive vertices with single vector loads, fastest when the arrays are 32-byte aligned.
+typedef struct {
+    unsigned int length;
+    float* x;
+    float* y;
+    float* z;
+    float* u;
+    float* v;
+    const BoundingBox* bounds;
+} SoaVertexBuffer;
+
+typedef enum {
+    INDEX_FORMAT_UINT16,
+    INDEX_FORMAT_UINT32
+} IndexFormat;
+
+typedef struct {
+    unsigned int length;
+    IndexFormat format;
+    void* data;
+} IndexBuffer;
+
+// A cluster of up to a few hundred triangles with its own range of vertices, culled as a whole. Built
+// by `build_meshlets` in `mesh.h`.
+typedef struct {
+    unsigned int vertex_offset;  // Vertices the meshlet's indices refer to.
+    unsigned int vertex_count;
+    unsigned int index_offset;   // The meshlet's triangles in the index buffer.
+    unsigned int index_count;
+    float center[3];             // Bounding sphere.
+    float radius;
+    float cone_apex[3];          // Normal cone, containing the normals of all triangles and with its
+    float cone_axis[3];          // apex behind all their planes.
+    float cone_cutoff;           // Sine of the cone's half-angle, 1 if it's too wide to cull.
+} Meshlet;
+
+typedef struct {
+    unsigned int length;
+    Meshlet* data;
+} MeshletBuffer;
+
+// A level of detail built by `build_lod_chain` in `mesh.h`. Coarser levels reference a prefix of the
+// vertices of finer ones, the first `vertex_count`.
+typedef struct {
+    unsigned int vertex_count;
+    IndexBuffer indices;
+    float error;  // Estimate of the model-space distance to the full mesh, not a bound.
+} MeshLod;
+
+// Level 0 is the full mesh, every following level is coarser.
+typedef struct {
+    unsigned int length;
+    MeshLod* data;
+} MeshLodChain;
+
 typedef struct {
     float data[16];
 } Matrix;
@@ -37,8 +122,56 @@ typedef struct {
     float* depth;
 } DepthColorBuffer;
 
+// Transforms map points in front of the camera to w < 0, and x / w and y / w to [-0.5, 0.5] across
+// the target. Triangles crossing the edges of the target, the camera plane or the near plane set by
+// `set_near_plane` are clipped.
 extern void rasterize_vertices(const VertexBuffer* buffer, const Matrix* transform, const ColorBuffer* source_buffer, DepthColorBuffer* target_buffer);
 
+// Draws the triangle list `index_buffer` refers to. Every vertex of `vertex_buffer` is transformed
+// exactly once, no matter how many triangles share it.
+extern void rasterize_indexed(const VertexBuffer* vertex_buffer, const IndexBuffer* index_buffer, const Matrix* transform,
+                              const ColorBuffer* source_buffer, DepthColorBuffer* target_buffer);
+
+// Per-instance inputs of `rasterize_vertices_instanced` besides the transform.
+typedef struct {
+    const ColorBuffer* source_buffer;  // Texture of the instance, NULL for the one of the draw.
+} InstanceData;
+
+// Draws `instance_count` copies of a vertex buffer, as a triangle list or through `index_buffer` if
+// it's not NULL, one with every transform of `transforms`. `instance_data` is optional, one entry per
+// instance. The draw is validated once, then the shared vertices are transformed once per visible
+// instance into the same transient buffer. Instances whose bounds are outside the frustum are
+// skipped before their transform and counted as culled draws.
+extern void rasterize_vertices_instanced(const VertexBuffer* vertex_buffer, const IndexBuffer* index_buffer, const Matrix* transforms,
+                                         const InstanceData* instance_data, unsigned int instance_count,
+                                         const ColorBuffer* source_buffer, DepthColorBuffer* target_buffer);
+
+// Draws a packed vertex buffer, as a triangle list or through `index_buffer` if it's not NULL. The
+// position decode is folded into `transform` and the 16-bit components are decoded during the transform.
+extern void rasterize_packed(const PackedVertexBuffer* vertex_buffer, const IndexBuffer* index_buffer, const Matrix* transform,
+                             const ColorBuffer* source_buffer, DepthColorBuffer* target_buffer);
+
+// Draws a structure-of-arrays vertex buffer, as a triangle list or through `index_buffer` if it's not NULL.
+extern void rasterize_soa(const SoaVertexBuffer* vertex_buffer, const IndexBuffer* index_buffer, const Matrix* transform,
+                          const ColorBuffer* source_buffer, DepthColorBuffer* target_buffer);
+
+// Draws the meshlets of a vertex and index buffer built by `build_meshlets`. Meshlets outside the
+// frustum, or whose normal cone shows all their triangles would be culled by the cull mode, are
+// skipped before any of their vertices are transformed.
+extern void rasterize_meshlets(const VertexBuffer* vertex_buffer, const IndexBuffer* index_buffer, const MeshletBuffer* meshlets,
+                               const Matrix* transform, const ColorBuffer* source_buffer, DepthColorBuffer* target_buffer);
+
+// Draws the coarsest level of `lods` whose estimated error, projected from the point of `vertex_buffer`'s
+// bounds nearest to the camera, is at most `max_pixel_error` pixels. The estimate is a heuristic, so
+// the actual deviation of the drawn level may exceed it. Only the vertices that level references
+// are transformed. Without bounds, level 0 is drawn.
+extern void rasterize_lod(const VertexBuffer* vertex_buffer, const MeshLodChain* lods, const Matrix* transform, float max_pixel_error,
+                          const ColorBuffer* source_buffer, DepthColorBuffer* target_buffer);
+
+// The `rasterize_*` functions above transform vertex buffers into an internal transient buffer
+// before rasterizing them. The buffer grows with the largest vertex buffer drawn and is freed by this call.
+extern void release_rasterizer_memory();
+
 typedef struct {
     float x;
     float y;
@@ -63,3 +196,151 @@ typedef struct {
 } Barycentric;
 
 extern void rasterize_triangle(const RasterizedTriangle* triangle, const ColorBuffer* source_buffer, DepthColorBuffer* target_buffer);
+
+// Out-of-line copies of the rasterizer's inline stages for microbenchmarks. Not part of the regular build.
+#ifdef SOFT3D_EXPOSE_KERNELS
+extern RasterizedVertex kernel_convert_vertex(const Vertex* vertex, const Matrix* transform, float screen_w, float screen_h);
+extern void kernel_sort_vertices(RasterizedTriangle* triangle);
+extern void kernel_transform_vertices(const Vertex* vertices, unsigned int count, const Matrix* transform, float screen_w, float screen_h,
+                                      float* x, float* y, float* z, unsigned int* outcodes);
+extern void kernel_transform_soa_vertices(const SoaVertexBuffer* buffer, const Matrix* transform, float screen_w, float screen_h,
+                                          float* x, float* y, float* z, unsigned int* outcodes);
+extern void kernel_transform_packed_vertices(const PackedVertexBuffer* buffer, const Matrix* transform, float screen_w, float screen_h,
+                                             float* x, float* y, float* z, float* u, float* v, unsigned int* outcodes);
+#endif
+
+// Counters accumulated by the rasterizer since the last reset.
+typedef struct {
+    unsigned long long vertices_transformed;
+    unsigned long long draws_culled;         // Draws or instances skipped because their bounds are outside the frustum.
+    unsigned long long meshlets_culled;      // Meshlets skipped by their bounding sphere or normal cone.
+    unsigned long long triangles_submitted;
+    unsigned long long triangles_culled;     // Triangles dropped by the cull mode.
+    unsigned long long triangles_clipped;    // Triangles dropped or cut by the frustum planes.
+    unsigned long long triangles_rejected;   // Triangles that test no pixel, whether dropped before setup or after walking their spans.
+    unsigned long long triangles_rasterized; // Triangles that test at least one pixel.
+    unsigned long long pixels_tested;
+    unsigned long long pixels_passed;        // Pixels that passed the depth test.
+    unsigned long long texels_fetched;
+} PipelineStatistics;
+
+extern void reset_pipeline_statistics();
+extern void get_pipeline_statistics(PipelineStatistics* statistics);
+
+typedef enum {
+    CULL_MODE_NONE,
+    CULL_MODE_BACK,
+    CULL_MODE_FRONT
+} CullMode;
+
+// Winding of front faces as they appear in the target buffer, with row 0 at the top.
+typedef enum {
+    FRONT_FACE_CLOCKWISE,
+    FRONT_FACE_COUNTER_CLOCKWISE
+} FrontFace;
+
+// Triangles drawn by the `rasterize_*` functions are culled by the sign of their screen-space area
+// right after the vertex transform, before setup. Zero-area triangles are culled by either mode.
+// `rasterize_triangle` is never culled. The default is `CULL_MODE_NONE`.
+extern void set_cull_mode(CullMode mode, FrontFace front_face);
+
+// Clips triangles where their depth z / w exceeds `depth`, the depth the projection maps its near
+// plane to, as greater depths are nearer. Geometry is always clipped at the camera plane, w = 0, which
+// is all that happens without a near plane: geometry between the camera and the projection's near
+// plane is then drawn with depths beyond the near plane's. Pass INFINITY to disable it, the default.
+extern void set_near_plane(float depth);
+
+// Rectangle of the target buffer, in pixels, that rasterization is limited to.
+typedef struct {
+    unsigned int x;
+    unsigned int y;
+    unsigned int width;
+    unsigned int height;
+} ScissorRect;
+
+// Every triangle, including ones drawn by `rasterize_triangle`, only writes pixels inside `rect` and
+// the target buffer. Rows and spans are clamped before the pixel loop, so pixels outside cost nothing.
+// Pass NULL to disable the scissor test, which is the default.
+extern void set_scissor_rect(const ScissorRect* rect);
+
+// Debug side buffer of the same size as the target buffer. While set, every pixel tested by
+// `rasterize_triangle` increments its touch count and, if it fails the depth test, its depth
+// failure count. Counters are never cleared by the rasterizer.
+typedef struct {
+    unsigned int width;
+    unsigned int height;
+    unsigned int* touches;
+    unsigned int* depth_failures;
+} OverdrawBuffer;
+
+// Pass NULL to disable overdraw accumulation.
+extern void set_overdraw_buffer(OverdrawBuffer* buffer);
+
+typedef enum {
+    PROFILE_STAGE_CLEAR,
+    PROFILE_STAGE_VERTEX,
+    PROFILE_STAGE_SETUP,
+    PROFILE_STAGE_RASTER,
+    PROFILE_STAGE_COUNT
+} ProfileStage;
+
+typedef struct {
+    double milliseconds[PROFILE_STAGE_COUNT];
+} ProfileReport;
+
+// Per-stage timers are compiled in only when SOFT3D_PROFILE is defined. Otherwise PROFILE_BEGIN and
+// PROFILE_END expand to nothing and the rasterizer is exactly the same as without them.
+#ifdef SOFT3D_PROFILE
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define PROFILE_TICKS() __rdtsc()
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define PROFILE_TICKS() __rdtsc()
+#else
+extern unsigned long long profile_ticks();
+#define PROFILE_TICKS() profile_ticks()
+#endif
+
+extern unsigned long long profile_accumulators[PROFILE_STAGE_COUNT];
+
+#define PROFILE_BEGIN(stage) const unsigned long long profile_start_##stage = PROFILE_TICKS()
+#define PROFILE_END(stage) (profile_accumulators[stage] += PROFILE_TICKS() - profile_start_##stage)
+
+// Resets the stage timers. Everything measured until `profile_end_frame` is reported as one frame.
+extern void profile_begin_frame();
+extern void profile_end_frame(ProfileReport* report);
+
+#else
+
+#define PROFILE_BEGIN(stage)
+#define PROFILE_END(stage)
+
+#endif
+
+extern const char* profile_stage_name(ProfileStage stage);
+
+// Timeline events in the Chrome trace format (chrome://tracing, Perfetto), compiled in only when
+// SOFT3D_TRACE is defined. Events are recorded between `trace_start_capture` and
+// `trace_stop_capture` from any thread. Names must outlive the capture.
+#ifdef SOFT3D_TRACE
+
+extern void trace_begin(const char* name);
+extern void trace_end(const char* name);
+
+#define TRACE_BEGIN(name) trace_begin(name)
+#define TRACE_END(name) trace_end(name)
+
+// Returns 1 on success. Events past `max_events` are dropped.
+extern int trace_start_capture(unsigned int max_events);
+
+// Writes the captured events to `path` as JSON. Returns 1 on success.
+extern int trace_stop_capture(const char* path);
+
+#else
+
+#define TRACE_BEGIN(name)
+#define TRACE_END(name)
+
+#endif
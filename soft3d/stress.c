@@ -0,0 +1,220 @@
+// soft3d by Andrej Suvorau, 2019
+
+#include "soft3d.h"
+#include "stress.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#define STRESS_TEXTURE_SIZE 256
+#define STRESS_EXTENT 0.499f
+#define STRESS_GRID_SIZE 10
+
+static const BoundingBox grid_bounds = { { -0.5f, -0.5f, 0.f }, { 0.5f, 0.5f, 0.f } };
+
+static unsigned int next_random(unsigned int* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+static float random_float(unsigned int* state, float min, float max) {
+    return min + (max - min) * (next_random(state) & 0xFFFFFF) / (float)0x1000000;
+}
+
+static Vertex make_vertex(float x, float y, float z) {
+    Vertex vertex = { x, y, z, x + 0.5f, y + 0.5f };
+    return vertex;
+}
+
+static Vertex* add_quad(Vertex* vertices, float left, float top, float right, float bottom, float z) {
+    *vertices++ = make_vertex(left, top, z);
+    *vertices++ = make_vertex(right, top, z);
+    *vertices++ = make_vertex(left, bottom, z);
+    *vertices++ = make_vertex(right, top, z);
+    *vertices++ = make_vertex(right, bottom, z);
+    *vertices++ = make_vertex(left, bottom, z);
+    return vertices;
+}
+
+// Orthographic placement. Every element is negated so that w is -1, the visible side of the near
+// plane, while x / w, y / w and z / w stay the same.
+static void build_instance_matrix(Matrix* result, float scale, float x, float y, float z) {
+    for (size_t i = 0; i < 16; i++) {
+        result->data[i] = 0.f;
+    }
+    result->data[0] = -scale;
+    result->data[5] = -scale;
+    result->data[10] = -1.f;
+    result->data[12] = -x;
+    result->data[13] = -y;
+    result->data[14] = -z;
+    result->data[15] = -1.f;
+}
+
+static unsigned int get_vertex_count(StressSceneType type, unsigned int count) {
+    switch (type) {
+        case STRESS_SCENE_SUBPIXEL:
+        case STRESS_SCENE_SLIVERS:
+            return count * 3;
+        case STRESS_SCENE_FULLSCREEN:
+        case STRESS_SCENE_OVERDRAW:
+            return count * 6;
+        case STRESS_SCENE_INSTANCES:
+            return (STRESS_GRID_SIZE + 1) * (STRESS_GRID_SIZE + 1);
+        default:
+            return 0;
+    }
+}
+
+const char* stress_scene_name(StressSceneType type) {
+    static const char* names[STRESS_SCENE_COUNT] = { "subpixel", "fullscreen", "slivers", "overdraw", "instances" };
+    return type < STRESS_SCENE_COUNT ? names[type] : "unknown";
+}
+
+unsigned int stress_scene_default_count(StressSceneType type) {
+    static const unsigned int counts[STRESS_SCENE_COUNT] = { 1000000, 4, 10000, 64, 1000 };
+    return type < STRESS_SCENE_COUNT ? counts[type] : 0;
+}
+
+int generate_stress_scene(StressScene* scene, StressSceneType type, unsigned int count, unsigned int width, unsigned int height, unsigned int seed) {
+    const unsigned int vertex_count = get_vertex_count(type, count);
+    const unsigned int instance_count = type == STRESS_SCENE_INSTANCES ? count : 1;
+
+    const unsigned int index_count = type == STRESS_SCENE_INSTANCES ? STRESS_GRID_SIZE * STRESS_GRID_SIZE * 6 : 0;
+
+    scene->vertex_buffer.length = vertex_count;
+    scene->vertex_buffer.data = (Vertex*)malloc(vertex_count * sizeof(Vertex));
+    scene->vertex_buffer.bounds = type == STRESS_SCENE_INSTANCES ? &grid_bounds : NULL;
+    scene->index_buffer.length = index_count;
+    scene->index_buffer.format = INDEX_FORMAT_UINT16;
+    scene->index_buffer.data = index_count > 0 ? malloc(index_count * sizeof(unsigned short)) : NULL;
+    scene->texture.width = STRESS_TEXTURE_SIZE;
+    scene->texture.height = STRESS_TEXTURE_SIZE;
+    scene->texture.data = (Color*)malloc(STRESS_TEXTURE_SIZE * STRESS_TEXTURE_SIZE * sizeof(Color));
+    scene->instance_count = instance_count;
+    scene->instances = (Matrix*)malloc(instance_count * sizeof(Matrix));
+
+    if (vertex_count == 0 || scene->vertex_buffer.data == NULL || (index_count > 0 && scene->index_buffer.data == NULL) ||
+        scene->texture.data == NULL || scene->instances == NULL) {
+        destroy_stress_scene(scene);
+        return 0;
+    }
+
+    for (size_t i = 0; i < STRESS_TEXTURE_SIZE; i++) {
+        for (size_t j = 0; j < STRESS_TEXTURE_SIZE; j++) {
+            const unsigned char shade = ((i / 16) + (j / 16)) % 2 ? 0xD0 : 0x50;
+            Color color = { shade, (unsigned char)i, (unsigned char)j, 0xFF };
+            scene->texture.data[i * STRESS_TEXTURE_SIZE + j] = color;
+        }
+    }
+
+    unsigned int random_state = seed != 0 ? seed : 1;
+    const float pixel_width = 1.f / width;
+    const float pixel_height = 1.f / height;
+
+    Vertex* vertices = scene->vertex_buffer.data;
+    switch (type) {
+        case STRESS_SCENE_SUBPIXEL:
+            for (unsigned int i = 0; i < count; i++) {
+                const float x = random_float(&random_state, -STRESS_EXTENT + pixel_width, STRESS_EXTENT - pixel_width);
+                const float y = random_float(&random_state, -STRESS_EXTENT + pixel_height, STRESS_EXTENT - pixel_height);
+                const float z = random_float(&random_state, 0.f, 1.f);
+                for (size_t j = 0; j < 3; j++) {
+                    *vertices++ = make_vertex(x + random_float(&random_state, -0.5f, 0.5f) * pixel_width,
+                                              y + random_float(&random_state, -0.5f, 0.5f) * pixel_height, z);
+                }
+            }
+            break;
+        case STRESS_SCENE_FULLSCREEN:
+            for (unsigned int i = 0; i < count; i++) {
+                vertices = add_quad(vertices, -0.5f, -0.5f, 0.5f, 0.5f, 1.f - (float)i / count);
+            }
+            break;
+        case STRESS_SCENE_SLIVERS:
+            for (unsigned int i = 0; i < count; i++) {
+                const float x0 = random_float(&random_state, -STRESS_EXTENT + pixel_width, STRESS_EXTENT - pixel_width);
+                const float y0 = random_float(&random_state, -STRESS_EXTENT + pixel_height, STRESS_EXTENT - pixel_height);
+                const float x1 = random_float(&random_state, -STRESS_EXTENT + pixel_width, STRESS_EXTENT - pixel_width);
+                const float y1 = random_float(&random_state, -STRESS_EXTENT + pixel_height, STRESS_EXTENT - pixel_height);
+                const float z = random_float(&random_state, 0.f, 1.f);
+
+                // Half a pixel perpendicular to the sliver.
+                const float dx = (x1 - x0) * width;
+                const float dy = (y1 - y0) * height;
+                const float length = (float)sqrt(dx * dx + dy * dy) + 1e-6f;
+
+                *vertices++ = make_vertex(x0, y0, z);
+                *vertices++ = make_vertex(x1, y1, z);
+                *vertices++ = make_vertex(x0 - 0.5f * dy / length * pixel_width, y0 + 0.5f * dx / length * pixel_height, z);
+            }
+            break;
+        case STRESS_SCENE_OVERDRAW:
+            for (unsigned int i = 0; i < count; i++) {
+                vertices = add_quad(vertices, -0.25f, -0.25f, 0.25f, 0.25f, (float)i / count);
+            }
+            break;
+        case STRESS_SCENE_INSTANCES: {
+            for (unsigned int i = 0; i <= STRESS_GRID_SIZE; i++) {
+                for (unsigned int j = 0; j <= STRESS_GRID_SIZE; j++) {
+                    *vertices++ = make_vertex((float)j / STRESS_GRID_SIZE - 0.5f, (float)i / STRESS_GRID_SIZE - 0.5f, 0.f);
+                }
+            }
+
+            unsigned short* indices = (unsigned short*)scene->index_buffer.data;
+            for (unsigned int i = 0; i < STRESS_GRID_SIZE; i++) {
+                for (unsigned int j = 0; j < STRESS_GRID_SIZE; j++) {
+                    const unsigned short top_left = (unsigned short)(i * (STRESS_GRID_SIZE + 1) + j);
+                    const unsigned short bottom_left = (unsigned short)(top_left + STRESS_GRID_SIZE + 1);
+                    *indices++ = top_left;
+                    *indices++ = top_left + 1;
+                    *indices++ = bottom_left;
+                    *indices++ = top_left + 1;
+                    *indices++ = bottom_left + 1;
+                    *indices++ = bottom_left;
+                }
+            }
+            break;
+        }
+        default:
+            break;
+    }
+
+    if (type == STRESS_SCENE_INSTANCES) {
+        const float scale = 0.05f;
+        for (unsigned int i = 0; i < instance_count; i++) {
+            build_instance_matrix(&scene->instances[i], scale,
+                                  random_float(&random_state, -STRESS_EXTENT + scale, STRESS_EXTENT - scale),
+                                  random_float(&random_state, -STRESS_EXTENT + scale, STRESS_EXTENT - scale),
+                                  random_float(&random_state, 0.f, 1.f));
+        }
+    } else {
+        build_instance_matrix(&scene->instances[0], 1.f, 0.f, 0.f, 0.f);
+    }
+
+    return 1;
+}
+
+void render_stress_scene(const StressScene* scene, DepthColorBuffer* target_buffer) {
+    if (scene->index_buffer.length > 0) {
+        rasterize_vertices_instanced(&scene->vertex_buffer, &scene->index_buffer, scene->instances, NULL, scene->instance_count,
+                                     &scene->texture, target_buffer);
+    } else {
+        for (unsigned int i = 0; i < scene->instance_count; i++) {
+            rasterize_vertices(&scene->vertex_buffer, &scene->instances[i], &scene->texture, target_buffer);
+        }
+    }
+}
+
+void destroy_stress_scene(StressScene* scene) {
+    free(scene->vertex_buffer.data);
+    free(scene->index_buffer.data);
+    free(scene->texture.data);
+    free(scene->instances);
+
+    scene->vertex_buffer.data = NULL;
+    scene->index_buffer.data = NULL;
+    scene->texture.data = NULL;
+    scene->instances = NULL;
+}
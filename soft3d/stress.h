@@ -0,0 +1,32 @@
+// soft3d by Andrej Suvorau, 2019
+
+// Synthetic scenes that exercise the rasterizer in ways the dog never does. Vertices are generated in
+// normalized screen coordinates (x and y in [-0.5, 0.5], greater z is nearer) and drawn through the
+// negated orthographic matrices in `instances`, which map them to w = -1, the visible side of the
+// camera, with x / w, y / w and z / w equal to the scene's own. They always stay inside the target buffer.
+
+typedef enum {
+    STRESS_SCENE_SUBPIXEL,   // `count` triangles smaller than a pixel scattered over the screen.
+    STRESS_SCENE_FULLSCREEN, // `count` screen-sized quads, front to back.
+    STRESS_SCENE_SLIVERS,    // `count` sub-pixel wide triangles spanning the screen in random directions.
+    STRESS_SCENE_OVERDRAW,   // `count` stacked half-screen quads, back to front, so every layer passes the depth test.
+    STRESS_SCENE_INSTANCES,  // `count` instances of an indexed 200 triangle grid, drawn with one `rasterize_vertices_instanced` call.
+    STRESS_SCENE_COUNT
+} StressSceneType;
+
+// Scenes with an empty index buffer are drawn with `rasterize_vertices`.
+typedef struct {
+    VertexBuffer vertex_buffer;
+    IndexBuffer index_buffer;
+    ColorBuffer texture;
+    unsigned int instance_count;
+    Matrix* instances;
+} StressScene;
+
+extern const char* stress_scene_name(StressSceneType type);
+extern unsigned int stress_scene_default_count(StressSceneType type);
+
+// Returns 1 on success. The same type, count, size and seed always produce the same scene.
+extern int generate_stress_scene(StressScene* scene, StressSceneType type, unsigned int count, unsigned int width, unsigned int height, unsigned int seed);
+extern void render_stress_scene(const StressScene* scene, DepthColorBuffer* target_buffer);
+extern void destroy_stress_scene(StressScene* scene);